@@ -52,6 +52,13 @@
 /// separate "template instantiation" .h/.c file pair, but you can also provide them inline with
 /// your type like discussed in `CnxVector(T)`'s documentation. \see CnxVector
 ///
+/// If your type is trivially default-constructible (all-zero bits), copyable (`memcpy`-able),
+/// and destructible (needs no cleanup), you can also define `ARRAY_TRIVIAL` to true when
+/// instantiating the definitions. Element construction, copying, and destruction then compile down
+/// to `memset`, `memcpy`, and no-ops respectively, and any user-defined element
+/// constructors/destructors in `CnxCollectionData` are ignored. Without it, the same fast paths
+/// are still taken at runtime for arrays using the default `CnxCollectionData`.
+///
 /// Example:
 ///
 /// @code {.c}
@@ -261,6 +268,7 @@
 #if ARRAY_UNDEF_PARAMS
 	#undef ARRAY_T
 	#undef ARRAY_N
+	#undef ARRAY_TRIVIAL
 	#undef ARRAY_DECL
 	#undef ARRAY_IMPL
 #endif // ARRAY_UNDEF_PARAMS
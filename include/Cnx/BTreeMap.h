@@ -0,0 +1,198 @@
+/// @file BTreeMap.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides an ordered, cache-conscious associative container comparable to
+/// Rust's `std::collections::BTreeMap` for Cnx
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// @ingroup collections
+/// @{
+/// @defgroup cnx_btree_map CnxBTreeMap
+/// `CnxBTreeMap(K, V)` is a struct template for a type-safe ordered map from keys of type `K` to
+/// values of type `V`. It's allocator aware, provides Cnx compatible forward iterators (and so
+/// works with `foreach` and `CnxRange`), and supports user-defined default constructors,
+/// copy-constructors, and destructors for its entries.
+///
+/// `CnxBTreeMap(K, V)` is a B+ tree: all entries live in the leaves, which are linked in key order
+/// so that in-order iteration is a linear walk over densely packed arrays, while internal nodes
+/// only store separator keys and child pointers. Node sizes are fixed at a small multiple of the
+/// cache-line size (configurable, see "Template Parameters" below), so a lookup touches only a
+/// handful of cache lines per level and the tree stays very shallow. Because every node
+/// allocation is one of exactly two sizes (see `cnx_btree_map_leaf_node_size` and
+/// `cnx_btree_map_internal_node_size`), the map pairs well with a fixed-size pool allocator.
+///
+/// In addition to the usual lookup, insertion, and removal, `CnxBTreeMap(K, V)` provides
+/// `cnx_btree_map_lower_bound` and `cnx_btree_map_upper_bound` for ordered range queries, and
+/// `cnx_btree_map_from_sorted` for O(N) bulk-loading from already sorted input.
+///
+/// A set can be modeled by instantiating `CnxBTreeMap(K, V)` with a small placeholder value
+/// type, such as `u8`.
+///
+/// # Instantiation requirements:
+///
+/// 1. `typedef`s of your key and value types to provide alphanumeric names for them (for template
+/// 	and macro parameters)
+/// 2. For key types that aren't arithmetic, a comparison function (see `BTREE_MAP_COMPARE` below)
+///
+/// The entry type, `CnxBTreeMapEntry(K, V)`, and its `Ref`/`ConstRef` typedefs and Cnx iterators
+/// are instantiated along with the map.
+///
+/// # Parameters
+///
+/// `CnxBTreeMap(K, V)` takes several instantiation-time macro parameters, in addition to the
+/// instantiation-mode macro parameters required of all Cnx templates.
+///
+/// ## Instantiation-Mode Parameters
+///
+/// These signal to the implementation to instantiate the declarations, definitions, or both, for
+/// the template.
+/// 1. `BTREE_MAP_DECL` (Optional) - Defining this to true signals to the implementation to
+/// declare the template instantiation when you include `<Cnx/BTreeMap.h>`. This will instantiate
+/// any required type declarations and definitions and any required function declarations. No
+/// functions will be defined. This is optional (but signals intent explicitly) - If required
+/// template parameters are defined and `BTREE_MAP_IMPL` is not, then this will be inferred as
+/// true (`1`) by default.
+/// 2. `BTREE_MAP_IMPL` - Defining this to true signals to the implementation to define the
+/// template instantiation when you include `<Cnx/BTreeMap.h>`. This will instantiate any
+/// required function definitions. If this instantiation-mode hasn't been included in exactly one
+/// translation unit in your build, you will get linking errors due to the missing function
+/// definitions.
+///
+/// ## Template Parameters
+///
+/// These provide the type or value parameters that the template is parameterized on to the
+/// template implementation. These should be `#define`d to their appropriate values.
+/// 1. `BTREE_MAP_K` - The key type to instantiate the map for. This is required.
+/// 2. `BTREE_MAP_V` - The value type to instantiate the map for. This is required.
+/// 3. `BTREE_MAP_COMPARE` - The comparison function used to order keys, of the signature
+/// `i32 (*)(const K* restrict lhs, const K* restrict rhs)`, returning a negative value if
+/// `lhs < rhs`, `0` if they are equal, and a positive value if `lhs > rhs`. This is optional. If
+/// not provided, keys will be compared with the builtin `<` and `>` operators. This only needs to
+/// be provided when instantiating the definitions (`BTREE_MAP_IMPL`).
+/// 4. `BTREE_MAP_NODE_SIZE` - The target size, in bytes, of a tree node. Node capacities are
+/// derived from this so that each node spans a fixed number of cache lines. This is optional. If
+/// not provided, this will default to `CNX_BTREE_MAP_DEFAULT_NODE_SIZE` (four cache lines). If
+/// provided, it must match between the declaration and definition instantiations.
+///
+/// Example:
+///
+/// @code {.c}
+/// // in `MyMap.h`
+/// #define BTREE_MAP_K i32
+/// #define BTREE_MAP_V f64
+/// #define BTREE_MAP_DECL TRUE
+/// #define BTREE_MAP_UNDEF_PARAMS TRUE
+/// #include <Cnx/BTreeMap.h>
+///
+/// // in `MyMap.c`
+/// #include "MyMap.h"
+/// #define BTREE_MAP_K i32
+/// #define BTREE_MAP_V f64
+/// #define BTREE_MAP_IMPL TRUE
+/// #define BTREE_MAP_UNDEF_PARAMS TRUE
+/// #include <Cnx/BTreeMap.h>
+///
+/// // elsewhere
+/// void example(void) {
+/// 	CnxScopedBTreeMap(i32, f64) map = cnx_btree_map_new(i32, f64);
+/// 	cnx_btree_map_insert(map, 3, 3.0);
+/// 	cnx_btree_map_insert(map, 1, 1.0);
+/// 	cnx_btree_map_insert(map, 2, 2.0);
+///
+/// 	// prints "1: 1.0", "2: 2.0", "3: 3.0"
+/// 	foreach(entry, map) {
+/// 		println("{}: {}", entry.m_key, entry.m_value);
+/// 	}
+///
+/// 	// iterate over all the entries with keys in [2, 3)
+/// 	let_mut begin = cnx_btree_map_lower_bound(map, 2);
+/// 	let end = cnx_btree_map_lower_bound(map, 3);
+/// 	for(; !cnx_iterator_equals(begin, end); ignore(cnx_iterator_next(begin))) {
+/// 		let entry = cnx_iterator_current(begin);
+/// 		// ...
+/// 	}
+/// }
+/// @endcode
+/// @}
+
+#include <Cnx/btree_map/BTreeMapDef.h>
+
+#if !defined(BTREE_MAP_DECL) && (!defined(BTREE_MAP_IMPL) || !BTREE_MAP_IMPL) \
+	&& defined(BTREE_MAP_K) && defined(BTREE_MAP_V)
+	#define BTREE_MAP_DECL 1
+#endif // !defined(BTREE_MAP_DECL) && (!defined(BTREE_MAP_IMPL) || !BTREE_MAP_IMPL) \
+	   // && defined(BTREE_MAP_K) && defined(BTREE_MAP_V)
+
+#if(defined(BTREE_MAP_DECL) || defined(BTREE_MAP_IMPL)) && !defined(BTREE_MAP_NODE_SIZE)
+	#define BTREE_MAP_NODE_SIZE CNX_BTREE_MAP_DEFAULT_NODE_SIZE
+#endif // (defined(BTREE_MAP_DECL) || defined(BTREE_MAP_IMPL)) && !defined(BTREE_MAP_NODE_SIZE)
+
+#if(!defined(BTREE_MAP_K) || !defined(BTREE_MAP_V)) && BTREE_MAP_DECL
+	#error BTreeMap.h included with BTREE_MAP_DECL defined true but template parameters BTREE_MAP_K and/or BTREE_MAP_V not defined
+#endif // (!defined(BTREE_MAP_K) || !defined(BTREE_MAP_V)) && BTREE_MAP_DECL
+
+#if(!defined(BTREE_MAP_K) || !defined(BTREE_MAP_V)) && BTREE_MAP_IMPL
+	#error BTreeMap.h included with BTREE_MAP_IMPL defined true but template parameters BTREE_MAP_K and/or BTREE_MAP_V not defined
+#endif // (!defined(BTREE_MAP_K) || !defined(BTREE_MAP_V)) && BTREE_MAP_IMPL
+
+#if BTREE_MAP_DECL && BTREE_MAP_IMPL
+	#define BTREE_MAP_STATIC static
+	#define BTREE_MAP_INLINE inline
+#else
+	#ifndef BTREE_MAP_STATIC
+		#define BTREE_MAP_STATIC
+	#endif // BTREE_MAP_STATIC
+	#ifndef BTREE_MAP_INLINE
+		#define BTREE_MAP_INLINE
+	#endif // BTREE_MAP_INLINE
+#endif	   // BTREE_MAP_DECL && BTREE_MAP_IMPL
+
+#if defined(BTREE_MAP_K) && defined(BTREE_MAP_V) && BTREE_MAP_DECL \
+	&& !CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+	#include <Cnx/btree_map/BTreeMapDecl.h>
+#endif // defined(BTREE_MAP_K) && defined(BTREE_MAP_V) && BTREE_MAP_DECL \
+	   // && !CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+
+#if defined(BTREE_MAP_K) && defined(BTREE_MAP_V) && BTREE_MAP_IMPL \
+	&& !CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+	#include <Cnx/btree_map/BTreeMapImpl.h>
+#endif // defined(BTREE_MAP_K) && defined(BTREE_MAP_V) && BTREE_MAP_IMPL \
+	   // && !CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+
+#if BTREE_MAP_UNDEF_PARAMS
+	#undef BTREE_MAP_K
+	#undef BTREE_MAP_V
+	#undef BTREE_MAP_COMPARE
+	#undef BTREE_MAP_NODE_SIZE
+	#undef BTREE_MAP_DECL
+	#undef BTREE_MAP_IMPL
+	#undef BTREE_MAP_UNDEF_PARAMS
+#endif // BTREE_MAP_UNDEF_PARAMS
+
+#ifdef BTREE_MAP_STATIC
+	#undef BTREE_MAP_STATIC
+#endif // BTREE_MAP_STATIC
+#ifdef BTREE_MAP_INLINE
+	#undef BTREE_MAP_INLINE
+#endif // BTREE_MAP_INLINE
@@ -0,0 +1,773 @@
+/// @file BitVector.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief `CnxBitVector` is a dynamically sized, densely packed set of bits
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// @ingroup collections
+/// @{
+/// @defgroup cnx_bit_vector CnxBitVector
+/// `CnxBitVector` is a dynamically sized, allocator aware set of bits, packed 64 to a word.
+/// Compared to a `CnxVector(bool)`, it uses an eighth of a bit per flag instead of a full byte,
+/// and provides word-at-a-time bulk operations: whole-vector `and`, `or`, `xor`, and `andnot`,
+/// hardware population count, and finding the first or next set bit via count-trailing-zeros. Bulk
+/// operations use AVX2 kernels when the running CPU supports them, falling back to portable
+/// word-at-a-time loops otherwise.
+///
+/// The set bits of a `CnxBitVector` can be iterated over, in increasing order, with `foreach` via
+/// `cnx_bit_vector_set_bits`.
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/BitVector.h>
+/// #include <Cnx/IO.h>
+///
+/// CnxScopedBitVector seen = cnx_bit_vector_new_with_size(1000000);
+/// cnx_bit_vector_set(seen, 42);
+/// cnx_bit_vector_set(seen, 1024);
+///
+/// CnxScopedBitVector wanted = cnx_bit_vector_new_with_size(1000000);
+/// cnx_bit_vector_set_range(wanted, 0, 100);
+///
+/// // `seen` now only contains the bits set in both
+/// cnx_bit_vector_and(seen, wanted);
+/// println("{} ids are both seen and wanted", cnx_bit_vector_count(seen));
+///
+/// let set_bits = cnx_bit_vector_set_bits(seen);
+/// foreach(index, set_bits) {
+/// 	println("{}", index);
+/// }
+/// @endcode
+/// @}
+
+#ifndef CNX_BIT_VECTOR
+/// @brief Declarations related to `CnxBitVector`
+#define CNX_BIT_VECTOR
+
+#include <Cnx/Allocators.h>
+#include <Cnx/BasicTypes.h>
+#include <Cnx/Def.h>
+#include <Cnx/Iterator.h>
+
+/// @brief The number of bits stored in a single word of a `CnxBitVector`
+/// @ingroup cnx_bit_vector
+#define CNX_BIT_VECTOR_BITS_PER_WORD (static_cast(usize)(sizeof(u64) * 8U))
+
+/// @brief Cnx dynamic bitset type
+///
+/// `CnxBitVector` stores its bits packed into an array of `u64` words, with bit `i` stored in
+/// bit `i % 64` of word `i / 64`. Bits in the last word beyond `m_size` are always zero, so whole
+/// words can be operated on without masking.
+/// @ingroup cnx_bit_vector
+typedef struct CnxBitVector {
+	/// @brief The packed bits
+	u64* m_words;
+	/// @brief The number of bits in the vector
+	usize m_size;
+	/// @brief The number of words allocated for `m_words`
+	usize m_capacity;
+	/// @brief The allocator used for memory allocation
+	CnxAllocator m_allocator;
+} CnxBitVector;
+
+/// @brief Cnx bit vector set-bits iterator storage type
+/// `CnxBitVectorSetBitsIterator` is the underlying storage type used by `CnxBitVectorSetBits` for
+/// its iterator type (`CnxForwardIterator(const_usize_ref)`)
+/// @ingroup cnx_bit_vector
+typedef struct CnxBitVectorSetBitsIterator {
+	/// @brief The index of the set bit the iterator currently points to
+	usize m_index;
+	/// @brief The `CnxBitVector` this iterator iterates over
+	const CnxBitVector* m_bit_vector;
+} CnxBitVectorSetBitsIterator;
+
+/// @brief The function vector table of methods associated with `CnxBitVectorSetBits`
+/// @ingroup cnx_bit_vector
+typedef struct cnx_bit_vector_set_bits_vtable_t cnx_bit_vector_set_bits_vtable_t;
+
+/// @brief A lazy view of the indices of the set bits in a `CnxBitVector`, in increasing order
+///
+/// Iterating over a `CnxBitVectorSetBits` skips over unset bits a whole word at a time, so it is
+/// proportional to the number of words plus the number of set bits, not the number of bits.
+/// The view is invalidated by any operation that modifies its associated `CnxBitVector`.
+/// @ingroup cnx_bit_vector
+typedef struct CnxBitVectorSetBits {
+	/// @brief The `CnxBitVector` this is a view of
+	const CnxBitVector* m_bit_vector;
+	/// @brief The function vector table of methods associated with `CnxBitVectorSetBits`
+	const cnx_bit_vector_set_bits_vtable_t* m_vtable;
+} CnxBitVectorSetBits;
+
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxBitVector operation on a nullptr")
+
+/// @brief Creates a new, empty `CnxBitVector`, using the default allocator
+///
+/// @return a new `CnxBitVector`
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) CnxBitVector cnx_bit_vector_new(void);
+/// @brief Creates a new, empty `CnxBitVector`, using the given allocator
+///
+/// @param allocator - The allocator to use for memory allocations
+///
+/// @return a new `CnxBitVector`
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) CnxBitVector cnx_bit_vector_new_with_allocator(CnxAllocator allocator);
+/// @brief Creates a new, empty `CnxBitVector` with at least enough capacity to store `capacity`
+/// bits, using the default allocator
+///
+/// @param capacity - The number of bits to reserve memory for
+///
+/// @return a new `CnxBitVector`
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) CnxBitVector cnx_bit_vector_new_with_capacity(usize capacity);
+/// @brief Creates a new, empty `CnxBitVector` with at least enough capacity to store `capacity`
+/// bits, using the given allocator
+///
+/// @param capacity - The number of bits to reserve memory for
+/// @param allocator - The allocator to use for memory allocations
+///
+/// @return a new `CnxBitVector`
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) CnxBitVector
+	cnx_bit_vector_new_with_capacity_with_allocator(usize capacity, CnxAllocator allocator);
+/// @brief Creates a new `CnxBitVector` containing `size` unset bits, using the default allocator
+///
+/// @param size - The number of bits in the new vector
+///
+/// @return a new `CnxBitVector`
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) CnxBitVector cnx_bit_vector_new_with_size(usize size);
+/// @brief Creates a new `CnxBitVector` containing `size` unset bits, using the given allocator
+///
+/// @param size - The number of bits in the new vector
+/// @param allocator - The allocator to use for memory allocations
+///
+/// @return a new `CnxBitVector`
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) CnxBitVector
+	cnx_bit_vector_new_with_size_with_allocator(usize size, CnxAllocator allocator);
+/// @brief Creates a copy of the given `CnxBitVector`, using the same allocator
+///
+/// @param self - The `CnxBitVector` to copy
+///
+/// @return a copy of `self`
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) CnxBitVector
+	cnx_bit_vector_clone(const CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Frees the memory allocated by the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to free
+/// @ingroup cnx_bit_vector
+__attr(not_null(1)) void cnx_bit_vector_free(void* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief declare a `CnxBitVector` variable with this attribute to have `cnx_bit_vector_free`
+/// automatically called on it at scope end
+/// @ingroup cnx_bit_vector
+#define CnxScopedBitVector scoped(cnx_bit_vector_free)
+
+/// @brief Returns the number of bits in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to get the size of
+///
+/// @return the number of bits in `self`
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) usize
+	cnx_bit_vector_size(const CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns the number of bits the given `CnxBitVector` can store before reallocating
+///
+/// @param self - The `CnxBitVector` to get the capacity of
+///
+/// @return the capacity of `self`, in bits
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) usize
+	cnx_bit_vector_capacity(const CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns whether the given `CnxBitVector` contains no bits
+///
+/// @param self - The `CnxBitVector` to check
+///
+/// @return `true` if `self` has a size of zero, `false` otherwise
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) bool
+	cnx_bit_vector_is_empty(const CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns the number of `u64` words used to store the bits of the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to get the number of words of
+///
+/// @return the number of words used by `self`
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) usize
+	cnx_bit_vector_word_count(const CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns the underlying word array of the given `CnxBitVector`
+///
+/// Bit `i` is stored in bit `i % 64` of word `i / 64`.
+///
+/// @param self - The `CnxBitVector` to get the words of
+///
+/// @return the underlying words of `self`
+/// @note Modifying the bits of the last word past `cnx_bit_vector_size(self)` is undefined behavior
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) u64*
+	cnx_bit_vector_data_mut(CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns the underlying word array of the given `CnxBitVector`
+///
+/// Bit `i` is stored in bit `i % 64` of word `i / 64`.
+///
+/// @param self - The `CnxBitVector` to get the words of
+///
+/// @return the underlying words of `self`
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) const u64*
+	cnx_bit_vector_data_const(const CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns whether the bit at the given index is set
+///
+/// @param self - The `CnxBitVector` to check the bit of
+/// @param index - The index of the bit to check
+///
+/// @return whether the bit at `index` is set
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) bool
+	cnx_bit_vector_test(const CnxBitVector* restrict self, usize index) ___DISABLE_IF_NULL(self);
+/// @brief Sets the bit at the given index
+///
+/// @param self - The `CnxBitVector` to set the bit of
+/// @param index - The index of the bit to set
+/// @ingroup cnx_bit_vector
+__attr(not_null(1)) void
+	cnx_bit_vector_set(CnxBitVector* restrict self, usize index) ___DISABLE_IF_NULL(self);
+/// @brief Resets (unsets) the bit at the given index
+///
+/// @param self - The `CnxBitVector` to reset the bit of
+/// @param index - The index of the bit to reset
+/// @ingroup cnx_bit_vector
+__attr(not_null(1)) void
+	cnx_bit_vector_reset(CnxBitVector* restrict self, usize index) ___DISABLE_IF_NULL(self);
+/// @brief Flips the bit at the given index
+///
+/// @param self - The `CnxBitVector` to flip the bit of
+/// @param index - The index of the bit to flip
+/// @ingroup cnx_bit_vector
+__attr(not_null(1)) void
+	cnx_bit_vector_flip(CnxBitVector* restrict self, usize index) ___DISABLE_IF_NULL(self);
+/// @brief Sets the bit at the given index to the given value
+///
+/// @param self - The `CnxBitVector` to assign the bit of
+/// @param index - The index of the bit to assign
+/// @param value - The value to assign to the bit
+/// @ingroup cnx_bit_vector
+__attr(not_null(1)) void
+	cnx_bit_vector_assign(CnxBitVector* restrict self, usize index, bool value)
+		___DISABLE_IF_NULL(self);
+/// @brief Sets the `count` bits starting at `index`
+///
+/// Interior words are filled whole, so this is proportional to the number of words covered,
+/// not the number of bits.
+///
+/// @param self - The `CnxBitVector` to set the bits of
+/// @param index - The index of the first bit to set
+/// @param count - The number of bits to set
+/// @ingroup cnx_bit_vector
+__attr(not_null(1)) void
+	cnx_bit_vector_set_range(CnxBitVector* restrict self, usize index, usize count)
+		___DISABLE_IF_NULL(self);
+/// @brief Resets (unsets) the `count` bits starting at `index`
+///
+/// Interior words are cleared whole, so this is proportional to the number of words covered,
+/// not the number of bits.
+///
+/// @param self - The `CnxBitVector` to reset the bits of
+/// @param index - The index of the first bit to reset
+/// @param count - The number of bits to reset
+/// @ingroup cnx_bit_vector
+__attr(not_null(1)) void
+	cnx_bit_vector_reset_range(CnxBitVector* restrict self, usize index, usize count)
+		___DISABLE_IF_NULL(self);
+/// @brief Sets every bit in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to set the bits of
+/// @ingroup cnx_bit_vector
+__attr(not_null(1)) void
+	cnx_bit_vector_set_all(CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Resets (unsets) every bit in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to reset the bits of
+/// @ingroup cnx_bit_vector
+__attr(not_null(1)) void
+	cnx_bit_vector_reset_all(CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Flips every bit in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to flip the bits of
+/// @ingroup cnx_bit_vector
+__attr(not_null(1)) void
+	cnx_bit_vector_flip_all(CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Appends a bit with the given value to the end of the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to append to
+/// @param value - The value of the bit to append
+/// @ingroup cnx_bit_vector
+__attr(not_null(1)) void
+	cnx_bit_vector_push_back(CnxBitVector* restrict self, bool value) ___DISABLE_IF_NULL(self);
+/// @brief Resizes the given `CnxBitVector` to contain `new_size` bits.
+///
+/// If `new_size` is greater than the current size, the new bits are unset.
+///
+/// @param self - The `CnxBitVector` to resize
+/// @param new_size - The new number of bits
+/// @ingroup cnx_bit_vector
+__attr(not_null(1)) void
+	cnx_bit_vector_resize(CnxBitVector* restrict self, usize new_size) ___DISABLE_IF_NULL(self);
+/// @brief Ensures the given `CnxBitVector` can store at least `new_capacity` bits without
+/// reallocating
+///
+/// @param self - The `CnxBitVector` to reserve memory for
+/// @param new_capacity - The number of bits to reserve memory for
+/// @ingroup cnx_bit_vector
+__attr(not_null(1)) void cnx_bit_vector_reserve(CnxBitVector* restrict self, usize new_capacity)
+	___DISABLE_IF_NULL(self);
+/// @brief Shrinks the memory allocation of the given `CnxBitVector` to the minimum necessary to
+/// store its current bits
+///
+/// @param self - The `CnxBitVector` to shrink
+/// @ingroup cnx_bit_vector
+__attr(not_null(1)) void
+	cnx_bit_vector_shrink_to_fit(CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Removes every bit from the given `CnxBitVector`, leaving its capacity unchanged
+///
+/// @param self - The `CnxBitVector` to clear
+/// @ingroup cnx_bit_vector
+__attr(not_null(1)) void
+	cnx_bit_vector_clear(CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Sets `self` to the bitwise and of `self` and `other`
+///
+/// @param self - The `CnxBitVector` to store the result in
+/// @param other - The `CnxBitVector` to combine with `self`. Must be the same size as `self`
+/// @ingroup cnx_bit_vector
+__attr(not_null(1, 2)) void
+	cnx_bit_vector_and(CnxBitVector* restrict self, const CnxBitVector* restrict other)
+		___DISABLE_IF_NULL(self) ___DISABLE_IF_NULL(other);
+/// @brief Sets `self` to the bitwise or of `self` and `other`
+///
+/// @param self - The `CnxBitVector` to store the result in
+/// @param other - The `CnxBitVector` to combine with `self`. Must be the same size as `self`
+/// @ingroup cnx_bit_vector
+__attr(not_null(1, 2)) void
+	cnx_bit_vector_or(CnxBitVector* restrict self, const CnxBitVector* restrict other)
+		___DISABLE_IF_NULL(self) ___DISABLE_IF_NULL(other);
+/// @brief Sets `self` to the bitwise exclusive or of `self` and `other`
+///
+/// @param self - The `CnxBitVector` to store the result in
+/// @param other - The `CnxBitVector` to combine with `self`. Must be the same size as `self`
+/// @ingroup cnx_bit_vector
+__attr(not_null(1, 2)) void
+	cnx_bit_vector_xor(CnxBitVector* restrict self, const CnxBitVector* restrict other)
+		___DISABLE_IF_NULL(self) ___DISABLE_IF_NULL(other);
+/// @brief Sets `self` to the bitwise and of `self` and the complement of `other` (the set
+/// difference `self - other`)
+///
+/// @param self - The `CnxBitVector` to store the result in
+/// @param other - The `CnxBitVector` to remove from `self`. Must be the same size as `self`
+/// @ingroup cnx_bit_vector
+__attr(not_null(1, 2)) void
+	cnx_bit_vector_andnot(CnxBitVector* restrict self, const CnxBitVector* restrict other)
+		___DISABLE_IF_NULL(self) ___DISABLE_IF_NULL(other);
+/// @brief Returns whether the two `CnxBitVector`s have the same size and the same bits set
+///
+/// @param self - The first `CnxBitVector` to compare
+/// @param other - The second `CnxBitVector` to compare
+///
+/// @return whether `self` and `other` are equal
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1, 2)) bool
+	cnx_bit_vector_equals(const CnxBitVector* restrict self, const CnxBitVector* restrict other)
+		___DISABLE_IF_NULL(self) ___DISABLE_IF_NULL(other);
+
+/// @brief Returns the number of set bits in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to count the set bits of
+///
+/// @return the number of set bits in `self`
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) usize
+	cnx_bit_vector_count(const CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns whether any bit in the given `CnxBitVector` is set
+///
+/// @param self - The `CnxBitVector` to check
+///
+/// @return `true` if at least one bit is set, `false` otherwise
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) bool
+	cnx_bit_vector_any(const CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns whether no bit in the given `CnxBitVector` is set
+///
+/// @param self - The `CnxBitVector` to check
+///
+/// @return `true` if no bits are set, `false` otherwise
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) bool
+	cnx_bit_vector_none(const CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns whether every bit in the given `CnxBitVector` is set
+///
+/// @param self - The `CnxBitVector` to check
+///
+/// @return `true` if every bit is set (or `self` is empty), `false` otherwise
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) bool
+	cnx_bit_vector_all(const CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns the index of the first set bit in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to search
+///
+/// @return the index of the first set bit, or `cnx_bit_vector_size(self)` if no bits are set
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) usize
+	cnx_bit_vector_find_first_set(const CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns the index of the first set bit after `index` in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to search
+/// @param index - The index to search after
+///
+/// @return the index of the first set bit after `index`, or `cnx_bit_vector_size(self)` if
+/// there are none
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) usize
+	cnx_bit_vector_find_next_set(const CnxBitVector* restrict self, usize index)
+		___DISABLE_IF_NULL(self);
+/// @brief Returns the index of the first unset bit in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to search
+///
+/// @return the index of the first unset bit, or `cnx_bit_vector_size(self)` if every bit is set
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) usize
+	cnx_bit_vector_find_first_unset(const CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns the index of the first unset bit after `index` in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to search
+/// @param index - The index to search after
+///
+/// @return the index of the first unset bit after `index`, or `cnx_bit_vector_size(self)` if
+/// there are none
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) usize
+	cnx_bit_vector_find_next_unset(const CnxBitVector* restrict self, usize index)
+		___DISABLE_IF_NULL(self);
+
+/// @brief Returns a view of the indices of the set bits in the given `CnxBitVector`, suitable for
+/// use with `foreach`
+///
+/// @param self - The `CnxBitVector` to get the set bits of
+///
+/// @return a `CnxBitVectorSetBits` view of `self`
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) CnxBitVectorSetBits
+	cnx_bit_vector_set_bits(const CnxBitVector* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Implement the Trait `CnxForwardIterator` for `CnxBitVectorSetBitsIterator`
+DeclIntoCnxForwardIterator(CnxBitVectorSetBits,
+						   const_usize_ref,
+						   cnx_bit_vector_set_bits_into_iter);
+
+/// @brief Returns a `CnxForwardIterator(const_usize_ref)` at the first set bit of the given view
+///
+/// @param self - The `CnxBitVectorSetBits` to get an iterator into
+///
+/// @return an iterator at the beginning of the iteration
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) CnxForwardIterator(const_usize_ref)
+	cnx_bit_vector_set_bits_begin(const CnxBitVectorSetBits* restrict self)
+		___DISABLE_IF_NULL(self);
+/// @brief Returns a `CnxForwardIterator(const_usize_ref)` at the end of the given view
+///
+/// @param self - The `CnxBitVectorSetBits` to get an iterator into
+///
+/// @return an iterator at the end of the iteration
+/// @ingroup cnx_bit_vector
+__attr(nodiscard) __attr(not_null(1)) CnxForwardIterator(const_usize_ref)
+	cnx_bit_vector_set_bits_end(const CnxBitVectorSetBits* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief The function vector table of methods associated with `CnxBitVectorSetBits`
+/// @ingroup cnx_bit_vector
+typedef struct cnx_bit_vector_set_bits_vtable_t {
+	/// @brief Returns a `CnxForwardIterator(const_usize_ref)` at the first set bit
+	CnxForwardIterator(const_usize_ref) (*const begin)(const CnxBitVectorSetBits* restrict self);
+	/// @brief Returns a `CnxForwardIterator(const_usize_ref)` at the end of the iteration
+	CnxForwardIterator(const_usize_ref) (*const end)(const CnxBitVectorSetBits* restrict self);
+	/// @brief Returns a `CnxForwardIterator(const_usize_ref)` at the first set bit
+	CnxForwardIterator(const_usize_ref) (*const cbegin)(const CnxBitVectorSetBits* restrict self);
+	/// @brief Returns a `CnxForwardIterator(const_usize_ref)` at the end of the iteration
+	CnxForwardIterator(const_usize_ref) (*const cend)(const CnxBitVectorSetBits* restrict self);
+} cnx_bit_vector_set_bits_vtable_t;
+
+/// @brief Creates a copy of the given `CnxBitVector`, using the same allocator
+///
+/// @param self - The `CnxBitVector` to copy
+///
+/// @return a copy of `self`
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_clone(self) cnx_bit_vector_clone(&(self))
+/// @brief Frees the memory allocated by the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to free
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_free(self) cnx_bit_vector_free(&(self))
+/// @brief Returns the number of bits in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to get the size of
+///
+/// @return the number of bits in `self`
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_size(self) cnx_bit_vector_size(&(self))
+/// @brief Returns the number of bits the given `CnxBitVector` can store before reallocating
+///
+/// @param self - The `CnxBitVector` to get the capacity of
+///
+/// @return the capacity of `self`, in bits
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_capacity(self) cnx_bit_vector_capacity(&(self))
+/// @brief Returns whether the given `CnxBitVector` contains no bits
+///
+/// @param self - The `CnxBitVector` to check
+///
+/// @return `true` if `self` has a size of zero, `false` otherwise
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_is_empty(self) cnx_bit_vector_is_empty(&(self))
+/// @brief Returns the number of `u64` words used to store the bits of the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to get the number of words of
+///
+/// @return the number of words used by `self`
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_word_count(self) cnx_bit_vector_word_count(&(self))
+// clang-format off
+/// @brief Returns the underlying word array of the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to get the words of
+///
+/// @return the underlying words of `self`
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_data(self) (_Generic((&(self)), 				\
+	CnxBitVector* 			: cnx_bit_vector_data_mut, 				\
+	const CnxBitVector* 	: cnx_bit_vector_data_const)(&(self)))
+// clang-format on
+/// @brief Returns whether the bit at the given index is set
+///
+/// @param self - The `CnxBitVector` to check the bit of
+/// @param index - The index of the bit to check
+///
+/// @return whether the bit at `index` is set
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_test(self, index) cnx_bit_vector_test(&(self), (index))
+/// @brief Sets the bit at the given index
+///
+/// @param self - The `CnxBitVector` to set the bit of
+/// @param index - The index of the bit to set
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_set(self, index) cnx_bit_vector_set(&(self), (index))
+/// @brief Resets (unsets) the bit at the given index
+///
+/// @param self - The `CnxBitVector` to reset the bit of
+/// @param index - The index of the bit to reset
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_reset(self, index) cnx_bit_vector_reset(&(self), (index))
+/// @brief Flips the bit at the given index
+///
+/// @param self - The `CnxBitVector` to flip the bit of
+/// @param index - The index of the bit to flip
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_flip(self, index) cnx_bit_vector_flip(&(self), (index))
+/// @brief Sets the bit at the given index to the given value
+///
+/// @param self - The `CnxBitVector` to assign the bit of
+/// @param index - The index of the bit to assign
+/// @param value - The value to assign to the bit
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_assign(self, index, value) cnx_bit_vector_assign(&(self), (index), (value))
+/// @brief Sets the `count` bits starting at `index`
+///
+/// @param self - The `CnxBitVector` to set the bits of
+/// @param index - The index of the first bit to set
+/// @param count - The number of bits to set
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_set_range(self, index, count) \
+	cnx_bit_vector_set_range(&(self), (index), (count))
+/// @brief Resets (unsets) the `count` bits starting at `index`
+///
+/// @param self - The `CnxBitVector` to reset the bits of
+/// @param index - The index of the first bit to reset
+/// @param count - The number of bits to reset
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_reset_range(self, index, count) \
+	cnx_bit_vector_reset_range(&(self), (index), (count))
+/// @brief Sets every bit in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to set the bits of
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_set_all(self) cnx_bit_vector_set_all(&(self))
+/// @brief Resets (unsets) every bit in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to reset the bits of
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_reset_all(self) cnx_bit_vector_reset_all(&(self))
+/// @brief Flips every bit in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to flip the bits of
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_flip_all(self) cnx_bit_vector_flip_all(&(self))
+/// @brief Appends a bit with the given value to the end of the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to append to
+/// @param value - The value of the bit to append
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_push_back(self, value) cnx_bit_vector_push_back(&(self), (value))
+/// @brief Resizes the given `CnxBitVector` to contain `new_size` bits.
+///
+/// @param self - The `CnxBitVector` to resize
+/// @param new_size - The new number of bits
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_resize(self, new_size) cnx_bit_vector_resize(&(self), (new_size))
+/// @brief Ensures the given `CnxBitVector` can store at least `new_capacity` bits without
+/// reallocating
+///
+/// @param self - The `CnxBitVector` to reserve memory for
+/// @param new_capacity - The number of bits to reserve memory for
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_reserve(self, new_capacity) cnx_bit_vector_reserve(&(self), (new_capacity))
+/// @brief Shrinks the memory allocation of the given `CnxBitVector` to the minimum necessary to
+/// store its current bits
+///
+/// @param self - The `CnxBitVector` to shrink
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_shrink_to_fit(self) cnx_bit_vector_shrink_to_fit(&(self))
+/// @brief Removes every bit from the given `CnxBitVector`, leaving its capacity unchanged
+///
+/// @param self - The `CnxBitVector` to clear
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_clear(self) cnx_bit_vector_clear(&(self))
+/// @brief Sets `self` to the bitwise and of `self` and `other`
+///
+/// @param self - The `CnxBitVector` to store the result in
+/// @param other - The `CnxBitVector` to combine with `self`. Must be the same size as `self`
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_and(self, other) cnx_bit_vector_and(&(self), &(other))
+/// @brief Sets `self` to the bitwise or of `self` and `other`
+///
+/// @param self - The `CnxBitVector` to store the result in
+/// @param other - The `CnxBitVector` to combine with `self`. Must be the same size as `self`
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_or(self, other) cnx_bit_vector_or(&(self), &(other))
+/// @brief Sets `self` to the bitwise exclusive or of `self` and `other`
+///
+/// @param self - The `CnxBitVector` to store the result in
+/// @param other - The `CnxBitVector` to combine with `self`. Must be the same size as `self`
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_xor(self, other) cnx_bit_vector_xor(&(self), &(other))
+/// @brief Sets `self` to the bitwise and of `self` and the complement of `other`
+///
+/// @param self - The `CnxBitVector` to store the result in
+/// @param other - The `CnxBitVector` to remove from `self`. Must be the same size as `self`
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_andnot(self, other) cnx_bit_vector_andnot(&(self), &(other))
+/// @brief Returns whether the two `CnxBitVector`s have the same size and the same bits set
+///
+/// @param self - The first `CnxBitVector` to compare
+/// @param other - The second `CnxBitVector` to compare
+///
+/// @return whether `self` and `other` are equal
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_equals(self, other) cnx_bit_vector_equals(&(self), &(other))
+/// @brief Returns the number of set bits in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to count the set bits of
+///
+/// @return the number of set bits in `self`
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_count(self) cnx_bit_vector_count(&(self))
+/// @brief Returns whether any bit in the given `CnxBitVector` is set
+///
+/// @param self - The `CnxBitVector` to check
+///
+/// @return `true` if at least one bit is set, `false` otherwise
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_any(self) cnx_bit_vector_any(&(self))
+/// @brief Returns whether no bit in the given `CnxBitVector` is set
+///
+/// @param self - The `CnxBitVector` to check
+///
+/// @return `true` if no bits are set, `false` otherwise
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_none(self) cnx_bit_vector_none(&(self))
+/// @brief Returns whether every bit in the given `CnxBitVector` is set
+///
+/// @param self - The `CnxBitVector` to check
+///
+/// @return `true` if every bit is set (or `self` is empty), `false` otherwise
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_all(self) cnx_bit_vector_all(&(self))
+/// @brief Returns the index of the first set bit in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to search
+///
+/// @return the index of the first set bit, or `cnx_bit_vector_size(self)` if no bits are set
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_find_first_set(self) cnx_bit_vector_find_first_set(&(self))
+/// @brief Returns the index of the first set bit after `index` in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to search
+/// @param index - The index to search after
+///
+/// @return the index of the first set bit after `index`, or `cnx_bit_vector_size(self)` if
+/// there are none
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_find_next_set(self, index) cnx_bit_vector_find_next_set(&(self), (index))
+/// @brief Returns the index of the first unset bit in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to search
+///
+/// @return the index of the first unset bit, or `cnx_bit_vector_size(self)` if every bit is set
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_find_first_unset(self) cnx_bit_vector_find_first_unset(&(self))
+/// @brief Returns the index of the first unset bit after `index` in the given `CnxBitVector`
+///
+/// @param self - The `CnxBitVector` to search
+/// @param index - The index to search after
+///
+/// @return the index of the first unset bit after `index`, or `cnx_bit_vector_size(self)` if
+/// there are none
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_find_next_unset(self, index) \
+	cnx_bit_vector_find_next_unset(&(self), (index))
+/// @brief Returns a view of the indices of the set bits in the given `CnxBitVector`, suitable for
+/// use with `foreach`
+///
+/// @param self - The `CnxBitVector` to get the set bits of
+///
+/// @return a `CnxBitVectorSetBits` view of `self`
+/// @ingroup cnx_bit_vector
+#define cnx_bit_vector_set_bits(self) cnx_bit_vector_set_bits(&(self))
+
+#undef ___DISABLE_IF_NULL
+#endif // CNX_BIT_VECTOR
@@ -51,6 +51,7 @@
 #include <Cnx/Assert.h>
 #include <Cnx/Atomic.h>
 #include <Cnx/BasicTypes.h>
+#include <Cnx/BitVector.h>
 #include <Cnx/CollectionData.h>
 #include <Cnx/Def.h>
 #include <Cnx/Enum.h>
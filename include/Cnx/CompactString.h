@@ -0,0 +1,543 @@
+/// @file CompactString.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief A compact, allocator-implicit string type with a larger small-string capacity
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+
+#ifndef CNX_COMPACT_STRING
+/// @brief Declarations related to `CnxCompactString`
+#define CNX_COMPACT_STRING
+
+#include <Cnx/Allocators.h>
+#include <Cnx/Assert.h>
+#include <Cnx/Def.h>
+#include <Cnx/String.h>
+#include <stdint.h>
+
+/// @ingroup cnx_string
+/// @{
+/// @defgroup cnx_compact_string CnxCompactString
+/// `CnxCompactString` is an opt-in, memory-dense alternative to `CnxString` for programs that
+/// store very large numbers of (mostly short) strings, such as the keys of a large
+/// `CnxVector(CnxString)` or `CnxHashMap`.
+///
+/// Every `CnxString` carries its own `CnxAllocator` and function vector table alongside its
+/// small-string buffer, making it 48 bytes with room for 23 characters inline. A
+/// `CnxCompactString` always allocates with `DEFAULT_ALLOCATOR`, and has no vtable, so it fits in
+/// 32 bytes while storing up to 31 characters inline (the final byte of the inline buffer
+/// doubles as both the length tag and the null terminator of a full short string).
+///
+/// `CnxCompactString`'s API mirrors `CnxString`'s, with `cnx_compact_string_*` in place of
+/// `cnx_string_*`, and a `CnxCompactString` can be viewed as a `CnxStringView` with
+/// `cnx_compact_string_into_stringview`, so all of the `CnxStringView` functionality (searching,
+/// splitting, iteration with `foreach`, formatting, etc.) is available for it. When the full
+/// `CnxString` API is required, `cnx_compact_string_into_string` converts it to a `CnxString`.
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/CompactString.h>
+///
+/// void example(void) {
+/// 	CnxScopedCompactString string = cnx_compact_string_from("Hello");
+/// 	cnx_compact_string_append(string, ", world!");
+/// 	// still stored inline, no allocation was made
+/// 	cnx_assert(cnx_compact_string_is_short(string), "string should be short");
+///
+/// 	let view = cnx_compact_string_into_stringview(string);
+/// 	// prints "Hello, world!"
+/// 	println("{}", view);
+/// }
+/// @endcode
+/// @}
+
+/// @brief The size, in bytes, of a `CnxCompactString`
+/// @ingroup cnx_compact_string
+#define CNX_COMPACT_STRING_SIZE 32
+/// @brief The number of characters a `CnxCompactString` can store inline, without allocating
+/// @ingroup cnx_compact_string
+#define CNX_COMPACT_STRING_SHORT_CAPACITY (CNX_COMPACT_STRING_SIZE - 1)
+
+/// @brief `CnxCompactString` is a 32-byte, allocator-implicit string type storing up to 31
+/// characters inline
+/// @ingroup cnx_compact_string
+typedef struct CnxCompactString {
+	union {
+		struct {
+			/// @brief The heap-allocated contents of a long string
+			cstring m_long;
+			/// @brief The length of a long string
+			usize m_length;
+			/// @brief The capacity of a long string, excluding the null terminator. On 64-bit
+			/// platforms this overlaps the final byte of `m_short`, so it is stored encoded with
+			/// the long-string tag (see `___CNX_COMPACT_STRING_ENCODE_CAPACITY`)
+			usize m_capacity;
+		};
+		/// @brief The inline contents of a short string. The final byte stores
+		/// `CNX_COMPACT_STRING_SHORT_CAPACITY - length` for a short string, so that it is the
+		/// null terminator when the string is full, or an out-of-range tag for a long string
+		char m_short[CNX_COMPACT_STRING_SIZE];
+	};
+} CnxCompactString;
+
+cnx_static_assert(sizeof(CnxCompactString) == CNX_COMPACT_STRING_SIZE,
+				  "CnxCompactString must be exactly CNX_COMPACT_STRING_SIZE bytes");
+
+/// @brief The value of the final byte of `m_short` for a long `CnxCompactString`
+#define ___CNX_COMPACT_STRING_LONG_TAG static_cast(u8)(0xFF)
+
+#if UINTPTR_MAX == UINT64_MAX
+	// the last byte of `m_short` is a byte of `m_capacity`, so reserve that byte for the tag
+	#if CNX_PLATFORM_BIG_ENDIAN
+		#define ___CNX_COMPACT_STRING_ENCODE_CAPACITY(capacity) \
+			((static_cast(usize)(capacity) << 8U) | ___CNX_COMPACT_STRING_LONG_TAG)
+		#define ___CNX_COMPACT_STRING_DECODE_CAPACITY(encoded) ((encoded) >> 8U)
+	#else
+		#define ___CNX_COMPACT_STRING_CAPACITY_TAG_MASK \
+			(static_cast(usize)(___CNX_COMPACT_STRING_LONG_TAG) << 56U)
+		#define ___CNX_COMPACT_STRING_ENCODE_CAPACITY(capacity) \
+			(static_cast(usize)(capacity) | ___CNX_COMPACT_STRING_CAPACITY_TAG_MASK)
+		#define ___CNX_COMPACT_STRING_DECODE_CAPACITY(encoded) \
+			((encoded) & ~___CNX_COMPACT_STRING_CAPACITY_TAG_MASK)
+	#endif // CNX_PLATFORM_BIG_ENDIAN
+#else
+	// the last byte of `m_short` is padding past the end of the long representation
+	#define ___CNX_COMPACT_STRING_ENCODE_CAPACITY(capacity) static_cast(usize)(capacity)
+	#define ___CNX_COMPACT_STRING_DECODE_CAPACITY(encoded)	(encoded)
+#endif // UINTPTR_MAX == UINT64_MAX
+
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxCompactString operation on a nullptr")
+
+/// @brief Creates a new, empty `CnxCompactString`
+///
+/// @return an empty `CnxCompactString`
+/// @ingroup cnx_compact_string
+__attr(nodiscard) CnxCompactString cnx_compact_string_new(void);
+/// @brief Creates a new `CnxCompactString` with at least the given capacity
+///
+/// @param capacity - The minimum capacity of the string
+///
+/// @return an empty `CnxCompactString` with at least the given capacity
+/// @ingroup cnx_compact_string
+__attr(nodiscard) CnxCompactString cnx_compact_string_new_with_capacity(usize capacity);
+/// @brief Creates a new `CnxCompactString` from the given character data
+///
+/// @param string - The characters to copy into the string
+/// @param length - The number of characters to copy
+///
+/// @return a `CnxCompactString` containing a copy of `string`
+/// @ingroup cnx_compact_string
+__attr(nodiscard) __attr(not_null(1)) CnxCompactString
+	cnx_compact_string_from_cstring(restrict const_cstring string, usize length)
+		cnx_disable_if(!string, "Can't create a CnxCompactString from a nullptr");
+/// @brief Creates a copy of the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to clone
+///
+/// @return a copy of `self`
+/// @ingroup cnx_compact_string
+__attr(nodiscard) __attr(not_null(1)) CnxCompactString
+	cnx_compact_string_clone(const CnxCompactString* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Frees the memory associated with the given `CnxCompactString`, leaving it empty
+///
+/// @param self - The `CnxCompactString` to free
+/// @ingroup cnx_compact_string
+__attr(not_null(1)) void cnx_compact_string_free(void* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief declare a `CnxCompactString` variable with this attribute to have
+/// `cnx_compact_string_free` automatically called on it when it goes out of scope
+/// @ingroup cnx_compact_string
+#define CnxScopedCompactString scoped(cnx_compact_string_free)
+
+/// @brief Returns whether the given `CnxCompactString` is stored inline
+///
+/// @param self - The `CnxCompactString` to check
+///
+/// @return whether `self` is stored inline
+/// @ingroup cnx_compact_string
+__attr(nodiscard) __attr(not_null(1)) static inline bool
+	cnx_compact_string_is_short(const CnxCompactString* restrict self) ___DISABLE_IF_NULL(self) {
+	return static_cast(u8)(self->m_short[CNX_COMPACT_STRING_SHORT_CAPACITY])
+		   != ___CNX_COMPACT_STRING_LONG_TAG;
+}
+/// @brief Returns the length of the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to get the length of
+///
+/// @return the length of `self`
+/// @ingroup cnx_compact_string
+__attr(nodiscard) __attr(not_null(1)) static inline usize
+	cnx_compact_string_length(const CnxCompactString* restrict self) ___DISABLE_IF_NULL(self) {
+	return cnx_compact_string_is_short(self) ?
+			   static_cast(usize)(CNX_COMPACT_STRING_SHORT_CAPACITY
+								  - self->m_short[CNX_COMPACT_STRING_SHORT_CAPACITY]) :
+			   self->m_length;
+}
+/// @brief Returns the capacity of the given `CnxCompactString`, excluding the null terminator
+///
+/// @param self - The `CnxCompactString` to get the capacity of
+///
+/// @return the capacity of `self`
+/// @ingroup cnx_compact_string
+__attr(nodiscard) __attr(not_null(1)) static inline usize
+	cnx_compact_string_capacity(const CnxCompactString* restrict self) ___DISABLE_IF_NULL(self) {
+	return cnx_compact_string_is_short(self) ?
+			   CNX_COMPACT_STRING_SHORT_CAPACITY :
+			   ___CNX_COMPACT_STRING_DECODE_CAPACITY(self->m_capacity);
+}
+/// @brief Returns whether the given `CnxCompactString` is empty
+///
+/// @param self - The `CnxCompactString` to check
+///
+/// @return whether `self` is empty
+/// @ingroup cnx_compact_string
+__attr(nodiscard) __attr(not_null(1)) static inline bool
+	cnx_compact_string_is_empty(const CnxCompactString* restrict self) ___DISABLE_IF_NULL(self) {
+	return cnx_compact_string_length(self) == 0;
+}
+/// @brief Returns the null-terminated contents of the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to get the contents of
+///
+/// @return the contents of `self`
+/// @ingroup cnx_compact_string
+__attr(nodiscard) __attr(not_null(1)) __attr(returns_not_null) static inline const_cstring
+	cnx_compact_string_into_cstring(const CnxCompactString* restrict self)
+		___DISABLE_IF_NULL(self) {
+	return cnx_compact_string_is_short(self) ? self->m_short : self->m_long;
+}
+/// @brief Returns a `CnxStringView` of the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to view
+///
+/// @return a view of `self`
+/// @ingroup cnx_compact_string
+__attr(nodiscard) __attr(not_null(1)) CnxStringView
+	cnx_compact_string_into_stringview(const CnxCompactString* restrict self)
+		___DISABLE_IF_NULL(self);
+/// @brief Creates a `CnxString` containing a copy of the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to copy
+///
+/// @return a `CnxString` copy of `self`
+/// @ingroup cnx_compact_string
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_compact_string_into_string(const CnxCompactString* restrict self)
+		___DISABLE_IF_NULL(self);
+
+/// @brief Returns the character at the given index in the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to get the character from
+/// @param index - The index of the character
+///
+/// @return the character at `index`
+/// @ingroup cnx_compact_string
+__attr(nodiscard) __attr(not_null(1)) const_cstring
+	cnx_compact_string_at(const CnxCompactString* restrict self, usize index)
+		___DISABLE_IF_NULL(self);
+/// @brief Returns a mutable reference to the character at the given index in the given
+/// `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to get the character from
+/// @param index - The index of the character
+///
+/// @return a mutable reference to the character at `index`
+/// @ingroup cnx_compact_string
+__attr(nodiscard) __attr(not_null(1)) cstring
+	cnx_compact_string_at_mut(CnxCompactString* restrict self, usize index)
+		___DISABLE_IF_NULL(self);
+
+/// @brief Ensures the given `CnxCompactString` has capacity for at least `new_capacity`
+/// characters
+///
+/// @param self - The `CnxCompactString` to reserve memory for
+/// @param new_capacity - The minimum capacity of the string
+/// @ingroup cnx_compact_string
+__attr(not_null(1)) void
+	cnx_compact_string_reserve(CnxCompactString* restrict self, usize new_capacity)
+		___DISABLE_IF_NULL(self);
+/// @brief Shrinks the given `CnxCompactString`'s memory to fit its contents, moving it back
+/// inline if it fits
+///
+/// @param self - The `CnxCompactString` to shrink
+/// @ingroup cnx_compact_string
+__attr(not_null(1)) void cnx_compact_string_shrink_to_fit(CnxCompactString* restrict self)
+	___DISABLE_IF_NULL(self);
+/// @brief Clears the contents of the given `CnxCompactString`, keeping its capacity
+///
+/// @param self - The `CnxCompactString` to clear
+/// @ingroup cnx_compact_string
+__attr(not_null(1)) void cnx_compact_string_clear(CnxCompactString* restrict self)
+	___DISABLE_IF_NULL(self);
+/// @brief Appends the given character to the end of the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to append to
+/// @param character - The character to append
+/// @ingroup cnx_compact_string
+__attr(not_null(1)) void cnx_compact_string_push_back(CnxCompactString* restrict self,
+													  char character) ___DISABLE_IF_NULL(self);
+/// @brief Removes the last character from the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to remove the last character from
+///
+/// @return `Some` last character, or `None` if `self` is empty
+/// @ingroup cnx_compact_string
+__attr(nodiscard) __attr(not_null(1)) CnxOption(char)
+	cnx_compact_string_pop_back(CnxCompactString* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Appends the given characters to the end of the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to append to
+/// @param string - The characters to append
+/// @param length - The number of characters to append
+/// @ingroup cnx_compact_string
+__attr(not_null(1, 2)) void cnx_compact_string_append_cstring(CnxCompactString* restrict self,
+															  restrict const_cstring string,
+															  usize length)
+	___DISABLE_IF_NULL(self) cnx_disable_if(!string, "Can't append a nullptr to a CnxCompactString");
+
+/// @brief Returns whether the contents of the given `CnxCompactString` are equal to the given
+/// characters
+///
+/// @param self - The `CnxCompactString` to compare
+/// @param string - The characters to compare to
+/// @param length - The number of characters to compare to
+///
+/// @return whether `self` is equal to `string`
+/// @ingroup cnx_compact_string
+__attr(nodiscard) __attr(not_null(1, 2)) bool
+	cnx_compact_string_equal_cstring(const CnxCompactString* restrict self,
+									 restrict const_cstring string,
+									 usize length) ___DISABLE_IF_NULL(self)
+		cnx_disable_if(!string, "Can't compare a CnxCompactString to a nullptr");
+/// @brief Lexicographically compares the given `CnxCompactString` to the given characters
+///
+/// @param self - The `CnxCompactString` to compare
+/// @param string - The characters to compare to
+/// @param length - The number of characters to compare to
+///
+/// @return a negative value if `self` orders before `string`, `0` if they are equal, or a
+/// positive value if `self` orders after `string`
+/// @ingroup cnx_compact_string
+__attr(nodiscard) __attr(not_null(1, 2)) i32
+	cnx_compact_string_compare_cstring(const CnxCompactString* restrict self,
+									   restrict const_cstring string,
+									   usize length) ___DISABLE_IF_NULL(self)
+		cnx_disable_if(!string, "Can't compare a CnxCompactString to a nullptr");
+
+#undef ___DISABLE_IF_NULL
+
+// clang-format off
+
+/// @brief Expands the given string-like value to the pointer-and-length argument pair expected by
+/// the `cnx_compact_string_*_cstring` functions
+#define ___CNX_COMPACT_STRING_ARG(string) 													   \
+	_Generic((string),                                                                      \
+		const_cstring 				: static_cast(const_cstring)(string),                  \
+		cstring 					: static_cast(const_cstring)(string),                  \
+		CnxStringView* 				: (static_cast(const CnxStringView*)(string))->m_view, \
+		const CnxStringView* 		: (static_cast(const CnxStringView*)(string))->m_view, \
+		CnxString* 					: (cnx_string_into_cstring)(                           \
+										static_cast(const CnxString*)(string)),            \
+		const CnxString* 			: (cnx_string_into_cstring)(                           \
+										static_cast(const CnxString*)(string)),            \
+		CnxCompactString* 			: (cnx_compact_string_into_cstring)(                   \
+										static_cast(const CnxCompactString*)(string)),     \
+		const CnxCompactString* 	: (cnx_compact_string_into_cstring)(                   \
+										static_cast(const CnxCompactString*)(string))),    \
+	_Generic((string),                                                                      \
+		const_cstring 				: strlen(static_cast(const_cstring)(string)),          \
+		cstring 					: strlen(static_cast(const_cstring)(string)),          \
+		CnxStringView* 				: (static_cast(const CnxStringView*)(string))->m_length, \
+		const CnxStringView* 		: (static_cast(const CnxStringView*)(string))->m_length, \
+		CnxString* 					: (cnx_string_length)(                                 \
+										static_cast(const CnxString*)(string)),            \
+		const CnxString* 			: (cnx_string_length)(                                 \
+										static_cast(const CnxString*)(string)),            \
+		CnxCompactString* 			: (cnx_compact_string_length)(                         \
+										static_cast(const CnxCompactString*)(string)),     \
+		const CnxCompactString* 	: (cnx_compact_string_length)(                         \
+										static_cast(const CnxCompactString*)(string)))
+
+// clang-format on
+
+/// @brief Creates a new `CnxCompactString` from the given string-like value
+///
+/// @param string - The string to copy. Can be a `cstring`, or a pointer to a `CnxStringView`,
+/// `CnxString`, or `CnxCompactString`
+///
+/// @return a `CnxCompactString` containing a copy of `string`
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_from(string) \
+	cnx_compact_string_from_cstring(___CNX_COMPACT_STRING_ARG(string))
+/// @brief Creates a copy of the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to clone
+///
+/// @return a copy of `self`
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_clone(self) cnx_compact_string_clone(&(self))
+/// @brief Frees the memory associated with the given `CnxCompactString`, leaving it empty
+///
+/// @param self - The `CnxCompactString` to free
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_free(self) cnx_compact_string_free(&(self))
+/// @brief Returns whether the given `CnxCompactString` is stored inline
+///
+/// @param self - The `CnxCompactString` to check
+///
+/// @return whether `self` is stored inline
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_is_short(self) cnx_compact_string_is_short(&(self))
+/// @brief Returns the length of the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to get the length of
+///
+/// @return the length of `self`
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_length(self) cnx_compact_string_length(&(self))
+/// @brief Returns the length of the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to get the length of
+///
+/// @return the length of `self`
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_size(self) cnx_compact_string_length(self)
+/// @brief Returns the capacity of the given `CnxCompactString`, excluding the null terminator
+///
+/// @param self - The `CnxCompactString` to get the capacity of
+///
+/// @return the capacity of `self`
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_capacity(self) cnx_compact_string_capacity(&(self))
+/// @brief Returns whether the given `CnxCompactString` is empty
+///
+/// @param self - The `CnxCompactString` to check
+///
+/// @return whether `self` is empty
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_is_empty(self) cnx_compact_string_is_empty(&(self))
+/// @brief Returns the null-terminated contents of the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to get the contents of
+///
+/// @return the contents of `self`
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_into_cstring(self) cnx_compact_string_into_cstring(&(self))
+/// @brief Returns a `CnxStringView` of the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to view
+///
+/// @return a view of `self`
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_into_stringview(self) cnx_compact_string_into_stringview(&(self))
+/// @brief Creates a `CnxString` containing a copy of the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to copy
+///
+/// @return a `CnxString` copy of `self`
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_into_string(self) cnx_compact_string_into_string(&(self))
+/// @brief Returns the character at the given index in the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to get the character from
+/// @param index - The index of the character
+///
+/// @return the character at `index`
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_at(self, index) (*cnx_compact_string_at(&(self), (index)))
+/// @brief Returns a mutable reference to the character at the given index in the given
+/// `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to get the character from
+/// @param index - The index of the character
+///
+/// @return a mutable reference to the character at `index`
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_at_mut(self, index) (*cnx_compact_string_at_mut(&(self), (index)))
+/// @brief Ensures the given `CnxCompactString` has capacity for at least `new_capacity`
+/// characters
+///
+/// @param self - The `CnxCompactString` to reserve memory for
+/// @param new_capacity - The minimum capacity of the string
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_reserve(self, new_capacity) \
+	cnx_compact_string_reserve(&(self), (new_capacity))
+/// @brief Shrinks the given `CnxCompactString`'s memory to fit its contents, moving it back
+/// inline if it fits
+///
+/// @param self - The `CnxCompactString` to shrink
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_shrink_to_fit(self) cnx_compact_string_shrink_to_fit(&(self))
+/// @brief Clears the contents of the given `CnxCompactString`, keeping its capacity
+///
+/// @param self - The `CnxCompactString` to clear
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_clear(self) cnx_compact_string_clear(&(self))
+/// @brief Appends the given character to the end of the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to append to
+/// @param character - The character to append
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_push_back(self, character) \
+	cnx_compact_string_push_back(&(self), (character))
+/// @brief Removes the last character from the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to remove the last character from
+///
+/// @return `Some` last character, or `None` if `self` is empty
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_pop_back(self) cnx_compact_string_pop_back(&(self))
+/// @brief Appends the given string-like value to the end of the given `CnxCompactString`
+///
+/// @param self - The `CnxCompactString` to append to
+/// @param string - The string to append. Can be a `cstring`, or a pointer to a `CnxStringView`,
+/// `CnxString`, or `CnxCompactString`
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_append(self, string) \
+	cnx_compact_string_append_cstring(&(self), ___CNX_COMPACT_STRING_ARG(string))
+/// @brief Returns whether the contents of the given `CnxCompactString` are equal to the given
+/// string-like value
+///
+/// @param self - The `CnxCompactString` to compare
+/// @param string - The string to compare to. Can be a `cstring`, or a pointer to a
+/// `CnxStringView`, `CnxString`, or `CnxCompactString`
+///
+/// @return whether `self` is equal to `string`
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_equal(self, string) \
+	cnx_compact_string_equal_cstring(&(self), ___CNX_COMPACT_STRING_ARG(string))
+/// @brief Lexicographically compares the given `CnxCompactString` to the given string-like value
+///
+/// @param self - The `CnxCompactString` to compare
+/// @param string - The string to compare to. Can be a `cstring`, or a pointer to a
+/// `CnxStringView`, `CnxString`, or `CnxCompactString`
+///
+/// @return a negative value if `self` orders before `string`, `0` if they are equal, or a
+/// positive value if `self` orders after `string`
+/// @ingroup cnx_compact_string
+#define cnx_compact_string_compare(self, string) \
+	cnx_compact_string_compare_cstring(&(self), ___CNX_COMPACT_STRING_ARG(string))
+
+#endif // CNX_COMPACT_STRING
@@ -0,0 +1,509 @@
+/// @file Csv.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides streaming reading and writing of CSV (comma-separated values) data
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+
+#ifndef CNX_CSV
+/// @brief Declarations related to `CnxCsvReader` and `CnxCsvWriter`
+#define CNX_CSV
+
+#include <Cnx/Allocators.h>
+#include <Cnx/Def.h>
+#include <Cnx/String.h>
+#include <Cnx/__string/__byte_scan.h>
+#include <Cnx/filesystem/File.h>
+
+#define RESULT_INCLUDE_DEFAULT_INSTANTIATIONS TRUE
+#include <Cnx/Result.h>
+#undef RESULT_INCLUDE_DEFAULT_INSTANTIATIONS
+
+/// @ingroup io
+/// @{
+/// @defgroup cnx_csv CSV
+/// Cnx provides streaming reading and writing of CSV (comma-separated values) data, as described
+/// by RFC 4180, through `CnxCsvReader` and `CnxCsvWriter`.
+///
+/// `CnxCsvReader` parses rows directly out of a buffer of the input, without copying fields into
+/// their own strings: each row is yielded as an array of `CnxStringView`s into that buffer.
+/// Delimiters, quotes, and line endings are found with the same vectorized byte scanning the
+/// string algorithms use, so unquoted fields are skipped over many bytes at a time. Quoted fields
+/// are yielded without their surrounding quotes, and only fields containing escaped (doubled)
+/// quotes are unescaped, into a scratch buffer owned by the reader. Rows may end with either
+/// `"\n"` or `"\r\n"`, and quoted fields may span multiple lines. When reading from a `CnxFile`,
+/// the input is read in chunks, and the reader's buffer grows as necessary to hold the longest
+/// row, so files of any size can be read in bounded memory.
+///
+/// Fields can be extracted as numbers with `cnx_csv_row_get_i64`, `cnx_csv_row_get_u64`, and
+/// `cnx_csv_row_get_f64`, which parse the field without allocating.
+///
+/// `CnxCsvWriter` writes fields directly to a `CnxFile`, quoting only the fields that need it
+/// (those containing the delimiter, the quote character, or a line ending) and escaping any
+/// quotes within them.
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/Csv.h>
+/// #include <Cnx/IO.h>
+///
+/// // sums the second column of a CSV file, copying the rows with a positive value to another
+/// f64 example(CnxFile* restrict input, CnxFile* restrict output) {
+/// 	CnxScopedCsvReader reader = cnx_csv_reader_from_file(input);
+/// 	let_mut writer = cnx_csv_writer_new(output);
+/// 	let_mut total = 0.0;
+///
+/// 	CnxCsvRow row;
+/// 	while(cnx_csv_reader_next(&reader, &row)) {
+/// 		let_mut value = cnx_csv_row_get_f64(row, 1);
+/// 		if(cnx_result_is_ok(value) && cnx_result_unwrap(value) > 0.0) {
+/// 			total += cnx_result_unwrap(value);
+/// 			ignore(cnx_csv_writer_write_row(&writer, row));
+/// 		}
+/// 	}
+///
+/// 	let_mut status = cnx_csv_reader_status(&reader);
+/// 	if(cnx_result_is_err(status)) {
+/// 		eprintln("failed to read CSV: {}", as_format_t(CnxResult, status));
+/// 	}
+///
+/// 	return total;
+/// }
+/// @endcode
+/// @}
+
+/// @brief The initial size, in bytes, of the buffer a `CnxCsvReader` reads a `CnxFile` into
+/// @ingroup cnx_csv
+#define CNX_CSV_READER_DEFAULT_BUFFER_SIZE (static_cast(usize)(64U * 1024U))
+
+/// @brief Use to configure the CSV dialect read by a `CnxCsvReader` or written by a
+/// `CnxCsvWriter`
+/// @ingroup cnx_csv
+typedef struct CnxCsvOptions {
+	/// @brief The character separating fields in a row
+	char delimiter;
+	/// @brief The character fields are quoted with
+	char quote;
+	/// @brief Whether a `CnxCsvWriter` ends rows with `"\r\n"` instead of `"\n"`. Ignored by
+	/// `CnxCsvReader`, which accepts either
+	bool crlf;
+} CnxCsvOptions;
+
+/// @brief The default `CnxCsvOptions`, with `,` as the delimiter, `"` as the quote character,
+/// and rows ending with `"\n"`
+/// @ingroup cnx_csv
+#define cnx_csv_default_options \
+	((CnxCsvOptions){.delimiter = ',', .quote = '"', .crlf = false})
+
+/// @brief A single row of CSV data, as yielded by a `CnxCsvReader`
+///
+/// The fields of a `CnxCsvRow` refer to the buffers of the `CnxCsvReader` that yielded it, so they
+/// are only valid until the next call to `cnx_csv_reader_next` or until the reader is freed.
+/// @ingroup cnx_csv
+typedef struct CnxCsvRow {
+	/// @brief The fields of the row
+	const CnxStringView* m_fields;
+	/// @brief The number of fields in the row
+	usize m_num_fields;
+} CnxCsvRow;
+
+/// @brief A streaming reader of CSV data. See the module-level documentation for details
+/// @ingroup cnx_csv
+typedef struct CnxCsvReader {
+	/// @brief The file being read, or `nullptr` if reading from a `CnxStringView`
+	CnxFile* m_file;
+	/// @brief The options configuring the CSV dialect being read
+	CnxCsvOptions m_options;
+	/// @brief The bytes that can end an unquoted field: the delimiter and the line endings
+	CnxByteSet m_terminators;
+	/// @brief The input currently available to parse. When reading from a `CnxFile`, this is
+	/// `m_buffer`, otherwise it's the `CnxStringView` being read
+	const_cstring m_data;
+	/// @brief The number of bytes in `m_data`
+	usize m_length;
+	/// @brief The index in `m_data` at which the next row begins
+	usize m_position;
+	/// @brief Whether the end of the input has been reached, ie `m_data` holds all of the
+	/// remaining input
+	bool m_end_of_input;
+	/// @brief The buffer `m_file` is read into
+	char* m_buffer;
+	/// @brief The capacity of `m_buffer`
+	usize m_buffer_capacity;
+	/// @brief The fields of the most recently read row
+	CnxStringView* m_fields;
+	/// @brief Whether each of `m_fields` contains escaped quotes that need to be unescaped
+	bool* m_escaped;
+	/// @brief The capacity of `m_fields` and `m_escaped`
+	usize m_fields_capacity;
+	/// @brief The buffer fields containing escaped quotes are unescaped into
+	char* m_scratch;
+	/// @brief The capacity of `m_scratch`
+	usize m_scratch_capacity;
+	/// @brief The error that stopped reading, if any
+	CnxError m_error;
+	/// @brief Whether reading was stopped by an error
+	bool m_failed;
+	/// @brief The allocator the reader's buffers are allocated with
+	CnxAllocator m_allocator;
+} CnxCsvReader;
+
+/// @brief A writer of CSV data to a `CnxFile`. See the module-level documentation for details
+/// @ingroup cnx_csv
+typedef struct CnxCsvWriter {
+	/// @brief The file being written to
+	CnxFile* m_file;
+	/// @brief The options configuring the CSV dialect being written
+	CnxCsvOptions m_options;
+	/// @brief The bytes that require a field to be quoted: the delimiter, the quote character, and
+	/// the line endings
+	CnxByteSet m_special;
+	/// @brief The number of fields written to the current row
+	usize m_num_fields;
+} CnxCsvWriter;
+
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxCsvReader operation on a nullptr")
+
+/// @brief Creates a new `CnxCsvReader` reading from the given `CnxFile`, configured with the
+/// given options, allocating its buffers with the given allocator
+///
+/// `file` must remain valid, and must not be read from by anything other than the reader, until
+/// the reader is freed.
+///
+/// @param file - The `CnxFile` to read CSV data from
+/// @param options - The `CnxCsvOptions` configuring the CSV dialect to read
+/// @param allocator - The `CnxAllocator` to allocate the reader's buffers with
+///
+/// @return a new `CnxCsvReader`
+/// @ingroup cnx_csv
+__attr(nodiscard) __attr(not_null(1)) CnxCsvReader
+	cnx_csv_reader_from_file_with_allocator(CnxFile* restrict file,
+											CnxCsvOptions options,
+											CnxAllocator allocator)
+		cnx_disable_if(!file, "Can't create a CnxCsvReader from a null file");
+/// @brief Creates a new `CnxCsvReader` reading from the given `CnxFile`, configured with the
+/// given options
+///
+/// `file` must remain valid, and must not be read from by anything other than the reader, until
+/// the reader is freed.
+///
+/// @param file - The `CnxFile` to read CSV data from
+/// @param options - The `CnxCsvOptions` configuring the CSV dialect to read
+///
+/// @return a new `CnxCsvReader`
+/// @ingroup cnx_csv
+#define cnx_csv_reader_from_file_with_options(file, options) \
+	cnx_csv_reader_from_file_with_allocator(file, options, DEFAULT_ALLOCATOR)
+/// @brief Creates a new `CnxCsvReader` reading from the given `CnxFile`, with the default
+/// options (see `cnx_csv_default_options`)
+///
+/// `file` must remain valid, and must not be read from by anything other than the reader, until
+/// the reader is freed.
+///
+/// @param file - The `CnxFile` to read CSV data from
+///
+/// @return a new `CnxCsvReader`
+/// @ingroup cnx_csv
+#define cnx_csv_reader_from_file(file) \
+	cnx_csv_reader_from_file_with_allocator(file, cnx_csv_default_options, DEFAULT_ALLOCATOR)
+/// @brief Creates a new `CnxCsvReader` reading from the given `CnxStringView`, configured with
+/// the given options, allocating its buffers with the given allocator
+///
+/// The data viewed by `view` is parsed in place, so it must remain valid until the reader is
+/// freed.
+///
+/// @param view - The `CnxStringView` to read CSV data from
+/// @param options - The `CnxCsvOptions` configuring the CSV dialect to read
+/// @param allocator - The `CnxAllocator` to allocate the reader's buffers with
+///
+/// @return a new `CnxCsvReader`
+/// @ingroup cnx_csv
+__attr(nodiscard) __attr(not_null(1)) CnxCsvReader
+	cnx_csv_reader_from_stringview_with_allocator(const CnxStringView* restrict view,
+												  CnxCsvOptions options,
+												  CnxAllocator allocator)
+		cnx_disable_if(!view, "Can't create a CnxCsvReader from a null view");
+/// @brief Creates a new `CnxCsvReader` reading from the given `CnxStringView`, configured with
+/// the given options
+///
+/// The data viewed by `view` is parsed in place, so it must remain valid until the reader is
+/// freed.
+///
+/// @param view - The `CnxStringView` to read CSV data from
+/// @param options - The `CnxCsvOptions` configuring the CSV dialect to read
+///
+/// @return a new `CnxCsvReader`
+/// @ingroup cnx_csv
+#define cnx_csv_reader_from_stringview_with_options(view, options) \
+	cnx_csv_reader_from_stringview_with_allocator(&(view), options, DEFAULT_ALLOCATOR)
+/// @brief Creates a new `CnxCsvReader` reading from the given `CnxStringView`, with the default
+/// options (see `cnx_csv_default_options`)
+///
+/// The data viewed by `view` is parsed in place, so it must remain valid until the reader is
+/// freed.
+///
+/// @param view - The `CnxStringView` to read CSV data from
+///
+/// @return a new `CnxCsvReader`
+/// @ingroup cnx_csv
+#define cnx_csv_reader_from_stringview(view)                 \
+	cnx_csv_reader_from_stringview_with_allocator(&(view),   \
+												  cnx_csv_default_options, \
+												  DEFAULT_ALLOCATOR)
+/// @brief Frees the buffers of the given `CnxCsvReader`. This does not close the file it reads
+/// from
+///
+/// @param self - The `CnxCsvReader` to free
+/// @ingroup cnx_csv
+__attr(not_null(1)) void cnx_csv_reader_free(void* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief declare a `CnxCsvReader` variable with this attribute to have `cnx_csv_reader_free`
+/// automatically called on it when it goes out of scope
+/// @ingroup cnx_csv
+#define CnxScopedCsvReader scoped(cnx_csv_reader_free)
+/// @brief Reads the next row from the given `CnxCsvReader`
+///
+/// The fields of the row refer to the buffers of `self`, so they are only valid until the next
+/// call to `cnx_csv_reader_next` or until `self` is freed.
+///
+/// @param self - The `CnxCsvReader` to read from
+/// @param row - The `CnxCsvRow` to store the row in
+///
+/// @return `true` if a row was read. `false` if the end of the input was reached, or reading
+/// failed (check `cnx_csv_reader_status` to distinguish the two)
+/// @ingroup cnx_csv
+__attr(nodiscard) __attr(not_null(1, 2)) bool
+	cnx_csv_reader_next(CnxCsvReader* restrict self, CnxCsvRow* restrict row)
+		___DISABLE_IF_NULL(self) cnx_disable_if(!row, "Can't read a CSV row into a nullptr");
+/// @brief Returns whether the given `CnxCsvReader` has stopped reading because of an error
+///
+/// @param self - The `CnxCsvReader` to get the status of
+///
+/// @return `Ok` if no error has occurred, otherwise an `Err` containing `EINVAL` if the input is
+/// malformed (for example, a quoted field is never closed, or is followed by anything other than
+/// a delimiter or line ending), or the error that occurred reading from the file
+/// @ingroup cnx_csv
+__attr(nodiscard) __attr(not_null(1)) CnxResult
+	cnx_csv_reader_status(const CnxCsvReader* restrict self) ___DISABLE_IF_NULL(self);
+
+#undef ___DISABLE_IF_NULL
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxCsvRow operation on a nullptr")
+
+/// @brief Returns the number of fields in the given `CnxCsvRow`
+///
+/// @param self - The `CnxCsvRow` to get the number of fields of
+///
+/// @return the number of fields in the row
+/// @ingroup cnx_csv
+__attr(nodiscard) __attr(not_null(1)) static inline usize
+	cnx_csv_row_size(const CnxCsvRow* restrict self) ___DISABLE_IF_NULL(self) {
+	return self->m_num_fields;
+}
+/// @brief Returns the field at the given index of the given `CnxCsvRow`
+///
+/// @param self - The `CnxCsvRow` to get the field of
+/// @param index - The index of the field to get
+///
+/// @return the field at `index`
+/// @ingroup cnx_csv
+__attr(nodiscard) __attr(not_null(1)) static inline CnxStringView
+	cnx_csv_row_get(const CnxCsvRow* restrict self, usize index) ___DISABLE_IF_NULL(self) {
+	cnx_assert(index < self->m_num_fields, "cnx_csv_row_get called with index out of bounds");
+	return self->m_fields[index];
+}
+/// @brief Parses the field at the given index of the given `CnxCsvRow` as a signed integer
+///
+/// The field must consist entirely of an optional sign followed by decimal digits.
+///
+/// @param self - The `CnxCsvRow` to get the field of
+/// @param index - The index of the field to parse
+///
+/// @return `Ok` containing the parsed value, or an `Err` containing `EINVAL` if `index` is out of
+/// bounds or the field isn't an integer, or `ERANGE` if the value doesn't fit in an `i64`
+/// @ingroup cnx_csv
+__attr(nodiscard) __attr(not_null(1)) CnxResult(i64)
+	cnx_csv_row_get_i64(const CnxCsvRow* restrict self, usize index) ___DISABLE_IF_NULL(self);
+/// @brief Parses the field at the given index of the given `CnxCsvRow` as an unsigned integer
+///
+/// The field must consist entirely of an optional `+` followed by decimal digits.
+///
+/// @param self - The `CnxCsvRow` to get the field of
+/// @param index - The index of the field to parse
+///
+/// @return `Ok` containing the parsed value, or an `Err` containing `EINVAL` if `index` is out of
+/// bounds or the field isn't an unsigned integer, or `ERANGE` if the value doesn't fit in a `u64`
+/// @ingroup cnx_csv
+__attr(nodiscard) __attr(not_null(1)) CnxResult(u64)
+	cnx_csv_row_get_u64(const CnxCsvRow* restrict self, usize index) ___DISABLE_IF_NULL(self);
+/// @brief Parses the field at the given index of the given `CnxCsvRow` as a floating point number
+///
+/// The field must consist entirely of a decimal or hexadecimal floating point number, infinity,
+/// or NaN, in the forms accepted by `strtod`.
+///
+/// @param self - The `CnxCsvRow` to get the field of
+/// @param index - The index of the field to parse
+///
+/// @return `Ok` containing the parsed value, or an `Err` containing `EINVAL` if `index` is out of
+/// bounds or the field isn't a floating point number, or `ERANGE` if the value overflows an `f64`
+/// @ingroup cnx_csv
+__attr(nodiscard) __attr(not_null(1)) CnxResult(f64)
+	cnx_csv_row_get_f64(const CnxCsvRow* restrict self, usize index) ___DISABLE_IF_NULL(self);
+
+#undef ___DISABLE_IF_NULL
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxCsvWriter operation on a nullptr")
+
+/// @brief Creates a new `CnxCsvWriter` writing to the given `CnxFile`, configured with the given
+/// options
+///
+/// `file` must remain valid while the writer is in use. The writer writes directly to `file`, so
+/// `file` must be flushed (or closed) for the written data to be visible to other readers.
+///
+/// @param file - The `CnxFile` to write CSV data to
+/// @param options - The `CnxCsvOptions` configuring the CSV dialect to write
+///
+/// @return a new `CnxCsvWriter`
+/// @ingroup cnx_csv
+__attr(nodiscard) __attr(not_null(1)) CnxCsvWriter
+	cnx_csv_writer_new_with_options(CnxFile* restrict file, CnxCsvOptions options)
+		cnx_disable_if(!file, "Can't create a CnxCsvWriter writing to a null file");
+/// @brief Creates a new `CnxCsvWriter` writing to the given `CnxFile`, with the default options
+/// (see `cnx_csv_default_options`)
+///
+/// `file` must remain valid while the writer is in use. The writer writes directly to `file`, so
+/// `file` must be flushed (or closed) for the written data to be visible to other readers.
+///
+/// @param file - The `CnxFile` to write CSV data to
+///
+/// @return a new `CnxCsvWriter`
+/// @ingroup cnx_csv
+#define cnx_csv_writer_new(file) cnx_csv_writer_new_with_options(file, cnx_csv_default_options)
+/// @brief Writes the given field to the current row of the given `CnxCsvWriter`, quoting it if
+/// necessary
+///
+/// @param self - The `CnxCsvWriter` to write with
+/// @param field - The field to write
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_csv
+__attr(not_null(1, 2)) CnxResult
+	cnx_csv_writer_write_field(CnxCsvWriter* restrict self, const CnxStringView* restrict field)
+		___DISABLE_IF_NULL(self) cnx_disable_if(!field, "Can't write a null CSV field");
+/// @brief Writes the given signed integer as a field of the current row of the given
+/// `CnxCsvWriter`
+///
+/// @param self - The `CnxCsvWriter` to write with
+/// @param value - The value to write
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_csv
+__attr(not_null(1)) CnxResult
+	cnx_csv_writer_write_i64(CnxCsvWriter* restrict self, i64 value) ___DISABLE_IF_NULL(self);
+/// @brief Writes the given unsigned integer as a field of the current row of the given
+/// `CnxCsvWriter`
+///
+/// @param self - The `CnxCsvWriter` to write with
+/// @param value - The value to write
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_csv
+__attr(not_null(1)) CnxResult
+	cnx_csv_writer_write_u64(CnxCsvWriter* restrict self, u64 value) ___DISABLE_IF_NULL(self);
+/// @brief Writes the given floating point number as a field of the current row of the given
+/// `CnxCsvWriter`
+///
+/// The value is written with the fewest significant digits (up to 17) that parse back to exactly
+/// the same value.
+///
+/// @param self - The `CnxCsvWriter` to write with
+/// @param value - The value to write
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_csv
+__attr(not_null(1)) CnxResult
+	cnx_csv_writer_write_f64(CnxCsvWriter* restrict self, f64 value) ___DISABLE_IF_NULL(self);
+/// @brief Ends the current row of the given `CnxCsvWriter`
+///
+/// @param self - The `CnxCsvWriter` to write with
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_csv
+__attr(not_null(1)) CnxResult cnx_csv_writer_end_row(CnxCsvWriter* restrict self)
+	___DISABLE_IF_NULL(self);
+/// @brief Writes the given fields as a complete row with the given `CnxCsvWriter`
+///
+/// @param self - The `CnxCsvWriter` to write with
+/// @param fields - The fields of the row
+/// @param num_fields - The number of fields in `fields`
+///
+/// @return `Ok()` on success, otherwise the first error that occurred writing to the file
+/// @ingroup cnx_csv
+__attr(not_null(1)) CnxResult cnx_csv_writer_write_fields(CnxCsvWriter* restrict self,
+														   const CnxStringView* restrict fields,
+														   usize num_fields)
+	___DISABLE_IF_NULL(self)
+		cnx_disable_if(!fields && num_fields != 0, "Can't write null CSV fields");
+/// @brief Writes the given `CnxCsvRow` as a complete row with the given `CnxCsvWriter`
+///
+/// @param self - The `CnxCsvWriter` to write with
+/// @param row - The `CnxCsvRow` to write
+///
+/// @return `Ok()` on success, otherwise the first error that occurred writing to the file
+/// @ingroup cnx_csv
+#define cnx_csv_writer_write_row(self, row) \
+	cnx_csv_writer_write_fields(self, (row).m_fields, (row).m_num_fields)
+
+#undef ___DISABLE_IF_NULL
+
+/// @brief Returns the number of fields in the given `CnxCsvRow`
+///
+/// @param self - The `CnxCsvRow` to get the number of fields of
+///
+/// @return the number of fields in the row
+/// @ingroup cnx_csv
+#define cnx_csv_row_size(self) cnx_csv_row_size(&(self))
+/// @brief Returns the field at the given index of the given `CnxCsvRow`
+///
+/// @param self - The `CnxCsvRow` to get the field of
+/// @param index - The index of the field to get
+///
+/// @return the field at `index`
+/// @ingroup cnx_csv
+#define cnx_csv_row_get(self, index) cnx_csv_row_get(&(self), index)
+/// @brief Parses the field at the given index of the given `CnxCsvRow` as a signed integer. See
+/// the function of the same name for details
+/// @ingroup cnx_csv
+#define cnx_csv_row_get_i64(self, index) cnx_csv_row_get_i64(&(self), index)
+/// @brief Parses the field at the given index of the given `CnxCsvRow` as an unsigned integer.
+/// See the function of the same name for details
+/// @ingroup cnx_csv
+#define cnx_csv_row_get_u64(self, index) cnx_csv_row_get_u64(&(self), index)
+/// @brief Parses the field at the given index of the given `CnxCsvRow` as a floating point
+/// number. See the function of the same name for details
+/// @ingroup cnx_csv
+#define cnx_csv_row_get_f64(self, index) cnx_csv_row_get_f64(&(self), index)
+
+#endif // CNX_CSV
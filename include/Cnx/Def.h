@@ -404,6 +404,15 @@
 	#define always_inline always_inline
 #endif // CNX_C_STD_23
 
+/// @def noinline
+/// @brief Specify that the following function should never be inlined
+/// @ingroup cnx_def
+#if CNX_C_STD_23
+	#define noinline gnu::noinline
+#else
+	#define noinline noinline
+#endif // CNX_C_STD_23
+
 /// @def not_null
 /// @brief Attribute to specify that the function arguments in the indicated positions
 /// (1-based indices) should not be nullptr
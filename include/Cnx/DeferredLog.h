@@ -0,0 +1,313 @@
+/// @file DeferredLog.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides deferred, binary logging, where formatting happens off of the
+/// logging thread
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef CNX_DEFERRED_LOG
+/// @brief Declarations related to `CnxDeferredLog`
+#define CNX_DEFERRED_LOG
+
+#include <Cnx/Allocators.h>
+#include <Cnx/Def.h>
+#include <Cnx/Format.h>
+#include <Cnx/time/Duration.h>
+#include <Cnx/filesystem/File.h>
+
+#define RESULT_INCLUDE_DEFAULT_INSTANTIATIONS TRUE
+#include <Cnx/Result.h>
+#undef RESULT_INCLUDE_DEFAULT_INSTANTIATIONS
+
+/// @ingroup io
+/// @{
+/// @defgroup cnx_deferred_log CnxDeferredLog
+/// `CnxDeferredLog` is a logger that moves string formatting off of the logging thread.
+/// `cnx_deferred_log_println` doesn't format anything: it records the format string pointer and
+/// the raw bytes of the arguments (along with their `CnxFormat` implementations) into a
+/// per-thread ring buffer, which takes only a handful of nanoseconds. The records are later
+/// decoded into text, with the same `CnxFormat` implementations `cnx_format` uses, and written to
+/// the log's sink `CnxFile`, either periodically by a background decoder thread or explicitly
+/// with `cnx_deferred_log_flush`.
+///
+/// Each thread logging to a `CnxDeferredLog` gets its own ring buffer (created on the thread's
+/// first log call), so logging threads never contend with each other, and logging never locks or
+/// allocates after that first call. If a thread's buffer is full, the record is dropped rather
+/// than waiting for the decoder to catch up, and counted (see `cnx_deferred_log_dropped`).
+///
+/// Records from a single thread are written to the sink in the order they were logged, but
+/// records from different threads may be interleaved in any order.
+///
+/// # Argument lifetimes
+///
+/// Because arguments are formatted later, they're copied into the record by value when logged.
+/// `cstring`s, `CnxString`s, and `CnxStringView`s are copied by content, so they don't need to
+/// outlive the log call. Other types are copied bytewise (`sizeof` the argument), so user-defined
+/// types whose `CnxFormat` implementation follows pointers to other memory require that memory
+/// to remain valid until the record has been decoded. `CnxFormat` Trait objects passed directly
+/// as arguments are not copied at all, so the objects they refer to must likewise outlive
+/// decoding. The format string is never copied, so it must have static storage duration (a string
+/// literal, for example), and format strings are not validated until decoding.
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/DeferredLog.h>
+///
+/// void example(CnxFile* restrict file) {
+/// 	let_mut maybe_log = cnx_deferred_log_new(file);
+/// 	if(cnx_result_is_err(maybe_log)) {
+/// 		return;
+/// 	}
+/// 	CnxScopedDeferredLog log = cnx_result_unwrap(maybe_log);
+///
+/// 	for(let_mut i = 0; i < 100; ++i) {
+/// 		let elapsed = 1.5 * i;
+/// 		// only records `i` and `elapsed`; formatting happens on the decoder thread
+/// 		cnx_deferred_log_println(&log, "iteration {} took {}ms", i, elapsed);
+/// 	}
+///
+/// 	// any records not yet written are written when `log` is freed
+/// }
+/// @endcode
+/// @}
+
+/// @brief The default capacity, in bytes, of each thread's `CnxDeferredLog` ring buffer
+/// @ingroup cnx_deferred_log
+#define CNX_DEFERRED_LOG_DEFAULT_BUFFER_CAPACITY (static_cast(usize)(64U * 1024U))
+
+/// @brief The default interval at which a `CnxDeferredLog`'s background decoder writes pending
+/// records to its sink
+/// @ingroup cnx_deferred_log
+#define CNX_DEFERRED_LOG_DEFAULT_DECODE_INTERVAL (cnx_milliseconds(10))
+
+/// @brief The maximum number of arguments a single `CnxDeferredLog` record can have
+/// @ingroup cnx_deferred_log
+#define CNX_DEFERRED_LOG_MAX_ARGS (static_cast(usize)(UINT16_MAX))
+
+/// @brief Use to configure a `CnxDeferredLog` when creating it with
+/// `cnx_deferred_log_new_with_options`
+/// @ingroup cnx_deferred_log
+typedef struct CnxDeferredLogOptions {
+	/// @brief The capacity, in bytes, of each thread's ring buffer. This is rounded up to a power
+	/// of two, and determines the maximum size of a single record
+	usize buffer_capacity;
+	/// @brief The interval at which the background decoder writes pending records to the sink. A
+	/// zero interval disables the background decoder, in which case records are only written by
+	/// `cnx_deferred_log_flush` and when the log is freed
+	CnxDuration decode_interval;
+	/// @brief The allocator to allocate the log's state and ring buffers, and the decoded
+	/// strings, with
+	CnxAllocator allocator;
+} CnxDeferredLogOptions;
+
+/// @brief The default `CnxDeferredLogOptions`, with `CNX_DEFERRED_LOG_DEFAULT_BUFFER_CAPACITY`
+/// sized buffers, a background decoder running every `CNX_DEFERRED_LOG_DEFAULT_DECODE_INTERVAL`,
+/// and the default allocator
+/// @ingroup cnx_deferred_log
+#define cnx_deferred_log_default_options                                \
+	((CnxDeferredLogOptions){.buffer_capacity                          \
+							 = CNX_DEFERRED_LOG_DEFAULT_BUFFER_CAPACITY, \
+							 .decode_interval                          \
+							 = CNX_DEFERRED_LOG_DEFAULT_DECODE_INTERVAL, \
+							 .allocator = DEFAULT_ALLOCATOR})
+
+/// @brief The shared state of a `CnxDeferredLog`. This is an implementation detail
+/// @ingroup cnx_deferred_log
+typedef struct CnxDeferredLogState CnxDeferredLogState;
+
+/// @brief A deferred, binary logger. See the module-level documentation for details
+/// @ingroup cnx_deferred_log
+typedef struct CnxDeferredLog {
+	/// @brief The state of the log. This is allocated separately so that it has a stable
+	/// address for the logging and decoder threads
+	CnxDeferredLogState* m_state;
+} CnxDeferredLog;
+
+/// @brief A single argument to a `CnxDeferredLog` record: its `CnxFormat` implementation and the
+/// number of bytes to copy from it. An `m_size` of `0` indicates the argument is referred to, not
+/// copied
+/// @ingroup cnx_deferred_log
+typedef struct CnxDeferredLogArg {
+	CnxFormat m_format;
+	usize m_size;
+} CnxDeferredLogArg;
+
+#define RESULT_T	CnxDeferredLog
+#define RESULT_DECL TRUE
+// NOLINTNEXTLINE(readability-duplicate-include)
+#include <Cnx/Result.h>
+#undef RESULT_T
+#undef RESULT_DECL
+
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxDeferredLog operation on a nullptr")
+
+/// @brief Creates a new `CnxDeferredLog` writing to the given sink, configured with the given
+/// options
+///
+/// `sink` must remain valid until the log is freed, and must not be written to by anything other
+/// than the log while it's in use, since the log may be writing to it from its decoder thread.
+///
+/// @param sink - The `CnxFile` to write decoded records to
+/// @param options - The `CnxDeferredLogOptions` to configure the log with
+///
+/// @return `Ok` containing the new `CnxDeferredLog`, or an `Err` if the background decoder thread
+/// could not be started
+/// @ingroup cnx_deferred_log
+__attr(nodiscard) __attr(not_null(1)) CnxResult(CnxDeferredLog)
+	cnx_deferred_log_new_with_options(CnxFile* restrict sink, CnxDeferredLogOptions options)
+		cnx_disable_if(!sink, "Can't create a CnxDeferredLog with a null sink");
+/// @brief Creates a new `CnxDeferredLog` writing to the given sink, with the default options
+/// (see `cnx_deferred_log_default_options`)
+///
+/// `sink` must remain valid until the log is freed, and must not be written to by anything other
+/// than the log while it's in use, since the log may be writing to it from its decoder thread.
+///
+/// @param sink - The `CnxFile` to write decoded records to
+///
+/// @return `Ok` containing the new `CnxDeferredLog`, or an `Err` if the background decoder thread
+/// could not be started
+/// @ingroup cnx_deferred_log
+#define cnx_deferred_log_new(sink) \
+	cnx_deferred_log_new_with_options(sink, cnx_deferred_log_default_options)
+/// @brief Frees the given `CnxDeferredLog`, stopping its background decoder (if any) and writing
+/// any remaining records to its sink first
+///
+/// No thread may log to the `CnxDeferredLog` during or after this call.
+///
+/// @param self - The `CnxDeferredLog` to free
+/// @ingroup cnx_deferred_log
+__attr(not_null(1)) void cnx_deferred_log_free(void* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief declare a `CnxDeferredLog` variable with this attribute to have
+/// `cnx_deferred_log_free` automatically called on it when it goes out of scope
+/// @ingroup cnx_deferred_log
+#define CnxScopedDeferredLog scoped(cnx_deferred_log_free)
+/// @brief Records a log entry with the given format string and arguments to the calling thread's
+/// ring buffer of `self`. Prefer `cnx_deferred_log_print` or `cnx_deferred_log_println` to
+/// calling this directly
+///
+/// @param self - The `CnxDeferredLog` to log to
+/// @param newline - Whether the entry should be followed by a newline when written
+/// @param format_string - The format string of the entry. Must have static storage duration
+/// @param num_args - The number of arguments in `args`
+/// @param args - The arguments of the entry
+///
+/// @return whether the entry was recorded. Entries are dropped if they don't fit in the calling
+/// thread's ring buffer
+/// @ingroup cnx_deferred_log
+__attr(not_null(1, 3)) bool cnx_deferred_log_record(CnxDeferredLog* restrict self,
+													bool newline,
+													restrict const_cstring format_string,
+													usize num_args,
+													const CnxDeferredLogArg* restrict args)
+	___DISABLE_IF_NULL(self)
+		cnx_disable_if(!format_string, "Can't log with a null format_string")
+			cnx_disable_if(num_args > CNX_DEFERRED_LOG_MAX_ARGS,
+						   "Can't log more than CNX_DEFERRED_LOG_MAX_ARGS arguments");
+/// @brief Writes all pending records of the given `CnxDeferredLog` to its sink, then flushes the
+/// sink
+///
+/// Records logged concurrently with this call, by other threads, may or may not be written.
+///
+/// @param self - The `CnxDeferredLog` to flush
+///
+/// @return `Ok()` on success, otherwise the first error that occurred writing to or flushing the
+/// sink
+/// @ingroup cnx_deferred_log
+__attr(not_null(1)) CnxResult cnx_deferred_log_flush(CnxDeferredLog* restrict self)
+	___DISABLE_IF_NULL(self);
+/// @brief Returns the number of records that have been dropped by the given `CnxDeferredLog`
+/// because the logging thread's ring buffer was full (or the record was larger than the buffer)
+///
+/// @param self - The `CnxDeferredLog` to get the number of dropped records of
+///
+/// @return the number of dropped records
+/// @ingroup cnx_deferred_log
+__attr(nodiscard) __attr(not_null(1)) usize
+	cnx_deferred_log_dropped(const CnxDeferredLog* restrict self) ___DISABLE_IF_NULL(self);
+
+#undef ___DISABLE_IF_NULL
+
+/// @brief Converts the given variable into a `CnxDeferredLogArg`
+///
+/// `x` must be an lvalue of a type convertible to `CnxFormat` with `as_format`
+///
+/// @param x - The variable to convert
+///
+/// @return `x` as a `CnxDeferredLogArg`
+/// @ingroup cnx_deferred_log
+#define as_deferred_log_arg(x)                                                            \
+	((CnxDeferredLogArg){.m_format = as_format(x),                                        \
+						 .m_size = _Generic((&(x)),                                       \
+									CnxFormat* : static_cast(usize)(0),                   \
+									const CnxFormat* : static_cast(usize)(0),             \
+									default : sizeof(x))})
+
+// expands to the number of arguments followed by the array of them, since `PP_NUM_ARGS()` is `1`
+#define ___CNX_DEFERRED_LOG_ARGS_(...) 0, nullptr
+#define ___CNX_DEFERRED_LOG_ARGS_1(...) \
+	PP_NUM_ARGS(__VA_ARGS__),           \
+		((const CnxDeferredLogArg[]){APPLY_TO_LIST(as_deferred_log_arg, __VA_ARGS__)})
+#define ___CNX_DEFERRED_LOG_ARGS(...) \
+	CONCAT2(___CNX_DEFERRED_LOG_ARGS_, __VA_OPT__(1))(__VA_ARGS__)
+
+/// @brief Logs the string resulting from formatting `format_string` and the formatting arguments
+/// to the given `CnxDeferredLog`.
+///
+/// Only the format string and the arguments are recorded; the formatting happens when the record
+/// is decoded. See the module-level documentation for the requirements this places on the
+/// arguments.
+///
+/// @param self - Pointer to the `CnxDeferredLog` to log to
+/// @param format_string - The format string. Must have static storage duration
+/// @param ... - The formatting arguments. Each must be an lvalue
+///
+/// @return whether the entry was recorded
+/// @ingroup cnx_deferred_log
+#define cnx_deferred_log_print(self, format_string, ...) \
+	cnx_deferred_log_record(self,                         \
+							false,                        \
+							format_string,                \
+							___CNX_DEFERRED_LOG_ARGS(__VA_ARGS__))
+/// @brief Logs the string resulting from formatting `format_string` and the formatting arguments
+/// to the given `CnxDeferredLog`, followed by a newline.
+///
+/// Only the format string and the arguments are recorded; the formatting happens when the record
+/// is decoded. See the module-level documentation for the requirements this places on the
+/// arguments.
+///
+/// @param self - Pointer to the `CnxDeferredLog` to log to
+/// @param format_string - The format string. Must have static storage duration
+/// @param ... - The formatting arguments. Each must be an lvalue
+///
+/// @return whether the entry was recorded
+/// @ingroup cnx_deferred_log
+#define cnx_deferred_log_println(self, format_string, ...) \
+	cnx_deferred_log_record(self,                           \
+							true,                           \
+							format_string,                  \
+							___CNX_DEFERRED_LOG_ARGS(__VA_ARGS__))
+
+#endif // CNX_DEFERRED_LOG
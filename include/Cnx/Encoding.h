@@ -0,0 +1,247 @@
+/// @file Encoding.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides fast hexadecimal and Base64 encoding and decoding for Cnx
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef CNX_ENCODING
+/// @brief Declarations related to hexadecimal and Base64 encoding and decoding
+#define CNX_ENCODING
+
+#include <Cnx/Def.h>
+#include <Cnx/String.h>
+
+#define RESULT_INCLUDE_DEFAULT_INSTANTIATIONS TRUE
+#include <Cnx/Result.h>
+#undef RESULT_INCLUDE_DEFAULT_INSTANTIATIONS
+
+/// @ingroup cnx_string
+/// @{
+/// @defgroup cnx_encoding Encoding
+/// Cnx provides bulk hexadecimal (Base16) and Base64 (RFC 4648) encoding and decoding of binary
+/// data, for embedding identifiers, hashes, and blobs in text formats.
+///
+/// Every encoding has a function computing the exact size of its output up front
+/// (`cnx_hex_encoded_length`, `cnx_base64_decoded_length`, etc.), so that encoding and decoding
+/// can write directly into caller-provided buffers, or into a `CnxString` with a single
+/// allocation (`cnx_string_append_hex`, `cnx_string_append_base64`). On x86_64, encoding and
+/// decoding use AVX2 or SSSE3 kernels, selected at runtime, that translate 16 or 32 bytes per
+/// step with table lookups (`pshufb`) instead of per-byte branches; decoding validates the whole
+/// input as part of the same step.
+///
+/// Base64 is available with both the standard alphabet (`+` and `/`, padded with `=`) and the
+/// URL- and filename-safe alphabet (`-` and `_`, unpadded), see `CnxBase64Alphabet`. Decoding
+/// accepts input with or without padding for either alphabet.
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/Encoding.h>
+///
+/// void example(const u8* payload_id, usize length) {
+/// 	CnxScopedString record = cnx_string_from("id=");
+/// 	// writes the hex digits straight into `record`'s storage
+/// 	cnx_string_append_hex(record, payload_id, length, false);
+///
+/// 	let encoded = "aGVsbG8gd29ybGQ=";
+/// 	u8 decoded[32];
+/// 	// the exact decoded size is known before decoding
+/// 	cnx_assert(cnx_base64_decoded_length(encoded, strlen(encoded)) <= sizeof(decoded),
+/// 			   "buffer too small");
+/// 	let_mut result = cnx_base64_decode(encoded, strlen(encoded), decoded, CNX_BASE64_STANDARD);
+/// 	if(cnx_result_is_ok(result)) {
+/// 		// decoded contains the 11 bytes "hello world"
+/// 	}
+/// }
+/// @endcode
+/// @}
+
+/// @brief The Base64 alphabets supported by Cnx
+/// @ingroup cnx_encoding
+typedef enum CnxBase64Alphabet {
+	/// @brief The standard alphabet, using `+` and `/` for values 62 and 63. Encoded output is
+	/// padded with `=` to a multiple of four characters
+	/// @ingroup cnx_encoding
+	CNX_BASE64_STANDARD = 0,
+	/// @brief The URL- and filename-safe alphabet, using `-` and `_` for values 62 and 63. Encoded
+	/// output is not padded
+	/// @ingroup cnx_encoding
+	CNX_BASE64_URL,
+} CnxBase64Alphabet;
+
+/// @brief Returns the number of characters in the hexadecimal encoding of `length` bytes
+///
+/// @param length - The number of bytes to encode
+///
+/// @return the length of the encoding
+/// @ingroup cnx_encoding
+__attr(nodiscard) usize cnx_hex_encoded_length(usize length);
+
+/// @brief Encodes the given bytes as hexadecimal, two digits per byte, most significant first
+///
+/// @param data - The bytes to encode
+/// @param length - The number of bytes in `data`
+/// @param out - The buffer to write the encoding to. Must have room for
+/// `cnx_hex_encoded_length(length)` characters
+/// @param uppercase - Whether to use uppercase (`A-F`) rather than lowercase (`a-f`) digits
+///
+/// @return the number of characters written
+/// @ingroup cnx_encoding
+__attr(not_null(3)) usize
+	cnx_hex_encode(const u8* restrict data, usize length, char* restrict out, bool uppercase);
+
+/// @brief Returns the number of bytes encoded by a hexadecimal encoding of `length` characters
+///
+/// @param length - The number of characters in the encoding
+///
+/// @return the length of the decoded bytes
+/// @ingroup cnx_encoding
+__attr(nodiscard) usize cnx_hex_decoded_length(usize length);
+
+/// @brief Decodes the given hexadecimal into bytes. Both uppercase and lowercase digits are
+/// accepted
+///
+/// @param data - The hexadecimal to decode
+/// @param length - The number of characters in `data`
+/// @param out - The buffer to write the bytes to. Must have room for
+/// `cnx_hex_decoded_length(length)` bytes
+///
+/// @return `Ok` containing the number of bytes written, or an `Err` containing `EINVAL` if `data`
+/// has an odd length or contains a character that isn't a hexadecimal digit. On error, the
+/// contents of `out` are unspecified
+/// @ingroup cnx_encoding
+__attr(nodiscard) __attr(not_null(3)) CnxResult(usize)
+	cnx_hex_decode(restrict const_cstring data, usize length, u8* restrict out);
+
+/// @brief Returns the number of characters in the Base64 encoding of `length` bytes, with the
+/// given alphabet
+///
+/// @param length - The number of bytes to encode
+/// @param alphabet - The alphabet to encode with, which determines whether the encoding is padded
+///
+/// @return the length of the encoding
+/// @ingroup cnx_encoding
+__attr(nodiscard) usize cnx_base64_encoded_length(usize length, CnxBase64Alphabet alphabet);
+
+/// @brief Encodes the given bytes as Base64, with the given alphabet
+///
+/// @param data - The bytes to encode
+/// @param length - The number of bytes in `data`
+/// @param out - The buffer to write the encoding to. Must have room for
+/// `cnx_base64_encoded_length(length, alphabet)` characters
+/// @param alphabet - The alphabet to encode with
+///
+/// @return the number of characters written
+/// @ingroup cnx_encoding
+__attr(not_null(3)) usize cnx_base64_encode(const u8* restrict data,
+											usize length,
+											char* restrict out,
+											CnxBase64Alphabet alphabet);
+
+/// @brief Returns the number of bytes encoded by the given Base64
+///
+/// If `data` isn't valid Base64 this still returns an upper bound on the number of bytes
+/// `cnx_base64_decode` writes before reporting the error.
+///
+/// @param data - The Base64 to measure
+/// @param length - The number of characters in `data`
+///
+/// @return the length of the decoded bytes
+/// @ingroup cnx_encoding
+__attr(nodiscard) usize cnx_base64_decoded_length(restrict const_cstring data, usize length);
+
+/// @brief Decodes the given Base64, in the given alphabet, into bytes
+///
+/// Padding is optional. If present, `data` must be padded to a multiple of four characters.
+///
+/// @param data - The Base64 to decode
+/// @param length - The number of characters in `data`
+/// @param out - The buffer to write the bytes to. Must have room for
+/// `cnx_base64_decoded_length(data, length)` bytes
+/// @param alphabet - The alphabet `data` is encoded in
+///
+/// @return `Ok` containing the number of bytes written, or an `Err` containing `EINVAL` if `data`
+/// contains a character that isn't in `alphabet`, has invalid padding, or has an impossible
+/// length. On error, the contents of `out` are unspecified
+/// @ingroup cnx_encoding
+__attr(nodiscard) __attr(not_null(3)) CnxResult(usize)
+	cnx_base64_decode(restrict const_cstring data,
+					  usize length,
+					  u8* restrict out,
+					  CnxBase64Alphabet alphabet);
+
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't append an encoding to a nullptr CnxString")
+
+/// @brief Appends the hexadecimal encoding of the given bytes to the given `CnxString`, with at
+/// most one reallocation
+///
+/// @param self - The `CnxString` to append to
+/// @param data - The bytes to encode
+/// @param length - The number of bytes in `data`
+/// @param uppercase - Whether to use uppercase (`A-F`) rather than lowercase (`a-f`) digits
+/// @ingroup cnx_encoding
+__attr(not_null(1)) void cnx_string_append_hex(CnxString* restrict self,
+											   const u8* restrict data,
+											   usize length,
+											   bool uppercase) ___DISABLE_IF_NULL(self);
+
+/// @brief Appends the Base64 encoding of the given bytes to the given `CnxString`, with at most
+/// one reallocation
+///
+/// @param self - The `CnxString` to append to
+/// @param data - The bytes to encode
+/// @param length - The number of bytes in `data`
+/// @param alphabet - The alphabet to encode with
+/// @ingroup cnx_encoding
+__attr(not_null(1)) void cnx_string_append_base64(CnxString* restrict self,
+												  const u8* restrict data,
+												  usize length,
+												  CnxBase64Alphabet alphabet)
+	___DISABLE_IF_NULL(self);
+
+#undef ___DISABLE_IF_NULL
+
+/// @brief Appends the hexadecimal encoding of the given bytes to the given `CnxString`, with at
+/// most one reallocation
+///
+/// @param self - The `CnxString` to append to
+/// @param data - The bytes to encode
+/// @param length - The number of bytes in `data`
+/// @param uppercase - Whether to use uppercase (`A-F`) rather than lowercase (`a-f`) digits
+/// @ingroup cnx_encoding
+#define cnx_string_append_hex(self, data, length, uppercase) \
+	cnx_string_append_hex(&(self), data, length, uppercase)
+/// @brief Appends the Base64 encoding of the given bytes to the given `CnxString`, with at most
+/// one reallocation
+///
+/// @param self - The `CnxString` to append to
+/// @param data - The bytes to encode
+/// @param length - The number of bytes in `data`
+/// @param alphabet - The alphabet to encode with
+/// @ingroup cnx_encoding
+#define cnx_string_append_base64(self, data, length, alphabet) \
+	cnx_string_append_base64(&(self), data, length, alphabet)
+
+#endif // CNX_ENCODING
@@ -719,6 +719,72 @@ Trait(
 										    CnxAllocator allocator););
 // clang-format on
 
+/// @brief Formats the given array of `CnxFormat` Trait objects into their associated place in the
+/// given format string, using the provided allocator
+///
+/// This is the equivalent of `cnx_vformat_with_allocator` for arguments that have already been
+/// collected into an array, such as when formatting is deferred to a later time or another thread
+///
+/// @param format_string - The string specifying the format positions, specifiers, and other text
+/// 				       that should be present in the output string
+/// @param allocator - The `CnxAllocator` to allocate the output string with
+/// @param num_args - The number of arguments in `args`
+/// @param args - The array of arguments to be formatted
+///
+/// @return The formatted output string
+/// @ingroup format
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_format_array_with_allocator(restrict const_cstring format_string,
+									CnxAllocator allocator,
+									usize num_args,
+									const CnxFormat* restrict args)
+		cnx_disable_if(!format_string, "Can't format arguments with a null format_string")
+			cnx_disable_if(num_args != 0 && !args, "Can't format a null array of arguments");
+/// @brief Formats the given array of `CnxFormat` Trait objects into their associated place in the
+/// given format string, using the default allocator
+///
+/// @param format_string - The string specifying the format positions, specifiers, and other text
+/// 				       that should be present in the output string
+/// @param num_args - The number of arguments in `args`
+/// @param args - The array of arguments to be formatted
+///
+/// @return The formatted output string
+/// @ingroup format
+#define cnx_format_array(format_string, num_args, args) \
+	cnx_format_array_with_allocator(format_string, cnx_allocator_new(), num_args, args)
+
+/// @brief A function that receives formatted output from `cnx_vformat_into`, one piece at a time,
+/// in order
+///
+/// @param target - The destination the output is being written to
+/// @param piece - The next piece of the output
+/// @param length - The number of characters in `piece`
+/// @ingroup format
+typedef void (*CnxFormatSink)(void* restrict target, restrict const_cstring piece, usize length);
+
+/// @brief Formats the various `va_list` parameter pack arguments into their associated place in
+/// the given format string, passing the output to `sink` piece by piece instead of collecting it
+/// into a `CnxString`
+///
+/// This lets a destination like `CnxStringBuilder` receive formatted output directly, without
+/// the intermediate string `cnx_vformat_with_allocator` would allocate and the copy out of it.
+///
+/// @param target - The destination to pass to `sink`
+/// @param sink - The function to pass each piece of the output to
+/// @param format_string - The string specifying the format positions, specifiers, and other text
+/// 				       that should be present in the output
+/// @param allocator - The `CnxAllocator` to use for any allocations needed while formatting
+/// @param num_args - The number of arguments in the parameter pack
+/// @param list - The parameter pack of arguments to be formatted
+/// @ingroup format
+__attr(not_null(2, 3)) void cnx_vformat_into(void* restrict target,
+											 CnxFormatSink sink,
+											 restrict const_cstring format_string,
+											 CnxAllocator allocator,
+											 usize num_args,
+											 va_list list)
+	cnx_disable_if(!format_string, "Can't format arguments with a null format_string");
+
 	#define ___DISABLE_IF_NULL(self) \
 		cnx_disable_if(!(self), "The data being formatted can't be a nullptr")
 
@@ -954,6 +954,56 @@
 	#define cnx_iterator_into_bidirectional_iterator(iterator) \
 		trait_call(into_bidirectional_iterator, iterator)
 
+	// `CnxString` and `CnxStringView` store their elements contiguously, so the `foreach` family
+	// iterates over them through raw pointers instead of through their iterators. This removes the
+	// indirect calls to `next` and `equals` on every iteration, making the loop visible to the
+	// optimizer (and so eligible for auto-vectorization). Which path to take is decided at compile
+	// time with `_Generic`; the unused path is constant-folded away.
+	//
+	// These are declared here so that dispatch compiles whether or not `<Cnx/String.h>` has been
+	// included at the point of use.
+	typedef struct CnxString CnxString;
+	typedef struct CnxStringView CnxStringView;
+	const_cstring(cnx_string_into_cstring)(const CnxString* restrict self);
+	usize(cnx_string_length)(const CnxString* restrict self);
+	const_cstring(cnx_stringview_into_cstring)(const CnxStringView* restrict self);
+	usize(cnx_stringview_length)(const CnxStringView* restrict self);
+
+	// clang-format off
+
+	#define ___CNX_FOREACH_IS_CONTIGUOUS(collection) _Generic((&(collection)),                     \
+		CnxString* 				: true,                                                            \
+		const CnxString* 		: true,                                                            \
+		CnxStringView* 			: true,                                                            \
+		const CnxStringView* 	: true,                                                            \
+		default 				: false)
+
+	#define ___CNX_FOREACH_CONTIGUOUS_DATA(collection) _Generic((&(collection)),                   \
+		CnxString* 				: (cnx_string_into_cstring)(static_cast(const CnxString*)(&(collection))), \
+		const CnxString* 		: (cnx_string_into_cstring)(static_cast(const CnxString*)(&(collection))), \
+		CnxStringView* 			: (cnx_stringview_into_cstring)(static_cast(const CnxStringView*)(&(collection))), \
+		const CnxStringView* 	: (cnx_stringview_into_cstring)(static_cast(const CnxStringView*)(&(collection))), \
+		default 				: nullptr)
+
+	#define ___CNX_FOREACH_CONTIGUOUS_SIZE(collection) _Generic((&(collection)),                   \
+		CnxString* 				: (cnx_string_length)(static_cast(const CnxString*)(&(collection))), \
+		const CnxString* 		: (cnx_string_length)(static_cast(const CnxString*)(&(collection))), \
+		CnxStringView* 			: (cnx_stringview_length)(static_cast(const CnxStringView*)(&(collection))), \
+		const CnxStringView* 	: (cnx_stringview_length)(static_cast(const CnxStringView*)(&(collection))), \
+		default 				: 0U)
+
+	/// @brief Declares the raw pointer bounds of `collection`, if it's contiguous
+	/// (`UNIQUE_VAR(contiguous_begin)` and `UNIQUE_VAR(contiguous_end)`). Both are `nullptr` if
+	/// it's not
+	#define ___CNX_FOREACH_CONTIGUOUS_BOUNDS(collection)                                           \
+		let UNIQUE_VAR(contiguous_begin) = static_cast(typeof(cnx_iterator_current(UNIQUE_VAR(begin)))*)( \
+			___CNX_FOREACH_CONTIGUOUS_DATA(collection));                                           \
+		let UNIQUE_VAR(contiguous_end) = ___CNX_FOREACH_IS_CONTIGUOUS(collection) ?                \
+				UNIQUE_VAR(contiguous_begin) + ___CNX_FOREACH_CONTIGUOUS_SIZE(collection)          \
+				: UNIQUE_VAR(contiguous_begin);
+
+	// clang-format on
+
 	#if CNX_PLATFORM_COMPILER_GCC
 	// clang-format off
 
@@ -966,16 +1016,24 @@
 	/// @ingroup iterators
 	#define foreach(element, collection)                                                           \
 		_Pragma("GCC diagnostic push")                                                             \
-		_Pragma("GCC diagnostic ignored \"-Wdiscarded-qualifiers\"")                       	   	   \
+		_Pragma("GCC diagnostic ignored \"-Wdiscarded-qualifiers\"")                               \
 		let_mut UNIQUE_VAR(begin) = (collection).m_vtable->begin(&(collection));                   \
 		let UNIQUE_VAR(end) = (collection).m_vtable->end(&(collection));                           \
-		_Pragma("GCC diagnostic pop") 															   \
-		for(let_mut element = static_cast(typeof(cnx_iterator_current(UNIQUE_VAR(begin))))( 	   \
-								!cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end)) ? 		   \
-							  	cnx_iterator_current(UNIQUE_VAR(begin)) 						   \
-							  	: (typeof(cnx_iterator_current(UNIQUE_VAR(begin)))){0}); 		   \
-			!cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end));  							   \
-			element = cnx_iterator_next(UNIQUE_VAR(begin)))
+		_Pragma("GCC diagnostic pop")                                                              \
+		___CNX_FOREACH_CONTIGUOUS_BOUNDS(collection)                                               \
+		let_mut UNIQUE_VAR(contiguous_current) = UNIQUE_VAR(contiguous_begin);                     \
+		for(let_mut element = static_cast(typeof(cnx_iterator_current(UNIQUE_VAR(begin))))(        \
+								!___CNX_FOREACH_IS_CONTIGUOUS(collection)                          \
+								&& !cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end)) ?      \
+							  	cnx_iterator_current(UNIQUE_VAR(begin))                            \
+							  	: (typeof(cnx_iterator_current(UNIQUE_VAR(begin)))){0});           \
+			___CNX_FOREACH_IS_CONTIGUOUS(collection) ?                                             \
+				UNIQUE_VAR(contiguous_current) != UNIQUE_VAR(contiguous_end)                       \
+				&& ((element = *UNIQUE_VAR(contiguous_current)), true)                             \
+				: !cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end));                        \
+			___CNX_FOREACH_IS_CONTIGUOUS(collection) ?                                             \
+				(void)(++UNIQUE_VAR(contiguous_current))                                           \
+				: (void)(element = cnx_iterator_next(UNIQUE_VAR(begin))))
 
 	// clang-format on
 	#else
@@ -991,12 +1049,20 @@
 	#define foreach(element, collection)                                                           \
 		let_mut UNIQUE_VAR(begin) = (collection).m_vtable->cbegin(&(collection));                  \
 		let UNIQUE_VAR(end) = (collection).m_vtable->cend(&(collection));                          \
-		for(let_mut element = static_cast(typeof(cnx_iterator_current(UNIQUE_VAR(begin))))( 	   \
-								!cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end)) ? 		   \
-							  	cnx_iterator_current(UNIQUE_VAR(begin)) 						   \
-							  	: (typeof(cnx_iterator_current(UNIQUE_VAR(begin)))){0}); 		   \
-			!cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end));  							   \
-			element = cnx_iterator_next(UNIQUE_VAR(begin)))
+		___CNX_FOREACH_CONTIGUOUS_BOUNDS(collection)                                               \
+		let_mut UNIQUE_VAR(contiguous_current) = UNIQUE_VAR(contiguous_begin);                     \
+		for(let_mut element = static_cast(typeof(cnx_iterator_current(UNIQUE_VAR(begin))))(        \
+								!___CNX_FOREACH_IS_CONTIGUOUS(collection)                          \
+								&& !cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end)) ?      \
+							  	cnx_iterator_current(UNIQUE_VAR(begin))                            \
+							  	: (typeof(cnx_iterator_current(UNIQUE_VAR(begin)))){0});           \
+			___CNX_FOREACH_IS_CONTIGUOUS(collection) ?                                             \
+				UNIQUE_VAR(contiguous_current) != UNIQUE_VAR(contiguous_end)                       \
+				&& ((element = *UNIQUE_VAR(contiguous_current)), true)                             \
+				: !cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end));                        \
+			___CNX_FOREACH_IS_CONTIGUOUS(collection) ?                                             \
+				(void)(++UNIQUE_VAR(contiguous_current))                                           \
+				: (void)(element = cnx_iterator_next(UNIQUE_VAR(begin))))
 
 	// clang-format on
 	#endif
@@ -1010,15 +1076,22 @@
 	/// @param element - The name to use to reference the current element in the iteration
 	/// @param collection - The collection to iterate over
 	/// @ingroup iterators
-	#define foreach_ref(element, collection)                                     				   \
-		let_mut UNIQUE_VAR(begin) = (collection).m_vtable->cbegin(&(collection)); 				   \
-		let UNIQUE_VAR(end) = (collection).m_vtable->cend(&(collection));         				   \
-		for(let_mut element = static_cast(typeof(cnx_iterator_current(UNIQUE_VAR(begin)))*)( 	   \
-								!cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end)) ? 		   \
-							  	&cnx_iterator_current(UNIQUE_VAR(begin)) 						   \
-							  	: &(typeof(cnx_iterator_current(UNIQUE_VAR(begin)))){0}); 		   \
-			!cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end));           				   \
-			element = &cnx_iterator_next(UNIQUE_VAR(begin)))
+	#define foreach_ref(element, collection)                                                       \
+		let_mut UNIQUE_VAR(begin) = (collection).m_vtable->cbegin(&(collection));                  \
+		let UNIQUE_VAR(end) = (collection).m_vtable->cend(&(collection));                          \
+		___CNX_FOREACH_CONTIGUOUS_BOUNDS(collection)                                               \
+		for(let_mut element = static_cast(typeof(cnx_iterator_current(UNIQUE_VAR(begin)))*)(       \
+								___CNX_FOREACH_IS_CONTIGUOUS(collection) ?                         \
+								UNIQUE_VAR(contiguous_begin)                                       \
+								: !cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end)) ?       \
+							  	&cnx_iterator_current(UNIQUE_VAR(begin))                           \
+							  	: &(typeof(cnx_iterator_current(UNIQUE_VAR(begin)))){0});          \
+			___CNX_FOREACH_IS_CONTIGUOUS(collection) ?                                             \
+				element != UNIQUE_VAR(contiguous_end)                                              \
+				: !cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end));                        \
+			element = ___CNX_FOREACH_IS_CONTIGUOUS(collection) ?                                   \
+				element + 1                                                                        \
+				: &cnx_iterator_next(UNIQUE_VAR(begin)))
 
 // clang-format on
 
@@ -1032,18 +1105,25 @@
 	/// @param element - The name to use to reference the current element in the iteration
 	/// @param collection - The collection to iterate over
 	/// @ingroup iterators
-	#define foreach_ref_mut(element, collection)                                     			   \
+	#define foreach_ref_mut(element, collection)                                                   \
 		_Pragma("GCC diagnostic push")                                                             \
-		_Pragma("GCC diagnostic ignored \"-Wdiscarded-qualifiers\"")                       	   	   \
-		let_mut UNIQUE_VAR(begin) = (collection).m_vtable->begin(&(collection)); 				   \
-		let UNIQUE_VAR(end) = (collection).m_vtable->end(&(collection));         				   \
-		_Pragma("GCC diagnostic pop") 															   \
-		for(let_mut element = static_cast(typeof(cnx_iterator_current(UNIQUE_VAR(begin)))*)( 	   \
-								!cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end)) ? 		   \
-							  	&cnx_iterator_current(UNIQUE_VAR(begin)) 						   \
-							  	: &(typeof(cnx_iterator_current(UNIQUE_VAR(begin)))){0}); 		   \
-			!cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end));           				   \
-			element = &cnx_iterator_next(UNIQUE_VAR(begin)))
+		_Pragma("GCC diagnostic ignored \"-Wdiscarded-qualifiers\"")                               \
+		let_mut UNIQUE_VAR(begin) = (collection).m_vtable->begin(&(collection));                   \
+		let UNIQUE_VAR(end) = (collection).m_vtable->end(&(collection));                           \
+		_Pragma("GCC diagnostic pop")                                                              \
+		___CNX_FOREACH_CONTIGUOUS_BOUNDS(collection)                                               \
+		for(let_mut element = static_cast(typeof(cnx_iterator_current(UNIQUE_VAR(begin)))*)(       \
+								___CNX_FOREACH_IS_CONTIGUOUS(collection) ?                         \
+								UNIQUE_VAR(contiguous_begin)                                       \
+								: !cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end)) ?       \
+							  	&cnx_iterator_current(UNIQUE_VAR(begin))                           \
+							  	: &(typeof(cnx_iterator_current(UNIQUE_VAR(begin)))){0});          \
+			___CNX_FOREACH_IS_CONTIGUOUS(collection) ?                                             \
+				element != UNIQUE_VAR(contiguous_end)                                              \
+				: !cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end));                        \
+			element = ___CNX_FOREACH_IS_CONTIGUOUS(collection) ?                                   \
+				element + 1                                                                        \
+				: &cnx_iterator_next(UNIQUE_VAR(begin)))
 
 	// clang-format on
 
@@ -1057,15 +1137,22 @@
 	/// @param element - The name to use to reference the current element in the iteration
 	/// @param collection - The collection to iterate over
 	/// @ingroup iterators
-	#define foreach_ref_mut(element, collection)                                     			   \
-		let_mut UNIQUE_VAR(begin) = (collection).m_vtable->begin(&(collection)); 				   \
-		let UNIQUE_VAR(end) = (collection).m_vtable->end(&(collection));         				   \
-		for(let_mut element = static_cast(typeof(cnx_iterator_current(UNIQUE_VAR(begin)))*)( 	   \
-								!cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end)) ? 		   \
-							  	&cnx_iterator_current(UNIQUE_VAR(begin)) 						   \
-							  	: &(typeof(cnx_iterator_current(UNIQUE_VAR(begin)))){0}); 		   \
-			!cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end));           				   \
-			element = &cnx_iterator_next(UNIQUE_VAR(begin)))
+	#define foreach_ref_mut(element, collection)                                                   \
+		let_mut UNIQUE_VAR(begin) = (collection).m_vtable->begin(&(collection));                   \
+		let UNIQUE_VAR(end) = (collection).m_vtable->end(&(collection));                           \
+		___CNX_FOREACH_CONTIGUOUS_BOUNDS(collection)                                               \
+		for(let_mut element = static_cast(typeof(cnx_iterator_current(UNIQUE_VAR(begin)))*)(       \
+								___CNX_FOREACH_IS_CONTIGUOUS(collection) ?                         \
+								UNIQUE_VAR(contiguous_begin)                                       \
+								: !cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end)) ?       \
+							  	&cnx_iterator_current(UNIQUE_VAR(begin))                           \
+							  	: &(typeof(cnx_iterator_current(UNIQUE_VAR(begin)))){0});          \
+			___CNX_FOREACH_IS_CONTIGUOUS(collection) ?                                             \
+				element != UNIQUE_VAR(contiguous_end)                                              \
+				: !cnx_iterator_equals(UNIQUE_VAR(begin), UNIQUE_VAR(end));                        \
+			element = ___CNX_FOREACH_IS_CONTIGUOUS(collection) ?                                   \
+				element + 1                                                                        \
+				: &cnx_iterator_next(UNIQUE_VAR(begin)))
 
 	// clang-format on
 
@@ -0,0 +1,689 @@
+/// @file Json.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides JSON writing, and SAX and DOM style JSON parsing
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+
+#ifndef CNX_JSON
+/// @brief Declarations related to `CnxJsonWriter`, `CnxJsonHandler`, and `CnxJsonDocument`
+#define CNX_JSON
+
+#include <Cnx/Allocators.h>
+#include <Cnx/Def.h>
+#include <Cnx/Format.h>
+#include <Cnx/String.h>
+#include <Cnx/Trait.h>
+#include <Cnx/filesystem/File.h>
+
+#define OPTION_INCLUDE_DEFAULT_INSTANTIATIONS TRUE
+#include <Cnx/Option.h>
+#undef OPTION_INCLUDE_DEFAULT_INSTANTIATIONS
+
+#define RESULT_INCLUDE_DEFAULT_INSTANTIATIONS TRUE
+#include <Cnx/Result.h>
+#undef RESULT_INCLUDE_DEFAULT_INSTANTIATIONS
+
+/// @ingroup io
+/// @{
+/// @defgroup cnx_json JSON
+/// Cnx provides writing and parsing of JSON, as described by RFC 8259.
+///
+/// `CnxJsonWriter` writes JSON directly into a `CnxString` or a `CnxFile`, without formatting any
+/// intermediate strings. Strings are escaped as they're written: runs of characters that don't
+/// need escaping are found with vectorized byte scanning and appended in one go.
+///
+/// Parsing happens in two stages. The first classifies the input 64 bytes at a time with SIMD
+/// comparisons, and uses bitwise arithmetic on the resulting masks to find every structural
+/// character (`{`, `}`, `[`, `]`, `:`, `,`) and the start of every string and scalar value, while
+/// skipping over the contents of strings (accounting for escaped quotes) without branching per
+/// byte. The second stage walks that structural index to validate the document and report its
+/// contents, either:
+///
+/// - as a stream of events to a `CnxJsonHandler` (SAX style), with `cnx_json_parse_sax`, which
+/// doesn't allocate any memory for values, or
+/// - as a `CnxJsonDocument` (DOM style), with `cnx_json_parse`, whose values are allocated in
+/// large blocks from an arena owned by the document, and freed all at once with it. String values
+/// are `CnxStringView`s into the input when they contain no escape sequences, so the input must
+/// outlive the document; only strings containing escape sequences are unescaped into the arena.
+///
+/// `CnxJsonValue` implements `CnxFormat`, so parsed values can be formatted back into (compact)
+/// JSON with `cnx_format` and friends.
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/IO.h>
+/// #include <Cnx/Json.h>
+///
+/// void example(void) {
+/// 	CnxScopedString output = cnx_string_new();
+/// 	let_mut writer = cnx_json_writer_new_string(&output);
+/// 	ignore(cnx_json_writer_begin_object(&writer));
+/// 	ignore(cnx_json_writer_key_cstring(&writer, "name"));
+/// 	ignore(cnx_json_writer_write_cstring(&writer, "Cnx \"JSON\""));
+/// 	ignore(cnx_json_writer_key_cstring(&writer, "values"));
+/// 	ignore(cnx_json_writer_begin_array(&writer));
+/// 	for(let_mut i = 0; i < 3; ++i) {
+/// 		ignore(cnx_json_writer_write_i64(&writer, i));
+/// 	}
+/// 	ignore(cnx_json_writer_end_array(&writer));
+/// 	ignore(cnx_json_writer_end_object(&writer));
+/// 	// output is now {"name":"Cnx \"JSON\"","values":[0,1,2]}
+///
+/// 	let view = cnx_string_into_stringview(output);
+/// 	let_mut maybe_document = cnx_json_parse(view);
+/// 	if(cnx_result_is_err(maybe_document)) {
+/// 		return;
+/// 	}
+/// 	CnxScopedJsonDocument document = cnx_result_unwrap(maybe_document);
+/// 	let root = cnx_json_document_root(document);
+/// 	let values = cnx_json_value_get(root, "values");
+/// 	for(let_mut i = 0U; i < cnx_json_value_size(values); ++i) {
+/// 		println("{}", as_format_t(CnxJsonValue, *cnx_json_value_at(values, i)));
+/// 	}
+/// }
+/// @endcode
+/// @}
+
+/// @brief The maximum nesting depth of arrays and objects that can be written or parsed
+/// @ingroup cnx_json
+#define CNX_JSON_MAX_DEPTH (static_cast(usize)(1024U))
+
+/// @brief The type of a JSON value
+/// @ingroup cnx_json
+typedef enum CnxJsonType {
+	/// @brief `null`
+	CnxJsonNull = 0,
+	/// @brief `true` or `false`
+	CnxJsonBoolean,
+	/// @brief An integer representable as an `i64`
+	CnxJsonI64,
+	/// @brief An integer greater than `INT64_MAX` and representable as a `u64`
+	CnxJsonU64,
+	/// @brief Any other number
+	CnxJsonF64,
+	/// @brief A string
+	CnxJsonString,
+	/// @brief An array
+	CnxJsonArray,
+	/// @brief An object
+	CnxJsonObject,
+} CnxJsonType;
+
+/// @brief A JSON number, as reported to a `CnxJsonHandler`
+/// @ingroup cnx_json
+typedef struct CnxJsonNumber {
+	/// @brief The type of the number: one of `CnxJsonI64`, `CnxJsonU64`, or `CnxJsonF64`
+	CnxJsonType m_type;
+	/// @brief The value of the number, determined by `m_type`
+	union {
+		i64 m_i64;
+		u64 m_u64;
+		f64 m_f64;
+	};
+	/// @brief The text of the number in the input, for when more precision than an `f64` is
+	/// required
+	CnxStringView m_text;
+} CnxJsonNumber;
+
+typedef struct CnxJsonMember CnxJsonMember;
+
+/// @brief A JSON value in a `CnxJsonDocument`
+/// @ingroup cnx_json
+typedef struct CnxJsonValue {
+	/// @brief The type of the value
+	CnxJsonType m_type;
+	/// @brief The value, determined by `m_type`
+	union {
+		bool m_boolean;
+		i64 m_i64;
+		u64 m_u64;
+		f64 m_f64;
+		CnxStringView m_string;
+		struct {
+			struct CnxJsonValue* m_elements;
+			usize m_size;
+		} m_array;
+		struct {
+			CnxJsonMember* m_members;
+			usize m_size;
+		} m_object;
+	};
+} CnxJsonValue;
+
+/// @brief A member of a JSON object in a `CnxJsonDocument`
+/// @ingroup cnx_json
+typedef struct CnxJsonMember {
+	/// @brief The key of the member
+	CnxStringView m_key;
+	/// @brief The value of the member
+	CnxJsonValue m_value;
+} CnxJsonMember;
+
+/// @brief A block of memory in the arena of a `CnxJsonDocument`. This is an implementation detail
+/// @ingroup cnx_json
+typedef struct CnxJsonArenaBlock CnxJsonArenaBlock;
+
+/// @brief A parsed JSON document. Its values are allocated in an arena owned by the document, and
+/// freed with it
+/// @ingroup cnx_json
+typedef struct CnxJsonDocument {
+	/// @brief The root value of the document
+	CnxJsonValue m_root;
+	/// @brief The most recently allocated block of the document's arena
+	CnxJsonArenaBlock* m_blocks;
+	/// @brief The allocator the document's arena was allocated with
+	CnxAllocator m_allocator;
+} CnxJsonDocument;
+
+#define RESULT_T	CnxJsonDocument
+#define RESULT_DECL TRUE
+// NOLINTNEXTLINE(readability-duplicate-include)
+#include <Cnx/Result.h>
+#undef RESULT_T
+#undef RESULT_DECL
+
+// clang-format off
+
+/// @struct CnxJsonHandler
+/// @brief `CnxJsonHandler` is the Trait receiving the events of SAX style JSON parsing with
+/// `cnx_json_parse_sax`
+///
+/// Each function returns whether parsing should continue; returning `false` stops parsing, which
+/// then fails with `ECANCELED`. `CnxStringView`s passed to the handler are only valid for the
+/// duration of the call.
+/// @ingroup cnx_json
+Trait(CnxJsonHandler,
+	  /// @brief Called for a `null` value
+	  /// @param self - The handler
+	  /// @return whether parsing should continue
+	  bool (*const null_value)(CnxJsonHandler* restrict self);
+	  /// @brief Called for a `true` or `false` value
+	  /// @param self - The handler
+	  /// @param value - The value
+	  /// @return whether parsing should continue
+	  bool (*const boolean)(CnxJsonHandler* restrict self, bool value);
+	  /// @brief Called for a number value
+	  /// @param self - The handler
+	  /// @param value - The value
+	  /// @return whether parsing should continue
+	  bool (*const number)(CnxJsonHandler* restrict self, CnxJsonNumber value);
+	  /// @brief Called for a string value, with any escape sequences unescaped
+	  /// @param self - The handler
+	  /// @param value - The value
+	  /// @return whether parsing should continue
+	  bool (*const string)(CnxJsonHandler* restrict self, CnxStringView value);
+	  /// @brief Called at the beginning of an object
+	  /// @param self - The handler
+	  /// @return whether parsing should continue
+	  bool (*const begin_object)(CnxJsonHandler* restrict self);
+	  /// @brief Called for the key of each member of an object, before its value
+	  /// @param self - The handler
+	  /// @param key - The key, with any escape sequences unescaped
+	  /// @return whether parsing should continue
+	  bool (*const key)(CnxJsonHandler* restrict self, CnxStringView key);
+	  /// @brief Called at the end of an object
+	  /// @param self - The handler
+	  /// @return whether parsing should continue
+	  bool (*const end_object)(CnxJsonHandler* restrict self);
+	  /// @brief Called at the beginning of an array
+	  /// @param self - The handler
+	  /// @return whether parsing should continue
+	  bool (*const begin_array)(CnxJsonHandler* restrict self);
+	  /// @brief Called at the end of an array
+	  /// @param self - The handler
+	  /// @return whether parsing should continue
+	  bool (*const end_array)(CnxJsonHandler* restrict self));
+
+// clang-format on
+
+/// @brief Writes JSON to a `CnxString` or a `CnxFile`. See the module-level documentation for
+/// details
+/// @ingroup cnx_json
+typedef struct CnxJsonWriter {
+	/// @brief The string being written to, or `nullptr` if writing to a file
+	CnxString* m_string;
+	/// @brief The file being written to, or `nullptr` if writing to a string
+	CnxFile* m_file;
+	/// @brief The current nesting depth
+	usize m_depth;
+	/// @brief Bitset of whether each nesting level is an object (`1`) or array (`0`)
+	u64 m_objects[CNX_JSON_MAX_DEPTH / 64U];
+	/// @brief Whether the next key or value must be preceded by a comma
+	bool m_needs_comma;
+	/// @brief Whether a key has been written, and its value has not
+	bool m_after_key;
+	/// @brief Whether a complete top-level value has been written
+	bool m_complete;
+} CnxJsonWriter;
+
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxJsonWriter operation on a nullptr")
+
+/// @brief Creates a new `CnxJsonWriter` appending to the given `CnxString`
+///
+/// @param string - The `CnxString` to append JSON to. It must remain valid while the writer is in
+/// use
+///
+/// @return a new `CnxJsonWriter`
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) CnxJsonWriter
+	cnx_json_writer_new_string(CnxString* restrict string)
+		cnx_disable_if(!string, "Can't create a CnxJsonWriter writing to a null string");
+/// @brief Creates a new `CnxJsonWriter` writing to the given `CnxFile`
+///
+/// The writer writes directly to `file`, so `file` must be flushed (or closed) for the written
+/// data to be visible to other readers.
+///
+/// @param file - The `CnxFile` to write JSON to. It must remain valid while the writer is in use
+///
+/// @return a new `CnxJsonWriter`
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) CnxJsonWriter cnx_json_writer_new_file(CnxFile* restrict file)
+	cnx_disable_if(!file, "Can't create a CnxJsonWriter writing to a null file");
+/// @brief Begins an object with the given `CnxJsonWriter`
+///
+/// @param self - The `CnxJsonWriter` to write with
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_json
+__attr(not_null(1)) CnxResult cnx_json_writer_begin_object(CnxJsonWriter* restrict self)
+	___DISABLE_IF_NULL(self);
+/// @brief Ends the current object of the given `CnxJsonWriter`
+///
+/// @param self - The `CnxJsonWriter` to write with
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_json
+__attr(not_null(1)) CnxResult cnx_json_writer_end_object(CnxJsonWriter* restrict self)
+	___DISABLE_IF_NULL(self);
+/// @brief Begins an array with the given `CnxJsonWriter`
+///
+/// @param self - The `CnxJsonWriter` to write with
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_json
+__attr(not_null(1)) CnxResult cnx_json_writer_begin_array(CnxJsonWriter* restrict self)
+	___DISABLE_IF_NULL(self);
+/// @brief Ends the current array of the given `CnxJsonWriter`
+///
+/// @param self - The `CnxJsonWriter` to write with
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_json
+__attr(not_null(1)) CnxResult cnx_json_writer_end_array(CnxJsonWriter* restrict self)
+	___DISABLE_IF_NULL(self);
+/// @brief Writes the key of the next member of the current object of the given `CnxJsonWriter`,
+/// escaping it as necessary
+///
+/// @param self - The `CnxJsonWriter` to write with
+/// @param key - The key to write
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_json
+__attr(not_null(1, 2)) CnxResult
+	cnx_json_writer_key(CnxJsonWriter* restrict self, const CnxStringView* restrict key)
+		___DISABLE_IF_NULL(self) cnx_disable_if(!key, "Can't write a null JSON key");
+/// @brief Writes the key of the next member of the current object of the given `CnxJsonWriter`,
+/// escaping it as necessary
+///
+/// @param self - The `CnxJsonWriter` to write with
+/// @param key - The key to write
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_json
+__attr(not_null(1, 2)) CnxResult
+	cnx_json_writer_key_cstring(CnxJsonWriter* restrict self, restrict const_cstring key)
+		___DISABLE_IF_NULL(self) cnx_disable_if(!key, "Can't write a null JSON key");
+/// @brief Writes a `null` value with the given `CnxJsonWriter`
+///
+/// @param self - The `CnxJsonWriter` to write with
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_json
+__attr(not_null(1)) CnxResult cnx_json_writer_write_null(CnxJsonWriter* restrict self)
+	___DISABLE_IF_NULL(self);
+/// @brief Writes a boolean value with the given `CnxJsonWriter`
+///
+/// @param self - The `CnxJsonWriter` to write with
+/// @param value - The value to write
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_json
+__attr(not_null(1)) CnxResult cnx_json_writer_write_bool(CnxJsonWriter* restrict self, bool value)
+	___DISABLE_IF_NULL(self);
+/// @brief Writes a signed integer value with the given `CnxJsonWriter`
+///
+/// @param self - The `CnxJsonWriter` to write with
+/// @param value - The value to write
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_json
+__attr(not_null(1)) CnxResult cnx_json_writer_write_i64(CnxJsonWriter* restrict self, i64 value)
+	___DISABLE_IF_NULL(self);
+/// @brief Writes an unsigned integer value with the given `CnxJsonWriter`
+///
+/// @param self - The `CnxJsonWriter` to write with
+/// @param value - The value to write
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_json
+__attr(not_null(1)) CnxResult cnx_json_writer_write_u64(CnxJsonWriter* restrict self, u64 value)
+	___DISABLE_IF_NULL(self);
+/// @brief Writes a floating point value with the given `CnxJsonWriter`
+///
+/// The value is written with the fewest significant digits (up to 17) that parse back to exactly
+/// the same value. JSON can't represent infinities or NaN, so they're written as `null`.
+///
+/// @param self - The `CnxJsonWriter` to write with
+/// @param value - The value to write
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_json
+__attr(not_null(1)) CnxResult cnx_json_writer_write_f64(CnxJsonWriter* restrict self, f64 value)
+	___DISABLE_IF_NULL(self);
+/// @brief Writes a string value with the given `CnxJsonWriter`, escaping it as necessary
+///
+/// @param self - The `CnxJsonWriter` to write with
+/// @param value - The value to write
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_json
+__attr(not_null(1, 2)) CnxResult
+	cnx_json_writer_write_string(CnxJsonWriter* restrict self, const CnxStringView* restrict value)
+		___DISABLE_IF_NULL(self) cnx_disable_if(!value, "Can't write a null JSON string");
+/// @brief Writes a string value with the given `CnxJsonWriter`, escaping it as necessary
+///
+/// @param self - The `CnxJsonWriter` to write with
+/// @param value - The value to write
+///
+/// @return `Ok()` on success, otherwise the error that occurred writing to the file
+/// @ingroup cnx_json
+__attr(not_null(1, 2)) CnxResult
+	cnx_json_writer_write_cstring(CnxJsonWriter* restrict self, restrict const_cstring value)
+		___DISABLE_IF_NULL(self) cnx_disable_if(!value, "Can't write a null JSON string");
+/// @brief Writes the given `CnxJsonValue`, and all of its elements or members, with the given
+/// `CnxJsonWriter`
+///
+/// @param self - The `CnxJsonWriter` to write with
+/// @param value - The value to write
+///
+/// @return `Ok()` on success, otherwise the first error that occurred writing to the file
+/// @ingroup cnx_json
+__attr(not_null(1, 2)) CnxResult
+	cnx_json_writer_write_value(CnxJsonWriter* restrict self, const CnxJsonValue* restrict value)
+		___DISABLE_IF_NULL(self) cnx_disable_if(!value, "Can't write a null JSON value");
+/// @brief Returns whether the given `CnxJsonWriter` has written a complete top-level value
+///
+/// @param self - The `CnxJsonWriter` to check
+///
+/// @return whether a complete JSON value has been written
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) static inline bool
+	cnx_json_writer_is_complete(const CnxJsonWriter* restrict self) ___DISABLE_IF_NULL(self) {
+	return self->m_complete;
+}
+
+#undef ___DISABLE_IF_NULL
+
+/// @brief Parses the given JSON, reporting its contents to the given `CnxJsonHandler`
+///
+/// @param input - The JSON to parse
+/// @param handler - The `CnxJsonHandler` to report the contents of `input` to
+/// @param allocator - The `CnxAllocator` to allocate the parser's temporary buffers with
+///
+/// @return `Ok()` if `input` is valid JSON and the handler didn't stop parsing, an `Err`
+/// containing `ECANCELED` if the handler stopped parsing, or an `Err` containing `EINVAL` if
+/// `input` isn't valid JSON (including if it isn't valid UTF-8, or nests arrays and objects
+/// deeper than `CNX_JSON_MAX_DEPTH`)
+/// @ingroup cnx_json
+__attr(not_null(1, 2)) CnxResult
+	cnx_json_parse_sax_with_allocator(const CnxStringView* restrict input,
+									  CnxJsonHandler* restrict handler,
+									  CnxAllocator allocator)
+		cnx_disable_if(!input, "Can't parse null JSON input")
+			cnx_disable_if(!handler, "Can't parse JSON with a null handler");
+/// @brief Parses the given JSON, reporting its contents to the given `CnxJsonHandler`
+///
+/// @param input - The JSON to parse, as a `CnxStringView`
+/// @param handler - The `CnxJsonHandler` to report the contents of `input` to
+///
+/// @return `Ok()` if `input` is valid JSON and the handler didn't stop parsing, an `Err`
+/// containing `ECANCELED` if the handler stopped parsing, or an `Err` containing `EINVAL` if
+/// `input` isn't valid JSON (including if it isn't valid UTF-8, or nests arrays and objects
+/// deeper than `CNX_JSON_MAX_DEPTH`)
+/// @ingroup cnx_json
+#define cnx_json_parse_sax(input, handler) \
+	cnx_json_parse_sax_with_allocator(&(input), handler, DEFAULT_ALLOCATOR)
+/// @brief Parses the given JSON into a `CnxJsonDocument`, allocating it with the given allocator
+///
+/// String values in the document may refer to `input`, so `input` must outlive the document.
+///
+/// @param input - The JSON to parse
+/// @param allocator - The `CnxAllocator` to allocate the document (and the parser's temporary
+/// buffers) with
+///
+/// @return `Ok` containing the parsed document, or an `Err` containing `EINVAL` if `input` isn't
+/// valid JSON (including if it isn't valid UTF-8, or nests arrays and objects deeper than
+/// `CNX_JSON_MAX_DEPTH`)
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) CnxResult(CnxJsonDocument)
+	cnx_json_parse_with_allocator(const CnxStringView* restrict input, CnxAllocator allocator)
+		cnx_disable_if(!input, "Can't parse null JSON input");
+/// @brief Parses the given JSON into a `CnxJsonDocument`
+///
+/// String values in the document may refer to `input`, so `input` must outlive the document.
+///
+/// @param input - The JSON to parse, as a `CnxStringView`
+///
+/// @return `Ok` containing the parsed document, or an `Err` containing `EINVAL` if `input` isn't
+/// valid JSON (including if it isn't valid UTF-8, or nests arrays and objects deeper than
+/// `CNX_JSON_MAX_DEPTH`)
+/// @ingroup cnx_json
+#define cnx_json_parse(input) cnx_json_parse_with_allocator(&(input), DEFAULT_ALLOCATOR)
+/// @brief Frees the given `CnxJsonDocument`, and all of its values
+///
+/// @param self - The `CnxJsonDocument` to free
+/// @ingroup cnx_json
+__attr(not_null(1)) void cnx_json_document_free(void* restrict self)
+	cnx_disable_if(!self, "Can't free a nullptr");
+/// @brief declare a `CnxJsonDocument` variable with this attribute to have
+/// `cnx_json_document_free` automatically called on it when it goes out of scope
+/// @ingroup cnx_json
+#define CnxScopedJsonDocument scoped(cnx_json_document_free)
+
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxJsonValue operation on a nullptr")
+
+/// @brief Returns the root value of the given `CnxJsonDocument`
+///
+/// @param self - The `CnxJsonDocument` to get the root of
+///
+/// @return the root value
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) __attr(returns_not_null) static inline const CnxJsonValue*
+	cnx_json_document_root(const CnxJsonDocument* restrict self)
+		cnx_disable_if(!self, "Can't get the root of a null CnxJsonDocument") {
+	return &(self->m_root);
+}
+/// @brief Returns the type of the given `CnxJsonValue`
+///
+/// @param self - The `CnxJsonValue` to get the type of
+///
+/// @return the type of the value
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) static inline CnxJsonType
+	cnx_json_value_type(const CnxJsonValue* restrict self) ___DISABLE_IF_NULL(self) {
+	return self->m_type;
+}
+/// @brief Returns the value of the given boolean `CnxJsonValue`
+///
+/// @param self - The `CnxJsonValue` to get the value of. Must be a `CnxJsonBoolean`
+///
+/// @return the value
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) static inline bool
+	cnx_json_value_as_bool(const CnxJsonValue* restrict self) ___DISABLE_IF_NULL(self) {
+	cnx_assert(self->m_type == CnxJsonBoolean,
+			   "cnx_json_value_as_bool called on a non-boolean CnxJsonValue");
+	return self->m_boolean;
+}
+/// @brief Returns the value of the given `CnxJsonValue` as an `i64`, if it's an integer
+/// representable as one
+///
+/// @param self - The `CnxJsonValue` to get the value of
+///
+/// @return `Some` containing the value, or `None` if `self` isn't an integer representable as an
+/// `i64`
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) CnxOption(i64)
+	cnx_json_value_as_i64(const CnxJsonValue* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns the value of the given `CnxJsonValue` as a `u64`, if it's an integer
+/// representable as one
+///
+/// @param self - The `CnxJsonValue` to get the value of
+///
+/// @return `Some` containing the value, or `None` if `self` isn't an integer representable as a
+/// `u64`
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) CnxOption(u64)
+	cnx_json_value_as_u64(const CnxJsonValue* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns the value of the given `CnxJsonValue` as an `f64`, if it's a number
+///
+/// @param self - The `CnxJsonValue` to get the value of
+///
+/// @return `Some` containing the value (converted to the nearest `f64`, if it's an integer), or
+/// `None` if `self` isn't a number
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) CnxOption(f64)
+	cnx_json_value_as_f64(const CnxJsonValue* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns the value of the given `CnxJsonValue`, if it's a string
+///
+/// @param self - The `CnxJsonValue` to get the value of
+///
+/// @return `Some` containing the value, or `None` if `self` isn't a string
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) CnxOption(CnxStringView)
+	cnx_json_value_as_string(const CnxJsonValue* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns the number of elements (if it's an array) or members (if it's an object) of the
+/// given `CnxJsonValue`
+///
+/// @param self - The `CnxJsonValue` to get the size of
+///
+/// @return the number of elements or members, or `0` if `self` is neither an array nor an object
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) usize cnx_json_value_size(const CnxJsonValue* restrict self)
+	___DISABLE_IF_NULL(self);
+/// @brief Returns the element at the given index of the given array `CnxJsonValue`
+///
+/// @param self - The `CnxJsonValue` to get the element of
+/// @param index - The index of the element to get
+///
+/// @return the element, or `nullptr` if `self` isn't an array or `index` is out of bounds
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) const CnxJsonValue*
+	cnx_json_value_at(const CnxJsonValue* restrict self, usize index) ___DISABLE_IF_NULL(self);
+/// @brief Returns the member at the given index of the given object `CnxJsonValue`. Members are in
+/// the order they appear in the input
+///
+/// @param self - The `CnxJsonValue` to get the member of
+/// @param index - The index of the member to get
+///
+/// @return the member, or `nullptr` if `self` isn't an object or `index` is out of bounds
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) const CnxJsonMember*
+	cnx_json_value_member_at(const CnxJsonValue* restrict self, usize index)
+		___DISABLE_IF_NULL(self);
+/// @brief Returns the value of the first member with the given key of the given object
+/// `CnxJsonValue`
+///
+/// Members are searched linearly, so iterate over them with `cnx_json_value_member_at` instead
+/// when visiting many members of a large object.
+///
+/// @param self - The `CnxJsonValue` to get the member of
+/// @param key - The key of the member to get
+///
+/// @return the value of the member, or `nullptr` if `self` isn't an object or has no member with
+/// the given key
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1, 2)) const CnxJsonValue*
+	cnx_json_value_get(const CnxJsonValue* restrict self, restrict const_cstring key)
+		___DISABLE_IF_NULL(self) cnx_disable_if(!key, "Can't get a JSON member with a null key");
+
+/// @brief Implementation of `CnxFormat.is_specifier_valid` for `CnxJsonValue`. Only the empty
+/// specifier is valid
+///
+/// @param self - The `CnxJsonValue` to format as a `CnxFormat` trait object
+/// @param specifier - The `CnxStringView` viewing the format specifier to validate
+///
+/// @return The `CnxFormatContext` indicating whether specifier was valid
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) CnxFormatContext
+	cnx_json_value_is_specifier_valid(const CnxFormat* restrict self, CnxStringView specifier)
+		___DISABLE_IF_NULL(self);
+/// @brief Implements the allocator-unaware part of the `CnxFormat` trait for `CnxJsonValue`,
+/// formatting it as compact JSON
+///
+/// @param self - The `CnxJsonValue` to format, as its `CnxFormat` trait representation
+/// @param context - The `CnxFormatContext` specifying how formatting should be done
+///
+/// @return `self` formatted as a `CnxString`
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_json_value_format(const CnxFormat* restrict self, CnxFormatContext context)
+		___DISABLE_IF_NULL(self);
+/// @brief Implements the allocator-aware part of the `CnxFormat` trait for `CnxJsonValue`,
+/// formatting it as compact JSON
+///
+/// @param self - The `CnxJsonValue` to format, as its `CnxFormat` trait representation
+/// @param context - The `CnxFormatContext` specifying how formatting should be done
+/// @param allocator - The `CnxAllocator` to allocate memory with
+///
+/// @return `self` formatted as a `CnxString`
+/// @ingroup cnx_json
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_json_value_format_with_allocator(const CnxFormat* restrict self,
+										 CnxFormatContext context,
+										 CnxAllocator allocator) ___DISABLE_IF_NULL(self);
+
+/// @brief Implements the `CnxFormat` trait for `CnxJsonValue`
+/// @ingroup cnx_json
+__attr(maybe_unused) static ImplTraitFor(CnxFormat,
+										 CnxJsonValue,
+										 cnx_json_value_is_specifier_valid,
+										 cnx_json_value_format,
+										 cnx_json_value_format_with_allocator);
+
+#undef ___DISABLE_IF_NULL
+
+/// @brief Returns the root value of the given `CnxJsonDocument`
+///
+/// @param self - The `CnxJsonDocument` to get the root of
+///
+/// @return the root value
+/// @ingroup cnx_json
+#define cnx_json_document_root(self) cnx_json_document_root(&(self))
+
+#endif // CNX_JSON
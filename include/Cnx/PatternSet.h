@@ -0,0 +1,474 @@
+/// @file PatternSet.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief CnxPatternSet provides single-pass multi-pattern search and replacement over strings
+/// and `CnxFile` streams
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef CNX_PATTERN_SET
+/// @brief Declarations related to `CnxPatternSet`
+#define CNX_PATTERN_SET
+
+#include <Cnx/Allocators.h>
+#include <Cnx/Def.h>
+#include <Cnx/String.h>
+#include <Cnx/StringSearch.h>
+#include <Cnx/__string/__byte_scan.h>
+#include <Cnx/filesystem/File.h>
+
+/// @ingroup cnx_string
+/// @{
+/// @defgroup cnx_pattern_set CnxPatternSet
+/// `CnxPatternSet` is a compiled set of patterns that can be searched for simultaneously, in a
+/// single pass over the input, regardless of how many patterns it contains.
+///
+/// A `CnxPatternSet` is built once from a list of patterns (`cnx_pattern_set_new`) into an
+/// Aho-Corasick automaton: a trie of the patterns whose failure transitions have been resolved
+/// ahead of time, so that searching does exactly one table lookup per input byte and never
+/// backtracks. Input bytes are mapped to a small number of equivalence classes (the distinct bytes
+/// occurring in the patterns, plus one class for every other byte) to keep the transition table
+/// compact, and while the automaton is in its start state, input is skipped ahead to the next
+/// byte that can begin a pattern using the vectorized byte scanning kernels.
+///
+/// Matches can be found in several ways:
+/// - `cnx_pattern_set_find_first` finds the leftmost match in a string, preferring the longest
+/// pattern when several start at the same position.
+/// - `CnxPatternMatcher` iterates over every match (including overlapping ones) in a string or,
+/// incrementally and in bounded memory, in a `CnxFile`.
+/// - `cnx_string_replace_all` replaces every non-overlapping leftmost-longest match with the
+/// corresponding replacement, building the result with a single allocation.
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/PatternSet.h>
+///
+/// void scrub(CnxString* line) {
+/// 	let patterns = (CnxStringView[]){
+/// 		cnx_stringview_from("password=", 0, 9),
+/// 		cnx_stringview_from("token=", 0, 6),
+/// 	};
+/// 	let replacements = (CnxStringView[]){
+/// 		cnx_stringview_from("password=***", 0, 12),
+/// 		cnx_stringview_from("token=***", 0, 9),
+/// 	};
+/// 	// build once, use for many lines
+/// 	CnxScopedPatternSet set = cnx_pattern_set_new(patterns, 2);
+///
+/// 	let_mut scrubbed = cnx_string_replace_all(*line, set, replacements);
+/// 	cnx_string_free(*line);
+/// 	*line = scrubbed;
+///
+/// 	// or iterate over every match
+/// 	CnxScopedPatternMatcher matcher = cnx_pattern_matcher_new(set, line);
+/// 	let_mut match = cnx_pattern_matcher_next(matcher);
+/// 	while(cnx_option_is_some(match)) {
+/// 		let found = cnx_option_unwrap(match);
+/// 		println("pattern {} at {}", found.m_pattern, found.m_start);
+/// 		match = cnx_pattern_matcher_next(matcher);
+/// 	}
+/// }
+/// @endcode
+/// @}
+
+/// @brief The maximum number of distinct first bytes of the patterns in a `CnxPatternSet` for
+/// which searching from the start state skips ahead with the vectorized byte scanning kernels.
+/// With more than this many, candidate bytes are usually too frequent for skipping to pay off
+/// @ingroup cnx_pattern_set
+#define CNX_PATTERN_SET_PREFILTER_MAX_BYTES 16
+
+/// @brief The default size of the buffer a `CnxPatternMatcher` reads a `CnxFile` in chunks of
+/// @ingroup cnx_pattern_set
+#define CNX_PATTERN_MATCHER_DEFAULT_BUFFER_SIZE 4096
+
+/// @brief A match of a pattern in a `CnxPatternSet`
+/// @ingroup cnx_pattern_set
+typedef struct CnxPatternMatch {
+	/// @brief The index of the matched pattern, in the list the `CnxPatternSet` was built from
+	usize m_pattern;
+	/// @brief The index in the input the match starts at
+	usize m_start;
+	/// @brief The length of the match
+	usize m_length;
+} CnxPatternMatch;
+
+#define OPTION_DECL TRUE
+/// @brief Declares `CnxOption(T)` for `CnxPatternMatch`
+#define OPTION_T CnxPatternMatch
+#include <Cnx/Option.h>
+#undef OPTION_T
+#undef OPTION_DECL
+
+/// @brief `CnxPatternSet` is a compiled Aho-Corasick automaton for finding any of a set of
+/// patterns in a single pass
+/// @ingroup cnx_pattern_set
+typedef struct CnxPatternSet {
+	/// @brief The transition table: `m_num_classes` next states for each state, with the failure
+	/// transitions already resolved. State `0` is the start state
+	u32* m_transitions;
+	/// @brief The index of the pattern ending at each state, if any
+	u32* m_outputs;
+	/// @brief For each state, the nearest state reachable by failure transitions that has an
+	/// output, or `0` if there is none
+	u32* m_output_links;
+	/// @brief The lengths of the patterns
+	usize* m_pattern_lengths;
+	/// @brief The equivalence class of each byte value
+	u16* m_classes;
+	/// @brief The bytes patterns can start with
+	CnxByteSet m_first_bytes;
+	/// @brief The number of states in the automaton
+	usize m_num_states;
+	/// @brief The number of byte equivalence classes
+	usize m_num_classes;
+	/// @brief The number of patterns
+	usize m_num_patterns;
+	/// @brief The length of the longest pattern
+	usize m_max_pattern_length;
+	/// @brief Whether to skip ahead to the next byte in `m_first_bytes` while in the start state
+	bool m_use_prefilter;
+	/// @brief The allocator used for the set's memory
+	CnxAllocator m_allocator;
+} CnxPatternSet;
+
+/// @brief `CnxPatternMatcher` iterates over every match of a `CnxPatternSet`'s patterns in a
+/// string or `CnxFile`, in order of the end position of the matches
+/// @ingroup cnx_pattern_set
+typedef struct CnxPatternMatcher {
+	/// @brief The set of patterns being searched for
+	const CnxPatternSet* m_set;
+	/// @brief The input currently being searched
+	const u8* m_data;
+	/// @brief The length of `m_data`
+	usize m_length;
+	/// @brief The index in `m_data` of the next byte to search
+	usize m_position;
+	/// @brief The index of `m_data` in the overall input
+	usize m_offset;
+	/// @brief The current state of the automaton
+	u32 m_state;
+	/// @brief The state with the next output to report at the current position, or `0`
+	u32 m_pending;
+	/// @brief The file being searched, if searching a file
+	CnxFile* m_file;
+	/// @brief The buffer `m_file` is read into, if searching a file
+	u8* m_buffer;
+	/// @brief The size of `m_buffer`
+	usize m_buffer_size;
+	/// @brief The result of the last read from `m_file`
+	CnxResult m_status;
+} CnxPatternMatcher;
+
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxPatternSet operation on a nullptr")
+
+/// @brief Builds a new `CnxPatternSet` from the given patterns, using the given allocator
+///
+/// If the same pattern occurs more than once, matches report the index of its first occurrence.
+///
+/// @param patterns - The patterns to search for. Must not be empty strings
+/// @param num_patterns - The number of patterns
+/// @param allocator - The `CnxAllocator` to allocate memory with
+///
+/// @return a `CnxPatternSet` for `patterns`
+/// @ingroup cnx_pattern_set
+__attr(nodiscard) CnxPatternSet
+	cnx_pattern_set_new_with_allocator(const CnxStringView* restrict patterns,
+									   usize num_patterns,
+									   CnxAllocator allocator)
+		cnx_disable_if(!patterns && num_patterns != 0,
+					   "Can't build a CnxPatternSet from a nullptr");
+/// @brief Frees the given `CnxPatternSet`
+///
+/// @param self - The `CnxPatternSet` to free
+/// @ingroup cnx_pattern_set
+__attr(not_null(1)) void cnx_pattern_set_free(void* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief declare a `CnxPatternSet` variable with this attribute to have `cnx_pattern_set_free`
+/// automatically called on it when it goes out of scope
+/// @ingroup cnx_pattern_set
+#define CnxScopedPatternSet scoped(cnx_pattern_set_free)
+/// @brief Returns the number of patterns in the given `CnxPatternSet`
+///
+/// @param self - The `CnxPatternSet` to get the size of
+///
+/// @return the number of patterns in `self`
+/// @ingroup cnx_pattern_set
+__attr(nodiscard) __attr(not_null(1)) usize
+	cnx_pattern_set_size(const CnxPatternSet* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Finds the leftmost match of any of the patterns in the given `CnxPatternSet` in the
+/// given string. If several patterns match at the leftmost position, the longest one is chosen
+///
+/// @param self - The `CnxPatternSet` to search with
+/// @param haystack - The string to search in
+/// @param haystack_length - The length of `haystack`
+///
+/// @return `Some` leftmost-longest match, or `None` if no pattern occurs in `haystack`
+/// @ingroup cnx_pattern_set
+__attr(nodiscard) __attr(not_null(1, 2)) CnxOption(CnxPatternMatch)
+	cnx_pattern_set_find_first_cstring(const CnxPatternSet* restrict self,
+									   restrict const_cstring haystack,
+									   usize haystack_length) ___DISABLE_IF_NULL(self);
+
+/// @brief Creates a `CnxPatternMatcher` iterating over every match of the given `CnxPatternSet`'s
+/// patterns in the given string
+///
+/// @param set - The `CnxPatternSet` to search with. Must outlive the matcher
+/// @param haystack - The string to search in. Must outlive the matcher
+/// @param haystack_length - The length of `haystack`
+///
+/// @return a `CnxPatternMatcher` over `haystack`
+/// @ingroup cnx_pattern_set
+__attr(nodiscard) __attr(not_null(1, 2)) CnxPatternMatcher
+	cnx_pattern_matcher_new_cstring(const CnxPatternSet* restrict set,
+									restrict const_cstring haystack,
+									usize haystack_length) ___DISABLE_IF_NULL(set);
+/// @brief Creates a `CnxPatternMatcher` iterating over every match of the given `CnxPatternSet`'s
+/// patterns in the given `CnxFile`, from its current position to its end.
+///
+/// The file is read in chunks of `buffer_size` bytes as matching progresses, so files of any size
+/// are searched in bounded memory. Matches spanning chunk boundaries are found as normal, and
+/// match positions are relative to the file position the matcher was created at.
+///
+/// @param set - The `CnxPatternSet` to search with. Must outlive the matcher
+/// @param file - The `CnxFile` to search in. Must outlive the matcher
+/// @param buffer_size - The size of the chunks to read `file` in
+///
+/// @return a `CnxPatternMatcher` over `file`
+/// @ingroup cnx_pattern_set
+__attr(nodiscard) __attr(not_null(1, 2)) CnxPatternMatcher
+	cnx_pattern_matcher_from_file(const CnxPatternSet* restrict set,
+								  CnxFile* restrict file,
+								  usize buffer_size) ___DISABLE_IF_NULL(set)
+		cnx_disable_if(!file, "Can't search a nullptr CnxFile");
+/// @brief Frees the given `CnxPatternMatcher`
+///
+/// @param self - The `CnxPatternMatcher` to free
+/// @ingroup cnx_pattern_set
+__attr(not_null(1)) void cnx_pattern_matcher_free(void* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief declare a `CnxPatternMatcher` variable with this attribute to have
+/// `cnx_pattern_matcher_free` automatically called on it when it goes out of scope
+/// @ingroup cnx_pattern_set
+#define CnxScopedPatternMatcher scoped(cnx_pattern_matcher_free)
+/// @brief Returns the next match found by the given `CnxPatternMatcher`.
+///
+/// Every occurrence of every pattern is reported, including overlapping ones. Matches are
+/// reported in order of their end position and, for matches ending at the same position, from
+/// longest to shortest.
+///
+/// @param self - The `CnxPatternMatcher` to get the next match from
+///
+/// @return `Some` next match, or `None` if the end of the input has been reached (or reading the
+/// `CnxFile` being searched failed, see `cnx_pattern_matcher_status`)
+/// @ingroup cnx_pattern_set
+__attr(nodiscard) __attr(not_null(1)) CnxOption(CnxPatternMatch)
+	cnx_pattern_matcher_next(CnxPatternMatcher* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns whether reading the `CnxFile` searched by the given `CnxPatternMatcher` has
+/// failed. Always `Ok` for matchers over strings
+///
+/// @param self - The `CnxPatternMatcher` to get the status of
+///
+/// @return `Ok` if no read has failed, otherwise the error the failing read returned
+/// @ingroup cnx_pattern_set
+__attr(nodiscard) __attr(not_null(1)) CnxResult
+	cnx_pattern_matcher_status(const CnxPatternMatcher* restrict self) ___DISABLE_IF_NULL(self);
+
+#undef ___DISABLE_IF_NULL
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxString operation on a nullptr")
+
+/// @brief Returns a copy of the given `CnxStringView` with every match of the given
+/// `CnxPatternSet`'s patterns replaced with the corresponding replacement.
+///
+/// Matches are chosen leftmost-longest and don't overlap: scanning from left to right, the
+/// leftmost match is replaced (preferring the longest pattern when several start at the same
+/// position), and scanning resumes after it. The size of the result is computed before it's
+/// built, so it's built with a single allocation.
+///
+/// @param self - The `CnxStringView` to replace the patterns in
+/// @param patterns - The patterns to replace
+/// @param replacements - The replacement for each pattern, indexed the same as the list
+/// `patterns` was built from
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return a copy of `self` with every match replaced
+/// @ingroup cnx_pattern_set
+__attr(nodiscard) __attr(not_null(1, 2, 3)) CnxString
+	cnx_stringview_replace_all_with_allocator(const CnxStringView* restrict self,
+											  const CnxPatternSet* restrict patterns,
+											  const CnxStringView* restrict replacements,
+											  CnxAllocator allocator) ___DISABLE_IF_NULL(self);
+/// @brief Returns a copy of the given `CnxString` with every match of the given
+/// `CnxPatternSet`'s patterns replaced with the corresponding replacement, using the same
+/// allocator as `self`. See `cnx_stringview_replace_all_with_allocator`
+///
+/// @param self - The `CnxString` to replace the patterns in
+/// @param patterns - The patterns to replace
+/// @param replacements - The replacement for each pattern, indexed the same as the list
+/// `patterns` was built from
+///
+/// @return a copy of `self` with every match replaced
+/// @ingroup cnx_pattern_set
+__attr(nodiscard) __attr(not_null(1, 2, 3)) CnxString
+	cnx_string_replace_all(const CnxString* restrict self,
+						   const CnxPatternSet* restrict patterns,
+						   const CnxStringView* restrict replacements) ___DISABLE_IF_NULL(self);
+/// @brief Returns a copy of the given `CnxString` with every match of the given
+/// `CnxPatternSet`'s patterns replaced with the corresponding replacement. See
+/// `cnx_stringview_replace_all_with_allocator`
+///
+/// @param self - The `CnxString` to replace the patterns in
+/// @param patterns - The patterns to replace
+/// @param replacements - The replacement for each pattern, indexed the same as the list
+/// `patterns` was built from
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return a copy of `self` with every match replaced
+/// @ingroup cnx_pattern_set
+__attr(nodiscard) __attr(not_null(1, 2, 3)) CnxString
+	cnx_string_replace_all_with_allocator(const CnxString* restrict self,
+										  const CnxPatternSet* restrict patterns,
+										  const CnxStringView* restrict replacements,
+										  CnxAllocator allocator) ___DISABLE_IF_NULL(self);
+
+#undef ___DISABLE_IF_NULL
+
+/// @brief Builds a new `CnxPatternSet` from the given patterns
+///
+/// If the same pattern occurs more than once, matches report the index of its first occurrence.
+///
+/// @param patterns - The patterns to search for, as an array of `CnxStringView`s. Must not be
+/// empty strings
+/// @param num_patterns - The number of patterns
+///
+/// @return a `CnxPatternSet` for `patterns`
+/// @ingroup cnx_pattern_set
+#define cnx_pattern_set_new(patterns, num_patterns) \
+	cnx_pattern_set_new_with_allocator((patterns), (num_patterns), DEFAULT_ALLOCATOR)
+/// @brief Frees the given `CnxPatternSet`
+///
+/// @param self - The `CnxPatternSet` to free
+/// @ingroup cnx_pattern_set
+#define cnx_pattern_set_free(self) cnx_pattern_set_free(&(self))
+/// @brief Returns the number of patterns in the given `CnxPatternSet`
+///
+/// @param self - The `CnxPatternSet` to get the size of
+///
+/// @return the number of patterns in `self`
+/// @ingroup cnx_pattern_set
+#define cnx_pattern_set_size(self) cnx_pattern_set_size(&(self))
+/// @brief Finds the leftmost match of any of the patterns in the given `CnxPatternSet` in the
+/// given string. If several patterns match at the leftmost position, the longest one is chosen
+///
+/// @param self - The `CnxPatternSet` to search with
+/// @param haystack - The string to search in. Can be a `cstring`, a pointer to a `CnxStringView`,
+/// or a pointer to a `CnxString`
+///
+/// @return `Some` leftmost-longest match, or `None` if no pattern occurs in `haystack`
+/// @ingroup cnx_pattern_set
+#define cnx_pattern_set_find_first(self, haystack) \
+	cnx_pattern_set_find_first_cstring(&(self), ___CNX_STRING_SEARCH_NEEDLE(haystack))
+/// @brief Creates a `CnxPatternMatcher` iterating over every match of the given `CnxPatternSet`'s
+/// patterns in the given string
+///
+/// @param set - The `CnxPatternSet` to search with. Must outlive the matcher
+/// @param haystack - The string to search in. Can be a `cstring`, a pointer to a `CnxStringView`,
+/// or a pointer to a `CnxString`. Must outlive the matcher
+///
+/// @return a `CnxPatternMatcher` over `haystack`
+/// @ingroup cnx_pattern_set
+#define cnx_pattern_matcher_new(set, haystack) \
+	cnx_pattern_matcher_new_cstring(&(set), ___CNX_STRING_SEARCH_NEEDLE(haystack))
+/// @brief Frees the given `CnxPatternMatcher`
+///
+/// @param self - The `CnxPatternMatcher` to free
+/// @ingroup cnx_pattern_set
+#define cnx_pattern_matcher_free(self) cnx_pattern_matcher_free(&(self))
+/// @brief Returns the next match found by the given `CnxPatternMatcher`. See
+/// `cnx_pattern_matcher_next`
+///
+/// @param self - The `CnxPatternMatcher` to get the next match from
+///
+/// @return `Some` next match, or `None` if the end of the input has been reached
+/// @ingroup cnx_pattern_set
+#define cnx_pattern_matcher_next(self) cnx_pattern_matcher_next(&(self))
+/// @brief Returns whether reading the `CnxFile` searched by the given `CnxPatternMatcher` has
+/// failed. Always `Ok` for matchers over strings
+///
+/// @param self - The `CnxPatternMatcher` to get the status of
+///
+/// @return `Ok` if no read has failed, otherwise the error the failing read returned
+/// @ingroup cnx_pattern_set
+#define cnx_pattern_matcher_status(self) cnx_pattern_matcher_status(&(self))
+/// @brief Returns a copy of the given `CnxStringView` with every match of the given
+/// `CnxPatternSet`'s patterns replaced with the corresponding replacement. See
+/// `cnx_stringview_replace_all_with_allocator`
+///
+/// @param self - The `CnxStringView` to replace the patterns in
+/// @param patterns - The `CnxPatternSet` of patterns to replace
+/// @param replacements - The replacement for each pattern, as an array of `CnxStringView`s
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return a copy of `self` with every match replaced
+/// @ingroup cnx_pattern_set
+#define cnx_stringview_replace_all_with_allocator(self, patterns, replacements, allocator) \
+	cnx_stringview_replace_all_with_allocator(&(self), &(patterns), (replacements), (allocator))
+/// @brief Returns a copy of the given `CnxStringView` with every match of the given
+/// `CnxPatternSet`'s patterns replaced with the corresponding replacement. See
+/// `cnx_stringview_replace_all_with_allocator`
+///
+/// @param self - The `CnxStringView` to replace the patterns in
+/// @param patterns - The `CnxPatternSet` of patterns to replace
+/// @param replacements - The replacement for each pattern, as an array of `CnxStringView`s
+///
+/// @return a copy of `self` with every match replaced
+/// @ingroup cnx_pattern_set
+#define cnx_stringview_replace_all(self, patterns, replacements) \
+	cnx_stringview_replace_all_with_allocator(self, patterns, replacements, DEFAULT_ALLOCATOR)
+/// @brief Returns a copy of the given `CnxString` with every match of the given
+/// `CnxPatternSet`'s patterns replaced with the corresponding replacement, using the same
+/// allocator as `self`. See `cnx_stringview_replace_all_with_allocator`
+///
+/// @param self - The `CnxString` to replace the patterns in
+/// @param patterns - The `CnxPatternSet` of patterns to replace
+/// @param replacements - The replacement for each pattern, as an array of `CnxStringView`s
+///
+/// @return a copy of `self` with every match replaced
+/// @ingroup cnx_pattern_set
+#define cnx_string_replace_all(self, patterns, replacements) \
+	cnx_string_replace_all(&(self), &(patterns), (replacements))
+/// @brief Returns a copy of the given `CnxString` with every match of the given
+/// `CnxPatternSet`'s patterns replaced with the corresponding replacement. See
+/// `cnx_stringview_replace_all_with_allocator`
+///
+/// @param self - The `CnxString` to replace the patterns in
+/// @param patterns - The `CnxPatternSet` of patterns to replace
+/// @param replacements - The replacement for each pattern, as an array of `CnxStringView`s
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return a copy of `self` with every match replaced
+/// @ingroup cnx_pattern_set
+#define cnx_string_replace_all_with_allocator(self, patterns, replacements, allocator) \
+	cnx_string_replace_all_with_allocator(&(self), &(patterns), (replacements), (allocator))
+
+#endif // CNX_PATTERN_SET
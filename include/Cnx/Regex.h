@@ -0,0 +1,463 @@
+/// @file Regex.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief CnxRegex provides compiled regular expressions for matching `CnxStringView`s
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef CNX_REGEX
+/// @brief Declarations related to `CnxRegex`
+#define CNX_REGEX
+
+#include <Cnx/Allocators.h>
+#include <Cnx/Def.h>
+#include <Cnx/String.h>
+#include <Cnx/StringSearch.h>
+
+#define RESULT_INCLUDE_DEFAULT_INSTANTIATIONS TRUE
+#include <Cnx/Result.h>
+#undef RESULT_INCLUDE_DEFAULT_INSTANTIATIONS
+
+/// @ingroup cnx_string
+/// @{
+/// @defgroup cnx_regex CnxRegex
+/// `CnxRegex` is a compiled regular expression for finding patterns in `CnxStringView`s in time
+/// linear in the length of the input, regardless of the pattern (there is no backtracking).
+///
+/// A pattern is compiled once (`cnx_regex_new`) into a Thompson NFA. Matching then uses two
+/// engines over that NFA:
+/// - A lazily constructed DFA: DFA states are built from sets of NFA states only as the input
+/// requires them, and are cached so that subsequent searches run at one table lookup per input
+/// byte. The cache has a fixed size (`CNX_REGEX_CACHE_SIZE`); when it fills, it's cleared and
+/// rebuilt as needed. `cnx_regex_is_match` runs entirely on the DFA, and the other searches use it
+/// to reject non-matching input quickly.
+/// - A Pike VM, which simulates the NFA directly, tracking capture positions. This determines the
+/// exact extent of matches and of their capture groups.
+///
+/// If every match must begin with a literal prefix (for example `"ERROR: [0-9]+"`), the
+/// engines skip ahead to occurrences of that prefix using the vectorized substring search from
+/// `<Cnx/StringSearch.h>` whenever they have no partial match in progress.
+///
+/// All memory needed for matching is allocated when the regex is compiled, using the allocator it
+/// was compiled with, so matching never allocates. Because matching updates the DFA cache, a
+/// `CnxRegex` must not be used by multiple threads at the same time.
+///
+/// Matching is byte-oriented: UTF-8 input can be matched, but `.` and classes match single bytes.
+/// Searches report the leftmost match and, when several alternatives match starting at the same
+/// position, prefer them leftmost-first, with the same semantics as RE2 and Go's `regexp`:
+/// alternatives are tried in order, and greedy or lazy repetition prefers more or fewer
+/// iterations. Unlike a backtracking engine such as Perl or PCRE, an iteration of `*`, `+`, or
+/// `{n,}` that would match the empty string doesn't end the loop with a match. It's discarded,
+/// and the next-preferred choice is taken instead. This only affects which submatches are
+/// reported when a repeated group can match empty: for example, `(a??)*` matched against `"a"`
+/// captures `"a"` in group 1, where Perl captures `""`.
+///
+/// # Syntax
+///
+/// - Literals: any byte other than `\.[]()|*+?{}^$`. These can be matched literally by escaping
+/// them with `\`
+/// - `.` - Any byte except `'\n'`
+/// - `[abc]`, `[a-z]`, `[^a-z]` - Byte classes. Classes can contain escapes, including the
+/// class escapes below
+/// - `\d`, `\w`, `\s` - ASCII digits, word characters (`[0-9A-Za-z_]`), and whitespace, and their
+/// negations `\D`, `\W`, and `\S`
+/// - `\n`, `\r`, `\t`, `\f`, `\v`, `\0`, `\xHH` - Control characters and arbitrary bytes
+/// - `^`, `$` - The beginning and end of the input
+/// - `(x)`, `(?:x)` - Capturing and non-capturing groups
+/// - `x|y` - Alternation
+/// - `x*`, `x+`, `x?`, `x{n}`, `x{n,}`, `x{n,m}` - Repetition. Appending `?` makes any of these
+/// lazy (e.g. `x*?`)
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/Regex.h>
+///
+/// void example(CnxStringView line) {
+/// 	let_mut maybe_regex = cnx_regex_new("status=([0-9]+) took=([0-9]+)ms");
+/// 	if(cnx_result_is_err(maybe_regex)) {
+/// 		return;
+/// 	}
+/// 	CnxScopedRegex regex = cnx_result_unwrap(maybe_regex);
+///
+/// 	CnxOption(CnxStringView) captures[3];
+/// 	if(cnx_regex_captures(regex, line, captures, 3)) {
+/// 		let status = cnx_option_unwrap(captures[1]);
+/// 		let duration = cnx_option_unwrap(captures[2]);
+/// 		// ...
+/// 	}
+/// }
+/// @endcode
+/// @}
+
+/// @brief The size, in bytes, of the lazy DFA cache of a `CnxRegex`
+/// @ingroup cnx_regex
+#define CNX_REGEX_CACHE_SIZE (128U * 1024U)
+
+/// @brief The maximum number of instructions in a compiled `CnxRegex`. Patterns compiling to more
+/// instructions than this (typically due to large counted repetitions) are rejected with
+/// `CNX_REGEX_TOO_LARGE`
+/// @ingroup cnx_regex
+#define CNX_REGEX_MAX_PROGRAM_LENGTH 16384U
+
+/// @brief Specifies the possible errors that can occur when compiling a `CnxRegex`
+/// @ingroup cnx_regex
+typedef enum CnxRegexErrorTypes {
+	/// @brief No error, the pattern is valid
+	/// @ingroup cnx_regex
+	CNX_REGEX_SUCCESS = 0,
+	/// @brief A group was opened and never closed, or closed without being opened
+	/// @ingroup cnx_regex
+	CNX_REGEX_UNMATCHED_PARENTHESIS,
+	/// @brief A byte class was opened and never closed
+	/// @ingroup cnx_regex
+	CNX_REGEX_UNCLOSED_CLASS,
+	/// @brief A range in a byte class ends before it begins (e.g. `[z-a]`)
+	/// @ingroup cnx_regex
+	CNX_REGEX_INVALID_RANGE,
+	/// @brief An unsupported escape sequence, or a trailing `\`
+	/// @ingroup cnx_regex
+	CNX_REGEX_INVALID_ESCAPE,
+	/// @brief A repetition operator with nothing before it to repeat
+	/// @ingroup cnx_regex
+	CNX_REGEX_NOTHING_TO_REPEAT,
+	/// @brief A counted repetition whose minimum is greater than its maximum
+	/// @ingroup cnx_regex
+	CNX_REGEX_INVALID_REPETITION,
+	/// @brief The pattern is too large, too deeply nested, or has too many capture groups to
+	/// compile
+	/// @ingroup cnx_regex
+	CNX_REGEX_TOO_LARGE,
+} CnxRegexErrorTypes;
+
+/// @brief A single instruction of a compiled `CnxRegex`
+/// @ingroup cnx_regex
+typedef struct CnxRegexInstruction {
+	/// @brief What the instruction does
+	u32 m_opcode;
+	/// @brief The instruction to continue at
+	u32 m_next;
+	/// @brief The byte set, capture slot, or alternative instruction, depending on `m_opcode`
+	u32 m_argument;
+} CnxRegexInstruction;
+
+/// @brief A set of bytes matched by a `CnxRegexInstruction`
+/// @ingroup cnx_regex
+typedef struct CnxRegexByteSet {
+	/// @brief Bitmap of the bytes in the set
+	u64 m_bits[4]; // NOLINT
+} CnxRegexByteSet;
+
+/// @brief A sparse set of instructions, with the capture slots of each, used for the states of
+/// both matching engines
+/// @ingroup cnx_regex
+typedef struct CnxRegexThreadList {
+	/// @brief The instructions in the set, in insertion order
+	u32* m_dense;
+	/// @brief The index of each instruction in `m_dense`, if it's in the set
+	u32* m_sparse;
+	/// @brief The number of instructions in the set
+	usize m_size;
+	/// @brief The capture slots of each instruction
+	usize* m_slots;
+} CnxRegexThreadList;
+
+/// @brief An entry in the explicit stack used to follow empty transitions
+/// @ingroup cnx_regex
+typedef struct CnxRegexFrame {
+	/// @brief Whether this frame restores a capture slot, rather than visiting an instruction
+	bool m_restore;
+	/// @brief The instruction to visit, or the slot to restore
+	u32 m_index;
+	/// @brief The value to restore the slot to
+	usize m_value;
+} CnxRegexFrame;
+
+/// @brief The lazy DFA cache and matching scratch space of a `CnxRegex`
+/// @ingroup cnx_regex
+typedef struct CnxRegexCache {
+	/// @brief The transition table: `m_num_classes` next states for each state, or `0` for
+	/// transitions that haven't been computed yet. State `0` is unused
+	u32* m_transitions;
+	/// @brief The offset of each state's instruction set in `m_pool`
+	u32* m_offsets;
+	/// @brief The size of each state's instruction set
+	u32* m_lengths;
+	/// @brief Properties of each state
+	u8* m_flags;
+	/// @brief Storage for the instruction sets of the states
+	u32* m_pool;
+	/// @brief Open-addressed hash table of states, by instruction set
+	u32* m_table;
+	/// @brief Scratch space for the instruction set of a new state
+	u32* m_set;
+	/// @brief The states matching starts in at the beginning of the input (`[0]`) and elsewhere
+	/// (`[1]`)
+	u32 m_start_states[2]; // NOLINT
+	/// @brief The number of states
+	usize m_num_states;
+	/// @brief The maximum number of states
+	usize m_max_states;
+	/// @brief The number of entries of `m_pool` in use
+	usize m_pool_used;
+	/// @brief The size of `m_pool`
+	usize m_pool_capacity;
+	/// @brief The size of `m_table`. Always a power of two
+	usize m_table_capacity;
+	/// @brief The number of times the cache has been cleared during the current search
+	usize m_num_clears;
+	/// @brief The current and next thread lists
+	CnxRegexThreadList m_lists[2];
+	/// @brief Stack for following empty transitions
+	CnxRegexFrame* m_stack;
+	/// @brief Capture slots of the thread being followed
+	usize* m_scratch_slots;
+} CnxRegexCache;
+
+/// @brief `CnxRegex` is a compiled regular expression
+/// @ingroup cnx_regex
+typedef struct CnxRegex {
+	/// @brief The compiled program
+	CnxRegexInstruction* m_program;
+	/// @brief The number of instructions in `m_program`
+	usize m_program_length;
+	/// @brief The instruction matching starts at
+	u32 m_start;
+	/// @brief The byte sets used by `m_program`
+	CnxRegexByteSet* m_sets;
+	/// @brief The number of capture groups, including the implicit group of the whole match
+	usize m_num_groups;
+	/// @brief The equivalence class of each byte value. Bytes in the same class are matched
+	/// identically by every instruction
+	u8 m_classes[256]; // NOLINT
+	/// @brief A byte in each equivalence class
+	u8 m_class_representatives[256]; // NOLINT
+	/// @brief The number of equivalence classes
+	usize m_num_classes;
+	/// @brief The literal every match begins with, if any
+	char* m_prefix;
+	/// @brief The length of `m_prefix`
+	usize m_prefix_length;
+	/// @brief The DFA cache and matching scratch space
+	CnxRegexCache m_cache;
+	/// @brief The allocator used for the regex's memory
+	CnxAllocator m_allocator;
+} CnxRegex;
+
+#define RESULT_T	CnxRegex
+#define RESULT_DECL TRUE
+// NOLINTNEXTLINE(readability-duplicate-include)
+#include <Cnx/Result.h>
+#undef RESULT_T
+#undef RESULT_DECL
+
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxRegex operation on a nullptr")
+
+/// @brief Compiles the given pattern into a new `CnxRegex`, using the given allocator
+///
+/// @param pattern - The pattern to compile
+/// @param length - The length of `pattern`
+/// @param allocator - The `CnxAllocator` to allocate memory with
+///
+/// @return `Ok` containing the compiled `CnxRegex`, or an `Err` containing the
+/// `CnxRegexErrorTypes` value describing why the pattern is invalid
+/// @ingroup cnx_regex
+__attr(nodiscard) __attr(not_null(1)) CnxResult(CnxRegex)
+	cnx_regex_new_cstring_with_allocator(restrict const_cstring pattern,
+										 usize length,
+										 CnxAllocator allocator)
+		cnx_disable_if(!pattern, "Can't compile a nullptr pattern");
+/// @brief Frees the given `CnxRegex`
+///
+/// @param self - The `CnxRegex` to free
+/// @ingroup cnx_regex
+__attr(not_null(1)) void cnx_regex_free(void* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief declare a `CnxRegex` variable with this attribute to have `cnx_regex_free`
+/// automatically called on it when it goes out of scope
+/// @ingroup cnx_regex
+#define CnxScopedRegex scoped(cnx_regex_free)
+/// @brief Returns the number of capture groups in the given `CnxRegex`, including the implicit
+/// group `0` of the whole match
+///
+/// @param self - The `CnxRegex` to get the number of groups of
+///
+/// @return the number of capture groups in `self`
+/// @ingroup cnx_regex
+__attr(nodiscard) __attr(not_null(1)) usize cnx_regex_group_count(const CnxRegex* restrict self)
+	___DISABLE_IF_NULL(self);
+/// @brief Returns whether the given `CnxRegex` matches anywhere in the given `CnxStringView`
+///
+/// @param self - The `CnxRegex` to match with
+/// @param haystack - The `CnxStringView` to search in
+///
+/// @return whether `self` matches in `haystack`
+/// @ingroup cnx_regex
+__attr(nodiscard) __attr(not_null(1, 2)) bool
+	cnx_regex_is_match(CnxRegex* restrict self, const CnxStringView* restrict haystack)
+		___DISABLE_IF_NULL(self);
+/// @brief Returns whether the given `CnxRegex` matches the entirety of the given `CnxStringView`
+///
+/// @param self - The `CnxRegex` to match with
+/// @param haystack - The `CnxStringView` to match
+///
+/// @return whether `self` matches all of `haystack`
+/// @ingroup cnx_regex
+__attr(nodiscard) __attr(not_null(1, 2)) bool
+	cnx_regex_is_full_match(CnxRegex* restrict self, const CnxStringView* restrict haystack)
+		___DISABLE_IF_NULL(self);
+/// @brief Finds the first match of the given `CnxRegex` in the given `CnxStringView`, starting
+/// the search at `start`.
+///
+/// Anchors still refer to the whole of `haystack`, so `^` never matches when `start` is greater
+/// than `0`. Searching again from the end of each match finds every match in turn.
+///
+/// @param self - The `CnxRegex` to match with
+/// @param haystack - The `CnxStringView` to search in
+/// @param start - The index in `haystack` to start searching at
+///
+/// @return `Some` view of the match in `haystack`, or `None` if there is no match
+/// @ingroup cnx_regex
+__attr(nodiscard) __attr(not_null(1, 2)) CnxOption(CnxStringView)
+	cnx_regex_find_at(CnxRegex* restrict self,
+					  const CnxStringView* restrict haystack,
+					  usize start) ___DISABLE_IF_NULL(self);
+/// @brief Finds the first match of the given `CnxRegex` in the given `CnxStringView`, starting
+/// the search at `start`, and the text matched by each of its capture groups.
+///
+/// On a match, `captures[i]` is set to `Some` view of the text matched by group `i` (group `0`
+/// being the whole match), or `None` if group `i` didn't participate in the match, for the first
+/// `num_captures` groups.
+///
+/// @param self - The `CnxRegex` to match with
+/// @param haystack - The `CnxStringView` to search in
+/// @param start - The index in `haystack` to start searching at
+/// @param captures - The array to write the captures to
+/// @param num_captures - The size of `captures`
+///
+/// @return whether a match was found
+/// @ingroup cnx_regex
+__attr(nodiscard) __attr(not_null(1, 2, 4)) bool
+	cnx_regex_captures_at(CnxRegex* restrict self,
+						  const CnxStringView* restrict haystack,
+						  usize start,
+						  CnxOption(CnxStringView) * restrict captures,
+						  usize num_captures) ___DISABLE_IF_NULL(self);
+
+#undef ___DISABLE_IF_NULL
+
+/// @brief Compiles the given pattern into a new `CnxRegex`
+///
+/// @param pattern - The pattern to compile. Can be a `cstring`, a pointer to a `CnxStringView`,
+/// or a pointer to a `CnxString`
+///
+/// @return `Ok` containing the compiled `CnxRegex`, or an `Err` containing the
+/// `CnxRegexErrorTypes` value describing why the pattern is invalid
+/// @ingroup cnx_regex
+#define cnx_regex_new(pattern) cnx_regex_new_with_allocator(pattern, DEFAULT_ALLOCATOR)
+/// @brief Compiles the given pattern into a new `CnxRegex`, using the given allocator
+///
+/// @param pattern - The pattern to compile. Can be a `cstring`, a pointer to a `CnxStringView`,
+/// or a pointer to a `CnxString`
+/// @param allocator - The `CnxAllocator` to allocate memory with
+///
+/// @return `Ok` containing the compiled `CnxRegex`, or an `Err` containing the
+/// `CnxRegexErrorTypes` value describing why the pattern is invalid
+/// @ingroup cnx_regex
+#define cnx_regex_new_with_allocator(pattern, allocator) \
+	cnx_regex_new_cstring_with_allocator(___CNX_STRING_SEARCH_NEEDLE(pattern), (allocator))
+/// @brief Frees the given `CnxRegex`
+///
+/// @param self - The `CnxRegex` to free
+/// @ingroup cnx_regex
+#define cnx_regex_free(self) cnx_regex_free(&(self))
+/// @brief Returns the number of capture groups in the given `CnxRegex`, including the implicit
+/// group `0` of the whole match
+///
+/// @param self - The `CnxRegex` to get the number of groups of
+///
+/// @return the number of capture groups in `self`
+/// @ingroup cnx_regex
+#define cnx_regex_group_count(self) cnx_regex_group_count(&(self))
+/// @brief Returns whether the given `CnxRegex` matches anywhere in the given `CnxStringView`
+///
+/// @param self - The `CnxRegex` to match with
+/// @param haystack - The `CnxStringView` to search in
+///
+/// @return whether `self` matches in `haystack`
+/// @ingroup cnx_regex
+#define cnx_regex_is_match(self, haystack) cnx_regex_is_match(&(self), &(haystack))
+/// @brief Returns whether the given `CnxRegex` matches the entirety of the given `CnxStringView`
+///
+/// @param self - The `CnxRegex` to match with
+/// @param haystack - The `CnxStringView` to match
+///
+/// @return whether `self` matches all of `haystack`
+/// @ingroup cnx_regex
+#define cnx_regex_is_full_match(self, haystack) cnx_regex_is_full_match(&(self), &(haystack))
+/// @brief Finds the first match of the given `CnxRegex` in the given `CnxStringView`, starting
+/// the search at `start`. See `cnx_regex_find_at`
+///
+/// @param self - The `CnxRegex` to match with
+/// @param haystack - The `CnxStringView` to search in
+/// @param start - The index in `haystack` to start searching at
+///
+/// @return `Some` view of the match in `haystack`, or `None` if there is no match
+/// @ingroup cnx_regex
+#define cnx_regex_find_at(self, haystack, start) cnx_regex_find_at(&(self), &(haystack), (start))
+/// @brief Finds the first match of the given `CnxRegex` in the given `CnxStringView`
+///
+/// @param self - The `CnxRegex` to match with
+/// @param haystack - The `CnxStringView` to search in
+///
+/// @return `Some` view of the match in `haystack`, or `None` if there is no match
+/// @ingroup cnx_regex
+#define cnx_regex_find(self, haystack) cnx_regex_find_at(self, haystack, 0)
+/// @brief Finds the first match of the given `CnxRegex` in the given `CnxStringView`, starting
+/// the search at `start`, and the text matched by each of its capture groups. See
+/// `cnx_regex_captures_at`
+///
+/// @param self - The `CnxRegex` to match with
+/// @param haystack - The `CnxStringView` to search in
+/// @param start - The index in `haystack` to start searching at
+/// @param captures - The array of `CnxOption(CnxStringView)` to write the captures to
+/// @param num_captures - The size of `captures`
+///
+/// @return whether a match was found
+/// @ingroup cnx_regex
+#define cnx_regex_captures_at(self, haystack, start, captures, num_captures) \
+	cnx_regex_captures_at(&(self), &(haystack), (start), (captures), (num_captures))
+/// @brief Finds the first match of the given `CnxRegex` in the given `CnxStringView`, and the
+/// text matched by each of its capture groups. See `cnx_regex_captures_at`
+///
+/// @param self - The `CnxRegex` to match with
+/// @param haystack - The `CnxStringView` to search in
+/// @param captures - The array of `CnxOption(CnxStringView)` to write the captures to
+/// @param num_captures - The size of `captures`
+///
+/// @return whether a match was found
+/// @ingroup cnx_regex
+#define cnx_regex_captures(self, haystack, captures, num_captures) \
+	cnx_regex_captures_at(self, haystack, 0, captures, num_captures)
+
+#endif // CNX_REGEX
@@ -0,0 +1,448 @@
+/// @file SharedString.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides an immutable, reference-counted string type for Cnx
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef CNX_SHARED_STRING
+/// @brief Declarations related to `CnxSharedString`
+#define CNX_SHARED_STRING
+
+#include <Cnx/Allocators.h>
+#include <Cnx/Assert.h>
+#include <Cnx/Atomic.h>
+#include <Cnx/Def.h>
+#include <Cnx/String.h>
+
+/// @ingroup cnx_string
+/// @{
+/// @defgroup cnx_shared_string CnxSharedString
+/// `CnxSharedString` is an immutable, atomically reference-counted string type, for string data
+/// that is shared between many owners or threads (URLs, message payloads, configuration values,
+/// etc.), where `cnx_string_clone`'s allocation and copy on every clone would be wasteful.
+///
+/// A `CnxSharedString` stores its reference count, allocator, and characters together in a
+/// single allocation, so creating one allocates exactly once, and cloning one is O(1): it only
+/// increments the reference count. The characters are freed when the last `CnxSharedString`
+/// referring to them is freed. Because the contents are never modified after creation, clones
+/// can be freely passed to, read from, and freed on other threads without any further
+/// synchronization.
+///
+/// `cnx_shared_string_substring` creates a `CnxSharedString` for a range of another's
+/// characters in O(1), without copying, by sharing (and keeping alive) the original allocation.
+/// Because of this, a `CnxSharedString` is not necessarily null-terminated; use
+/// `cnx_shared_string_into_stringview` to access its contents with the `CnxStringView` API
+/// (searching, splitting, iteration with `foreach`, formatting, etc.), or
+/// `cnx_shared_string_into_string` to copy them into a (mutable) `CnxString`.
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/SharedString.h>
+///
+/// void example(void) {
+/// 	CnxScopedSharedString url = cnx_shared_string_from("https://example.com/index.html");
+/// 	// no allocation or copy, `url` and `copy` share the same characters
+/// 	CnxScopedSharedString copy = cnx_shared_string_clone(url);
+/// 	// still no allocation or copy, `host` keeps `url`'s characters alive
+/// 	CnxScopedSharedString host = cnx_shared_string_substring(url, 8, 11);
+///
+/// 	let view = cnx_shared_string_into_stringview(host);
+/// 	// prints "example.com"
+/// 	println("{}", view);
+/// }
+/// @endcode
+/// @}
+
+/// @brief The shared allocation backing a `CnxSharedString`
+/// @ingroup cnx_shared_string
+typedef struct CnxSharedStringStorage {
+	/// @brief The number of `CnxSharedString`s referring to this storage
+	atomic_usize m_ref_count;
+	/// @brief The allocator this storage was allocated with
+	CnxAllocator m_allocator;
+	/// @brief The number of characters in `m_data`, excluding the null terminator
+	usize m_length;
+	/// @brief The null-terminated characters
+	char m_data[];
+} CnxSharedStringStorage;
+
+/// @brief `CnxSharedString` is an immutable, reference-counted string type with O(1) cloning
+/// and substrings
+/// @ingroup cnx_shared_string
+typedef struct CnxSharedString {
+	/// @brief The storage shared by this string, or `nullptr` if this string is empty
+	CnxSharedStringStorage* m_storage;
+	/// @brief The first character of this string, within `m_storage`
+	const_cstring m_data;
+	/// @brief The number of characters in this string
+	usize m_length;
+} CnxSharedString;
+
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxSharedString operation on a nullptr")
+
+/// @brief Creates a new, empty `CnxSharedString`. This does not allocate
+///
+/// @return an empty `CnxSharedString`
+/// @ingroup cnx_shared_string
+__attr(nodiscard) CnxSharedString cnx_shared_string_new(void);
+/// @brief Creates a new `CnxSharedString` from the given character data, allocating its storage
+/// with the given allocator
+///
+/// @param string - The characters to copy into the string
+/// @param length - The number of characters to copy
+/// @param allocator - The allocator to allocate the string's storage with
+///
+/// @return a `CnxSharedString` containing a copy of `string`
+/// @ingroup cnx_shared_string
+__attr(nodiscard) __attr(not_null(1)) CnxSharedString
+	cnx_shared_string_from_cstring_with_allocator(restrict const_cstring string,
+												  usize length,
+												  CnxAllocator allocator)
+		cnx_disable_if(!string, "Can't create a CnxSharedString from a nullptr");
+/// @brief Creates a new `CnxSharedString` from the given character data
+///
+/// @param string - The characters to copy into the string
+/// @param length - The number of characters to copy
+///
+/// @return a `CnxSharedString` containing a copy of `string`
+/// @ingroup cnx_shared_string
+__attr(nodiscard) __attr(not_null(1)) CnxSharedString
+	cnx_shared_string_from_cstring(restrict const_cstring string, usize length)
+		cnx_disable_if(!string, "Can't create a CnxSharedString from a nullptr");
+/// @brief Creates a new `CnxSharedString` containing a copy of the given `CnxString`, allocating
+/// its storage with the `CnxString`'s allocator
+///
+/// @param string - The `CnxString` to copy
+///
+/// @return a `CnxSharedString` containing a copy of `string`
+/// @ingroup cnx_shared_string
+__attr(nodiscard) __attr(not_null(1)) CnxSharedString
+	cnx_shared_string_from_string(const CnxString* restrict string)
+		cnx_disable_if(!string, "Can't create a CnxSharedString from a nullptr");
+/// @brief Creates a new reference to the given `CnxSharedString`'s characters. This is O(1),
+/// and does not allocate or copy
+///
+/// @param self - The `CnxSharedString` to clone
+///
+/// @return a `CnxSharedString` sharing the contents of `self`
+/// @ingroup cnx_shared_string
+__attr(nodiscard) __attr(not_null(1)) CnxSharedString
+	cnx_shared_string_clone(const CnxSharedString* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Releases the given `CnxSharedString`'s reference to its characters, leaving it empty.
+/// The characters are freed when the last reference to them is released
+///
+/// @param self - The `CnxSharedString` to free
+/// @ingroup cnx_shared_string
+__attr(not_null(1)) void cnx_shared_string_free(void* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief declare a `CnxSharedString` variable with this attribute to have
+/// `cnx_shared_string_free` automatically called on it when it goes out of scope
+/// @ingroup cnx_shared_string
+#define CnxScopedSharedString scoped(cnx_shared_string_free)
+
+/// @brief Returns the length of the given `CnxSharedString`
+///
+/// @param self - The `CnxSharedString` to get the length of
+///
+/// @return the length of `self`
+/// @ingroup cnx_shared_string
+__attr(nodiscard) __attr(not_null(1)) static inline usize
+	cnx_shared_string_length(const CnxSharedString* restrict self) ___DISABLE_IF_NULL(self) {
+	return self->m_length;
+}
+/// @brief Returns whether the given `CnxSharedString` is empty
+///
+/// @param self - The `CnxSharedString` to check
+///
+/// @return whether `self` is empty
+/// @ingroup cnx_shared_string
+__attr(nodiscard) __attr(not_null(1)) static inline bool
+	cnx_shared_string_is_empty(const CnxSharedString* restrict self) ___DISABLE_IF_NULL(self) {
+	return self->m_length == 0;
+}
+/// @brief Returns a pointer to the characters of the given `CnxSharedString`. These are only
+/// null-terminated if `self` is not a substring ending before the end of its storage
+///
+/// @param self - The `CnxSharedString` to get the characters of
+///
+/// @return the characters of `self`
+/// @ingroup cnx_shared_string
+__attr(nodiscard) __attr(not_null(1)) __attr(returns_not_null) static inline const_cstring
+	cnx_shared_string_data(const CnxSharedString* restrict self) ___DISABLE_IF_NULL(self) {
+	return self->m_data;
+}
+/// @brief Returns the number of `CnxSharedString`s (including substrings) sharing the given
+/// `CnxSharedString`'s characters. This is `0` for an empty string that doesn't share any
+/// storage.
+///
+/// The result is only a snapshot, and may already be out of date if other threads hold
+/// references to the same storage.
+///
+/// @param self - The `CnxSharedString` to get the reference count of
+///
+/// @return the number of references to `self`'s characters
+/// @ingroup cnx_shared_string
+__attr(nodiscard) __attr(not_null(1)) usize
+	cnx_shared_string_ref_count(const CnxSharedString* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Returns the character at the given index in the given `CnxSharedString`
+///
+/// @param self - The `CnxSharedString` to get the character from
+/// @param index - The index of the character
+///
+/// @return the character at `index`
+/// @ingroup cnx_shared_string
+__attr(nodiscard) __attr(not_null(1)) const_cstring
+	cnx_shared_string_at(const CnxSharedString* restrict self, usize index)
+		___DISABLE_IF_NULL(self);
+/// @brief Creates a `CnxSharedString` of the `length` characters of the given `CnxSharedString`
+/// starting at `index`. This is O(1), and does not allocate or copy: the substring shares (and
+/// keeps alive) `self`'s characters
+///
+/// @param self - The `CnxSharedString` to get a substring of
+/// @param index - The index of the first character of the substring
+/// @param length - The length of the substring
+///
+/// @return a `CnxSharedString` of the given range of `self`
+/// @ingroup cnx_shared_string
+__attr(nodiscard) __attr(not_null(1)) CnxSharedString
+	cnx_shared_string_substring(const CnxSharedString* restrict self, usize index, usize length)
+		___DISABLE_IF_NULL(self);
+/// @brief Returns a `CnxStringView` of the given `CnxSharedString`. The view is only valid for
+/// as long as `self` (or another reference to its characters) is alive
+///
+/// @param self - The `CnxSharedString` to view
+///
+/// @return a view of `self`
+/// @ingroup cnx_shared_string
+__attr(nodiscard) __attr(not_null(1)) CnxStringView
+	cnx_shared_string_into_stringview(const CnxSharedString* restrict self)
+		___DISABLE_IF_NULL(self);
+/// @brief Creates a `CnxString` containing a copy of the given `CnxSharedString`, using the
+/// allocator `self`'s storage was allocated with
+///
+/// @param self - The `CnxSharedString` to copy
+///
+/// @return a `CnxString` copy of `self`
+/// @ingroup cnx_shared_string
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_shared_string_into_string(const CnxSharedString* restrict self)
+		___DISABLE_IF_NULL(self);
+/// @brief Returns whether the contents of the given `CnxSharedString` are equal to the given
+/// characters
+///
+/// @param self - The `CnxSharedString` to compare
+/// @param string - The characters to compare to
+/// @param length - The number of characters to compare to
+///
+/// @return whether `self` is equal to `string`
+/// @ingroup cnx_shared_string
+__attr(nodiscard) __attr(not_null(1, 2)) bool
+	cnx_shared_string_equal_cstring(const CnxSharedString* restrict self,
+									restrict const_cstring string,
+									usize length) ___DISABLE_IF_NULL(self)
+		cnx_disable_if(!string, "Can't compare a CnxSharedString to a nullptr");
+/// @brief Lexicographically compares the given `CnxSharedString` to the given characters
+///
+/// @param self - The `CnxSharedString` to compare
+/// @param string - The characters to compare to
+/// @param length - The number of characters to compare to
+///
+/// @return a negative value if `self` orders before `string`, `0` if they are equal, or a
+/// positive value if `self` orders after `string`
+/// @ingroup cnx_shared_string
+__attr(nodiscard) __attr(not_null(1, 2)) i32
+	cnx_shared_string_compare_cstring(const CnxSharedString* restrict self,
+									  restrict const_cstring string,
+									  usize length) ___DISABLE_IF_NULL(self)
+		cnx_disable_if(!string, "Can't compare a CnxSharedString to a nullptr");
+
+#undef ___DISABLE_IF_NULL
+
+// clang-format off
+
+/// @brief Expands the given string-like value to the pointer-and-length argument pair expected by
+/// the `cnx_shared_string_*_cstring` functions
+#define ___CNX_SHARED_STRING_ARG(string) 													   \
+	_Generic((string),                                                                      \
+		const_cstring 				: static_cast(const_cstring)(string),                  \
+		cstring 					: static_cast(const_cstring)(string),                  \
+		CnxStringView* 				: (static_cast(const CnxStringView*)(string))->m_view, \
+		const CnxStringView* 		: (static_cast(const CnxStringView*)(string))->m_view, \
+		CnxString* 					: (cnx_string_into_cstring)(                           \
+										static_cast(const CnxString*)(string)),            \
+		const CnxString* 			: (cnx_string_into_cstring)(                           \
+										static_cast(const CnxString*)(string)),            \
+		CnxSharedString* 			: (static_cast(const CnxSharedString*)(string))->m_data, \
+		const CnxSharedString* 		: (static_cast(const CnxSharedString*)(string))->m_data), \
+	_Generic((string),                                                                      \
+		const_cstring 				: strlen(static_cast(const_cstring)(string)),          \
+		cstring 					: strlen(static_cast(const_cstring)(string)),          \
+		CnxStringView* 				: (static_cast(const CnxStringView*)(string))->m_length, \
+		const CnxStringView* 		: (static_cast(const CnxStringView*)(string))->m_length, \
+		CnxString* 					: (cnx_string_length)(                                 \
+										static_cast(const CnxString*)(string)),            \
+		const CnxString* 			: (cnx_string_length)(                                 \
+										static_cast(const CnxString*)(string)),            \
+		CnxSharedString* 			: (static_cast(const CnxSharedString*)(string))->m_length, \
+		const CnxSharedString* 		: (static_cast(const CnxSharedString*)(string))->m_length)
+
+// clang-format on
+
+/// @brief Creates a new `CnxSharedString` from the given string-like value
+///
+/// @param string - The string to copy. Can be a `cstring`, or a pointer to a `CnxStringView`,
+/// `CnxString`, or `CnxSharedString`
+///
+/// @return a `CnxSharedString` containing a copy of `string`
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_from(string) \
+	cnx_shared_string_from_cstring(___CNX_SHARED_STRING_ARG(string))
+/// @brief Creates a new `CnxSharedString` from the given string-like value, allocating its
+/// storage with the given allocator
+///
+/// @param string - The string to copy. Can be a `cstring`, or a pointer to a `CnxStringView`,
+/// `CnxString`, or `CnxSharedString`
+/// @param allocator - The allocator to allocate the string's storage with
+///
+/// @return a `CnxSharedString` containing a copy of `string`
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_from_with_allocator(string, allocator) \
+	cnx_shared_string_from_cstring_with_allocator(___CNX_SHARED_STRING_ARG(string), allocator)
+/// @brief Creates a new `CnxSharedString` containing a copy of the given `CnxString`, allocating
+/// its storage with the `CnxString`'s allocator
+///
+/// @param string - The `CnxString` to copy
+///
+/// @return a `CnxSharedString` containing a copy of `string`
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_from_string(string) cnx_shared_string_from_string(&(string))
+/// @brief Creates a new reference to the given `CnxSharedString`'s characters. This is O(1),
+/// and does not allocate or copy
+///
+/// @param self - The `CnxSharedString` to clone
+///
+/// @return a `CnxSharedString` sharing the contents of `self`
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_clone(self) cnx_shared_string_clone(&(self))
+/// @brief Releases the given `CnxSharedString`'s reference to its characters, leaving it empty.
+/// The characters are freed when the last reference to them is released
+///
+/// @param self - The `CnxSharedString` to free
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_free(self) cnx_shared_string_free(&(self))
+/// @brief Returns the length of the given `CnxSharedString`
+///
+/// @param self - The `CnxSharedString` to get the length of
+///
+/// @return the length of `self`
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_length(self) cnx_shared_string_length(&(self))
+/// @brief Returns the length of the given `CnxSharedString`
+///
+/// @param self - The `CnxSharedString` to get the length of
+///
+/// @return the length of `self`
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_size(self) cnx_shared_string_length(self)
+/// @brief Returns whether the given `CnxSharedString` is empty
+///
+/// @param self - The `CnxSharedString` to check
+///
+/// @return whether `self` is empty
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_is_empty(self) cnx_shared_string_is_empty(&(self))
+/// @brief Returns a pointer to the characters of the given `CnxSharedString`. These are only
+/// null-terminated if `self` is not a substring ending before the end of its storage
+///
+/// @param self - The `CnxSharedString` to get the characters of
+///
+/// @return the characters of `self`
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_data(self) cnx_shared_string_data(&(self))
+/// @brief Returns the number of `CnxSharedString`s (including substrings) sharing the given
+/// `CnxSharedString`'s characters
+///
+/// @param self - The `CnxSharedString` to get the reference count of
+///
+/// @return the number of references to `self`'s characters
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_ref_count(self) cnx_shared_string_ref_count(&(self))
+/// @brief Returns the character at the given index in the given `CnxSharedString`
+///
+/// @param self - The `CnxSharedString` to get the character from
+/// @param index - The index of the character
+///
+/// @return the character at `index`
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_at(self, index) (*cnx_shared_string_at(&(self), (index)))
+/// @brief Creates a `CnxSharedString` of the `length` characters of the given `CnxSharedString`
+/// starting at `index`. This is O(1), and does not allocate or copy
+///
+/// @param self - The `CnxSharedString` to get a substring of
+/// @param index - The index of the first character of the substring
+/// @param length - The length of the substring
+///
+/// @return a `CnxSharedString` of the given range of `self`
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_substring(self, index, length) \
+	cnx_shared_string_substring(&(self), (index), (length))
+/// @brief Returns a `CnxStringView` of the given `CnxSharedString`
+///
+/// @param self - The `CnxSharedString` to view
+///
+/// @return a view of `self`
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_into_stringview(self) cnx_shared_string_into_stringview(&(self))
+/// @brief Creates a `CnxString` containing a copy of the given `CnxSharedString`
+///
+/// @param self - The `CnxSharedString` to copy
+///
+/// @return a `CnxString` copy of `self`
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_into_string(self) cnx_shared_string_into_string(&(self))
+/// @brief Returns whether the contents of the given `CnxSharedString` are equal to the given
+/// string-like value
+///
+/// @param self - The `CnxSharedString` to compare
+/// @param string - The string to compare to. Can be a `cstring`, or a pointer to a
+/// `CnxStringView`, `CnxString`, or `CnxSharedString`
+///
+/// @return whether `self` is equal to `string`
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_equal(self, string) \
+	cnx_shared_string_equal_cstring(&(self), ___CNX_SHARED_STRING_ARG(string))
+/// @brief Lexicographically compares the given `CnxSharedString` to the given string-like value
+///
+/// @param self - The `CnxSharedString` to compare
+/// @param string - The string to compare to. Can be a `cstring`, or a pointer to a
+/// `CnxStringView`, `CnxString`, or `CnxSharedString`
+///
+/// @return a negative value if `self` orders before `string`, `0` if they are equal, or a
+/// positive value if `self` orders after `string`
+/// @ingroup cnx_shared_string
+#define cnx_shared_string_compare(self, string) \
+	cnx_shared_string_compare_cstring(&(self), ___CNX_SHARED_STRING_ARG(string))
+
+#endif // CNX_SHARED_STRING
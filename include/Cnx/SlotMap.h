@@ -0,0 +1,171 @@
+/// @file SlotMap.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides a generational slot map with stable handles, comparable to
+/// Rust's `slotmap` crate, for Cnx
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// @ingroup collections
+/// @{
+/// @defgroup cnx_slot_map CnxSlotMap
+/// `CnxSlotMap(T)` is a struct template for a type-safe container that hands out stable,
+/// generational handles (`CnxSlotMapHandle`) to the elements inserted into it. Insertion,
+/// removal, and lookup by handle are all O(1), and a handle whose element has been removed is
+/// reliably detected as stale, even after its slot has been reused. `CnxSlotMap(T)` is
+/// allocator aware, provides Cnx compatible forward iterators (and so works with `foreach` and
+/// `CnxRange`), and supports user-defined default constructors, copy-constructors, and
+/// destructors for its elements.
+///
+/// This makes `CnxSlotMap(T)` ideal for object registries and similar situations where indices
+/// into a `CnxVector(T)` would be handed out, but elements also need to be removed from the
+/// middle: removing from a `CnxVector(T)` shifts every following element (invalidating their
+/// indices), while removing from a `CnxSlotMap(T)` never invalidates any other handle.
+///
+/// Internally, elements are kept densely packed in a contiguous array, so iterating over a
+/// `CnxSlotMap(T)` is as fast as iterating over a `CnxVector(T)`. Handles refer to entries in a
+/// separate slot table, each of which records the position of its element in the dense storage
+/// and a generation counter. Removal moves the last element into the removed one's position and
+/// pushes the freed slot onto a free-list for reuse, advancing its generation so that
+/// outstanding handles to the removed element no longer match. Because of this, the order of
+/// elements in the dense storage is unspecified.
+///
+/// # Instantiation requirements:
+///
+/// 1. a `typedef` of your type to provide an alphanumeric name for it (for template and macro
+/// 	parameters)
+/// 2. a `typedef` for pointer to your type as `Ref(YourType)`, for use with the iterators.
+/// 3. a `typedef` for pointer to const your type as `ConstRef(YourType)`, for use with the
+/// 	iterators
+/// 4. Instantiations for Cnx iterators for the typedefs provided in (2) and (3)
+///
+/// # Parameters
+///
+/// `CnxSlotMap(T)` takes an instantiation-time type parameter, in addition to the
+/// instantiation-mode macro parameters required of all Cnx templates.
+///
+/// ## Instantiation-Mode Parameters
+///
+/// These signal to the implementation to instantiate the declarations, definitions, or both, for
+/// the template.
+/// 1. `SLOT_MAP_DECL` (Optional) - Defining this to true signals to the implementation to
+/// declare the template instantiation when you include `<Cnx/SlotMap.h>`. This will instantiate
+/// any required type declarations and definitions and any required function declarations. No
+/// functions will be defined. This is optional (but signals intent explicitly) - If required
+/// template parameters are defined and `SLOT_MAP_IMPL` is not, then this will be inferred as
+/// true (`1`) by default.
+/// 2. `SLOT_MAP_IMPL` - Defining this to true signals to the implementation to define the
+/// template instantiation when you include `<Cnx/SlotMap.h>`. This will instantiate any
+/// required function definitions. If this instantiation-mode hasn't been included in exactly one
+/// translation unit in your build, you will get linking errors due to the missing function
+/// definitions.
+///
+/// ## Template Parameters
+///
+/// These provide the type or value parameters that the template is parameterized on to the
+/// template implementation. These should be `#define`d to their appropriate values.
+/// 1. `SLOT_MAP_T` - The type to store in the map. This is required.
+///
+/// Example:
+///
+/// @code {.c}
+/// // in `MySlotMap.h`
+/// #define SLOT_MAP_T f32
+/// #define SLOT_MAP_DECL TRUE
+/// #define SLOT_MAP_UNDEF_PARAMS TRUE
+/// #include <Cnx/SlotMap.h>
+///
+/// // in `MySlotMap.c`
+/// #include "MySlotMap.h"
+/// #define SLOT_MAP_T f32
+/// #define SLOT_MAP_IMPL TRUE
+/// #define SLOT_MAP_UNDEF_PARAMS TRUE
+/// #include <Cnx/SlotMap.h>
+///
+/// // elsewhere
+/// void example(void) {
+/// 	CnxScopedSlotMap(f32) map = cnx_slot_map_new(f32);
+/// 	let first = cnx_slot_map_insert(map, 1.0F);
+/// 	let second = cnx_slot_map_insert(map, 2.0F);
+///
+/// 	ignore(cnx_slot_map_erase(map, first));
+/// 	// `first` is now stale
+/// 	cnx_assert(cnx_slot_map_get(map, first) == nullptr, "first should be stale");
+/// 	// but `second` is still valid
+/// 	cnx_assert(cnx_slot_map_at(map, second) == 2.0F, "second should still be valid");
+///
+/// 	foreach(elem, map) {
+/// 		println("{}", elem);
+/// 	}
+/// }
+/// @endcode
+/// @}
+
+#include <Cnx/slot_map/SlotMapDef.h>
+
+#if !defined(SLOT_MAP_DECL) && (!defined(SLOT_MAP_IMPL) || !SLOT_MAP_IMPL) && defined(SLOT_MAP_T)
+	#define SLOT_MAP_DECL 1
+#endif // !defined(SLOT_MAP_DECL) && (!defined(SLOT_MAP_IMPL) || !SLOT_MAP_IMPL) \
+	   // && defined(SLOT_MAP_T)
+
+#if !defined(SLOT_MAP_T) && SLOT_MAP_DECL
+	#error SlotMap.h included with SLOT_MAP_DECL defined true but template parameter SLOT_MAP_T not defined
+#endif // !defined(SLOT_MAP_T) && SLOT_MAP_DECL
+
+#if !defined(SLOT_MAP_T) && SLOT_MAP_IMPL
+	#error SlotMap.h included with SLOT_MAP_IMPL defined true but template parameter SLOT_MAP_T not defined
+#endif // !defined(SLOT_MAP_T) && SLOT_MAP_IMPL
+
+#if SLOT_MAP_DECL && SLOT_MAP_IMPL
+	#define SLOT_MAP_STATIC static
+	#define SLOT_MAP_INLINE inline
+#else
+	#ifndef SLOT_MAP_STATIC
+		#define SLOT_MAP_STATIC
+	#endif // SLOT_MAP_STATIC
+	#ifndef SLOT_MAP_INLINE
+		#define SLOT_MAP_INLINE
+	#endif // SLOT_MAP_INLINE
+#endif	   // SLOT_MAP_DECL && SLOT_MAP_IMPL
+
+#if defined(SLOT_MAP_T) && SLOT_MAP_DECL && !CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+	#include <Cnx/slot_map/SlotMapDecl.h>
+#endif // defined(SLOT_MAP_T) && SLOT_MAP_DECL && !CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+
+#if defined(SLOT_MAP_T) && SLOT_MAP_IMPL && !CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+	#include <Cnx/slot_map/SlotMapImpl.h>
+#endif // defined(SLOT_MAP_T) && SLOT_MAP_IMPL && !CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+
+#if SLOT_MAP_UNDEF_PARAMS
+	#undef SLOT_MAP_T
+	#undef SLOT_MAP_DECL
+	#undef SLOT_MAP_IMPL
+	#undef SLOT_MAP_UNDEF_PARAMS
+#endif // SLOT_MAP_UNDEF_PARAMS
+
+#ifdef SLOT_MAP_STATIC
+	#undef SLOT_MAP_STATIC
+#endif // SLOT_MAP_STATIC
+#ifdef SLOT_MAP_INLINE
+	#undef SLOT_MAP_INLINE
+#endif // SLOT_MAP_INLINE
@@ -0,0 +1,167 @@
+/// @file SoA.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides a struct-of-arrays container template for Cnx
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// @ingroup collections
+/// @{
+/// @defgroup cnx_soa CnxSoA
+/// `CnxSoA(T)` is a struct template for a dynamic-capacity, struct-of-arrays container. Where
+/// `CnxVector(T)` stores each element's fields together (array-of-structs), `CnxSoA(T)` stores
+/// each field of `T` in its own contiguous column. Loops that only touch one or two fields of
+/// wide records then read only the columns they need, using every byte of every cache line they
+/// load, and the compiler can vectorize them directly over the column arrays.
+///
+/// Every column is aligned to `CNX_SOA_COLUMN_ALIGNMENT` (a cache line), and all of the columns
+/// share a single allocation, so growing the container is a single allocation no matter how many
+/// fields `T` has. Elements can be appended, inserted, erased, read, and written as a whole
+/// (gathered from and scattered to each column), and each column can be accessed directly, with
+/// `cnx_soa_column`, or as a `CnxSoASpan(T, field)` (a pointer and length pair), with
+/// `cnx_soa_column_span`.
+///
+/// The element type `T` is generated by the template from the list of fields it's instantiated
+/// with, so it must not already be defined. The fields are bitwise copied when moved between
+/// columns, so their types must be trivially copyable (`CnxSoA(T)` is intended for plain
+/// numeric data).
+///
+/// # Parameters
+///
+/// `CnxSoA(T)` takes several instantiation-time macro parameters, in addition to the
+/// instantiation-mode macro parameters required of all Cnx templates.
+///
+/// ## Instantiation-Mode Parameters
+///
+/// These signal to the implementation to instantiate the declarations, definitions, or both, for
+/// the template.
+/// 1. `SOA_DECL` (Optional) - Defining this to true signals to the implementation to declare the
+/// template instantiation when you include `<Cnx/SoA.h>`. This will instantiate any required
+/// type declarations and definitions (including `T` itself) and any required function
+/// declarations. No functions will be defined. This is optional (but signals intent explicitly)
+/// - If required template parameters are defined and `SOA_IMPL` is not, then this will be
+/// inferred as true (`1`) by default.
+/// 2. `SOA_IMPL` - Defining this to true signals to the implementation to define the template
+/// instantiation when you include `<Cnx/SoA.h>`. This will instantiate any required function
+/// definitions. If this instantiation-mode hasn't been included in exactly one translation unit
+/// in your build, you will get linking errors due to the missing function definitions.
+///
+/// ## Template Parameters
+///
+/// These provide the type or value parameters that the template is parameterized on to the
+/// template implementation. These should be `#define`d to their appropriate values.
+/// 1. `SOA_T` - The name of the element type to generate. This is required.
+/// 2. `SOA_FIELDS` - The fields of `SOA_T`, as a comma separated list of `(Type, name)` pairs.
+/// Each field's type must be an alphanumeric name (`typedef` it if necessary). This is required.
+///
+/// Example:
+///
+/// @code {.c}
+/// // in `Particles.h`
+/// #define SOA_T Particle
+/// #define SOA_FIELDS (f32, x), (f32, y), (f32, mass), (u32, id)
+/// #define SOA_DECL TRUE
+/// #define SOA_UNDEF_PARAMS TRUE
+/// #include <Cnx/SoA.h>
+///
+/// // in `Particles.c`
+/// #include "Particles.h"
+/// #define SOA_T Particle
+/// #define SOA_FIELDS (f32, x), (f32, y), (f32, mass), (u32, id)
+/// #define SOA_IMPL TRUE
+/// #define SOA_UNDEF_PARAMS TRUE
+/// #include <Cnx/SoA.h>
+///
+/// // elsewhere
+/// f32 total_mass(const CnxSoA(Particle)* particles) {
+/// 	// only the `mass` column is read, and this loop vectorizes
+/// 	let masses = cnx_soa_column_span(Particle, *particles, mass);
+/// 	let_mut total = 0.0F;
+/// 	for(let_mut i = 0U; i < masses.m_size; ++i) {
+/// 		total += masses.m_data[i];
+/// 	}
+/// 	return total;
+/// }
+///
+/// void example(void) {
+/// 	CnxScopedSoA(Particle) particles = cnx_soa_new(Particle);
+/// 	cnx_soa_push_back(particles, ((Particle){.x = 1.0F, .y = 2.0F, .mass = 3.0F, .id = 0}));
+/// 	cnx_soa_at(particles, x, 0) += 1.0F;
+/// 	let particle = cnx_soa_get(particles, 0);
+/// 	println("{}", total_mass(&particles));
+/// }
+/// @endcode
+/// @}
+
+#include <Cnx/soa/SoADef.h>
+
+#if !defined(SOA_DECL) && (!defined(SOA_IMPL) || !SOA_IMPL) && defined(SOA_T) \
+	&& defined(SOA_FIELDS)
+	#define SOA_DECL 1
+#endif // !defined(SOA_DECL) && (!defined(SOA_IMPL) || !SOA_IMPL) && defined(SOA_T) \
+	   // && defined(SOA_FIELDS)
+
+#if(!defined(SOA_T) || !defined(SOA_FIELDS)) && SOA_DECL
+	#error SoA.h included with SOA_DECL defined true but template parameters SOA_T and/or SOA_FIELDS not defined
+#endif // (!defined(SOA_T) || !defined(SOA_FIELDS)) && SOA_DECL
+
+#if(!defined(SOA_T) || !defined(SOA_FIELDS)) && SOA_IMPL
+	#error SoA.h included with SOA_IMPL defined true but template parameters SOA_T and/or SOA_FIELDS not defined
+#endif // (!defined(SOA_T) || !defined(SOA_FIELDS)) && SOA_IMPL
+
+#if SOA_DECL && SOA_IMPL
+	#define SOA_STATIC static
+	#define SOA_INLINE inline
+#else
+	#ifndef SOA_STATIC
+		#define SOA_STATIC
+	#endif // SOA_STATIC
+	#ifndef SOA_INLINE
+		#define SOA_INLINE
+	#endif // SOA_INLINE
+#endif	   // SOA_DECL && SOA_IMPL
+
+#if defined(SOA_T) && defined(SOA_FIELDS) && SOA_DECL && !CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+	#include <Cnx/soa/SoADecl.h>
+#endif // defined(SOA_T) && defined(SOA_FIELDS) && SOA_DECL \
+	   // && !CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+
+#if defined(SOA_T) && defined(SOA_FIELDS) && SOA_IMPL && !CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+	#include <Cnx/soa/SoAImpl.h>
+#endif // defined(SOA_T) && defined(SOA_FIELDS) && SOA_IMPL \
+	   // && !CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+
+#if SOA_UNDEF_PARAMS
+	#undef SOA_T
+	#undef SOA_FIELDS
+	#undef SOA_DECL
+	#undef SOA_IMPL
+	#undef SOA_UNDEF_PARAMS
+#endif // SOA_UNDEF_PARAMS
+
+#ifdef SOA_STATIC
+	#undef SOA_STATIC
+#endif // SOA_STATIC
+#ifdef SOA_INLINE
+	#undef SOA_INLINE
+#endif // SOA_INLINE
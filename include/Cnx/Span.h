@@ -0,0 +1,290 @@
+/// @file Span.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides a non-owning, contiguous view type, `CnxSpan(T)`, comparable to
+/// C++'s `std::span`, for Cnx
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+/// @ingroup collections
+/// @{
+/// @defgroup cnx_span CnxSpan
+/// `CnxSpan(T)` is a non-owning view of a contiguous sequence of `T`s: a pointer and a length.
+/// Any contiguous collection (`CnxVector(T)`, `CnxArray(T, N)`, a raw array, a column of a
+/// `CnxSoA(T)`, etc.) can be viewed as a `CnxSpan(T)`, so functions that only need to read or write
+/// a sequence of elements can accept a `CnxSpan(T)` instead of a specific collection type.
+///
+/// Unlike collections, spans have no vtable and iterating over one doesn't go through Cnx's
+/// iterator traits. `foreach_span`, `foreach_span_ref`, and `foreach_span_ref_mut` iterate over the
+/// span's elements through raw pointers, so the compiler sees an ordinary counted loop over an
+/// array and can unroll and vectorize it. For loops over large collections of plain numeric data
+/// where every cycle counts, prefer iterating over a span of the collection over using `foreach`
+/// with the collection directly.
+///
+/// Span types are declared with `DeclCnxSpan(T)`. Spans for the builtin scalar types (`char`,
+/// `u8`, ..., `f64`) are declared by this header.
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/Span.h>
+/// #include <Cnx/Vector.h>
+///
+/// i32 sum(CnxSpan(i32) values) {
+/// 	let_mut total = 0;
+/// 	// compiles to a vectorizable loop over `values.m_data`
+/// 	foreach_span(value, values) {
+/// 		total += value;
+/// 	}
+/// 	return total;
+/// }
+///
+/// void example(void) {
+/// 	CnxScopedVector(i32) vec = cnx_vector_new(i32);
+/// 	// fill `vec`...
+/// 	let total = sum(cnx_vector_as_span(i32, vec));
+///
+/// 	i32 array[] = {1, 2, 3, 4};
+/// 	let total2 = sum(cnx_span_from_array(i32, array));
+///
+/// 	// only the last two elements
+/// 	let total3 = sum(cnx_span_last(cnx_span_from_array(i32, array), 2));
+/// }
+/// @endcode
+/// @}
+
+#ifndef CNX_SPAN
+	/// @brief Declarations and definitions related to `CnxSpan(T)`
+	#define CNX_SPAN
+
+	#include <Cnx/Assert.h>
+	#include <Cnx/BasicTypes.h>
+	#include <Cnx/Def.h>
+
+	/// @brief Macro alias for a `CnxSpan(T)` viewing `T`s
+	///
+	/// @param T - The element type of the span
+	/// @ingroup cnx_span
+	#define CnxSpan(T) CONCAT2(CnxSpan, T)
+
+	/// @brief Declares the span type `CnxSpan(T)`
+	///
+	/// This must be used exactly once for each element type `T` in a translation unit before
+	/// `CnxSpan(T)` can be used
+	///
+	/// @param T - The element type of the span
+	/// @ingroup cnx_span
+	#define DeclCnxSpan(T)               \
+		typedef struct CnxSpan(T) {      \
+			T* m_data;                   \
+			usize m_size;                \
+		} CnxSpan(T)
+
+	/// @brief Creates a `CnxSpan(T)` viewing the `size` `T`s starting at `data`
+	///
+	/// @param T - The element type of the span
+	/// @param data - Pointer to the first element to view
+	/// @param size - The number of elements to view
+	///
+	/// @return a `CnxSpan(T)` viewing the given elements
+	/// @ingroup cnx_span
+	#define cnx_span_new(T, data, size) ((CnxSpan(T)){.m_data = (data), .m_size = (size)})
+
+	/// @brief Creates a `CnxSpan(T)` viewing every element of the given array
+	///
+	/// @param T - The element type of the span
+	/// @param array - The array to view. Must be an actual array, not a pointer
+	///
+	/// @return a `CnxSpan(T)` viewing `array`
+	/// @ingroup cnx_span
+	#define cnx_span_from_array(T, array) \
+		cnx_span_new(T, &((array)[0]), sizeof(array) / sizeof((array)[0]))
+
+	/// @brief Returns a pointer to the first element viewed by the span
+	///
+	/// @param self - The `CnxSpan(T)` to get the data of
+	///
+	/// @return the pointer to the beginning of `self`
+	/// @ingroup cnx_span
+	#define cnx_span_data(self) ((self).m_data)
+
+	/// @brief Returns the number of elements viewed by the span
+	///
+	/// @param self - The `CnxSpan(T)` to get the size of
+	///
+	/// @return the size of `self`
+	/// @ingroup cnx_span
+	#define cnx_span_size(self) ((self).m_size)
+
+	/// @brief Returns whether the span is empty
+	///
+	/// @param self - The `CnxSpan(T)` to check
+	///
+	/// @return whether `self` is empty
+	/// @ingroup cnx_span
+	#define cnx_span_is_empty(self) ((self).m_size == 0)
+
+	/// @brief Returns a reference to the element at the given index in the span
+	///
+	/// The index is bounds-checked via `cnx_assert`
+	///
+	/// @param self - The `CnxSpan(T)` to access an element of
+	/// @param index - The index of the element to access
+	///
+	/// @return a reference (lvalue) to the element at `index`
+	/// @ingroup cnx_span
+	#define cnx_span_at(self, index)                                                     \
+		(*({                                                                             \
+			let UNIQUE_VAR(span) = (self);                                               \
+			let UNIQUE_VAR(index_) = static_cast(usize)(index);                          \
+			cnx_assert(UNIQUE_VAR(index_) < UNIQUE_VAR(span).m_size,                     \
+					   "cnx_span_at called with index out of bounds");                   \
+			UNIQUE_VAR(span).m_data + UNIQUE_VAR(index_);                                \
+		}))
+
+	/// @brief Returns a span viewing `size` elements of `self`, starting at `offset`
+	///
+	/// @param self - The `CnxSpan(T)` to get a subspan of
+	/// @param offset - The index of the first element of the subspan
+	/// @param size - The number of elements in the subspan
+	///
+	/// @return a subspan of `self`
+	/// @ingroup cnx_span
+	#define cnx_span_subspan(self, offset, size)                                                 \
+		({                                                                                       \
+			let UNIQUE_VAR(span) = (self);                                                       \
+			let UNIQUE_VAR(offset_) = static_cast(usize)(offset);                                \
+			let UNIQUE_VAR(size_) = static_cast(usize)(size);                                    \
+			cnx_assert(UNIQUE_VAR(offset_) <= UNIQUE_VAR(span).m_size                            \
+						   && UNIQUE_VAR(size_) <= UNIQUE_VAR(span).m_size - UNIQUE_VAR(offset_), \
+					   "cnx_span_subspan called with a range out of bounds");                    \
+			(typeof(UNIQUE_VAR(span))){.m_data = UNIQUE_VAR(span).m_data + UNIQUE_VAR(offset_),  \
+									   .m_size = UNIQUE_VAR(size_)};                             \
+		})
+
+	/// @brief Returns a span viewing the first `size` elements of `self`
+	///
+	/// @param self - The `CnxSpan(T)` to get a subspan of
+	/// @param size - The number of elements in the subspan
+	///
+	/// @return a subspan of the beginning of `self`
+	/// @ingroup cnx_span
+	#define cnx_span_first(self, size) cnx_span_subspan(self, 0U, size)
+
+	/// @brief Returns a span viewing the last `size` elements of `self`
+	///
+	/// @param self - The `CnxSpan(T)` to get a subspan of
+	/// @param size - The number of elements in the subspan
+	///
+	/// @return a subspan of the end of `self`
+	/// @ingroup cnx_span
+	#define cnx_span_last(self, size)                                                        \
+		({                                                                                   \
+			let UNIQUE_VAR(span) = (self);                                                   \
+			let UNIQUE_VAR(size_) = static_cast(usize)(size);                                \
+			cnx_assert(UNIQUE_VAR(size_) <= UNIQUE_VAR(span).m_size,                         \
+					   "cnx_span_last called with size larger than the span");              \
+			(typeof(UNIQUE_VAR(span))){.m_data = UNIQUE_VAR(span).m_data                     \
+												 + (UNIQUE_VAR(span).m_size - UNIQUE_VAR(size_)), \
+									   .m_size = UNIQUE_VAR(size_)};                         \
+		})
+
+	// clang-format off
+
+	/// @brief Loops over each element viewed by the given span
+	///
+	/// This category of foreach loop iterates by value (`element` will be a copy).
+	/// Unlike `foreach`, this iterates through raw pointers, so the loop is eligible for
+	/// auto-vectorization
+	///
+	/// @param element - The name to use to reference the current element in the iteration
+	/// @param span - The `CnxSpan(T)` to iterate over
+	/// @ingroup cnx_span
+	#define foreach_span(element, span)                                                          \
+		let UNIQUE_VAR(span_) = (span);                                                          \
+		let UNIQUE_VAR(end) = UNIQUE_VAR(span_).m_data + UNIQUE_VAR(span_).m_size;               \
+		let_mut UNIQUE_VAR(current) = UNIQUE_VAR(span_).m_data;                                  \
+		for(typeof(*UNIQUE_VAR(current)) element; 											   \
+			UNIQUE_VAR(current) != UNIQUE_VAR(end) && ((element = *UNIQUE_VAR(current)), true); \
+			++UNIQUE_VAR(current))
+
+	/// @brief Loops over each element viewed by the given span
+	///
+	/// This category of foreach loop iterates by const pointer (`element` will be a pointer to
+	/// const). Unlike `foreach_ref`, this iterates through raw pointers, so the loop is eligible
+	/// for auto-vectorization
+	///
+	/// @param element - The name to use to reference the current element in the iteration
+	/// @param span - The `CnxSpan(T)` to iterate over
+	/// @ingroup cnx_span
+	#define foreach_span_ref(element, span)                                                      \
+		let UNIQUE_VAR(span_) = (span);                                                          \
+		for(const typeof(*UNIQUE_VAR(span_).m_data)* element = UNIQUE_VAR(span_).m_data;         \
+			element != UNIQUE_VAR(span_).m_data + UNIQUE_VAR(span_).m_size;                      \
+			++element)
+
+	/// @brief Loops over each element viewed by the given span
+	///
+	/// This category of foreach loop iterates by pointer (`element` will be a pointer).
+	/// Unlike `foreach_ref_mut`, this iterates through raw pointers, so the loop is eligible for
+	/// auto-vectorization
+	///
+	/// @param element - The name to use to reference the current element in the iteration
+	/// @param span - The `CnxSpan(T)` to iterate over
+	/// @ingroup cnx_span
+	#define foreach_span_ref_mut(element, span)                                                  \
+		let UNIQUE_VAR(span_) = (span);                                                          \
+		for(let_mut element = UNIQUE_VAR(span_).m_data;                                          \
+			element != UNIQUE_VAR(span_).m_data + UNIQUE_VAR(span_).m_size;                      \
+			++element)
+
+// clang-format on
+
+/// @brief Declares `CnxSpan(char)`
+DeclCnxSpan(char);
+/// @brief Declares `CnxSpan(u8)`
+DeclCnxSpan(u8);
+/// @brief Declares `CnxSpan(u16)`
+DeclCnxSpan(u16);
+/// @brief Declares `CnxSpan(u32)`
+DeclCnxSpan(u32);
+/// @brief Declares `CnxSpan(u64)`
+DeclCnxSpan(u64);
+/// @brief Declares `CnxSpan(usize)`
+DeclCnxSpan(usize);
+/// @brief Declares `CnxSpan(i8)`
+DeclCnxSpan(i8);
+/// @brief Declares `CnxSpan(i16)`
+DeclCnxSpan(i16);
+/// @brief Declares `CnxSpan(i32)`
+DeclCnxSpan(i32);
+/// @brief Declares `CnxSpan(i64)`
+DeclCnxSpan(i64);
+/// @brief Declares `CnxSpan(isize)`
+DeclCnxSpan(isize);
+/// @brief Declares `CnxSpan(f32)`
+DeclCnxSpan(f32);
+/// @brief Declares `CnxSpan(f64)`
+DeclCnxSpan(f64);
+
+#endif // CNX_SPAN
@@ -329,6 +329,64 @@ __attr(nodiscard) __attr(not_null(1)) CnxString
 											usize length,
 											CnxAllocator allocator)
 		cnx_disable_if(!string, "Can't create a CnxString from a nullptr");
+/// @brief Creates a new `CnxString` from the given UTF-16, transcoding it to UTF-8
+///
+/// The length of the result is computed up front, so this makes at most one allocation. Unpaired
+/// surrogates are transcoded as `U+FFFD` (see `<Cnx/Utf8.h>`).
+///
+/// @param string - The UTF-16 to create the `CnxString` from
+/// @param length - The number of code units in `string`
+///
+/// @return a `CnxString`
+/// @ingroup cnx_string
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_string_from_utf16(const u16* restrict string, usize length)
+		cnx_disable_if(!string, "Can't create a CnxString from a nullptr");
+/// @brief Creates a new `CnxString` from the given UTF-16, transcoding it to UTF-8
+///
+/// The length of the result is computed up front, so this makes at most one allocation. Unpaired
+/// surrogates are transcoded as `U+FFFD` (see `<Cnx/Utf8.h>`).
+///
+/// @param string - The UTF-16 to create the `CnxString` from
+/// @param length - The number of code units in `string`
+/// @param allocator - The allocator to use for memory allocations
+///
+/// @return a `CnxString`
+/// @ingroup cnx_string
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_string_from_utf16_with_allocator(const u16* restrict string,
+										 usize length,
+										 CnxAllocator allocator)
+		cnx_disable_if(!string, "Can't create a CnxString from a nullptr");
+/// @brief Creates a new `CnxString` from the given UTF-32, transcoding it to UTF-8
+///
+/// The length of the result is computed up front, so this makes at most one allocation.
+/// Surrogates and values above `U+10FFFF` are transcoded as `U+FFFD` (see `<Cnx/Utf8.h>`).
+///
+/// @param string - The UTF-32 to create the `CnxString` from
+/// @param length - The number of code units in `string`
+///
+/// @return a `CnxString`
+/// @ingroup cnx_string
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_string_from_utf32(const u32* restrict string, usize length)
+		cnx_disable_if(!string, "Can't create a CnxString from a nullptr");
+/// @brief Creates a new `CnxString` from the given UTF-32, transcoding it to UTF-8
+///
+/// The length of the result is computed up front, so this makes at most one allocation.
+/// Surrogates and values above `U+10FFFF` are transcoded as `U+FFFD` (see `<Cnx/Utf8.h>`).
+///
+/// @param string - The UTF-32 to create the `CnxString` from
+/// @param length - The number of code units in `string`
+/// @param allocator - The allocator to use for memory allocations
+///
+/// @return a `CnxString`
+/// @ingroup cnx_string
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_string_from_utf32_with_allocator(const u32* restrict string,
+										 usize length,
+										 CnxAllocator allocator)
+		cnx_disable_if(!string, "Can't create a CnxString from a nullptr");
 /// @brief Creates a new `CnxString` from the given `CnxStringView`
 ///
 /// @param view - The string view to create a `CnxString` from
@@ -1516,6 +1574,22 @@ __attr(not_null(1, 2)) void cnx_string_append_cstring(CnxString* restrict self,
 __attr(not_null(1, 2)) void cnx_string_append_stringview(CnxString* restrict self,
 														 const CnxStringView* restrict to_append)
 	___DISABLE_IF_NULL(self) cnx_disable_if(!to_append, "Can't append a nullptr to a CnxString");
+/// @brief Extends the string by `num_characters` characters, returning a pointer to the first
+/// of them, for the caller to fill in.
+///
+/// This allows producers that know the exact size of their output up front (encoders,
+/// transcoders, formatters) to write it directly into the string's storage, with at most one
+/// reallocation and no intermediate buffer. The contents of the new characters are unspecified
+/// until written.
+///
+/// @param self - The `CnxString` to extend
+/// @param num_characters - The number of characters to extend `self` by
+///
+/// @return a pointer to the first new character
+/// @ingroup cnx_string
+__attr(nodiscard) __attr(not_null(1)) __attr(returns_not_null) char_ptr
+	cnx_string_append_uninitialized(CnxString* restrict self, usize num_characters)
+		___DISABLE_IF_NULL(self);
 /// @brief Prepends the given string to the beginning of the string
 ///
 /// @param self - The `CnxString` to prepend to
@@ -1693,6 +1767,19 @@ __attr(nodiscard) __attr(not_null(1)) CnxStringView
 __attr(nodiscard) __attr(not_null(1)) CnxStringView
 	cnx_stringview_from(restrict const_cstring string, usize index, usize length)
 		cnx_disable_if(!string, "Can't create a stringview from a nullptr");
+/// @brief Returns a new `CnxStringView` of the given characters
+///
+/// Unlike `cnx_stringview_from`, the characters don't need to be null-terminated and their length
+/// isn't measured, so this can view any part of a larger buffer.
+///
+/// @param string - The characters to view
+/// @param length - The number of characters to view
+///
+/// @return a `CnxStringView` of the given characters
+/// @ingroup cnx_stringview
+__attr(nodiscard) __attr(not_null(1)) CnxStringView
+	cnx_stringview_from_raw(restrict const_cstring string, usize length)
+		cnx_disable_if(!string, "Can't create a stringview from a nullptr");
 /// @brief Returns the character in the view located at the given index
 ///
 /// @param self - The `CnxStringView` to retrieve a character from
@@ -2314,6 +2401,16 @@ __attr(nodiscard) __attr(not_null(1)) CnxRandomAccessIteratorconst_char_ref
 /// @return `Some(char)` if `cnx_string_size(self) > 0`, else `None(char)`
 /// @ingroup cnx_string
 #define cnx_string_pop_front(self) cnx_string_pop_front(&(self))
+/// @brief Extends the string by `num_characters` characters, returning a pointer to the first
+/// of them, for the caller to fill in. See `cnx_string_append_uninitialized`
+///
+/// @param self - The `CnxString` to extend
+/// @param num_characters - The number of characters to extend `self` by
+///
+/// @return a pointer to the first new character
+/// @ingroup cnx_string
+#define cnx_string_append_uninitialized(self, num_characters) \
+	cnx_string_append_uninitialized(&(self), num_characters)
 // clang-format off
 /// @brief Appends `to_append` to the end of `self`
 ///
@@ -0,0 +1,486 @@
+/// @file StringAscii.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Vectorized ASCII case conversion, trimming, and case-insensitive comparison for
+/// `CnxString`s and `CnxStringView`s
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef CNX_STRING_ASCII
+/// @brief Declarations related to ASCII string transforms
+#define CNX_STRING_ASCII
+
+#include <Cnx/Def.h>
+#include <Cnx/String.h>
+#include <Cnx/StringSearch.h>
+
+/// @ingroup cnx_string
+/// @{
+/// @defgroup cnx_string_ascii ASCII Transforms
+/// Functions for normalizing and comparing `CnxString`s and `CnxStringView`s under ASCII rules:
+///
+/// - Case conversion (`cnx_string_to_lower`, `cnx_string_to_upper`, and their in-place and
+/// `CnxStringView` variants) maps only `'A'`-`'Z'` to `'a'`-`'z'` and vice versa. All other bytes,
+/// including the bytes of non-ASCII UTF-8 sequences, are left unchanged, so UTF-8 input stays
+/// valid UTF-8.
+/// - Trimming (`cnx_string_trim`, `cnx_string_trim_start`, and `cnx_string_trim_end`) strips ASCII
+/// whitespace (`' '`, `'\t'`, `'\n'`, `'\v'`, `'\f'`, and `'\r'`) and returns a `CnxStringView`
+/// into the original string, without allocating.
+/// - Case-insensitive comparison (`cnx_string_equal_ignore_case`,
+/// `cnx_string_starts_with_ignore_case`, and `cnx_string_ends_with_ignore_case`) compares as if
+/// both sides were converted to lowercase, without actually converting either of them.
+///
+/// These are intended for hot loops such as normalizing protocol header names and keys, and are
+/// implemented with 32-byte (AVX2) or 16-byte (SSE2) kernels on x86_64, selected at runtime, with a
+/// portable scalar fallback.
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/StringAscii.h>
+///
+/// bool is_content_length(CnxStringView header_name) {
+/// 	let trimmed = cnx_stringview_trim(header_name);
+/// 	return cnx_stringview_equal_ignore_case(trimmed, "content-length");
+/// }
+///
+/// void normalize_key(CnxString* key) {
+/// 	cnx_string_to_lower_in_place(*key);
+/// }
+/// @endcode
+/// @}
+
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxString operation on a nullptr")
+
+/// @brief Returns a view of the given `CnxStringView` with leading and trailing ASCII whitespace
+/// removed
+///
+/// @param self - The `CnxStringView` to trim
+///
+/// @return a view of `self` without leading or trailing whitespace
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1)) CnxStringView
+	cnx_stringview_trim(const CnxStringView* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns a view of the given `CnxStringView` with leading ASCII whitespace removed
+///
+/// @param self - The `CnxStringView` to trim
+///
+/// @return a view of `self` without leading whitespace
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1)) CnxStringView
+	cnx_stringview_trim_start(const CnxStringView* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns a view of the given `CnxStringView` with trailing ASCII whitespace removed
+///
+/// @param self - The `CnxStringView` to trim
+///
+/// @return a view of `self` without trailing whitespace
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1)) CnxStringView
+	cnx_stringview_trim_end(const CnxStringView* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns whether the given `CnxStringView` is equal to the given string, ignoring ASCII
+/// case
+///
+/// @param self - The `CnxStringView` to compare
+/// @param other - The string to compare to
+/// @param other_length - The length of `other`
+///
+/// @return whether `self` and `other` are equal, ignoring ASCII case
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1, 2)) bool
+	cnx_stringview_equal_ignore_case_cstring(const CnxStringView* restrict self,
+											 restrict const_cstring other,
+											 usize other_length) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns whether the given `CnxStringView` starts with the given string, ignoring ASCII
+/// case
+///
+/// @param self - The `CnxStringView` to check
+/// @param prefix - The prefix to check for
+/// @param prefix_length - The length of `prefix`
+///
+/// @return whether `self` starts with `prefix`, ignoring ASCII case
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1, 2)) bool
+	cnx_stringview_starts_with_ignore_case_cstring(const CnxStringView* restrict self,
+												   restrict const_cstring prefix,
+												   usize prefix_length) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns whether the given `CnxStringView` ends with the given string, ignoring ASCII
+/// case
+///
+/// @param self - The `CnxStringView` to check
+/// @param suffix - The suffix to check for
+/// @param suffix_length - The length of `suffix`
+///
+/// @return whether `self` ends with `suffix`, ignoring ASCII case
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1, 2)) bool
+	cnx_stringview_ends_with_ignore_case_cstring(const CnxStringView* restrict self,
+												 restrict const_cstring suffix,
+												 usize suffix_length) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns a copy of the given `CnxStringView` with its ASCII letters converted to
+/// lowercase
+///
+/// @param self - The `CnxStringView` to convert
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return a lowercase copy of `self`
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_stringview_to_lower_with_allocator(const CnxStringView* restrict self,
+										   CnxAllocator allocator) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns a copy of the given `CnxStringView` with its ASCII letters converted to
+/// uppercase
+///
+/// @param self - The `CnxStringView` to convert
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return an uppercase copy of `self`
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_stringview_to_upper_with_allocator(const CnxStringView* restrict self,
+										   CnxAllocator allocator) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns a view of the given `CnxString` with leading and trailing ASCII whitespace
+/// removed
+///
+/// @param self - The `CnxString` to trim
+///
+/// @return a view of `self` without leading or trailing whitespace
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1)) CnxStringView
+	cnx_string_trim(const CnxString* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns a view of the given `CnxString` with leading ASCII whitespace removed
+///
+/// @param self - The `CnxString` to trim
+///
+/// @return a view of `self` without leading whitespace
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1)) CnxStringView
+	cnx_string_trim_start(const CnxString* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns a view of the given `CnxString` with trailing ASCII whitespace removed
+///
+/// @param self - The `CnxString` to trim
+///
+/// @return a view of `self` without trailing whitespace
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1)) CnxStringView
+	cnx_string_trim_end(const CnxString* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns whether the given `CnxString` is equal to the given string, ignoring ASCII case
+///
+/// @param self - The `CnxString` to compare
+/// @param other - The string to compare to
+/// @param other_length - The length of `other`
+///
+/// @return whether `self` and `other` are equal, ignoring ASCII case
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1, 2)) bool
+	cnx_string_equal_ignore_case_cstring(const CnxString* restrict self,
+										 restrict const_cstring other,
+										 usize other_length) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns whether the given `CnxString` starts with the given string, ignoring ASCII case
+///
+/// @param self - The `CnxString` to check
+/// @param prefix - The prefix to check for
+/// @param prefix_length - The length of `prefix`
+///
+/// @return whether `self` starts with `prefix`, ignoring ASCII case
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1, 2)) bool
+	cnx_string_starts_with_ignore_case_cstring(const CnxString* restrict self,
+											   restrict const_cstring prefix,
+											   usize prefix_length) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns whether the given `CnxString` ends with the given string, ignoring ASCII case
+///
+/// @param self - The `CnxString` to check
+/// @param suffix - The suffix to check for
+/// @param suffix_length - The length of `suffix`
+///
+/// @return whether `self` ends with `suffix`, ignoring ASCII case
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1, 2)) bool
+	cnx_string_ends_with_ignore_case_cstring(const CnxString* restrict self,
+											 restrict const_cstring suffix,
+											 usize suffix_length) ___DISABLE_IF_NULL(self);
+
+/// @brief Converts the ASCII letters of the given `CnxString` to lowercase, in place
+///
+/// @param self - The `CnxString` to convert
+/// @ingroup cnx_string_ascii
+__attr(not_null(1)) void cnx_string_to_lower_in_place(CnxString* restrict self)
+	___DISABLE_IF_NULL(self);
+
+/// @brief Converts the ASCII letters of the given `CnxString` to uppercase, in place
+///
+/// @param self - The `CnxString` to convert
+/// @ingroup cnx_string_ascii
+__attr(not_null(1)) void cnx_string_to_upper_in_place(CnxString* restrict self)
+	___DISABLE_IF_NULL(self);
+
+/// @brief Returns a copy of the given `CnxString` with its ASCII letters converted to lowercase,
+/// using the same allocator as `self`
+///
+/// @param self - The `CnxString` to convert
+///
+/// @return a lowercase copy of `self`
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_string_to_lower(const CnxString* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns a copy of the given `CnxString` with its ASCII letters converted to lowercase
+///
+/// @param self - The `CnxString` to convert
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return a lowercase copy of `self`
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_string_to_lower_with_allocator(const CnxString* restrict self, CnxAllocator allocator)
+		___DISABLE_IF_NULL(self);
+
+/// @brief Returns a copy of the given `CnxString` with its ASCII letters converted to uppercase,
+/// using the same allocator as `self`
+///
+/// @param self - The `CnxString` to convert
+///
+/// @return an uppercase copy of `self`
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_string_to_upper(const CnxString* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns a copy of the given `CnxString` with its ASCII letters converted to uppercase
+///
+/// @param self - The `CnxString` to convert
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return an uppercase copy of `self`
+/// @ingroup cnx_string_ascii
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_string_to_upper_with_allocator(const CnxString* restrict self, CnxAllocator allocator)
+		___DISABLE_IF_NULL(self);
+
+#undef ___DISABLE_IF_NULL
+
+/// @brief Returns a view of the given `CnxStringView` with leading and trailing ASCII whitespace
+/// removed
+///
+/// @param self - The `CnxStringView` to trim
+///
+/// @return a view of `self` without leading or trailing whitespace
+/// @ingroup cnx_string_ascii
+#define cnx_stringview_trim(self) cnx_stringview_trim(&(self))
+/// @brief Returns a view of the given `CnxStringView` with leading ASCII whitespace removed
+///
+/// @param self - The `CnxStringView` to trim
+///
+/// @return a view of `self` without leading whitespace
+/// @ingroup cnx_string_ascii
+#define cnx_stringview_trim_start(self) cnx_stringview_trim_start(&(self))
+/// @brief Returns a view of the given `CnxStringView` with trailing ASCII whitespace removed
+///
+/// @param self - The `CnxStringView` to trim
+///
+/// @return a view of `self` without trailing whitespace
+/// @ingroup cnx_string_ascii
+#define cnx_stringview_trim_end(self) cnx_stringview_trim_end(&(self))
+/// @brief Returns whether the given `CnxStringView` is equal to the given string, ignoring ASCII
+/// case
+///
+/// @param self - The `CnxStringView` to compare
+/// @param other - The string to compare to. Can be a `cstring`, a pointer to a `CnxStringView`,
+/// or a pointer to a `CnxString`
+///
+/// @return whether `self` and `other` are equal, ignoring ASCII case
+/// @ingroup cnx_string_ascii
+#define cnx_stringview_equal_ignore_case(self, other) \
+	cnx_stringview_equal_ignore_case_cstring(&(self), ___CNX_STRING_SEARCH_NEEDLE(other))
+/// @brief Returns whether the given `CnxStringView` starts with the given string, ignoring ASCII
+/// case
+///
+/// @param self - The `CnxStringView` to check
+/// @param prefix - The prefix to check for. Can be a `cstring`, a pointer to a `CnxStringView`,
+/// or a pointer to a `CnxString`
+///
+/// @return whether `self` starts with `prefix`, ignoring ASCII case
+/// @ingroup cnx_string_ascii
+#define cnx_stringview_starts_with_ignore_case(self, prefix) \
+	cnx_stringview_starts_with_ignore_case_cstring(&(self), ___CNX_STRING_SEARCH_NEEDLE(prefix))
+/// @brief Returns whether the given `CnxStringView` ends with the given string, ignoring ASCII
+/// case
+///
+/// @param self - The `CnxStringView` to check
+/// @param suffix - The suffix to check for. Can be a `cstring`, a pointer to a `CnxStringView`,
+/// or a pointer to a `CnxString`
+///
+/// @return whether `self` ends with `suffix`, ignoring ASCII case
+/// @ingroup cnx_string_ascii
+#define cnx_stringview_ends_with_ignore_case(self, suffix) \
+	cnx_stringview_ends_with_ignore_case_cstring(&(self), ___CNX_STRING_SEARCH_NEEDLE(suffix))
+/// @brief Returns a copy of the given `CnxStringView` with its ASCII letters converted to
+/// lowercase
+///
+/// @param self - The `CnxStringView` to convert
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return a lowercase copy of `self`
+/// @ingroup cnx_string_ascii
+#define cnx_stringview_to_lower_with_allocator(self, allocator) \
+	cnx_stringview_to_lower_with_allocator(&(self), (allocator))
+/// @brief Returns a copy of the given `CnxStringView` with its ASCII letters converted to
+/// lowercase
+///
+/// @param self - The `CnxStringView` to convert
+///
+/// @return a lowercase copy of `self`
+/// @ingroup cnx_string_ascii
+#define cnx_stringview_to_lower(self) \
+	cnx_stringview_to_lower_with_allocator(self, DEFAULT_ALLOCATOR)
+/// @brief Returns a copy of the given `CnxStringView` with its ASCII letters converted to
+/// uppercase
+///
+/// @param self - The `CnxStringView` to convert
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return an uppercase copy of `self`
+/// @ingroup cnx_string_ascii
+#define cnx_stringview_to_upper_with_allocator(self, allocator) \
+	cnx_stringview_to_upper_with_allocator(&(self), (allocator))
+/// @brief Returns a copy of the given `CnxStringView` with its ASCII letters converted to
+/// uppercase
+///
+/// @param self - The `CnxStringView` to convert
+///
+/// @return an uppercase copy of `self`
+/// @ingroup cnx_string_ascii
+#define cnx_stringview_to_upper(self) \
+	cnx_stringview_to_upper_with_allocator(self, DEFAULT_ALLOCATOR)
+
+/// @brief Returns a view of the given `CnxString` with leading and trailing ASCII whitespace
+/// removed
+///
+/// @param self - The `CnxString` to trim
+///
+/// @return a view of `self` without leading or trailing whitespace
+/// @ingroup cnx_string_ascii
+#define cnx_string_trim(self) cnx_string_trim(&(self))
+/// @brief Returns a view of the given `CnxString` with leading ASCII whitespace removed
+///
+/// @param self - The `CnxString` to trim
+///
+/// @return a view of `self` without leading whitespace
+/// @ingroup cnx_string_ascii
+#define cnx_string_trim_start(self) cnx_string_trim_start(&(self))
+/// @brief Returns a view of the given `CnxString` with trailing ASCII whitespace removed
+///
+/// @param self - The `CnxString` to trim
+///
+/// @return a view of `self` without trailing whitespace
+/// @ingroup cnx_string_ascii
+#define cnx_string_trim_end(self) cnx_string_trim_end(&(self))
+/// @brief Returns whether the given `CnxString` is equal to the given string, ignoring ASCII case
+///
+/// @param self - The `CnxString` to compare
+/// @param other - The string to compare to. Can be a `cstring`, a pointer to a `CnxStringView`,
+/// or a pointer to a `CnxString`
+///
+/// @return whether `self` and `other` are equal, ignoring ASCII case
+/// @ingroup cnx_string_ascii
+#define cnx_string_equal_ignore_case(self, other) \
+	cnx_string_equal_ignore_case_cstring(&(self), ___CNX_STRING_SEARCH_NEEDLE(other))
+/// @brief Returns whether the given `CnxString` starts with the given string, ignoring ASCII case
+///
+/// @param self - The `CnxString` to check
+/// @param prefix - The prefix to check for. Can be a `cstring`, a pointer to a `CnxStringView`,
+/// or a pointer to a `CnxString`
+///
+/// @return whether `self` starts with `prefix`, ignoring ASCII case
+/// @ingroup cnx_string_ascii
+#define cnx_string_starts_with_ignore_case(self, prefix) \
+	cnx_string_starts_with_ignore_case_cstring(&(self), ___CNX_STRING_SEARCH_NEEDLE(prefix))
+/// @brief Returns whether the given `CnxString` ends with the given string, ignoring ASCII case
+///
+/// @param self - The `CnxString` to check
+/// @param suffix - The suffix to check for. Can be a `cstring`, a pointer to a `CnxStringView`,
+/// or a pointer to a `CnxString`
+///
+/// @return whether `self` ends with `suffix`, ignoring ASCII case
+/// @ingroup cnx_string_ascii
+#define cnx_string_ends_with_ignore_case(self, suffix) \
+	cnx_string_ends_with_ignore_case_cstring(&(self), ___CNX_STRING_SEARCH_NEEDLE(suffix))
+/// @brief Converts the ASCII letters of the given `CnxString` to lowercase, in place
+///
+/// @param self - The `CnxString` to convert
+/// @ingroup cnx_string_ascii
+#define cnx_string_to_lower_in_place(self) cnx_string_to_lower_in_place(&(self))
+/// @brief Converts the ASCII letters of the given `CnxString` to uppercase, in place
+///
+/// @param self - The `CnxString` to convert
+/// @ingroup cnx_string_ascii
+#define cnx_string_to_upper_in_place(self) cnx_string_to_upper_in_place(&(self))
+/// @brief Returns a copy of the given `CnxString` with its ASCII letters converted to lowercase,
+/// using the same allocator as `self`
+///
+/// @param self - The `CnxString` to convert
+///
+/// @return a lowercase copy of `self`
+/// @ingroup cnx_string_ascii
+#define cnx_string_to_lower(self) cnx_string_to_lower(&(self))
+/// @brief Returns a copy of the given `CnxString` with its ASCII letters converted to lowercase
+///
+/// @param self - The `CnxString` to convert
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return a lowercase copy of `self`
+/// @ingroup cnx_string_ascii
+#define cnx_string_to_lower_with_allocator(self, allocator) \
+	cnx_string_to_lower_with_allocator(&(self), (allocator))
+/// @brief Returns a copy of the given `CnxString` with its ASCII letters converted to uppercase,
+/// using the same allocator as `self`
+///
+/// @param self - The `CnxString` to convert
+///
+/// @return an uppercase copy of `self`
+/// @ingroup cnx_string_ascii
+#define cnx_string_to_upper(self) cnx_string_to_upper(&(self))
+/// @brief Returns a copy of the given `CnxString` with its ASCII letters converted to uppercase
+///
+/// @param self - The `CnxString` to convert
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return an uppercase copy of `self`
+/// @ingroup cnx_string_ascii
+#define cnx_string_to_upper_with_allocator(self, allocator) \
+	cnx_string_to_upper_with_allocator(&(self), (allocator))
+
+#endif // CNX_STRING_ASCII
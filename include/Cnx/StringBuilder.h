@@ -0,0 +1,417 @@
+/// @file StringBuilder.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Chunked, incremental construction of large `CnxString`s
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+
+#ifndef CNX_STRING_BUILDER
+/// @brief Declarations related to `CnxStringBuilder`
+#define CNX_STRING_BUILDER
+
+#include <Cnx/Allocators.h>
+#include <Cnx/Def.h>
+#include <Cnx/Format.h>
+#include <Cnx/String.h>
+#include <Cnx/filesystem/File.h>
+
+/// @ingroup cnx_string
+/// @{
+/// @defgroup cnx_string_builder CnxStringBuilder
+/// `CnxStringBuilder` efficiently builds large strings from many smaller pieces.
+///
+/// Repeatedly appending to a `CnxString` re-grows one contiguous buffer, copying everything
+/// written so far on each growth, and prepending or inserting into one is O(N) per call. A
+/// `CnxStringBuilder` instead accumulates its contents in a list of geometrically growing chunks
+/// that are never moved once allocated, so appending and prepending strings, views, characters,
+/// and formatted values only ever copies the new data. Once built, the contents can be
+/// materialized into a `CnxString` with exactly one allocation (`cnx_string_builder_build`), or
+/// written straight to a `CnxFile` without materializing them at all
+/// (`cnx_string_builder_write_to_file`).
+///
+/// `CnxStringBuilder` is allocator aware; pairing it with a bump or arena style allocator makes
+/// chunk allocation essentially free.
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/StringBuilder.h>
+///
+/// CnxString build_report(const i32* values, usize num_values) {
+/// 	CnxScopedStringBuilder builder = cnx_string_builder_new();
+/// 	for(let_mut i = 0U; i < num_values; ++i) {
+/// 		cnx_string_builder_append_format(builder, "value {}: {}\n", i, values[i]);
+/// 	}
+/// 	cnx_string_builder_prepend(builder, "Report:\n");
+///
+/// 	return cnx_string_builder_build(builder);
+/// }
+/// @endcode
+/// @}
+
+/// @brief The size of the first chunk allocated by a `CnxStringBuilder`, unless a larger initial
+/// capacity is requested
+/// @ingroup cnx_string_builder
+#define CNX_STRING_BUILDER_MIN_CHUNK_SIZE 256
+
+/// @brief A single chunk of a `CnxStringBuilder`'s contents
+/// @ingroup cnx_string_builder
+typedef struct CnxStringBuilderChunk {
+	/// @brief The chunk's memory
+	char* m_data;
+	/// @brief The number of characters written to the chunk
+	usize m_length;
+	/// @brief The capacity of the chunk
+	usize m_capacity;
+} CnxStringBuilderChunk;
+
+/// @brief `CnxStringBuilder` accumulates appended and prepended strings in chunks, so that large
+/// strings can be built incrementally without repeatedly copying what has already been written
+/// @ingroup cnx_string_builder
+typedef struct CnxStringBuilder {
+	/// @brief The chunks holding appended contents, in order. Each is filled from its front
+	CnxStringBuilderChunk* m_chunks;
+	/// @brief The number of chunks in `m_chunks`
+	usize m_num_chunks;
+	/// @brief The capacity of `m_chunks`
+	usize m_chunks_capacity;
+	/// @brief The chunks holding prepended contents, in reverse order. Each is filled from its
+	/// back, so the contents of a prefix chunk are its last `m_length` characters
+	CnxStringBuilderChunk* m_prefix_chunks;
+	/// @brief The number of chunks in `m_prefix_chunks`
+	usize m_num_prefix_chunks;
+	/// @brief The capacity of `m_prefix_chunks`
+	usize m_prefix_chunks_capacity;
+	/// @brief The total length of the contents
+	usize m_length;
+	/// @brief The allocator used to allocate chunks and built strings
+	CnxAllocator m_allocator;
+} CnxStringBuilder;
+
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxStringBuilder operation on a nullptr")
+
+/// @brief Creates a new, empty `CnxStringBuilder` that will use the given allocator
+///
+/// @param allocator - The `CnxAllocator` to allocate memory with
+///
+/// @return an empty `CnxStringBuilder`
+/// @ingroup cnx_string_builder
+__attr(nodiscard) CnxStringBuilder cnx_string_builder_new_with_allocator(CnxAllocator allocator);
+/// @brief Creates a new, empty `CnxStringBuilder` with room for at least `capacity` characters
+/// before needing to allocate another chunk, that will use the given allocator
+///
+/// @param capacity - The minimum number of characters to reserve room for
+/// @param allocator - The `CnxAllocator` to allocate memory with
+///
+/// @return an empty `CnxStringBuilder`
+/// @ingroup cnx_string_builder
+__attr(nodiscard) CnxStringBuilder
+	cnx_string_builder_new_with_capacity_with_allocator(usize capacity, CnxAllocator allocator);
+/// @brief Frees the memory associated with the given `CnxStringBuilder`, leaving it empty
+///
+/// @param self - The `CnxStringBuilder` to free
+/// @ingroup cnx_string_builder
+__attr(not_null(1)) void cnx_string_builder_free(void* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief declare a `CnxStringBuilder` variable with this attribute to have
+/// `cnx_string_builder_free` automatically called on it when it goes out of scope
+/// @ingroup cnx_string_builder
+#define CnxScopedStringBuilder scoped(cnx_string_builder_free)
+
+/// @brief Returns the length of the contents of the given `CnxStringBuilder`
+///
+/// @param self - The `CnxStringBuilder` to get the length of
+///
+/// @return the length of `self`'s contents
+/// @ingroup cnx_string_builder
+__attr(nodiscard) __attr(not_null(1)) static inline usize
+	cnx_string_builder_length(const CnxStringBuilder* restrict self) ___DISABLE_IF_NULL(self) {
+	return self->m_length;
+}
+/// @brief Returns whether the given `CnxStringBuilder` is empty
+///
+/// @param self - The `CnxStringBuilder` to check
+///
+/// @return whether `self` is empty
+/// @ingroup cnx_string_builder
+__attr(nodiscard) __attr(not_null(1)) static inline bool
+	cnx_string_builder_is_empty(const CnxStringBuilder* restrict self) ___DISABLE_IF_NULL(self) {
+	return self->m_length == 0;
+}
+/// @brief Clears the contents of the given `CnxStringBuilder`, keeping its first chunk for reuse
+///
+/// @param self - The `CnxStringBuilder` to clear
+/// @ingroup cnx_string_builder
+__attr(not_null(1)) void cnx_string_builder_clear(CnxStringBuilder* restrict self)
+	___DISABLE_IF_NULL(self);
+
+/// @brief Appends the given characters to the end of the given `CnxStringBuilder`
+///
+/// @param self - The `CnxStringBuilder` to append to
+/// @param string - The characters to append
+/// @param length - The number of characters to append
+/// @ingroup cnx_string_builder
+__attr(not_null(1, 2)) void cnx_string_builder_append_cstring(CnxStringBuilder* restrict self,
+															  restrict const_cstring string,
+															  usize length)
+	___DISABLE_IF_NULL(self) cnx_disable_if(!string, "Can't append a nullptr to a CnxStringBuilder");
+/// @brief Prepends the given characters to the beginning of the given `CnxStringBuilder`
+///
+/// @param self - The `CnxStringBuilder` to prepend to
+/// @param string - The characters to prepend
+/// @param length - The number of characters to prepend
+/// @ingroup cnx_string_builder
+__attr(not_null(1, 2)) void cnx_string_builder_prepend_cstring(CnxStringBuilder* restrict self,
+															   restrict const_cstring string,
+															   usize length)
+	___DISABLE_IF_NULL(self)
+		cnx_disable_if(!string, "Can't prepend a nullptr to a CnxStringBuilder");
+/// @brief Appends the given character to the end of the given `CnxStringBuilder`
+///
+/// @param self - The `CnxStringBuilder` to append to
+/// @param character - The character to append
+/// @ingroup cnx_string_builder
+__attr(not_null(1)) void cnx_string_builder_push_back(CnxStringBuilder* restrict self,
+													  char character) ___DISABLE_IF_NULL(self);
+/// @brief Prepends the given character to the beginning of the given `CnxStringBuilder`
+///
+/// @param self - The `CnxStringBuilder` to prepend to
+/// @param character - The character to prepend
+/// @ingroup cnx_string_builder
+__attr(not_null(1)) void cnx_string_builder_push_front(CnxStringBuilder* restrict self,
+													   char character) ___DISABLE_IF_NULL(self);
+/// @brief Formats the given arguments according to the given format string directly into the end
+/// of the given `CnxStringBuilder`. Prefer `cnx_string_builder_append_format` to calling this
+/// directly
+///
+/// @param self - The `CnxStringBuilder` to append to
+/// @param format_string - The format string specifying how to format the arguments
+/// @param num_args - The number of arguments to format
+/// @param ... - The arguments to format, as `CnxFormat` Trait objects
+/// @ingroup cnx_string_builder
+__attr(not_null(1, 2)) void cnx_string_builder_append_format(CnxStringBuilder* restrict self,
+															 restrict const_cstring format_string,
+															 usize num_args,
+															 ...) ___DISABLE_IF_NULL(self);
+/// @brief Formats the given arguments according to the given format string directly into the
+/// beginning of the given `CnxStringBuilder`. Prefer `cnx_string_builder_prepend_format` to
+/// calling this directly
+///
+/// @param self - The `CnxStringBuilder` to prepend to
+/// @param format_string - The format string specifying how to format the arguments
+/// @param num_args - The number of arguments to format
+/// @param ... - The arguments to format, as `CnxFormat` Trait objects
+/// @ingroup cnx_string_builder
+__attr(not_null(1, 2)) void cnx_string_builder_prepend_format(CnxStringBuilder* restrict self,
+															  restrict const_cstring format_string,
+															  usize num_args,
+															  ...) ___DISABLE_IF_NULL(self);
+
+/// @brief Builds a `CnxString` from the contents of the given `CnxStringBuilder`, using the
+/// builder's allocator. This makes exactly one allocation (none if the contents fit in a short
+/// string), and leaves the builder unchanged
+///
+/// @param self - The `CnxStringBuilder` to build a `CnxString` from
+///
+/// @return a `CnxString` containing the contents of `self`
+/// @ingroup cnx_string_builder
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_string_builder_build(const CnxStringBuilder* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief Builds a `CnxString` from the contents of the given `CnxStringBuilder`, using the given
+/// allocator. This makes exactly one allocation (none if the contents fit in a short string), and
+/// leaves the builder unchanged
+///
+/// @param self - The `CnxStringBuilder` to build a `CnxString` from
+/// @param allocator - The `CnxAllocator` to allocate the `CnxString` with
+///
+/// @return a `CnxString` containing the contents of `self`
+/// @ingroup cnx_string_builder
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_string_builder_build_with_allocator(const CnxStringBuilder* restrict self,
+											CnxAllocator allocator) ___DISABLE_IF_NULL(self);
+/// @brief Writes the contents of the given `CnxStringBuilder` to the given `CnxFile`, chunk by
+/// chunk, without building an intermediate `CnxString`
+///
+/// @param self - The `CnxStringBuilder` to write
+/// @param file - The `CnxFile` to write to
+///
+/// @return `CnxResult(usize)` - The number of bytes written on success, otherwise the error
+/// returned by the failed write
+/// @ingroup cnx_string_builder
+__attr(nodiscard) __attr(not_null(1, 2)) CnxResult(usize)
+	cnx_string_builder_write_to_file(const CnxStringBuilder* restrict self,
+									 CnxFile* restrict file) ___DISABLE_IF_NULL(self)
+		cnx_disable_if(!file, "Can't write a CnxStringBuilder to a nullptr");
+
+#undef ___DISABLE_IF_NULL
+
+// clang-format off
+
+/// @brief Expands the given string-like value to the pointer-and-length argument pair expected by
+/// the `cnx_string_builder_*_cstring` functions
+#define ___CNX_STRING_BUILDER_ARG(string) 													   \
+	_Generic((string),                                                                      \
+		const_cstring 			: static_cast(const_cstring)(string),                      \
+		cstring 				: static_cast(const_cstring)(string),                      \
+		CnxStringView* 			: (static_cast(const CnxStringView*)(string))->m_view,     \
+		const CnxStringView* 	: (static_cast(const CnxStringView*)(string))->m_view,     \
+		CnxString* 				: (cnx_string_into_cstring)(                               \
+									static_cast(const CnxString*)(string)),                \
+		const CnxString* 		: (cnx_string_into_cstring)(                               \
+									static_cast(const CnxString*)(string))),               \
+	_Generic((string),                                                                      \
+		const_cstring 			: strlen(static_cast(const_cstring)(string)),              \
+		cstring 				: strlen(static_cast(const_cstring)(string)),              \
+		CnxStringView* 			: (static_cast(const CnxStringView*)(string))->m_length,   \
+		const CnxStringView* 	: (static_cast(const CnxStringView*)(string))->m_length,   \
+		CnxString* 				: (cnx_string_length)(static_cast(const CnxString*)(string)), \
+		const CnxString* 		: (cnx_string_length)(static_cast(const CnxString*)(string)))
+
+// clang-format on
+
+/// @brief Creates a new, empty `CnxStringBuilder` that will use the default allocator
+///
+/// @return an empty `CnxStringBuilder`
+/// @ingroup cnx_string_builder
+#define cnx_string_builder_new() cnx_string_builder_new_with_allocator(DEFAULT_ALLOCATOR)
+/// @brief Creates a new, empty `CnxStringBuilder` with room for at least `capacity` characters
+/// before needing to allocate another chunk, that will use the default allocator
+///
+/// @param capacity - The minimum number of characters to reserve room for
+///
+/// @return an empty `CnxStringBuilder`
+/// @ingroup cnx_string_builder
+#define cnx_string_builder_new_with_capacity(capacity) \
+	cnx_string_builder_new_with_capacity_with_allocator(capacity, DEFAULT_ALLOCATOR)
+/// @brief Frees the memory associated with the given `CnxStringBuilder`, leaving it empty
+///
+/// @param self - The `CnxStringBuilder` to free
+/// @ingroup cnx_string_builder
+#define cnx_string_builder_free(self) cnx_string_builder_free(&(self))
+/// @brief Returns the length of the contents of the given `CnxStringBuilder`
+///
+/// @param self - The `CnxStringBuilder` to get the length of
+///
+/// @return the length of `self`'s contents
+/// @ingroup cnx_string_builder
+#define cnx_string_builder_length(self) cnx_string_builder_length(&(self))
+/// @brief Returns whether the given `CnxStringBuilder` is empty
+///
+/// @param self - The `CnxStringBuilder` to check
+///
+/// @return whether `self` is empty
+/// @ingroup cnx_string_builder
+#define cnx_string_builder_is_empty(self) cnx_string_builder_is_empty(&(self))
+/// @brief Clears the contents of the given `CnxStringBuilder`, keeping its first chunk for reuse
+///
+/// @param self - The `CnxStringBuilder` to clear
+/// @ingroup cnx_string_builder
+#define cnx_string_builder_clear(self) cnx_string_builder_clear(&(self))
+/// @brief Appends the given string-like value to the end of the given `CnxStringBuilder`
+///
+/// @param self - The `CnxStringBuilder` to append to
+/// @param string - The string to append. Can be a `cstring`, a pointer to a `CnxStringView`, or
+/// a pointer to a `CnxString`
+/// @ingroup cnx_string_builder
+#define cnx_string_builder_append(self, string) \
+	cnx_string_builder_append_cstring(&(self), ___CNX_STRING_BUILDER_ARG(string))
+/// @brief Prepends the given string-like value to the beginning of the given `CnxStringBuilder`
+///
+/// @param self - The `CnxStringBuilder` to prepend to
+/// @param string - The string to prepend. Can be a `cstring`, a pointer to a `CnxStringView`, or
+/// a pointer to a `CnxString`
+/// @ingroup cnx_string_builder
+#define cnx_string_builder_prepend(self, string) \
+	cnx_string_builder_prepend_cstring(&(self), ___CNX_STRING_BUILDER_ARG(string))
+/// @brief Appends the given character to the end of the given `CnxStringBuilder`
+///
+/// @param self - The `CnxStringBuilder` to append to
+/// @param character - The character to append
+/// @ingroup cnx_string_builder
+#define cnx_string_builder_push_back(self, character) \
+	cnx_string_builder_push_back(&(self), (character))
+/// @brief Prepends the given character to the beginning of the given `CnxStringBuilder`
+///
+/// @param self - The `CnxStringBuilder` to prepend to
+/// @param character - The character to prepend
+/// @ingroup cnx_string_builder
+#define cnx_string_builder_push_front(self, character) \
+	cnx_string_builder_push_front(&(self), (character))
+/// @brief Formats the given arguments according to the given format string, and appends the
+/// result to the end of the given `CnxStringBuilder`
+///
+/// @param self - The `CnxStringBuilder` to append to
+/// @param format_string - The format string specifying how to format the arguments
+/// @param ... - The arguments to format
+/// @ingroup cnx_string_builder
+#define cnx_string_builder_append_format(self, format_string, ...) \
+	(cnx_string_builder_append_format)(&(self),                    \
+									   format_string,              \
+									   PP_NUM_ARGS(__VA_ARGS__)    \
+										   __VA_OPT__(, APPLY_TO_LIST(as_format, __VA_ARGS__)))
+/// @brief Formats the given arguments according to the given format string, and prepends the
+/// result to the beginning of the given `CnxStringBuilder`
+///
+/// @param self - The `CnxStringBuilder` to prepend to
+/// @param format_string - The format string specifying how to format the arguments
+/// @param ... - The arguments to format
+/// @ingroup cnx_string_builder
+#define cnx_string_builder_prepend_format(self, format_string, ...) \
+	(cnx_string_builder_prepend_format)(&(self),                    \
+										format_string,              \
+										PP_NUM_ARGS(__VA_ARGS__)    \
+											__VA_OPT__(, APPLY_TO_LIST(as_format, __VA_ARGS__)))
+/// @brief Builds a `CnxString` from the contents of the given `CnxStringBuilder`, using the
+/// builder's allocator. This makes exactly one allocation (none if the contents fit in a short
+/// string), and leaves the builder unchanged
+///
+/// @param self - The `CnxStringBuilder` to build a `CnxString` from
+///
+/// @return a `CnxString` containing the contents of `self`
+/// @ingroup cnx_string_builder
+#define cnx_string_builder_build(self) cnx_string_builder_build(&(self))
+/// @brief Builds a `CnxString` from the contents of the given `CnxStringBuilder`, using the given
+/// allocator. This makes exactly one allocation (none if the contents fit in a short string), and
+/// leaves the builder unchanged
+///
+/// @param self - The `CnxStringBuilder` to build a `CnxString` from
+/// @param allocator - The `CnxAllocator` to allocate the `CnxString` with
+///
+/// @return a `CnxString` containing the contents of `self`
+/// @ingroup cnx_string_builder
+#define cnx_string_builder_build_with_allocator(self, allocator) \
+	cnx_string_builder_build_with_allocator(&(self), (allocator))
+/// @brief Writes the contents of the given `CnxStringBuilder` to the given `CnxFile`, chunk by
+/// chunk, without building an intermediate `CnxString`
+///
+/// @param self - The `CnxStringBuilder` to write
+/// @param file - The `CnxFile` to write to
+///
+/// @return `CnxResult(usize)` - The number of bytes written on success, otherwise the error
+/// returned by the failed write
+/// @ingroup cnx_string_builder
+#define cnx_string_builder_write_to_file(self, file) \
+	cnx_string_builder_write_to_file(&(self), (file))
+
+#endif // CNX_STRING_BUILDER
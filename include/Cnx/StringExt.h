@@ -30,6 +30,7 @@
 
 #include <Cnx/Def.h>
 #include <Cnx/String.h>
+#include <Cnx/StringSearch.h>
 
 #define VECTOR_INCLUDE_DEFAULT_INSTANTIATIONS TRUE
 #include <Cnx/Vector.h>
@@ -313,6 +314,52 @@ __attr(nodiscard) __attr(not_null(1)) CnxVector(usize)
 														  CnxAllocator allocator)
 		___DISABLE_IF_NULL(self);
 
+/// @brief Joins the given `CnxStringView`s into a single `CnxString`, with the given separator
+/// between each pair of adjacent views
+///
+/// Computes the length of the result up front, so the returned string is allocated exactly once,
+/// and each piece is then copied into it directly.
+///
+/// @param separator - The separator to insert between adjacent views
+/// @param separator_length - The length of `separator`
+/// @param views - The array of views to join
+/// @param num_views - The number of views in `views`
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return The joined string
+/// @ingroup cnx_string
+/// @headerfile "Cnx/StringExt.h"
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_string_join_stringviews_with_allocator(restrict const_cstring separator,
+											   usize separator_length,
+											   const CnxStringView* restrict views,
+											   usize num_views,
+											   CnxAllocator allocator)
+		cnx_disable_if(!separator, "Can't join strings with a nullptr separator");
+
+/// @brief Joins the given `CnxString`s into a single `CnxString`, with the given separator
+/// between each pair of adjacent strings
+///
+/// Computes the length of the result up front, so the returned string is allocated exactly once,
+/// and each piece is then copied into it directly.
+///
+/// @param separator - The separator to insert between adjacent strings
+/// @param separator_length - The length of `separator`
+/// @param strings - The array of strings to join
+/// @param num_strings - The number of strings in `strings`
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return The joined string
+/// @ingroup cnx_string
+/// @headerfile "Cnx/StringExt.h"
+__attr(nodiscard) __attr(not_null(1)) CnxString
+	cnx_string_join_strings_with_allocator(restrict const_cstring separator,
+										   usize separator_length,
+										   const CnxString* restrict strings,
+										   usize num_strings,
+										   CnxAllocator allocator)
+		cnx_disable_if(!separator, "Can't join strings with a nullptr separator");
+
 /// @brief Splits the given string at each instance of the given `delimiter` character, returning a
 /// `CnxVector` of the resulting substrings
 ///
@@ -547,6 +594,158 @@ __attr(nodiscard) __attr(not_null(1)) CnxVector(usize)
 	const CnxString* 			: 	cnx_string_find_occurrences_of_with_allocator(&(self), 		   \
 										static_cast(const CnxString*)(to_find), allocator))
 
+
+/// @brief Joins the elements of the given `CnxVector(CnxString)` or `CnxVector(CnxStringView)`
+/// into a single `CnxString`, with the given separator between each pair of adjacent elements,
+/// using the given allocator
+///
+/// The returned string is allocated exactly once.
+///
+/// @param separator - The separator to insert between adjacent elements. Can be a `cstring`, a
+/// pointer to a `CnxStringView`, or a pointer to a `CnxString`
+/// @param vector - The `CnxVector(CnxString)` or `CnxVector(CnxStringView)` to join
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return The joined string
+/// @ingroup cnx_string
+/// @headerfile "Cnx/StringExt.h"
+#define cnx_string_join_with_allocator(separator, vector, allocator) 						   \
+	_Generic((vector), 																		   \
+	CnxVector(CnxString) 		: 	cnx_string_join_strings_with_allocator( 				   \
+										___CNX_STRING_SEARCH_NEEDLE(separator), 			   \
+										static_cast(const CnxString*)(						   \
+											static_cast(const void*)(cnx_vector_data(vector))),\
+										cnx_vector_size(vector), 							   \
+										allocator), 										   \
+	CnxVector(CnxStringView) 	: 	cnx_string_join_stringviews_with_allocator( 			   \
+										___CNX_STRING_SEARCH_NEEDLE(separator), 			   \
+										static_cast(const CnxStringView*)(					   \
+											static_cast(const void*)(cnx_vector_data(vector))),\
+										cnx_vector_size(vector), 							   \
+										allocator))
+
+/// @brief Joins the elements of the given `CnxVector(CnxString)` or `CnxVector(CnxStringView)`
+/// into a single `CnxString`, with the given separator between each pair of adjacent elements
+///
+/// The returned string is allocated exactly once, using the default allocator.
+///
+/// @param separator - The separator to insert between adjacent elements. Can be a `cstring`, a
+/// pointer to a `CnxStringView`, or a pointer to a `CnxString`
+/// @param vector - The `CnxVector(CnxString)` or `CnxVector(CnxStringView)` to join
+///
+/// @return The joined string
+/// @ingroup cnx_string
+/// @headerfile "Cnx/StringExt.h"
+#define cnx_string_join(separator, vector) \
+	cnx_string_join_with_allocator(separator, vector, DEFAULT_ALLOCATOR)
+
+/// @brief Joins the elements of the given array of `CnxString`s or `CnxStringView`s into a single
+/// `CnxString`, with the given separator between each pair of adjacent elements, using the given
+/// allocator
+///
+/// The returned string is allocated exactly once.
+///
+/// @param separator - The separator to insert between adjacent elements. Can be a `cstring`, a
+/// pointer to a `CnxStringView`, or a pointer to a `CnxString`
+/// @param array - Pointer to the first `CnxString` or `CnxStringView` to join
+/// @param count - The number of elements in `array`
+/// @param allocator - The allocator the returned string will use for memory allocations
+///
+/// @return The joined string
+/// @ingroup cnx_string
+/// @headerfile "Cnx/StringExt.h"
+#define cnx_string_join_array_with_allocator(separator, array, count, allocator) 			   \
+	_Generic((array), 																		   \
+	CnxString* 					: 	cnx_string_join_strings_with_allocator( 				   \
+										___CNX_STRING_SEARCH_NEEDLE(separator), 			   \
+										static_cast(const CnxString*)(						   \
+											static_cast(const void*)(array)), 				   \
+										count, 												   \
+										allocator), 										   \
+	const CnxString* 			: 	cnx_string_join_strings_with_allocator( 				   \
+										___CNX_STRING_SEARCH_NEEDLE(separator), 			   \
+										static_cast(const CnxString*)(						   \
+											static_cast(const void*)(array)), 				   \
+										count, 												   \
+										allocator), 										   \
+	CnxStringView* 				: 	cnx_string_join_stringviews_with_allocator( 			   \
+										___CNX_STRING_SEARCH_NEEDLE(separator), 			   \
+										static_cast(const CnxStringView*)(					   \
+											static_cast(const void*)(array)), 				   \
+										count, 												   \
+										allocator), 										   \
+	const CnxStringView* 		: 	cnx_string_join_stringviews_with_allocator( 			   \
+										___CNX_STRING_SEARCH_NEEDLE(separator), 			   \
+										static_cast(const CnxStringView*)(					   \
+											static_cast(const void*)(array)), 				   \
+										count, 												   \
+										allocator))
+
+/// @brief Joins the elements of the given array of `CnxString`s or `CnxStringView`s into a single
+/// `CnxString`, with the given separator between each pair of adjacent elements
+///
+/// The returned string is allocated exactly once, using the default allocator.
+///
+/// @param separator - The separator to insert between adjacent elements. Can be a `cstring`, a
+/// pointer to a `CnxStringView`, or a pointer to a `CnxString`
+/// @param array - Pointer to the first `CnxString` or `CnxStringView` to join
+/// @param count - The number of elements in `array`
+///
+/// @return The joined string
+/// @ingroup cnx_string
+/// @headerfile "Cnx/StringExt.h"
+#define cnx_string_join_array(separator, array, count) \
+	cnx_string_join_array_with_allocator(separator, array, count, DEFAULT_ALLOCATOR)
+
+/// @brief Converts the given string-like value to a `CnxStringView` of it
+#define ___CNX_STRING_EXT_AS_VIEW(string) 													   \
+	_Generic((string), 																		   \
+	const_cstring 				: 	cnx_stringview_from(static_cast(const_cstring)(string),    \
+										0, 													   \
+										strlen(static_cast(const_cstring)(string))), 		   \
+	cstring 					: 	cnx_stringview_from(static_cast(const_cstring)(string),    \
+										0, 													   \
+										strlen(static_cast(const_cstring)(string))), 		   \
+	CnxStringView* 				: 	*static_cast(const CnxStringView*)(string), 			   \
+	const CnxStringView* 		: 	*static_cast(const CnxStringView*)(string), 			   \
+	CnxString* 					: 	cnx_stringview_new(static_cast(const CnxString*)(string)), \
+	const CnxString* 			: 	cnx_stringview_new(static_cast(const CnxString*)(string)))
+
+/// @brief Concatenates all of the given string-like values into a single `CnxString`, using the
+/// given allocator
+///
+/// Unlike chaining `cnx_string_concatenate`, which allocates an intermediate string for each
+/// pair, this computes the length of the result up front and allocates exactly once.
+///
+/// @param allocator - The allocator the returned string will use for memory allocations
+/// @param ... - The strings to concatenate. Each can be a `cstring`, a pointer to a
+/// `CnxStringView`, or a pointer to a `CnxString`
+///
+/// @return The concatenated string
+/// @ingroup cnx_string
+/// @headerfile "Cnx/StringExt.h"
+#define cnx_string_concat_n_with_allocator(allocator, ...) 									   \
+	cnx_string_join_stringviews_with_allocator( 											   \
+		"", 																				   \
+		0, 																					   \
+		(const CnxStringView[]){APPLY_TO_LIST(___CNX_STRING_EXT_AS_VIEW, __VA_ARGS__)}, 	   \
+		PP_NUM_ARGS(__VA_ARGS__), 															   \
+		allocator)
+
+/// @brief Concatenates all of the given string-like values into a single `CnxString`
+///
+/// Unlike chaining `cnx_string_concatenate`, which allocates an intermediate string for each
+/// pair, this computes the length of the result up front and allocates exactly once, using the
+/// default allocator.
+///
+/// @param ... - The strings to concatenate. Each can be a `cstring`, a pointer to a
+/// `CnxStringView`, or a pointer to a `CnxString`
+///
+/// @return The concatenated string
+/// @ingroup cnx_string
+/// @headerfile "Cnx/StringExt.h"
+#define cnx_string_concat_n(...) cnx_string_concat_n_with_allocator(DEFAULT_ALLOCATOR, __VA_ARGS__)
+
 // clang-format on
 #undef ___DISABLE_IF_NULL
 #endif // CNX_STRING_EXT
@@ -0,0 +1,218 @@
+/// @file StringSearch.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Substring search for `CnxString`, `CnxStringView`, and raw byte strings
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef CNX_STRING_SEARCH
+/// @brief Declarations related to substring search
+#define CNX_STRING_SEARCH
+
+#include <Cnx/Def.h>
+#include <Cnx/String.h>
+
+/// @ingroup cnx_string
+/// @{
+/// @defgroup cnx_string_search String Search
+/// The substring search engine used by `cnx_string_contains`, `cnx_string_find_first`,
+/// `cnx_string_find_last`, `cnx_string_occurrences_of`, and `cnx_string_find_occurrences_of`, and
+/// exposed here for searching `CnxStringView`s and raw byte strings directly.
+///
+/// The engine picks an algorithm based on the needle length:
+/// - single-byte needles use `memchr`
+/// - short needles (up to `CNX_STRING_SEARCH_TWO_WAY_THRESHOLD` bytes) compare the first and last
+/// 	byte of the needle against a whole block of candidate positions at once, only doing a full
+/// 	comparison for positions where both match. Blocks are 32 bytes wide with AVX2 and 16 bytes
+/// 	wide with SSE2, selected at runtime based on the running CPU, with a portable
+/// 	`memchr`-driven fallback for other targets
+/// - longer needles use the Two-Way algorithm, which runs in linear time and constant space
+/// 	regardless of the contents of the haystack or needle
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/StringSearch.h>
+///
+/// let line = cnx_stringview_from("GET /index.html HTTP/1.1", 0, 24);
+/// if(cnx_stringview_contains(line, "HTTP/")) {
+/// 	let maybe_index = cnx_stringview_find_first(line, "/index");
+/// 	// maybe_index is Some(4)
+/// }
+/// @endcode
+/// @}
+
+/// @brief The needle length above which substring search switches from block-filtered comparison
+/// to the Two-Way algorithm
+/// @ingroup cnx_string_search
+#define CNX_STRING_SEARCH_TWO_WAY_THRESHOLD 64
+
+/// @brief Finds the first occurrence of `needle` in `haystack`
+///
+/// @param haystack - The bytes to search in
+/// @param haystack_length - The number of bytes in `haystack`
+/// @param needle - The bytes to search for
+/// @param needle_length - The number of bytes in `needle`
+///
+/// @return `Some` index of the first occurrence of `needle` in `haystack`, or `None` if it doesn't
+/// occur. An empty `needle` is found at index `0`.
+/// @ingroup cnx_string_search
+__attr(nodiscard) CnxOption(usize) cnx_string_search_first(restrict const_cstring haystack,
+														   usize haystack_length,
+														   restrict const_cstring needle,
+														   usize needle_length);
+
+/// @brief Finds the last occurrence of `needle` in `haystack`
+///
+/// @param haystack - The bytes to search in
+/// @param haystack_length - The number of bytes in `haystack`
+/// @param needle - The bytes to search for
+/// @param needle_length - The number of bytes in `needle`
+///
+/// @return `Some` index of the last occurrence of `needle` in `haystack`, or `None` if it doesn't
+/// occur. An empty `needle` is found at index `haystack_length`.
+/// @ingroup cnx_string_search
+__attr(nodiscard) CnxOption(usize) cnx_string_search_last(restrict const_cstring haystack,
+														  usize haystack_length,
+														  restrict const_cstring needle,
+														  usize needle_length);
+
+/// @brief Counts the (possibly overlapping) occurrences of `needle` in `haystack`
+///
+/// @param haystack - The bytes to search in
+/// @param haystack_length - The number of bytes in `haystack`
+/// @param needle - The bytes to search for
+/// @param needle_length - The number of bytes in `needle`
+///
+/// @return The number of indices in `haystack` at which `needle` occurs. An empty `needle` occurs
+/// at every index of `haystack`
+/// @ingroup cnx_string_search
+__attr(nodiscard) usize cnx_string_search_count(restrict const_cstring haystack,
+												usize haystack_length,
+												restrict const_cstring needle,
+												usize needle_length);
+
+#undef ___DISABLE_IF_NULL
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a stringview operation on a nullptr")
+
+/// @brief Returns whether the given `CnxStringView` contains the given `cstring`
+///
+/// @param self - The `CnxStringView` to search in
+/// @param substring - The `cstring` to search for
+/// @param substring_length - The length of `substring`
+///
+/// @return whether `self` contains `substring`
+/// @ingroup cnx_string_search
+/// @headerfile "Cnx/StringSearch.h"
+__attr(nodiscard) __attr(not_null(1, 2)) bool
+	cnx_stringview_contains_cstring(const CnxStringView* restrict self,
+									restrict const_cstring substring,
+									usize substring_length) ___DISABLE_IF_NULL(self);
+
+/// @brief Finds the first occurrence of the given `cstring` in the given `CnxStringView`
+///
+/// @param self - The `CnxStringView` to search in
+/// @param substring - The `cstring` to search for
+/// @param substring_length - The length of `substring`
+///
+/// @return `Some` index of the first occurrence of `substring` in `self`, or `None`
+/// @ingroup cnx_string_search
+/// @headerfile "Cnx/StringSearch.h"
+__attr(nodiscard) __attr(not_null(1, 2)) CnxOption(usize)
+	cnx_stringview_find_first_cstring(const CnxStringView* restrict self,
+									  restrict const_cstring substring,
+									  usize substring_length) ___DISABLE_IF_NULL(self);
+
+/// @brief Finds the last occurrence of the given `cstring` in the given `CnxStringView`
+///
+/// @param self - The `CnxStringView` to search in
+/// @param substring - The `cstring` to search for
+/// @param substring_length - The length of `substring`
+///
+/// @return `Some` index of the last occurrence of `substring` in `self`, or `None`
+/// @ingroup cnx_string_search
+/// @headerfile "Cnx/StringSearch.h"
+__attr(nodiscard) __attr(not_null(1, 2)) CnxOption(usize)
+	cnx_stringview_find_last_cstring(const CnxStringView* restrict self,
+									 restrict const_cstring substring,
+									 usize substring_length) ___DISABLE_IF_NULL(self);
+
+#undef ___DISABLE_IF_NULL
+
+// clang-format off
+
+/// @brief Expands to the pointer and length of the given string-like `substring`, as two
+/// comma-separated arguments
+#define ___CNX_STRING_SEARCH_NEEDLE(substring) 												   \
+	_Generic((substring),                                                                      \
+		const_cstring 			: static_cast(const_cstring)(substring),                       \
+		cstring 				: static_cast(const_cstring)(substring),                       \
+		CnxStringView* 			: (static_cast(const CnxStringView*)(substring))->m_view,      \
+		const CnxStringView* 	: (static_cast(const CnxStringView*)(substring))->m_view,      \
+		CnxString* 				: cnx_string_into_cstring(                                     \
+									*static_cast(const CnxString*)(substring)),                \
+		const CnxString* 		: cnx_string_into_cstring(                                     \
+									*static_cast(const CnxString*)(substring))),               \
+	_Generic((substring),                                                                      \
+		const_cstring 			: strlen(static_cast(const_cstring)(substring)),               \
+		cstring 				: strlen(static_cast(const_cstring)(substring)),               \
+		CnxStringView* 			: (static_cast(const CnxStringView*)(substring))->m_length,    \
+		const CnxStringView* 	: (static_cast(const CnxStringView*)(substring))->m_length,    \
+		CnxString* 				: cnx_string_length(*static_cast(const CnxString*)(substring)),\
+		const CnxString* 		: cnx_string_length(*static_cast(const CnxString*)(substring)))
+
+// clang-format on
+
+/// @brief Returns whether the given `CnxStringView` contains the given substring
+///
+/// @param self - The `CnxStringView` to search in
+/// @param substring - The substring to search for. Can be a `cstring`, a pointer to a
+/// `CnxStringView`, or a pointer to a `CnxString`
+///
+/// @return whether `self` contains `substring`
+/// @ingroup cnx_string_search
+#define cnx_stringview_contains(self, substring) \
+	cnx_stringview_contains_cstring(&(self), ___CNX_STRING_SEARCH_NEEDLE(substring))
+/// @brief Finds the first occurrence of the given substring in the given `CnxStringView`
+///
+/// @param self - The `CnxStringView` to search in
+/// @param substring - The substring to search for. Can be a `cstring`, a pointer to a
+/// `CnxStringView`, or a pointer to a `CnxString`
+///
+/// @return `Some` index of the first occurrence of `substring` in `self`, or `None`
+/// @ingroup cnx_string_search
+#define cnx_stringview_find_first(self, substring) \
+	cnx_stringview_find_first_cstring(&(self), ___CNX_STRING_SEARCH_NEEDLE(substring))
+/// @brief Finds the last occurrence of the given substring in the given `CnxStringView`
+///
+/// @param self - The `CnxStringView` to search in
+/// @param substring - The substring to search for. Can be a `cstring`, a pointer to a
+/// `CnxStringView`, or a pointer to a `CnxString`
+///
+/// @return `Some` index of the last occurrence of `substring` in `self`, or `None`
+/// @ingroup cnx_string_search
+#define cnx_stringview_find_last(self, substring) \
+	cnx_stringview_find_last_cstring(&(self), ___CNX_STRING_SEARCH_NEEDLE(substring))
+
+#endif // CNX_STRING_SEARCH
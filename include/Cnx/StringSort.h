@@ -0,0 +1,164 @@
+/// @file StringSort.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief String-specialized sorting of `CnxString`s and `CnxStringView`s
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef CNX_STRING_SORT
+/// @brief Declarations related to string sorting
+#define CNX_STRING_SORT
+
+#include <Cnx/Def.h>
+#include <Cnx/String.h>
+#include <Cnx/Vector.h>
+
+/// @ingroup cnx_string
+/// @{
+/// @defgroup cnx_string_sort String Sorting
+/// `cnx_string_sort` sorts a `CnxVector(CnxString)` or `CnxVector(CnxStringView)` (and
+/// `cnx_string_sort_array` an array of `CnxString`s or `CnxStringView`s) into lexicographical
+/// (byte-wise, `memcmp`) order, much faster than a generic comparison sort can.
+///
+/// A comparison sort compares whole strings from their first character on every comparison, and
+/// for `CnxString`s has to find each string's characters (possibly behind its `m_long` pointer)
+/// every time. Instead, string sorting first gathers a compact key for each element: a pointer to
+/// its characters, its length, and a cached 8-byte, big-endian prefix of its characters. It then
+/// sorts the keys with a multikey quicksort (Bentley & Sedgewick, "Fast Algorithms for Sorting
+/// and Searching Strings") that partitions on the cached prefix as a single integer, only moving
+/// on to the next 8 characters (and touching the characters themselves) for keys whose prefixes
+/// are equal. Characters that have already been found to be equal are never compared again.
+/// Finally, the elements themselves are moved into their sorted positions once, at the end.
+///
+/// `cnx_string_sort_parallel` and `cnx_string_sort_array_parallel` additionally split large inputs
+/// into independent ranges which are sorted on multiple threads.
+///
+/// String sorting is not stable: the relative order of elements with equal contents is
+/// unspecified.
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/StringSort.h>
+///
+/// void example(CnxVector(CnxString)* names) {
+/// 	cnx_string_sort(*names);
+///
+/// 	// or, for very large inputs, using four threads
+/// 	cnx_string_sort_parallel(*names, 4);
+///
+/// 	foreach(name, *names) {
+/// 		println("{}", name);
+/// 	}
+/// }
+/// @endcode
+/// @}
+
+/// @brief The minimum number of elements an input must have for `cnx_string_sort_parallel` or
+/// `cnx_string_sort_array_parallel` to use more than one thread. Smaller inputs are always sorted
+/// on the calling thread
+/// @ingroup cnx_string_sort
+#define CNX_STRING_SORT_PARALLEL_THRESHOLD 16384
+
+/// @brief Sorts the given array of `CnxString`s into lexicographical order
+///
+/// @param strings - The `CnxString`s to sort
+/// @param count - The number of `CnxString`s in `strings`
+/// @param num_threads - The maximum number of threads to sort with, including the calling thread.
+/// `0` and `1` both sort on the calling thread only
+/// @ingroup cnx_string_sort
+__attr(not_null(1)) void cnx_string_sort_strings(CnxString* restrict strings,
+												 usize count,
+												 usize num_threads)
+	cnx_disable_if(!strings, "Can't sort a nullptr array of CnxStrings");
+/// @brief Sorts the given array of `CnxStringView`s into lexicographical order
+///
+/// @param views - The `CnxStringView`s to sort
+/// @param count - The number of `CnxStringView`s in `views`
+/// @param num_threads - The maximum number of threads to sort with, including the calling thread.
+/// `0` and `1` both sort on the calling thread only
+/// @ingroup cnx_string_sort
+__attr(not_null(1)) void cnx_string_sort_stringviews(CnxStringView* restrict views,
+													 usize count,
+													 usize num_threads)
+	cnx_disable_if(!views, "Can't sort a nullptr array of CnxStringViews");
+
+// clang-format off
+
+/// @brief Sorts the elements of the given `CnxVector(CnxString)` or `CnxVector(CnxStringView)`
+/// into lexicographical order, using at most the given number of threads
+///
+/// @param vector - The `CnxVector(CnxString)` or `CnxVector(CnxStringView)` to sort
+/// @param num_threads - The maximum number of threads to sort with, including the calling thread.
+/// `0` and `1` both sort on the calling thread only
+/// @ingroup cnx_string_sort
+#define cnx_string_sort_parallel(vector, num_threads) 										   \
+	_Generic((vector), 																		   \
+	CnxVector(CnxString) 		: 	cnx_string_sort_strings( 								   \
+										static_cast(CnxString*)(							   \
+											static_cast(void*)(cnx_vector_data_mut(vector))),  \
+										cnx_vector_size(vector), 							   \
+										num_threads), 										   \
+	CnxVector(CnxStringView) 	: 	cnx_string_sort_stringviews( 							   \
+										static_cast(CnxStringView*)(						   \
+											static_cast(void*)(cnx_vector_data_mut(vector))),  \
+										cnx_vector_size(vector), 							   \
+										num_threads))
+
+/// @brief Sorts the elements of the given `CnxVector(CnxString)` or `CnxVector(CnxStringView)`
+/// into lexicographical order
+///
+/// @param vector - The `CnxVector(CnxString)` or `CnxVector(CnxStringView)` to sort
+/// @ingroup cnx_string_sort
+#define cnx_string_sort(vector) cnx_string_sort_parallel(vector, 1)
+
+/// @brief Sorts the given array of `CnxString`s or `CnxStringView`s into lexicographical order,
+/// using at most the given number of threads
+///
+/// @param array - Pointer to the first `CnxString` or `CnxStringView` to sort
+/// @param count - The number of elements in `array`
+/// @param num_threads - The maximum number of threads to sort with, including the calling thread.
+/// `0` and `1` both sort on the calling thread only
+/// @ingroup cnx_string_sort
+#define cnx_string_sort_array_parallel(array, count, num_threads) 							   \
+	_Generic((array), 																		   \
+	CnxString* 					: 	cnx_string_sort_strings( 								   \
+										static_cast(CnxString*)(static_cast(void*)(array)),    \
+										count, 												   \
+										num_threads), 										   \
+	CnxStringView* 				: 	cnx_string_sort_stringviews( 							   \
+										static_cast(CnxStringView*)(						   \
+											static_cast(void*)(array)), 					   \
+										count, 												   \
+										num_threads))
+
+/// @brief Sorts the given array of `CnxString`s or `CnxStringView`s into lexicographical order
+///
+/// @param array - Pointer to the first `CnxString` or `CnxStringView` to sort
+/// @param count - The number of elements in `array`
+/// @ingroup cnx_string_sort
+#define cnx_string_sort_array(array, count) cnx_string_sort_array_parallel(array, count, 1)
+
+// clang-format on
+
+#endif // CNX_STRING_SORT
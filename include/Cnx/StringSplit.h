@@ -0,0 +1,371 @@
+/// @file StringSplit.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Lazy, allocation-free splitting and tokenizing of `CnxString`s and `CnxStringView`s
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef CNX_STRING_SPLIT
+/// @brief Declarations related to lazy string splitting
+#define CNX_STRING_SPLIT
+
+#include <Cnx/Def.h>
+#include <Cnx/Iterator.h>
+#include <Cnx/String.h>
+#include <Cnx/StringSearch.h>
+#include <Cnx/__string/__byte_scan.h>
+
+/// @ingroup cnx_string
+/// @{
+/// @defgroup cnx_string_split String Splitting
+/// `CnxSplitIterator` lazily splits a `CnxString` or `CnxStringView` into `CnxStringView`s of its
+/// pieces. Pieces are found on demand with the substring search engine (so single-byte delimiters
+/// use `memchr`) or a vectorized byte-set scan, and splitting never allocates, regardless of the
+/// size of the input.
+///
+/// A `CnxSplitIterator` can split on:
+/// - every occurrence of a (possibly multi-byte) delimiter string (`cnx_stringview_split`)
+/// - every occurrence of any one of a set of delimiter bytes (`cnx_stringview_split_any_of`)
+///
+/// and can be configured with `CnxSplitOptions` to skip empty pieces (`cnx_stringview_tokenize` is
+/// shorthand for splitting on any of a set of bytes and skipping empty pieces) or to stop after a
+/// maximum number of splits, yielding the rest of the input as the final piece.
+///
+/// A `CnxSplitIterator` can be advanced manually with `cnx_split_iterator_next`, or iterated with
+/// `foreach` and `CnxRange`. Iterating with `foreach` or a `CnxRange` always starts from the
+/// beginning of the input. Because the current piece is stored in the `CnxSplitIterator` itself,
+/// the `CnxSplitIterator` must be mutable, must outlive any iteration over it, and only one
+/// iteration over it can be active at a time. The viewed string must outlive the
+/// `CnxSplitIterator` and any views it yields.
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/StringSplit.h>
+///
+/// void print_fields(CnxStringView line) {
+/// 	// prints "name", "", and "age"
+/// 	let_mut fields = cnx_stringview_split(line, ",");
+/// 	foreach(field, fields) {
+/// 		println("{}", field);
+/// 	}
+/// }
+///
+/// void count_words(CnxStringView text) {
+/// 	let_mut words = cnx_stringview_tokenize(text, " \t\n");
+/// 	let_mut count = 0U;
+/// 	while(cnx_option_is_some(cnx_split_iterator_next(words))) {
+/// 		++count;
+/// 	}
+/// }
+/// @endcode
+/// @}
+
+/// @brief Options controlling how a `CnxSplitIterator` splits its input. Zero-initialized
+/// options split on every occurrence of the delimiter string and yield empty pieces
+/// @ingroup cnx_string_split
+typedef struct CnxSplitOptions {
+	/// @brief Whether to split on any one of the bytes of the delimiter, instead of on
+	/// occurrences of the delimiter as a whole
+	bool m_any_of;
+	/// @brief Whether to skip empty pieces, such as those between adjacent delimiters
+	bool m_skip_empty;
+	/// @brief The maximum number of times to split the input. Once this many splits have been
+	/// made, the rest of the input is yielded as the final piece. `0` means unlimited
+	usize m_max_splits;
+} CnxSplitOptions;
+
+/// @brief The function vector table of methods associated with `CnxSplitIterator`
+/// @ingroup cnx_string_split
+typedef struct cnx_split_iterator_vtable_t cnx_split_iterator_vtable_t;
+
+/// @brief A lazy iteration over the pieces of a string delimited by a delimiter
+/// @ingroup cnx_string_split
+typedef struct CnxSplitIterator {
+	/// @brief The string being split
+	CnxStringView m_input;
+	/// @brief The piece most recently yielded
+	CnxStringView m_current;
+	/// @brief The delimiter string, or set of delimiter bytes
+	const_cstring m_delimiter;
+	/// @brief The length of `m_delimiter`
+	usize m_delimiter_length;
+	/// @brief The index in `m_input` at which the next piece begins
+	usize m_position;
+	/// @brief The number of splits made so far
+	usize m_splits;
+	/// @brief The options controlling the split
+	CnxSplitOptions m_options;
+	/// @brief Whether the final piece has been yielded
+	bool m_finished;
+	/// @brief The set of delimiter bytes, when splitting on any of a set of bytes
+	CnxByteSet m_delimiter_set;
+	/// @brief The function vector table of methods associated with `CnxSplitIterator`
+	const cnx_split_iterator_vtable_t* m_vtable;
+} CnxSplitIterator;
+
+/// @brief Cnx split iterator storage type
+/// `CnxSplitIteratorCursor` is the underlying storage type used by `CnxSplitIterator` for its
+/// iterator types (`CnxForwardIterator(Ref(CnxStringView))` and
+/// `CnxForwardIterator(ConstRef(CnxStringView))`)
+/// @ingroup cnx_string_split
+typedef struct CnxSplitIteratorCursor {
+	/// @brief The index of the current piece, or `-1` at the end of the iteration
+	isize m_index;
+	/// @brief The `CnxSplitIterator` this iterator iterates over
+	CnxSplitIterator* m_split;
+} CnxSplitIteratorCursor;
+
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxSplitIterator operation on a nullptr")
+
+/// @brief Creates a `CnxSplitIterator` over the pieces of `input` delimited by `delimiter`
+///
+/// @param input - The string to split
+/// @param delimiter - The delimiter string, or the set of delimiter bytes if
+/// `options.m_any_of` is `true`
+/// @param delimiter_length - The length of `delimiter`. Must be greater than zero
+/// @param options - The options controlling the split
+///
+/// @return a `CnxSplitIterator` over the pieces of `input`
+/// @ingroup cnx_string_split
+__attr(nodiscard) __attr(not_null(2)) CnxSplitIterator
+	cnx_split_iterator_new(CnxStringView input,
+						   restrict const_cstring delimiter,
+						   usize delimiter_length,
+						   CnxSplitOptions options);
+
+/// @brief Advances the given `CnxSplitIterator` to its next piece
+///
+/// @param self - The `CnxSplitIterator` to advance
+///
+/// @return `Some` view of the next piece, or `None` if all pieces have been yielded
+/// @ingroup cnx_string_split
+__attr(nodiscard) __attr(not_null(1)) CnxOption(CnxStringView)
+	cnx_split_iterator_next(CnxSplitIterator* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns the portion of the input the given `CnxSplitIterator` hasn't yielded yet
+///
+/// @param self - The `CnxSplitIterator` to get the remainder of
+///
+/// @return a view of the unconsumed input
+/// @ingroup cnx_string_split
+__attr(nodiscard) __attr(not_null(1)) CnxStringView
+	cnx_split_iterator_remainder(const CnxSplitIterator* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Restarts the given `CnxSplitIterator` at the beginning of its input
+///
+/// @param self - The `CnxSplitIterator` to reset
+/// @ingroup cnx_string_split
+__attr(not_null(1)) void cnx_split_iterator_reset(CnxSplitIterator* restrict self)
+	___DISABLE_IF_NULL(self);
+
+/// @brief Returns a `CnxForwardIterator(Ref(CnxStringView))` at the first piece of the given
+/// `CnxSplitIterator`, restarting it at the beginning of its input
+///
+/// @param self - The `CnxSplitIterator` to iterate over
+///
+/// @return a `CnxForwardIterator(Ref(CnxStringView))` at the first piece
+/// @ingroup cnx_string_split
+__attr(nodiscard) __attr(not_null(1)) CnxForwardIterator(Ref(CnxStringView))
+	cnx_split_iterator_begin(CnxSplitIterator* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns a `CnxForwardIterator(Ref(CnxStringView))` at the end of the iteration of the
+/// given `CnxSplitIterator`
+///
+/// @param self - The `CnxSplitIterator` to iterate over
+///
+/// @return a `CnxForwardIterator(Ref(CnxStringView))` at the end of the iteration
+/// @ingroup cnx_string_split
+__attr(nodiscard) __attr(not_null(1)) CnxForwardIterator(Ref(CnxStringView))
+	cnx_split_iterator_end(CnxSplitIterator* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns a `CnxForwardIterator(ConstRef(CnxStringView))` at the first piece of the given
+/// `CnxSplitIterator`, restarting it at the beginning of its input
+///
+/// @param self - The `CnxSplitIterator` to iterate over
+///
+/// @return a `CnxForwardIterator(ConstRef(CnxStringView))` at the first piece
+/// @ingroup cnx_string_split
+__attr(nodiscard) __attr(not_null(1)) CnxForwardIterator(ConstRef(CnxStringView))
+	cnx_split_iterator_cbegin(CnxSplitIterator* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns a `CnxForwardIterator(ConstRef(CnxStringView))` at the end of the iteration of
+/// the given `CnxSplitIterator`
+///
+/// @param self - The `CnxSplitIterator` to iterate over
+///
+/// @return a `CnxForwardIterator(ConstRef(CnxStringView))` at the end of the iteration
+/// @ingroup cnx_string_split
+__attr(nodiscard) __attr(not_null(1)) CnxForwardIterator(ConstRef(CnxStringView))
+	cnx_split_iterator_cend(CnxSplitIterator* restrict self) ___DISABLE_IF_NULL(self);
+
+#undef ___DISABLE_IF_NULL
+
+/// @brief The function vector table of methods associated with `CnxSplitIterator`
+/// @ingroup cnx_string_split
+typedef struct cnx_split_iterator_vtable_t {
+	/// @brief Returns a `CnxForwardIterator(Ref(CnxStringView))` at the first piece of the
+	/// `CnxSplitIterator`
+	CnxForwardIterator(Ref(CnxStringView)) (*const begin)(CnxSplitIterator* restrict self);
+	/// @brief Returns a `CnxForwardIterator(Ref(CnxStringView))` at the end of the iteration of
+	/// the `CnxSplitIterator`
+	CnxForwardIterator(Ref(CnxStringView)) (*const end)(CnxSplitIterator* restrict self);
+	/// @brief Returns a `CnxForwardIterator(ConstRef(CnxStringView))` at the first piece of the
+	/// `CnxSplitIterator`
+	CnxForwardIterator(ConstRef(CnxStringView)) (*const cbegin)(CnxSplitIterator* restrict self);
+	/// @brief Returns a `CnxForwardIterator(ConstRef(CnxStringView))` at the end of the
+	/// iteration of the `CnxSplitIterator`
+	CnxForwardIterator(ConstRef(CnxStringView)) (*const cend)(CnxSplitIterator* restrict self);
+} cnx_split_iterator_vtable_t;
+
+/// @brief Advances the given `CnxSplitIterator` to its next piece
+///
+/// @param self - The `CnxSplitIterator` to advance
+///
+/// @return `Some` view of the next piece, or `None` if all pieces have been yielded
+/// @ingroup cnx_string_split
+#define cnx_split_iterator_next(self) cnx_split_iterator_next(&(self))
+/// @brief Returns the portion of the input the given `CnxSplitIterator` hasn't yielded yet
+///
+/// @param self - The `CnxSplitIterator` to get the remainder of
+///
+/// @return a view of the unconsumed input
+/// @ingroup cnx_string_split
+#define cnx_split_iterator_remainder(self) cnx_split_iterator_remainder(&(self))
+/// @brief Restarts the given `CnxSplitIterator` at the beginning of its input
+///
+/// @param self - The `CnxSplitIterator` to reset
+/// @ingroup cnx_string_split
+#define cnx_split_iterator_reset(self) cnx_split_iterator_reset(&(self))
+/// @brief Returns a `CnxForwardIterator(Ref(CnxStringView))` at the first piece of the given
+/// `CnxSplitIterator`, restarting it at the beginning of its input
+///
+/// @param self - The `CnxSplitIterator` to iterate over
+///
+/// @return a `CnxForwardIterator(Ref(CnxStringView))` at the first piece
+/// @ingroup cnx_string_split
+#define cnx_split_iterator_begin(self) cnx_split_iterator_begin(&(self))
+/// @brief Returns a `CnxForwardIterator(Ref(CnxStringView))` at the end of the iteration of the
+/// given `CnxSplitIterator`
+///
+/// @param self - The `CnxSplitIterator` to iterate over
+///
+/// @return a `CnxForwardIterator(Ref(CnxStringView))` at the end of the iteration
+/// @ingroup cnx_string_split
+#define cnx_split_iterator_end(self) cnx_split_iterator_end(&(self))
+
+/// @brief Creates a `CnxSplitIterator` over the pieces of the given `CnxStringView` delimited by
+/// `delimiter`, with the given options
+///
+/// @param self - The `CnxStringView` to split
+/// @param delimiter - The delimiter. Can be a `cstring`, a pointer to a `CnxStringView`, or a
+/// pointer to a `CnxString`
+/// @param options - The `CnxSplitOptions` controlling the split
+///
+/// @return a `CnxSplitIterator` over the pieces of `self`
+/// @ingroup cnx_string_split
+#define cnx_stringview_split_with_options(self, delimiter, options) \
+	cnx_split_iterator_new((self), ___CNX_STRING_SEARCH_NEEDLE(delimiter), (options))
+/// @brief Creates a `CnxSplitIterator` over the pieces of the given `CnxStringView` delimited by
+/// each occurrence of `delimiter`
+///
+/// @param self - The `CnxStringView` to split
+/// @param delimiter - The delimiter. Can be a `cstring`, a pointer to a `CnxStringView`, or a
+/// pointer to a `CnxString`
+///
+/// @return a `CnxSplitIterator` over the pieces of `self`
+/// @ingroup cnx_string_split
+#define cnx_stringview_split(self, delimiter) \
+	cnx_stringview_split_with_options(self, delimiter, ((CnxSplitOptions){0}))
+/// @brief Creates a `CnxSplitIterator` over the pieces of the given `CnxStringView` delimited by
+/// each occurrence of any one of the bytes in `delimiters`
+///
+/// @param self - The `CnxStringView` to split
+/// @param delimiters - The set of delimiter bytes. Can be a `cstring`, a pointer to a
+/// `CnxStringView`, or a pointer to a `CnxString`
+///
+/// @return a `CnxSplitIterator` over the pieces of `self`
+/// @ingroup cnx_string_split
+#define cnx_stringview_split_any_of(self, delimiters) \
+	cnx_stringview_split_with_options(self, delimiters, ((CnxSplitOptions){.m_any_of = true}))
+/// @brief Creates a `CnxSplitIterator` over the non-empty tokens of the given `CnxStringView`
+/// separated by runs of any of the bytes in `delimiters`
+///
+/// @param self - The `CnxStringView` to tokenize
+/// @param delimiters - The set of delimiter bytes. Can be a `cstring`, a pointer to a
+/// `CnxStringView`, or a pointer to a `CnxString`
+///
+/// @return a `CnxSplitIterator` over the tokens of `self`
+/// @ingroup cnx_string_split
+#define cnx_stringview_tokenize(self, delimiters) \
+	cnx_stringview_split_with_options(self,       \
+									  delimiters, \
+									  ((CnxSplitOptions){.m_any_of = true, .m_skip_empty = true}))
+
+/// @brief Creates a `CnxSplitIterator` over the pieces of the given `CnxString` delimited by
+/// `delimiter`, with the given options
+///
+/// @param self - The `CnxString` to split
+/// @param delimiter - The delimiter. Can be a `cstring`, a pointer to a `CnxStringView`, or a
+/// pointer to a `CnxString`
+/// @param options - The `CnxSplitOptions` controlling the split
+///
+/// @return a `CnxSplitIterator` over the pieces of `self`
+/// @ingroup cnx_string_split
+#define cnx_string_split_with_options(self, delimiter, options) \
+	cnx_stringview_split_with_options(cnx_stringview_new(&(self)), delimiter, options)
+/// @brief Creates a `CnxSplitIterator` over the pieces of the given `CnxString` delimited by
+/// each occurrence of `delimiter`
+///
+/// @param self - The `CnxString` to split
+/// @param delimiter - The delimiter. Can be a `cstring`, a pointer to a `CnxStringView`, or a
+/// pointer to a `CnxString`
+///
+/// @return a `CnxSplitIterator` over the pieces of `self`
+/// @ingroup cnx_string_split
+#define cnx_string_split(self, delimiter) cnx_stringview_split(cnx_stringview_new(&(self)), delimiter)
+/// @brief Creates a `CnxSplitIterator` over the pieces of the given `CnxString` delimited by
+/// each occurrence of any one of the bytes in `delimiters`
+///
+/// @param self - The `CnxString` to split
+/// @param delimiters - The set of delimiter bytes. Can be a `cstring`, a pointer to a
+/// `CnxStringView`, or a pointer to a `CnxString`
+///
+/// @return a `CnxSplitIterator` over the pieces of `self`
+/// @ingroup cnx_string_split
+#define cnx_string_split_any_of(self, delimiters) \
+	cnx_stringview_split_any_of(cnx_stringview_new(&(self)), delimiters)
+/// @brief Creates a `CnxSplitIterator` over the non-empty tokens of the given `CnxString`
+/// separated by runs of any of the bytes in `delimiters`
+///
+/// @param self - The `CnxString` to tokenize
+/// @param delimiters - The set of delimiter bytes. Can be a `cstring`, a pointer to a
+/// `CnxStringView`, or a pointer to a `CnxString`
+///
+/// @return a `CnxSplitIterator` over the tokens of `self`
+/// @ingroup cnx_string_split
+#define cnx_string_tokenize(self, delimiters) \
+	cnx_stringview_tokenize(cnx_stringview_new(&(self)), delimiters)
+
+#endif // CNX_STRING_SPLIT
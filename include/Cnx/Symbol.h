@@ -0,0 +1,282 @@
+/// @file Symbol.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief String interning: deduplicated, identity-comparable `CnxSymbol`s
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+
+#ifndef CNX_SYMBOL
+/// @brief Declarations related to `CnxSymbol` and `CnxSymbolTable`
+#define CNX_SYMBOL
+
+#include <Cnx/Allocators.h>
+#include <Cnx/Def.h>
+#include <Cnx/String.h>
+#include <Cnx/StringSearch.h>
+#include <Cnx/sync/SharedMutex.h>
+
+/// @ingroup cnx_string
+/// @{
+/// @defgroup cnx_symbol CnxSymbol
+/// `CnxSymbol` is an interned string: a pointer-sized handle to a single, immutable, shared copy of
+/// a string's contents stored in a `CnxSymbolTable`.
+///
+/// Interning the same contents in the same `CnxSymbolTable` always yields the same `CnxSymbol`,
+/// so symbols are compared by identity in O(1) (`cnx_symbol_equal`), carry a precomputed hash
+/// (`cnx_symbol_hash`), and every occurrence of a given string shares one copy of its bytes. This
+/// makes `CnxSymbol` ideal for identifiers that are stored and compared many times over, such as
+/// host names, field names, or tags.
+///
+/// `CnxSymbolTable` is safe to use from multiple threads concurrently. It is split into
+/// `CNX_SYMBOL_TABLE_NUM_SHARDS` independently locked shards, so concurrent interning of different
+/// strings rarely contends, and looking up an already interned string only takes a shared (read)
+/// lock. The contents of interned strings are stored in large, never-moved blocks, so a
+/// `CnxSymbol` (and any `CnxStringView` of it) remains valid until its `CnxSymbolTable` is freed.
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/Symbol.h>
+///
+/// void example(CnxSymbolTable* table, const CnxString* host) {
+/// 	let symbol = cnx_symbol_table_intern(*table, host);
+/// 	let localhost = cnx_symbol_table_intern(*table, "localhost");
+/// 	// O(1), no string comparison
+/// 	if(cnx_symbol_equal(symbol, localhost)) {
+/// 		println("{}", cnx_symbol_into_stringview(symbol));
+/// 	}
+/// }
+/// @endcode
+/// @}
+
+/// @brief The number of independently locked shards a `CnxSymbolTable` is split into
+/// @ingroup cnx_symbol
+#define CNX_SYMBOL_TABLE_NUM_SHARDS 16
+
+/// @brief The minimum size of the blocks a `CnxSymbolTable` stores interned strings in
+/// @ingroup cnx_symbol
+#define CNX_SYMBOL_TABLE_BLOCK_SIZE 4096
+
+/// @brief The interned representation of a string, owned by a `CnxSymbolTable`
+/// @ingroup cnx_symbol
+typedef struct CnxSymbolEntry {
+	/// @brief The hash of the string
+	u64 m_hash;
+	/// @brief The length of the string
+	usize m_length;
+	/// @brief The null-terminated contents of the string
+	char m_data[];
+} CnxSymbolEntry;
+
+/// @brief `CnxSymbol` is a pointer-sized handle to a string interned in a `CnxSymbolTable`
+/// @ingroup cnx_symbol
+typedef struct CnxSymbol {
+	/// @brief The interned string this symbol refers to
+	const CnxSymbolEntry* m_entry;
+} CnxSymbol;
+
+#define OPTION_DECL TRUE
+/// @brief Declares `CnxOption(T)` for `CnxSymbol`
+#define OPTION_T CnxSymbol
+#include <Cnx/Option.h>
+#undef OPTION_T
+#undef OPTION_DECL
+
+/// @brief A single, independently locked shard of a `CnxSymbolTable`
+/// @ingroup cnx_symbol
+typedef struct CnxSymbolTableShard {
+	/// @brief Guards the shard. Lookups lock it shared, insertions lock it exclusively
+	CnxSharedMutex m_mutex;
+	/// @brief The open-addressed hash table of the shard's interned strings
+	const CnxSymbolEntry** m_slots;
+	/// @brief The number of slots in `m_slots`. Always zero or a power of two
+	usize m_capacity;
+	/// @brief The number of strings interned in the shard
+	usize m_size;
+	/// @brief The block interned strings are currently being stored in. The first bytes of each
+	/// block store a pointer to the previously filled block
+	char* m_block;
+	/// @brief The number of bytes used in `m_block`
+	usize m_block_used;
+	/// @brief The size of `m_block`
+	usize m_block_size;
+} CnxSymbolTableShard;
+
+/// @brief `CnxSymbolTable` is a thread-safe string interning table, mapping strings to
+/// deduplicated `CnxSymbol`s
+/// @ingroup cnx_symbol
+typedef struct CnxSymbolTable {
+	/// @brief The shards of the table
+	CnxSymbolTableShard m_shards[CNX_SYMBOL_TABLE_NUM_SHARDS];
+	/// @brief The allocator used for the table's memory
+	CnxAllocator m_allocator;
+} CnxSymbolTable;
+
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxSymbolTable operation on a nullptr")
+
+/// @brief Creates a new, empty `CnxSymbolTable` that will use the given allocator
+///
+/// @param allocator - The `CnxAllocator` to allocate memory with
+///
+/// @return an empty `CnxSymbolTable`
+/// @note Like other synchronization primitives, a `CnxSymbolTable` must not be moved once it's
+/// in use
+/// @ingroup cnx_symbol
+__attr(nodiscard) CnxSymbolTable cnx_symbol_table_new_with_allocator(CnxAllocator allocator);
+/// @brief Frees the given `CnxSymbolTable`, invalidating all `CnxSymbol`s interned in it
+///
+/// @param self - The `CnxSymbolTable` to free
+/// @ingroup cnx_symbol
+__attr(not_null(1)) void cnx_symbol_table_free(void* restrict self) ___DISABLE_IF_NULL(self);
+/// @brief declare a `CnxSymbolTable` variable with this attribute to have `cnx_symbol_table_free`
+/// automatically called on it when it goes out of scope
+/// @ingroup cnx_symbol
+#define CnxScopedSymbolTable scoped(cnx_symbol_table_free)
+
+/// @brief Interns the given string in the given `CnxSymbolTable`
+///
+/// @param self - The `CnxSymbolTable` to intern the string in
+/// @param string - The string to intern
+/// @param length - The length of `string`
+///
+/// @return the `CnxSymbol` for `string`
+/// @ingroup cnx_symbol
+__attr(nodiscard) __attr(not_null(1, 2)) CnxSymbol
+	cnx_symbol_table_intern_cstring(CnxSymbolTable* restrict self,
+									restrict const_cstring string,
+									usize length) ___DISABLE_IF_NULL(self)
+		cnx_disable_if(!string, "Can't intern a nullptr");
+/// @brief Looks up the given string in the given `CnxSymbolTable`, without interning it
+///
+/// @param self - The `CnxSymbolTable` to look up the string in
+/// @param string - The string to look up
+/// @param length - The length of `string`
+///
+/// @return `Some` `CnxSymbol` for `string` if it has been interned, otherwise `None`
+/// @ingroup cnx_symbol
+__attr(nodiscard) __attr(not_null(1, 2)) CnxOption(CnxSymbol)
+	cnx_symbol_table_find_cstring(CnxSymbolTable* restrict self,
+								  restrict const_cstring string,
+								  usize length) ___DISABLE_IF_NULL(self)
+		cnx_disable_if(!string, "Can't look up a nullptr");
+/// @brief Returns the number of distinct strings interned in the given `CnxSymbolTable`
+///
+/// @param self - The `CnxSymbolTable` to get the size of
+///
+/// @return the number of interned strings
+/// @ingroup cnx_symbol
+__attr(nodiscard) __attr(not_null(1)) usize cnx_symbol_table_size(CnxSymbolTable* restrict self)
+	___DISABLE_IF_NULL(self);
+
+#undef ___DISABLE_IF_NULL
+
+/// @brief Returns whether the given `CnxSymbol`s refer to the same interned string. Only
+/// meaningful for symbols interned in the same `CnxSymbolTable`
+///
+/// @param lhs - The first symbol to compare
+/// @param rhs - The second symbol to compare
+///
+/// @return whether `lhs` and `rhs` are the same symbol
+/// @ingroup cnx_symbol
+__attr(nodiscard) static inline bool cnx_symbol_equal(CnxSymbol lhs, CnxSymbol rhs) {
+	return lhs.m_entry == rhs.m_entry;
+}
+/// @brief Returns the hash of the given `CnxSymbol`'s string, computed when it was interned
+///
+/// @param self - The symbol to get the hash of
+///
+/// @return the hash of `self`
+/// @ingroup cnx_symbol
+__attr(nodiscard) static inline u64 cnx_symbol_hash(CnxSymbol self) {
+	return self.m_entry->m_hash;
+}
+/// @brief Returns the length of the given `CnxSymbol`'s string
+///
+/// @param self - The symbol to get the length of
+///
+/// @return the length of `self`
+/// @ingroup cnx_symbol
+__attr(nodiscard) static inline usize cnx_symbol_length(CnxSymbol self) {
+	return self.m_entry->m_length;
+}
+/// @brief Returns the null-terminated contents of the given `CnxSymbol`'s string
+///
+/// @param self - The symbol to get the contents of
+///
+/// @return the contents of `self`
+/// @ingroup cnx_symbol
+__attr(nodiscard) __attr(returns_not_null) static inline const_cstring
+	cnx_symbol_into_cstring(CnxSymbol self) {
+	return self.m_entry->m_data;
+}
+/// @brief Returns a `CnxStringView` of the given `CnxSymbol`'s string
+///
+/// @param self - The symbol to view
+///
+/// @return a view of `self`
+/// @ingroup cnx_symbol
+__attr(nodiscard) CnxStringView cnx_symbol_into_stringview(CnxSymbol self);
+
+/// @brief Creates a new, empty `CnxSymbolTable` that will use the default allocator
+///
+/// @return an empty `CnxSymbolTable`
+/// @note Like other synchronization primitives, a `CnxSymbolTable` must not be moved once it's
+/// in use
+/// @ingroup cnx_symbol
+#define cnx_symbol_table_new() cnx_symbol_table_new_with_allocator(DEFAULT_ALLOCATOR)
+/// @brief Frees the given `CnxSymbolTable`, invalidating all `CnxSymbol`s interned in it
+///
+/// @param self - The `CnxSymbolTable` to free
+/// @ingroup cnx_symbol
+#define cnx_symbol_table_free(self) cnx_symbol_table_free(&(self))
+/// @brief Interns the given string-like value in the given `CnxSymbolTable`
+///
+/// @param self - The `CnxSymbolTable` to intern the string in
+/// @param string - The string to intern. Can be a `cstring`, a pointer to a `CnxStringView`, or a
+/// pointer to a `CnxString`
+///
+/// @return the `CnxSymbol` for `string`
+/// @ingroup cnx_symbol
+#define cnx_symbol_table_intern(self, string) \
+	cnx_symbol_table_intern_cstring(&(self), ___CNX_STRING_SEARCH_NEEDLE(string))
+/// @brief Looks up the given string-like value in the given `CnxSymbolTable`, without interning it
+///
+/// @param self - The `CnxSymbolTable` to look up the string in
+/// @param string - The string to look up. Can be a `cstring`, a pointer to a `CnxStringView`, or
+/// a pointer to a `CnxString`
+///
+/// @return `Some` `CnxSymbol` for `string` if it has been interned, otherwise `None`
+/// @ingroup cnx_symbol
+#define cnx_symbol_table_find(self, string) \
+	cnx_symbol_table_find_cstring(&(self), ___CNX_STRING_SEARCH_NEEDLE(string))
+/// @brief Returns the number of distinct strings interned in the given `CnxSymbolTable`
+///
+/// @param self - The `CnxSymbolTable` to get the size of
+///
+/// @return the number of interned strings
+/// @ingroup cnx_symbol
+#define cnx_symbol_table_size(self) cnx_symbol_table_size(&(self))
+
+#endif // CNX_SYMBOL
@@ -0,0 +1,477 @@
+/// @file Utf8.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Vectorized UTF-8 validation, UTF-16/UTF-32 transcoding, and code point iteration for
+/// `CnxString`s and `CnxStringView`s
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef CNX_UTF8
+/// @brief Declarations related to UTF-8 validation, transcoding, and code point iteration
+#define CNX_UTF8
+
+#include <Cnx/Def.h>
+#include <Cnx/Iterator.h>
+#include <Cnx/String.h>
+
+/// @ingroup cnx_string
+/// @{
+/// @defgroup cnx_utf8 UTF-8
+/// Cnx's strings store arbitrary bytes, and are conventionally UTF-8. This module provides the
+/// tools for working with that UTF-8 safely and quickly, even when it comes from an untrusted
+/// source:
+///
+/// - `cnx_utf8_validate` checks that a byte range is well-formed UTF-8 per the Unicode standard
+/// (no overlong encodings, surrogates, code points above `U+10FFFF`, or truncated sequences). On
+/// x86_64 it uses the Keiser-Lemire lookup algorithm with AVX2 or SSSE3, selected at runtime,
+/// validating 32 or 16 bytes per step with a handful of table lookups and no branches, and skips
+/// ASCII-only blocks entirely. `cnx_utf8_find_invalid` reports where the first error is.
+/// - `cnx_utf8_is_ascii` is a vectorized check for ASCII-only input, which is trivially valid
+/// UTF-8 and needs no transcoding.
+/// - `cnx_utf8_utf16_length` and `cnx_utf8_utf32_length` compute the exact length of the
+/// transcoded output up front, so that transcoding needs exactly one allocation.
+/// `cnx_utf8_to_utf16`, `cnx_utf8_to_utf32`, `cnx_utf16_to_utf8`, and `cnx_utf32_to_utf8`
+/// transcode into caller-provided buffers of that length, with vectorized ASCII fast paths.
+/// Ill-formed UTF-8 is transcoded with the same replacement practice as `CnxCodePointIterator`.
+/// - `CnxCodePointIterator` lazily decodes the code points of a `CnxStringView`, and works with
+/// `foreach` and `CnxRange`. Ill-formed sequences are decoded as `U+FFFD` (the replacement
+/// character), following the Unicode "maximal subpart" practice, so iteration is safe on
+/// unvalidated input.
+///
+/// `cnx_string_from_utf16` and `cnx_string_from_utf32` (see `<Cnx/String.h>`) build a `CnxString`
+/// from UTF-16 or UTF-32 with one allocation, and `cnx_string_into_wcstring` and
+/// `cnx_string_from_wcstring` are implemented in terms of these transcoders.
+///
+/// Example:
+/// @code {.c}
+/// #include <Cnx/Utf8.h>
+///
+/// CnxResult(usize) count_characters(CnxStringView untrusted) {
+/// 	if(!cnx_stringview_is_valid_utf8(untrusted)) {
+/// 		return Err(usize, cnx_error_new(EILSEQ, CNX_POSIX_ERROR_CATEGORY));
+/// 	}
+///
+/// 	return Ok(usize, cnx_utf8_utf32_length(untrusted.m_view, untrusted.m_length));
+/// }
+///
+/// void print_code_points(CnxStringView view) {
+/// 	// prints "U+0063", "U+0061", "U+0066", "U+00E9"
+/// 	let_mut code_points = cnx_stringview_code_points(view);
+/// 	foreach(code_point, code_points) {
+/// 		println("U+{:X}", code_point);
+/// 	}
+/// }
+///
+/// const u16* into_utf16(CnxStringView view, usize* length) {
+/// 	*length = cnx_utf8_utf16_length(view.m_view, view.m_length);
+/// 	let_mut utf16 = cnx_allocator_allocate_array_t(u16, DEFAULT_ALLOCATOR, *length);
+/// 	ignore(cnx_utf8_to_utf16(view.m_view, view.m_length, utf16));
+/// 	return utf16;
+/// }
+/// @endcode
+/// @}
+
+/// @brief The Unicode replacement character, `U+FFFD`, substituted for ill-formed input
+/// @ingroup cnx_utf8
+#define CNX_UTF8_REPLACEMENT_CHARACTER 0xFFFDU
+
+/// @brief The maximum number of bytes in the UTF-8 encoding of a single code point
+/// @ingroup cnx_utf8
+#define CNX_UTF8_MAX_SEQUENCE_LENGTH 4U
+
+/// @brief Returns whether the given bytes are all ASCII (`< 0x80`)
+///
+/// ASCII is a subset of UTF-8, so ASCII-only input is valid UTF-8 with exactly one code point per
+/// byte.
+///
+/// @param data - The bytes to check
+/// @param length - The number of bytes in `data`
+///
+/// @return whether `data` contains only ASCII bytes
+/// @ingroup cnx_utf8
+__attr(nodiscard) bool cnx_utf8_is_ascii(restrict const_cstring data, usize length);
+
+/// @brief Returns whether the given bytes are well-formed UTF-8
+///
+/// @param data - The bytes to validate
+/// @param length - The number of bytes in `data`
+///
+/// @return whether `data` is valid UTF-8
+/// @ingroup cnx_utf8
+__attr(nodiscard) bool cnx_utf8_validate(restrict const_cstring data, usize length);
+
+/// @brief Finds the first ill-formed sequence in the given bytes
+///
+/// @param data - The bytes to validate
+/// @param length - The number of bytes in `data`
+///
+/// @return the index of the first byte of the first ill-formed sequence in `data`, or `length` if
+/// `data` is valid UTF-8
+/// @ingroup cnx_utf8
+__attr(nodiscard) usize cnx_utf8_find_invalid(restrict const_cstring data, usize length);
+
+/// @brief Decodes the code point starting at `*index` in the given UTF-8, and advances `*index`
+/// past it
+///
+/// If the bytes at `*index` aren't a well-formed sequence, returns
+/// `CNX_UTF8_REPLACEMENT_CHARACTER` and advances `*index` past the maximal subpart of the
+/// ill-formed sequence (at least one byte).
+///
+/// @param data - The UTF-8 to decode from
+/// @param length - The number of bytes in `data`
+/// @param index - The index to decode at. Must be less than `length`
+///
+/// @return the decoded code point
+/// @ingroup cnx_utf8
+__attr(nodiscard) __attr(not_null(3)) u32
+	cnx_utf8_decode(restrict const_cstring data, usize length, usize* restrict index);
+
+/// @brief Encodes the given code point as UTF-8
+///
+/// Surrogates and values above `U+10FFFF` are encoded as `CNX_UTF8_REPLACEMENT_CHARACTER`.
+///
+/// @param code_point - The code point to encode
+/// @param out - The buffer to write the encoding to. Must have room for
+/// `CNX_UTF8_MAX_SEQUENCE_LENGTH` bytes
+///
+/// @return the number of bytes written
+/// @ingroup cnx_utf8
+__attr(not_null(2)) usize cnx_utf8_encode(u32 code_point, char* restrict out);
+
+/// @brief Returns the number of UTF-16 code units required to represent the given UTF-8
+///
+/// If `data` isn't valid UTF-8 this still returns exactly the number of code units that
+/// `cnx_utf8_to_utf16` writes for it.
+///
+/// @param data - The UTF-8 to measure
+/// @param length - The number of bytes in `data`
+///
+/// @return the length of `data` transcoded to UTF-16
+/// @ingroup cnx_utf8
+__attr(nodiscard) usize cnx_utf8_utf16_length(restrict const_cstring data, usize length);
+
+/// @brief Returns the number of code points in the given UTF-8, which is the number of UTF-32 code
+/// units required to represent it
+///
+/// If `data` isn't valid UTF-8 this still returns exactly the number of code units that
+/// `cnx_utf8_to_utf32` writes for it.
+///
+/// @param data - The UTF-8 to measure
+/// @param length - The number of bytes in `data`
+///
+/// @return the length of `data` transcoded to UTF-32
+/// @ingroup cnx_utf8
+__attr(nodiscard) usize cnx_utf8_utf32_length(restrict const_cstring data, usize length);
+
+/// @brief Transcodes the given UTF-8 to UTF-16
+///
+/// The maximal subpart of each ill-formed sequence (as decoded by `cnx_utf8_decode`) is
+/// transcoded as one `CNX_UTF8_REPLACEMENT_CHARACTER`, so no input bytes are silently dropped.
+/// The output is always exactly `cnx_utf8_utf16_length(data, length)` code units, so it never
+/// overflows.
+///
+/// @param data - The UTF-8 to transcode
+/// @param length - The number of bytes in `data`
+/// @param out - The buffer to write the UTF-16 to. Must have room for
+/// `cnx_utf8_utf16_length(data, length)` code units
+///
+/// @return the number of code units written
+/// @ingroup cnx_utf8
+__attr(not_null(3)) usize
+	cnx_utf8_to_utf16(restrict const_cstring data, usize length, u16* restrict out);
+
+/// @brief Transcodes the given UTF-8 to UTF-32
+///
+/// The maximal subpart of each ill-formed sequence (as decoded by `cnx_utf8_decode`) is
+/// transcoded as one `CNX_UTF8_REPLACEMENT_CHARACTER`, so no input bytes are silently dropped.
+/// The output is always exactly `cnx_utf8_utf32_length(data, length)` code units, so it never
+/// overflows.
+///
+/// @param data - The UTF-8 to transcode
+/// @param length - The number of bytes in `data`
+/// @param out - The buffer to write the UTF-32 to. Must have room for
+/// `cnx_utf8_utf32_length(data, length)` code units
+///
+/// @return the number of code units written
+/// @ingroup cnx_utf8
+__attr(not_null(3)) usize
+	cnx_utf8_to_utf32(restrict const_cstring data, usize length, u32* restrict out);
+
+/// @brief Returns the number of bytes required to represent the given UTF-16 as UTF-8
+///
+/// Unpaired surrogates are counted as `CNX_UTF8_REPLACEMENT_CHARACTER`, matching
+/// `cnx_utf16_to_utf8`.
+///
+/// @param data - The UTF-16 to measure
+/// @param length - The number of code units in `data`
+///
+/// @return the length of `data` transcoded to UTF-8
+/// @ingroup cnx_utf8
+__attr(nodiscard) usize cnx_utf16_utf8_length(const u16* restrict data, usize length);
+
+/// @brief Transcodes the given UTF-16 to UTF-8
+///
+/// Unpaired surrogates are transcoded as `CNX_UTF8_REPLACEMENT_CHARACTER`.
+///
+/// @param data - The UTF-16 to transcode
+/// @param length - The number of code units in `data`
+/// @param out - The buffer to write the UTF-8 to. Must have room for
+/// `cnx_utf16_utf8_length(data, length)` bytes
+///
+/// @return the number of bytes written
+/// @ingroup cnx_utf8
+__attr(not_null(3)) usize
+	cnx_utf16_to_utf8(const u16* restrict data, usize length, char* restrict out);
+
+/// @brief Returns the number of bytes required to represent the given UTF-32 as UTF-8
+///
+/// Surrogates and values above `U+10FFFF` are counted as `CNX_UTF8_REPLACEMENT_CHARACTER`,
+/// matching `cnx_utf32_to_utf8`.
+///
+/// @param data - The UTF-32 to measure
+/// @param length - The number of code units in `data`
+///
+/// @return the length of `data` transcoded to UTF-8
+/// @ingroup cnx_utf8
+__attr(nodiscard) usize cnx_utf32_utf8_length(const u32* restrict data, usize length);
+
+/// @brief Transcodes the given UTF-32 to UTF-8
+///
+/// Surrogates and values above `U+10FFFF` are transcoded as `CNX_UTF8_REPLACEMENT_CHARACTER`.
+///
+/// @param data - The UTF-32 to transcode
+/// @param length - The number of code units in `data`
+/// @param out - The buffer to write the UTF-8 to. Must have room for
+/// `cnx_utf32_utf8_length(data, length)` bytes
+///
+/// @return the number of bytes written
+/// @ingroup cnx_utf8
+__attr(not_null(3)) usize
+	cnx_utf32_to_utf8(const u32* restrict data, usize length, char* restrict out);
+
+/// @brief The function vector table of methods associated with `CnxCodePointIterator`
+/// @ingroup cnx_utf8
+typedef struct cnx_code_point_iterator_vtable_t cnx_code_point_iterator_vtable_t;
+
+/// @brief A lazy iteration over the code points of a UTF-8 string
+/// @ingroup cnx_utf8
+typedef struct CnxCodePointIterator {
+	/// @brief The string being decoded
+	CnxStringView m_input;
+	/// @brief The index in `m_input` at which the next code point begins
+	usize m_position;
+	/// @brief The code point most recently yielded
+	u32 m_current;
+	/// @brief The function vector table of methods associated with `CnxCodePointIterator`
+	const cnx_code_point_iterator_vtable_t* m_vtable;
+} CnxCodePointIterator;
+
+/// @brief Cnx code point iterator storage type
+/// `CnxCodePointIteratorCursor` is the underlying storage type used by `CnxCodePointIterator` for
+/// its iterator types (`CnxForwardIterator(Ref(u32))` and `CnxForwardIterator(ConstRef(u32))`)
+/// @ingroup cnx_utf8
+typedef struct CnxCodePointIteratorCursor {
+	/// @brief The index of the current code point, or `-1` at the end of the iteration
+	isize m_index;
+	/// @brief The `CnxCodePointIterator` this iterator iterates over
+	CnxCodePointIterator* m_code_points;
+} CnxCodePointIteratorCursor;
+
+#define ___DISABLE_IF_NULL(self) \
+	cnx_disable_if(!(self), "Can't perform a CnxCodePointIterator operation on a nullptr")
+
+/// @brief Creates a `CnxCodePointIterator` over the code points of `input`
+///
+/// @param input - The UTF-8 string to decode
+///
+/// @return a `CnxCodePointIterator` over the code points of `input`
+/// @ingroup cnx_utf8
+__attr(nodiscard) CnxCodePointIterator cnx_code_point_iterator_new(CnxStringView input);
+
+/// @brief Advances the given `CnxCodePointIterator` to its next code point
+///
+/// @param self - The `CnxCodePointIterator` to advance
+///
+/// @return `Some` next code point, or `None` if all code points have been yielded
+/// @ingroup cnx_utf8
+__attr(nodiscard) __attr(not_null(1)) CnxOption(u32)
+	cnx_code_point_iterator_next(CnxCodePointIterator* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns the portion of the input the given `CnxCodePointIterator` hasn't decoded yet
+///
+/// @param self - The `CnxCodePointIterator` to get the remainder of
+///
+/// @return a view of the undecoded input
+/// @ingroup cnx_utf8
+__attr(nodiscard) __attr(not_null(1)) CnxStringView
+	cnx_code_point_iterator_remainder(const CnxCodePointIterator* restrict self)
+		___DISABLE_IF_NULL(self);
+
+/// @brief Restarts the given `CnxCodePointIterator` at the beginning of its input
+///
+/// @param self - The `CnxCodePointIterator` to reset
+/// @ingroup cnx_utf8
+__attr(not_null(1)) void cnx_code_point_iterator_reset(CnxCodePointIterator* restrict self)
+	___DISABLE_IF_NULL(self);
+
+/// @brief Returns a `CnxForwardIterator(Ref(u32))` at the first code point of the given
+/// `CnxCodePointIterator`, restarting it at the beginning of its input
+///
+/// @param self - The `CnxCodePointIterator` to iterate over
+///
+/// @return a `CnxForwardIterator(Ref(u32))` at the first code point
+/// @ingroup cnx_utf8
+__attr(nodiscard) __attr(not_null(1)) CnxForwardIterator(Ref(u32))
+	cnx_code_point_iterator_begin(CnxCodePointIterator* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns a `CnxForwardIterator(Ref(u32))` at the end of the iteration of the given
+/// `CnxCodePointIterator`
+///
+/// @param self - The `CnxCodePointIterator` to iterate over
+///
+/// @return a `CnxForwardIterator(Ref(u32))` at the end of the iteration
+/// @ingroup cnx_utf8
+__attr(nodiscard) __attr(not_null(1)) CnxForwardIterator(Ref(u32))
+	cnx_code_point_iterator_end(CnxCodePointIterator* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns a `CnxForwardIterator(ConstRef(u32))` at the first code point of the given
+/// `CnxCodePointIterator`, restarting it at the beginning of its input
+///
+/// @param self - The `CnxCodePointIterator` to iterate over
+///
+/// @return a `CnxForwardIterator(ConstRef(u32))` at the first code point
+/// @ingroup cnx_utf8
+__attr(nodiscard) __attr(not_null(1)) CnxForwardIterator(ConstRef(u32))
+	cnx_code_point_iterator_cbegin(CnxCodePointIterator* restrict self) ___DISABLE_IF_NULL(self);
+
+/// @brief Returns a `CnxForwardIterator(ConstRef(u32))` at the end of the iteration of the given
+/// `CnxCodePointIterator`
+///
+/// @param self - The `CnxCodePointIterator` to iterate over
+///
+/// @return a `CnxForwardIterator(ConstRef(u32))` at the end of the iteration
+/// @ingroup cnx_utf8
+__attr(nodiscard) __attr(not_null(1)) CnxForwardIterator(ConstRef(u32))
+	cnx_code_point_iterator_cend(CnxCodePointIterator* restrict self) ___DISABLE_IF_NULL(self);
+
+#undef ___DISABLE_IF_NULL
+
+typedef struct cnx_code_point_iterator_vtable_t {
+	/// @brief Returns a `CnxForwardIterator(Ref(u32))` at the first code point of the
+	/// `CnxCodePointIterator`
+	CnxForwardIterator(Ref(u32)) (*const begin)(CnxCodePointIterator* restrict self);
+	/// @brief Returns a `CnxForwardIterator(Ref(u32))` at the end of the iteration of the
+	/// `CnxCodePointIterator`
+	CnxForwardIterator(Ref(u32)) (*const end)(CnxCodePointIterator* restrict self);
+	/// @brief Returns a `CnxForwardIterator(ConstRef(u32))` at the first code point of the
+	/// `CnxCodePointIterator`
+	CnxForwardIterator(ConstRef(u32)) (*const cbegin)(CnxCodePointIterator* restrict self);
+	/// @brief Returns a `CnxForwardIterator(ConstRef(u32))` at the end of the iteration of the
+	/// `CnxCodePointIterator`
+	CnxForwardIterator(ConstRef(u32)) (*const cend)(CnxCodePointIterator* restrict self);
+} cnx_code_point_iterator_vtable_t;
+
+/// @brief Advances the given `CnxCodePointIterator` to its next code point
+///
+/// @param self - The `CnxCodePointIterator` to advance
+///
+/// @return `Some` next code point, or `None` if all code points have been yielded
+/// @ingroup cnx_utf8
+#define cnx_code_point_iterator_next(self) cnx_code_point_iterator_next(&(self))
+/// @brief Returns the portion of the input the given `CnxCodePointIterator` hasn't decoded yet
+///
+/// @param self - The `CnxCodePointIterator` to get the remainder of
+///
+/// @return a view of the undecoded input
+/// @ingroup cnx_utf8
+#define cnx_code_point_iterator_remainder(self) cnx_code_point_iterator_remainder(&(self))
+/// @brief Restarts the given `CnxCodePointIterator` at the beginning of its input
+///
+/// @param self - The `CnxCodePointIterator` to reset
+/// @ingroup cnx_utf8
+#define cnx_code_point_iterator_reset(self) cnx_code_point_iterator_reset(&(self))
+/// @brief Returns a `CnxForwardIterator(Ref(u32))` at the first code point of the given
+/// `CnxCodePointIterator`
+///
+/// @param self - The `CnxCodePointIterator` to iterate over
+///
+/// @return a `CnxForwardIterator(Ref(u32))` at the first code point
+/// @ingroup cnx_utf8
+#define cnx_code_point_iterator_begin(self) cnx_code_point_iterator_begin(&(self))
+/// @brief Returns a `CnxForwardIterator(Ref(u32))` at the end of the iteration of the given
+/// `CnxCodePointIterator`
+///
+/// @param self - The `CnxCodePointIterator` to iterate over
+///
+/// @return a `CnxForwardIterator(Ref(u32))` at the end of the iteration
+/// @ingroup cnx_utf8
+#define cnx_code_point_iterator_end(self) cnx_code_point_iterator_end(&(self))
+
+/// @brief Returns whether the given `CnxStringView` contains only ASCII
+///
+/// @param self - The `CnxStringView` to check
+///
+/// @return whether `self` contains only ASCII
+/// @ingroup cnx_utf8
+#define cnx_stringview_is_ascii(self) cnx_utf8_is_ascii((self).m_view, (self).m_length)
+/// @brief Returns whether the given `CnxStringView` is well-formed UTF-8
+///
+/// @param self - The `CnxStringView` to validate
+///
+/// @return whether `self` is valid UTF-8
+/// @ingroup cnx_utf8
+#define cnx_stringview_is_valid_utf8(self) cnx_utf8_validate((self).m_view, (self).m_length)
+/// @brief Returns a `CnxCodePointIterator` over the code points of the given `CnxStringView`
+///
+/// @param self - The `CnxStringView` to decode
+///
+/// @return a `CnxCodePointIterator` over `self`
+/// @ingroup cnx_utf8
+#define cnx_stringview_code_points(self) cnx_code_point_iterator_new(self)
+
+/// @brief Returns whether the given `CnxString` contains only ASCII
+///
+/// @param self - The `CnxString` to check
+///
+/// @return whether `self` contains only ASCII
+/// @ingroup cnx_utf8
+#define cnx_string_is_ascii(self) \
+	cnx_utf8_is_ascii(cnx_string_into_cstring(self), cnx_string_length(self))
+/// @brief Returns whether the given `CnxString` is well-formed UTF-8
+///
+/// @param self - The `CnxString` to validate
+///
+/// @return whether `self` is valid UTF-8
+/// @ingroup cnx_utf8
+#define cnx_string_is_valid_utf8(self) \
+	cnx_utf8_validate(cnx_string_into_cstring(self), cnx_string_length(self))
+/// @brief Returns a `CnxCodePointIterator` over the code points of the given `CnxString`
+///
+/// @param self - The `CnxString` to decode
+///
+/// @return a `CnxCodePointIterator` over `self`
+/// @ingroup cnx_utf8
+#define cnx_string_code_points(self) cnx_code_point_iterator_new(cnx_stringview_new(&(self)))
+
+#endif // CNX_UTF8
@@ -101,6 +101,14 @@
 /// `VECTOR_SMALL_OPT_CAPACITY` is defaulted or provided as greater than 0, this will not be used.
 /// Heap allocations occurring after size exceeds whichever of the two possible initial storage
 /// strategies are used will follow the growth strategy of the collection.
+/// 4. `VECTOR_TRIVIAL` - Defining this to true asserts that `VECTOR_T` is trivially
+/// default-constructible (all-zero bits), copyable (`memcpy`-able), and destructible (needs no
+/// cleanup). Element construction, copying, and destruction then compile down to `memset`,
+/// `memcpy`, and no-ops respectively (eg, `cnx_vector_clone` becomes a single `memcpy` and
+/// `cnx_vector_clear` no longer visits each element), and any user-defined element
+/// constructors/destructors in `CnxCollectionData` are ignored. This is optional, and only needs to
+/// be provided when instantiating the definitions (`VECTOR_IMPL`). Without it, the same fast paths
+/// are still taken at runtime for vectors using the default `CnxCollectionData`.
 ///
 /// Example of (1).
 ///
@@ -453,6 +461,7 @@
 #if VECTOR_UNDEF_PARAMS
 	#undef VECTOR_T
 	#undef VECTOR_SMALL_OPT_CAPACITY
+	#undef VECTOR_TRIVIAL
 	#undef VECTOR_DECL
 	#undef VECTOR_IMPL
 #endif // VECTOR_UNDEF_PARAMS
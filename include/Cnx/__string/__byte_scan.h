@@ -0,0 +1,167 @@
+/// @file __byte_scan.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Internal SIMD byte-scanning kernels used by the string and filesystem modules
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef __CNX_BYTE_SCAN
+#define __CNX_BYTE_SCAN
+
+#include <Cnx/BasicTypes.h>
+#include <Cnx/Def.h>
+
+// The kernels in this file scan raw byte ranges and are used internally to implement `CnxString`,
+// `CnxSplitIterator`, `CnxPath`, and the ASCII string transforms. Each has AVX2 and SSE2 (or
+// SSSE3, where byte shuffles are required) variants on x86_64, selected at runtime, and a
+// portable scalar variant for other targets. Functions that find a byte return the index of the first matching byte, or
+// `length` if there is none.
+
+/// @brief A set of bytes to search for with `cnx_byte_scan_find_any_of`
+///
+/// Membership is stored both as a 256-bit bitmap, for scalar lookups, and as a pair of nibble
+/// lookup tables for vectorized lookups: byte `b` is in the set iff
+/// `m_low_nibble_tables[b >> 7][b & 0xF]` has bit `(b >> 4) & 0x7` set.
+typedef struct CnxByteSet {
+	/// @brief Bitmap of the bytes in the set
+	u64 m_bitmap[4]; // NOLINT
+	/// @brief Low-nibble lookup tables for bytes `< 0x80` and `>= 0x80`, respectively
+	u8 m_low_nibble_tables[2][16]; // NOLINT
+} CnxByteSet;
+
+/// @brief Creates a `CnxByteSet` containing the given bytes
+///
+/// @param bytes - The bytes to include in the set
+/// @param length - The number of bytes in `bytes`
+///
+/// @return a `CnxByteSet` containing exactly the given bytes
+__attr(nodiscard) CnxByteSet cnx_byte_set_new(restrict const_cstring bytes, usize length);
+
+/// @brief Returns whether the given `CnxByteSet` contains `byte`
+///
+/// @param self - The `CnxByteSet` to check
+/// @param byte - The byte to check for
+///
+/// @return whether `byte` is in `self`
+__attr(always_inline) __attr(nodiscard) __attr(not_null(1)) static inline bool
+	cnx_byte_set_contains(const CnxByteSet* restrict self, char byte) {
+	let index = static_cast(u8)(byte);
+	return (self->m_bitmap[index / 64U] >> (index % 64U)) & 1U;
+}
+
+/// @brief Counts the occurrences of `byte` in `data`
+///
+/// @param data - The bytes to scan
+/// @param length - The number of bytes in `data`
+/// @param byte - The byte to count
+///
+/// @return the number of occurrences of `byte` in `data`
+__attr(nodiscard) usize cnx_byte_scan_count(restrict const_cstring data, usize length, char byte);
+
+/// @brief Finds the first occurrence of `byte` in `data`
+///
+/// @param data - The bytes to scan
+/// @param length - The number of bytes in `data`
+/// @param byte - The byte to find
+///
+/// @return the index of the first occurrence of `byte`, or `length` if there is none
+__attr(nodiscard) usize cnx_byte_scan_find(restrict const_cstring data, usize length, char byte);
+
+/// @brief Finds the first byte in `data` that's a member of `set`
+///
+/// @param data - The bytes to scan
+/// @param length - The number of bytes in `data`
+/// @param set - The set of bytes to find
+///
+/// @return the index of the first byte in `set`, or `length` if there is none
+__attr(nodiscard) __attr(not_null(3)) usize
+	cnx_byte_scan_find_any_of(restrict const_cstring data,
+							  usize length,
+							  const CnxByteSet* restrict set);
+
+/// @brief Finds the first non-ASCII byte (a byte `>= 0x80`) in `data`
+///
+/// @param data - The bytes to scan
+/// @param length - The number of bytes in `data`
+///
+/// @return the index of the first non-ASCII byte, or `length` if there is none
+__attr(nodiscard) usize cnx_byte_scan_find_non_ascii(restrict const_cstring data, usize length);
+
+/// @brief Finds the first ASCII whitespace byte (`' '`, `'\t'`, `'\n'`, `'\v'`, `'\f'`, or
+/// `'\r'`) in `data`
+///
+/// @param data - The bytes to scan
+/// @param length - The number of bytes in `data`
+///
+/// @return the index of the first whitespace byte, or `length` if there is none
+__attr(nodiscard) usize cnx_byte_scan_find_whitespace(restrict const_cstring data, usize length);
+
+/// @brief Finds the first byte in `data` that isn't ASCII whitespace
+///
+/// @param data - The bytes to scan
+/// @param length - The number of bytes in `data`
+///
+/// @return the index of the first non-whitespace byte, or `length` if there is none
+__attr(nodiscard) usize
+	cnx_byte_scan_find_non_whitespace(restrict const_cstring data, usize length);
+
+/// @brief Finds the last byte in `data` that isn't ASCII whitespace
+///
+/// @param data - The bytes to scan
+/// @param length - The number of bytes in `data`
+///
+/// @return the index of the last non-whitespace byte, or `length` if there is none
+__attr(nodiscard) usize
+	cnx_byte_scan_rfind_non_whitespace(restrict const_cstring data, usize length);
+
+/// @brief Converts the ASCII uppercase letters in `data` to lowercase, writing the result to `out`.
+/// All other bytes are copied unchanged
+///
+/// @param data - The bytes to convert
+/// @param length - The number of bytes in `data`
+/// @param out - The buffer to write the result to. Must have room for `length` bytes. May be
+/// `data`, to convert in place
+__attr(not_null(3)) void cnx_byte_scan_to_lower(const_cstring data, usize length, char* out);
+
+/// @brief Converts the ASCII lowercase letters in `data` to uppercase, writing the result to `out`.
+/// All other bytes are copied unchanged
+///
+/// @param data - The bytes to convert
+/// @param length - The number of bytes in `data`
+/// @param out - The buffer to write the result to. Must have room for `length` bytes. May be
+/// `data`, to convert in place
+__attr(not_null(3)) void cnx_byte_scan_to_upper(const_cstring data, usize length, char* out);
+
+/// @brief Returns whether the given byte ranges are equal, ignoring ASCII case
+///
+/// @param lhs - The first bytes to compare
+/// @param rhs - The second bytes to compare
+/// @param length - The number of bytes in each of `lhs` and `rhs`
+///
+/// @return whether `lhs` and `rhs` are equal, ignoring ASCII case
+__attr(nodiscard) bool cnx_byte_scan_equal_ignore_case(restrict const_cstring lhs,
+													   restrict const_cstring rhs,
+													   usize length);
+
+#endif // __CNX_BYTE_SCAN
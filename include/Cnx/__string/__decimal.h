@@ -0,0 +1,127 @@
+/// @file __decimal.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Internal decimal number parsing and formatting used by the text format modules
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef __CNX_DECIMAL
+#define __CNX_DECIMAL
+
+#include <Cnx/BasicTypes.h>
+#include <Cnx/Def.h>
+#define RESULT_INCLUDE_DEFAULT_INSTANTIATIONS TRUE
+#include <Cnx/Result.h>
+#undef RESULT_INCLUDE_DEFAULT_INSTANTIATIONS
+#include <memory.h>
+
+// The functions in this file parse and format numbers as decimal text. They're used internally to
+// implement the typed fields of `CnxCsvReader` and `CnxCsvWriter` and the numbers of
+// `CnxJsonWriter` and the JSON parser. Parsing functions require the entire given text to be the
+// number: they don't skip whitespace or stop at trailing characters, and they report `EINVAL` if
+// the text isn't a number and `ERANGE` if it's out of range of the result type.
+
+/// @brief The number of characters needed to format any `i64` or `u64` in decimal
+#define CNX_DECIMAL_MAX_INTEGER_LENGTH (static_cast(usize)(20U))
+
+/// @brief The number of characters needed to format any `f64` with `cnx_decimal_format_f64`
+#define CNX_DECIMAL_MAX_FLOAT_LENGTH (static_cast(usize)(32U))
+
+/// @brief The bits of an `f64`'s exponent, which are all set for infinities and NaN
+#define CNX_DECIMAL_F64_EXPONENT_BITS (static_cast(u64)(0x7FF0000000000000ULL))
+
+/// @brief Returns whether the given `f64` is finite (neither an infinity nor NaN)
+///
+/// This examines the bits of `value` directly, because release builds compile with
+/// `-ffast-math`, which assumes values are finite and folds `isfinite` and `isinf` away.
+///
+/// @param value - The value to check
+///
+/// @return whether `value` is finite
+__attr(nodiscard) static inline bool cnx_decimal_is_finite(f64 value) {
+	u64 bits = 0;
+	memcpy(&bits, &value, sizeof(bits));
+	return (bits & CNX_DECIMAL_F64_EXPONENT_BITS) != CNX_DECIMAL_F64_EXPONENT_BITS;
+}
+
+/// @brief Parses the given decimal digits, with no sign, as a `u64`
+///
+/// @param digits - The digits to parse
+/// @param length - The number of characters in `digits`
+///
+/// @return the parsed value, or an error: `EINVAL` if `digits` is empty or contains a character
+/// other than `'0'` through `'9'`, or `ERANGE` if the value doesn't fit in a `u64`
+__attr(nodiscard) CnxResult(u64)
+	cnx_decimal_parse_u64(restrict const_cstring digits, usize length);
+
+/// @brief Parses the given decimal digits, with no sign, as the magnitude of an `i64`
+///
+/// @param digits - The digits to parse
+/// @param length - The number of characters in `digits`
+/// @param negative - Whether the value is negative
+///
+/// @return the parsed value, or an error: `EINVAL` if `digits` is empty or contains a character
+/// other than `'0'` through `'9'`, or `ERANGE` if the value doesn't fit in an `i64`
+__attr(nodiscard) CnxResult(i64)
+	cnx_decimal_parse_i64(restrict const_cstring digits, usize length, bool negative);
+
+/// @brief Parses the given text as an `f64`, in any form accepted by `strtod`
+///
+/// @param text - The text to parse. It doesn't need to be null-terminated
+/// @param length - The number of characters in `text`
+///
+/// @return the parsed value, or an error: `EINVAL` if `text` isn't entirely a number, or `ERANGE`
+/// if the value's magnitude is too large for an `f64`. Values too small for an `f64` are rounded
+/// to the nearest representable value, as `strtod` does
+__attr(nodiscard) CnxResult(f64) cnx_decimal_parse_f64(restrict const_cstring text, usize length);
+
+/// @brief Formats the given `i64` in decimal
+///
+/// @param value - The value to format
+/// @param out - The buffer to write to. Must have room for `CNX_DECIMAL_MAX_INTEGER_LENGTH`
+/// characters
+///
+/// @return the number of characters written
+__attr(not_null(2)) usize cnx_decimal_format_i64(i64 value, char* restrict out);
+
+/// @brief Formats the given `u64` in decimal
+///
+/// @param value - The value to format
+/// @param out - The buffer to write to. Must have room for `CNX_DECIMAL_MAX_INTEGER_LENGTH`
+/// characters
+///
+/// @return the number of characters written
+__attr(not_null(2)) usize cnx_decimal_format_u64(u64 value, char* restrict out);
+
+/// @brief Formats the given `f64` with the fewest significant digits (at least 15) that parse
+/// back to exactly `value`
+///
+/// @param value - The value to format
+/// @param out - The buffer to write to. Must have room for `CNX_DECIMAL_MAX_FLOAT_LENGTH`
+/// characters
+///
+/// @return the number of characters written
+__attr(not_null(2)) usize cnx_decimal_format_f64(f64 value, char* restrict out);
+
+#endif // __CNX_DECIMAL
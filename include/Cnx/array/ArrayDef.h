@@ -29,6 +29,7 @@
 #define CNX_ARRAY_DEF
 
 #include <Cnx/Def.h>
+#include <Cnx/Span.h>
 
 /// @brief Macro alias for a `CnxArray(T, N)` containing up to `N` `T`s
 ///
@@ -249,6 +250,18 @@
 /// @return a const reference to the internal array
 /// @ingroup cnx_array
 #define cnx_array_data(self) *((self).m_vtable->data_const(&(self)))
+/// @brief Returns a `CnxSpan(T)` viewing the elements of the given `CnxArray(T, N)`
+///
+/// `CnxSpan(T)` must have been declared with `DeclCnxSpan(T)` (`<Cnx/Span.h>` does so for the
+/// builtin scalar types).
+///
+/// @param T - The element type of the `CnxArray(T, N)`
+/// @param self - The `CnxArray(T, N)` to view
+///
+/// @return a span viewing the elements of `self`
+/// @ingroup cnx_array
+#define cnx_array_as_span(T, self) \
+	cnx_span_new(T, &cnx_array_data_mut(self), cnx_array_size(self))
 /// @brief Returns whether the given `CnxArray(T, N)` is empty
 ///
 /// @param self - The `CnxArray(T, N)` to check for emptiness
@@ -38,6 +38,12 @@
 	#include <Cnx/array/ArrayDef.h>
 	#include <Cnx/option/OptionDef.h>
 
+	#if defined(ARRAY_TRIVIAL) && ARRAY_TRIVIAL
+		#define ___ARRAY_TRIVIAL TRUE
+	#else
+		#define ___ARRAY_TRIVIAL FALSE
+	#endif // defined(ARRAY_TRIVIAL) && ARRAY_TRIVIAL
+
 ARRAY_STATIC ARRAY_INLINE CnxArrayIterator(ARRAY_T, ARRAY_N)
 	CnxArrayIdentifier(ARRAY_T, ARRAY_N, iterator_new)(const CnxArray(ARRAY_T,
 																	  ARRAY_N) * restrict self);
@@ -194,6 +200,42 @@ static const struct CnxCollectionData(CnxArray(ARRAY_T, ARRAY_N))
 	   .m_copy_constructor = CnxArrayIdentifier(ARRAY_T, ARRAY_N, default_copy_constructor),
 	   .m_destructor = CnxArrayIdentifier(ARRAY_T, ARRAY_N, default_destructor)};
 
+/// Whether elements of `self` can be default constructed by zeroing their memory. This is true if
+/// `ARRAY_TRIVIAL` was set for this instantiation, or `self` uses the default element constructor
+__attr(always_inline) static inline bool
+	CnxArrayIdentifier(ARRAY_T, ARRAY_N, is_trivially_constructible)(
+		const CnxArray(ARRAY_T, ARRAY_N) * restrict self) {
+	return ___ARRAY_TRIVIAL
+		   || self->m_data->m_constructor
+				  == CnxArrayIdentifier(ARRAY_T, ARRAY_N, default_constructor);
+}
+
+/// Whether elements of `self` can be copied with `memcpy`. This is true if `ARRAY_TRIVIAL` was
+/// set for this instantiation, or `self` uses the default element copy constructor
+__attr(always_inline) static inline bool
+	CnxArrayIdentifier(ARRAY_T, ARRAY_N, is_trivially_copyable)(
+		const CnxArray(ARRAY_T, ARRAY_N) * restrict self) {
+	return ___ARRAY_TRIVIAL
+		   || self->m_data->m_copy_constructor
+				  == CnxArrayIdentifier(ARRAY_T, ARRAY_N, default_copy_constructor);
+}
+
+/// Destroys the elements of `self` in `[begin, end)`, unless `ARRAY_TRIVIAL` was set for this
+/// instantiation or `self` uses the default element destructor
+__attr(always_inline) static inline void
+	CnxArrayIdentifier(ARRAY_T, ARRAY_N, destroy_range)(CnxArray(ARRAY_T, ARRAY_N) * restrict self,
+														usize begin,
+														usize end) {
+	if(!___ARRAY_TRIVIAL
+	   && self->m_data->m_destructor != CnxArrayIdentifier(ARRAY_T, ARRAY_N, default_destructor))
+	{
+		let destructor = self->m_data->m_destructor;
+		for(let_mut i = begin; i < end; ++i) {
+			destructor(&cnx_array_at_mut(*self, i), self->m_allocator);
+		}
+	}
+}
+
 ARRAY_STATIC ARRAY_INLINE CnxArray(ARRAY_T, ARRAY_N)
 	CnxArrayIdentifier(ARRAY_T, ARRAY_N, new)(void) {
 	return cnx_array_new_with_allocator_and_collection_data(
@@ -243,10 +285,19 @@ ARRAY_STATIC ARRAY_INLINE CnxArray(ARRAY_T, ARRAY_N)
 			   "Can't clone a `CnxArray(ARRAY_T, ARRAY_N)` with elements that aren't copyable (no "
 			   "element copy-constructor defined)");
 
-	let_mut array = cnx_array_new_with_collection_data(ARRAY_T, ARRAY_N, self->m_data);
+	let_mut array = cnx_array_new_with_allocator_and_collection_data(ARRAY_T,
+																	 ARRAY_N,
+																	 self->m_allocator,
+																	 self->m_data);
 
-	foreach_ref(elem, *self) {
-		cnx_array_push_back(array, self->m_data->m_copy_constructor(elem, self->m_allocator));
+	if(CnxArrayIdentifier(ARRAY_T, ARRAY_N, is_trivially_copyable)(self)) {
+		cnx_memcpy(ARRAY_T, array.m_array, self->m_array, self->m_size);
+		array.m_size = self->m_size;
+	}
+	else {
+		foreach_ref(elem, *self) {
+			cnx_array_push_back(array, self->m_data->m_copy_constructor(elem, self->m_allocator));
+		}
 	}
 
 	return array;
@@ -328,17 +379,20 @@ ARRAY_STATIC ARRAY_INLINE void
 CnxArrayIdentifier(ARRAY_T, ARRAY_N, resize_internal)(CnxArray(ARRAY_T, ARRAY_N) * restrict self,
 													  usize new_size) {
 	if(new_size < self->m_size) {
-		for(let_mut i = new_size; i < self->m_size; ++i) {
-			self->m_data->m_destructor(&cnx_array_at_mut(*self, i), self->m_allocator);
-		}
+		CnxArrayIdentifier(ARRAY_T, ARRAY_N, destroy_range)(self, new_size, self->m_size);
 		self->m_size = new_size;
 	}
 	else {
 		let old_size = self->m_size;
 		self->m_size = new_size;
-		// cast away const for GCC compat
-		for(let_mut i = const_cast(usize)(old_size); i < new_size; ++i) {
-			cnx_array_at_mut(*self, i) = self->m_data->m_constructor(self->m_allocator);
+		if(CnxArrayIdentifier(ARRAY_T, ARRAY_N, is_trivially_constructible)(self)) {
+			cnx_memset(ARRAY_T, &self->m_array[old_size], 0, new_size - old_size);
+		}
+		else {
+			// cast away const for GCC compat
+			for(let_mut i = const_cast(usize)(old_size); i < new_size; ++i) {
+				cnx_array_at_mut(*self, i) = self->m_data->m_constructor(self->m_allocator);
+			}
 		}
 	}
 }
@@ -352,9 +406,7 @@ CnxArrayIdentifier(ARRAY_T, ARRAY_N, resize)(CnxArray(ARRAY_T, ARRAY_N) * restri
 
 ARRAY_STATIC ARRAY_INLINE void
 CnxArrayIdentifier(ARRAY_T, ARRAY_N, clear)(CnxArray(ARRAY_T, ARRAY_N) * restrict self) {
-	for(let_mut i = 0U; i < self->m_size; ++i) {
-		self->m_data->m_destructor(&cnx_array_at_mut(*self, i), self->m_allocator);
-	}
+	CnxArrayIdentifier(ARRAY_T, ARRAY_N, destroy_range)(self, 0U, self->m_size);
 	self->m_size = 0;
 }
 
@@ -432,9 +484,7 @@ CnxArrayIdentifier(ARRAY_T, ARRAY_N, erase_n)(CnxArray(ARRAY_T, ARRAY_N) * restr
 
 	let end = index + length;
 	let num_to_move = self->m_size - end;
-	for(let_mut i = index; i < end; ++i) {
-		self->m_data->m_destructor(&cnx_array_at_mut(*self, i), self->m_allocator);
-	}
+	CnxArrayIdentifier(ARRAY_T, ARRAY_N, destroy_range)(self, index, end);
 	if(end != self->m_size) {
 		cnx_memmove(ARRAY_T,
 					&cnx_array_at_mut(*self, index),
@@ -446,9 +496,7 @@ CnxArrayIdentifier(ARRAY_T, ARRAY_N, erase_n)(CnxArray(ARRAY_T, ARRAY_N) * restr
 
 ARRAY_STATIC ARRAY_INLINE void CnxArrayIdentifier(ARRAY_T, ARRAY_N, free)(void* restrict self) {
 	let self_ = static_cast(CnxArray(ARRAY_T, ARRAY_N)*)(self);
-	for(let_mut i = 0U; i < self_->m_size; ++i) {
-		self_->m_data->m_destructor(&cnx_array_at_mut(*self_, i), self_->m_allocator);
-	}
+	CnxArrayIdentifier(ARRAY_T, ARRAY_N, destroy_range)(self_, 0U, self_->m_size);
 	self_->m_size = 0;
 }
 
@@ -757,5 +805,6 @@ ARRAY_STATIC ARRAY_INLINE CnxString CnxArrayIdentifier(ARRAY_T, ARRAY_N, format_
 		as_format_t(nullptr_t, data));
 }
 
+	#undef ___ARRAY_TRIVIAL
 	#undef CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
 #endif // defined(ARRAY_T) && defined(ARRAY_N) && ARRAY_IMPL
@@ -0,0 +1,304 @@
+/// @file BTreeMapDecl.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides the type and function declarations for a template
+/// instantiation of `CnxBTreeMap(K, V)`
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <Cnx/Def.h>
+
+#if defined(BTREE_MAP_K) && defined(BTREE_MAP_V) && defined(BTREE_MAP_NODE_SIZE) && BTREE_MAP_DECL
+
+	#include <Cnx/btree_map/BTreeMapDef.h>
+
+typedef struct CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V) {
+	BTREE_MAP_K m_key;
+	BTREE_MAP_V m_value;
+}
+CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V);
+
+typedef CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V)* Ref(CnxBTreeMapEntry(BTREE_MAP_K,
+																		 BTREE_MAP_V));
+typedef const CnxBTreeMapEntry(BTREE_MAP_K,
+							   BTREE_MAP_V)* ConstRef(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V));
+
+	#define COLLECTION_DATA_ELEMENT	   CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V)
+	#define COLLECTION_DATA_COLLECTION CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)
+	#include <Cnx/CollectionData.h>
+	#undef COLLECTION_DATA_COLLECTION
+	#undef COLLECTION_DATA_ELEMENT
+
+	#define CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS TRUE
+
+	#include <Cnx/Allocators.h>
+	#include <Cnx/BasicTypes.h>
+	#include <Cnx/Iterator.h>
+	#include <Cnx/Platform.h>
+
+DeclCnxIterators(Ref(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V)));
+DeclCnxIterators(ConstRef(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V)));
+
+/// The header common to both leaf and internal nodes. `m_size` is the number of entries held by a
+/// leaf, or the number of keys (one less than the number of children) held by an internal node
+typedef struct CnxBTreeMapNode(BTREE_MAP_K, BTREE_MAP_V) {
+	u32 m_size;
+	bool m_is_leaf;
+}
+CnxBTreeMapNode(BTREE_MAP_K, BTREE_MAP_V);
+
+// Node capacities are derived from the node size so that each node spans a fixed number of cache
+// lines: leaves are entries plus the header and sibling link, internal nodes are keys and child
+// pointers plus the header
+enum {
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, leaf_capacity)
+	= (BTREE_MAP_NODE_SIZE - sizeof(CnxBTreeMapNode(BTREE_MAP_K, BTREE_MAP_V)) - sizeof(void*))
+				  / sizeof(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V))
+			  > CNX_BTREE_MAP_MIN_NODE_CAPACITY ?
+		  (BTREE_MAP_NODE_SIZE - sizeof(CnxBTreeMapNode(BTREE_MAP_K, BTREE_MAP_V)) - sizeof(void*))
+			  / sizeof(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V)) :
+		  CNX_BTREE_MAP_MIN_NODE_CAPACITY,
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, internal_capacity)
+	= (BTREE_MAP_NODE_SIZE - sizeof(CnxBTreeMapNode(BTREE_MAP_K, BTREE_MAP_V)) - sizeof(void*))
+				  / (sizeof(BTREE_MAP_K) + sizeof(void*))
+			  > CNX_BTREE_MAP_MIN_NODE_CAPACITY ?
+		  (BTREE_MAP_NODE_SIZE - sizeof(CnxBTreeMapNode(BTREE_MAP_K, BTREE_MAP_V)) - sizeof(void*))
+			  / (sizeof(BTREE_MAP_K) + sizeof(void*)) :
+		  CNX_BTREE_MAP_MIN_NODE_CAPACITY,
+};
+
+typedef struct CnxBTreeMapLeaf(BTREE_MAP_K, BTREE_MAP_V) {
+	CnxBTreeMapNode(BTREE_MAP_K, BTREE_MAP_V) m_node;
+	struct CnxBTreeMapLeaf(BTREE_MAP_K, BTREE_MAP_V) * m_next;
+	CnxBTreeMapEntry(BTREE_MAP_K,
+					 BTREE_MAP_V) m_entries[CnxBTreeMapIdentifier(BTREE_MAP_K,
+																  BTREE_MAP_V,
+																  leaf_capacity)];
+}
+CnxBTreeMapLeaf(BTREE_MAP_K, BTREE_MAP_V);
+
+typedef struct CnxBTreeMapInternal(BTREE_MAP_K, BTREE_MAP_V) {
+	CnxBTreeMapNode(BTREE_MAP_K, BTREE_MAP_V) m_node;
+	BTREE_MAP_K m_keys[CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, internal_capacity)];
+	CnxBTreeMapNode(BTREE_MAP_K, BTREE_MAP_V)
+		* m_children[CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, internal_capacity) + 1];
+}
+CnxBTreeMapInternal(BTREE_MAP_K, BTREE_MAP_V);
+
+typedef struct CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, vtable)
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, vtable);
+
+typedef struct CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) {
+	CnxBTreeMapNode(BTREE_MAP_K, BTREE_MAP_V) * m_root;
+	usize m_size;
+	CnxAllocator m_allocator;
+	const CnxCollectionData(CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)) * m_data;
+	const CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, vtable) * m_vtable;
+}
+CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V);
+
+typedef struct CnxBTreeMapIterator(BTREE_MAP_K, BTREE_MAP_V) {
+	CnxBTreeMapLeaf(BTREE_MAP_K, BTREE_MAP_V) * m_leaf;
+	usize m_index;
+}
+CnxBTreeMapIterator(BTREE_MAP_K, BTREE_MAP_V);
+
+__attr(nodiscard) BTREE_MAP_STATIC BTREE_MAP_INLINE CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, new)(void);
+__attr(nodiscard) BTREE_MAP_STATIC BTREE_MAP_INLINE CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, new_with_allocator)(CnxAllocator allocator);
+__attr(nodiscard) __attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE
+	CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)
+		CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, new_with_collection_data)(
+			const CnxCollectionData(CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)) * restrict data)
+			cnx_disable_if(!data,
+						   "Can't create a CnxBTreeMap(K, V) with null CnxCollectionData. To "
+						   "create a CnxBTreeMap(K, V) with defaulted CnxCollectionData, use "
+						   "cnx_btree_map_new()");
+__attr(nodiscard) __attr(not_null(2)) BTREE_MAP_STATIC BTREE_MAP_INLINE
+	CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)
+		CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, new_with_allocator_and_collection_data)(
+			CnxAllocator allocator,
+			const CnxCollectionData(CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)) * restrict data)
+			cnx_disable_if(!data,
+						   "Can't create a CnxBTreeMap(K, V) with null CnxCollectionData. To "
+						   "create a CnxBTreeMap(K, V) with a custom allocator and defaulted "
+						   "CnxCollectionData, use cnx_btree_map_new_with_allocator()");
+__attr(nodiscard) BTREE_MAP_STATIC BTREE_MAP_INLINE CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, from_sorted)(
+		CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V) * restrict entries,
+		usize num_entries);
+__attr(nodiscard) BTREE_MAP_STATIC BTREE_MAP_INLINE CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, from_sorted_with_allocator)(
+		CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V) * restrict entries,
+		usize num_entries,
+		CnxAllocator allocator);
+__attr(nodiscard) __attr(not_null(4)) BTREE_MAP_STATIC BTREE_MAP_INLINE
+	CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)
+		CnxBTreeMapIdentifier(BTREE_MAP_K,
+							  BTREE_MAP_V,
+							  from_sorted_with_allocator_and_collection_data)(
+			CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V) * restrict entries,
+			usize num_entries,
+			CnxAllocator allocator,
+			const CnxCollectionData(CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)) * restrict data)
+			cnx_disable_if(!data,
+						   "Can't create a CnxBTreeMap(K, V) with null CnxCollectionData. To "
+						   "bulk-load a CnxBTreeMap(K, V) with defaulted CnxCollectionData, use "
+						   "cnx_btree_map_from_sorted_with_allocator()");
+__attr(nodiscard) __attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE
+	CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)
+		CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, clone)(
+			const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self)
+			cnx_disable_if(!(self->m_data->m_copy_constructor),
+						   "Can't clone a CnxBTreeMap(K, V) with entries that aren't copyable (no "
+						   "entry copy constructor defined)");
+
+	#define ___DISABLE_IF_NULL(self) \
+		cnx_disable_if(!(self), "Can't perform an operation on a null btree map")
+
+__attr(nodiscard) __attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE usize
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, size)(
+		const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE bool
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, is_empty)(
+		const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE bool
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, contains)(
+		const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self,
+		BTREE_MAP_K key) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE const BTREE_MAP_V*
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, get_const)(
+		const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self,
+		BTREE_MAP_K key) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE BTREE_MAP_V*
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, get_mut)(
+		CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self,
+		BTREE_MAP_K key) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) __attr(returns_not_null) BTREE_MAP_STATIC BTREE_MAP_INLINE
+	const BTREE_MAP_V* CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, at_const)(
+		const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self,
+		BTREE_MAP_K key) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) __attr(returns_not_null) BTREE_MAP_STATIC BTREE_MAP_INLINE
+	BTREE_MAP_V* CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, at_mut)(
+		CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self,
+		BTREE_MAP_K key) ___DISABLE_IF_NULL(self);
+__attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE bool
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, insert)(
+		CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self,
+		BTREE_MAP_K key,
+		BTREE_MAP_V value) ___DISABLE_IF_NULL(self);
+__attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE bool
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, erase)(
+		CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self,
+		BTREE_MAP_K key) ___DISABLE_IF_NULL(self);
+__attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE void
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, clear)(
+		CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self) ___DISABLE_IF_NULL(self);
+__attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE void
+	CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, free)(void* restrict self)
+		___DISABLE_IF_NULL(self);
+
+DeclIntoCnxForwardIterator(CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V),
+						   Ref(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V)),
+						   CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, into_iter));
+DeclIntoCnxForwardIterator(CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V),
+						   ConstRef(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V)),
+						   CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, into_const_iter));
+
+__attr(nodiscard) __attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE
+	CnxForwardIterator(Ref(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V)))
+		CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, lower_bound)(
+			CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self,
+			BTREE_MAP_K key) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE
+	CnxForwardIterator(Ref(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V)))
+		CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, upper_bound)(
+			CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self,
+			BTREE_MAP_K key) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE
+	CnxForwardIterator(Ref(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V)))
+		CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, begin)(
+			CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE
+	CnxForwardIterator(Ref(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V)))
+		CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, end)(
+			CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE
+	CnxForwardIterator(ConstRef(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V)))
+		CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, cbegin)(
+			const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) BTREE_MAP_STATIC BTREE_MAP_INLINE
+	CnxForwardIterator(ConstRef(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V)))
+		CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, cend)(
+			const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) * restrict self) ___DISABLE_IF_NULL(self);
+
+typedef struct CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, vtable) {
+	CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V) (*const clone)(
+		const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self);
+	usize (*const size)(const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self);
+	bool (*const is_empty)(const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self);
+	bool (*const contains)(const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self,
+						   BTREE_MAP_K key);
+	const BTREE_MAP_V* (*const get_const)(
+		const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self,
+		BTREE_MAP_K key);
+	BTREE_MAP_V* (*const get_mut)(CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self,
+								  BTREE_MAP_K key);
+	const BTREE_MAP_V* (*const at_const)(
+		const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self,
+		BTREE_MAP_K key);
+	BTREE_MAP_V* (*const at_mut)(CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self,
+								 BTREE_MAP_K key);
+	bool (*const insert)(CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self,
+						 BTREE_MAP_K key,
+						 BTREE_MAP_V value);
+	bool (*const erase)(CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self, BTREE_MAP_K key);
+	void (*const clear)(CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self);
+	void (*const free)(void* restrict self);
+	CnxForwardIterator(Ref(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V))) (*const into_iter)(
+		const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self);
+	CnxForwardIterator(ConstRef(CnxBTreeMapEntry(BTREE_MAP_K,
+												 BTREE_MAP_V))) (*const into_const_iter)(
+		const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self);
+	CnxForwardIterator(Ref(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V))) (*const lower_bound)(
+		CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self,
+		BTREE_MAP_K key);
+	CnxForwardIterator(Ref(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V))) (*const upper_bound)(
+		CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self,
+		BTREE_MAP_K key);
+	CnxForwardIterator(Ref(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V))) (*const begin)(
+		CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self);
+	CnxForwardIterator(Ref(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V))) (*const end)(
+		CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self);
+	CnxForwardIterator(ConstRef(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V))) (*const cbegin)(
+		const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self);
+	CnxForwardIterator(ConstRef(CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V))) (*const cend)(
+		const CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)* restrict self);
+}
+CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, vtable);
+
+	#undef ___DISABLE_IF_NULL
+	#undef CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+#endif // defined(BTREE_MAP_K) && defined(BTREE_MAP_V) && defined(BTREE_MAP_NODE_SIZE) \
+	   // && BTREE_MAP_DECL
@@ -0,0 +1,365 @@
+/// @file BTreeMapDef.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides macro definitions for implementing and working with
+/// `CnxBTreeMap(K, V)`
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <Cnx/Def.h>
+#include <Cnx/Platform.h>
+
+#ifndef CNX_BTREE_MAP_DEF
+	#define CNX_BTREE_MAP_DEF
+
+	#define CnxBTreeMap(K, V)		  CONCAT4(CnxBTreeMap, K, _, V)
+	#define CnxBTreeMapEntry(K, V)	  CONCAT2(CnxBTreeMap(K, V), Entry)
+	#define CnxBTreeMapIterator(K, V) CONCAT2(CnxBTreeMap(K, V), Iterator)
+	#define CnxBTreeMapNode(K, V)	  CONCAT2(CnxBTreeMap(K, V), Node)
+	#define CnxBTreeMapLeaf(K, V)	  CONCAT2(CnxBTreeMap(K, V), Leaf)
+	#define CnxBTreeMapInternal(K, V) CONCAT2(CnxBTreeMap(K, V), Internal)
+	#define CnxBTreeMapIdentifier(K, V, Identifier) \
+		CONCAT4(cnx_btree_map_, K, CONCAT3(_, V, _), Identifier)
+
+	/// @brief The default target size, in bytes, of a single `CnxBTreeMap(K, V)` node.
+	///
+	/// Nodes span a small, fixed number of cache lines so that a node's keys can be searched
+	/// with a handful of cache misses, while still giving a wide fan-out (and thus a shallow
+	/// tree)
+	/// @ingroup cnx_btree_map
+	#define CNX_BTREE_MAP_DEFAULT_NODE_SIZE (4U * CNX_PLATFORM_CACHE_LINE_SIZE)
+
+	/// @brief The minimum number of entries (or keys, for internal nodes) a `CnxBTreeMap(K, V)`
+	/// node can hold, regardless of the configured node size
+	/// @ingroup cnx_btree_map
+	#define CNX_BTREE_MAP_MIN_NODE_CAPACITY 4U
+
+	/// @brief The maximum possible height of a `CnxBTreeMap(K, V)`.
+	///
+	/// Every non-root node holds at least two children, so a tree indexing a `usize` worth of
+	/// entries can never be taller than this
+	/// @ingroup cnx_btree_map
+	#define CNX_BTREE_MAP_MAX_HEIGHT 64U
+
+	/// @brief Creates a new `CnxBTreeMap(K, V)` with defaulted associated functions and
+	/// allocator
+	///
+	/// @param K - The key type of the map
+	/// @param V - The value type of the map
+	///
+	/// @return a new `CnxBTreeMap(K, V)`
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_new(K, V) CnxBTreeMapIdentifier(K, V, new)()
+	/// @brief Creates a new `CnxBTreeMap(K, V)` with defaulted associated functions that will
+	/// use the given allocator for all of its nodes
+	///
+	/// @param K - The key type of the map
+	/// @param V - The value type of the map
+	/// @param allocator - The `CnxAllocator` to allocate nodes with
+	///
+	/// @return a new `CnxBTreeMap(K, V)`
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_new_with_allocator(K, V, allocator) \
+		CnxBTreeMapIdentifier(K, V, new_with_allocator)(allocator)
+	/// @brief Creates a new `CnxBTreeMap(K, V)` with provided associated functions
+	///
+	/// @param K - The key type of the map
+	/// @param V - The value type of the map
+	/// @param collection_data_ptr - The `CnxCollectionData(CnxBTreeMap(K, V))*` containing the
+	/// associated functions for the entries of the map
+	///
+	/// @return a new `CnxBTreeMap(K, V)`
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_new_with_collection_data(K, V, collection_data_ptr) \
+		CnxBTreeMapIdentifier(K, V, new_with_collection_data)(collection_data_ptr)
+	/// @brief Creates a new `CnxBTreeMap(K, V)` with provided associated functions that will
+	/// use the given allocator for all of its nodes
+	///
+	/// @param K - The key type of the map
+	/// @param V - The value type of the map
+	/// @param allocator - The `CnxAllocator` to allocate nodes with
+	/// @param collection_data_ptr - The `CnxCollectionData(CnxBTreeMap(K, V))*` containing the
+	/// associated functions for the entries of the map
+	///
+	/// @return a new `CnxBTreeMap(K, V)`
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_new_with_allocator_and_collection_data(K,                   \
+																 V,                   \
+																 allocator,           \
+																 collection_data_ptr) \
+		CnxBTreeMapIdentifier(K, V, new_with_allocator_and_collection_data)(allocator,   \
+																			 collection_data_ptr)
+	/// @brief Creates a new `CnxBTreeMap(K, V)` by bulk-loading it from an array of entries
+	/// sorted in strictly ascending key order.
+	///
+	/// Bulk-loading builds the tree bottom-up in O(N), filling every node as densely as the
+	/// B-tree invariants allow. This is significantly faster than inserting the entries one at
+	/// a time and produces a tree with better cache utilization.
+	///
+	/// @param K - The key type of the map
+	/// @param V - The value type of the map
+	/// @param entries - Pointer to the first `CnxBTreeMapEntry(K, V)` to load
+	/// @param num_entries - The number of entries to load
+	///
+	/// @return a new `CnxBTreeMap(K, V)` containing the given entries
+	///
+	/// @note The entries are moved into the map (bitwise copied), so ownership of any resources
+	/// they hold transfers to the map
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_from_sorted(K, V, entries, num_entries) \
+		CnxBTreeMapIdentifier(K, V, from_sorted)((entries), (num_entries))
+	/// @brief Creates a new `CnxBTreeMap(K, V)` by bulk-loading it from an array of entries
+	/// sorted in strictly ascending key order, using the given allocator for all of its nodes
+	///
+	/// @param K - The key type of the map
+	/// @param V - The value type of the map
+	/// @param entries - Pointer to the first `CnxBTreeMapEntry(K, V)` to load
+	/// @param num_entries - The number of entries to load
+	/// @param allocator - The `CnxAllocator` to allocate nodes with
+	///
+	/// @return a new `CnxBTreeMap(K, V)` containing the given entries
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_from_sorted_with_allocator(K, V, entries, num_entries, allocator) \
+		CnxBTreeMapIdentifier(K, V, from_sorted_with_allocator)((entries),                 \
+															  (num_entries),             \
+															  (allocator))
+	/// @brief Creates a new `CnxBTreeMap(K, V)` by bulk-loading it from an array of entries
+	/// sorted in strictly ascending key order, using the given allocator and associated
+	/// functions
+	///
+	/// @param K - The key type of the map
+	/// @param V - The value type of the map
+	/// @param entries - Pointer to the first `CnxBTreeMapEntry(K, V)` to load
+	/// @param num_entries - The number of entries to load
+	/// @param allocator - The `CnxAllocator` to allocate nodes with
+	/// @param collection_data_ptr - The `CnxCollectionData(CnxBTreeMap(K, V))*` containing the
+	/// associated functions for the entries of the map
+	///
+	/// @return a new `CnxBTreeMap(K, V)` containing the given entries
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_from_sorted_with_allocator_and_collection_data(K,                   \
+																		 V,                   \
+																		 entries,             \
+																		 num_entries,         \
+																		 allocator,           \
+																		 collection_data_ptr) \
+		CnxBTreeMapIdentifier(K, V, from_sorted_with_allocator_and_collection_data)(          \
+			(entries),                                                                       \
+			(num_entries),                                                                   \
+			(allocator),                                                                     \
+			(collection_data_ptr))
+	/// @brief The size, in bytes, of a leaf node of a `CnxBTreeMap(K, V)`.
+	///
+	/// Every leaf allocation a `CnxBTreeMap(K, V)` makes is exactly this size, making it simple
+	/// to back the map with a fixed-size pool allocator
+	///
+	/// @param K - The key type of the map
+	/// @param V - The value type of the map
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_leaf_node_size(K, V) sizeof(CnxBTreeMapLeaf(K, V))
+	/// @brief The size, in bytes, of an internal node of a `CnxBTreeMap(K, V)`.
+	///
+	/// Every internal node allocation a `CnxBTreeMap(K, V)` makes is exactly this size, making it
+	/// simple to back the map with a fixed-size pool allocator
+	///
+	/// @param K - The key type of the map
+	/// @param V - The value type of the map
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_internal_node_size(K, V) sizeof(CnxBTreeMapInternal(K, V))
+	/// @brief Clones the given `CnxBTreeMap(K, V)`
+	///
+	/// Creates a deep copy of the given `CnxBTreeMap(K, V)` calling the associated copy
+	/// constructor for each entry stored in it.
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to clone
+	///
+	/// @return a clone of `self`
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_clone(self) (self).m_vtable->clone(&(self))
+	/// @brief Returns the number of entries in the given `CnxBTreeMap(K, V)`
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to get the size of
+	///
+	/// @return the number of entries in the map
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_size(self) (self).m_vtable->size(&(self))
+	/// @brief Returns whether the given `CnxBTreeMap(K, V)` is empty
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to check for emptiness
+	///
+	/// @return `true` if the map contains no entries, `false` otherwise
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_is_empty(self) (self).m_vtable->is_empty(&(self))
+	/// @brief Returns whether the given `CnxBTreeMap(K, V)` contains an entry for `key`
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to search
+	/// @param key - The key to search for
+	///
+	/// @return `true` if the map contains `key`, `false` otherwise
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_contains(self, key) (self).m_vtable->contains(&(self), (key))
+	/// @brief Returns a pointer to the value associated with `key` in the given
+	/// `CnxBTreeMap(K, V)`, or `nullptr` if the map doesn't contain `key`
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to search
+	/// @param key - The key to search for
+	///
+	/// @return a pointer to the value associated with `key`, or `nullptr`
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_get(self, key) (self).m_vtable->get_const(&(self), (key))
+	/// @brief Returns a mutable pointer to the value associated with `key` in the given
+	/// `CnxBTreeMap(K, V)`, or `nullptr` if the map doesn't contain `key`
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to search
+	/// @param key - The key to search for
+	///
+	/// @return a pointer to the value associated with `key`, or `nullptr`
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_get_mut(self, key) (self).m_vtable->get_mut(&(self), (key))
+	/// @brief Returns the value associated with `key` in the given `CnxBTreeMap(K, V)`
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to search
+	/// @param key - The key to get the value for
+	///
+	/// @return the value associated with `key`
+	/// @note the map must contain `key`
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_at(self, key) *((self).m_vtable->at_const(&(self), (key)))
+	/// @brief Returns the value associated with `key` in the given `CnxBTreeMap(K, V)`, as an
+	/// lvalue
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to search
+	/// @param key - The key to get the value for
+	///
+	/// @return the value associated with `key`
+	/// @note the map must contain `key`
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_at_mut(self, key) *((self).m_vtable->at_mut(&(self), (key)))
+	/// @brief Inserts the given key-value pair into the `CnxBTreeMap(K, V)`.
+	///
+	/// If the map already contains `key`, its entry is destroyed and replaced with the new one.
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to insert into
+	/// @param key - The key to insert
+	/// @param value - The value to associate with `key`
+	///
+	/// @return `true` if a new entry was created, `false` if an existing one was replaced
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_insert(self, key, value) \
+		(self).m_vtable->insert(&(self), (key), (value))
+	/// @brief Removes the entry for `key` from the given `CnxBTreeMap(K, V)`, if there is one
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to remove from
+	/// @param key - The key to remove
+	///
+	/// @return `true` if an entry was removed, `false` otherwise
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_erase(self, key) (self).m_vtable->erase(&(self), (key))
+	/// @brief Removes all entries from the given `CnxBTreeMap(K, V)`, freeing all of its nodes
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to clear
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_clear(self) (self).m_vtable->clear(&(self))
+	/// @brief Frees the given `CnxBTreeMap(K, V)`, calling the entry destructor on each entry
+	/// and freeing all allocated nodes
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to free
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_free(self) (self).m_vtable->free(&(self))
+	/// @brief Returns a `CnxForwardIterator` into the given `CnxBTreeMap(K, V)` positioned at the
+	/// first entry whose key is not less than `key`
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to search
+	/// @param key - The key to search for
+	///
+	/// @return an iterator at the lower bound of `key`, or the end iterator if there is none
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_lower_bound(self, key) (self).m_vtable->lower_bound(&(self), (key))
+	/// @brief Returns a `CnxForwardIterator` into the given `CnxBTreeMap(K, V)` positioned at the
+	/// first entry whose key is greater than `key`
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to search
+	/// @param key - The key to search for
+	///
+	/// @return an iterator at the upper bound of `key`, or the end iterator if there is none
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_upper_bound(self, key) (self).m_vtable->upper_bound(&(self), (key))
+	/// @brief Returns a `CnxForwardIterator` into the mutable iteration of the given
+	/// `CnxBTreeMap(K, V)`, starting at the entry with the smallest key
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to get an iterator to
+	///
+	/// @return a forward iterator at the beginning of the map
+	/// @note Keys must not be modified through the returned iterator
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_begin(self) (self).m_vtable->begin(&(self))
+	/// @brief Returns a `CnxForwardIterator` into the mutable iteration of the given
+	/// `CnxBTreeMap(K, V)`, positioned at the end of the iteration
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to get an iterator to
+	///
+	/// @return a forward iterator at the end of the map
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_end(self) (self).m_vtable->end(&(self))
+	/// @brief Returns a `CnxForwardIterator` into the const iteration of the given
+	/// `CnxBTreeMap(K, V)`, starting at the entry with the smallest key
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to get an iterator to
+	///
+	/// @return a forward iterator at the beginning of the map
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_cbegin(self) (self).m_vtable->cbegin(&(self))
+	/// @brief Returns a `CnxForwardIterator` into the const iteration of the given
+	/// `CnxBTreeMap(K, V)`, positioned at the end of the iteration
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to get an iterator to
+	///
+	/// @return a forward iterator at the end of the map
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_cend(self) (self).m_vtable->cend(&(self))
+	/// @brief Returns a `CnxForwardIterator` into the mutable iteration of the given
+	/// `CnxBTreeMap(K, V)`
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to get an iterator to
+	///
+	/// @return a forward iterator into the map
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_into_iter(self) (self).m_vtable->into_iter(&(self))
+	/// @brief Returns a `CnxForwardIterator` into the const iteration of the given
+	/// `CnxBTreeMap(K, V)`
+	///
+	/// @param self - The `CnxBTreeMap(K, V)` to get an iterator to
+	///
+	/// @return a forward iterator into the map
+	/// @ingroup cnx_btree_map
+	#define cnx_btree_map_into_const_iter(self) (self).m_vtable->into_const_iter(&(self))
+
+	/// @brief declare a `CnxBTreeMap(K, V)` variable with this attribute to have
+	/// `cnx_btree_map_free` automatically called on it at scope end
+	///
+	/// @param K - The key type of the `CnxBTreeMap(K, V)` instantiation
+	/// @param V - The value type of the `CnxBTreeMap(K, V)` instantiation
+	/// @ingroup cnx_btree_map
+	#define CnxScopedBTreeMap(K, V) scoped(CnxBTreeMapIdentifier(K, V, free))
+
+#endif // CNX_BTREE_MAP_DEF
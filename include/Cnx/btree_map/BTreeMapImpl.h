@@ -0,0 +1,1016 @@
+/// @file BTreeMapImpl.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides the function definitions for a template instantiation of
+/// `CnxBTreeMap(K, V)`
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <Cnx/Def.h>
+
+#if defined(BTREE_MAP_K) && defined(BTREE_MAP_V) && defined(BTREE_MAP_NODE_SIZE) && BTREE_MAP_IMPL
+
+	#define CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS TRUE
+
+	#include <Cnx/Allocators.h>
+	#include <Cnx/Assert.h>
+	#include <Cnx/BasicTypes.h>
+	#include <Cnx/CollectionData.h>
+	#include <Cnx/Iterator.h>
+	#include <Cnx/Platform.h>
+	#include <Cnx/btree_map/BTreeMapDef.h>
+
+	#define ___BTREE_MAP		  CnxBTreeMap(BTREE_MAP_K, BTREE_MAP_V)
+	#define ___BTREE_MAP_ENTRY	  CnxBTreeMapEntry(BTREE_MAP_K, BTREE_MAP_V)
+	#define ___BTREE_MAP_NODE	  CnxBTreeMapNode(BTREE_MAP_K, BTREE_MAP_V)
+	#define ___BTREE_MAP_LEAF	  CnxBTreeMapLeaf(BTREE_MAP_K, BTREE_MAP_V)
+	#define ___BTREE_MAP_INTERNAL CnxBTreeMapInternal(BTREE_MAP_K, BTREE_MAP_V)
+	#define ___BTREE_MAP_ITERATOR CnxBTreeMapIterator(BTREE_MAP_K, BTREE_MAP_V)
+	#define ___BTREE_MAP_IDENT(Identifier) \
+		CnxBTreeMapIdentifier(BTREE_MAP_K, BTREE_MAP_V, Identifier)
+	#define ___BTREE_MAP_LEAF_CAPACITY	   ___BTREE_MAP_IDENT(leaf_capacity)
+	#define ___BTREE_MAP_INTERNAL_CAPACITY ___BTREE_MAP_IDENT(internal_capacity)
+	#define ___BTREE_MAP_LEAF_MIN		   (___BTREE_MAP_LEAF_CAPACITY / 2U)
+	#define ___BTREE_MAP_INTERNAL_MIN	   (___BTREE_MAP_INTERNAL_CAPACITY / 2U)
+
+	#ifdef BTREE_MAP_COMPARE
+		#define ___BTREE_MAP_COMPARE(lhs, rhs) BTREE_MAP_COMPARE((lhs), (rhs))
+	#else
+
+__attr(always_inline) __attr(not_null(1, 2)) static inline i32
+	___BTREE_MAP_IDENT(default_compare)(const BTREE_MAP_K* restrict lhs,
+										const BTREE_MAP_K* restrict rhs) {
+	return static_cast(i32)(*lhs > *rhs) - static_cast(i32)(*lhs < *rhs);
+}
+
+		#define ___BTREE_MAP_COMPARE(lhs, rhs) ___BTREE_MAP_IDENT(default_compare)((lhs), (rhs))
+	#endif // BTREE_MAP_COMPARE
+
+/// A step in the root-to-leaf path taken by a mutating operation, recording the internal node
+/// passed through and the index of the child descended into
+typedef struct ___BTREE_MAP_IDENT(path_step) {
+	___BTREE_MAP_INTERNAL* m_node;
+	usize m_index;
+}
+___BTREE_MAP_IDENT(path_step);
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE ___BTREE_MAP_ITERATOR
+	___BTREE_MAP_IDENT(iterator_new)(const ___BTREE_MAP* restrict self);
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE Ref(___BTREE_MAP_ENTRY) ___BTREE_MAP_IDENT(iterator_next)(
+	CnxForwardIterator(Ref(___BTREE_MAP_ENTRY)) * restrict self);
+BTREE_MAP_STATIC BTREE_MAP_INLINE Ref(___BTREE_MAP_ENTRY) ___BTREE_MAP_IDENT(iterator_current)(
+	const CnxForwardIterator(Ref(___BTREE_MAP_ENTRY)) * restrict self);
+BTREE_MAP_STATIC BTREE_MAP_INLINE bool ___BTREE_MAP_IDENT(iterator_equals)(
+	const CnxForwardIterator(Ref(___BTREE_MAP_ENTRY)) * restrict self,
+	const CnxForwardIterator(Ref(___BTREE_MAP_ENTRY)) * restrict rhs);
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE ConstRef(___BTREE_MAP_ENTRY) ___BTREE_MAP_IDENT(iterator_cnext)(
+	CnxForwardIterator(ConstRef(___BTREE_MAP_ENTRY)) * restrict self);
+BTREE_MAP_STATIC BTREE_MAP_INLINE ConstRef(___BTREE_MAP_ENTRY)
+	___BTREE_MAP_IDENT(iterator_ccurrent)(
+		const CnxForwardIterator(ConstRef(___BTREE_MAP_ENTRY)) * restrict self);
+BTREE_MAP_STATIC BTREE_MAP_INLINE bool ___BTREE_MAP_IDENT(iterator_cequals)(
+	const CnxForwardIterator(ConstRef(___BTREE_MAP_ENTRY)) * restrict self,
+	const CnxForwardIterator(ConstRef(___BTREE_MAP_ENTRY)) * restrict rhs);
+
+ImplIntoCnxForwardIterator(___BTREE_MAP,
+						   Ref(___BTREE_MAP_ENTRY),
+						   ___BTREE_MAP_IDENT(into_iter),
+						   ___BTREE_MAP_IDENT(iterator_new),
+						   ___BTREE_MAP_IDENT(iterator_next),
+						   ___BTREE_MAP_IDENT(iterator_current),
+						   ___BTREE_MAP_IDENT(iterator_equals));
+ImplIntoCnxForwardIterator(___BTREE_MAP,
+						   ConstRef(___BTREE_MAP_ENTRY),
+						   ___BTREE_MAP_IDENT(into_const_iter),
+						   ___BTREE_MAP_IDENT(iterator_new),
+						   ___BTREE_MAP_IDENT(iterator_cnext),
+						   ___BTREE_MAP_IDENT(iterator_ccurrent),
+						   ___BTREE_MAP_IDENT(iterator_cequals));
+
+__attr(always_inline) static inline ___BTREE_MAP_ENTRY
+	___BTREE_MAP_IDENT(default_constructor)(__attr(maybe_unused) CnxAllocator allocator) {
+	return (___BTREE_MAP_ENTRY){0};
+}
+
+__attr(always_inline) __attr(not_null(1)) static inline ___BTREE_MAP_ENTRY
+	___BTREE_MAP_IDENT(default_copy_constructor)(const ___BTREE_MAP_ENTRY* restrict entry,
+												 __attr(maybe_unused) CnxAllocator allocator) {
+	return *entry;
+}
+
+__attr(always_inline) __attr(not_null(1)) static inline void ___BTREE_MAP_IDENT(
+	default_destructor)(__attr(maybe_unused)
+							___BTREE_MAP_ENTRY* restrict entry, /** NOLINT(readability-non-const-parameter)**/
+						__attr(maybe_unused) CnxAllocator allocator) {
+}
+
+static const struct ___BTREE_MAP_IDENT(vtable) ___BTREE_MAP_IDENT(vtable_impl) = {
+	.clone = ___BTREE_MAP_IDENT(clone),
+	.size = ___BTREE_MAP_IDENT(size),
+	.is_empty = ___BTREE_MAP_IDENT(is_empty),
+	.contains = ___BTREE_MAP_IDENT(contains),
+	.get_const = ___BTREE_MAP_IDENT(get_const),
+	.get_mut = ___BTREE_MAP_IDENT(get_mut),
+	.at_const = ___BTREE_MAP_IDENT(at_const),
+	.at_mut = ___BTREE_MAP_IDENT(at_mut),
+	.insert = ___BTREE_MAP_IDENT(insert),
+	.erase = ___BTREE_MAP_IDENT(erase),
+	.clear = ___BTREE_MAP_IDENT(clear),
+	.free = ___BTREE_MAP_IDENT(free),
+	.into_iter = ___BTREE_MAP_IDENT(into_iter),
+	.into_const_iter = ___BTREE_MAP_IDENT(into_const_iter),
+	.lower_bound = ___BTREE_MAP_IDENT(lower_bound),
+	.upper_bound = ___BTREE_MAP_IDENT(upper_bound),
+	.begin = ___BTREE_MAP_IDENT(begin),
+	.end = ___BTREE_MAP_IDENT(end),
+	.cbegin = ___BTREE_MAP_IDENT(cbegin),
+	.cend = ___BTREE_MAP_IDENT(cend),
+};
+
+static const struct CnxCollectionData(___BTREE_MAP) ___BTREE_MAP_IDENT(default_collection_data)
+	= {.m_constructor = ___BTREE_MAP_IDENT(default_constructor),
+	   .m_copy_constructor = ___BTREE_MAP_IDENT(default_copy_constructor),
+	   .m_destructor = ___BTREE_MAP_IDENT(default_destructor)};
+
+static inline ___BTREE_MAP_LEAF* ___BTREE_MAP_IDENT(leaf_new)(___BTREE_MAP* restrict self) {
+	let_mut leaf = cnx_allocator_allocate_t(___BTREE_MAP_LEAF, self->m_allocator);
+	leaf->m_node = (___BTREE_MAP_NODE){.m_size = 0, .m_is_leaf = true};
+	leaf->m_next = nullptr;
+	return leaf;
+}
+
+static inline ___BTREE_MAP_INTERNAL*
+___BTREE_MAP_IDENT(internal_new)(___BTREE_MAP* restrict self) {
+	let_mut node = cnx_allocator_allocate_t(___BTREE_MAP_INTERNAL, self->m_allocator);
+	node->m_node = (___BTREE_MAP_NODE){.m_size = 0, .m_is_leaf = false};
+	return node;
+}
+
+/// Returns the index of the first entry in `leaf` whose key is not less than `key` (or, if
+/// `upper` is `true`, greater than `key`)
+static inline usize ___BTREE_MAP_IDENT(leaf_search)(const ___BTREE_MAP_LEAF* restrict leaf,
+													const BTREE_MAP_K* restrict key,
+													bool upper) {
+	let_mut low = 0U;
+	let_mut high = static_cast(usize)(leaf->m_node.m_size);
+	while(low < high) {
+		let mid = low + (high - low) / 2U;
+		let comparison = ___BTREE_MAP_COMPARE(&(leaf->m_entries[mid].m_key), key);
+		if(comparison < 0 || (upper && comparison == 0)) {
+			low = mid + 1U;
+		}
+		else {
+			high = mid;
+		}
+	}
+	return low;
+}
+
+/// Returns the index of the child of `node` whose subtree would contain `key`
+static inline usize ___BTREE_MAP_IDENT(internal_search)(const ___BTREE_MAP_INTERNAL* restrict node,
+														const BTREE_MAP_K* restrict key) {
+	let_mut low = 0U;
+	let_mut high = static_cast(usize)(node->m_node.m_size);
+	while(low < high) {
+		let mid = low + (high - low) / 2U;
+		if(___BTREE_MAP_COMPARE(&(node->m_keys[mid]), key) <= 0) {
+			low = mid + 1U;
+		}
+		else {
+			high = mid;
+		}
+	}
+	return low;
+}
+
+static inline ___BTREE_MAP_LEAF* ___BTREE_MAP_IDENT(find_leaf)(const ___BTREE_MAP* restrict self,
+															   const BTREE_MAP_K* restrict key) {
+	let_mut node = self->m_root;
+	if(node == nullptr) {
+		return nullptr;
+	}
+
+	while(!node->m_is_leaf) {
+		let internal = static_cast(const ___BTREE_MAP_INTERNAL*)(node);
+		node = internal->m_children[___BTREE_MAP_IDENT(internal_search)(internal, key)];
+	}
+
+	return static_cast(___BTREE_MAP_LEAF*)(node);
+}
+
+static inline ___BTREE_MAP_LEAF* ___BTREE_MAP_IDENT(first_leaf)(const ___BTREE_MAP* restrict self) {
+	let_mut node = self->m_root;
+	if(node == nullptr) {
+		return nullptr;
+	}
+
+	while(!node->m_is_leaf) {
+		node = (static_cast(const ___BTREE_MAP_INTERNAL*)(node))->m_children[0];
+	}
+
+	return static_cast(___BTREE_MAP_LEAF*)(node);
+}
+
+/// Returns the entry for `key` in `self`, or `nullptr` if there isn't one
+static inline ___BTREE_MAP_ENTRY* ___BTREE_MAP_IDENT(find_entry)(const ___BTREE_MAP* restrict self,
+																 const BTREE_MAP_K* restrict key) {
+	let_mut leaf = ___BTREE_MAP_IDENT(find_leaf)(self, key);
+	if(leaf == nullptr) {
+		return nullptr;
+	}
+
+	let index = ___BTREE_MAP_IDENT(leaf_search)(leaf, key, false);
+	if(index < leaf->m_node.m_size
+	   && ___BTREE_MAP_COMPARE(&(leaf->m_entries[index].m_key), key) == 0)
+	{
+		return &(leaf->m_entries[index]);
+	}
+
+	return nullptr;
+}
+
+/// Separator keys in internal nodes are bitwise copies of the first key of their right subtree.
+/// When the entry owning that key is replaced or removed, the separator is re-pointed at `new_key`
+/// so that it never refers to destroyed key state
+static inline void
+___BTREE_MAP_IDENT(replace_separator)(___BTREE_MAP_IDENT(path_step) * restrict path,
+									  usize depth,
+									  const BTREE_MAP_K* restrict old_key,
+									  const BTREE_MAP_K* restrict new_key) {
+	for(let_mut i = depth; i > 0U; --i) {
+		let step = path[i - 1U];
+		if(step.m_index > 0U
+		   && ___BTREE_MAP_COMPARE(&(step.m_node->m_keys[step.m_index - 1U]), old_key) == 0)
+		{
+			step.m_node->m_keys[step.m_index - 1U] = *new_key;
+			return;
+		}
+	}
+}
+
+static inline void
+___BTREE_MAP_IDENT(free_node)(___BTREE_MAP* restrict self, ___BTREE_MAP_NODE* restrict node) {
+	if(node->m_is_leaf) {
+		let_mut leaf = static_cast(___BTREE_MAP_LEAF*)(node);
+		for(let_mut i = 0U; i < leaf->m_node.m_size; ++i) {
+			self->m_data->m_destructor(&(leaf->m_entries[i]), self->m_allocator);
+		}
+	}
+	else {
+		let_mut internal = static_cast(___BTREE_MAP_INTERNAL*)(node);
+		for(let_mut i = 0U; i <= internal->m_node.m_size; ++i) {
+			___BTREE_MAP_IDENT(free_node)(self, internal->m_children[i]);
+		}
+	}
+
+	cnx_allocator_deallocate(self->m_allocator, node);
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE ___BTREE_MAP ___BTREE_MAP_IDENT(new)(void) {
+	return cnx_btree_map_new_with_allocator_and_collection_data(
+		BTREE_MAP_K,
+		BTREE_MAP_V,
+		DEFAULT_ALLOCATOR,
+		&___BTREE_MAP_IDENT(default_collection_data));
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE ___BTREE_MAP
+	___BTREE_MAP_IDENT(new_with_allocator)(CnxAllocator allocator) {
+	return cnx_btree_map_new_with_allocator_and_collection_data(
+		BTREE_MAP_K,
+		BTREE_MAP_V,
+		allocator,
+		&___BTREE_MAP_IDENT(default_collection_data));
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE ___BTREE_MAP ___BTREE_MAP_IDENT(new_with_collection_data)(
+	const CnxCollectionData(___BTREE_MAP) * restrict data) {
+	return cnx_btree_map_new_with_allocator_and_collection_data(BTREE_MAP_K,
+																BTREE_MAP_V,
+																DEFAULT_ALLOCATOR,
+																data);
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE ___BTREE_MAP
+	___BTREE_MAP_IDENT(new_with_allocator_and_collection_data)(
+		CnxAllocator allocator,
+		const CnxCollectionData(___BTREE_MAP) * restrict data) {
+	let map = (___BTREE_MAP){.m_root = nullptr,
+							 .m_size = 0,
+							 .m_allocator = allocator,
+							 .m_data = data,
+							 .m_vtable = &___BTREE_MAP_IDENT(vtable_impl)};
+	cnx_assert(map.m_data->m_destructor != nullptr, "Entry destructor cannot be null");
+
+	return map;
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE ___BTREE_MAP
+	___BTREE_MAP_IDENT(from_sorted)(___BTREE_MAP_ENTRY* restrict entries, usize num_entries) {
+	return cnx_btree_map_from_sorted_with_allocator(BTREE_MAP_K,
+													BTREE_MAP_V,
+													entries,
+													num_entries,
+													DEFAULT_ALLOCATOR);
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE ___BTREE_MAP
+	___BTREE_MAP_IDENT(from_sorted_with_allocator)(___BTREE_MAP_ENTRY* restrict entries,
+												   usize num_entries,
+												   CnxAllocator allocator) {
+	return cnx_btree_map_from_sorted_with_allocator_and_collection_data(
+		BTREE_MAP_K,
+		BTREE_MAP_V,
+		entries,
+		num_entries,
+		allocator,
+		&___BTREE_MAP_IDENT(default_collection_data));
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE ___BTREE_MAP
+	___BTREE_MAP_IDENT(from_sorted_with_allocator_and_collection_data)(
+		___BTREE_MAP_ENTRY* restrict entries,
+		usize num_entries,
+		CnxAllocator allocator,
+		const CnxCollectionData(___BTREE_MAP) * restrict data) {
+	let_mut map = cnx_btree_map_new_with_allocator_and_collection_data(BTREE_MAP_K,
+																	   BTREE_MAP_V,
+																	   allocator,
+																	   data);
+	if(num_entries == 0U) {
+		return map;
+	}
+
+	for(let_mut i = 1U; i < num_entries; ++i) {
+		cnx_assert(___BTREE_MAP_COMPARE(&(entries[i - 1U].m_key), &(entries[i].m_key)) < 0,
+				   "cnx_btree_map_from_sorted called with entries that aren't sorted in strictly "
+				   "ascending key order");
+	}
+
+	// Entries are distributed evenly over the minimum number of leaves required to hold them,
+	// so that every leaf (and, below, every internal node) satisfies the B-tree fill invariant
+	let num_leaves = (num_entries + ___BTREE_MAP_LEAF_CAPACITY - 1U) / ___BTREE_MAP_LEAF_CAPACITY;
+	let_mut level = cnx_allocator_allocate_array_t(___BTREE_MAP_NODE*, allocator, num_leaves);
+	let_mut minimums = cnx_allocator_allocate_array_t(BTREE_MAP_K, allocator, num_leaves);
+
+	let_mut offset = 0U;
+	___BTREE_MAP_LEAF* previous = nullptr;
+	for(let_mut i = 0U; i < num_leaves; ++i) {
+		let count = num_entries / num_leaves + (i < num_entries % num_leaves ? 1U : 0U);
+		let_mut leaf = ___BTREE_MAP_IDENT(leaf_new)(&map);
+		cnx_memcpy(___BTREE_MAP_ENTRY, leaf->m_entries, entries + offset, count);
+		leaf->m_node.m_size = static_cast(u32)(count);
+		if(previous != nullptr) {
+			previous->m_next = leaf;
+		}
+		previous = leaf;
+		level[i] = &(leaf->m_node);
+		minimums[i] = entries[offset].m_key;
+		offset += count;
+	}
+
+	// Build each internal level in place over the one below it. Parent `p` only ever consumes
+	// children at indices >= `p`, so overwriting `level[p]` never clobbers unconsumed nodes
+	let_mut level_size = num_leaves;
+	while(level_size > 1U) {
+		let fan_out = static_cast(usize)(___BTREE_MAP_INTERNAL_CAPACITY) + 1U;
+		let num_parents = (level_size + fan_out - 1U) / fan_out;
+		let_mut child = 0U;
+		for(let_mut i = 0U; i < num_parents; ++i) {
+			let num_children = level_size / num_parents + (i < level_size % num_parents ? 1U : 0U);
+			let_mut node = ___BTREE_MAP_IDENT(internal_new)(&map);
+			node->m_children[0] = level[child];
+			for(let_mut j = 1U; j < num_children; ++j) {
+				node->m_keys[j - 1U] = minimums[child + j];
+				node->m_children[j] = level[child + j];
+			}
+			node->m_node.m_size = static_cast(u32)(num_children - 1U);
+			minimums[i] = minimums[child];
+			level[i] = &(node->m_node);
+			child += num_children;
+		}
+		level_size = num_parents;
+	}
+
+	map.m_root = level[0];
+	map.m_size = num_entries;
+
+	cnx_allocator_deallocate(allocator, minimums);
+	cnx_allocator_deallocate(allocator, level);
+
+	return map;
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE ___BTREE_MAP
+	___BTREE_MAP_IDENT(clone)(const ___BTREE_MAP* restrict self)
+		cnx_disable_if(!(self->m_data->m_copy_constructor),
+					   "Can't clone a CnxBTreeMap(K, V) with entries that aren't copyable (no "
+					   "entry copy constructor defined)") {
+	cnx_assert(self->m_data->m_copy_constructor != nullptr,
+			   "Can't clone a CnxBTreeMap(K, V) with entries that aren't copyable (no entry copy "
+			   "constructor defined)");
+
+	if(self->m_size == 0U) {
+		return cnx_btree_map_new_with_allocator_and_collection_data(BTREE_MAP_K,
+																	BTREE_MAP_V,
+																	self->m_allocator,
+																	self->m_data);
+	}
+
+	// The leaf chain already yields the entries in sorted order, so cloning is a bulk-load
+	let_mut entries
+		= cnx_allocator_allocate_array_t(___BTREE_MAP_ENTRY, self->m_allocator, self->m_size);
+	let_mut index = 0U;
+	for(let_mut leaf = ___BTREE_MAP_IDENT(first_leaf)(self); leaf != nullptr; leaf = leaf->m_next)
+	{
+		for(let_mut i = 0U; i < leaf->m_node.m_size; ++i) {
+			entries[index] = self->m_data->m_copy_constructor(&(leaf->m_entries[i]),
+															  self->m_allocator);
+			++index;
+		}
+	}
+
+	let map = cnx_btree_map_from_sorted_with_allocator_and_collection_data(BTREE_MAP_K,
+																		   BTREE_MAP_V,
+																		   entries,
+																		   self->m_size,
+																		   self->m_allocator,
+																		   self->m_data);
+	cnx_allocator_deallocate(self->m_allocator, entries);
+	return map;
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE usize
+___BTREE_MAP_IDENT(size)(const ___BTREE_MAP* restrict self) {
+	return self->m_size;
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE bool
+___BTREE_MAP_IDENT(is_empty)(const ___BTREE_MAP* restrict self) {
+	return self->m_size == 0U;
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE bool
+___BTREE_MAP_IDENT(contains)(const ___BTREE_MAP* restrict self, BTREE_MAP_K key) {
+	return ___BTREE_MAP_IDENT(find_entry)(self, &key) != nullptr;
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE const BTREE_MAP_V*
+___BTREE_MAP_IDENT(get_const)(const ___BTREE_MAP* restrict self, BTREE_MAP_K key) {
+	let entry = ___BTREE_MAP_IDENT(find_entry)(self, &key);
+	return entry != nullptr ? &(entry->m_value) : nullptr;
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE BTREE_MAP_V*
+___BTREE_MAP_IDENT(get_mut)(___BTREE_MAP* restrict self, BTREE_MAP_K key) {
+	let_mut entry = ___BTREE_MAP_IDENT(find_entry)(self, &key);
+	return entry != nullptr ? &(entry->m_value) : nullptr;
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE const BTREE_MAP_V*
+___BTREE_MAP_IDENT(at_const)(const ___BTREE_MAP* restrict self, BTREE_MAP_K key) {
+	let value = ___BTREE_MAP_IDENT(get_const)(self, key);
+	cnx_assert(value != nullptr, "cnx_btree_map_at called with a key not contained in the map");
+	return value;
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE BTREE_MAP_V*
+___BTREE_MAP_IDENT(at_mut)(___BTREE_MAP* restrict self, BTREE_MAP_K key) {
+	let_mut value = ___BTREE_MAP_IDENT(get_mut)(self, key);
+	cnx_assert(value != nullptr,
+			   "cnx_btree_map_at_mut called with a key not contained in the map");
+	return value;
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE bool
+___BTREE_MAP_IDENT(insert)(___BTREE_MAP* restrict self, BTREE_MAP_K key, BTREE_MAP_V value) {
+	let entry = (___BTREE_MAP_ENTRY){.m_key = key, .m_value = value};
+
+	if(self->m_root == nullptr) {
+		let_mut leaf = ___BTREE_MAP_IDENT(leaf_new)(self);
+		leaf->m_entries[0] = entry;
+		leaf->m_node.m_size = 1;
+		self->m_root = &(leaf->m_node);
+		self->m_size = 1;
+		return true;
+	}
+
+	___BTREE_MAP_IDENT(path_step) path[CNX_BTREE_MAP_MAX_HEIGHT];
+	let_mut depth = 0U;
+	let_mut node = self->m_root;
+	while(!node->m_is_leaf) {
+		let_mut internal = static_cast(___BTREE_MAP_INTERNAL*)(node);
+		let index = ___BTREE_MAP_IDENT(internal_search)(internal, &key);
+		path[depth] = (___BTREE_MAP_IDENT(path_step)){.m_node = internal, .m_index = index};
+		++depth;
+		node = internal->m_children[index];
+	}
+
+	let_mut leaf = static_cast(___BTREE_MAP_LEAF*)(node);
+	let index = ___BTREE_MAP_IDENT(leaf_search)(leaf, &key, false);
+	let size = static_cast(usize)(leaf->m_node.m_size);
+
+	if(index < size && ___BTREE_MAP_COMPARE(&(leaf->m_entries[index].m_key), &key) == 0) {
+		self->m_data->m_destructor(&(leaf->m_entries[index]), self->m_allocator);
+		leaf->m_entries[index] = entry;
+		if(index == 0U) {
+			___BTREE_MAP_IDENT(replace_separator)(path,
+												  depth,
+												  &key,
+												  &(leaf->m_entries[0].m_key));
+		}
+		return false;
+	}
+
+	BTREE_MAP_K separator;
+	___BTREE_MAP_NODE* new_child = nullptr;
+
+	if(size < ___BTREE_MAP_LEAF_CAPACITY) {
+		cnx_memmove(___BTREE_MAP_ENTRY,
+					leaf->m_entries + index + 1U,
+					leaf->m_entries + index,
+					size - index);
+		leaf->m_entries[index] = entry;
+		leaf->m_node.m_size++;
+	}
+	else {
+		___BTREE_MAP_ENTRY entries[___BTREE_MAP_LEAF_CAPACITY + 1U];
+		cnx_memcpy(___BTREE_MAP_ENTRY, entries, leaf->m_entries, index);
+		entries[index] = entry;
+		cnx_memcpy(___BTREE_MAP_ENTRY,
+				   entries + index + 1U,
+				   leaf->m_entries + index,
+				   size - index);
+
+		let total = size + 1U;
+		let left_size = total / 2U;
+		let_mut right = ___BTREE_MAP_IDENT(leaf_new)(self);
+		cnx_memcpy(___BTREE_MAP_ENTRY, leaf->m_entries, entries, left_size);
+		cnx_memcpy(___BTREE_MAP_ENTRY, right->m_entries, entries + left_size, total - left_size);
+		leaf->m_node.m_size = static_cast(u32)(left_size);
+		right->m_node.m_size = static_cast(u32)(total - left_size);
+		right->m_next = leaf->m_next;
+		leaf->m_next = right;
+
+		separator = right->m_entries[0].m_key;
+		new_child = &(right->m_node);
+	}
+
+	self->m_size++;
+
+	while(new_child != nullptr && depth > 0U) {
+		--depth;
+		let_mut parent = path[depth].m_node;
+		let position = path[depth].m_index;
+		let num_keys = static_cast(usize)(parent->m_node.m_size);
+
+		if(num_keys < ___BTREE_MAP_INTERNAL_CAPACITY) {
+			cnx_memmove(BTREE_MAP_K,
+						parent->m_keys + position + 1U,
+						parent->m_keys + position,
+						num_keys - position);
+			cnx_memmove(___BTREE_MAP_NODE*,
+						parent->m_children + position + 2U,
+						parent->m_children + position + 1U,
+						num_keys - position);
+			parent->m_keys[position] = separator;
+			parent->m_children[position + 1U] = new_child;
+			parent->m_node.m_size++;
+			new_child = nullptr;
+		}
+		else {
+			BTREE_MAP_K keys[___BTREE_MAP_INTERNAL_CAPACITY + 1U];
+			___BTREE_MAP_NODE* children[___BTREE_MAP_INTERNAL_CAPACITY + 2U];
+			cnx_memcpy(BTREE_MAP_K, keys, parent->m_keys, position);
+			keys[position] = separator;
+			cnx_memcpy(BTREE_MAP_K,
+					   keys + position + 1U,
+					   parent->m_keys + position,
+					   num_keys - position);
+			cnx_memcpy(___BTREE_MAP_NODE*, children, parent->m_children, position + 1U);
+			children[position + 1U] = new_child;
+			cnx_memcpy(___BTREE_MAP_NODE*,
+					   children + position + 2U,
+					   parent->m_children + position + 1U,
+					   num_keys - position);
+
+			// the middle key moves up into the grandparent rather than into either half
+			let total = num_keys + 1U;
+			let left_keys = total / 2U;
+			let right_keys = total - left_keys - 1U;
+			let_mut right = ___BTREE_MAP_IDENT(internal_new)(self);
+			cnx_memcpy(BTREE_MAP_K, parent->m_keys, keys, left_keys);
+			cnx_memcpy(___BTREE_MAP_NODE*, parent->m_children, children, left_keys + 1U);
+			cnx_memcpy(BTREE_MAP_K, right->m_keys, keys + left_keys + 1U, right_keys);
+			cnx_memcpy(___BTREE_MAP_NODE*,
+					   right->m_children,
+					   children + left_keys + 1U,
+					   right_keys + 1U);
+			parent->m_node.m_size = static_cast(u32)(left_keys);
+			right->m_node.m_size = static_cast(u32)(right_keys);
+
+			separator = keys[left_keys];
+			new_child = &(right->m_node);
+		}
+	}
+
+	if(new_child != nullptr) {
+		let_mut root = ___BTREE_MAP_IDENT(internal_new)(self);
+		root->m_keys[0] = separator;
+		root->m_children[0] = self->m_root;
+		root->m_children[1] = new_child;
+		root->m_node.m_size = 1;
+		self->m_root = &(root->m_node);
+	}
+
+	return true;
+}
+
+/// Merges the leaf at `left_index + 1` in `parent` into the leaf at `left_index`
+static inline void ___BTREE_MAP_IDENT(merge_leaves)(___BTREE_MAP* restrict self,
+													___BTREE_MAP_INTERNAL* restrict parent,
+													usize left_index) {
+	let_mut left = static_cast(___BTREE_MAP_LEAF*)(parent->m_children[left_index]);
+	let_mut right = static_cast(___BTREE_MAP_LEAF*)(parent->m_children[left_index + 1U]);
+
+	cnx_memcpy(___BTREE_MAP_ENTRY,
+			   left->m_entries + left->m_node.m_size,
+			   right->m_entries,
+			   right->m_node.m_size);
+	left->m_node.m_size += right->m_node.m_size;
+	left->m_next = right->m_next;
+	cnx_allocator_deallocate(self->m_allocator, right);
+
+	let num_keys = static_cast(usize)(parent->m_node.m_size);
+	cnx_memmove(BTREE_MAP_K,
+				parent->m_keys + left_index,
+				parent->m_keys + left_index + 1U,
+				num_keys - left_index - 1U);
+	cnx_memmove(___BTREE_MAP_NODE*,
+				parent->m_children + left_index + 1U,
+				parent->m_children + left_index + 2U,
+				num_keys - left_index - 1U);
+	parent->m_node.m_size--;
+}
+
+/// Merges the internal node at `left_index + 1` in `parent` into the one at `left_index`, pulling
+/// their separator down from `parent`
+static inline void ___BTREE_MAP_IDENT(merge_internals)(___BTREE_MAP* restrict self,
+													   ___BTREE_MAP_INTERNAL* restrict parent,
+													   usize left_index) {
+	let_mut left = static_cast(___BTREE_MAP_INTERNAL*)(parent->m_children[left_index]);
+	let_mut right = static_cast(___BTREE_MAP_INTERNAL*)(parent->m_children[left_index + 1U]);
+	let left_size = static_cast(usize)(left->m_node.m_size);
+	let right_size = static_cast(usize)(right->m_node.m_size);
+
+	left->m_keys[left_size] = parent->m_keys[left_index];
+	cnx_memcpy(BTREE_MAP_K, left->m_keys + left_size + 1U, right->m_keys, right_size);
+	cnx_memcpy(___BTREE_MAP_NODE*,
+			   left->m_children + left_size + 1U,
+			   right->m_children,
+			   right_size + 1U);
+	left->m_node.m_size = static_cast(u32)(left_size + right_size + 1U);
+	cnx_allocator_deallocate(self->m_allocator, right);
+
+	let num_keys = static_cast(usize)(parent->m_node.m_size);
+	cnx_memmove(BTREE_MAP_K,
+				parent->m_keys + left_index,
+				parent->m_keys + left_index + 1U,
+				num_keys - left_index - 1U);
+	cnx_memmove(___BTREE_MAP_NODE*,
+				parent->m_children + left_index + 1U,
+				parent->m_children + left_index + 2U,
+				num_keys - left_index - 1U);
+	parent->m_node.m_size--;
+}
+
+/// Restores the fill invariant of the underfull leaf at `index` in `parent`, by borrowing an
+/// entry from a sibling if one can spare it, or merging with a sibling otherwise
+static inline void ___BTREE_MAP_IDENT(rebalance_leaf)(___BTREE_MAP* restrict self,
+													  ___BTREE_MAP_INTERNAL* restrict parent,
+													  usize index) {
+	let_mut leaf = static_cast(___BTREE_MAP_LEAF*)(parent->m_children[index]);
+
+	if(index > 0U) {
+		let_mut left = static_cast(___BTREE_MAP_LEAF*)(parent->m_children[index - 1U]);
+		if(left->m_node.m_size > ___BTREE_MAP_LEAF_MIN) {
+			cnx_memmove(___BTREE_MAP_ENTRY,
+						leaf->m_entries + 1U,
+						leaf->m_entries,
+						leaf->m_node.m_size);
+			leaf->m_entries[0] = left->m_entries[left->m_node.m_size - 1U];
+			left->m_node.m_size--;
+			leaf->m_node.m_size++;
+			parent->m_keys[index - 1U] = leaf->m_entries[0].m_key;
+			return;
+		}
+	}
+
+	if(index < parent->m_node.m_size) {
+		let_mut right = static_cast(___BTREE_MAP_LEAF*)(parent->m_children[index + 1U]);
+		if(right->m_node.m_size > ___BTREE_MAP_LEAF_MIN) {
+			leaf->m_entries[leaf->m_node.m_size] = right->m_entries[0];
+			cnx_memmove(___BTREE_MAP_ENTRY,
+						right->m_entries,
+						right->m_entries + 1U,
+						right->m_node.m_size - 1U);
+			right->m_node.m_size--;
+			leaf->m_node.m_size++;
+			parent->m_keys[index] = right->m_entries[0].m_key;
+			return;
+		}
+	}
+
+	___BTREE_MAP_IDENT(merge_leaves)(self, parent, index > 0U ? index - 1U : index);
+}
+
+/// Restores the fill invariant of the underfull internal node at `index` in `parent`, by
+/// rotating a child through `parent` from a sibling if one can spare it, or merging with a
+/// sibling otherwise
+static inline void ___BTREE_MAP_IDENT(rebalance_internal)(___BTREE_MAP* restrict self,
+														  ___BTREE_MAP_INTERNAL* restrict parent,
+														  usize index) {
+	let_mut node = static_cast(___BTREE_MAP_INTERNAL*)(parent->m_children[index]);
+	let size = static_cast(usize)(node->m_node.m_size);
+
+	if(index > 0U) {
+		let_mut left = static_cast(___BTREE_MAP_INTERNAL*)(parent->m_children[index - 1U]);
+		let left_size = static_cast(usize)(left->m_node.m_size);
+		if(left_size > ___BTREE_MAP_INTERNAL_MIN) {
+			cnx_memmove(BTREE_MAP_K, node->m_keys + 1U, node->m_keys, size);
+			cnx_memmove(___BTREE_MAP_NODE*, node->m_children + 1U, node->m_children, size + 1U);
+			node->m_keys[0] = parent->m_keys[index - 1U];
+			node->m_children[0] = left->m_children[left_size];
+			parent->m_keys[index - 1U] = left->m_keys[left_size - 1U];
+			left->m_node.m_size--;
+			node->m_node.m_size++;
+			return;
+		}
+	}
+
+	if(index < parent->m_node.m_size) {
+		let_mut right = static_cast(___BTREE_MAP_INTERNAL*)(parent->m_children[index + 1U]);
+		let right_size = static_cast(usize)(right->m_node.m_size);
+		if(right_size > ___BTREE_MAP_INTERNAL_MIN) {
+			node->m_keys[size] = parent->m_keys[index];
+			node->m_children[size + 1U] = right->m_children[0];
+			parent->m_keys[index] = right->m_keys[0];
+			cnx_memmove(BTREE_MAP_K, right->m_keys, right->m_keys + 1U, right_size - 1U);
+			cnx_memmove(___BTREE_MAP_NODE*,
+						right->m_children,
+						right->m_children + 1U,
+						right_size);
+			right->m_node.m_size--;
+			node->m_node.m_size++;
+			return;
+		}
+	}
+
+	___BTREE_MAP_IDENT(merge_internals)(self, parent, index > 0U ? index - 1U : index);
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE bool
+___BTREE_MAP_IDENT(erase)(___BTREE_MAP* restrict self, BTREE_MAP_K key) {
+	if(self->m_root == nullptr) {
+		return false;
+	}
+
+	___BTREE_MAP_IDENT(path_step) path[CNX_BTREE_MAP_MAX_HEIGHT];
+	let_mut depth = 0U;
+	let_mut node = self->m_root;
+	while(!node->m_is_leaf) {
+		let_mut internal = static_cast(___BTREE_MAP_INTERNAL*)(node);
+		let index = ___BTREE_MAP_IDENT(internal_search)(internal, &key);
+		path[depth] = (___BTREE_MAP_IDENT(path_step)){.m_node = internal, .m_index = index};
+		++depth;
+		node = internal->m_children[index];
+	}
+
+	let_mut leaf = static_cast(___BTREE_MAP_LEAF*)(node);
+	let index = ___BTREE_MAP_IDENT(leaf_search)(leaf, &key, false);
+	if(index >= leaf->m_node.m_size
+	   || ___BTREE_MAP_COMPARE(&(leaf->m_entries[index].m_key), &key) != 0)
+	{
+		return false;
+	}
+
+	self->m_data->m_destructor(&(leaf->m_entries[index]), self->m_allocator);
+	cnx_memmove(___BTREE_MAP_ENTRY,
+				leaf->m_entries + index,
+				leaf->m_entries + index + 1U,
+				leaf->m_node.m_size - index - 1U);
+	leaf->m_node.m_size--;
+	self->m_size--;
+
+	if(depth == 0U) {
+		if(leaf->m_node.m_size == 0U) {
+			cnx_allocator_deallocate(self->m_allocator, leaf);
+			self->m_root = nullptr;
+		}
+		return true;
+	}
+
+	// non-root leaves never drop below `___BTREE_MAP_LEAF_MIN` (>= 2) entries, so there is
+	// always a live key to re-point a stale separator at
+	if(index == 0U) {
+		___BTREE_MAP_IDENT(replace_separator)(path, depth, &key, &(leaf->m_entries[0].m_key));
+	}
+
+	while(depth > 0U) {
+		let min = node->m_is_leaf ? ___BTREE_MAP_LEAF_MIN : ___BTREE_MAP_INTERNAL_MIN;
+		if(node->m_size >= min) {
+			break;
+		}
+
+		--depth;
+		let_mut parent = path[depth].m_node;
+		if(node->m_is_leaf) {
+			___BTREE_MAP_IDENT(rebalance_leaf)(self, parent, path[depth].m_index);
+		}
+		else {
+			___BTREE_MAP_IDENT(rebalance_internal)(self, parent, path[depth].m_index);
+		}
+		node = &(parent->m_node);
+	}
+
+	if(!self->m_root->m_is_leaf && self->m_root->m_size == 0U) {
+		let_mut old_root = static_cast(___BTREE_MAP_INTERNAL*)(self->m_root);
+		self->m_root = old_root->m_children[0];
+		cnx_allocator_deallocate(self->m_allocator, old_root);
+	}
+
+	return true;
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE void ___BTREE_MAP_IDENT(clear)(___BTREE_MAP* restrict self) {
+	if(self->m_root != nullptr) {
+		___BTREE_MAP_IDENT(free_node)(self, self->m_root);
+	}
+
+	self->m_root = nullptr;
+	self->m_size = 0U;
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE void ___BTREE_MAP_IDENT(free)(void* restrict self) {
+	let_mut self_ = static_cast(___BTREE_MAP*)(self);
+	___BTREE_MAP_IDENT(clear)(self_);
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE ___BTREE_MAP_ITERATOR
+	___BTREE_MAP_IDENT(iterator_new)(const ___BTREE_MAP* restrict self) {
+	let leaf = ___BTREE_MAP_IDENT(first_leaf)(self);
+	return (___BTREE_MAP_ITERATOR){.m_leaf = leaf, .m_index = 0U};
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE Ref(___BTREE_MAP_ENTRY) ___BTREE_MAP_IDENT(iterator_next)(
+	CnxForwardIterator(Ref(___BTREE_MAP_ENTRY)) * restrict self) {
+	let_mut _self = static_cast(___BTREE_MAP_ITERATOR*)(self->m_self);
+
+	cnx_assert(_self->m_leaf != nullptr,
+			   "Iterator advanced when iterator is positioned at the end of the iteration "
+			   "(iterator out of bounds)");
+
+	let_mut current = &(_self->m_leaf->m_entries[_self->m_index]);
+	_self->m_index++;
+	if(_self->m_index >= _self->m_leaf->m_node.m_size) {
+		_self->m_leaf = _self->m_leaf->m_next;
+		_self->m_index = 0U;
+	}
+
+	return _self->m_leaf != nullptr ? &(_self->m_leaf->m_entries[_self->m_index]) : current;
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE Ref(___BTREE_MAP_ENTRY) ___BTREE_MAP_IDENT(iterator_current)(
+	const CnxForwardIterator(Ref(___BTREE_MAP_ENTRY)) * restrict self) {
+	let _self = static_cast(const ___BTREE_MAP_ITERATOR*)(self->m_self);
+
+	cnx_assert(_self->m_leaf != nullptr,
+			   "Iterator value accessed when iterator is positioned at the end of the iteration "
+			   "(iterator out of bounds)");
+
+	return &(_self->m_leaf->m_entries[_self->m_index]);
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE bool ___BTREE_MAP_IDENT(iterator_equals)(
+	const CnxForwardIterator(Ref(___BTREE_MAP_ENTRY)) * restrict self,
+	const CnxForwardIterator(Ref(___BTREE_MAP_ENTRY)) * restrict rhs) {
+	let _self = static_cast(const ___BTREE_MAP_ITERATOR*)(self->m_self);
+	let _rhs = static_cast(const ___BTREE_MAP_ITERATOR*)(rhs->m_self);
+
+	return _self->m_leaf == _rhs->m_leaf && _self->m_index == _rhs->m_index;
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE ConstRef(___BTREE_MAP_ENTRY) ___BTREE_MAP_IDENT(iterator_cnext)(
+	CnxForwardIterator(ConstRef(___BTREE_MAP_ENTRY)) * restrict self) {
+	return ___BTREE_MAP_IDENT(iterator_next)(
+		static_cast(CnxForwardIterator(Ref(___BTREE_MAP_ENTRY))*)(self));
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE ConstRef(___BTREE_MAP_ENTRY)
+	___BTREE_MAP_IDENT(iterator_ccurrent)(
+		const CnxForwardIterator(ConstRef(___BTREE_MAP_ENTRY)) * restrict self) {
+	return ___BTREE_MAP_IDENT(iterator_current)(
+		static_cast(const CnxForwardIterator(Ref(___BTREE_MAP_ENTRY))*)(self));
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE bool ___BTREE_MAP_IDENT(iterator_cequals)(
+	const CnxForwardIterator(ConstRef(___BTREE_MAP_ENTRY)) * restrict self,
+	const CnxForwardIterator(ConstRef(___BTREE_MAP_ENTRY)) * restrict rhs) {
+	return ___BTREE_MAP_IDENT(iterator_equals)(
+		static_cast(const CnxForwardIterator(Ref(___BTREE_MAP_ENTRY))*)(self),
+		static_cast(const CnxForwardIterator(Ref(___BTREE_MAP_ENTRY))*)(rhs));
+}
+
+/// Returns a mutable iterator into `self` positioned at the given entry of `leaf`, normalizing
+/// one-past-the-end of a leaf to the start of the next one
+static inline CnxForwardIterator(Ref(___BTREE_MAP_ENTRY))
+	___BTREE_MAP_IDENT(iterator_at)(const ___BTREE_MAP* restrict self,
+									___BTREE_MAP_LEAF* restrict leaf,
+									usize index) {
+	if(leaf != nullptr && index >= leaf->m_node.m_size) {
+		leaf = leaf->m_next;
+		index = 0U;
+	}
+
+	let_mut iter = ___BTREE_MAP_IDENT(into_iter)(self);
+	let_mut inner = static_cast(___BTREE_MAP_ITERATOR*)(iter.m_self);
+	inner->m_leaf = leaf;
+	inner->m_index = leaf != nullptr ? index : 0U;
+	return iter;
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE CnxForwardIterator(Ref(___BTREE_MAP_ENTRY))
+	___BTREE_MAP_IDENT(lower_bound)(___BTREE_MAP* restrict self, BTREE_MAP_K key) {
+	let_mut leaf = ___BTREE_MAP_IDENT(find_leaf)(self, &key);
+	let index = leaf != nullptr ? ___BTREE_MAP_IDENT(leaf_search)(leaf, &key, false) : 0U;
+	return ___BTREE_MAP_IDENT(iterator_at)(self, leaf, index);
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE CnxForwardIterator(Ref(___BTREE_MAP_ENTRY))
+	___BTREE_MAP_IDENT(upper_bound)(___BTREE_MAP* restrict self, BTREE_MAP_K key) {
+	let_mut leaf = ___BTREE_MAP_IDENT(find_leaf)(self, &key);
+	let index = leaf != nullptr ? ___BTREE_MAP_IDENT(leaf_search)(leaf, &key, true) : 0U;
+	return ___BTREE_MAP_IDENT(iterator_at)(self, leaf, index);
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE CnxForwardIterator(Ref(___BTREE_MAP_ENTRY))
+	___BTREE_MAP_IDENT(begin)(___BTREE_MAP* restrict self) {
+	return ___BTREE_MAP_IDENT(into_iter)(self);
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE CnxForwardIterator(Ref(___BTREE_MAP_ENTRY))
+	___BTREE_MAP_IDENT(end)(___BTREE_MAP* restrict self) {
+	return ___BTREE_MAP_IDENT(iterator_at)(self, nullptr, 0U);
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE CnxForwardIterator(ConstRef(___BTREE_MAP_ENTRY))
+	___BTREE_MAP_IDENT(cbegin)(const ___BTREE_MAP* restrict self) {
+	return ___BTREE_MAP_IDENT(into_const_iter)(self);
+}
+
+BTREE_MAP_STATIC BTREE_MAP_INLINE CnxForwardIterator(ConstRef(___BTREE_MAP_ENTRY))
+	___BTREE_MAP_IDENT(cend)(const ___BTREE_MAP* restrict self) {
+	let_mut iter = ___BTREE_MAP_IDENT(into_const_iter)(self);
+	let_mut inner = static_cast(___BTREE_MAP_ITERATOR*)(iter.m_self);
+	inner->m_leaf = nullptr;
+	inner->m_index = 0U;
+	return iter;
+}
+
+	#undef ___BTREE_MAP_COMPARE
+	#undef ___BTREE_MAP_INTERNAL_MIN
+	#undef ___BTREE_MAP_LEAF_MIN
+	#undef ___BTREE_MAP_INTERNAL_CAPACITY
+	#undef ___BTREE_MAP_LEAF_CAPACITY
+	#undef ___BTREE_MAP_IDENT
+	#undef ___BTREE_MAP_ITERATOR
+	#undef ___BTREE_MAP_INTERNAL
+	#undef ___BTREE_MAP_LEAF
+	#undef ___BTREE_MAP_NODE
+	#undef ___BTREE_MAP_ENTRY
+	#undef ___BTREE_MAP
+	#undef CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+#endif // defined(BTREE_MAP_K) && defined(BTREE_MAP_V) && defined(BTREE_MAP_NODE_SIZE) \
+	   // && BTREE_MAP_IMPL
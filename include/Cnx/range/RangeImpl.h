@@ -47,6 +47,7 @@ __attr(maybe_unused) static const CnxRangeIdentifier(RANGE_T, vtable)
 
 	#define ___DISABLE_IF_NULL(self) \
 		cnx_disable_if(!(self), "Can't perform an operation on a null range")
+	#define ___RANGE_END_INDEX (-1)
 
 __attr(nodiscard) __attr(not_null(1)) RANGE_STATIC RANGE_INLINE
 	CnxRangeIdentifier(RANGE_T, Iterator)
@@ -75,13 +76,11 @@ ImplIntoCnxForwardIterator(CnxRange(RANGE_T),
 
 RANGE_STATIC RANGE_INLINE CnxRangeIdentifier(RANGE_T, Iterator)
 	CnxRangeIdentifier(RANGE_T, iterator_new)(const CnxRange(RANGE_T) * restrict self) {
-	let_mut _self = const_cast(CnxRange(RANGE_T)*)(
-		self); /** HACK relying on all Cnx compliant concrete iterator
-				* types to have the same       \ layout **/
-	let begin = static_cast(CnxRangeIdentifier(RANGE_T, Iterator)*)(self->m_begin.m_self);
+	// the position of a range iterator is tracked independently of the concrete iterator type of
+	// the underlying collection, so ranges work over any Cnx compliant iterator
 	return (CnxRangeIdentifier(RANGE_T, Iterator)){
-		.m_range = _self,
-		.m_index = begin->m_index,
+		.m_range = const_cast(CnxRange(RANGE_T)*)(self),
+		.m_index = 0,
 	};
 }
 
@@ -91,11 +90,16 @@ RANGE_STATIC RANGE_INLINE Ref(RANGE_T)
 	while(!cnx_iterator_equals(_self->m_range->m_current, _self->m_range->m_end)) {
 		let current = &cnx_iterator_next(_self->m_range->m_current);
 		_self->m_index++;
+		if(cnx_iterator_equals(_self->m_range->m_current, _self->m_range->m_end)) {
+			break;
+		}
+
 		if(_self->m_range->m_filter(static_cast(const RANGE_T*)(current))) {
 			return current;
 		}
 	}
 
+	_self->m_index = ___RANGE_END_INDEX;
 	return &cnx_iterator_current(_self->m_range->m_begin);
 }
 
@@ -121,26 +125,25 @@ RANGE_STATIC RANGE_INLINE CnxForwardIterator(Ref(RANGE_T))
 	let iter = cnx_range_into_iter(*self);
 	let_mut inner = static_cast(CnxRangeIdentifier(RANGE_T, Iterator)*)(iter.m_self);
 	self->m_current = self->m_begin;
-	let_mut current = &cnx_iterator_current(self->m_current);
-	do {
+	while(!cnx_iterator_equals(self->m_current, self->m_end)) {
+		let current = &cnx_iterator_current(self->m_current);
 		if(self->m_filter(static_cast(const RANGE_T*)(current))) {
 			return iter;
 		}
 
-		current = &cnx_iterator_next(self->m_current);
+		ignore(cnx_iterator_next(self->m_current));
 		inner->m_index++;
-	} while(!cnx_iterator_equals(self->m_current, self->m_end));
+	}
+
+	inner->m_index = ___RANGE_END_INDEX;
 	return iter;
 }
 
 RANGE_STATIC RANGE_INLINE CnxForwardIterator(Ref(RANGE_T))
 	CnxRangeIdentifier(RANGE_T, end)(CnxRange(RANGE_T) * restrict self) {
-	let_mut iter = cnx_range_into_iter(*self);
-	let_mut inner = static_cast(CnxRangeIdentifier(RANGE_T, Iterator)*)(
-		iter.m_self); /** HACK relying on all Cnx compliant concrete iterator types to have the
-					   * same       \ layout **/
-	let end = static_cast(CnxRangeIdentifier(RANGE_T, Iterator)*)(self->m_end.m_self);
-	inner->m_index = end->m_index;
+	let iter = cnx_range_into_iter(*self);
+	let_mut inner = static_cast(CnxRangeIdentifier(RANGE_T, Iterator)*)(iter.m_self);
+	inner->m_index = ___RANGE_END_INDEX;
 	return iter;
 }
 
@@ -161,5 +164,6 @@ CnxRangeIdentifier(RANGE_T, default_filter)(__attr(maybe_unused) const RANGE_T*
 }
 
 	#undef ___DISABLE_IF_NULL
+	#undef ___RANGE_END_INDEX
 	#undef CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
 #endif // defined(RANGE_T) && RANGE_IMPL
@@ -0,0 +1,210 @@
+/// @file SlotMapDecl.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides the type and function declarations for a template
+/// instantiation of `CnxSlotMap(T)`
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <Cnx/Def.h>
+
+#if defined(SLOT_MAP_T) && SLOT_MAP_DECL
+
+	#define COLLECTION_DATA_ELEMENT	   SLOT_MAP_T
+	#define COLLECTION_DATA_COLLECTION CnxSlotMap(SLOT_MAP_T)
+	#include <Cnx/CollectionData.h>
+	#undef COLLECTION_DATA_COLLECTION
+	#undef COLLECTION_DATA_ELEMENT
+
+	#define CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS TRUE
+
+	#include <Cnx/Allocators.h>
+	#include <Cnx/BasicTypes.h>
+	#include <Cnx/Iterator.h>
+	#include <Cnx/Platform.h>
+	#include <Cnx/slot_map/SlotMapDef.h>
+
+typedef struct CnxSlotMapIdentifier(SLOT_MAP_T, vtable) CnxSlotMapIdentifier(SLOT_MAP_T, vtable);
+
+typedef struct CnxSlotMap(SLOT_MAP_T) {
+	/// The elements, stored contiguously
+	SLOT_MAP_T* m_dense;
+	/// The index of the slot referring to each element in `m_dense`, used to patch up the slot
+	/// of the element moved into a removed element's position
+	u32* m_dense_to_slot;
+	CnxSlotMapSlot* m_slots;
+	usize m_size;
+	usize m_capacity;
+	usize m_num_slots;
+	usize m_slots_capacity;
+	u32 m_free_head;
+	CnxAllocator m_allocator;
+	const CnxCollectionData(CnxSlotMap(SLOT_MAP_T)) * m_data;
+	const CnxSlotMapIdentifier(SLOT_MAP_T, vtable) * m_vtable;
+}
+CnxSlotMap(SLOT_MAP_T);
+
+typedef struct CnxSlotMapIterator(SLOT_MAP_T) {
+	usize m_index;
+	CnxSlotMap(SLOT_MAP_T) * m_map;
+}
+CnxSlotMapIterator(SLOT_MAP_T);
+
+__attr(nodiscard) SLOT_MAP_STATIC SLOT_MAP_INLINE CnxSlotMap(SLOT_MAP_T)
+	CnxSlotMapIdentifier(SLOT_MAP_T, new)(void);
+__attr(nodiscard) SLOT_MAP_STATIC SLOT_MAP_INLINE CnxSlotMap(SLOT_MAP_T)
+	CnxSlotMapIdentifier(SLOT_MAP_T, new_with_allocator)(CnxAllocator allocator);
+__attr(nodiscard) __attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE CnxSlotMap(SLOT_MAP_T)
+	CnxSlotMapIdentifier(SLOT_MAP_T, new_with_collection_data)(
+		const CnxCollectionData(CnxSlotMap(SLOT_MAP_T)) * restrict data)
+		cnx_disable_if(!data,
+					   "Can't create a CnxSlotMap(T) with null CnxCollectionData. To create a "
+					   "CnxSlotMap(T) with defaulted CnxCollectionData, use cnx_slot_map_new()");
+__attr(nodiscard) __attr(not_null(2)) SLOT_MAP_STATIC SLOT_MAP_INLINE CnxSlotMap(SLOT_MAP_T)
+	CnxSlotMapIdentifier(SLOT_MAP_T, new_with_allocator_and_collection_data)(
+		CnxAllocator allocator,
+		const CnxCollectionData(CnxSlotMap(SLOT_MAP_T)) * restrict data)
+		cnx_disable_if(!data,
+					   "Can't create a CnxSlotMap(T) with null CnxCollectionData. To create a "
+					   "CnxSlotMap(T) with a custom allocator and defaulted CnxCollectionData, "
+					   "use cnx_slot_map_new_with_allocator()");
+__attr(nodiscard) SLOT_MAP_STATIC SLOT_MAP_INLINE CnxSlotMap(SLOT_MAP_T)
+	CnxSlotMapIdentifier(SLOT_MAP_T, new_with_capacity)(usize capacity);
+__attr(nodiscard) SLOT_MAP_STATIC SLOT_MAP_INLINE CnxSlotMap(SLOT_MAP_T)
+	CnxSlotMapIdentifier(SLOT_MAP_T, new_with_capacity_and_allocator)(usize capacity,
+																	  CnxAllocator allocator);
+__attr(nodiscard) __attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE CnxSlotMap(SLOT_MAP_T)
+	CnxSlotMapIdentifier(SLOT_MAP_T, clone)(const CnxSlotMap(SLOT_MAP_T) * restrict self)
+		cnx_disable_if(!(self->m_data->m_copy_constructor),
+					   "Can't clone a CnxSlotMap(T) with elements that aren't copyable (no "
+					   "element copy constructor defined)");
+
+	#define ___DISABLE_IF_NULL(self) \
+		cnx_disable_if(!(self), "Can't perform an operation on a null slot map")
+
+__attr(nodiscard) __attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE usize
+	CnxSlotMapIdentifier(SLOT_MAP_T, size)(const CnxSlotMap(SLOT_MAP_T) * restrict self)
+		___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE usize
+	CnxSlotMapIdentifier(SLOT_MAP_T, capacity)(const CnxSlotMap(SLOT_MAP_T) * restrict self)
+		___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE bool
+	CnxSlotMapIdentifier(SLOT_MAP_T, is_empty)(const CnxSlotMap(SLOT_MAP_T) * restrict self)
+		___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE bool
+	CnxSlotMapIdentifier(SLOT_MAP_T, contains)(const CnxSlotMap(SLOT_MAP_T) * restrict self,
+											   CnxSlotMapHandle handle) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE const SLOT_MAP_T*
+	CnxSlotMapIdentifier(SLOT_MAP_T, get_const)(const CnxSlotMap(SLOT_MAP_T) * restrict self,
+												CnxSlotMapHandle handle) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE SLOT_MAP_T*
+	CnxSlotMapIdentifier(SLOT_MAP_T, get_mut)(CnxSlotMap(SLOT_MAP_T) * restrict self,
+											  CnxSlotMapHandle handle) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) __attr(returns_not_null) SLOT_MAP_STATIC SLOT_MAP_INLINE
+	const SLOT_MAP_T* CnxSlotMapIdentifier(SLOT_MAP_T, at_const)(
+		const CnxSlotMap(SLOT_MAP_T) * restrict self,
+		CnxSlotMapHandle handle) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) __attr(returns_not_null) SLOT_MAP_STATIC SLOT_MAP_INLINE
+	SLOT_MAP_T* CnxSlotMapIdentifier(SLOT_MAP_T, at_mut)(CnxSlotMap(SLOT_MAP_T) * restrict self,
+														 CnxSlotMapHandle handle)
+		___DISABLE_IF_NULL(self);
+__attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE CnxSlotMapHandle
+	CnxSlotMapIdentifier(SLOT_MAP_T, insert)(CnxSlotMap(SLOT_MAP_T) * restrict self,
+											 SLOT_MAP_T element) ___DISABLE_IF_NULL(self);
+__attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE bool
+	CnxSlotMapIdentifier(SLOT_MAP_T, erase)(CnxSlotMap(SLOT_MAP_T) * restrict self,
+											CnxSlotMapHandle handle) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE CnxSlotMapHandle
+	CnxSlotMapIdentifier(SLOT_MAP_T, handle_at)(const CnxSlotMap(SLOT_MAP_T) * restrict self,
+												usize index) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE const SLOT_MAP_T*
+	CnxSlotMapIdentifier(SLOT_MAP_T, data)(const CnxSlotMap(SLOT_MAP_T) * restrict self)
+		___DISABLE_IF_NULL(self);
+__attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE void
+	CnxSlotMapIdentifier(SLOT_MAP_T, reserve)(CnxSlotMap(SLOT_MAP_T) * restrict self,
+											  usize new_capacity) ___DISABLE_IF_NULL(self);
+__attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE void
+	CnxSlotMapIdentifier(SLOT_MAP_T, clear)(CnxSlotMap(SLOT_MAP_T) * restrict self)
+		___DISABLE_IF_NULL(self);
+__attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE void
+	CnxSlotMapIdentifier(SLOT_MAP_T, free)(void* restrict self) ___DISABLE_IF_NULL(self);
+
+DeclIntoCnxForwardIterator(CnxSlotMap(SLOT_MAP_T),
+						   Ref(SLOT_MAP_T),
+						   CnxSlotMapIdentifier(SLOT_MAP_T, into_iter));
+DeclIntoCnxForwardIterator(CnxSlotMap(SLOT_MAP_T),
+						   ConstRef(SLOT_MAP_T),
+						   CnxSlotMapIdentifier(SLOT_MAP_T, into_const_iter));
+
+__attr(nodiscard) __attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE
+	CnxForwardIterator(Ref(SLOT_MAP_T))
+		CnxSlotMapIdentifier(SLOT_MAP_T, begin)(CnxSlotMap(SLOT_MAP_T) * restrict self)
+			___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE
+	CnxForwardIterator(Ref(SLOT_MAP_T))
+		CnxSlotMapIdentifier(SLOT_MAP_T, end)(CnxSlotMap(SLOT_MAP_T) * restrict self)
+			___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE
+	CnxForwardIterator(ConstRef(SLOT_MAP_T))
+		CnxSlotMapIdentifier(SLOT_MAP_T, cbegin)(const CnxSlotMap(SLOT_MAP_T) * restrict self)
+			___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) SLOT_MAP_STATIC SLOT_MAP_INLINE
+	CnxForwardIterator(ConstRef(SLOT_MAP_T))
+		CnxSlotMapIdentifier(SLOT_MAP_T, cend)(const CnxSlotMap(SLOT_MAP_T) * restrict self)
+			___DISABLE_IF_NULL(self);
+
+typedef struct CnxSlotMapIdentifier(SLOT_MAP_T, vtable) {
+	CnxSlotMap(SLOT_MAP_T) (*const clone)(const CnxSlotMap(SLOT_MAP_T)* restrict self);
+	usize (*const size)(const CnxSlotMap(SLOT_MAP_T)* restrict self);
+	usize (*const capacity)(const CnxSlotMap(SLOT_MAP_T)* restrict self);
+	bool (*const is_empty)(const CnxSlotMap(SLOT_MAP_T)* restrict self);
+	bool (*const contains)(const CnxSlotMap(SLOT_MAP_T)* restrict self, CnxSlotMapHandle handle);
+	const SLOT_MAP_T* (*const get_const)(const CnxSlotMap(SLOT_MAP_T)* restrict self,
+										 CnxSlotMapHandle handle);
+	SLOT_MAP_T* (*const get_mut)(CnxSlotMap(SLOT_MAP_T)* restrict self, CnxSlotMapHandle handle);
+	const SLOT_MAP_T* (*const at_const)(const CnxSlotMap(SLOT_MAP_T)* restrict self,
+										CnxSlotMapHandle handle);
+	SLOT_MAP_T* (*const at_mut)(CnxSlotMap(SLOT_MAP_T)* restrict self, CnxSlotMapHandle handle);
+	CnxSlotMapHandle (*const insert)(CnxSlotMap(SLOT_MAP_T)* restrict self, SLOT_MAP_T element);
+	bool (*const erase)(CnxSlotMap(SLOT_MAP_T)* restrict self, CnxSlotMapHandle handle);
+	CnxSlotMapHandle (*const handle_at)(const CnxSlotMap(SLOT_MAP_T)* restrict self, usize index);
+	const SLOT_MAP_T* (*const data)(const CnxSlotMap(SLOT_MAP_T)* restrict self);
+	void (*const reserve)(CnxSlotMap(SLOT_MAP_T)* restrict self, usize new_capacity);
+	void (*const clear)(CnxSlotMap(SLOT_MAP_T)* restrict self);
+	void (*const free)(void* restrict self);
+	CnxForwardIterator(Ref(SLOT_MAP_T)) (*const into_iter)(
+		const CnxSlotMap(SLOT_MAP_T)* restrict self);
+	CnxForwardIterator(ConstRef(SLOT_MAP_T)) (*const into_const_iter)(
+		const CnxSlotMap(SLOT_MAP_T)* restrict self);
+	CnxForwardIterator(Ref(SLOT_MAP_T)) (*const begin)(CnxSlotMap(SLOT_MAP_T)* restrict self);
+	CnxForwardIterator(Ref(SLOT_MAP_T)) (*const end)(CnxSlotMap(SLOT_MAP_T)* restrict self);
+	CnxForwardIterator(ConstRef(SLOT_MAP_T)) (*const cbegin)(
+		const CnxSlotMap(SLOT_MAP_T)* restrict self);
+	CnxForwardIterator(ConstRef(SLOT_MAP_T)) (*const cend)(
+		const CnxSlotMap(SLOT_MAP_T)* restrict self);
+}
+CnxSlotMapIdentifier(SLOT_MAP_T, vtable);
+
+	#undef ___DISABLE_IF_NULL
+	#undef CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+#endif // defined(SLOT_MAP_T) && SLOT_MAP_DECL
@@ -0,0 +1,340 @@
+/// @file SlotMapDef.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides macro definitions for implementing and working with
+/// `CnxSlotMap(T)`
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <Cnx/BasicTypes.h>
+#include <Cnx/Def.h>
+
+#ifndef CNX_SLOT_MAP_DEF
+	#define CNX_SLOT_MAP_DEF
+
+	#define CnxSlotMap(T)						  CONCAT2(CnxSlotMap, T)
+	#define CnxSlotMapIterator(T)				  CONCAT2(CnxSlotMap(T), Iterator)
+	#define CnxSlotMapIdentifier(T, Identifier) CONCAT3(cnx_slot_map_, T, CONCAT2(_, Identifier))
+
+/// @brief A handle to an element stored in a `CnxSlotMap(T)`.
+///
+/// A handle stays valid for as long as the element it was returned for remains in the map,
+/// regardless of any other insertions or removals. Once the element is removed, the handle is
+/// stale and lookups through it will fail, even if its slot has since been reused.
+/// @ingroup cnx_slot_map
+typedef struct CnxSlotMapHandle {
+	/// @brief The index of the slot the element occupies
+	u32 m_index;
+	/// @brief The generation of the slot at the time the element was inserted
+	u32 m_generation;
+} CnxSlotMapHandle;
+
+/// @brief A slot in the indirection table of a `CnxSlotMap(T)`.
+///
+/// An odd generation means the slot is occupied and `m_index` is the position of its element in
+/// the dense storage. An even generation means the slot is free and `m_index` is the next slot in
+/// the free-list.
+/// @ingroup cnx_slot_map
+typedef struct CnxSlotMapSlot {
+	u32 m_index;
+	u32 m_generation;
+} CnxSlotMapSlot;
+
+	/// @brief A `CnxSlotMapHandle` that never refers to an element in any `CnxSlotMap(T)`
+	/// @ingroup cnx_slot_map
+	#define CNX_SLOT_MAP_NULL_HANDLE ((CnxSlotMapHandle){.m_index = 0, .m_generation = 0})
+
+	/// @brief Returns whether the two `CnxSlotMapHandle`s refer to the same element
+	///
+	/// @param lhs - The first handle to compare
+	/// @param rhs - The second handle to compare
+	///
+	/// @return whether the handles are equal
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_handle_equals(lhs, rhs) \
+		((lhs).m_index == (rhs).m_index && (lhs).m_generation == (rhs).m_generation)
+
+	/// @brief Creates a new `CnxSlotMap(T)` with defaulted associated functions and allocator
+	///
+	/// @param T - The type to store in the map
+	///
+	/// @return a new `CnxSlotMap(T)`
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_new(T) CnxSlotMapIdentifier(T, new)()
+	/// @brief Creates a new `CnxSlotMap(T)` with defaulted associated functions that will use the
+	/// given allocator for its storage
+	///
+	/// @param T - The type to store in the map
+	/// @param allocator - The `CnxAllocator` to allocate memory with
+	///
+	/// @return a new `CnxSlotMap(T)`
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_new_with_allocator(T, allocator) \
+		CnxSlotMapIdentifier(T, new_with_allocator)(allocator)
+	/// @brief Creates a new `CnxSlotMap(T)` with provided associated functions
+	///
+	/// @param T - The type to store in the map
+	/// @param collection_data_ptr - The `CnxCollectionData(CnxSlotMap(T))*` containing the
+	/// associated functions for the elements of the map
+	///
+	/// @return a new `CnxSlotMap(T)`
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_new_with_collection_data(T, collection_data_ptr) \
+		CnxSlotMapIdentifier(T, new_with_collection_data)(collection_data_ptr)
+	/// @brief Creates a new `CnxSlotMap(T)` with provided associated functions that will use the
+	/// given allocator for its storage
+	///
+	/// @param T - The type to store in the map
+	/// @param allocator - The `CnxAllocator` to allocate memory with
+	/// @param collection_data_ptr - The `CnxCollectionData(CnxSlotMap(T))*` containing the
+	/// associated functions for the elements of the map
+	///
+	/// @return a new `CnxSlotMap(T)`
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_new_with_allocator_and_collection_data(T, allocator, collection_data_ptr) \
+		CnxSlotMapIdentifier(T, new_with_allocator_and_collection_data)(allocator,                \
+																		collection_data_ptr)
+	/// @brief Creates a new `CnxSlotMap(T)` with defaulted associated functions and allocator,
+	/// with enough storage reserved for at least `capacity` elements
+	///
+	/// @param T - The type to store in the map
+	/// @param capacity - The number of elements to reserve storage for
+	///
+	/// @return a new `CnxSlotMap(T)`
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_new_with_capacity(T, capacity) \
+		CnxSlotMapIdentifier(T, new_with_capacity)(capacity)
+	/// @brief Creates a new `CnxSlotMap(T)` with defaulted associated functions that will use the
+	/// given allocator for its storage, with enough storage reserved for at least `capacity`
+	/// elements
+	///
+	/// @param T - The type to store in the map
+	/// @param capacity - The number of elements to reserve storage for
+	/// @param allocator - The `CnxAllocator` to allocate memory with
+	///
+	/// @return a new `CnxSlotMap(T)`
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_new_with_capacity_and_allocator(T, capacity, allocator) \
+		CnxSlotMapIdentifier(T, new_with_capacity_and_allocator)(capacity, allocator)
+	/// @brief Clones the given `CnxSlotMap(T)`
+	///
+	/// Creates a deep copy of the given `CnxSlotMap(T)` calling the associated copy constructor
+	/// for each element stored in it. Handles into `self` are also valid for the clone.
+	///
+	/// @param self - The `CnxSlotMap(T)` to clone
+	///
+	/// @return a clone of `self`
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_clone(self) (self).m_vtable->clone(&(self))
+	/// @brief Returns the number of elements in the given `CnxSlotMap(T)`
+	///
+	/// @param self - The `CnxSlotMap(T)` to get the size of
+	///
+	/// @return the number of elements in the map
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_size(self) (self).m_vtable->size(&(self))
+	/// @brief Returns the number of elements the given `CnxSlotMap(T)` can store before needing
+	/// to grow its dense storage
+	///
+	/// @param self - The `CnxSlotMap(T)` to get the capacity of
+	///
+	/// @return the capacity of the map
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_capacity(self) (self).m_vtable->capacity(&(self))
+	/// @brief Returns whether the given `CnxSlotMap(T)` is empty
+	///
+	/// @param self - The `CnxSlotMap(T)` to check for emptiness
+	///
+	/// @return `true` if the map contains no elements, `false` otherwise
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_is_empty(self) (self).m_vtable->is_empty(&(self))
+	/// @brief Returns whether the given `CnxSlotMapHandle` refers to an element currently stored
+	/// in the `CnxSlotMap(T)`
+	///
+	/// @param self - The `CnxSlotMap(T)` to check
+	/// @param handle - The `CnxSlotMapHandle` to check
+	///
+	/// @return `true` if `handle` is live, `false` if it is stale or null
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_contains(self, handle) (self).m_vtable->contains(&(self), (handle))
+	/// @brief Returns a pointer to the element referred to by `handle` in the given
+	/// `CnxSlotMap(T)`, or `nullptr` if `handle` is stale
+	///
+	/// @param self - The `CnxSlotMap(T)` to look up the element in
+	/// @param handle - The `CnxSlotMapHandle` of the element
+	///
+	/// @return a pointer to the element, or `nullptr`
+	/// @note The returned pointer is invalidated by any insertion into or removal from the map
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_get(self, handle) (self).m_vtable->get_const(&(self), (handle))
+	/// @brief Returns a mutable pointer to the element referred to by `handle` in the given
+	/// `CnxSlotMap(T)`, or `nullptr` if `handle` is stale
+	///
+	/// @param self - The `CnxSlotMap(T)` to look up the element in
+	/// @param handle - The `CnxSlotMapHandle` of the element
+	///
+	/// @return a pointer to the element, or `nullptr`
+	/// @note The returned pointer is invalidated by any insertion into or removal from the map
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_get_mut(self, handle) (self).m_vtable->get_mut(&(self), (handle))
+	/// @brief Returns the element referred to by `handle` in the given `CnxSlotMap(T)`
+	///
+	/// @param self - The `CnxSlotMap(T)` to get the element from
+	/// @param handle - The `CnxSlotMapHandle` of the element
+	///
+	/// @return the element referred to by `handle`
+	/// @note `handle` must be live
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_at(self, handle) *((self).m_vtable->at_const(&(self), (handle)))
+	/// @brief Returns the element referred to by `handle` in the given `CnxSlotMap(T)`, as an
+	/// lvalue
+	///
+	/// @param self - The `CnxSlotMap(T)` to get the element from
+	/// @param handle - The `CnxSlotMapHandle` of the element
+	///
+	/// @return the element referred to by `handle`
+	/// @note `handle` must be live
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_at_mut(self, handle) *((self).m_vtable->at_mut(&(self), (handle)))
+	/// @brief Inserts the given element into the `CnxSlotMap(T)`, in amortized O(1)
+	///
+	/// The element is appended to the dense storage, and a slot is taken from the free-list (or
+	/// a new slot created, if the free-list is empty) to refer to it.
+	///
+	/// @param self - The `CnxSlotMap(T)` to insert into
+	/// @param element - The element to insert
+	///
+	/// @return the `CnxSlotMapHandle` referring to the inserted element
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_insert(self, element) (self).m_vtable->insert(&(self), (element))
+	/// @brief Removes the element referred to by `handle` from the given `CnxSlotMap(T)`, in O(1)
+	///
+	/// The last element of the dense storage is moved into the removed element's position, so
+	/// removal never shifts the remaining elements. The slot's generation is advanced, so
+	/// `handle` (and any copies of it) will be stale from here on.
+	///
+	/// @param self - The `CnxSlotMap(T)` to remove from
+	/// @param handle - The `CnxSlotMapHandle` of the element to remove
+	///
+	/// @return `true` if an element was removed, `false` if `handle` was stale
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_erase(self, handle) (self).m_vtable->erase(&(self), (handle))
+	/// @brief Returns the `CnxSlotMapHandle` of the element at position `index` in the dense
+	/// storage of the given `CnxSlotMap(T)`
+	///
+	/// Useful for recovering handles while iterating over the map.
+	///
+	/// @param self - The `CnxSlotMap(T)` to get the handle from
+	/// @param index - The position of the element in the dense storage
+	///
+	/// @return the handle referring to the element at `index`
+	/// @note `index` must be less than the size of the map
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_handle_at(self, index) (self).m_vtable->handle_at(&(self), (index))
+	/// @brief Returns a pointer to the dense storage of the given `CnxSlotMap(T)`
+	///
+	/// The elements are stored contiguously, in no particular order.
+	///
+	/// @param self - The `CnxSlotMap(T)` to get the storage of
+	///
+	/// @return a pointer to the first element in the dense storage
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_data(self) (self).m_vtable->data(&(self))
+	/// @brief Reserves enough storage for at least `new_capacity` elements in the given
+	/// `CnxSlotMap(T)`
+	///
+	/// @param self - The `CnxSlotMap(T)` to reserve storage for
+	/// @param new_capacity - The number of elements to reserve storage for
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_reserve(self, new_capacity) \
+		(self).m_vtable->reserve(&(self), (new_capacity))
+	/// @brief Removes all elements from the given `CnxSlotMap(T)`.
+	///
+	/// Every outstanding handle becomes stale. The map's storage is kept for reuse.
+	///
+	/// @param self - The `CnxSlotMap(T)` to clear
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_clear(self) (self).m_vtable->clear(&(self))
+	/// @brief Frees the given `CnxSlotMap(T)`, calling the element destructor on each element
+	/// and freeing its storage
+	///
+	/// @param self - The `CnxSlotMap(T)` to free
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_free(self) (self).m_vtable->free(&(self))
+	/// @brief Returns a `CnxForwardIterator` into the mutable iteration of the given
+	/// `CnxSlotMap(T)`, starting at the beginning of its dense storage
+	///
+	/// @param self - The `CnxSlotMap(T)` to get an iterator to
+	///
+	/// @return a forward iterator at the beginning of the map
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_begin(self) (self).m_vtable->begin(&(self))
+	/// @brief Returns a `CnxForwardIterator` into the mutable iteration of the given
+	/// `CnxSlotMap(T)`, positioned at the end of the iteration
+	///
+	/// @param self - The `CnxSlotMap(T)` to get an iterator to
+	///
+	/// @return a forward iterator at the end of the map
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_end(self) (self).m_vtable->end(&(self))
+	/// @brief Returns a `CnxForwardIterator` into the const iteration of the given
+	/// `CnxSlotMap(T)`, starting at the beginning of its dense storage
+	///
+	/// @param self - The `CnxSlotMap(T)` to get an iterator to
+	///
+	/// @return a forward iterator at the beginning of the map
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_cbegin(self) (self).m_vtable->cbegin(&(self))
+	/// @brief Returns a `CnxForwardIterator` into the const iteration of the given
+	/// `CnxSlotMap(T)`, positioned at the end of the iteration
+	///
+	/// @param self - The `CnxSlotMap(T)` to get an iterator to
+	///
+	/// @return a forward iterator at the end of the map
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_cend(self) (self).m_vtable->cend(&(self))
+	/// @brief Returns a `CnxForwardIterator` into the mutable iteration of the given
+	/// `CnxSlotMap(T)`
+	///
+	/// @param self - The `CnxSlotMap(T)` to get an iterator to
+	///
+	/// @return a forward iterator into the map
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_into_iter(self) (self).m_vtable->into_iter(&(self))
+	/// @brief Returns a `CnxForwardIterator` into the const iteration of the given
+	/// `CnxSlotMap(T)`
+	///
+	/// @param self - The `CnxSlotMap(T)` to get an iterator to
+	///
+	/// @return a forward iterator into the map
+	/// @ingroup cnx_slot_map
+	#define cnx_slot_map_into_const_iter(self) (self).m_vtable->into_const_iter(&(self))
+
+	/// @brief declare a `CnxSlotMap(T)` variable with this attribute to have `cnx_slot_map_free`
+	/// automatically called on it at scope end
+	///
+	/// @param T - The element type of the `CnxSlotMap(T)` instantiation
+	/// @ingroup cnx_slot_map
+	#define CnxScopedSlotMap(T) scoped(CnxSlotMapIdentifier(T, free))
+
+#endif // CNX_SLOT_MAP_DEF
@@ -0,0 +1,548 @@
+/// @file SlotMapImpl.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides the function definitions for a template instantiation of
+/// `CnxSlotMap(T)`
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <Cnx/Def.h>
+
+#if defined(SLOT_MAP_T) && SLOT_MAP_IMPL
+
+	#define CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS TRUE
+
+	#include <Cnx/Allocators.h>
+	#include <Cnx/Assert.h>
+	#include <Cnx/BasicTypes.h>
+	#include <Cnx/CollectionData.h>
+	#include <Cnx/Iterator.h>
+	#include <Cnx/Platform.h>
+	#include <Cnx/slot_map/SlotMapDef.h>
+
+	#define ___SLOT_MAP					  CnxSlotMap(SLOT_MAP_T)
+	#define ___SLOT_MAP_ITERATOR		  CnxSlotMapIterator(SLOT_MAP_T)
+	#define ___SLOT_MAP_IDENT(Identifier) CnxSlotMapIdentifier(SLOT_MAP_T, Identifier)
+	/// Marks the end of the free-list
+	#define ___SLOT_MAP_FREE_LIST_END cnx_max_value(u32)
+	/// Handles address slots with a `u32` index, so this is the maximum number of slots (and thus
+	/// elements) a map can have
+	#define ___SLOT_MAP_MAX_SLOTS (static_cast(usize)(cnx_max_value(u32)))
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE ___SLOT_MAP_ITERATOR
+	___SLOT_MAP_IDENT(iterator_new)(const ___SLOT_MAP* restrict self);
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE Ref(SLOT_MAP_T)
+	___SLOT_MAP_IDENT(iterator_next)(CnxForwardIterator(Ref(SLOT_MAP_T)) * restrict self);
+SLOT_MAP_STATIC SLOT_MAP_INLINE Ref(SLOT_MAP_T)
+	___SLOT_MAP_IDENT(iterator_current)(const CnxForwardIterator(Ref(SLOT_MAP_T)) * restrict self);
+SLOT_MAP_STATIC SLOT_MAP_INLINE bool
+___SLOT_MAP_IDENT(iterator_equals)(const CnxForwardIterator(Ref(SLOT_MAP_T)) * restrict self,
+								   const CnxForwardIterator(Ref(SLOT_MAP_T)) * restrict rhs);
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE ConstRef(SLOT_MAP_T)
+	___SLOT_MAP_IDENT(iterator_cnext)(CnxForwardIterator(ConstRef(SLOT_MAP_T)) * restrict self);
+SLOT_MAP_STATIC SLOT_MAP_INLINE ConstRef(SLOT_MAP_T) ___SLOT_MAP_IDENT(iterator_ccurrent)(
+	const CnxForwardIterator(ConstRef(SLOT_MAP_T)) * restrict self);
+SLOT_MAP_STATIC SLOT_MAP_INLINE bool
+___SLOT_MAP_IDENT(iterator_cequals)(const CnxForwardIterator(ConstRef(SLOT_MAP_T)) * restrict self,
+									const CnxForwardIterator(ConstRef(SLOT_MAP_T)) * restrict rhs);
+
+ImplIntoCnxForwardIterator(___SLOT_MAP,
+						   Ref(SLOT_MAP_T),
+						   ___SLOT_MAP_IDENT(into_iter),
+						   ___SLOT_MAP_IDENT(iterator_new),
+						   ___SLOT_MAP_IDENT(iterator_next),
+						   ___SLOT_MAP_IDENT(iterator_current),
+						   ___SLOT_MAP_IDENT(iterator_equals));
+ImplIntoCnxForwardIterator(___SLOT_MAP,
+						   ConstRef(SLOT_MAP_T),
+						   ___SLOT_MAP_IDENT(into_const_iter),
+						   ___SLOT_MAP_IDENT(iterator_new),
+						   ___SLOT_MAP_IDENT(iterator_cnext),
+						   ___SLOT_MAP_IDENT(iterator_ccurrent),
+						   ___SLOT_MAP_IDENT(iterator_cequals));
+
+__attr(always_inline) static inline SLOT_MAP_T
+	___SLOT_MAP_IDENT(default_constructor)(__attr(maybe_unused) CnxAllocator allocator) {
+	return (SLOT_MAP_T){0};
+}
+
+__attr(always_inline) __attr(not_null(1)) static inline SLOT_MAP_T
+	___SLOT_MAP_IDENT(default_copy_constructor)(const SLOT_MAP_T* restrict element,
+												__attr(maybe_unused) CnxAllocator allocator) {
+	return *element;
+}
+
+__attr(always_inline) __attr(not_null(1)) static inline void ___SLOT_MAP_IDENT(
+	default_destructor)(__attr(maybe_unused)
+							SLOT_MAP_T* restrict element, /** NOLINT(readability-non-const-parameter)**/
+						__attr(maybe_unused) CnxAllocator allocator) {
+}
+
+static const struct ___SLOT_MAP_IDENT(vtable) ___SLOT_MAP_IDENT(vtable_impl) = {
+	.clone = ___SLOT_MAP_IDENT(clone),
+	.size = ___SLOT_MAP_IDENT(size),
+	.capacity = ___SLOT_MAP_IDENT(capacity),
+	.is_empty = ___SLOT_MAP_IDENT(is_empty),
+	.contains = ___SLOT_MAP_IDENT(contains),
+	.get_const = ___SLOT_MAP_IDENT(get_const),
+	.get_mut = ___SLOT_MAP_IDENT(get_mut),
+	.at_const = ___SLOT_MAP_IDENT(at_const),
+	.at_mut = ___SLOT_MAP_IDENT(at_mut),
+	.insert = ___SLOT_MAP_IDENT(insert),
+	.erase = ___SLOT_MAP_IDENT(erase),
+	.handle_at = ___SLOT_MAP_IDENT(handle_at),
+	.data = ___SLOT_MAP_IDENT(data),
+	.reserve = ___SLOT_MAP_IDENT(reserve),
+	.clear = ___SLOT_MAP_IDENT(clear),
+	.free = ___SLOT_MAP_IDENT(free),
+	.into_iter = ___SLOT_MAP_IDENT(into_iter),
+	.into_const_iter = ___SLOT_MAP_IDENT(into_const_iter),
+	.begin = ___SLOT_MAP_IDENT(begin),
+	.end = ___SLOT_MAP_IDENT(end),
+	.cbegin = ___SLOT_MAP_IDENT(cbegin),
+	.cend = ___SLOT_MAP_IDENT(cend),
+};
+
+static const struct CnxCollectionData(___SLOT_MAP) ___SLOT_MAP_IDENT(default_collection_data)
+	= {.m_constructor = ___SLOT_MAP_IDENT(default_constructor),
+	   .m_copy_constructor = ___SLOT_MAP_IDENT(default_copy_constructor),
+	   .m_destructor = ___SLOT_MAP_IDENT(default_destructor)};
+
+__attr(always_inline) static inline usize
+	___SLOT_MAP_IDENT(get_expanded_capacity)(usize old_capacity) {
+	return old_capacity < 8U ? 8U : (old_capacity * 3U) / 2U;
+}
+
+/// Grows the dense storage of `self` (the elements and their slot back-references) to exactly
+/// `new_capacity` elements
+static inline void
+___SLOT_MAP_IDENT(resize_dense)(___SLOT_MAP* restrict self, usize new_capacity) {
+	cnx_assert(new_capacity <= ___SLOT_MAP_MAX_SLOTS,
+			   "Can't grow a CnxSlotMap(T) beyond the number of elements a handle can address");
+
+	if(self->m_dense == nullptr) {
+		self->m_dense
+			= cnx_allocator_allocate_array_t(SLOT_MAP_T, self->m_allocator, new_capacity);
+		self->m_dense_to_slot
+			= cnx_allocator_allocate_array_t(u32, self->m_allocator, new_capacity);
+	}
+	else {
+		self->m_dense = cnx_allocator_reallocate_array_t(SLOT_MAP_T,
+														 self->m_allocator,
+														 self->m_dense,
+														 self->m_capacity,
+														 new_capacity);
+		self->m_dense_to_slot = cnx_allocator_reallocate_array_t(u32,
+																 self->m_allocator,
+																 self->m_dense_to_slot,
+																 self->m_capacity,
+																 new_capacity);
+	}
+	self->m_capacity = new_capacity;
+}
+
+/// Grows the slot table of `self` to exactly `new_capacity` slots
+static inline void
+___SLOT_MAP_IDENT(resize_slots)(___SLOT_MAP* restrict self, usize new_capacity) {
+	cnx_assert(new_capacity <= ___SLOT_MAP_MAX_SLOTS,
+			   "Can't grow a CnxSlotMap(T) beyond the number of slots a handle can address");
+
+	if(self->m_slots == nullptr) {
+		self->m_slots
+			= cnx_allocator_allocate_array_t(CnxSlotMapSlot, self->m_allocator, new_capacity);
+	}
+	else {
+		self->m_slots = cnx_allocator_reallocate_array_t(CnxSlotMapSlot,
+														 self->m_allocator,
+														 self->m_slots,
+														 self->m_slots_capacity,
+														 new_capacity);
+	}
+	self->m_slots_capacity = new_capacity;
+}
+
+/// Returns the slot `handle` refers to, or `nullptr` if `handle` is stale
+__attr(always_inline) static inline const CnxSlotMapSlot*
+	___SLOT_MAP_IDENT(live_slot)(const ___SLOT_MAP* restrict self, CnxSlotMapHandle handle) {
+	if(static_cast(usize)(handle.m_index) >= self->m_num_slots) {
+		return nullptr;
+	}
+
+	// live handles always carry an odd generation, so a freed (even) slot or the null handle can
+	// never match
+	let slot = &(self->m_slots[handle.m_index]);
+	return slot->m_generation == handle.m_generation && (handle.m_generation & 1U) == 1U ?
+			   slot :
+			   nullptr;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE ___SLOT_MAP ___SLOT_MAP_IDENT(new)(void) {
+	return cnx_slot_map_new_with_allocator_and_collection_data(
+		SLOT_MAP_T,
+		DEFAULT_ALLOCATOR,
+		&___SLOT_MAP_IDENT(default_collection_data));
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE ___SLOT_MAP
+	___SLOT_MAP_IDENT(new_with_allocator)(CnxAllocator allocator) {
+	return cnx_slot_map_new_with_allocator_and_collection_data(
+		SLOT_MAP_T,
+		allocator,
+		&___SLOT_MAP_IDENT(default_collection_data));
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE ___SLOT_MAP
+	___SLOT_MAP_IDENT(new_with_collection_data)(const CnxCollectionData(___SLOT_MAP)
+													* restrict data) {
+	return cnx_slot_map_new_with_allocator_and_collection_data(SLOT_MAP_T,
+															   DEFAULT_ALLOCATOR,
+															   data);
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE ___SLOT_MAP
+	___SLOT_MAP_IDENT(new_with_allocator_and_collection_data)(
+		CnxAllocator allocator,
+		const CnxCollectionData(___SLOT_MAP) * restrict data) {
+	let map = (___SLOT_MAP){.m_dense = nullptr,
+							.m_dense_to_slot = nullptr,
+							.m_slots = nullptr,
+							.m_size = 0,
+							.m_capacity = 0,
+							.m_num_slots = 0,
+							.m_slots_capacity = 0,
+							.m_free_head = ___SLOT_MAP_FREE_LIST_END,
+							.m_allocator = allocator,
+							.m_data = data,
+							.m_vtable = &___SLOT_MAP_IDENT(vtable_impl)};
+	cnx_assert(map.m_data->m_destructor != nullptr, "Element destructor cannot be null");
+
+	return map;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE ___SLOT_MAP
+	___SLOT_MAP_IDENT(new_with_capacity)(usize capacity) {
+	let_mut map = cnx_slot_map_new(SLOT_MAP_T);
+	cnx_slot_map_reserve(map, capacity);
+	return map;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE ___SLOT_MAP
+	___SLOT_MAP_IDENT(new_with_capacity_and_allocator)(usize capacity, CnxAllocator allocator) {
+	let_mut map = cnx_slot_map_new_with_allocator(SLOT_MAP_T, allocator);
+	cnx_slot_map_reserve(map, capacity);
+	return map;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE ___SLOT_MAP
+	___SLOT_MAP_IDENT(clone)(const ___SLOT_MAP* restrict self)
+		cnx_disable_if(!(self->m_data->m_copy_constructor),
+					   "Can't clone a CnxSlotMap(T) with elements that aren't copyable (no "
+					   "element copy constructor defined)") {
+
+	let_mut map = cnx_slot_map_new_with_allocator_and_collection_data(SLOT_MAP_T,
+																	  self->m_allocator,
+																	  self->m_data);
+	if(self->m_capacity != 0) {
+		___SLOT_MAP_IDENT(resize_dense)(&map, self->m_capacity);
+	}
+	if(self->m_slots_capacity != 0) {
+		___SLOT_MAP_IDENT(resize_slots)(&map, self->m_slots_capacity);
+	}
+
+	for(let_mut i = 0U; i < self->m_size; ++i) {
+		map.m_dense[i] = self->m_data->m_copy_constructor(&(self->m_dense[i]), map.m_allocator);
+	}
+	// the slot table is copied verbatim, so handles into `self` stay valid for the clone
+	if(self->m_size != 0) {
+		cnx_memcpy(u32, map.m_dense_to_slot, self->m_dense_to_slot, self->m_size);
+	}
+	if(self->m_num_slots != 0) {
+		cnx_memcpy(CnxSlotMapSlot, map.m_slots, self->m_slots, self->m_num_slots);
+	}
+	map.m_size = self->m_size;
+	map.m_num_slots = self->m_num_slots;
+	map.m_free_head = self->m_free_head;
+
+	return map;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE usize ___SLOT_MAP_IDENT(size)(const ___SLOT_MAP* restrict self) {
+	return self->m_size;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE usize
+	___SLOT_MAP_IDENT(capacity)(const ___SLOT_MAP* restrict self) {
+	return self->m_capacity;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE bool
+	___SLOT_MAP_IDENT(is_empty)(const ___SLOT_MAP* restrict self) {
+	return self->m_size == 0;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE bool
+	___SLOT_MAP_IDENT(contains)(const ___SLOT_MAP* restrict self, CnxSlotMapHandle handle) {
+	return ___SLOT_MAP_IDENT(live_slot)(self, handle) != nullptr;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE const SLOT_MAP_T*
+	___SLOT_MAP_IDENT(get_const)(const ___SLOT_MAP* restrict self, CnxSlotMapHandle handle) {
+	let slot = ___SLOT_MAP_IDENT(live_slot)(self, handle);
+	return slot != nullptr ? &(self->m_dense[slot->m_index]) : nullptr;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE SLOT_MAP_T*
+	___SLOT_MAP_IDENT(get_mut)(___SLOT_MAP* restrict self, CnxSlotMapHandle handle) {
+	let slot = ___SLOT_MAP_IDENT(live_slot)(self, handle);
+	return slot != nullptr ? &(self->m_dense[slot->m_index]) : nullptr;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE const SLOT_MAP_T*
+	___SLOT_MAP_IDENT(at_const)(const ___SLOT_MAP* restrict self, CnxSlotMapHandle handle) {
+	let element = ___SLOT_MAP_IDENT(get_const)(self, handle);
+	cnx_assert(element != nullptr, "cnx_slot_map_at called with a stale handle");
+	return element;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE SLOT_MAP_T*
+	___SLOT_MAP_IDENT(at_mut)(___SLOT_MAP* restrict self, CnxSlotMapHandle handle) {
+	let element = ___SLOT_MAP_IDENT(get_mut)(self, handle);
+	cnx_assert(element != nullptr, "cnx_slot_map_at_mut called with a stale handle");
+	return element;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE CnxSlotMapHandle
+___SLOT_MAP_IDENT(insert)(___SLOT_MAP* restrict self,
+						  SLOT_MAP_T element /** NOLINT(readability-non-const-parameter) **/) {
+	if(self->m_size == self->m_capacity) {
+		___SLOT_MAP_IDENT(resize_dense)(self,
+										___SLOT_MAP_IDENT(get_expanded_capacity)(self->m_capacity));
+	}
+
+	let_mut slot_index = self->m_free_head;
+	if(slot_index != ___SLOT_MAP_FREE_LIST_END) {
+		self->m_free_head = self->m_slots[slot_index].m_index;
+	}
+	else {
+		if(self->m_num_slots == self->m_slots_capacity) {
+			___SLOT_MAP_IDENT(resize_slots)(
+				self,
+				___SLOT_MAP_IDENT(get_expanded_capacity)(self->m_slots_capacity));
+		}
+
+		slot_index = static_cast(u32)(self->m_num_slots);
+		self->m_slots[slot_index] = (CnxSlotMapSlot){.m_index = 0, .m_generation = 0};
+		self->m_num_slots++;
+	}
+
+	let_mut slot = &(self->m_slots[slot_index]);
+	slot->m_index = static_cast(u32)(self->m_size);
+	slot->m_generation++;
+	self->m_dense[self->m_size] = element;
+	self->m_dense_to_slot[self->m_size] = slot_index;
+	self->m_size++;
+
+	return (CnxSlotMapHandle){.m_index = slot_index, .m_generation = slot->m_generation};
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE bool
+	___SLOT_MAP_IDENT(erase)(___SLOT_MAP* restrict self, CnxSlotMapHandle handle) {
+	if(___SLOT_MAP_IDENT(live_slot)(self, handle) == nullptr) {
+		return false;
+	}
+
+	let_mut slot = &(self->m_slots[handle.m_index]);
+	let dense_index = slot->m_index;
+	let last_index = self->m_size - 1U;
+	self->m_data->m_destructor(&(self->m_dense[dense_index]), self->m_allocator);
+
+	// swap-remove: move the last element into the hole and repoint its slot
+	if(dense_index != last_index) {
+		self->m_dense[dense_index] = self->m_dense[last_index];
+		let moved_slot = self->m_dense_to_slot[last_index];
+		self->m_dense_to_slot[dense_index] = moved_slot;
+		self->m_slots[moved_slot].m_index = dense_index;
+	}
+	self->m_size--;
+
+	slot->m_generation++;
+	// a slot whose generation has wrapped around is retired instead of reused, so a stale handle
+	// can never alias a newer element
+	if(slot->m_generation != 0) {
+		slot->m_index = self->m_free_head;
+		self->m_free_head = handle.m_index;
+	}
+
+	return true;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE CnxSlotMapHandle
+	___SLOT_MAP_IDENT(handle_at)(const ___SLOT_MAP* restrict self, usize index) {
+	cnx_assert(index < self->m_size, "cnx_slot_map_handle_at called with index out of bounds");
+
+	let slot_index = self->m_dense_to_slot[index];
+	return (CnxSlotMapHandle){.m_index = slot_index,
+							  .m_generation = self->m_slots[slot_index].m_generation};
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE const SLOT_MAP_T*
+	___SLOT_MAP_IDENT(data)(const ___SLOT_MAP* restrict self) {
+	return self->m_dense;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE void
+	___SLOT_MAP_IDENT(reserve)(___SLOT_MAP* restrict self, usize new_capacity) {
+	if(new_capacity > self->m_capacity) {
+		___SLOT_MAP_IDENT(resize_dense)(self, new_capacity);
+	}
+	if(new_capacity > self->m_slots_capacity) {
+		___SLOT_MAP_IDENT(resize_slots)(self, new_capacity);
+	}
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE void ___SLOT_MAP_IDENT(clear)(___SLOT_MAP* restrict self) {
+	while(self->m_size != 0) {
+		ignore(___SLOT_MAP_IDENT(erase)(self, ___SLOT_MAP_IDENT(handle_at)(self, self->m_size - 1U)));
+	}
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE void ___SLOT_MAP_IDENT(free)(void* restrict self) {
+	let_mut _self = static_cast(___SLOT_MAP*)(self);
+	for(let_mut i = 0U; i < _self->m_size; ++i) {
+		_self->m_data->m_destructor(&(_self->m_dense[i]), _self->m_allocator);
+	}
+
+	if(_self->m_dense != nullptr) {
+		cnx_allocator_deallocate(_self->m_allocator, _self->m_dense);
+		cnx_allocator_deallocate(_self->m_allocator, _self->m_dense_to_slot);
+	}
+	if(_self->m_slots != nullptr) {
+		cnx_allocator_deallocate(_self->m_allocator, _self->m_slots);
+	}
+
+	_self->m_dense = nullptr;
+	_self->m_dense_to_slot = nullptr;
+	_self->m_slots = nullptr;
+	_self->m_size = 0;
+	_self->m_capacity = 0;
+	_self->m_num_slots = 0;
+	_self->m_slots_capacity = 0;
+	_self->m_free_head = ___SLOT_MAP_FREE_LIST_END;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE ___SLOT_MAP_ITERATOR
+	___SLOT_MAP_IDENT(iterator_new)(const ___SLOT_MAP* restrict self) {
+	return (___SLOT_MAP_ITERATOR){.m_index = 0, .m_map = const_cast(___SLOT_MAP*)(self)};
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE Ref(SLOT_MAP_T)
+	___SLOT_MAP_IDENT(iterator_next)(CnxForwardIterator(Ref(SLOT_MAP_T)) * restrict self) {
+	let_mut _self = static_cast(___SLOT_MAP_ITERATOR*)(self->m_self);
+
+	cnx_assert(_self->m_index < _self->m_map->m_size,
+			   "Iterator advanced when iterator is positioned at the end of the iteration "
+			   "(iterator out of bounds)");
+
+	_self->m_index++;
+	if(_self->m_index >= _self->m_map->m_size) {
+		return &(_self->m_map->m_dense[_self->m_map->m_size - 1U]);
+	}
+
+	return &(_self->m_map->m_dense[_self->m_index]);
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE Ref(SLOT_MAP_T)
+	___SLOT_MAP_IDENT(iterator_current)(const CnxForwardIterator(Ref(SLOT_MAP_T)) * restrict self) {
+	let _self = static_cast(const ___SLOT_MAP_ITERATOR*)(self->m_self);
+
+	cnx_assert(_self->m_index < _self->m_map->m_size,
+			   "Iterator value accessed when iterator is positioned at the end of the iteration "
+			   "(iterator out of bounds)");
+
+	return &(_self->m_map->m_dense[_self->m_index]);
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE bool
+___SLOT_MAP_IDENT(iterator_equals)(const CnxForwardIterator(Ref(SLOT_MAP_T)) * restrict self,
+								   const CnxForwardIterator(Ref(SLOT_MAP_T)) * restrict rhs) {
+	let _self = static_cast(const ___SLOT_MAP_ITERATOR*)(self->m_self);
+	let _rhs = static_cast(const ___SLOT_MAP_ITERATOR*)(rhs->m_self);
+
+	return _self->m_map == _rhs->m_map && _self->m_index == _rhs->m_index;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE ConstRef(SLOT_MAP_T)
+	___SLOT_MAP_IDENT(iterator_cnext)(CnxForwardIterator(ConstRef(SLOT_MAP_T)) * restrict self) {
+	return ___SLOT_MAP_IDENT(iterator_next)(
+		static_cast(CnxForwardIterator(Ref(SLOT_MAP_T))*)(self));
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE ConstRef(SLOT_MAP_T) ___SLOT_MAP_IDENT(iterator_ccurrent)(
+	const CnxForwardIterator(ConstRef(SLOT_MAP_T)) * restrict self) {
+	return ___SLOT_MAP_IDENT(iterator_current)(
+		static_cast(const CnxForwardIterator(Ref(SLOT_MAP_T))*)(self));
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE bool
+___SLOT_MAP_IDENT(iterator_cequals)(const CnxForwardIterator(ConstRef(SLOT_MAP_T)) * restrict self,
+									const CnxForwardIterator(ConstRef(SLOT_MAP_T)) * restrict rhs) {
+	return ___SLOT_MAP_IDENT(iterator_equals)(
+		static_cast(const CnxForwardIterator(Ref(SLOT_MAP_T))*)(self),
+		static_cast(const CnxForwardIterator(Ref(SLOT_MAP_T))*)(rhs));
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE CnxForwardIterator(Ref(SLOT_MAP_T))
+	___SLOT_MAP_IDENT(begin)(___SLOT_MAP* restrict self) {
+	return ___SLOT_MAP_IDENT(into_iter)(self);
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE CnxForwardIterator(Ref(SLOT_MAP_T))
+	___SLOT_MAP_IDENT(end)(___SLOT_MAP* restrict self) {
+	let_mut iter = ___SLOT_MAP_IDENT(into_iter)(self);
+	let_mut inner = static_cast(___SLOT_MAP_ITERATOR*)(iter.m_self);
+	inner->m_index = self->m_size;
+	return iter;
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE CnxForwardIterator(ConstRef(SLOT_MAP_T))
+	___SLOT_MAP_IDENT(cbegin)(const ___SLOT_MAP* restrict self) {
+	return ___SLOT_MAP_IDENT(into_const_iter)(self);
+}
+
+SLOT_MAP_STATIC SLOT_MAP_INLINE CnxForwardIterator(ConstRef(SLOT_MAP_T))
+	___SLOT_MAP_IDENT(cend)(const ___SLOT_MAP* restrict self) {
+	let_mut iter = ___SLOT_MAP_IDENT(into_const_iter)(self);
+	let_mut inner = static_cast(___SLOT_MAP_ITERATOR*)(iter.m_self);
+	inner->m_index = self->m_size;
+	return iter;
+}
+
+	#undef ___SLOT_MAP_MAX_SLOTS
+	#undef ___SLOT_MAP_FREE_LIST_END
+	#undef ___SLOT_MAP_IDENT
+	#undef ___SLOT_MAP_ITERATOR
+	#undef ___SLOT_MAP
+	#undef CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+#endif // defined(SLOT_MAP_T) && SLOT_MAP_IMPL
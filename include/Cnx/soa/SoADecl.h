@@ -0,0 +1,142 @@
+/// @file SoADecl.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides the type and function declarations for a template
+/// instantiation of `CnxSoA(T)`
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <Cnx/Def.h>
+
+#if defined(SOA_T) && defined(SOA_FIELDS) && SOA_DECL
+
+	#define CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS TRUE
+
+	#include <Cnx/Allocators.h>
+	#include <Cnx/BasicTypes.h>
+	#include <Cnx/Platform.h>
+	#include <Cnx/mpl/ArgLists.h>
+	#include <Cnx/soa/SoADef.h>
+
+	#define ___SOA_ROW_MEMBER(field)	___SOA_FIELD_TYPE(field) ___SOA_FIELD_NAME(field)
+	#define ___SOA_COLUMN_MEMBER(field) ___SOA_FIELD_TYPE(field) * ___SOA_COLUMN_NAME(field)
+	#define ___SOA_SPAN_TYPEDEF(field)                                  \
+		typedef struct CnxSoASpan(SOA_T, ___SOA_FIELD_NAME(field)) {    \
+			___SOA_FIELD_TYPE(field) * m_data;                          \
+			usize m_size;                                               \
+		}                                                               \
+		CnxSoASpan(SOA_T, ___SOA_FIELD_NAME(field))
+
+/// The element type of the `CnxSoA(T)`, with one member per entry in `SOA_FIELDS`.
+/// This is what elements are gathered into and scattered from when they are accessed as a whole
+typedef struct SOA_T {
+	DELIMIT_LIST(;, APPLY_TO_LIST(___SOA_ROW_MEMBER, SOA_FIELDS))
+}
+SOA_T;
+
+DELIMIT_LIST(;, APPLY_TO_LIST(___SOA_SPAN_TYPEDEF, SOA_FIELDS))
+
+typedef struct CnxSoAIdentifier(SOA_T, vtable) CnxSoAIdentifier(SOA_T, vtable);
+
+typedef struct CnxSoA(SOA_T) {
+	DELIMIT_LIST(;, APPLY_TO_LIST(___SOA_COLUMN_MEMBER, SOA_FIELDS))
+	usize m_size;
+	usize m_capacity;
+	/// The single allocation backing every column
+	void* m_memory;
+	CnxAllocator m_allocator;
+	const CnxSoAIdentifier(SOA_T, vtable) * m_vtable;
+}
+CnxSoA(SOA_T);
+
+__attr(nodiscard) SOA_STATIC SOA_INLINE CnxSoA(SOA_T) CnxSoAIdentifier(SOA_T, new)(void);
+__attr(nodiscard) SOA_STATIC SOA_INLINE CnxSoA(SOA_T)
+	CnxSoAIdentifier(SOA_T, new_with_allocator)(CnxAllocator allocator);
+__attr(nodiscard) SOA_STATIC SOA_INLINE CnxSoA(SOA_T)
+	CnxSoAIdentifier(SOA_T, new_with_capacity)(usize capacity);
+__attr(nodiscard) SOA_STATIC SOA_INLINE CnxSoA(SOA_T)
+	CnxSoAIdentifier(SOA_T, new_with_capacity_and_allocator)(usize capacity,
+															 CnxAllocator allocator);
+
+	#define ___DISABLE_IF_NULL(self) \
+		cnx_disable_if(!(self), "Can't perform an operation on a null CnxSoA(T)")
+
+__attr(nodiscard) __attr(not_null(1)) SOA_STATIC SOA_INLINE CnxSoA(SOA_T)
+	CnxSoAIdentifier(SOA_T, clone)(const CnxSoA(SOA_T) * restrict self) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) SOA_STATIC SOA_INLINE usize
+	CnxSoAIdentifier(SOA_T, size)(const CnxSoA(SOA_T) * restrict self) ___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) SOA_STATIC SOA_INLINE usize
+	CnxSoAIdentifier(SOA_T, capacity)(const CnxSoA(SOA_T) * restrict self)
+		___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) SOA_STATIC SOA_INLINE bool
+	CnxSoAIdentifier(SOA_T, is_empty)(const CnxSoA(SOA_T) * restrict self)
+		___DISABLE_IF_NULL(self);
+__attr(nodiscard) __attr(not_null(1)) SOA_STATIC SOA_INLINE SOA_T
+	CnxSoAIdentifier(SOA_T, get)(const CnxSoA(SOA_T) * restrict self, usize index)
+		___DISABLE_IF_NULL(self);
+__attr(not_null(1)) SOA_STATIC SOA_INLINE void
+	CnxSoAIdentifier(SOA_T, set)(CnxSoA(SOA_T) * restrict self, usize index, SOA_T element)
+		___DISABLE_IF_NULL(self);
+__attr(not_null(1)) SOA_STATIC SOA_INLINE void
+	CnxSoAIdentifier(SOA_T, push_back)(CnxSoA(SOA_T) * restrict self, SOA_T element)
+		___DISABLE_IF_NULL(self);
+__attr(not_null(1)) SOA_STATIC SOA_INLINE void
+	CnxSoAIdentifier(SOA_T, insert)(CnxSoA(SOA_T) * restrict self, SOA_T element, usize index)
+		___DISABLE_IF_NULL(self);
+__attr(not_null(1)) SOA_STATIC SOA_INLINE void
+	CnxSoAIdentifier(SOA_T, erase)(CnxSoA(SOA_T) * restrict self, usize index)
+		___DISABLE_IF_NULL(self);
+__attr(not_null(1)) SOA_STATIC SOA_INLINE void
+	CnxSoAIdentifier(SOA_T, reserve)(CnxSoA(SOA_T) * restrict self, usize new_capacity)
+		___DISABLE_IF_NULL(self);
+__attr(not_null(1)) SOA_STATIC SOA_INLINE void
+	CnxSoAIdentifier(SOA_T, resize)(CnxSoA(SOA_T) * restrict self, usize new_size)
+		___DISABLE_IF_NULL(self);
+__attr(not_null(1)) SOA_STATIC SOA_INLINE void
+	CnxSoAIdentifier(SOA_T, clear)(CnxSoA(SOA_T) * restrict self) ___DISABLE_IF_NULL(self);
+__attr(not_null(1)) SOA_STATIC SOA_INLINE void
+	CnxSoAIdentifier(SOA_T, free)(void* restrict self) ___DISABLE_IF_NULL(self);
+
+typedef struct CnxSoAIdentifier(SOA_T, vtable) {
+	CnxSoA(SOA_T) (*const clone)(const CnxSoA(SOA_T)* restrict self);
+	usize (*const size)(const CnxSoA(SOA_T)* restrict self);
+	usize (*const capacity)(const CnxSoA(SOA_T)* restrict self);
+	bool (*const is_empty)(const CnxSoA(SOA_T)* restrict self);
+	SOA_T (*const get)(const CnxSoA(SOA_T)* restrict self, usize index);
+	void (*const set)(CnxSoA(SOA_T)* restrict self, usize index, SOA_T element);
+	void (*const push_back)(CnxSoA(SOA_T)* restrict self, SOA_T element);
+	void (*const insert)(CnxSoA(SOA_T)* restrict self, SOA_T element, usize index);
+	void (*const erase)(CnxSoA(SOA_T)* restrict self, usize index);
+	void (*const reserve)(CnxSoA(SOA_T)* restrict self, usize new_capacity);
+	void (*const resize)(CnxSoA(SOA_T)* restrict self, usize new_size);
+	void (*const clear)(CnxSoA(SOA_T)* restrict self);
+	void (*const free)(void* restrict self);
+}
+CnxSoAIdentifier(SOA_T, vtable);
+
+	#undef ___DISABLE_IF_NULL
+	#undef ___SOA_SPAN_TYPEDEF
+	#undef ___SOA_COLUMN_MEMBER
+	#undef ___SOA_ROW_MEMBER
+	#undef CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+#endif // defined(SOA_T) && defined(SOA_FIELDS) && SOA_DECL
@@ -0,0 +1,239 @@
+/// @file SoADef.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides macro definitions for implementing and working with
+/// `CnxSoA(T)`
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <Cnx/Assert.h>
+#include <Cnx/Def.h>
+#include <Cnx/Platform.h>
+#include <Cnx/mpl/ArgLists.h>
+
+#ifndef CNX_SOA_DEF
+	#define CNX_SOA_DEF
+
+	#define CnxSoA(T)						CONCAT2(CnxSoA, T)
+	#define CnxSoASpan(T, field)			CONCAT4(CnxSoA(T), _, field, Span)
+	#define CnxSoAIdentifier(T, Identifier) CONCAT3(cnx_soa_, T, CONCAT2(_, Identifier))
+
+	/// @brief Returns the type of an `SOA_FIELDS` entry, `(Type, name)`
+	#define ___SOA_FIELD_TYPE(field) FIRST field
+	/// @brief Returns the name of an `SOA_FIELDS` entry, `(Type, name)`
+	#define ___SOA_FIELD_NAME(field) SECOND field
+	/// @brief Returns the name of the `CnxSoA(T)` member storing the column for the given
+	/// `SOA_FIELDS` entry
+	#define ___SOA_COLUMN_NAME(field) CONCAT2(m_, ___SOA_FIELD_NAME(field))
+
+	/// @brief The alignment, in bytes, of each column of a `CnxSoA(T)`.
+	///
+	/// Every column starts on its own cache line, so column loops never straddle a line shared
+	/// with another column and can use aligned vector loads.
+	/// @ingroup cnx_soa
+	#define CNX_SOA_COLUMN_ALIGNMENT CNX_PLATFORM_CACHE_LINE_SIZE
+
+	/// @brief Creates a new `CnxSoA(T)` with the default allocator
+	///
+	/// @param T - The element type of the `CnxSoA(T)`
+	///
+	/// @return a new `CnxSoA(T)`
+	/// @ingroup cnx_soa
+	#define cnx_soa_new(T) CnxSoAIdentifier(T, new)()
+	/// @brief Creates a new `CnxSoA(T)` that will use the given allocator for its storage
+	///
+	/// @param T - The element type of the `CnxSoA(T)`
+	/// @param allocator - The `CnxAllocator` to allocate memory with
+	///
+	/// @return a new `CnxSoA(T)`
+	/// @ingroup cnx_soa
+	#define cnx_soa_new_with_allocator(T, allocator) \
+		CnxSoAIdentifier(T, new_with_allocator)(allocator)
+	/// @brief Creates a new `CnxSoA(T)` with the default allocator, with enough storage reserved
+	/// for at least `capacity` elements
+	///
+	/// @param T - The element type of the `CnxSoA(T)`
+	/// @param capacity - The number of elements to reserve storage for
+	///
+	/// @return a new `CnxSoA(T)`
+	/// @ingroup cnx_soa
+	#define cnx_soa_new_with_capacity(T, capacity) CnxSoAIdentifier(T, new_with_capacity)(capacity)
+	/// @brief Creates a new `CnxSoA(T)` that will use the given allocator for its storage, with
+	/// enough storage reserved for at least `capacity` elements
+	///
+	/// @param T - The element type of the `CnxSoA(T)`
+	/// @param capacity - The number of elements to reserve storage for
+	/// @param allocator - The `CnxAllocator` to allocate memory with
+	///
+	/// @return a new `CnxSoA(T)`
+	/// @ingroup cnx_soa
+	#define cnx_soa_new_with_capacity_and_allocator(T, capacity, allocator) \
+		CnxSoAIdentifier(T, new_with_capacity_and_allocator)(capacity, allocator)
+	/// @brief Clones the given `CnxSoA(T)`
+	///
+	/// @param self - The `CnxSoA(T)` to clone
+	///
+	/// @return a clone of `self`
+	/// @ingroup cnx_soa
+	#define cnx_soa_clone(self) (self).m_vtable->clone(&(self))
+	/// @brief Returns the number of elements in the given `CnxSoA(T)`
+	///
+	/// @param self - The `CnxSoA(T)` to get the size of
+	///
+	/// @return the number of elements (rows) in `self`
+	/// @ingroup cnx_soa
+	#define cnx_soa_size(self) (self).m_vtable->size(&(self))
+	/// @brief Returns the number of elements the given `CnxSoA(T)` can store before needing to
+	/// reallocate its columns
+	///
+	/// @param self - The `CnxSoA(T)` to get the capacity of
+	///
+	/// @return the capacity of `self`
+	/// @ingroup cnx_soa
+	#define cnx_soa_capacity(self) (self).m_vtable->capacity(&(self))
+	/// @brief Returns whether the given `CnxSoA(T)` is empty
+	///
+	/// @param self - The `CnxSoA(T)` to check for emptiness
+	///
+	/// @return `true` if `self` contains no elements, `false` otherwise
+	/// @ingroup cnx_soa
+	#define cnx_soa_is_empty(self) (self).m_vtable->is_empty(&(self))
+	/// @brief Returns the element at `index` in the given `CnxSoA(T)`, gathered from each column
+	///
+	/// @param self - The `CnxSoA(T)` to get the element from
+	/// @param index - The index of the element to get
+	///
+	/// @return the element at `index`, as a `T`
+	/// @ingroup cnx_soa
+	#define cnx_soa_get(self, index) (self).m_vtable->get(&(self), (index))
+	/// @brief Overwrites the element at `index` in the given `CnxSoA(T)`, scattering its fields
+	/// into each column
+	///
+	/// @param self - The `CnxSoA(T)` to set the element in
+	/// @param index - The index of the element to set
+	/// @param element - The new value of the element
+	/// @ingroup cnx_soa
+	#define cnx_soa_set(self, index, element) (self).m_vtable->set(&(self), (index), (element))
+	/// @brief Appends the given element to the end of the given `CnxSoA(T)`
+	///
+	/// @param self - The `CnxSoA(T)` to append to
+	/// @param element - The element to append
+	/// @ingroup cnx_soa
+	#define cnx_soa_push_back(self, element) (self).m_vtable->push_back(&(self), (element))
+	/// @brief Inserts the given element at `index` in the given `CnxSoA(T)`, shifting every
+	/// following element back by one in each column
+	///
+	/// @param self - The `CnxSoA(T)` to insert into
+	/// @param element - The element to insert
+	/// @param index - The index to insert `element` at
+	/// @ingroup cnx_soa
+	#define cnx_soa_insert(self, element, index) \
+		(self).m_vtable->insert(&(self), (element), (index))
+	/// @brief Removes the element at `index` from the given `CnxSoA(T)`, shifting every following
+	/// element forward by one in each column
+	///
+	/// @param self - The `CnxSoA(T)` to remove from
+	/// @param index - The index of the element to remove
+	/// @ingroup cnx_soa
+	#define cnx_soa_erase(self, index) (self).m_vtable->erase(&(self), (index))
+	/// @brief Reserves enough storage in every column of the given `CnxSoA(T)` for at least
+	/// `new_capacity` elements
+	///
+	/// @param self - The `CnxSoA(T)` to reserve storage for
+	/// @param new_capacity - The number of elements to reserve storage for
+	/// @ingroup cnx_soa
+	#define cnx_soa_reserve(self, new_capacity) (self).m_vtable->reserve(&(self), (new_capacity))
+	/// @brief Resizes the given `CnxSoA(T)` to contain `new_size` elements. New elements are
+	/// zero-initialized in every column
+	///
+	/// @param self - The `CnxSoA(T)` to resize
+	/// @param new_size - The new number of elements
+	/// @ingroup cnx_soa
+	#define cnx_soa_resize(self, new_size) (self).m_vtable->resize(&(self), (new_size))
+	/// @brief Removes all elements from the given `CnxSoA(T)`, keeping its storage for reuse
+	///
+	/// @param self - The `CnxSoA(T)` to clear
+	/// @ingroup cnx_soa
+	#define cnx_soa_clear(self) (self).m_vtable->clear(&(self))
+	/// @brief Frees the storage of the given `CnxSoA(T)`
+	///
+	/// @param self - The `CnxSoA(T)` to free
+	/// @ingroup cnx_soa
+	#define cnx_soa_free(self) (self).m_vtable->free(&(self))
+	/// @brief Returns a pointer to the contiguous, `CNX_SOA_COLUMN_ALIGNMENT` aligned column
+	/// storing `field` for every element of the given `CnxSoA(T)`
+	///
+	/// @param self - The `CnxSoA(T)` to get the column of
+	/// @param field - The name of the field to get the column for
+	///
+	/// @return a pointer to the first element of the column
+	/// @note The returned pointer is invalidated by any operation that reallocates `self`
+	/// @ingroup cnx_soa
+	#define cnx_soa_column(self, field) ((self).CONCAT2(m_, field))
+	/// @brief Returns the value of `field` for the element at `index` in the given `CnxSoA(T)`,
+	/// as an lvalue
+	///
+	/// @param self - The `CnxSoA(T)` to access
+	/// @param field - The name of the field to access
+	/// @param index - The index of the element to access
+	///
+	/// @return the value of `field` for the element at `index`
+	/// @ingroup cnx_soa
+	#define cnx_soa_at(self, field, index) \
+		(cnx_soa_column(self, field)[___cnx_soa_checked_index((index), (self).m_size)])
+
+	/// @brief Asserts that `index` is in bounds for a `CnxSoA(T)` of the given size
+	///
+	/// @param index - The index to check
+	/// @param size - The size of the `CnxSoA(T)`
+	///
+	/// @return `index`
+	__attr(always_inline) __attr(nodiscard) static inline usize
+		___cnx_soa_checked_index(usize index, __attr(maybe_unused) usize size) {
+		cnx_assert(index < size, "cnx_soa_at called with index >= size (index out of bounds)");
+		return index;
+	}
+	/// @brief Returns a `CnxSoASpan(T, field)` viewing the column storing `field` for every
+	/// element of the given `CnxSoA(T)`
+	///
+	/// The span's `m_data` is aligned to `CNX_SOA_COLUMN_ALIGNMENT` and its `m_size` is the size
+	/// of `self`, making it directly suitable for vectorized processing.
+	///
+	/// @param T - The element type of the `CnxSoA(T)`
+	/// @param self - The `CnxSoA(T)` to view a column of
+	/// @param field - The name of the field to view the column for
+	///
+	/// @return a span over the column
+	/// @note The returned span is invalidated by any operation that reallocates `self`
+	/// @ingroup cnx_soa
+	#define cnx_soa_column_span(T, self, field) \
+		((CnxSoASpan(T, field)){.m_data = cnx_soa_column(self, field), .m_size = (self).m_size})
+
+	/// @brief declare a `CnxSoA(T)` variable with this attribute to have `cnx_soa_free`
+	/// automatically called on it at scope end
+	///
+	/// @param T - The element type of the `CnxSoA(T)` instantiation
+	/// @ingroup cnx_soa
+	#define CnxScopedSoA(T) scoped(CnxSoAIdentifier(T, free))
+
+#endif // CNX_SOA_DEF
@@ -0,0 +1,264 @@
+/// @file SoAImpl.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides the function definitions for a template instantiation of
+/// `CnxSoA(T)`
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <Cnx/Def.h>
+
+#if defined(SOA_T) && defined(SOA_FIELDS) && SOA_IMPL
+
+	#define CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS TRUE
+
+	#include <Cnx/Allocators.h>
+	#include <Cnx/Assert.h>
+	#include <Cnx/BasicTypes.h>
+	#include <Cnx/Platform.h>
+	#include <Cnx/mpl/ArgLists.h>
+	#include <Cnx/soa/SoADef.h>
+
+	#define ___SOA						CnxSoA(SOA_T)
+	#define ___SOA_IDENT(Identifier)	CnxSoAIdentifier(SOA_T, Identifier)
+	#define ___SOA_ROUND_UP(num_bytes) \
+		(((num_bytes) + CNX_SOA_COLUMN_ALIGNMENT - 1U) \
+		 & ~static_cast(usize)(CNX_SOA_COLUMN_ALIGNMENT - 1U))
+
+	// Per-column operations, applied to each entry of `SOA_FIELDS` with `APPLY_TO_LIST`.
+	// These refer to the locals of the functions they're expanded in, by name.
+	#define ___SOA_COLUMN_BYTES(field) ___SOA_ROUND_UP(capacity * sizeof(___SOA_FIELD_TYPE(field)))
+	#define ___SOA_ASSIGN_COLUMN(field)                                                          \
+		(resized.___SOA_COLUMN_NAME(field)                                                   \
+		 = static_cast(___SOA_FIELD_TYPE(field)*)(static_cast(void*)(base + offset)),        \
+		 offset += ___SOA_COLUMN_BYTES(field))
+	#define ___SOA_COPY_COLUMN(field)             \
+		cnx_memcpy(___SOA_FIELD_TYPE(field),      \
+				   resized.___SOA_COLUMN_NAME(field), \
+				   self->___SOA_COLUMN_NAME(field),   \
+				   self->m_size)
+	#define ___SOA_STORE(field) \
+		(self->___SOA_COLUMN_NAME(field)[index] = element.___SOA_FIELD_NAME(field))
+	#define ___SOA_LOAD(field) .___SOA_FIELD_NAME(field) = self->___SOA_COLUMN_NAME(field)[index]
+	#define ___SOA_SHIFT_BACK(field)                          \
+		cnx_memmove(___SOA_FIELD_TYPE(field),                 \
+					self->___SOA_COLUMN_NAME(field) + index + 1U, \
+					self->___SOA_COLUMN_NAME(field) + index,      \
+					self->m_size - index)
+	#define ___SOA_SHIFT_FORWARD(field)                           \
+		cnx_memmove(___SOA_FIELD_TYPE(field),                     \
+					self->___SOA_COLUMN_NAME(field) + index,          \
+					self->___SOA_COLUMN_NAME(field) + index + 1U,     \
+					self->m_size - index - 1U)
+	#define ___SOA_ZERO_TAIL(field)                                  \
+		cnx_memset(___SOA_FIELD_TYPE(field),                         \
+				   self->___SOA_COLUMN_NAME(field) + self->m_size,   \
+				   0,                                                \
+				   new_size - self->m_size)
+
+static const struct ___SOA_IDENT(vtable) ___SOA_IDENT(vtable_impl) = {
+	.clone = ___SOA_IDENT(clone),
+	.size = ___SOA_IDENT(size),
+	.capacity = ___SOA_IDENT(capacity),
+	.is_empty = ___SOA_IDENT(is_empty),
+	.get = ___SOA_IDENT(get),
+	.set = ___SOA_IDENT(set),
+	.push_back = ___SOA_IDENT(push_back),
+	.insert = ___SOA_IDENT(insert),
+	.erase = ___SOA_IDENT(erase),
+	.reserve = ___SOA_IDENT(reserve),
+	.resize = ___SOA_IDENT(resize),
+	.clear = ___SOA_IDENT(clear),
+	.free = ___SOA_IDENT(free),
+};
+
+__attr(always_inline) static inline usize
+	___SOA_IDENT(get_expanded_capacity)(usize old_capacity) {
+	return old_capacity < 8U ? 8U : (old_capacity * 3U) / 2U;
+}
+
+/// Reallocates every column of `self` to hold exactly `capacity` elements.
+///
+/// All columns share a single allocation, each starting on a `CNX_SOA_COLUMN_ALIGNMENT` boundary,
+/// so growing the container costs one allocation regardless of the number of fields
+static inline void ___SOA_IDENT(resize_internal)(___SOA* restrict self, usize capacity) {
+	cnx_assert(capacity >= self->m_size, "Can't shrink a CnxSoA(T) below its size");
+
+	let num_bytes = DELIMIT_LIST(+, APPLY_TO_LIST(___SOA_COLUMN_BYTES, SOA_FIELDS)) 0U;
+	let_mut resized = *self;
+	resized.m_memory = cnx_allocator_allocate_array_t(u8,
+													  self->m_allocator,
+													  num_bytes + CNX_SOA_COLUMN_ALIGNMENT);
+	let base = static_cast(u8*)(resized.m_memory)
+			   + (___SOA_ROUND_UP(static_cast(usize)(resized.m_memory))
+				  - static_cast(usize)(resized.m_memory));
+	let_mut offset = static_cast(usize)(0);
+	APPLY_TO_LIST(___SOA_ASSIGN_COLUMN, SOA_FIELDS);
+
+	if(self->m_size != 0) {
+		APPLY_TO_LIST(___SOA_COPY_COLUMN, SOA_FIELDS);
+	}
+	if(self->m_memory != nullptr) {
+		cnx_allocator_deallocate(self->m_allocator, self->m_memory);
+	}
+
+	resized.m_capacity = capacity;
+	*self = resized;
+}
+
+SOA_STATIC SOA_INLINE ___SOA ___SOA_IDENT(new)(void) {
+	return cnx_soa_new_with_allocator(SOA_T, DEFAULT_ALLOCATOR);
+}
+
+SOA_STATIC SOA_INLINE ___SOA ___SOA_IDENT(new_with_allocator)(CnxAllocator allocator) {
+	return (___SOA){.m_size = 0,
+					.m_capacity = 0,
+					.m_memory = nullptr,
+					.m_allocator = allocator,
+					.m_vtable = &___SOA_IDENT(vtable_impl)};
+}
+
+SOA_STATIC SOA_INLINE ___SOA ___SOA_IDENT(new_with_capacity)(usize capacity) {
+	return cnx_soa_new_with_capacity_and_allocator(SOA_T, capacity, DEFAULT_ALLOCATOR);
+}
+
+SOA_STATIC SOA_INLINE ___SOA
+	___SOA_IDENT(new_with_capacity_and_allocator)(usize capacity, CnxAllocator allocator) {
+	let_mut soa = cnx_soa_new_with_allocator(SOA_T, allocator);
+	cnx_soa_reserve(soa, capacity);
+	return soa;
+}
+
+SOA_STATIC SOA_INLINE ___SOA ___SOA_IDENT(clone)(const ___SOA* restrict self) {
+	let_mut resized = cnx_soa_new_with_capacity_and_allocator(SOA_T,
+															  self->m_size,
+															  self->m_allocator);
+	if(self->m_size != 0) {
+		APPLY_TO_LIST(___SOA_COPY_COLUMN, SOA_FIELDS);
+	}
+	resized.m_size = self->m_size;
+	return resized;
+}
+
+SOA_STATIC SOA_INLINE usize ___SOA_IDENT(size)(const ___SOA* restrict self) {
+	return self->m_size;
+}
+
+SOA_STATIC SOA_INLINE usize ___SOA_IDENT(capacity)(const ___SOA* restrict self) {
+	return self->m_capacity;
+}
+
+SOA_STATIC SOA_INLINE bool ___SOA_IDENT(is_empty)(const ___SOA* restrict self) {
+	return self->m_size == 0;
+}
+
+SOA_STATIC SOA_INLINE SOA_T ___SOA_IDENT(get)(const ___SOA* restrict self, usize index) {
+	cnx_assert(index < self->m_size, "cnx_soa_get called with index out of bounds");
+	return (SOA_T){APPLY_TO_LIST(___SOA_LOAD, SOA_FIELDS)};
+}
+
+SOA_STATIC SOA_INLINE void
+___SOA_IDENT(set)(___SOA* restrict self,
+				  usize index,
+				  SOA_T element /** NOLINT(readability-non-const-parameter) **/) {
+	cnx_assert(index < self->m_size, "cnx_soa_set called with index out of bounds");
+	APPLY_TO_LIST(___SOA_STORE, SOA_FIELDS);
+}
+
+SOA_STATIC SOA_INLINE void
+___SOA_IDENT(push_back)(___SOA* restrict self,
+						SOA_T element /** NOLINT(readability-non-const-parameter) **/) {
+	if(self->m_size == self->m_capacity) {
+		___SOA_IDENT(resize_internal)(self, ___SOA_IDENT(get_expanded_capacity)(self->m_capacity));
+	}
+
+	let index = self->m_size;
+	APPLY_TO_LIST(___SOA_STORE, SOA_FIELDS);
+	self->m_size++;
+}
+
+SOA_STATIC SOA_INLINE void
+___SOA_IDENT(insert)(___SOA* restrict self,
+					 SOA_T element /** NOLINT(readability-non-const-parameter) **/,
+					 usize index) {
+	cnx_assert(index <= self->m_size, "cnx_soa_insert called with index out of bounds");
+
+	if(self->m_size == self->m_capacity) {
+		___SOA_IDENT(resize_internal)(self, ___SOA_IDENT(get_expanded_capacity)(self->m_capacity));
+	}
+
+	if(index < self->m_size) {
+		APPLY_TO_LIST(___SOA_SHIFT_BACK, SOA_FIELDS);
+	}
+	APPLY_TO_LIST(___SOA_STORE, SOA_FIELDS);
+	self->m_size++;
+}
+
+SOA_STATIC SOA_INLINE void ___SOA_IDENT(erase)(___SOA* restrict self, usize index) {
+	cnx_assert(index < self->m_size, "cnx_soa_erase called with index out of bounds");
+
+	if(index < self->m_size - 1U) {
+		APPLY_TO_LIST(___SOA_SHIFT_FORWARD, SOA_FIELDS);
+	}
+	self->m_size--;
+}
+
+SOA_STATIC SOA_INLINE void ___SOA_IDENT(reserve)(___SOA* restrict self, usize new_capacity) {
+	if(new_capacity > self->m_capacity) {
+		___SOA_IDENT(resize_internal)(self, new_capacity);
+	}
+}
+
+SOA_STATIC SOA_INLINE void ___SOA_IDENT(resize)(___SOA* restrict self, usize new_size) {
+	if(new_size > self->m_size) {
+		___SOA_IDENT(reserve)(self, new_size);
+		APPLY_TO_LIST(___SOA_ZERO_TAIL, SOA_FIELDS);
+	}
+	self->m_size = new_size;
+}
+
+SOA_STATIC SOA_INLINE void ___SOA_IDENT(clear)(___SOA* restrict self) {
+	self->m_size = 0;
+}
+
+SOA_STATIC SOA_INLINE void ___SOA_IDENT(free)(void* restrict self) {
+	let_mut _self = static_cast(___SOA*)(self);
+	if(_self->m_memory != nullptr) {
+		cnx_allocator_deallocate(_self->m_allocator, _self->m_memory);
+	}
+	*_self = cnx_soa_new_with_allocator(SOA_T, _self->m_allocator);
+}
+
+	#undef ___SOA_ZERO_TAIL
+	#undef ___SOA_SHIFT_FORWARD
+	#undef ___SOA_SHIFT_BACK
+	#undef ___SOA_LOAD
+	#undef ___SOA_STORE
+	#undef ___SOA_COPY_COLUMN
+	#undef ___SOA_ASSIGN_COLUMN
+	#undef ___SOA_COLUMN_BYTES
+	#undef ___SOA_ROUND_UP
+	#undef ___SOA_IDENT
+	#undef ___SOA
+	#undef CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
+#endif // defined(SOA_T) && defined(SOA_FIELDS) && SOA_IMPL
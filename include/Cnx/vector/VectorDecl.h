@@ -39,6 +39,7 @@
 	#include <Cnx/Allocators.h>
 	#include <Cnx/BasicTypes.h>
 	#include <Cnx/Iterator.h>
+	#include <Cnx/Lambda.h>
 	#include <Cnx/Platform.h>
 	#include <Cnx/Format.h>
 	#include <Cnx/vector/VectorDef.h>
@@ -70,6 +71,9 @@ typedef struct CnxVectorConstIterator(VECTOR_T) {
 }
 CnxVectorConstIterator(VECTOR_T);
 
+typedef bool (*CnxVectorPredicate(VECTOR_T))(const VECTOR_T* restrict elem);
+typedef Lambda(bool, const VECTOR_T* restrict) CnxVectorPredicateLambda(VECTOR_T);
+
 __attr(nodiscard) VECTOR_STATIC VECTOR_INLINE CnxVector(VECTOR_T)
 	CnxVectorIdentifier(VECTOR_T, new)(void);
 __attr(nodiscard) VECTOR_STATIC VECTOR_INLINE CnxVector(VECTOR_T)
@@ -194,8 +198,52 @@ __attr(not_null(1)) VECTOR_STATIC VECTOR_INLINE
 	void CnxVectorIdentifier(VECTOR_T, erase_n)(CnxVector(VECTOR_T) * restrict self,
 												usize index,
 												usize num_elements) ___DISABLE_IF_NULL(self);
+__attr(not_null(1)) VECTOR_STATIC VECTOR_INLINE
+	void CnxVectorIdentifier(VECTOR_T, erase_range)(CnxVector(VECTOR_T) * restrict self,
+													usize begin,
+													usize end) ___DISABLE_IF_NULL(self);
+__attr(not_null(1)) VECTOR_STATIC VECTOR_INLINE
+	void CnxVectorIdentifier(VECTOR_T, swap_remove)(CnxVector(VECTOR_T) * restrict self,
+													usize index) ___DISABLE_IF_NULL(self);
+__attr(not_null(1, 2)) VECTOR_STATIC VECTOR_INLINE
+	usize CnxVectorIdentifier(VECTOR_T, retain)(CnxVector(VECTOR_T) * restrict self,
+												CnxVectorPredicate(VECTOR_T) predicate)
+		___DISABLE_IF_NULL(self);
+__attr(not_null(1, 2)) VECTOR_STATIC VECTOR_INLINE usize
+	CnxVectorIdentifier(VECTOR_T, retain_lambda)(CnxVector(VECTOR_T) * restrict self,
+												 CnxVectorPredicateLambda(VECTOR_T) predicate)
+		___DISABLE_IF_NULL(self);
+__attr(not_null(1, 2)) VECTOR_STATIC VECTOR_INLINE
+	usize CnxVectorIdentifier(VECTOR_T, erase_if)(CnxVector(VECTOR_T) * restrict self,
+												  CnxVectorPredicate(VECTOR_T) predicate)
+		___DISABLE_IF_NULL(self);
+__attr(not_null(1, 2)) VECTOR_STATIC VECTOR_INLINE usize
+	CnxVectorIdentifier(VECTOR_T, erase_if_lambda)(CnxVector(VECTOR_T) * restrict self,
+												   CnxVectorPredicateLambda(VECTOR_T) predicate)
+		___DISABLE_IF_NULL(self);
 __attr(not_null(1)) VECTOR_STATIC VECTOR_INLINE
 	void CnxVectorIdentifier(VECTOR_T, free)(void* restrict self) ___DISABLE_IF_NULL(self);
+__attr(not_null(1)) VECTOR_STATIC VECTOR_INLINE
+	void CnxVectorIdentifier(VECTOR_T, resize_for_overwrite)(CnxVector(VECTOR_T) * restrict self,
+															 usize new_size)
+		___DISABLE_IF_NULL(self);
+__attr(not_null(1)) VECTOR_STATIC VECTOR_INLINE
+	void CnxVectorIdentifier(VECTOR_T, extend)(CnxVector(VECTOR_T) * restrict self,
+											   const VECTOR_T* restrict elements,
+											   usize num_elements) ___DISABLE_IF_NULL(self);
+__attr(not_null(1)) VECTOR_STATIC VECTOR_INLINE void CnxVectorIdentifier(VECTOR_T, extend_from_iter)(
+	CnxVector(VECTOR_T) * restrict self,
+	CnxForwardIterator(Ref(VECTOR_T)) begin,
+	CnxForwardIterator(Ref(VECTOR_T)) end) ___DISABLE_IF_NULL(self);
+__attr(not_null(1)) VECTOR_STATIC VECTOR_INLINE
+	void CnxVectorIdentifier(VECTOR_T, insert_n)(CnxVector(VECTOR_T) * restrict self,
+												 const VECTOR_T* restrict elements,
+												 usize num_elements,
+												 usize index) ___DISABLE_IF_NULL(self);
+__attr(not_null(1)) VECTOR_STATIC VECTOR_INLINE
+	void CnxVectorIdentifier(VECTOR_T, assign)(CnxVector(VECTOR_T) * restrict self,
+											   const VECTOR_T* restrict elements,
+											   usize num_elements) ___DISABLE_IF_NULL(self);
 
 __attr(nodiscard) __attr(not_null(1)) VECTOR_STATIC VECTOR_INLINE CnxFormatContext
 	CnxVectorIdentifier(VECTOR_T, is_specifier_valid)(const CnxFormat* restrict self,
@@ -291,7 +339,31 @@ typedef struct CnxVectorIdentifier(VECTOR_T, vtable) {
 	void (*const insert)(CnxVector(VECTOR_T)* restrict self, VECTOR_T element, usize index);
 	void (*const erase)(CnxVector(VECTOR_T)* restrict self, usize index);
 	void (*const erase_n)(CnxVector(VECTOR_T)* restrict self, usize index, usize num_elements);
+	void (*const erase_range)(CnxVector(VECTOR_T)* restrict self, usize begin, usize end);
+	void (*const swap_remove)(CnxVector(VECTOR_T)* restrict self, usize index);
+	usize (*const retain)(CnxVector(VECTOR_T)* restrict self,
+						  CnxVectorPredicate(VECTOR_T) predicate);
+	usize (*const retain_lambda)(CnxVector(VECTOR_T)* restrict self,
+								 CnxVectorPredicateLambda(VECTOR_T) predicate);
+	usize (*const erase_if)(CnxVector(VECTOR_T)* restrict self,
+							CnxVectorPredicate(VECTOR_T) predicate);
+	usize (*const erase_if_lambda)(CnxVector(VECTOR_T)* restrict self,
+								   CnxVectorPredicateLambda(VECTOR_T) predicate);
 	void (*const free)(void* restrict self);
+	void (*const resize_for_overwrite)(CnxVector(VECTOR_T)* restrict self, usize new_size);
+	void (*const extend)(CnxVector(VECTOR_T)* restrict self,
+						 const VECTOR_T* restrict elements,
+						 usize num_elements);
+	void (*const extend_from_iter)(CnxVector(VECTOR_T)* restrict self,
+								   CnxForwardIterator(Ref(VECTOR_T)) begin,
+								   CnxForwardIterator(Ref(VECTOR_T)) end);
+	void (*const insert_n)(CnxVector(VECTOR_T)* restrict self,
+						   const VECTOR_T* restrict elements,
+						   usize num_elements,
+						   usize index);
+	void (*const assign)(CnxVector(VECTOR_T)* restrict self,
+						 const VECTOR_T* restrict elements,
+						 usize num_elements);
 	CnxRandomAccessIterator(Ref(VECTOR_T)) (*const into_iter)(
 		const CnxVector(VECTOR_T)* restrict self);
 	CnxRandomAccessIterator(Ref(VECTOR_T)) (*const into_reverse_iter)(
@@ -26,6 +26,7 @@
 /// SOFTWARE.
 
 #include <Cnx/Def.h>
+#include <Cnx/Span.h>
 
 #ifndef CNX_VECTOR_DEF
 	#define CNX_VECTOR_DEF
@@ -90,6 +91,32 @@
 	/// @brief macro alias for an identifier (type, function, etc) associated with a
 	/// `CnxVector(T)` containing `T`s
 	#define CnxVectorIdentifier(T, Identifier) CONCAT3(cnx_vector_, T, CONCAT2(_, Identifier))
+	/// @brief Macro alias for a predicate function compatible with a `CnxVector(T)` instantiation
+	///
+	/// Used for creating and referencing a typedef for a predicate function compatible with a
+	/// specific `CnxVector(T)` instantiation, as used by `cnx_vector_retain` and
+	/// `cnx_vector_erase_if`. A `CnxVectorPredicate(T)` must take the signature:
+	///
+	/// @code
+	/// bool (*predicate)(const T* restrict elem);
+	/// @endcode
+	///
+	/// @param T - The element type of the `CnxVector(T)` instantiation
+	/// @ingroup cnx_vector
+	#define CnxVectorPredicate(T) CnxVectorIdentifier(T, Predicate)
+	/// @brief Macro alias for a `Lambda` predicate compatible with a `CnxVector(T)` instantiation
+	///
+	/// Used for referencing the named `Lambda` type accepted by `cnx_vector_retain_lambda` and
+	/// `cnx_vector_erase_if_lambda`. A `CnxVectorPredicateLambda(T)` is a
+	/// `Lambda(bool, const T* restrict)`, so its `LambdaFunction` must take the signature:
+	///
+	/// @code
+	/// bool LambdaFunction(predicate, const T* restrict elem);
+	/// @endcode
+	///
+	/// @param T - The element type of the `CnxVector(T)` instantiation
+	/// @ingroup cnx_vector
+	#define CnxVectorPredicateLambda(T) CnxVectorIdentifier(T, PredicateLambda)
 
 	/// @brief The default small-vector optimization capacity if not given as a template parameter
 	/// @ingroup cnx_vector
@@ -331,6 +358,19 @@
 	/// @return a pointer to the raw array
 	/// @ingroup cnx_vector
 	#define cnx_vector_data(self) (self).m_vtable->data_const(&(self))
+	/// @brief Returns a `CnxSpan(T)` viewing the elements of the given `CnxVector(T)`
+	///
+	/// The span is invalidated by any operation that reallocates or resizes `self`.
+	/// `CnxSpan(T)` must have been declared with `DeclCnxSpan(T)` (`<Cnx/Span.h>` does so for the
+	/// builtin scalar types).
+	///
+	/// @param T - The element type of the `CnxVector(T)`
+	/// @param self - The `CnxVector(T)` to view
+	///
+	/// @return a span viewing the elements of `self`
+	/// @ingroup cnx_vector
+	#define cnx_vector_as_span(T, self) \
+		cnx_span_new(T, cnx_vector_data_mut(self), cnx_vector_size(self))
 	/// @brief Returns whether the given `CnxVector(T)`is empty
 	///
 	/// @param self - The `CnxVector(T)` to check for emptiness
@@ -449,12 +489,163 @@
 	/// @ingroup cnx_vector
 	#define cnx_vector_erase_n(self, index, num_elements) \
 		(self).m_vtable->erase_n(&(self), (index), (num_elements))
+	/// @brief Removes the elements in the range `[begin, end)` from the given `CnxVector(T)`,
+	/// moving the elements after the range forward in a single `memmove`.
+	///
+	/// @param self - The `CnxVector(T)` to remove elements from
+	/// @param begin - The index of the first element to remove
+	/// @param end - The index one past the last element to remove. Must be at most the size of
+	/// the vector
+	/// @ingroup cnx_vector
+	#define cnx_vector_erase_range(self, begin, end) \
+		(self).m_vtable->erase_range(&(self), (begin), (end))
+	/// @brief Removes the element at `index` from the given `CnxVector(T)` by replacing it with the
+	/// last element in the vector.
+	/// This is O(1), but does not preserve the order of the remaining elements.
+	///
+	/// @param self - The `CnxVector(T)` to remove an element from
+	/// @param index - The index of the element to remove
+	/// @ingroup cnx_vector
+	#define cnx_vector_swap_remove(self, index) (self).m_vtable->swap_remove(&(self), (index))
+	/// @brief Retains only the elements of the given `CnxVector(T)` for which `predicate` returns
+	/// `true`, removing all others.
+	/// This is a single, stable (order-preserving) pass over the vector: each element is moved at
+	/// most once, and the element destructor is only called on removed elements.
+	///
+	/// @param self - The `CnxVector(T)` to filter
+	/// @param predicate - The `CnxVectorPredicate(T)` determining which elements to keep
+	///
+	/// @return The number of elements removed
+	/// @ingroup cnx_vector
+	#define cnx_vector_retain(self, predicate) (self).m_vtable->retain(&(self), (predicate))
+	/// @brief Retains only the elements of the given `CnxVector(T)` for which the `Lambda`
+	/// `predicate` returns `true`, removing all others.
+	/// This is a single, stable (order-preserving) pass over the vector: each element is moved at
+	/// most once, and the element destructor is only called on removed elements.
+	///
+	/// @param self - The `CnxVector(T)` to filter
+	/// @param predicate - The `CnxVectorPredicateLambda(T)` determining which elements to keep.
+	/// This is not freed by the vector
+	///
+	/// @return The number of elements removed
+	/// @ingroup cnx_vector
+	#define cnx_vector_retain_lambda(self, predicate) \
+		(self).m_vtable->retain_lambda(&(self), (predicate))
+	/// @brief Removes all elements of the given `CnxVector(T)` for which `predicate` returns
+	/// `true`.
+	/// This is a single, stable (order-preserving) pass over the vector: each element is moved at
+	/// most once, and the element destructor is only called on removed elements.
+	///
+	/// @param self - The `CnxVector(T)` to filter
+	/// @param predicate - The `CnxVectorPredicate(T)` determining which elements to remove
+	///
+	/// @return The number of elements removed
+	/// @ingroup cnx_vector
+	#define cnx_vector_erase_if(self, predicate) (self).m_vtable->erase_if(&(self), (predicate))
+	/// @brief Removes all elements of the given `CnxVector(T)` for which the `Lambda` `predicate`
+	/// returns `true`.
+	/// This is a single, stable (order-preserving) pass over the vector: each element is moved at
+	/// most once, and the element destructor is only called on removed elements.
+	///
+	/// @param self - The `CnxVector(T)` to filter
+	/// @param predicate - The `CnxVectorPredicateLambda(T)` determining which elements to remove.
+	/// This is not freed by the vector
+	///
+	/// @return The number of elements removed
+	/// @ingroup cnx_vector
+	#define cnx_vector_erase_if_lambda(self, predicate) \
+		(self).m_vtable->erase_if_lambda(&(self), (predicate))
 	/// @brief Frees the given `CnxVector(T)`, calling the element destructor on each element
 	/// and freeing any allocated memory
 	///
 	/// @param self - The `CnxVector(T)` to free
 	/// @ingroup cnx_vector
 	#define cnx_vector_free(self) (self).m_vtable->free(&(self))
+	/// @brief Resizes the given `CnxVector(T)` to `new_size` number of elements, without
+	/// initializing any new elements.
+	/// If `new_size` is greater than the current size, this will allocate memory if necessary,
+	/// but the new elements are left uninitialized and must be written before they are read
+	/// (eg, by reading data directly into `cnx_vector_data_mut(self)`). If `new_size` is less than
+	/// the current size, this will destruct `size - new_size` number of elements.
+	///
+	/// @param self - The `CnxVector(T)` to resize
+	/// @param new_size - The desired size of the `CnxVector(T)`
+	/// @ingroup cnx_vector
+	#define cnx_vector_resize_for_overwrite(self, new_size) \
+		(self).m_vtable->resize_for_overwrite(&(self), (new_size))
+	/// @brief Appends copies of the `num_elements` elements starting at `elements` to the end of
+	/// the given `CnxVector(T)`.
+	/// This reallocates at most once, and copies the elements with a single `memcpy` if the vector
+	/// uses the default element copy constructor.
+	///
+	/// @param self - The `CnxVector(T)` to append to
+	/// @param elements - Pointer to the first element to append
+	/// @param num_elements - The number of elements to append
+	///
+	/// @note `elements` must not point into `self`
+	/// @ingroup cnx_vector
+	#define cnx_vector_extend(self, elements, num_elements) \
+		(self).m_vtable->extend(&(self), (elements), (num_elements))
+	/// @brief Appends copies of the elements of the `CnxVector(T)` `other` to the end of the given
+	/// `CnxVector(T)`, reallocating at most once
+	///
+	/// @param self - The `CnxVector(T)` to append to
+	/// @param other - The `CnxVector(T)` to append the elements of. Must not be `self`
+	/// @ingroup cnx_vector
+	#define cnx_vector_extend_from_vector(self, other) \
+		cnx_vector_extend(self, cnx_vector_data(other), cnx_vector_size(other))
+	/// @brief Appends copies of the elements viewed by the `CnxSpan(T)` `span` to the end of the
+	/// given `CnxVector(T)`, reallocating at most once
+	///
+	/// @param self - The `CnxVector(T)` to append to
+	/// @param span - The `CnxSpan(T)` to append the elements of
+	/// @ingroup cnx_vector
+	#define cnx_vector_extend_from_span(self, span) \
+		cnx_vector_extend(self, cnx_span_data(span), cnx_span_size(span))
+	/// @brief Appends copies of the elements in the iteration `[begin, end)` to the end of the
+	/// given `CnxVector(T)`.
+	/// The iteration is walked exactly once, growing the vector geometrically as needed. If the
+	/// number of elements is known up front, prefer `cnx_vector_extend` or
+	/// `cnx_vector_extend_from_span`, which reallocate at most once.
+	///
+	/// @param self - The `CnxVector(T)` to append to
+	/// @param begin - A `CnxForwardIterator(Ref(T))` at the beginning of the iteration
+	/// @param end - A `CnxForwardIterator(Ref(T))` at the end of the iteration
+	/// @ingroup cnx_vector
+	#define cnx_vector_extend_from_iter(self, begin, end) \
+		(self).m_vtable->extend_from_iter(&(self), (begin), (end))
+	/// @brief Appends copies of the elements of the `CnxRange(T)` `range` to the end of the given
+	/// `CnxVector(T)`
+	///
+	/// @param self - The `CnxVector(T)` to append to
+	/// @param range - The `CnxRange(T)` to append the elements of
+	/// @ingroup cnx_vector
+	#define cnx_vector_extend_from_range(self, range) \
+		cnx_vector_extend_from_iter(self, cnx_range_begin(range), cnx_range_end(range))
+	/// @brief Inserts copies of the `num_elements` elements starting at `elements` into the given
+	/// `CnxVector(T)`, starting at `index`, moving elements backward in the vector if necessary.
+	/// This reallocates and moves the trailing elements at most once.
+	///
+	/// @param self - The `CnxVector(T)` to insert into
+	/// @param elements - Pointer to the first element to insert
+	/// @param num_elements - The number of elements to insert
+	/// @param index - The index at which to insert the first element
+	///
+	/// @note `elements` must not point into `self`
+	/// @ingroup cnx_vector
+	#define cnx_vector_insert_n(self, elements, num_elements, index) \
+		(self).m_vtable->insert_n(&(self), (elements), (num_elements), (index))
+	/// @brief Replaces the contents of the given `CnxVector(T)` with copies of the `num_elements`
+	/// elements starting at `elements`, reallocating at most once
+	///
+	/// @param self - The `CnxVector(T)` to assign to
+	/// @param elements - Pointer to the first element to assign
+	/// @param num_elements - The number of elements to assign
+	///
+	/// @note `elements` must not point into `self`
+	/// @ingroup cnx_vector
+	#define cnx_vector_assign(self, elements, num_elements) \
+		(self).m_vtable->assign(&(self), (elements), (num_elements))
 	/// @brief Returns a `CnxRandomAccessIterator` into the mutable iteration of the given
 	/// `CnxVector(T)`, starting at the beginning of the iteration (pointing at the beginning of
 	/// the vector)
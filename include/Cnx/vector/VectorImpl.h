@@ -34,10 +34,17 @@
 	#include <Cnx/BasicTypes.h>
 	#include <Cnx/CollectionData.h>
 	#include <Cnx/Iterator.h>
+	#include <Cnx/Lambda.h>
 	#include <Cnx/Platform.h>
 	#include <Cnx/Format.h>
 	#include <Cnx/vector/VectorDef.h>
 
+	#if defined(VECTOR_TRIVIAL) && VECTOR_TRIVIAL
+		#define ___VECTOR_TRIVIAL TRUE
+	#else
+		#define ___VECTOR_TRIVIAL FALSE
+	#endif // defined(VECTOR_TRIVIAL) && VECTOR_TRIVIAL
+
 VECTOR_STATIC VECTOR_INLINE CnxVectorIterator(VECTOR_T)
 	CnxVectorIdentifier(VECTOR_T, iterator_new)(const CnxVector(VECTOR_T) * restrict self);
 VECTOR_STATIC VECTOR_INLINE CnxVectorConstIterator(VECTOR_T)
@@ -166,7 +173,18 @@ static const struct CnxVectorIdentifier(VECTOR_T, vtable) CnxVectorIdentifier(VE
 		.insert = CnxVectorIdentifier(VECTOR_T, insert),
 		.erase = CnxVectorIdentifier(VECTOR_T, erase),
 		.erase_n = CnxVectorIdentifier(VECTOR_T, erase_n),
+		.erase_range = CnxVectorIdentifier(VECTOR_T, erase_range),
+		.swap_remove = CnxVectorIdentifier(VECTOR_T, swap_remove),
+		.retain = CnxVectorIdentifier(VECTOR_T, retain),
+		.retain_lambda = CnxVectorIdentifier(VECTOR_T, retain_lambda),
+		.erase_if = CnxVectorIdentifier(VECTOR_T, erase_if),
+		.erase_if_lambda = CnxVectorIdentifier(VECTOR_T, erase_if_lambda),
 		.free = CnxVectorIdentifier(VECTOR_T, free),
+		.resize_for_overwrite = CnxVectorIdentifier(VECTOR_T, resize_for_overwrite),
+		.extend = CnxVectorIdentifier(VECTOR_T, extend),
+		.extend_from_iter = CnxVectorIdentifier(VECTOR_T, extend_from_iter),
+		.insert_n = CnxVectorIdentifier(VECTOR_T, insert_n),
+		.assign = CnxVectorIdentifier(VECTOR_T, assign),
 		.into_iter = CnxVectorIdentifier(VECTOR_T, into_iter),
 		.into_reverse_iter = CnxVectorIdentifier(VECTOR_T, into_reverse_iter),
 		.into_const_iter = CnxVectorIdentifier(VECTOR_T, into_const_iter),
@@ -187,6 +205,44 @@ static const struct CnxCollectionData(CnxVector(VECTOR_T))
 	   .m_copy_constructor = CnxVectorIdentifier(VECTOR_T, default_copy_constructor),
 	   .m_destructor = CnxVectorIdentifier(VECTOR_T, default_destructor)};
 
+/// Whether elements of `self` can be default constructed by zeroing their memory. This is true if
+/// `VECTOR_TRIVIAL` was set for this instantiation, or `self` uses the default element constructor
+__attr(always_inline) static inline bool CnxVectorIdentifier(VECTOR_T, is_trivially_constructible)(
+	const CnxVector(VECTOR_T) * restrict self) {
+	return ___VECTOR_TRIVIAL
+		   || self->m_data->m_constructor == CnxVectorIdentifier(VECTOR_T, default_constructor);
+}
+
+/// Whether elements of `self` can be copied with `memcpy`. This is true if `VECTOR_TRIVIAL` was
+/// set for this instantiation, or `self` uses the default element copy constructor
+__attr(always_inline) static inline bool CnxVectorIdentifier(VECTOR_T, is_trivially_copyable)(
+	const CnxVector(VECTOR_T) * restrict self) {
+	return ___VECTOR_TRIVIAL
+		   || self->m_data->m_copy_constructor
+				  == CnxVectorIdentifier(VECTOR_T, default_copy_constructor);
+}
+
+/// Whether elements of `self` can be dropped without calling their destructor. This is true if
+/// `VECTOR_TRIVIAL` was set for this instantiation, or `self` uses the default element destructor
+__attr(always_inline) static inline bool CnxVectorIdentifier(VECTOR_T, is_trivially_destructible)(
+	const CnxVector(VECTOR_T) * restrict self) {
+	return ___VECTOR_TRIVIAL
+		   || self->m_data->m_destructor == CnxVectorIdentifier(VECTOR_T, default_destructor);
+}
+
+/// Destroys the elements of `self` in `[begin, end)`, if they aren't trivially destructible
+__attr(always_inline) static inline void
+	CnxVectorIdentifier(VECTOR_T, destroy_range)(CnxVector(VECTOR_T) * restrict self,
+												 usize begin,
+												 usize end) {
+	if(!CnxVectorIdentifier(VECTOR_T, is_trivially_destructible)(self)) {
+		let destructor = self->m_data->m_destructor;
+		for(let_mut i = begin; i < end; ++i) {
+			destructor(&cnx_vector_at_mut(*self, i), self->m_allocator);
+		}
+	}
+}
+
 __attr(always_inline) static inline bool CnxVectorIdentifier(VECTOR_T, is_short)(
 	const CnxVector(VECTOR_T) * restrict self) {
 	return self->m_capacity <= VECTOR_SMALL_OPT_CAPACITY;
@@ -290,8 +346,14 @@ VECTOR_STATIC VECTOR_INLINE CnxVector(VECTOR_T)
 																	 cnx_vector_capacity(*self),
 																	 self->m_allocator,
 																	 self->m_data);
-	foreach_ref(elem, *self) {
-		cnx_vector_push_back(vec, self->m_data->m_copy_constructor(elem, self->m_allocator));
+	if(CnxVectorIdentifier(VECTOR_T, is_trivially_copyable)(self)) {
+		cnx_memcpy(VECTOR_T, &cnx_vector_at_mut(vec, 0), &cnx_vector_at(*self, 0), self->m_size);
+		vec.m_size = self->m_size;
+	}
+	else {
+		foreach_ref(elem, *self) {
+			cnx_vector_push_back(vec, self->m_data->m_copy_constructor(elem, self->m_allocator));
+		}
 	}
 	return vec;
 }
@@ -380,13 +442,8 @@ VECTOR_STATIC VECTOR_INLINE void
 CnxVectorIdentifier(VECTOR_T, resize_internal)(CnxVector(VECTOR_T) * restrict self,
 											   usize new_size) {
 	let size = cnx_vector_size(*self);
-	if(self->m_data->m_destructor != CnxVectorIdentifier(VECTOR_T, default_destructor)
-	   && new_size < size)
-	{
-		let num_to_destroy = size - new_size;
-		for(let_mut i = new_size; i < new_size + num_to_destroy; ++i) {
-			self->m_data->m_destructor(&cnx_vector_at_mut(*self, i), self->m_allocator);
-		}
+	if(new_size < size) {
+		CnxVectorIdentifier(VECTOR_T, destroy_range)(self, new_size, size);
 	}
 
 	if(new_size > VECTOR_SMALL_OPT_CAPACITY) {
@@ -445,10 +502,28 @@ CnxVectorIdentifier(VECTOR_T, reserve)(CnxVector(VECTOR_T) * restrict self, usiz
 
 VECTOR_STATIC VECTOR_INLINE void
 CnxVectorIdentifier(VECTOR_T, resize)(CnxVector(VECTOR_T) * restrict self, usize new_size) {
-	CnxVectorIdentifier(VECTOR_T, resize_internal)(self, new_size);
-	if(new_size > self->m_size) {
-		for(let_mut i = self->m_size - 1; i < new_size; ++i) {
-			cnx_vector_at_mut(*self, i) = self->m_data->m_constructor(self->m_allocator);
+	let size = self->m_size;
+	if(new_size < size) {
+		CnxVectorIdentifier(VECTOR_T, destroy_range)(self, new_size, size);
+		self->m_size = new_size;
+		if(new_size <= VECTOR_SMALL_OPT_CAPACITY && !CnxVectorIdentifier(VECTOR_T, is_short)(self))
+		{
+			CnxVectorIdentifier(VECTOR_T, resize_internal)(self, new_size);
+		}
+	}
+	else if(new_size > size) {
+		if(new_size > self->m_capacity) {
+			CnxVectorIdentifier(VECTOR_T, resize_internal)(self, new_size);
+		}
+
+		self->m_size = new_size;
+		if(CnxVectorIdentifier(VECTOR_T, is_trivially_constructible)(self)) {
+			cnx_memset(VECTOR_T, &cnx_vector_at_mut(*self, size), 0, new_size - size);
+		}
+		else {
+			for(let_mut i = size; i < new_size; ++i) {
+				cnx_vector_at_mut(*self, i) = self->m_data->m_constructor(self->m_allocator);
+			}
 		}
 	}
 	self->m_size = new_size;
@@ -461,9 +536,7 @@ CnxVectorIdentifier(VECTOR_T, shrink_to_fit)(CnxVector(VECTOR_T) * restrict self
 
 VECTOR_STATIC VECTOR_INLINE void
 CnxVectorIdentifier(VECTOR_T, clear)(CnxVector(VECTOR_T) * restrict self) {
-	for(let_mut i = 0U; i < cnx_vector_size(*self); ++i) {
-		self->m_data->m_destructor(&cnx_vector_at_mut(*self, i), self->m_allocator);
-	}
+	CnxVectorIdentifier(VECTOR_T, destroy_range)(self, 0U, self->m_size);
 	self->m_size = 0U;
 }
 
@@ -537,7 +610,7 @@ CnxVectorIdentifier(VECTOR_T, erase)(CnxVector(VECTOR_T) * restrict self, usize
 	cnx_assert(index < self->m_size,
 			   "cnx_vector_erase called with index >= self->m_size (index out of bounds)");
 
-	self->m_data->m_destructor(&cnx_vector_at_mut(*self, index), self->m_allocator);
+	CnxVectorIdentifier(VECTOR_T, destroy_range)(self, index, index + 1);
 
 	if(index != self->m_size - 1) {
 		let num_to_move = self->m_size - (index + 1);
@@ -561,9 +634,7 @@ CnxVectorIdentifier(VECTOR_T,
 	let end = index + num_elements;
 	let num_to_move = self->m_size - end;
 
-	for(let_mut i = index; i < end; ++i) {
-		self->m_data->m_destructor(&cnx_vector_at_mut(*self, i), self->m_allocator);
-	}
+	CnxVectorIdentifier(VECTOR_T, destroy_range)(self, index, end);
 
 	if(end != self->m_size) {
 		cnx_memmove(VECTOR_T,
@@ -574,11 +645,105 @@ CnxVectorIdentifier(VECTOR_T,
 	self->m_size -= num_elements;
 }
 
+VECTOR_STATIC VECTOR_INLINE void
+CnxVectorIdentifier(VECTOR_T, erase_range)(CnxVector(VECTOR_T) * restrict self,
+										   usize begin,
+										   usize end) {
+	cnx_assert(begin <= end, "cnx_vector_erase_range called with begin > end (invalid range)");
+	cnx_assert(end <= self->m_size,
+			   "cnx_vector_erase_range called with end > size (range out of bounds)");
+
+	if(begin == end) {
+		return;
+	}
+
+	CnxVectorIdentifier(VECTOR_T, destroy_range)(self, begin, end);
+
+	if(end != self->m_size) {
+		cnx_memmove(VECTOR_T,
+					&cnx_vector_at_mut(*self, begin),
+					&cnx_vector_at_mut(*self, end),
+					self->m_size - end);
+	}
+	self->m_size -= end - begin;
+}
+
+VECTOR_STATIC VECTOR_INLINE void
+CnxVectorIdentifier(VECTOR_T, swap_remove)(CnxVector(VECTOR_T) * restrict self, usize index) {
+	cnx_assert(index < self->m_size,
+			   "cnx_vector_swap_remove called with index >= size (index out of bounds)");
+
+	CnxVectorIdentifier(VECTOR_T, destroy_range)(self, index, index + 1);
+
+	let last = self->m_size - 1;
+	if(index != last) {
+		cnx_vector_at_mut(*self, index) = cnx_vector_at(*self, last);
+	}
+	self->m_size--;
+}
+
+/// Removes the elements of `self` for which `predicate` (or, if it's null, `lambda`) returns
+/// `!keep_matching`, in a single stable pass.
+/// Retained elements are shifted down over removed ones as they're encountered, so each element is
+/// moved at most once, and only removed elements are destroyed.
+__attr(always_inline) static inline usize
+	CnxVectorIdentifier(VECTOR_T, retain_internal)(CnxVector(VECTOR_T) * restrict self,
+												   CnxVectorPredicate(VECTOR_T) predicate,
+												   CnxVectorPredicateLambda(VECTOR_T) lambda,
+												   bool keep_matching) {
+	let size = self->m_size;
+	if(size == 0) {
+		return 0;
+	}
+
+	let_mut data = &cnx_vector_at_mut(*self, 0);
+	let trivially_destructible = CnxVectorIdentifier(VECTOR_T, is_trivially_destructible)(self);
+	let_mut write = 0U;
+	for(let_mut read = 0U; read < size; ++read) {
+		let elem = static_cast(const VECTOR_T*)(&data[read]);
+		let matches = predicate != nullptr ? predicate(elem) : lambda_call(lambda, elem);
+		if(matches == keep_matching) {
+			if(write != read) {
+				data[write] = data[read];
+			}
+			++write;
+		}
+		else if(!trivially_destructible) {
+			self->m_data->m_destructor(&data[read], self->m_allocator);
+		}
+	}
+
+	self->m_size = write;
+	return size - write;
+}
+
+VECTOR_STATIC VECTOR_INLINE usize
+CnxVectorIdentifier(VECTOR_T, retain)(CnxVector(VECTOR_T) * restrict self,
+									  CnxVectorPredicate(VECTOR_T) predicate) {
+	return CnxVectorIdentifier(VECTOR_T, retain_internal)(self, predicate, nullptr, true);
+}
+
+VECTOR_STATIC VECTOR_INLINE usize
+CnxVectorIdentifier(VECTOR_T, retain_lambda)(CnxVector(VECTOR_T) * restrict self,
+											 CnxVectorPredicateLambda(VECTOR_T) predicate) {
+	return CnxVectorIdentifier(VECTOR_T, retain_internal)(self, nullptr, predicate, true);
+}
+
+VECTOR_STATIC VECTOR_INLINE usize
+CnxVectorIdentifier(VECTOR_T, erase_if)(CnxVector(VECTOR_T) * restrict self,
+										CnxVectorPredicate(VECTOR_T) predicate) {
+	return CnxVectorIdentifier(VECTOR_T, retain_internal)(self, predicate, nullptr, false);
+}
+
+VECTOR_STATIC VECTOR_INLINE usize
+CnxVectorIdentifier(VECTOR_T, erase_if_lambda)(CnxVector(VECTOR_T) * restrict self,
+											   CnxVectorPredicateLambda(VECTOR_T) predicate) {
+	return CnxVectorIdentifier(VECTOR_T, retain_internal)(self, nullptr, predicate, false);
+}
+
 VECTOR_STATIC VECTOR_INLINE void CnxVectorIdentifier(VECTOR_T, free)(void* restrict self) {
 	let self_ = static_cast(CnxVector(VECTOR_T)*)(self);
-	for(let_mut i = 0U; i < self_->m_size; ++i) {
-		self_->m_data->m_destructor(&cnx_vector_at_mut(*self_, i), self_->m_allocator);
-	}
+	CnxVectorIdentifier(VECTOR_T, destroy_range)(self_, 0U, self_->m_size);
 
 	if(!CnxVectorIdentifier(VECTOR_T, is_short)(self_)) {
 		cnx_allocator_deallocate(self_->m_allocator, self_->m_long);
@@ -587,6 +752,125 @@ VECTOR_STATIC VECTOR_INLINE void CnxVectorIdentifier(VECTOR_T, free)(void* restr
 	self_->m_size = 0U;
 }
 
+VECTOR_STATIC VECTOR_INLINE void
+CnxVectorIdentifier(VECTOR_T, resize_for_overwrite)(CnxVector(VECTOR_T) * restrict self,
+													usize new_size) {
+	if(new_size < self->m_size) {
+		CnxVectorIdentifier(VECTOR_T, destroy_range)(self, new_size, self->m_size);
+	}
+	else {
+		cnx_vector_reserve(*self, new_size);
+	}
+	self->m_size = new_size;
+}
+
+/// Copies `num_elements` elements from `elements` into the (uninitialized) storage at `dest`,
+/// using the element copy constructor. Copying is a single `memcpy` when elements of `self` are
+/// trivially copyable
+__attr(always_inline) static inline void
+	CnxVectorIdentifier(VECTOR_T, copy_into)(const CnxVector(VECTOR_T) * restrict self,
+											 VECTOR_T* restrict dest,
+											 const VECTOR_T* restrict elements,
+											 usize num_elements) {
+	cnx_assert(self->m_data->m_copy_constructor != nullptr,
+			   "Can't copy elements into a CnxVector(VECTOR_T) with elements that aren't "
+			   "copyable (no element copy constructor defined)");
+
+	if(CnxVectorIdentifier(VECTOR_T, is_trivially_copyable)(self)) {
+		cnx_memcpy(VECTOR_T, dest, elements, num_elements);
+	}
+	else {
+		for(let_mut i = 0U; i < num_elements; ++i) {
+			dest[i] = self->m_data->m_copy_constructor(&elements[i], self->m_allocator);
+		}
+	}
+}
+
+VECTOR_STATIC VECTOR_INLINE void
+CnxVectorIdentifier(VECTOR_T, extend)(CnxVector(VECTOR_T) * restrict self,
+									  const VECTOR_T* restrict elements,
+									  usize num_elements) {
+	if(num_elements == 0) {
+		return;
+	}
+
+	let size = self->m_size;
+	cnx_vector_reserve(*self, size + num_elements);
+	CnxVectorIdentifier(VECTOR_T, copy_into)(self,
+											 &cnx_vector_at_mut(*self, size),
+											 elements,
+											 num_elements);
+	self->m_size = size + num_elements;
+}
+
+VECTOR_STATIC VECTOR_INLINE void
+CnxVectorIdentifier(VECTOR_T, extend_from_iter)(CnxVector(VECTOR_T) * restrict self,
+												CnxForwardIterator(Ref(VECTOR_T)) begin,
+												CnxForwardIterator(Ref(VECTOR_T)) end) {
+	let copy_constructor = self->m_data->m_copy_constructor;
+	cnx_assert(copy_constructor != nullptr,
+			   "Can't copy elements into a CnxVector(VECTOR_T) with elements that aren't "
+			   "copyable (no element copy constructor defined)");
+
+	// forward iterators can share their iteration state (eg, `CnxRange(T)`'s iterators), so we
+	// can only walk the iteration once. Grow geometrically instead of per-element
+	for(; !cnx_iterator_equals(begin, end); ignore(cnx_iterator_next(begin))) {
+		if(self->m_size == self->m_capacity) {
+			let new_capacity
+				= CnxVectorIdentifier(VECTOR_T, get_expanded_capacity)(self->m_capacity, 1);
+			CnxVectorIdentifier(VECTOR_T, resize_internal)(self, new_capacity);
+		}
+
+		cnx_vector_at_mut(*self, self->m_size)
+			= copy_constructor(&cnx_iterator_current(begin), self->m_allocator);
+		self->m_size++;
+	}
+}
+
+VECTOR_STATIC VECTOR_INLINE void
+CnxVectorIdentifier(VECTOR_T, insert_n)(CnxVector(VECTOR_T) * restrict self,
+										const VECTOR_T* restrict elements,
+										usize num_elements,
+										usize index) {
+	cnx_assert(index <= self->m_size,
+			   "cnx_vector_insert_n called with index > size (index out of bounds)");
+
+	if(num_elements == 0) {
+		return;
+	}
+
+	let size = self->m_size;
+	cnx_vector_reserve(*self, size + num_elements);
+	if(index != size) {
+		cnx_memmove(VECTOR_T,
+					&cnx_vector_at_mut(*self, index) + num_elements,
+					&cnx_vector_at_mut(*self, index),
+					size - index);
+	}
+	CnxVectorIdentifier(VECTOR_T, copy_into)(self,
+											 &cnx_vector_at_mut(*self, index),
+											 elements,
+											 num_elements);
+	self->m_size = size + num_elements;
+}
+
+VECTOR_STATIC VECTOR_INLINE void
+CnxVectorIdentifier(VECTOR_T, assign)(CnxVector(VECTOR_T) * restrict self,
+									  const VECTOR_T* restrict elements,
+									  usize num_elements) {
+	cnx_vector_clear(*self);
+	if(num_elements == 0) {
+		return;
+	}
+
+	cnx_vector_reserve(*self, num_elements);
+	CnxVectorIdentifier(VECTOR_T, copy_into)(self,
+											 &cnx_vector_at_mut(*self, 0),
+											 elements,
+											 num_elements);
+	self->m_size = num_elements;
+}
+
 VECTOR_STATIC VECTOR_INLINE CnxVectorIterator(VECTOR_T)
 	CnxVectorIdentifier(VECTOR_T, iterator_new)(const CnxVector(VECTOR_T) * restrict self) {
 	return (CnxVectorIterator(VECTOR_T)){.m_index = 0U,
@@ -902,5 +1186,6 @@ CnxVectorIdentifier(VECTOR_T, format_with_allocator)(const CnxFormat* restrict s
 		as_format_t(nullptr_t, data));
 }
 
+	#undef ___VECTOR_TRIVIAL
 	#undef CNX_TEMPLATE_SUPPRESS_INSTANTIATIONS
 #endif // defined(VECTOR_T) && defined(VECTOR_SMALL_OPT_CAPACITY) && VECTOR_IMPL
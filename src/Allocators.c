@@ -86,16 +86,16 @@ void* cnx_allocator_reallocate(CnxAllocator allocator,
 	let_mut mem = trait_call(reallocate, allocator, memory, new_size_bytes);
 
 	if(mem != nullptr) {
-		if(mem != memory) {
-			memcpy(mem, memory, cnx_min(new_size_bytes, old_size_bytes));
-		}
+		// `reallocate` has `realloc` semantics: it has already copied the contents and released
+		// `memory` if it had to move the allocation, so `memory` must not be touched again here
 		return mem;
 	}
 	else {
 		let_mut retry = trait_call(allocate, allocator, new_size_bytes);
 		if(retry != nullptr) {
 			memcpy(retry, memory, cnx_min(new_size_bytes, old_size_bytes));
-			return mem;
+			trait_call(deallocate, allocator, memory);
+			return retry;
 		}
 
 #if CNX_ALLOCATOR_ABORT_ON_ALLOCATION_FAILURE
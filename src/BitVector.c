@@ -0,0 +1,628 @@
+/// @file BitVector.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief `CnxBitVector` is a dynamically sized, densely packed set of bits
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include <Cnx/Assert.h>
+#include <Cnx/BitVector.h>
+#include <Cnx/Math.h>
+#include <Cnx/Platform.h>
+
+#if (CNX_PLATFORM_COMPILER_GCC || CNX_PLATFORM_COMPILER_CLANG) \
+	&& (defined(__x86_64__) || defined(_M_X64))
+	/// @brief Whether the AVX2 bulk operation kernels are available for this target
+	#define CNX_BIT_VECTOR_AVX2_KERNELS 1
+	#include <immintrin.h>
+#else
+	/// @brief Whether the AVX2 bulk operation kernels are available for this target
+	#define CNX_BIT_VECTOR_AVX2_KERNELS 0
+#endif
+
+#define ALL_BITS (~static_cast(u64)(0))
+
+__attr(always_inline) __attr(nodiscard) static inline usize words_for_bits(usize num_bits) {
+	return (num_bits + CNX_BIT_VECTOR_BITS_PER_WORD - 1) / CNX_BIT_VECTOR_BITS_PER_WORD;
+}
+
+__attr(always_inline) __attr(nodiscard) static inline usize word_index(usize bit_index) {
+	return bit_index / CNX_BIT_VECTOR_BITS_PER_WORD;
+}
+
+__attr(always_inline) __attr(nodiscard) static inline u64 bit_mask(usize bit_index) {
+	return static_cast(u64)(1) << (bit_index % CNX_BIT_VECTOR_BITS_PER_WORD);
+}
+
+/// @brief Zeroes the bits of the last word beyond `m_size`, maintaining the invariant that they
+/// are never set
+__attr(always_inline) static inline void clear_unused_bits(CnxBitVector* restrict self) {
+	let used = self->m_size % CNX_BIT_VECTOR_BITS_PER_WORD;
+	if(used != 0) {
+		self->m_words[word_index(self->m_size)] &= ~(ALL_BITS << used);
+	}
+}
+
+#if CNX_BIT_VECTOR_AVX2_KERNELS
+
+__attr(always_inline) __attr(nodiscard) static inline bool cpu_has_avx2(void) {
+	return __builtin_cpu_supports("avx2");
+}
+
+__attr(always_inline) __attr(nodiscard) static inline bool cpu_has_popcnt(void) {
+	return __builtin_cpu_supports("popcnt");
+}
+
+#endif // CNX_BIT_VECTOR_AVX2_KERNELS
+
+#define SCALAR_AND(lhs, rhs)	((lhs) & (rhs))
+#define SCALAR_OR(lhs, rhs)		((lhs) | (rhs))
+#define SCALAR_XOR(lhs, rhs)	((lhs) ^ (rhs))
+#define SCALAR_ANDNOT(lhs, rhs) ((lhs) & ~(rhs))
+
+#define SIMD_AND(lhs, rhs)	  _mm256_and_si256(lhs, rhs)
+#define SIMD_OR(lhs, rhs)	  _mm256_or_si256(lhs, rhs)
+#define SIMD_XOR(lhs, rhs)	  _mm256_xor_si256(lhs, rhs)
+#define SIMD_ANDNOT(lhs, rhs) _mm256_andnot_si256(rhs, lhs)
+
+/// @brief Generates the scalar kernel for a whole-vector bitwise operation
+#define BULK_OP_SCALAR_KERNEL(name, scalar_op)                                            \
+	static void name##_scalar(u64* restrict dest, const u64* restrict src, usize words) { \
+		for(let_mut i = static_cast(usize)(0); i < words; ++i) {                          \
+			dest[i] = scalar_op(dest[i], src[i]);                                         \
+		}                                                                                 \
+	}
+
+#if CNX_BIT_VECTOR_AVX2_KERNELS
+	/// @brief Generates the AVX2 kernel and the dispatching kernel for a whole-vector bitwise
+	/// operation
+	#define BULK_OP_KERNEL(name, scalar_op, simd_op)                                              \
+		BULK_OP_SCALAR_KERNEL(name, scalar_op)                                                    \
+		__attr(target("avx2")) static void name##_avx2(u64* restrict dest,                        \
+													   const u64* restrict src,                   \
+													   usize words) {                             \
+			let_mut i = static_cast(usize)(0);                                                    \
+			for(; i + 4 <= words; i += 4) {                                                       \
+				let lhs = _mm256_loadu_si256(static_cast(const __m256i*)(                         \
+					static_cast(const void*)(dest + i)));                                         \
+				let rhs = _mm256_loadu_si256(static_cast(const __m256i*)(                         \
+					static_cast(const void*)(src + i)));                                          \
+				_mm256_storeu_si256(static_cast(__m256i*)(static_cast(void*)(dest + i)),          \
+									simd_op(lhs, rhs));                                           \
+			}                                                                                     \
+			for(; i < words; ++i) {                                                               \
+				dest[i] = scalar_op(dest[i], src[i]);                                             \
+			}                                                                                     \
+		}                                                                                         \
+		static void name(u64* restrict dest, const u64* restrict src, usize words) {              \
+			if(cpu_has_avx2()) {                                                                  \
+				name##_avx2(dest, src, words);                                                    \
+			}                                                                                     \
+			else {                                                                                \
+				name##_scalar(dest, src, words);                                                  \
+			}                                                                                     \
+		}
+#else
+	/// @brief Generates the kernel for a whole-vector bitwise operation
+	#define BULK_OP_KERNEL(name, scalar_op, simd_op)                                 \
+		BULK_OP_SCALAR_KERNEL(name, scalar_op)                                       \
+		static void name(u64* restrict dest, const u64* restrict src, usize words) { \
+			name##_scalar(dest, src, words);                                         \
+		}
+#endif // CNX_BIT_VECTOR_AVX2_KERNELS
+
+BULK_OP_KERNEL(bulk_and, SCALAR_AND, SIMD_AND)
+BULK_OP_KERNEL(bulk_or, SCALAR_OR, SIMD_OR)
+BULK_OP_KERNEL(bulk_xor, SCALAR_XOR, SIMD_XOR)
+BULK_OP_KERNEL(bulk_andnot, SCALAR_ANDNOT, SIMD_ANDNOT)
+
+static usize popcount_scalar(const u64* restrict words, usize num_words) {
+	let_mut count = static_cast(usize)(0);
+	for(let_mut i = static_cast(usize)(0); i < num_words; ++i) {
+		count += static_cast(usize)(__builtin_popcountll(words[i]));
+	}
+	return count;
+}
+
+#if CNX_BIT_VECTOR_AVX2_KERNELS
+
+__attr(target("popcnt")) static usize popcount_popcnt(const u64* restrict words, usize num_words) {
+	let_mut count = static_cast(usize)(0);
+	for(let_mut i = static_cast(usize)(0); i < num_words; ++i) {
+		count += static_cast(usize)(__builtin_popcountll(words[i]));
+	}
+	return count;
+}
+
+/// @brief Counts set bits 256 at a time, using a nibble lookup table to count each byte and
+/// `vpsadbw` to horizontally accumulate the byte counts into 64-bit lanes
+__attr(target("avx2,popcnt")) static usize
+	popcount_avx2(const u64* restrict words, usize num_words) {
+	let lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, // NOLINT
+								  0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4); // NOLINT
+	let low_mask = _mm256_set1_epi8(0x0F); // NOLINT
+	let zero = _mm256_setzero_si256();
+	let_mut accumulator = _mm256_setzero_si256();
+
+	let_mut i = static_cast(usize)(0);
+	for(; i + 4 <= num_words; i += 4) {
+		let vec
+			= _mm256_loadu_si256(static_cast(const __m256i*)(static_cast(const void*)(words + i)));
+		let low = _mm256_and_si256(vec, low_mask);
+		let high = _mm256_and_si256(_mm256_srli_epi16(vec, 4), low_mask); // NOLINT
+		let counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low),
+									 _mm256_shuffle_epi8(lookup, high));
+		accumulator = _mm256_add_epi64(accumulator, _mm256_sad_epu8(counts, zero));
+	}
+
+	let_mut count = static_cast(usize)(_mm256_extract_epi64(accumulator, 0))
+					+ static_cast(usize)(_mm256_extract_epi64(accumulator, 1))
+					+ static_cast(usize)(_mm256_extract_epi64(accumulator, 2))
+					+ static_cast(usize)(_mm256_extract_epi64(accumulator, 3));
+	for(; i < num_words; ++i) {
+		count += static_cast(usize)(__builtin_popcountll(words[i]));
+	}
+	return count;
+}
+
+#endif // CNX_BIT_VECTOR_AVX2_KERNELS
+
+static usize popcount(const u64* restrict words, usize num_words) {
+#if CNX_BIT_VECTOR_AVX2_KERNELS
+	if(cpu_has_avx2() && cpu_has_popcnt()) {
+		return popcount_avx2(words, num_words);
+	}
+
+	if(cpu_has_popcnt()) {
+		return popcount_popcnt(words, num_words);
+	}
+#endif // CNX_BIT_VECTOR_AVX2_KERNELS
+
+	return popcount_scalar(words, num_words);
+}
+
+/// @brief Finds the first bit at or after `start` whose value, xor'd with `invert`, is set.
+/// Skips a whole word at a time, using count-trailing-zeros to locate the bit within a word
+static usize find_from(const CnxBitVector* restrict self, usize start, u64 invert) {
+	if(start >= self->m_size) {
+		return self->m_size;
+	}
+
+	let num_words = words_for_bits(self->m_size);
+	let_mut index = word_index(start);
+	let_mut word = (self->m_words[index] ^ invert)
+				   & (ALL_BITS << (start % CNX_BIT_VECTOR_BITS_PER_WORD));
+	while(word == 0) {
+		++index;
+		if(index >= num_words) {
+			return self->m_size;
+		}
+		word = self->m_words[index] ^ invert;
+	}
+
+	let found = index * CNX_BIT_VECTOR_BITS_PER_WORD
+				+ static_cast(usize)(__builtin_ctzll(word));
+	// when searching for unset bits, the unused bits of the last word read as set
+	return cnx_min(found, self->m_size);
+}
+
+CnxBitVector cnx_bit_vector_new(void) {
+	return cnx_bit_vector_new_with_allocator(DEFAULT_ALLOCATOR);
+}
+
+CnxBitVector cnx_bit_vector_new_with_allocator(CnxAllocator allocator) {
+	return (CnxBitVector){.m_words = nullptr,
+						  .m_size = 0,
+						  .m_capacity = 0,
+						  .m_allocator = allocator};
+}
+
+CnxBitVector cnx_bit_vector_new_with_capacity(usize capacity) {
+	return cnx_bit_vector_new_with_capacity_with_allocator(capacity, DEFAULT_ALLOCATOR);
+}
+
+CnxBitVector cnx_bit_vector_new_with_capacity_with_allocator(usize capacity, CnxAllocator allocator) {
+	let_mut self = cnx_bit_vector_new_with_allocator(allocator);
+	cnx_bit_vector_reserve(self, capacity);
+	return self;
+}
+
+CnxBitVector cnx_bit_vector_new_with_size(usize size) {
+	return cnx_bit_vector_new_with_size_with_allocator(size, DEFAULT_ALLOCATOR);
+}
+
+CnxBitVector cnx_bit_vector_new_with_size_with_allocator(usize size, CnxAllocator allocator) {
+	let_mut self = cnx_bit_vector_new_with_allocator(allocator);
+	cnx_bit_vector_resize(self, size);
+	return self;
+}
+
+CnxBitVector(cnx_bit_vector_clone)(const CnxBitVector* restrict self) {
+	let_mut clone = cnx_bit_vector_new_with_capacity_with_allocator(self->m_size,
+																	self->m_allocator);
+	if(self->m_size != 0) {
+		cnx_memcpy(u64, clone.m_words, self->m_words, words_for_bits(self->m_size));
+	}
+	clone.m_size = self->m_size;
+	return clone;
+}
+
+void(cnx_bit_vector_free)(void* restrict self) {
+	let_mut _self = static_cast(CnxBitVector*)(self);
+	if(_self->m_words != nullptr) {
+		cnx_allocator_deallocate(_self->m_allocator, _self->m_words);
+	}
+	_self->m_words = nullptr;
+	_self->m_size = 0;
+	_self->m_capacity = 0;
+}
+
+usize(cnx_bit_vector_size)(const CnxBitVector* restrict self) {
+	return self->m_size;
+}
+
+usize(cnx_bit_vector_capacity)(const CnxBitVector* restrict self) {
+	return self->m_capacity * CNX_BIT_VECTOR_BITS_PER_WORD;
+}
+
+bool(cnx_bit_vector_is_empty)(const CnxBitVector* restrict self) {
+	return self->m_size == 0;
+}
+
+usize(cnx_bit_vector_word_count)(const CnxBitVector* restrict self) {
+	return words_for_bits(self->m_size);
+}
+
+u64* cnx_bit_vector_data_mut(CnxBitVector* restrict self) {
+	return self->m_words;
+}
+
+const u64* cnx_bit_vector_data_const(const CnxBitVector* restrict self) {
+	return self->m_words;
+}
+
+bool(cnx_bit_vector_test)(const CnxBitVector* restrict self, usize index) {
+	cnx_assert(index < self->m_size, "cnx_bit_vector_test called with index out of bounds");
+	return (self->m_words[word_index(index)] & bit_mask(index)) != 0;
+}
+
+void(cnx_bit_vector_set)(CnxBitVector* restrict self, usize index) {
+	cnx_assert(index < self->m_size, "cnx_bit_vector_set called with index out of bounds");
+	self->m_words[word_index(index)] |= bit_mask(index);
+}
+
+void(cnx_bit_vector_reset)(CnxBitVector* restrict self, usize index) {
+	cnx_assert(index < self->m_size, "cnx_bit_vector_reset called with index out of bounds");
+	self->m_words[word_index(index)] &= ~bit_mask(index);
+}
+
+void(cnx_bit_vector_flip)(CnxBitVector* restrict self, usize index) {
+	cnx_assert(index < self->m_size, "cnx_bit_vector_flip called with index out of bounds");
+	self->m_words[word_index(index)] ^= bit_mask(index);
+}
+
+void(cnx_bit_vector_assign)(CnxBitVector* restrict self, usize index, bool value) {
+	cnx_assert(index < self->m_size, "cnx_bit_vector_assign called with index out of bounds");
+	let mask = bit_mask(index);
+	let_mut word = &(self->m_words[word_index(index)]);
+	*word = (*word & ~mask) | (value ? mask : 0);
+}
+
+void(cnx_bit_vector_set_range)(CnxBitVector* restrict self, usize index, usize count) {
+	cnx_assert(index <= self->m_size && count <= self->m_size - index,
+			   "cnx_bit_vector_set_range called with range out of bounds");
+	if(count == 0) {
+		return;
+	}
+
+	let last = index + count - 1;
+	let first_word = word_index(index);
+	let last_word = word_index(last);
+	let first_mask = ALL_BITS << (index % CNX_BIT_VECTOR_BITS_PER_WORD);
+	let last_mask
+		= ALL_BITS >> (CNX_BIT_VECTOR_BITS_PER_WORD - 1 - last % CNX_BIT_VECTOR_BITS_PER_WORD);
+
+	if(first_word == last_word) {
+		self->m_words[first_word] |= first_mask & last_mask;
+		return;
+	}
+
+	self->m_words[first_word] |= first_mask;
+	cnx_memset(u64, self->m_words + first_word + 1, 0xFF, last_word - first_word - 1); // NOLINT
+	self->m_words[last_word] |= last_mask;
+}
+
+void(cnx_bit_vector_reset_range)(CnxBitVector* restrict self, usize index, usize count) {
+	cnx_assert(index <= self->m_size && count <= self->m_size - index,
+			   "cnx_bit_vector_reset_range called with range out of bounds");
+	if(count == 0) {
+		return;
+	}
+
+	let last = index + count - 1;
+	let first_word = word_index(index);
+	let last_word = word_index(last);
+	let first_mask = ALL_BITS << (index % CNX_BIT_VECTOR_BITS_PER_WORD);
+	let last_mask
+		= ALL_BITS >> (CNX_BIT_VECTOR_BITS_PER_WORD - 1 - last % CNX_BIT_VECTOR_BITS_PER_WORD);
+
+	if(first_word == last_word) {
+		self->m_words[first_word] &= ~(first_mask & last_mask);
+		return;
+	}
+
+	self->m_words[first_word] &= ~first_mask;
+	cnx_memset(u64, self->m_words + first_word + 1, 0, last_word - first_word - 1);
+	self->m_words[last_word] &= ~last_mask;
+}
+
+void(cnx_bit_vector_set_all)(CnxBitVector* restrict self) {
+	if(self->m_size == 0) {
+		return;
+	}
+
+	cnx_memset(u64, self->m_words, 0xFF, words_for_bits(self->m_size)); // NOLINT
+	clear_unused_bits(self);
+}
+
+void(cnx_bit_vector_reset_all)(CnxBitVector* restrict self) {
+	if(self->m_size == 0) {
+		return;
+	}
+
+	cnx_memset(u64, self->m_words, 0, words_for_bits(self->m_size));
+}
+
+void(cnx_bit_vector_flip_all)(CnxBitVector* restrict self) {
+	if(self->m_size == 0) {
+		return;
+	}
+
+	let num_words = words_for_bits(self->m_size);
+	for(let_mut i = static_cast(usize)(0); i < num_words; ++i) {
+		self->m_words[i] = ~self->m_words[i];
+	}
+	clear_unused_bits(self);
+}
+
+void(cnx_bit_vector_push_back)(CnxBitVector* restrict self, bool value) {
+	if(self->m_size == cnx_bit_vector_capacity(*self)) {
+		let new_capacity = cnx_max(self->m_capacity * 2, static_cast(usize)(1));
+		cnx_bit_vector_reserve(*self, new_capacity * CNX_BIT_VECTOR_BITS_PER_WORD);
+	}
+
+	if(self->m_size % CNX_BIT_VECTOR_BITS_PER_WORD == 0) {
+		self->m_words[word_index(self->m_size)] = 0;
+	}
+
+	if(value) {
+		self->m_words[word_index(self->m_size)] |= bit_mask(self->m_size);
+	}
+	self->m_size++;
+}
+
+void(cnx_bit_vector_resize)(CnxBitVector* restrict self, usize new_size) {
+	if(new_size <= self->m_size) {
+		self->m_size = new_size;
+		clear_unused_bits(self);
+		return;
+	}
+
+	cnx_bit_vector_reserve(*self, new_size);
+	// the unused bits of the current last word are already zero, so we only need to zero the words
+	// that weren't in use
+	let old_words = words_for_bits(self->m_size);
+	let new_words = words_for_bits(new_size);
+	cnx_memset(u64, self->m_words + old_words, 0, new_words - old_words);
+	self->m_size = new_size;
+}
+
+void(cnx_bit_vector_reserve)(CnxBitVector* restrict self, usize new_capacity) {
+	let new_words = words_for_bits(new_capacity);
+	if(new_words <= self->m_capacity) {
+		return;
+	}
+
+	if(self->m_words == nullptr) {
+		self->m_words = cnx_allocator_allocate_array_t(u64, self->m_allocator, new_words);
+	}
+	else {
+		self->m_words = cnx_allocator_reallocate_array_t(u64,
+														 self->m_allocator,
+														 self->m_words,
+														 self->m_capacity,
+														 new_words);
+	}
+	self->m_capacity = new_words;
+}
+
+void(cnx_bit_vector_shrink_to_fit)(CnxBitVector* restrict self) {
+	let num_words = words_for_bits(self->m_size);
+	if(num_words == self->m_capacity) {
+		return;
+	}
+
+	if(num_words == 0) {
+		cnx_allocator_deallocate(self->m_allocator, self->m_words);
+		self->m_words = nullptr;
+	}
+	else {
+		self->m_words = cnx_allocator_reallocate_array_t(u64,
+														 self->m_allocator,
+														 self->m_words,
+														 self->m_capacity,
+														 num_words);
+	}
+	self->m_capacity = num_words;
+}
+
+void(cnx_bit_vector_clear)(CnxBitVector* restrict self) {
+	self->m_size = 0;
+}
+
+void(cnx_bit_vector_and)(CnxBitVector* restrict self, const CnxBitVector* restrict other) {
+	cnx_assert(self->m_size == other->m_size,
+			   "cnx_bit_vector_and called with CnxBitVectors of different sizes");
+	bulk_and(self->m_words, other->m_words, words_for_bits(self->m_size));
+}
+
+void(cnx_bit_vector_or)(CnxBitVector* restrict self, const CnxBitVector* restrict other) {
+	cnx_assert(self->m_size == other->m_size,
+			   "cnx_bit_vector_or called with CnxBitVectors of different sizes");
+	bulk_or(self->m_words, other->m_words, words_for_bits(self->m_size));
+}
+
+void(cnx_bit_vector_xor)(CnxBitVector* restrict self, const CnxBitVector* restrict other) {
+	cnx_assert(self->m_size == other->m_size,
+			   "cnx_bit_vector_xor called with CnxBitVectors of different sizes");
+	bulk_xor(self->m_words, other->m_words, words_for_bits(self->m_size));
+}
+
+void(cnx_bit_vector_andnot)(CnxBitVector* restrict self, const CnxBitVector* restrict other) {
+	cnx_assert(self->m_size == other->m_size,
+			   "cnx_bit_vector_andnot called with CnxBitVectors of different sizes");
+	bulk_andnot(self->m_words, other->m_words, words_for_bits(self->m_size));
+}
+
+bool(cnx_bit_vector_equals)(const CnxBitVector* restrict self, const CnxBitVector* restrict other) {
+	if(self->m_size != other->m_size) {
+		return false;
+	}
+
+	if(self->m_size == 0) {
+		return true;
+	}
+
+	return memcmp(self->m_words, other->m_words, words_for_bits(self->m_size) * sizeof(u64)) == 0;
+}
+
+usize(cnx_bit_vector_count)(const CnxBitVector* restrict self) {
+	if(self->m_size == 0) {
+		return 0;
+	}
+
+	return popcount(self->m_words, words_for_bits(self->m_size));
+}
+
+bool(cnx_bit_vector_any)(const CnxBitVector* restrict self) {
+	let num_words = words_for_bits(self->m_size);
+	for(let_mut i = static_cast(usize)(0); i < num_words; ++i) {
+		if(self->m_words[i] != 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool(cnx_bit_vector_none)(const CnxBitVector* restrict self) {
+	return !cnx_bit_vector_any(*self);
+}
+
+bool(cnx_bit_vector_all)(const CnxBitVector* restrict self) {
+	return cnx_bit_vector_find_first_unset(*self) == self->m_size;
+}
+
+usize(cnx_bit_vector_find_first_set)(const CnxBitVector* restrict self) {
+	return find_from(self, 0, 0);
+}
+
+usize(cnx_bit_vector_find_next_set)(const CnxBitVector* restrict self, usize index) {
+	return find_from(self, index + 1, 0);
+}
+
+usize(cnx_bit_vector_find_first_unset)(const CnxBitVector* restrict self) {
+	return find_from(self, 0, ALL_BITS);
+}
+
+usize(cnx_bit_vector_find_next_unset)(const CnxBitVector* restrict self, usize index) {
+	return find_from(self, index + 1, ALL_BITS);
+}
+
+static const cnx_bit_vector_set_bits_vtable_t cnx_bit_vector_set_bits_vtable = {
+	.begin = cnx_bit_vector_set_bits_begin,
+	.end = cnx_bit_vector_set_bits_end,
+	.cbegin = cnx_bit_vector_set_bits_begin,
+	.cend = cnx_bit_vector_set_bits_end,
+};
+
+CnxBitVectorSetBits(cnx_bit_vector_set_bits)(const CnxBitVector* restrict self) {
+	return (CnxBitVectorSetBits){.m_bit_vector = self, .m_vtable = &cnx_bit_vector_set_bits_vtable};
+}
+
+/// @brief Creates a `CnxBitVectorSetBitsIterator` (one pointing to the end of the iteration)
+///
+/// @param self - The `CnxBitVectorSetBits` to get an iterator for
+///
+/// @return a `CnxBitVectorSetBitsIterator` into `self`
+static CnxBitVectorSetBitsIterator
+cnx_bit_vector_set_bits_iterator_new(const CnxBitVectorSetBits* restrict self) {
+	return (CnxBitVectorSetBitsIterator){.m_index = self->m_bit_vector->m_size,
+										 .m_bit_vector = self->m_bit_vector};
+}
+
+static const_usize_ref
+cnx_bit_vector_set_bits_iterator_next(CnxForwardIterator(const_usize_ref) * restrict self) {
+	let_mut _self = static_cast(CnxBitVectorSetBitsIterator*)(self->m_self);
+
+	cnx_assert(_self->m_index < _self->m_bit_vector->m_size,
+			   "Iterator advanced when iterator is positioned after the end of the iteration "
+			   "(iterator out of bounds)");
+	_self->m_index = cnx_bit_vector_find_next_set(*(_self->m_bit_vector), _self->m_index);
+	return &(_self->m_index);
+}
+
+static const_usize_ref
+cnx_bit_vector_set_bits_iterator_current(const CnxForwardIterator(const_usize_ref) * restrict self) {
+	let _self = static_cast(const CnxBitVectorSetBitsIterator*)(self->m_self);
+	return &(_self->m_index);
+}
+
+static bool
+cnx_bit_vector_set_bits_iterator_equals(const CnxForwardIterator(const_usize_ref) * restrict self,
+										const CnxForwardIterator(const_usize_ref) * restrict rhs) {
+	let _self = static_cast(const CnxBitVectorSetBitsIterator*)(self->m_self);
+	let _rhs = static_cast(const CnxBitVectorSetBitsIterator*)(rhs->m_self);
+
+	return _self->m_index == _rhs->m_index && _self->m_bit_vector == _rhs->m_bit_vector;
+}
+
+ImplIntoCnxForwardIterator(CnxBitVectorSetBits,
+						   const_usize_ref,
+						   cnx_bit_vector_set_bits_into_iter,
+						   cnx_bit_vector_set_bits_iterator_new,
+						   cnx_bit_vector_set_bits_iterator_next,
+						   cnx_bit_vector_set_bits_iterator_current,
+						   cnx_bit_vector_set_bits_iterator_equals);
+
+CnxForwardIterator(const_usize_ref)
+	cnx_bit_vector_set_bits_begin(const CnxBitVectorSetBits* restrict self) {
+	let_mut iter = cnx_bit_vector_set_bits_into_iter(self);
+	let_mut inner = static_cast(CnxBitVectorSetBitsIterator*)(iter.m_self);
+	inner->m_index = cnx_bit_vector_find_first_set(*(self->m_bit_vector));
+	return iter;
+}
+
+CnxForwardIterator(const_usize_ref)
+	cnx_bit_vector_set_bits_end(const CnxBitVectorSetBits* restrict self) {
+	return cnx_bit_vector_set_bits_into_iter(self);
+}
@@ -0,0 +1,584 @@
+/// @file ByteScan.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Internal SIMD byte-scanning kernels used by the string and filesystem modules
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <Cnx/Platform.h>
+#include <Cnx/__string/__byte_scan.h>
+#include <memory.h>
+
+#if(CNX_PLATFORM_COMPILER_GCC || CNX_PLATFORM_COMPILER_CLANG) \
+	&& (defined(__x86_64__) || defined(_M_X64))
+	/// @brief Whether the SSE2, SSSE3, and AVX2 scanning kernels are available for this target
+	#define CNX_BYTE_SCAN_SIMD_KERNELS 1
+	#include <immintrin.h>
+#else
+	/// @brief Whether the SSE2, SSSE3, and AVX2 scanning kernels are available for this target
+	#define CNX_BYTE_SCAN_SIMD_KERNELS 0
+#endif
+
+/// @brief The high-nibble lookup table for `CnxByteSet`: maps the high nibble of a byte to the
+/// bit representing it in the low-nibble tables
+#define HIGH_NIBBLE_BITS 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 // NOLINT
+
+CnxByteSet cnx_byte_set_new(restrict const_cstring bytes, usize length) {
+	let_mut set = (CnxByteSet){0};
+	for(let_mut i = static_cast(usize)(0); i < length; ++i) {
+		let byte = static_cast(u8)(bytes[i]);
+		set.m_bitmap[byte / 64U] |= static_cast(u64)(1) << (byte % 64U);
+		set.m_low_nibble_tables[byte >> 7U][byte & 0xFU] |= static_cast(u8)(1U << ((byte >> 4U) & 0x7U));
+	}
+
+	return set;
+}
+
+__attr(nodiscard) static usize
+	count_scalar(const_cstring data, usize length, char byte, usize start) {
+	let_mut count = static_cast(usize)(0);
+	for(let_mut i = start; i < length; ++i) {
+		count += data[i] == byte;
+	}
+	return count;
+}
+
+__attr(nodiscard) static usize find_any_of_scalar(const_cstring data,
+												  usize length,
+												  const CnxByteSet* restrict set,
+												  usize start) {
+	for(let_mut i = start; i < length; ++i) {
+		if(cnx_byte_set_contains(set, data[i])) {
+			return i;
+		}
+	}
+	return length;
+}
+
+__attr(nodiscard) static usize find_non_ascii_scalar(const_cstring data, usize length, usize start) {
+	let_mut i = start;
+	// check a word at a time for any set high bits
+	for(; i + sizeof(u64) <= length; i += sizeof(u64)) {
+		u64 word = 0;
+		memcpy(&word, data + i, sizeof(word));
+		if((word & 0x8080808080808080ULL) != 0) { // NOLINT
+			break;
+		}
+	}
+
+	for(; i < length; ++i) {
+		if(static_cast(u8)(data[i]) >= 0x80U) { // NOLINT
+			return i;
+		}
+	}
+	return length;
+}
+
+__attr(always_inline) __attr(nodiscard) static inline bool is_whitespace(char byte) {
+	return byte == ' ' || static_cast(u8)(byte - '\t') <= static_cast(u8)('\r' - '\t');
+}
+
+__attr(nodiscard) static usize
+	find_whitespace_scalar(const_cstring data, usize length, usize start) {
+	for(let_mut i = start; i < length; ++i) {
+		if(is_whitespace(data[i])) {
+			return i;
+		}
+	}
+	return length;
+}
+
+__attr(nodiscard) static usize
+	find_non_whitespace_scalar(const_cstring data, usize length, usize start) {
+	for(let_mut i = start; i < length; ++i) {
+		if(!is_whitespace(data[i])) {
+			return i;
+		}
+	}
+	return length;
+}
+
+/// @brief Searches `data[0, end)` backwards for a non-whitespace byte, returning its index or
+/// `length` if there is none
+__attr(nodiscard) static usize
+	rfind_non_whitespace_scalar(const_cstring data, usize length, usize end) {
+	for(let_mut i = end; i > 0; --i) {
+		if(!is_whitespace(data[i - 1])) {
+			return i - 1;
+		}
+	}
+	return length;
+}
+
+/// @brief Flips the case of `byte` if it's an ASCII letter in `[first, first + 25]`. `first` must
+/// be `'A'`, to convert to lowercase, or `'a'`, to convert to uppercase
+__attr(always_inline) __attr(nodiscard) static inline char flip_case_from(char byte, char first) {
+	return static_cast(u8)(byte - first) <= static_cast(u8)('Z' - 'A')
+			   ? static_cast(char)(byte ^ 0x20) // NOLINT
+			   : byte;
+}
+
+static void
+	convert_case_scalar(const_cstring data, usize length, char* out, char first, usize start) {
+	for(let_mut i = start; i < length; ++i) {
+		out[i] = flip_case_from(data[i], first);
+	}
+}
+
+__attr(nodiscard) static bool
+	equal_ignore_case_scalar(const_cstring lhs, const_cstring rhs, usize length, usize start) {
+	for(let_mut i = start; i < length; ++i) {
+		if(flip_case_from(lhs[i], 'A') != flip_case_from(rhs[i], 'A')) {
+			return false;
+		}
+	}
+	return true;
+}
+
+#if CNX_BYTE_SCAN_SIMD_KERNELS
+
+__attr(always_inline) __attr(nodiscard) static inline bool cpu_has_avx2(void) {
+	return __builtin_cpu_supports("avx2");
+}
+
+__attr(always_inline) __attr(nodiscard) static inline bool cpu_has_ssse3(void) {
+	return __builtin_cpu_supports("ssse3");
+}
+
+	/// @brief Loads an unaligned vector of type `vector_t` from `data + index`
+	#define LOAD(loadu, vector_t, data, index) \
+		loadu(static_cast(const vector_t*)(static_cast(const void*)((data) + (index))))
+	/// @brief Stores the vector `value` of type `vector_t` to `data + index`, unaligned
+	#define STORE(storeu, vector_t, data, index, value) \
+		storeu(static_cast(vector_t*)(static_cast(void*)((data) + (index))), value)
+
+__attr(target("avx2")) __attr(nodiscard) static usize
+	count_avx2(const_cstring data, usize length, char byte) {
+	let needle = _mm256_set1_epi8(byte);
+	let_mut count = static_cast(usize)(0);
+	let_mut i = static_cast(usize)(0);
+	for(; i + 32 <= length; i += 32) {
+		let block = LOAD(_mm256_loadu_si256, __m256i, data, i);
+		let mask = static_cast(u32)(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+		count += static_cast(usize)(__builtin_popcount(mask));
+	}
+	return count + count_scalar(data, length, byte, i);
+}
+
+__attr(nodiscard) static usize count_sse2(const_cstring data, usize length, char byte) {
+	let needle = _mm_set1_epi8(byte);
+	let_mut count = static_cast(usize)(0);
+	let_mut i = static_cast(usize)(0);
+	for(; i + 16 <= length; i += 16) {
+		let block = LOAD(_mm_loadu_si128, __m128i, data, i);
+		let mask = static_cast(u32)(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+		count += static_cast(usize)(__builtin_popcount(mask));
+	}
+	return count + count_scalar(data, length, byte, i);
+}
+
+__attr(target("avx2")) __attr(nodiscard) static usize
+	find_any_of_avx2(const_cstring data, usize length, const CnxByteSet* restrict set) {
+	let low_table = LOAD(_mm_loadu_si128, __m128i, set->m_low_nibble_tables[0], 0);
+	let high_table = LOAD(_mm_loadu_si128, __m128i, set->m_low_nibble_tables[1], 0);
+	let ascii_table = _mm256_broadcastsi128_si256(low_table);
+	let non_ascii_table = _mm256_broadcastsi128_si256(high_table);
+	let bits_table = _mm256_setr_epi8(HIGH_NIBBLE_BITS, HIGH_NIBBLE_BITS);
+	let nibble_mask = _mm256_set1_epi8(0x0F); // NOLINT
+	let zero = _mm256_setzero_si256();
+
+	let_mut i = static_cast(usize)(0);
+	for(; i + 32 <= length; i += 32) {
+		let block = LOAD(_mm256_loadu_si256, __m256i, data, i);
+		let low = _mm256_and_si256(block, nibble_mask);
+		let high = _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble_mask);
+		let classes = _mm256_blendv_epi8(_mm256_shuffle_epi8(ascii_table, low),
+										 _mm256_shuffle_epi8(non_ascii_table, low),
+										 block);
+		let bits = _mm256_shuffle_epi8(bits_table, high);
+		let misses = _mm256_cmpeq_epi8(_mm256_and_si256(classes, bits), zero);
+		let mask = ~static_cast(u32)(_mm256_movemask_epi8(misses));
+		if(mask != 0) {
+			return i + static_cast(usize)(__builtin_ctz(mask));
+		}
+	}
+	return find_any_of_scalar(data, length, set, i);
+}
+
+__attr(target("ssse3")) __attr(nodiscard) static usize
+	find_any_of_ssse3(const_cstring data, usize length, const CnxByteSet* restrict set) {
+	let ascii_table = LOAD(_mm_loadu_si128, __m128i, set->m_low_nibble_tables[0], 0);
+	let non_ascii_table = LOAD(_mm_loadu_si128, __m128i, set->m_low_nibble_tables[1], 0);
+	let bits_table = _mm_setr_epi8(HIGH_NIBBLE_BITS);
+	let nibble_mask = _mm_set1_epi8(0x0F); // NOLINT
+	let zero = _mm_setzero_si128();
+
+	let_mut i = static_cast(usize)(0);
+	for(; i + 16 <= length; i += 16) {
+		let block = LOAD(_mm_loadu_si128, __m128i, data, i);
+		let low = _mm_and_si128(block, nibble_mask);
+		let high = _mm_and_si128(_mm_srli_epi16(block, 4), nibble_mask);
+		// SSSE3 has no blendv, so select between the tables with the sign mask of each byte
+		let non_ascii = _mm_cmplt_epi8(block, zero);
+		let classes = _mm_or_si128(_mm_and_si128(non_ascii, _mm_shuffle_epi8(non_ascii_table, low)),
+								   _mm_andnot_si128(non_ascii, _mm_shuffle_epi8(ascii_table, low)));
+		let bits = _mm_shuffle_epi8(bits_table, high);
+		let misses = _mm_cmpeq_epi8(_mm_and_si128(classes, bits), zero);
+		let mask = ~static_cast(u32)(_mm_movemask_epi8(misses)) & 0xFFFFU; // NOLINT
+		if(mask != 0) {
+			return i + static_cast(usize)(__builtin_ctz(mask));
+		}
+	}
+	return find_any_of_scalar(data, length, set, i);
+}
+
+__attr(target("avx2")) __attr(nodiscard) static usize
+	find_non_ascii_avx2(const_cstring data, usize length) {
+	let_mut i = static_cast(usize)(0);
+	for(; i + 32 <= length; i += 32) {
+		let block = LOAD(_mm256_loadu_si256, __m256i, data, i);
+		let mask = static_cast(u32)(_mm256_movemask_epi8(block));
+		if(mask != 0) {
+			return i + static_cast(usize)(__builtin_ctz(mask));
+		}
+	}
+	return find_non_ascii_scalar(data, length, i);
+}
+
+__attr(nodiscard) static usize find_non_ascii_sse2(const_cstring data, usize length) {
+	let_mut i = static_cast(usize)(0);
+	for(; i + 16 <= length; i += 16) {
+		let block = LOAD(_mm_loadu_si128, __m128i, data, i);
+		let mask = static_cast(u32)(_mm_movemask_epi8(block));
+		if(mask != 0) {
+			return i + static_cast(usize)(__builtin_ctz(mask));
+		}
+	}
+	return find_non_ascii_scalar(data, length, i);
+}
+
+/// @brief Returns a mask of the bytes of `block` in `[first, first + range]`
+__attr(target("avx2")) __attr(always_inline) __attr(nodiscard) static inline __m256i
+	in_range_avx2(__m256i block, char first, char range) {
+	// a single unsigned comparison checks both ends of the range
+	let offset = _mm256_sub_epi8(block, _mm256_set1_epi8(first));
+	return _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(range)), offset);
+}
+
+/// @brief Returns a mask of the bytes of `block` in `[first, first + range]`
+__attr(always_inline) __attr(nodiscard) static inline __m128i
+	in_range_sse2(__m128i block, char first, char range) {
+	// a single unsigned comparison checks both ends of the range
+	let offset = _mm_sub_epi8(block, _mm_set1_epi8(first));
+	return _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(range)), offset);
+}
+
+/// @brief Returns a mask of the whitespace bytes of `block`
+__attr(target("avx2")) __attr(always_inline) __attr(nodiscard) static inline u32
+	whitespace_mask_avx2(__m256i block) {
+	// '\t' through '\r' are contiguous, so check them with one range comparison
+	let is_control = in_range_avx2(block, '\t', '\r' - '\t');
+	let matches = _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(' ')), is_control);
+	return static_cast(u32)(_mm256_movemask_epi8(matches));
+}
+
+/// @brief Returns a mask of the whitespace bytes of `block`
+__attr(always_inline) __attr(nodiscard) static inline u32 whitespace_mask_sse2(__m128i block) {
+	let is_control = in_range_sse2(block, '\t', '\r' - '\t');
+	let matches = _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(' ')), is_control);
+	return static_cast(u32)(_mm_movemask_epi8(matches));
+}
+
+__attr(target("avx2")) __attr(nodiscard) static usize
+	find_whitespace_avx2(const_cstring data, usize length) {
+	let_mut i = static_cast(usize)(0);
+	for(; i + 32 <= length; i += 32) {
+		let mask = whitespace_mask_avx2(LOAD(_mm256_loadu_si256, __m256i, data, i));
+		if(mask != 0) {
+			return i + static_cast(usize)(__builtin_ctz(mask));
+		}
+	}
+	return find_whitespace_scalar(data, length, i);
+}
+
+__attr(nodiscard) static usize find_whitespace_sse2(const_cstring data, usize length) {
+	let_mut i = static_cast(usize)(0);
+	for(; i + 16 <= length; i += 16) {
+		let mask = whitespace_mask_sse2(LOAD(_mm_loadu_si128, __m128i, data, i));
+		if(mask != 0) {
+			return i + static_cast(usize)(__builtin_ctz(mask));
+		}
+	}
+	return find_whitespace_scalar(data, length, i);
+}
+
+__attr(target("avx2")) __attr(nodiscard) static usize
+	find_non_whitespace_avx2(const_cstring data, usize length) {
+	let_mut i = static_cast(usize)(0);
+	for(; i + 32 <= length; i += 32) {
+		let mask = ~whitespace_mask_avx2(LOAD(_mm256_loadu_si256, __m256i, data, i));
+		if(mask != 0) {
+			return i + static_cast(usize)(__builtin_ctz(mask));
+		}
+	}
+	return find_non_whitespace_scalar(data, length, i);
+}
+
+__attr(nodiscard) static usize find_non_whitespace_sse2(const_cstring data, usize length) {
+	let_mut i = static_cast(usize)(0);
+	for(; i + 16 <= length; i += 16) {
+		let block = LOAD(_mm_loadu_si128, __m128i, data, i);
+		let mask = ~whitespace_mask_sse2(block) & 0xFFFFU; // NOLINT
+		if(mask != 0) {
+			return i + static_cast(usize)(__builtin_ctz(mask));
+		}
+	}
+	return find_non_whitespace_scalar(data, length, i);
+}
+
+__attr(target("avx2")) __attr(nodiscard) static usize
+	rfind_non_whitespace_avx2(const_cstring data, usize length) {
+	let_mut end = length;
+	for(; end >= 32; end -= 32) {
+		let mask = ~whitespace_mask_avx2(LOAD(_mm256_loadu_si256, __m256i, data, end - 32));
+		if(mask != 0) {
+			return end - 1 - static_cast(usize)(__builtin_clz(mask));
+		}
+	}
+	return rfind_non_whitespace_scalar(data, length, end);
+}
+
+__attr(nodiscard) static usize rfind_non_whitespace_sse2(const_cstring data, usize length) {
+	let_mut end = length;
+	for(; end >= 16; end -= 16) {
+		let block = LOAD(_mm_loadu_si128, __m128i, data, end - 16);
+		let mask = ~whitespace_mask_sse2(block) & 0xFFFFU; // NOLINT
+		if(mask != 0) {
+			// the mask only occupies the low 16 bits
+			return end - 1 - static_cast(usize)(__builtin_clz(mask) - 16);
+		}
+	}
+	return rfind_non_whitespace_scalar(data, length, end);
+}
+
+__attr(target("avx2")) static void
+	convert_case_avx2(const_cstring data, usize length, char* out, char first) {
+	let case_bit = _mm256_set1_epi8(0x20); // NOLINT
+	let_mut i = static_cast(usize)(0);
+	for(; i + 32 <= length; i += 32) {
+		let block = LOAD(_mm256_loadu_si256, __m256i, data, i);
+		let letters = in_range_avx2(block, first, 'Z' - 'A');
+		STORE(_mm256_storeu_si256,
+			  __m256i,
+			  out,
+			  i,
+			  _mm256_xor_si256(block, _mm256_and_si256(letters, case_bit)));
+	}
+	convert_case_scalar(data, length, out, first, i);
+}
+
+static void convert_case_sse2(const_cstring data, usize length, char* out, char first) {
+	let case_bit = _mm_set1_epi8(0x20); // NOLINT
+	let_mut i = static_cast(usize)(0);
+	for(; i + 16 <= length; i += 16) {
+		let block = LOAD(_mm_loadu_si128, __m128i, data, i);
+		let letters = in_range_sse2(block, first, 'Z' - 'A');
+		STORE(_mm_storeu_si128,
+			  __m128i,
+			  out,
+			  i,
+			  _mm_xor_si128(block, _mm_and_si128(letters, case_bit)));
+	}
+	convert_case_scalar(data, length, out, first, i);
+}
+
+__attr(target("avx2")) __attr(nodiscard) static bool
+	equal_ignore_case_avx2(const_cstring lhs, const_cstring rhs, usize length) {
+	let case_bit = _mm256_set1_epi8(0x20); // NOLINT
+	let_mut i = static_cast(usize)(0);
+	for(; i + 32 <= length; i += 32) {
+		let left = LOAD(_mm256_loadu_si256, __m256i, lhs, i);
+		let right = LOAD(_mm256_loadu_si256, __m256i, rhs, i);
+		// fold both sides to lowercase before comparing
+		let left_folded = _mm256_or_si256(
+			left,
+			_mm256_and_si256(in_range_avx2(left, 'A', 'Z' - 'A'), case_bit));
+		let right_folded = _mm256_or_si256(
+			right,
+			_mm256_and_si256(in_range_avx2(right, 'A', 'Z' - 'A'), case_bit));
+		if(static_cast(u32)(_mm256_movemask_epi8(_mm256_cmpeq_epi8(left_folded, right_folded)))
+		   != 0xFFFFFFFFU) // NOLINT
+		{
+			return false;
+		}
+	}
+	return equal_ignore_case_scalar(lhs, rhs, length, i);
+}
+
+__attr(nodiscard) static bool
+	equal_ignore_case_sse2(const_cstring lhs, const_cstring rhs, usize length) {
+	let case_bit = _mm_set1_epi8(0x20); // NOLINT
+	let_mut i = static_cast(usize)(0);
+	for(; i + 16 <= length; i += 16) {
+		let left = LOAD(_mm_loadu_si128, __m128i, lhs, i);
+		let right = LOAD(_mm_loadu_si128, __m128i, rhs, i);
+		// fold both sides to lowercase before comparing
+		let left_folded
+			= _mm_or_si128(left, _mm_and_si128(in_range_sse2(left, 'A', 'Z' - 'A'), case_bit));
+		let right_folded
+			= _mm_or_si128(right, _mm_and_si128(in_range_sse2(right, 'A', 'Z' - 'A'), case_bit));
+		if(_mm_movemask_epi8(_mm_cmpeq_epi8(left_folded, right_folded)) != 0xFFFF) { // NOLINT
+			return false;
+		}
+	}
+	return equal_ignore_case_scalar(lhs, rhs, length, i);
+}
+
+	#undef LOAD
+	#undef STORE
+
+#endif // CNX_BYTE_SCAN_SIMD_KERNELS
+
+usize cnx_byte_scan_count(restrict const_cstring data, usize length, char byte) {
+#if CNX_BYTE_SCAN_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		return count_avx2(data, length, byte);
+	}
+
+	return count_sse2(data, length, byte);
+#else
+	return count_scalar(data, length, byte, 0);
+#endif // CNX_BYTE_SCAN_SIMD_KERNELS
+}
+
+usize cnx_byte_scan_find(restrict const_cstring data, usize length, char byte) {
+	// `memchr` is already vectorized by every major libc, so there's nothing to gain from a
+	// hand-written kernel here
+	let found = static_cast(const_cstring)(memchr(data, byte, length));
+	return found == nullptr ? length : static_cast(usize)(found - data);
+}
+
+usize cnx_byte_scan_find_any_of(restrict const_cstring data,
+								usize length,
+								const CnxByteSet* restrict set) {
+#if CNX_BYTE_SCAN_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		return find_any_of_avx2(data, length, set);
+	}
+
+	if(cpu_has_ssse3()) {
+		return find_any_of_ssse3(data, length, set);
+	}
+#endif // CNX_BYTE_SCAN_SIMD_KERNELS
+
+	return find_any_of_scalar(data, length, set, 0);
+}
+
+usize cnx_byte_scan_find_non_ascii(restrict const_cstring data, usize length) {
+#if CNX_BYTE_SCAN_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		return find_non_ascii_avx2(data, length);
+	}
+
+	return find_non_ascii_sse2(data, length);
+#else
+	return find_non_ascii_scalar(data, length, 0);
+#endif // CNX_BYTE_SCAN_SIMD_KERNELS
+}
+
+usize cnx_byte_scan_find_whitespace(restrict const_cstring data, usize length) {
+#if CNX_BYTE_SCAN_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		return find_whitespace_avx2(data, length);
+	}
+
+	return find_whitespace_sse2(data, length);
+#else
+	return find_whitespace_scalar(data, length, 0);
+#endif // CNX_BYTE_SCAN_SIMD_KERNELS
+}
+
+usize cnx_byte_scan_find_non_whitespace(restrict const_cstring data, usize length) {
+#if CNX_BYTE_SCAN_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		return find_non_whitespace_avx2(data, length);
+	}
+
+	return find_non_whitespace_sse2(data, length);
+#else
+	return find_non_whitespace_scalar(data, length, 0);
+#endif // CNX_BYTE_SCAN_SIMD_KERNELS
+}
+
+usize cnx_byte_scan_rfind_non_whitespace(restrict const_cstring data, usize length) {
+#if CNX_BYTE_SCAN_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		return rfind_non_whitespace_avx2(data, length);
+	}
+
+	return rfind_non_whitespace_sse2(data, length);
+#else
+	return rfind_non_whitespace_scalar(data, length, length);
+#endif // CNX_BYTE_SCAN_SIMD_KERNELS
+}
+
+void cnx_byte_scan_to_lower(const_cstring data, usize length, char* out) {
+#if CNX_BYTE_SCAN_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		convert_case_avx2(data, length, out, 'A');
+		return;
+	}
+
+	convert_case_sse2(data, length, out, 'A');
+#else
+	convert_case_scalar(data, length, out, 'A', 0);
+#endif // CNX_BYTE_SCAN_SIMD_KERNELS
+}
+
+void cnx_byte_scan_to_upper(const_cstring data, usize length, char* out) {
+#if CNX_BYTE_SCAN_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		convert_case_avx2(data, length, out, 'a');
+		return;
+	}
+
+	convert_case_sse2(data, length, out, 'a');
+#else
+	convert_case_scalar(data, length, out, 'a', 0);
+#endif // CNX_BYTE_SCAN_SIMD_KERNELS
+}
+
+bool cnx_byte_scan_equal_ignore_case(restrict const_cstring lhs,
+									 restrict const_cstring rhs,
+									 usize length) {
+#if CNX_BYTE_SCAN_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		return equal_ignore_case_avx2(lhs, rhs, length);
+	}
+
+	return equal_ignore_case_sse2(lhs, rhs, length);
+#else
+	return equal_ignore_case_scalar(lhs, rhs, length, 0);
+#endif // CNX_BYTE_SCAN_SIMD_KERNELS
+}
@@ -0,0 +1,231 @@
+/// @file CompactString.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief A compact, allocator-implicit string type with a larger small-string capacity
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+
+#include <Cnx/Allocators.h>
+#include <Cnx/Assert.h>
+#include <Cnx/CompactString.h>
+#include <memory.h>
+
+/// @brief Sets the length of the given short `CnxCompactString`, null-terminating it
+__attr(always_inline) static inline void
+set_short_length(CnxCompactString* restrict self, usize length) {
+	self->m_short[length] = 0;
+	self->m_short[CNX_COMPACT_STRING_SHORT_CAPACITY]
+		= static_cast(char)(CNX_COMPACT_STRING_SHORT_CAPACITY - length);
+}
+
+/// @brief Sets the length of the given `CnxCompactString`, null-terminating it
+__attr(always_inline) static inline void
+set_length(CnxCompactString* restrict self, usize length) {
+	if((cnx_compact_string_is_short)(self)) {
+		set_short_length(self, length);
+	}
+	else {
+		self->m_length = length;
+		self->m_long[length] = 0;
+	}
+}
+
+/// @brief Returns a pointer to the first character of the given `CnxCompactString`
+__attr(always_inline) static inline cstring data(CnxCompactString* restrict self) {
+	return (cnx_compact_string_is_short)(self) ? self->m_short : self->m_long;
+}
+
+/// @brief Moves the contents of the given `CnxCompactString` into a newly allocated buffer of
+/// exactly the given capacity
+static void reallocate(CnxCompactString* restrict self, usize new_capacity) {
+	let length = (cnx_compact_string_length)(self);
+	cnx_assert(new_capacity >= length,
+			   "reallocate called with a capacity smaller than the CnxCompactString's length");
+
+	let_mut memory = cnx_allocator_allocate_array_t(char, DEFAULT_ALLOCATOR, new_capacity + 1);
+	cnx_memcpy(char, memory, data(self), length);
+	memory[length] = 0;
+	if(!(cnx_compact_string_is_short)(self)) {
+		cnx_allocator_deallocate(DEFAULT_ALLOCATOR, self->m_long);
+	}
+
+	self->m_long = memory;
+	self->m_length = length;
+	self->m_capacity = ___CNX_COMPACT_STRING_ENCODE_CAPACITY(new_capacity);
+	self->m_short[CNX_COMPACT_STRING_SHORT_CAPACITY]
+		= static_cast(char)(___CNX_COMPACT_STRING_LONG_TAG);
+}
+
+CnxCompactString cnx_compact_string_new(void) {
+	let_mut string = (CnxCompactString){0};
+	set_short_length(&string, 0);
+	return string;
+}
+
+CnxCompactString cnx_compact_string_new_with_capacity(usize capacity) {
+	let_mut string = cnx_compact_string_new();
+	if(capacity > CNX_COMPACT_STRING_SHORT_CAPACITY) {
+		reallocate(&string, capacity);
+	}
+	return string;
+}
+
+CnxCompactString cnx_compact_string_from_cstring(restrict const_cstring string, usize length) {
+	let_mut compact = cnx_compact_string_new_with_capacity(length);
+	cnx_memcpy(char, data(&compact), string, length);
+	set_length(&compact, length);
+	return compact;
+}
+
+CnxCompactString(cnx_compact_string_clone)(const CnxCompactString* restrict self) {
+	if((cnx_compact_string_is_short)(self)) {
+		return *self;
+	}
+
+	return cnx_compact_string_from_cstring(self->m_long, self->m_length);
+}
+
+void(cnx_compact_string_free)(void* restrict self) {
+	let self_ptr = static_cast(CnxCompactString*)(self);
+	if(!(cnx_compact_string_is_short)(self_ptr)) {
+		cnx_allocator_deallocate(DEFAULT_ALLOCATOR, self_ptr->m_long);
+	}
+	*self_ptr = cnx_compact_string_new();
+}
+
+CnxStringView(cnx_compact_string_into_stringview)(const CnxCompactString* restrict self) {
+	return cnx_stringview_from_raw((cnx_compact_string_into_cstring)(self),
+								   (cnx_compact_string_length)(self));
+}
+
+CnxString(cnx_compact_string_into_string)(const CnxCompactString* restrict self) {
+	return cnx_string_from_cstring((cnx_compact_string_into_cstring)(self),
+								   (cnx_compact_string_length)(self));
+}
+
+const_cstring(cnx_compact_string_at)(const CnxCompactString* restrict self, usize index) {
+	cnx_assert(index < (cnx_compact_string_length)(self),
+			   "cnx_compact_string_at called with index >= length (index out of bounds)");
+	return &((cnx_compact_string_into_cstring)(self)[index]);
+}
+
+cstring(cnx_compact_string_at_mut)(CnxCompactString* restrict self, usize index) {
+	cnx_assert(index < (cnx_compact_string_length)(self),
+			   "cnx_compact_string_at_mut called with index >= length (index out of bounds)");
+	return &(data(self)[index]);
+}
+
+void(cnx_compact_string_reserve)(CnxCompactString* restrict self, usize new_capacity) {
+	if(new_capacity > (cnx_compact_string_capacity)(self)) {
+		reallocate(self, new_capacity);
+	}
+}
+
+void(cnx_compact_string_shrink_to_fit)(CnxCompactString* restrict self) {
+	if((cnx_compact_string_is_short)(self)) {
+		return;
+	}
+
+	let length = self->m_length;
+	if(length <= CNX_COMPACT_STRING_SHORT_CAPACITY) {
+		let ptr = self->m_long;
+		cnx_memcpy(char, self->m_short, ptr, length);
+		set_short_length(self, length);
+		cnx_allocator_deallocate(DEFAULT_ALLOCATOR, ptr);
+	}
+	else if(length < (cnx_compact_string_capacity)(self)) {
+		reallocate(self, length);
+	}
+}
+
+void(cnx_compact_string_clear)(CnxCompactString* restrict self) {
+	set_length(self, 0);
+}
+
+/// @brief Ensures there is room for `additional` more characters in the given
+/// `CnxCompactString`, growing its capacity geometrically if there isn't
+__attr(always_inline) static inline void
+grow_for(CnxCompactString* restrict self, usize additional) {
+	let required = (cnx_compact_string_length)(self) + additional;
+	let capacity = (cnx_compact_string_capacity)(self);
+	if(required > capacity) {
+		let doubled = capacity * 2;
+		reallocate(self, doubled > required ? doubled : required);
+	}
+}
+
+void(cnx_compact_string_push_back)(CnxCompactString* restrict self, char character) {
+	grow_for(self, 1);
+	let length = (cnx_compact_string_length)(self);
+	data(self)[length] = character;
+	set_length(self, length + 1);
+}
+
+CnxOption(char)(cnx_compact_string_pop_back)(CnxCompactString* restrict self) {
+	let length = (cnx_compact_string_length)(self);
+	if(length == 0) {
+		return None(char);
+	}
+
+	let character = data(self)[length - 1];
+	set_length(self, length - 1);
+	return Some(char, character);
+}
+
+void cnx_compact_string_append_cstring(CnxCompactString* restrict self,
+									   restrict const_cstring string,
+									   usize length) {
+	let current_length = (cnx_compact_string_length)(self);
+	let contents = (cnx_compact_string_into_cstring)(self);
+	// `string` may be (a part of) `self`'s own contents, which growing could move or free, so
+	// track it by offset in that case
+	let aliases = string >= contents && string < contents + current_length;
+	let offset = static_cast(usize)(string - contents);
+
+	grow_for(self, length);
+	let source = aliases ? (cnx_compact_string_into_cstring)(self) + offset : string;
+	memmove(data(self) + current_length, source, length);
+	set_length(self, current_length + length);
+}
+
+bool cnx_compact_string_equal_cstring(const CnxCompactString* restrict self,
+									  restrict const_cstring string,
+									  usize length) {
+	return (cnx_compact_string_length)(self) == length
+		   && memcmp((cnx_compact_string_into_cstring)(self), string, length) == 0;
+}
+
+i32 cnx_compact_string_compare_cstring(const CnxCompactString* restrict self,
+									   restrict const_cstring string,
+									   usize length) {
+	let self_length = (cnx_compact_string_length)(self);
+	let shorter = self_length < length ? self_length : length;
+	let result = memcmp((cnx_compact_string_into_cstring)(self), string, shorter);
+	if(result != 0) {
+		return result;
+	}
+
+	return self_length < length ? -1 : (self_length > length ? 1 : 0);
+}
@@ -0,0 +1,519 @@
+/// @file Csv.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides streaming reading and writing of CSV (comma-separated values) data
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+
+#include <Cnx/Assert.h>
+#include <Cnx/Csv.h>
+#include <Cnx/__string/__decimal.h>
+#include <errno.h>
+#include <memory.h>
+
+#undef cnx_csv_row_get_i64
+#undef cnx_csv_row_get_u64
+#undef cnx_csv_row_get_f64
+
+/// @brief The number of fields a `CnxCsvReader` initially has room for in a row
+#define INITIAL_FIELDS_CAPACITY (static_cast(usize)(16U))
+
+/// @brief The outcome of attempting to parse a row from the available input
+typedef enum ParseStatus {
+	/// @brief A complete row was parsed
+	PARSE_ROW,
+	/// @brief The row continues past the end of the available input
+	PARSE_INCOMPLETE,
+	/// @brief The row is malformed
+	PARSE_MALFORMED,
+} ParseStatus;
+
+__attr(nodiscard) static inline CnxCsvReader
+	new_reader(CnxCsvOptions options, CnxAllocator allocator) {
+	const char terminators[] = {options.delimiter, '\n', '\r'};
+	return (CnxCsvReader){.m_file = nullptr,
+						  .m_options = options,
+						  .m_terminators = cnx_byte_set_new(terminators, sizeof(terminators)),
+						  .m_data = nullptr,
+						  .m_length = 0,
+						  .m_position = 0,
+						  .m_end_of_input = false,
+						  .m_buffer = nullptr,
+						  .m_buffer_capacity = 0,
+						  .m_fields = nullptr,
+						  .m_escaped = nullptr,
+						  .m_fields_capacity = 0,
+						  .m_scratch = nullptr,
+						  .m_scratch_capacity = 0,
+						  .m_failed = false,
+						  .m_allocator = allocator};
+}
+
+CnxCsvReader cnx_csv_reader_from_file_with_allocator(CnxFile* restrict file,
+													 CnxCsvOptions options,
+													 CnxAllocator allocator) {
+	let_mut reader = new_reader(options, allocator);
+	reader.m_file = file;
+	reader.m_buffer
+		= cnx_allocator_allocate_array_t(char, allocator, CNX_CSV_READER_DEFAULT_BUFFER_SIZE);
+	reader.m_buffer_capacity = CNX_CSV_READER_DEFAULT_BUFFER_SIZE;
+	reader.m_data = reader.m_buffer;
+	return reader;
+}
+
+CnxCsvReader cnx_csv_reader_from_stringview_with_allocator(const CnxStringView* restrict view,
+														   CnxCsvOptions options,
+														   CnxAllocator allocator) {
+	let_mut reader = new_reader(options, allocator);
+	reader.m_data = view->m_view;
+	reader.m_length = view->m_length;
+	reader.m_end_of_input = true;
+	return reader;
+}
+
+void cnx_csv_reader_free(void* restrict self) {
+	let_mut _self = static_cast(CnxCsvReader*)(self);
+	if(_self->m_buffer != nullptr) {
+		cnx_allocator_deallocate(_self->m_allocator, _self->m_buffer);
+	}
+	if(_self->m_fields != nullptr) {
+		cnx_allocator_deallocate(_self->m_allocator, _self->m_fields);
+		cnx_allocator_deallocate(_self->m_allocator, _self->m_escaped);
+	}
+	if(_self->m_scratch != nullptr) {
+		cnx_allocator_deallocate(_self->m_allocator, _self->m_scratch);
+	}
+	*_self = new_reader(_self->m_options, _self->m_allocator);
+	_self->m_end_of_input = true;
+}
+
+/// @brief Stops `self` from reading any further because of the given error
+static inline void fail(CnxCsvReader* restrict self, CnxError error) {
+	self->m_error = error;
+	self->m_failed = true;
+}
+
+/// @brief Ensures `self` has room for at least `num_fields` fields in a row
+static inline void reserve_fields(CnxCsvReader* restrict self, usize num_fields) {
+	if(num_fields <= self->m_fields_capacity) {
+		return;
+	}
+
+	let_mut capacity
+		= self->m_fields_capacity == 0 ? INITIAL_FIELDS_CAPACITY : self->m_fields_capacity;
+	while(capacity < num_fields) {
+		capacity *= 2U;
+	}
+
+	if(self->m_fields == nullptr) {
+		self->m_fields = cnx_allocator_allocate_array_t(CnxStringView, self->m_allocator, capacity);
+		self->m_escaped = cnx_allocator_allocate_array_t(bool, self->m_allocator, capacity);
+	}
+	else {
+		self->m_fields = cnx_allocator_reallocate_array_t(CnxStringView,
+														  self->m_allocator,
+														  self->m_fields,
+														  self->m_fields_capacity,
+														  capacity);
+		self->m_escaped = cnx_allocator_reallocate_array_t(bool,
+														   self->m_allocator,
+														   self->m_escaped,
+														   self->m_fields_capacity,
+														   capacity);
+	}
+	self->m_fields_capacity = capacity;
+}
+
+/// @brief Attempts to parse the row beginning at `self->m_position`, storing its fields (still
+/// escaped) in `self->m_fields`, the number of them in `num_fields`, and the index just past its
+/// line ending in `row_end`
+__attr(nodiscard) static ParseStatus
+	parse_row(CnxCsvReader* restrict self, usize* restrict row_end, usize* restrict num_fields) {
+	let data = self->m_data;
+	let length = self->m_length;
+	let delimiter = self->m_options.delimiter;
+	let quote = self->m_options.quote;
+	let_mut position = self->m_position;
+	let_mut count = static_cast(usize)(0);
+
+	loop {
+		reserve_fields(self, count + 1U);
+		let_mut field = cnx_stringview_from_raw(data + position, 0);
+		let_mut escaped = false;
+		// the index of the byte after the field (and its closing quote, if it's quoted)
+		let_mut end = position;
+
+		if(position < length && data[position] == quote) {
+			let start = position + 1U;
+			end = start;
+			loop {
+				end += cnx_byte_scan_find(data + end, length - end, quote);
+				// we can't tell whether a quote at the end of the input is a closing quote or
+				// the first of an escaped pair until we have the next byte
+				if(end + 1U >= length) {
+					if(!self->m_end_of_input) {
+						return PARSE_INCOMPLETE;
+					}
+					if(end == length) {
+						// the field is never closed
+						return PARSE_MALFORMED;
+					}
+					break;
+				}
+				if(data[end + 1U] != quote) {
+					break;
+				}
+				escaped = true;
+				end += 2U;
+			}
+
+			field = cnx_stringview_from_raw(data + start, end - start);
+			// skip the closing quote
+			++end;
+			if(end < length && data[end] != delimiter && data[end] != '\n' && data[end] != '\r') {
+				return PARSE_MALFORMED;
+			}
+		}
+		else {
+			end += cnx_byte_scan_find_any_of(data + position,
+											 length - position,
+											 &self->m_terminators);
+			field = cnx_stringview_from_raw(data + position, end - position);
+		}
+
+		self->m_fields[count] = field;
+		self->m_escaped[count] = escaped;
+		++count;
+
+		if(end == length) {
+			if(!self->m_end_of_input) {
+				return PARSE_INCOMPLETE;
+			}
+			*row_end = length;
+			break;
+		}
+
+		if(data[end] == delimiter) {
+			position = end + 1U;
+			continue;
+		}
+
+		if(data[end] == '\r') {
+			if(end + 1U == length && !self->m_end_of_input) {
+				// this might be the first half of a "\r\n"
+				return PARSE_INCOMPLETE;
+			}
+			*row_end = end + 1U + ((end + 1U < length && data[end + 1U] == '\n') ? 1U : 0U);
+		}
+		else {
+			*row_end = end + 1U;
+		}
+		break;
+	}
+
+	*num_fields = count;
+	return PARSE_ROW;
+}
+
+/// @brief Moves the unconsumed input in `self`'s buffer to the front of it (growing the buffer if
+/// the unconsumed input already fills it), then reads more of the file into the remainder
+///
+/// @return whether more input could be read. Sets the reader's error if reading failed
+__attr(nodiscard) static bool fill_buffer(CnxCsvReader* restrict self) {
+	cnx_assert(self->m_file != nullptr, "Can't read more input from a CnxCsvReader without a file");
+
+	let remaining = self->m_length - self->m_position;
+	if(self->m_position != 0) {
+		memmove(self->m_buffer, self->m_buffer + self->m_position, remaining);
+	}
+	else if(remaining == self->m_buffer_capacity) {
+		let capacity = self->m_buffer_capacity * 2U;
+		self->m_buffer = cnx_allocator_reallocate_array_t(char,
+														  self->m_allocator,
+														  self->m_buffer,
+														  self->m_buffer_capacity,
+														  capacity);
+		self->m_buffer_capacity = capacity;
+	}
+	self->m_data = self->m_buffer;
+	self->m_position = 0;
+	self->m_length = remaining;
+
+	let to_read = self->m_buffer_capacity - remaining;
+	let_mut read = cnx_file_read_bytes(self->m_file,
+									   static_cast(u8*)(static_cast(void*)(self->m_buffer
+																		   + remaining)),
+									   to_read);
+	if(cnx_result_is_err(read)) {
+		fail(self, cnx_result_unwrap_err(read));
+		return false;
+	}
+
+	let num_read = cnx_result_unwrap(read);
+	self->m_length += num_read;
+	// `cnx_file_read_bytes` only reads less than requested at the end of the file
+	self->m_end_of_input = num_read < to_read;
+	return true;
+}
+
+/// @brief Unescapes the quotes of the fields of the most recently parsed row that contain escaped
+/// quotes, into `self`'s scratch buffer
+static void unescape_fields(CnxCsvReader* restrict self, usize num_fields) {
+	let_mut needed = static_cast(usize)(0);
+	for(let_mut i = static_cast(usize)(0); i < num_fields; ++i) {
+		if(self->m_escaped[i]) {
+			needed += self->m_fields[i].m_length;
+		}
+	}
+
+	if(needed == 0) {
+		return;
+	}
+
+	if(needed > self->m_scratch_capacity) {
+		if(self->m_scratch != nullptr) {
+			cnx_allocator_deallocate(self->m_allocator, self->m_scratch);
+		}
+		let doubled = self->m_scratch_capacity * 2U;
+		let capacity = needed > doubled ? needed : doubled;
+		self->m_scratch = cnx_allocator_allocate_array_t(char, self->m_allocator, capacity);
+		self->m_scratch_capacity = capacity;
+	}
+
+	let quote = self->m_options.quote;
+	let_mut out = self->m_scratch;
+	for(let_mut i = static_cast(usize)(0); i < num_fields; ++i) {
+		if(!self->m_escaped[i]) {
+			continue;
+		}
+
+		let field = &(self->m_fields[i]);
+		let start = out;
+		let end = field->m_view + field->m_length;
+		let_mut in = field->m_view;
+		while(in < end) {
+			let remaining = static_cast(usize)(end - in);
+			let index = cnx_byte_scan_find(in, remaining, quote);
+			memcpy(out, in, index);
+			out += index;
+			in += index;
+			if(index != remaining) {
+				// every quote within a quoted field is the first of an escaped pair
+				*out = quote;
+				++out;
+				in += 2;
+			}
+		}
+
+		field->m_view = start;
+		field->m_length = static_cast(usize)(out - start);
+	}
+}
+
+bool cnx_csv_reader_next(CnxCsvReader* restrict self, CnxCsvRow* restrict row) {
+	if(self->m_failed) {
+		return false;
+	}
+
+	loop {
+		if(self->m_position == self->m_length && self->m_end_of_input) {
+			return false;
+		}
+
+		let_mut row_end = static_cast(usize)(0);
+		let_mut num_fields = static_cast(usize)(0);
+		let status = parse_row(self, &row_end, &num_fields);
+		if(status == PARSE_ROW) {
+			unescape_fields(self, num_fields);
+			self->m_position = row_end;
+			*row = (CnxCsvRow){.m_fields = self->m_fields, .m_num_fields = num_fields};
+			return true;
+		}
+
+		if(status == PARSE_MALFORMED) {
+			fail(self, cnx_error_new(EINVAL, CNX_POSIX_ERROR_CATEGORY));
+			return false;
+		}
+
+		// the row continues past the end of the available input, so read more and re-parse it
+		if(!fill_buffer(self)) {
+			return false;
+		}
+	}
+}
+
+CnxResult cnx_csv_reader_status(const CnxCsvReader* restrict self) {
+	return self->m_failed ? Err(i32, self->m_error) : Ok(i32, 0);
+}
+
+CnxResult(i64)(cnx_csv_row_get_i64)(const CnxCsvRow* restrict self, usize index) {
+	if(index >= self->m_num_fields) {
+		return Err(i64, cnx_error_new(EINVAL, CNX_POSIX_ERROR_CATEGORY));
+	}
+
+	let field = self->m_fields[index];
+	let negative = field.m_length != 0 && field.m_view[0] == '-';
+	let has_sign = negative || (field.m_length != 0 && field.m_view[0] == '+');
+	let offset = has_sign ? 1U : 0U;
+	return cnx_decimal_parse_i64(field.m_view + offset, field.m_length - offset, negative);
+}
+
+CnxResult(u64)(cnx_csv_row_get_u64)(const CnxCsvRow* restrict self, usize index) {
+	if(index >= self->m_num_fields) {
+		return Err(u64, cnx_error_new(EINVAL, CNX_POSIX_ERROR_CATEGORY));
+	}
+
+	let field = self->m_fields[index];
+	let offset = (field.m_length != 0 && field.m_view[0] == '+') ? 1U : 0U;
+	return cnx_decimal_parse_u64(field.m_view + offset, field.m_length - offset);
+}
+
+CnxResult(f64)(cnx_csv_row_get_f64)(const CnxCsvRow* restrict self, usize index) {
+	if(index >= self->m_num_fields) {
+		return Err(f64, cnx_error_new(EINVAL, CNX_POSIX_ERROR_CATEGORY));
+	}
+
+	let field = self->m_fields[index];
+	return cnx_decimal_parse_f64(field.m_view, field.m_length);
+}
+
+CnxCsvWriter cnx_csv_writer_new_with_options(CnxFile* restrict file, CnxCsvOptions options) {
+	const char special[] = {options.delimiter, options.quote, '\n', '\r'};
+	return (CnxCsvWriter){.m_file = file,
+						  .m_options = options,
+						  .m_special = cnx_byte_set_new(special, sizeof(special)),
+						  .m_num_fields = 0};
+}
+
+/// @brief Writes the given bytes to the file of `self`, storing the error in `result` on failure
+///
+/// @return whether the bytes were written
+__attr(nodiscard) static inline bool write_bytes(CnxCsvWriter* restrict self,
+												 restrict const_cstring bytes,
+												 usize length,
+												 CnxResult* restrict result) {
+	if(length == 0) {
+		return true;
+	}
+
+	let_mut written
+		= cnx_file_write_bytes(self->m_file,
+							   static_cast(const u8*)(static_cast(const void*)(bytes)),
+							   length);
+	if(cnx_result_is_err(written)) {
+		*result = written;
+		return false;
+	}
+
+	return true;
+}
+
+CnxResult cnx_csv_writer_write_field(CnxCsvWriter* restrict self,
+									 const CnxStringView* restrict field) {
+	let_mut result = Ok(i32, 0);
+	let data = field->m_view;
+	let length = field->m_length;
+	let quote = &(self->m_options.quote);
+
+	if(self->m_num_fields != 0 && !write_bytes(self, &(self->m_options.delimiter), 1U, &result)) {
+		return result;
+	}
+	++self->m_num_fields;
+
+	if(cnx_byte_scan_find_any_of(data, length, &self->m_special) == length) {
+		ignore(write_bytes(self, data, length, &result));
+		return result;
+	}
+
+	if(!write_bytes(self, quote, 1U, &result)) {
+		return result;
+	}
+
+	let_mut position = static_cast(usize)(0);
+	loop {
+		let index = position + cnx_byte_scan_find(data + position, length - position, *quote);
+		if(index == length) {
+			if(!write_bytes(self, data + position, length - position, &result)) {
+				return result;
+			}
+			break;
+		}
+
+		// write up to and including the quote, then another quote to escape it
+		if(!write_bytes(self, data + position, index + 1U - position, &result)
+		   || !write_bytes(self, quote, 1U, &result))
+		{
+			return result;
+		}
+		position = index + 1U;
+	}
+
+	ignore(write_bytes(self, quote, 1U, &result));
+	return result;
+}
+
+/// @brief Writes the given formatted number as a field with `self`
+__attr(nodiscard) static inline CnxResult
+	write_number(CnxCsvWriter* restrict self, restrict const_cstring number, usize length) {
+	let field = cnx_stringview_from_raw(number, length);
+	// a number can only need quoting if the delimiter is a digit, sign, or decimal point, but this
+	// handles that case too
+	return cnx_csv_writer_write_field(self, &field);
+}
+
+CnxResult cnx_csv_writer_write_i64(CnxCsvWriter* restrict self, i64 value) {
+	char buffer[CNX_DECIMAL_MAX_INTEGER_LENGTH];
+	return write_number(self, buffer, cnx_decimal_format_i64(value, buffer));
+}
+
+CnxResult cnx_csv_writer_write_u64(CnxCsvWriter* restrict self, u64 value) {
+	char buffer[CNX_DECIMAL_MAX_INTEGER_LENGTH];
+	return write_number(self, buffer, cnx_decimal_format_u64(value, buffer));
+}
+
+CnxResult cnx_csv_writer_write_f64(CnxCsvWriter* restrict self, f64 value) {
+	char buffer[CNX_DECIMAL_MAX_FLOAT_LENGTH];
+	return write_number(self, buffer, cnx_decimal_format_f64(value, buffer));
+}
+
+CnxResult cnx_csv_writer_end_row(CnxCsvWriter* restrict self) {
+	let_mut result = Ok(i32, 0);
+	self->m_num_fields = 0;
+	let line_ending = self->m_options.crlf ? "\r\n" : "\n";
+	ignore(write_bytes(self, line_ending, self->m_options.crlf ? 2U : 1U, &result));
+	return result;
+}
+
+CnxResult cnx_csv_writer_write_fields(CnxCsvWriter* restrict self,
+									  const CnxStringView* restrict fields,
+									  usize num_fields) {
+	for(let_mut i = static_cast(usize)(0); i < num_fields; ++i) {
+		let_mut result = cnx_csv_writer_write_field(self, &(fields[i]));
+		if(cnx_result_is_err(result)) {
+			return result;
+		}
+	}
+	return cnx_csv_writer_end_row(self);
+}
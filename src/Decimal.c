@@ -0,0 +1,177 @@
+/// @file Decimal.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Internal decimal number parsing and formatting used by the text format modules
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <Cnx/Allocators.h>
+#include <Cnx/__string/__decimal.h>
+#include <ctype.h>
+#include <errno.h>
+#include <memory.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/// @brief The longest text `cnx_decimal_parse_f64` parses without allocating a copy of it
+#define MAX_STACK_FLOAT_LENGTH (static_cast(usize)(128U))
+
+/// @brief The fewest significant digits `cnx_decimal_format_f64` tries to format a value with
+#define MIN_FLOAT_DIGITS 15
+
+/// @brief The most significant digits `cnx_decimal_format_f64` formats a value with. Every `f64`
+/// round-trips with this many
+#define MAX_FLOAT_DIGITS 17
+
+CnxResult(u64) cnx_decimal_parse_u64(restrict const_cstring digits, usize length) {
+	if(length == 0) {
+		return Err(u64, cnx_error_new(EINVAL, CNX_POSIX_ERROR_CATEGORY));
+	}
+
+	let_mut value = static_cast(u64)(0);
+	let_mut overflowed = false;
+	for(let_mut i = static_cast(usize)(0); i < length; ++i) {
+		let digit = static_cast(u64)(static_cast(u8)(digits[i]) - static_cast(u8)('0'));
+		// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+		if(digit > 9U) {
+			return Err(u64, cnx_error_new(EINVAL, CNX_POSIX_ERROR_CATEGORY));
+		}
+		// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+		if(value > (UINT64_MAX - digit) / 10U) {
+			overflowed = true;
+		}
+		// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+		value = value * 10U + digit;
+	}
+
+	return overflowed ? Err(u64, cnx_error_new(ERANGE, CNX_POSIX_ERROR_CATEGORY)) : Ok(u64, value);
+}
+
+CnxResult(i64)
+	cnx_decimal_parse_i64(restrict const_cstring digits, usize length, bool negative) {
+	let_mut parsed = cnx_decimal_parse_u64(digits, length);
+	if(cnx_result_is_err(parsed)) {
+		return Err(i64, cnx_result_unwrap_err(parsed));
+	}
+
+	let magnitude = cnx_result_unwrap(parsed);
+	let limit = static_cast(u64)(INT64_MAX) + (negative ? 1U : 0U);
+	if(magnitude > limit) {
+		return Err(i64, cnx_error_new(ERANGE, CNX_POSIX_ERROR_CATEGORY));
+	}
+
+	if(negative) {
+		// negate as `magnitude - 1` first, so that `INT64_MIN` doesn't overflow
+		return Ok(i64, magnitude == 0 ? 0 : -static_cast(i64)(magnitude - 1U) - 1);
+	}
+
+	return Ok(i64, static_cast(i64)(magnitude));
+}
+
+CnxResult(f64) cnx_decimal_parse_f64(restrict const_cstring text, usize length) {
+	// `strtod` skips leading whitespace, but we require the entire text to be the number
+	if(length == 0 || isspace(static_cast(u8)(text[0])) != 0) {
+		return Err(f64, cnx_error_new(EINVAL, CNX_POSIX_ERROR_CATEGORY));
+	}
+
+	// `strtod` requires a null-terminated string, and the text isn't necessarily null-terminated
+	char stack_copy[MAX_STACK_FLOAT_LENGTH];
+	let_mut copy = stack_copy;
+	if(length >= MAX_STACK_FLOAT_LENGTH) {
+		copy = cnx_allocator_allocate_array_t(char, DEFAULT_ALLOCATOR, length + 1U);
+	}
+	memcpy(copy, text, length);
+	copy[length] = '\0';
+
+	cstring end = nullptr;
+	errno = 0;
+	let value = strtod(copy, &end);
+	let error = errno;
+	let parsed_all = end == copy + length;
+	if(copy != stack_copy) {
+		cnx_allocator_deallocate(DEFAULT_ALLOCATOR, copy);
+	}
+
+	if(!parsed_all) {
+		return Err(f64, cnx_error_new(EINVAL, CNX_POSIX_ERROR_CATEGORY));
+	}
+
+	// `strtod` also reports `ERANGE` on underflow, but the (denormal or zero) result is the
+	// closest representable value, so we only consider overflow an error
+	if(error == ERANGE && !cnx_decimal_is_finite(value)) {
+		return Err(f64, cnx_error_new(ERANGE, CNX_POSIX_ERROR_CATEGORY));
+	}
+
+	return Ok(f64, value);
+}
+
+/// @brief Formats the given magnitude in decimal, ending at `end`, returning the start of the
+/// formatted digits
+__attr(nodiscard) __attr(returns_not_null) static inline char* format_digits(u64 value, char* end) {
+	let_mut out = end;
+	do {
+		--out;
+		// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+		*out = static_cast(char)('0' + static_cast(char)(value % 10U));
+		// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+		value /= 10U;
+	} while(value != 0);
+	return out;
+}
+
+usize cnx_decimal_format_i64(i64 value, char* restrict out) {
+	char buffer[CNX_DECIMAL_MAX_INTEGER_LENGTH];
+	let end = buffer + CNX_DECIMAL_MAX_INTEGER_LENGTH;
+	// negate as `value + 1` first, so that `INT64_MIN` doesn't overflow
+	let magnitude = value < 0 ? static_cast(u64)(-(value + 1)) + 1U : static_cast(u64)(value);
+	let_mut start = format_digits(magnitude, end);
+	if(value < 0) {
+		--start;
+		*start = '-';
+	}
+
+	let length = static_cast(usize)(end - start);
+	memcpy(out, start, length);
+	return length;
+}
+
+usize cnx_decimal_format_u64(u64 value, char* restrict out) {
+	char buffer[CNX_DECIMAL_MAX_INTEGER_LENGTH];
+	let end = buffer + CNX_DECIMAL_MAX_INTEGER_LENGTH;
+	let start = format_digits(value, end);
+	let length = static_cast(usize)(end - start);
+	memcpy(out, start, length);
+	return length;
+}
+
+usize cnx_decimal_format_f64(f64 value, char* restrict out) {
+	let_mut length = 0;
+	for(let_mut digits = MIN_FLOAT_DIGITS; digits <= MAX_FLOAT_DIGITS; ++digits) {
+		length = snprintf(out, CNX_DECIMAL_MAX_FLOAT_LENGTH, "%.*g", digits, value);
+		if(digits == MAX_FLOAT_DIGITS || strtod(out, nullptr) == value) {
+			break;
+		}
+	}
+	return static_cast(usize)(length);
+}
@@ -0,0 +1,424 @@
+/// @file DeferredLog.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides deferred, binary logging, where formatting happens off of the
+/// logging thread
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <Cnx/Allocators.h>
+#include <Cnx/Assert.h>
+#include <Cnx/Atomic.h>
+#include <Cnx/DeferredLog.h>
+#include <Cnx/Lambda.h>
+#include <Cnx/Platform.h>
+#include <Cnx/Thread.h>
+#include <memory.h>
+
+#define RESULT_T	CnxDeferredLog
+#define RESULT_IMPL TRUE
+// NOLINTNEXTLINE(readability-duplicate-include)
+#include <Cnx/Result.h>
+#undef RESULT_T
+#undef RESULT_IMPL
+
+/// @brief The alignment of records, and of each argument payload within a record. This is the
+/// strictest alignment of any builtin type, so that copied arguments can be formatted in place
+#define RECORD_ALIGNMENT (static_cast(usize)(16U))
+
+/// @brief The smallest capacity of a ring buffer
+#define MIN_BUFFER_CAPACITY (static_cast(usize)(256U))
+
+/// @brief The largest capacity of a ring buffer, so that record sizes fit in a `u32`
+#define MAX_BUFFER_CAPACITY (static_cast(usize)(1U) << 30U)
+
+/// @brief The header of a record in a ring buffer. A record is its header, followed by
+/// `m_num_args` `CnxFormat`s referring to the argument payloads, followed by the payloads
+typedef struct RecordHeader {
+	/// @brief The format string of the record, or `nullptr` if this is padding to skip the
+	/// remainder of the ring buffer
+	const_cstring m_format_string;
+	/// @brief The total size of the record, in bytes
+	u32 m_size;
+	u16 m_num_args;
+	bool m_newline;
+} RecordHeader;
+
+static_assert(sizeof(RecordHeader) % RECORD_ALIGNMENT == 0,
+			  "RecordHeader must preserve the alignment of the record that follows it");
+static_assert(sizeof(CnxFormat) % RECORD_ALIGNMENT == 0,
+			  "CnxFormat must preserve the alignment of the record that follows it");
+
+/// @brief A single-producer, single-consumer ring buffer of records, owned by one logging thread
+typedef struct DeferredLogBuffer {
+	/// @brief The total number of bytes ever written. Only modified by the owning thread
+	atomic_usize m_head;
+	u8 m_head_padding[CNX_PLATFORM_CACHE_LINE_SIZE - sizeof(atomic_usize)];
+	/// @brief The total number of bytes ever consumed. Only modified by the decoder
+	atomic_usize m_tail;
+	u8 m_tail_padding[CNX_PLATFORM_CACHE_LINE_SIZE - sizeof(atomic_usize)];
+	u8* m_data;
+	usize m_capacity;
+	CnxThreadID m_owner;
+	struct DeferredLogBuffer* m_next;
+	/// @brief The allocation `m_data` was aligned within
+	u8* m_allocation;
+} DeferredLogBuffer;
+
+struct CnxDeferredLogState {
+	/// @brief Uniquely identifies this log for the thread-local buffer cache, since the address of
+	/// a freed log's state may be reused by a later one
+	u64 m_id;
+	CnxFile* m_sink;
+	CnxAllocator m_allocator;
+	usize m_buffer_capacity;
+	CnxDuration m_decode_interval;
+	/// @brief The list of every thread's ring buffer. Buffers are only ever pushed to the front
+	atomic_ptr m_buffers;
+	atomic_usize m_dropped;
+	/// @brief Serializes decoding between the background decoder and `cnx_deferred_log_flush`
+	CnxBasicMutex m_decode_mutex;
+	CnxJThread m_decoder;
+	bool m_has_decoder;
+};
+
+static atomic_u64 next_log_id = 1;
+static thread_local u64 cached_log_id = 0;
+static thread_local DeferredLogBuffer* cached_buffer = nullptr;
+
+__attr(always_inline) static inline usize align_up(usize size) {
+	return (size + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+}
+
+static DeferredLogBuffer* new_buffer(CnxDeferredLogState* restrict state, CnxThreadID owner) {
+	let_mut buffer = cnx_allocator_allocate_t(DeferredLogBuffer, state->m_allocator);
+	*buffer = (DeferredLogBuffer){.m_capacity = state->m_buffer_capacity, .m_owner = owner};
+	atomic_init(&buffer->m_head, 0);
+	atomic_init(&buffer->m_tail, 0);
+	buffer->m_allocation = cnx_allocator_allocate_array_t(u8,
+														  state->m_allocator,
+														  state->m_buffer_capacity
+															  + RECORD_ALIGNMENT);
+	let address = static_cast(usize)(buffer->m_allocation);
+	buffer->m_data = buffer->m_allocation + (align_up(address) - address);
+	return buffer;
+}
+
+/// @brief Returns the calling thread's ring buffer of the given log, creating it if necessary
+static DeferredLogBuffer* thread_buffer(CnxDeferredLogState* restrict state) {
+	if(cached_log_id == state->m_id) {
+		return cached_buffer;
+	}
+
+	// the calling thread may already have a buffer that was evicted from its cache, or one left
+	// behind by an exited thread whose ID has been reused, which it can safely take over
+	let id = cnx_this_thread_get_id();
+	let_mut buffer
+		= static_cast(DeferredLogBuffer*)(atomic_load_explicit(&state->m_buffers,
+															   memory_order_acquire));
+	for(; buffer != nullptr; buffer = buffer->m_next) {
+		if(cnx_thread_id_equal(buffer->m_owner, id)) {
+			break;
+		}
+	}
+
+	if(buffer == nullptr) {
+		buffer = new_buffer(state, id);
+		let_mut head = atomic_load_explicit(&state->m_buffers, memory_order_relaxed);
+		do {
+			buffer->m_next = static_cast(DeferredLogBuffer*)(head);
+		} while(!atomic_compare_exchange_weak_explicit(&state->m_buffers,
+													   &head,
+													   buffer,
+													   memory_order_release,
+													   memory_order_relaxed));
+	}
+
+	cached_log_id = state->m_id;
+	cached_buffer = buffer;
+	return buffer;
+}
+
+__attr(always_inline) static inline bool is_string_arg(const CnxDeferredLogArg* restrict arg) {
+	let format = arg->m_format.m_vtable->format;
+	return arg->m_size != 0
+		   && (format == cnx_format_cstring || format == cnx_format_cnx_string
+			   || format == cnx_format_cnx_stringview);
+}
+
+/// @brief Returns the characters of the given string argument
+static CnxStringView string_arg_view(const CnxDeferredLogArg* restrict arg) {
+	let format = arg->m_format.m_vtable->format;
+	let self = arg->m_format.m_self;
+	if(format == cnx_format_cnx_string) {
+		let string = static_cast(const CnxString*)(self);
+		return cnx_string_into_stringview(*string);
+	}
+	if(format == cnx_format_cnx_stringview) {
+		return *static_cast(const CnxStringView*)(self);
+	}
+
+	let string = static_cast(const_cstring)(self);
+	return cnx_stringview_from_raw(string, strlen(string));
+}
+
+/// @brief Returns the size of the payload of the given argument in a record
+__attr(always_inline) static inline usize payload_size(const CnxDeferredLogArg* restrict arg) {
+	if(is_string_arg(arg)) {
+		// string arguments are recorded as a `CnxStringView` followed by the characters
+		let view = string_arg_view(arg);
+		return align_up(sizeof(CnxStringView)) + align_up(view.m_length);
+	}
+
+	return align_up(arg->m_size);
+}
+
+bool cnx_deferred_log_record(CnxDeferredLog* restrict self,
+							 bool newline,
+							 restrict const_cstring format_string,
+							 usize num_args,
+							 const CnxDeferredLogArg* restrict args) {
+	let state = self->m_state;
+	let_mut buffer = thread_buffer(state);
+
+	let_mut size = sizeof(RecordHeader) + num_args * sizeof(CnxFormat);
+	for(let_mut i = static_cast(usize)(0); i < num_args; ++i) {
+		size += payload_size(&args[i]);
+	}
+
+	// only this thread writes `m_head`, so it doesn't need to synchronize with anything
+	let_mut head = atomic_load_explicit(&buffer->m_head, memory_order_relaxed);
+	let tail = atomic_load_explicit(&buffer->m_tail, memory_order_acquire);
+	let_mut offset = head & (buffer->m_capacity - 1);
+	let contiguous = buffer->m_capacity - offset;
+	// records are never split across the end of the buffer, so if this one doesn't fit before
+	// the end, the remainder is padded out and the record starts at the beginning
+	let required = size <= contiguous ? size : size + contiguous;
+	if(required > buffer->m_capacity - (head - tail)) {
+		ignore(atomic_fetch_add_explicit(&state->m_dropped, 1, memory_order_relaxed));
+		return false;
+	}
+
+	if(size > contiguous) {
+		// NOLINTNEXTLINE(bugprone-casting-through-void)
+		let_mut padding = static_cast(RecordHeader*)(static_cast(void*)(buffer->m_data + offset));
+		*padding = (RecordHeader){.m_format_string = nullptr,
+								  .m_size = static_cast(u32)(contiguous)};
+		head += contiguous;
+		offset = 0;
+	}
+
+	let record = buffer->m_data + offset;
+	// NOLINTNEXTLINE(bugprone-casting-through-void)
+	let_mut header = static_cast(RecordHeader*)(static_cast(void*)(record));
+	*header = (RecordHeader){.m_format_string = format_string,
+							 .m_size = static_cast(u32)(size),
+							 .m_num_args = static_cast(u16)(num_args),
+							 .m_newline = newline};
+
+	// NOLINTNEXTLINE(bugprone-casting-through-void)
+	let_mut formats = static_cast(CnxFormat*)(static_cast(void*)(record + sizeof(RecordHeader)));
+	let_mut payload = record + sizeof(RecordHeader) + num_args * sizeof(CnxFormat);
+	for(let_mut i = static_cast(usize)(0); i < num_args; ++i) {
+		let arg = &args[i];
+		if(arg->m_size == 0) {
+			formats[i] = arg->m_format;
+		}
+		else if(is_string_arg(arg)) {
+			let view = string_arg_view(arg);
+			let characters = payload + align_up(sizeof(CnxStringView));
+			memcpy(characters, view.m_view, view.m_length);
+
+			// NOLINTNEXTLINE(bugprone-casting-through-void)
+			let_mut recorded = static_cast(CnxStringView*)(static_cast(void*)(payload));
+			*recorded = view;
+			recorded->m_view = static_cast(const_cstring)(static_cast(void*)(characters));
+			formats[i] = as_format_t(CnxStringView, *recorded);
+			payload = characters + align_up(view.m_length);
+		}
+		else {
+			memcpy(payload, arg->m_format.m_self, arg->m_size);
+			formats[i] = (CnxFormat){.m_vtable = arg->m_format.m_vtable, .m_self = payload};
+			payload += align_up(arg->m_size);
+		}
+	}
+
+	atomic_store_explicit(&buffer->m_head, head + size, memory_order_release);
+	return true;
+}
+
+/// @brief Decodes all of the records currently in the given buffer and writes them to the sink.
+/// Must be called with the decode mutex held
+static CnxResult decode_buffer(CnxDeferredLogState* restrict state,
+							   DeferredLogBuffer* restrict buffer) {
+	let_mut result = Ok(i32, 0);
+	let_mut tail = atomic_load_explicit(&buffer->m_tail, memory_order_relaxed);
+	let head = atomic_load_explicit(&buffer->m_head, memory_order_acquire);
+	while(tail != head) {
+		let record = buffer->m_data + (tail & (buffer->m_capacity - 1));
+		// NOLINTNEXTLINE(bugprone-casting-through-void)
+		let header = static_cast(const RecordHeader*)(static_cast(const void*)(record));
+		if(header->m_format_string != nullptr) {
+			// the argument payloads are formatted in place
+			// NOLINTNEXTLINE(bugprone-casting-through-void)
+			let args = static_cast(const CnxFormat*)(
+				static_cast(const void*)(record + sizeof(RecordHeader)));
+			CnxScopedString line = cnx_format_array_with_allocator(header->m_format_string,
+																   state->m_allocator,
+																   header->m_num_args,
+																   args);
+			if(header->m_newline) {
+				cnx_string_push_back(line, '\n');
+			}
+
+			let_mut written = cnx_file_write_bytes(
+				state->m_sink,
+				static_cast(const u8*)(static_cast(const void*)(cnx_string_into_cstring(line))),
+				cnx_string_length(line));
+			if(cnx_result_is_err(written) && cnx_result_is_ok(result)) {
+				result = written;
+			}
+		}
+
+		tail += header->m_size;
+		// release the record's space back to the logging thread as soon as it's been written
+		atomic_store_explicit(&buffer->m_tail, tail, memory_order_release);
+	}
+
+	return result;
+}
+
+/// @brief Decodes all pending records of every thread and writes them to the sink, then flushes
+/// the sink
+static CnxResult decode_pending(CnxDeferredLogState* restrict state) {
+	let_mut result = cnx_basic_mutex_lock(&state->m_decode_mutex);
+	if(cnx_result_is_err(result)) {
+		return result;
+	}
+
+	let_mut buffer
+		= static_cast(DeferredLogBuffer*)(atomic_load_explicit(&state->m_buffers,
+															   memory_order_acquire));
+	for(; buffer != nullptr; buffer = buffer->m_next) {
+		let_mut decoded = decode_buffer(state, buffer);
+		if(cnx_result_is_err(decoded) && cnx_result_is_ok(result)) {
+			result = decoded;
+		}
+	}
+
+	let_mut flushed = cnx_file_flush(state->m_sink);
+	if(cnx_result_is_err(flushed) && cnx_result_is_ok(result)) {
+		result = flushed;
+	}
+
+	ignore(cnx_basic_mutex_unlock(&state->m_decode_mutex));
+	return result;
+}
+
+void LambdaFunction(decoder, const CnxStopToken* token) {
+	let binding = lambda_binding(CnxDeferredLogState*);
+	let state = binding._1;
+	while(!cnx_stop_token_stop_requested(token)) {
+		// errors are reported to callers of `cnx_deferred_log_flush`, but there's no one to report
+		// them to here
+		ignore(decode_pending(state));
+		cnx_this_thread_sleep_for(state->m_decode_interval);
+	}
+}
+
+CnxResult(CnxDeferredLog)
+	cnx_deferred_log_new_with_options(CnxFile* restrict sink, CnxDeferredLogOptions options) {
+	cnx_assert(options.buffer_capacity <= MAX_BUFFER_CAPACITY,
+			   "CnxDeferredLog buffer capacity is too large");
+
+	let_mut capacity = MIN_BUFFER_CAPACITY;
+	while(capacity < options.buffer_capacity) {
+		capacity <<= 1U;
+	}
+
+	let_mut state = cnx_allocator_allocate_t(CnxDeferredLogState, options.allocator);
+	*state = (CnxDeferredLogState){
+		.m_id = atomic_fetch_add_explicit(&next_log_id, 1, memory_order_relaxed),
+		.m_sink = sink,
+		.m_allocator = options.allocator,
+		.m_buffer_capacity = capacity,
+		.m_decode_interval = options.decode_interval,
+		.m_has_decoder = options.decode_interval.count > 0,
+	};
+	atomic_init(&state->m_buffers, nullptr);
+	atomic_init(&state->m_dropped, 0);
+
+	let_mut result = cnx_basic_mutex_init(&state->m_decode_mutex);
+	if(cnx_result_is_err(result)) {
+		cnx_allocator_deallocate(options.allocator, state);
+		return Err(CnxDeferredLog, cnx_result_unwrap_err(result));
+	}
+
+	if(state->m_has_decoder) {
+		result = cnx_jthread_init(&state->m_decoder,
+								  lambda_cast(lambda(decoder, state), CnxJThreadLambda));
+		if(cnx_result_is_err(result)) {
+			ignore(cnx_basic_mutex_free(&state->m_decode_mutex));
+			cnx_allocator_deallocate(options.allocator, state);
+			return Err(CnxDeferredLog, cnx_result_unwrap_err(result));
+		}
+	}
+
+	return Ok(CnxDeferredLog, (CnxDeferredLog){.m_state = state});
+}
+
+void cnx_deferred_log_free(void* restrict self) {
+	let_mut log = static_cast(CnxDeferredLog*)(self);
+	let_mut state = log->m_state;
+	if(state == nullptr) {
+		return;
+	}
+
+	if(state->m_has_decoder) {
+		cnx_jthread_free(&state->m_decoder);
+	}
+	ignore(decode_pending(state));
+
+	let_mut buffer
+		= static_cast(DeferredLogBuffer*)(atomic_load_explicit(&state->m_buffers,
+															   memory_order_acquire));
+	while(buffer != nullptr) {
+		let next = buffer->m_next;
+		cnx_allocator_deallocate(state->m_allocator, buffer->m_allocation);
+		cnx_allocator_deallocate(state->m_allocator, buffer);
+		buffer = next;
+	}
+
+	ignore(cnx_basic_mutex_free(&state->m_decode_mutex));
+	cnx_allocator_deallocate(state->m_allocator, state);
+	log->m_state = nullptr;
+}
+
+CnxResult cnx_deferred_log_flush(CnxDeferredLog* restrict self) {
+	return decode_pending(self->m_state);
+}
+
+usize cnx_deferred_log_dropped(const CnxDeferredLog* restrict self) {
+	return atomic_load_explicit(&self->m_state->m_dropped, memory_order_relaxed);
+}
@@ -0,0 +1,696 @@
+/// @file Encoding.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides fast hexadecimal and Base64 encoding and decoding for Cnx
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <Cnx/Encoding.h>
+#include <Cnx/Error.h>
+#include <Cnx/Platform.h>
+#include <errno.h>
+
+#if(CNX_PLATFORM_COMPILER_GCC || CNX_PLATFORM_COMPILER_CLANG) \
+	&& (defined(__x86_64__) || defined(_M_X64))
+	/// @brief Whether the SSSE3 and AVX2 encoding kernels are available for this target
+	#define CNX_ENCODING_SIMD_KERNELS 1
+	#include <immintrin.h>
+#else
+	/// @brief Whether the SSSE3 and AVX2 encoding kernels are available for this target
+	#define CNX_ENCODING_SIMD_KERNELS 0
+#endif
+
+#undef cnx_string_append_hex
+#undef cnx_string_append_base64
+
+/// @brief The hexadecimal digits, indexed by value. 16 bytes each, so they can be loaded as the
+/// table of a `pshufb` lookup
+static const char hex_digits_lower[16] = {'0', '1', '2', '3', '4', '5', '6', '7',
+										  '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+static const char hex_digits_upper[16] = {'0', '1', '2', '3', '4', '5', '6', '7',
+										  '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+
+/// @brief The Base64 digits, indexed by value. Only the last two differ between alphabets
+static const char base64_digits[]
+	= "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+
+/// @brief Returns the digit for value 62 in the given alphabet
+__attr(always_inline) __attr(nodiscard) static inline char
+	base64_digit_62(CnxBase64Alphabet alphabet) {
+	return alphabet == CNX_BASE64_URL ? '-' : '+';
+}
+
+/// @brief Returns the digit for value 63 in the given alphabet
+__attr(always_inline) __attr(nodiscard) static inline char
+	base64_digit_63(CnxBase64Alphabet alphabet) {
+	return alphabet == CNX_BASE64_URL ? '_' : '/';
+}
+
+__attr(always_inline) __attr(nodiscard) static inline char
+	base64_digit(u32 value, CnxBase64Alphabet alphabet) {
+	if(value < 62U) { // NOLINT(readability-magic-numbers)
+		return base64_digits[value];
+	}
+	return value == 62U ? base64_digit_62(alphabet) : base64_digit_63(alphabet); // NOLINT
+}
+
+/// @brief The value of an invalid digit in `hex_value` and `base64_value`
+#define INVALID_DIGIT 0xFFU
+
+__attr(always_inline) __attr(nodiscard) static inline u32 hex_value(char digit) {
+	let byte = static_cast(u8)(digit);
+	if(byte >= '0' && byte <= '9') {
+		return byte - '0';
+	}
+	// setting bit 5 maps uppercase ASCII letters to lowercase
+	let lower = byte | 0x20U; // NOLINT(readability-magic-numbers)
+	if(lower >= 'a' && lower <= 'f') {
+		return lower - 'a' + 10U; // NOLINT(readability-magic-numbers)
+	}
+	return INVALID_DIGIT;
+}
+
+__attr(always_inline) __attr(nodiscard) static inline u32
+	base64_value(char digit, CnxBase64Alphabet alphabet) {
+	let byte = static_cast(u8)(digit);
+	if(byte >= 'A' && byte <= 'Z') {
+		return byte - 'A';
+	}
+	if(byte >= 'a' && byte <= 'z') {
+		return byte - 'a' + 26U; // NOLINT(readability-magic-numbers)
+	}
+	if(byte >= '0' && byte <= '9') {
+		return byte - '0' + 52U; // NOLINT(readability-magic-numbers)
+	}
+	if(digit == base64_digit_62(alphabet)) {
+		return 62U; // NOLINT(readability-magic-numbers)
+	}
+	if(digit == base64_digit_63(alphabet)) {
+		return 63U; // NOLINT(readability-magic-numbers)
+	}
+	return INVALID_DIGIT;
+}
+
+#if CNX_ENCODING_SIMD_KERNELS
+
+__attr(always_inline) __attr(nodiscard) static inline bool cpu_has_avx2(void) {
+	return __builtin_cpu_supports("avx2");
+}
+
+__attr(always_inline) __attr(nodiscard) static inline bool cpu_has_ssse3(void) {
+	return __builtin_cpu_supports("ssse3");
+}
+
+	/// @brief Loads an unaligned vector of type `vector_t` from `data + index`
+	#define LOAD(loadu, vector_t, data, index) \
+		loadu(static_cast(const vector_t*)(static_cast(const void*)((data) + (index))))
+	/// @brief Stores the vector `value` of type `vector_t` to `data + index`, unaligned
+	#define STORE(storeu, vector_t, data, index, value) \
+		storeu(static_cast(vector_t*)(static_cast(void*)((data) + (index))), value)
+
+// Hex encoding splits each byte into its two nibbles, and looks both up in the table of digits
+// with `pshufb`. Interleaving the high- and low-nibble digits then puts them in output order.
+
+/// @brief Encodes 16 bytes at a time, returning the number of bytes encoded
+__attr(target("ssse3")) __attr(nodiscard) static usize hex_encode_ssse3(const u8* restrict data,
+																		usize length,
+																		char* restrict out,
+																		const char* digits) {
+	let table = LOAD(_mm_loadu_si128, __m128i, digits, 0);
+	let mask = _mm_set1_epi8(0x0F); // NOLINT(readability-magic-numbers)
+	let_mut i = static_cast(usize)(0);
+	for(; i + 16 <= length; i += 16) {
+		let input = LOAD(_mm_loadu_si128, __m128i, data, i);
+		let high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(input, 4), mask));
+		let low = _mm_shuffle_epi8(table, _mm_and_si128(input, mask));
+		STORE(_mm_storeu_si128, __m128i, out, 2 * i, _mm_unpacklo_epi8(high, low));
+		STORE(_mm_storeu_si128, __m128i, out, 2 * i + 16, _mm_unpackhi_epi8(high, low));
+	}
+	return i;
+}
+
+/// @brief Encodes 32 bytes at a time, returning the number of bytes encoded
+__attr(target("avx2")) __attr(nodiscard) static usize hex_encode_avx2(const u8* restrict data,
+																	  usize length,
+																	  char* restrict out,
+																	  const char* digits) {
+	let table = _mm256_broadcastsi128_si256(LOAD(_mm_loadu_si128, __m128i, digits, 0));
+	let mask = _mm256_set1_epi8(0x0F); // NOLINT(readability-magic-numbers)
+	let_mut i = static_cast(usize)(0);
+	for(; i + 32 <= length; i += 32) {
+		let input = LOAD(_mm256_loadu_si256, __m256i, data, i);
+		let high = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(input, 4), mask));
+		let low = _mm256_shuffle_epi8(table, _mm256_and_si256(input, mask));
+		// unpacking works within 128-bit lanes, so the lanes have to be put back in order
+		let first = _mm256_unpacklo_epi8(high, low);
+		let second = _mm256_unpackhi_epi8(high, low);
+		STORE(_mm256_storeu_si256,
+			  __m256i,
+			  out,
+			  2 * i,
+			  _mm256_permute2x128_si256(first, second, 0x20)); // NOLINT
+		STORE(_mm256_storeu_si256,
+			  __m256i,
+			  out,
+			  2 * i + 32,
+			  _mm256_permute2x128_si256(first, second, 0x31)); // NOLINT
+	}
+	return i;
+}
+
+// Hex decoding range-checks each character as a decimal digit and as a letter (after folding it
+// to lowercase), keeping the value from whichever check passed. Adjacent values are then merged
+// into bytes with a multiply-add (`high * 16 + low`) and packed.
+
+/// @brief Converts 16 hex digits to their values, clearing the corresponding bytes of `valid` if
+/// they aren't hex digits
+__attr(target("ssse3")) __attr(always_inline) static inline __m128i
+	hex_values_ssse3(__m128i digits, __m128i* restrict valid) {
+	let decimal = _mm_sub_epi8(digits, _mm_set1_epi8('0'));
+	let is_decimal = _mm_cmpeq_epi8(_mm_min_epu8(decimal, _mm_set1_epi8(9)), decimal); // NOLINT
+	let letter = _mm_sub_epi8(_mm_or_si128(digits, _mm_set1_epi8(0x20)), // NOLINT
+							  _mm_set1_epi8('a'));
+	let is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter); // NOLINT
+	*valid = _mm_and_si128(*valid, _mm_or_si128(is_decimal, is_letter));
+	return _mm_or_si128(
+		_mm_and_si128(is_decimal, decimal),
+		_mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10)))); // NOLINT
+}
+
+/// @brief Decodes 32 digits at a time, returning the number of digits decoded. Stops early at the
+/// first block containing an invalid digit
+__attr(target("ssse3")) __attr(nodiscard) static usize
+	hex_decode_ssse3(const_cstring restrict data, usize length, u8* restrict out) {
+	let weights = _mm_set1_epi16(0x0110); // NOLINT(readability-magic-numbers)
+	let_mut i = static_cast(usize)(0);
+	for(; i + 32 <= length; i += 32) {
+		let_mut valid = _mm_set1_epi8(-1);
+		let first = hex_values_ssse3(LOAD(_mm_loadu_si128, __m128i, data, i), &valid);
+		let second = hex_values_ssse3(LOAD(_mm_loadu_si128, __m128i, data, i + 16), &valid);
+		if(_mm_movemask_epi8(valid) != 0xFFFF) { // NOLINT(readability-magic-numbers)
+			break;
+		}
+
+		let bytes = _mm_packus_epi16(_mm_maddubs_epi16(first, weights),
+									 _mm_maddubs_epi16(second, weights));
+		STORE(_mm_storeu_si128, __m128i, out, i / 2, bytes);
+	}
+	return i;
+}
+
+/// @brief Converts 32 hex digits to their values, clearing the corresponding bytes of `valid` if
+/// they aren't hex digits
+__attr(target("avx2")) __attr(always_inline) static inline __m256i
+	hex_values_avx2(__m256i digits, __m256i* restrict valid) {
+	let decimal = _mm256_sub_epi8(digits, _mm256_set1_epi8('0'));
+	let is_decimal
+		= _mm256_cmpeq_epi8(_mm256_min_epu8(decimal, _mm256_set1_epi8(9)), decimal); // NOLINT
+	let letter = _mm256_sub_epi8(_mm256_or_si256(digits, _mm256_set1_epi8(0x20)), // NOLINT
+								 _mm256_set1_epi8('a'));
+	let is_letter
+		= _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter); // NOLINT
+	*valid = _mm256_and_si256(*valid, _mm256_or_si256(is_decimal, is_letter));
+	return _mm256_or_si256(
+		_mm256_and_si256(is_decimal, decimal),
+		_mm256_and_si256(is_letter, _mm256_add_epi8(letter, _mm256_set1_epi8(10)))); // NOLINT
+}
+
+/// @brief Decodes 64 digits at a time, returning the number of digits decoded. Stops early at the
+/// first block containing an invalid digit
+__attr(target("avx2")) __attr(nodiscard) static usize
+	hex_decode_avx2(const_cstring restrict data, usize length, u8* restrict out) {
+	let weights = _mm256_set1_epi16(0x0110); // NOLINT(readability-magic-numbers)
+	let_mut i = static_cast(usize)(0);
+	for(; i + 64 <= length; i += 64) {
+		let_mut valid = _mm256_set1_epi8(-1);
+		let first = hex_values_avx2(LOAD(_mm256_loadu_si256, __m256i, data, i), &valid);
+		let second = hex_values_avx2(LOAD(_mm256_loadu_si256, __m256i, data, i + 32), &valid);
+		if(_mm256_movemask_epi8(valid) != -1) {
+			break;
+		}
+
+		// packing works within 128-bit lanes, so the 64-bit halves have to be put back in order
+		let packed = _mm256_packus_epi16(_mm256_maddubs_epi16(first, weights),
+										 _mm256_maddubs_epi16(second, weights));
+		STORE(_mm256_storeu_si256,
+			  __m256i,
+			  out,
+			  i / 2,
+			  _mm256_permute4x64_epi64(packed, 0xD8)); // NOLINT(readability-magic-numbers)
+	}
+	return i;
+}
+
+// Base64 encoding follows Muła & Lemire, "Faster Base64 Encoding and Decoding Using AVX2
+// Instructions". Each group of three input bytes is shuffled into a 32-bit lane, and the four
+// 6-bit values are moved into separate bytes with a pair of 16-bit multiplies. Values are
+// converted to digits by adding an offset that depends only on which range the value is in
+// (`A-Z`, `a-z`, `0-9`, 62, or 63), which is looked up with `pshufb` after reducing each value to
+// a small range index with a saturating subtract and a compare.
+
+/// @brief Returns the `pshufb` table of offsets from value to digit for the given alphabet
+__attr(target("ssse3")) __attr(always_inline) static inline __m128i
+	base64_offsets_ssse3(CnxBase64Alphabet alphabet) {
+	// index 0 is `a-z`, 1 through 10 are `0-9`, 11 is value 62, 12 is value 63, and 13 is `A-Z`
+	return _mm_setr_epi8('a' - 26, // NOLINT
+						 '0' - 52, // NOLINT
+						 '0' - 52, // NOLINT
+						 '0' - 52, // NOLINT
+						 '0' - 52, // NOLINT
+						 '0' - 52, // NOLINT
+						 '0' - 52, // NOLINT
+						 '0' - 52, // NOLINT
+						 '0' - 52, // NOLINT
+						 '0' - 52, // NOLINT
+						 '0' - 52, // NOLINT
+						 static_cast(char)(base64_digit_62(alphabet) - 62), // NOLINT
+						 static_cast(char)(base64_digit_63(alphabet) - 63), // NOLINT
+						 'A',
+						 0,
+						 0);
+}
+
+/// @brief Encodes the first 12 bytes of `input` as 16 Base64 digits
+__attr(target("ssse3")) __attr(always_inline) static inline __m128i
+	base64_encode_block_ssse3(__m128i input, __m128i offsets) {
+	let shuffled = _mm_shuffle_epi8(
+		input,
+		_mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10)); // NOLINT
+	let high = _mm_mulhi_epu16(_mm_and_si128(shuffled, _mm_set1_epi32(0x0FC0FC00)), // NOLINT
+							   _mm_set1_epi32(0x04000040)); // NOLINT
+	let low = _mm_mullo_epi16(_mm_and_si128(shuffled, _mm_set1_epi32(0x003F03F0)), // NOLINT
+							  _mm_set1_epi32(0x01000010)); // NOLINT
+	let values = _mm_or_si128(high, low);
+
+	let_mut ranges = _mm_subs_epu8(values, _mm_set1_epi8(51)); // NOLINT
+	let is_upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), values); // NOLINT
+	ranges = _mm_or_si128(ranges, _mm_and_si128(is_upper, _mm_set1_epi8(13))); // NOLINT
+	return _mm_add_epi8(values, _mm_shuffle_epi8(offsets, ranges));
+}
+
+/// @brief Encodes 12 bytes at a time, returning the number of bytes encoded
+__attr(target("ssse3")) __attr(nodiscard) static usize
+	base64_encode_ssse3(const u8* restrict data,
+						usize length,
+						char* restrict out,
+						CnxBase64Alphabet alphabet) {
+	let offsets = base64_offsets_ssse3(alphabet);
+	let_mut i = static_cast(usize)(0);
+	let_mut written = static_cast(usize)(0);
+	// each step reads 16 bytes, but only encodes 12 of them
+	for(; i + 16 <= length; i += 12, written += 16) { // NOLINT(readability-magic-numbers)
+		let digits = base64_encode_block_ssse3(LOAD(_mm_loadu_si128, __m128i, data, i), offsets);
+		STORE(_mm_storeu_si128, __m128i, out, written, digits);
+	}
+	return i;
+}
+
+/// @brief Encodes 24 bytes at a time, returning the number of bytes encoded
+__attr(target("avx2")) __attr(nodiscard) static usize
+	base64_encode_avx2(const u8* restrict data,
+					   usize length,
+					   char* restrict out,
+					   CnxBase64Alphabet alphabet) {
+	let offsets = _mm256_broadcastsi128_si256(base64_offsets_ssse3(alphabet));
+	let shuffle = _mm256_broadcastsi128_si256(
+		_mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10)); // NOLINT
+	let_mut i = static_cast(usize)(0);
+	let_mut written = static_cast(usize)(0);
+	// each step reads 28 bytes (12 into the low lane and 16 into the high), but only encodes 24
+	for(; i + 28 <= length; i += 24, written += 32) { // NOLINT(readability-magic-numbers)
+		let input = _mm256_inserti128_si256(
+			_mm256_castsi128_si256(LOAD(_mm_loadu_si128, __m128i, data, i)),
+			LOAD(_mm_loadu_si128, __m128i, data, i + 12), // NOLINT(readability-magic-numbers)
+			1);
+		let shuffled = _mm256_shuffle_epi8(input, shuffle);
+		let high_bits = _mm256_and_si256(shuffled, _mm256_set1_epi32(0x0FC0FC00)); // NOLINT
+		let high = _mm256_mulhi_epu16(high_bits, _mm256_set1_epi32(0x04000040)); // NOLINT
+		let low_bits = _mm256_and_si256(shuffled, _mm256_set1_epi32(0x003F03F0)); // NOLINT
+		let low = _mm256_mullo_epi16(low_bits, _mm256_set1_epi32(0x01000010)); // NOLINT
+		let values = _mm256_or_si256(high, low);
+
+		let_mut ranges = _mm256_subs_epu8(values, _mm256_set1_epi8(51)); // NOLINT
+		let is_upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), values); // NOLINT
+		ranges
+			= _mm256_or_si256(ranges, _mm256_and_si256(is_upper, _mm256_set1_epi8(13))); // NOLINT
+		let digits = _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, ranges));
+		STORE(_mm256_storeu_si256, __m256i, out, written, digits);
+	}
+	return i;
+}
+
+// Base64 decoding range-checks each character against the three alphanumeric ranges and compares
+// it to the two remaining digits, keeping the value from whichever check passed, like hex
+// decoding. Groups of four 6-bit values are merged into 24 bits with two multiply-adds, then
+// shuffled into big-endian byte order and packed.
+
+/// @brief Converts 16 Base64 digits to their values, clearing the corresponding bytes of `valid`
+/// if they aren't digits of the alphabet
+__attr(target("ssse3")) __attr(always_inline) static inline __m128i
+	base64_values_ssse3(__m128i digits, __m128i digit_62, __m128i digit_63, __m128i* valid) {
+	let upper = _mm_sub_epi8(digits, _mm_set1_epi8('A'));
+	let is_upper = _mm_cmpeq_epi8(_mm_min_epu8(upper, _mm_set1_epi8(25)), upper); // NOLINT
+	let lower = _mm_sub_epi8(digits, _mm_set1_epi8('a'));
+	let is_lower = _mm_cmpeq_epi8(_mm_min_epu8(lower, _mm_set1_epi8(25)), lower); // NOLINT
+	let decimal = _mm_sub_epi8(digits, _mm_set1_epi8('0'));
+	let is_decimal = _mm_cmpeq_epi8(_mm_min_epu8(decimal, _mm_set1_epi8(9)), decimal); // NOLINT
+	let is_62 = _mm_cmpeq_epi8(digits, digit_62);
+	let is_63 = _mm_cmpeq_epi8(digits, digit_63);
+
+	*valid = _mm_and_si128(
+		*valid,
+		_mm_or_si128(_mm_or_si128(is_upper, is_lower),
+					 _mm_or_si128(is_decimal, _mm_or_si128(is_62, is_63))));
+	let_mut values = _mm_and_si128(is_upper, upper);
+	values = _mm_or_si128(
+		values,
+		_mm_and_si128(is_lower, _mm_add_epi8(lower, _mm_set1_epi8(26)))); // NOLINT
+	values = _mm_or_si128(
+		values,
+		_mm_and_si128(is_decimal, _mm_add_epi8(decimal, _mm_set1_epi8(52)))); // NOLINT
+	values = _mm_or_si128(values, _mm_and_si128(is_62, _mm_set1_epi8(62))); // NOLINT
+	return _mm_or_si128(values, _mm_and_si128(is_63, _mm_set1_epi8(63))); // NOLINT
+}
+
+/// @brief Packs the 6-bit values of 16 Base64 digits into 12 bytes, at the start of the result
+__attr(target("ssse3")) __attr(always_inline) static inline __m128i
+	base64_pack_ssse3(__m128i values) {
+	let pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)); // NOLINT
+	let quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000)); // NOLINT
+	return _mm_shuffle_epi8(
+		quads,
+		_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)); // NOLINT
+}
+
+/// @brief Decodes 16 digits at a time, returning the number of digits decoded. Stops early at
+/// the first block containing an invalid digit, or when fewer than 16 bytes of output remain
+__attr(target("ssse3")) __attr(nodiscard) static usize
+	base64_decode_ssse3(const_cstring restrict data,
+						usize length,
+						u8* restrict out,
+						usize out_length,
+						CnxBase64Alphabet alphabet) {
+	let digit_62 = _mm_set1_epi8(base64_digit_62(alphabet));
+	let digit_63 = _mm_set1_epi8(base64_digit_63(alphabet));
+	let_mut i = static_cast(usize)(0);
+	let_mut written = static_cast(usize)(0);
+	// each step writes 16 bytes, but only 12 of them are decoded output
+	for(; i + 16 <= length && written + 16 <= out_length; i += 16, written += 12) { // NOLINT
+		let_mut valid = _mm_set1_epi8(-1);
+		let values = base64_values_ssse3(LOAD(_mm_loadu_si128, __m128i, data, i),
+										 digit_62,
+										 digit_63,
+										 &valid);
+		if(_mm_movemask_epi8(valid) != 0xFFFF) { // NOLINT(readability-magic-numbers)
+			break;
+		}
+		STORE(_mm_storeu_si128, __m128i, out, written, base64_pack_ssse3(values));
+	}
+	return i;
+}
+
+/// @brief Converts 32 Base64 digits to their values, clearing the corresponding bytes of `valid`
+/// if they aren't digits of the alphabet
+__attr(target("avx2")) __attr(always_inline) static inline __m256i
+	base64_values_avx2(__m256i digits, __m256i digit_62, __m256i digit_63, __m256i* valid) {
+	let upper = _mm256_sub_epi8(digits, _mm256_set1_epi8('A'));
+	let is_upper = _mm256_cmpeq_epi8(_mm256_min_epu8(upper, _mm256_set1_epi8(25)), upper); // NOLINT
+	let lower = _mm256_sub_epi8(digits, _mm256_set1_epi8('a'));
+	let is_lower = _mm256_cmpeq_epi8(_mm256_min_epu8(lower, _mm256_set1_epi8(25)), lower); // NOLINT
+	let decimal = _mm256_sub_epi8(digits, _mm256_set1_epi8('0'));
+	let is_decimal
+		= _mm256_cmpeq_epi8(_mm256_min_epu8(decimal, _mm256_set1_epi8(9)), decimal); // NOLINT
+	let is_62 = _mm256_cmpeq_epi8(digits, digit_62);
+	let is_63 = _mm256_cmpeq_epi8(digits, digit_63);
+
+	*valid = _mm256_and_si256(
+		*valid,
+		_mm256_or_si256(_mm256_or_si256(is_upper, is_lower),
+						_mm256_or_si256(is_decimal, _mm256_or_si256(is_62, is_63))));
+	let_mut values = _mm256_and_si256(is_upper, upper);
+	values = _mm256_or_si256(
+		values,
+		_mm256_and_si256(is_lower, _mm256_add_epi8(lower, _mm256_set1_epi8(26)))); // NOLINT
+	values = _mm256_or_si256(
+		values,
+		_mm256_and_si256(is_decimal, _mm256_add_epi8(decimal, _mm256_set1_epi8(52)))); // NOLINT
+	values = _mm256_or_si256(values, _mm256_and_si256(is_62, _mm256_set1_epi8(62))); // NOLINT
+	return _mm256_or_si256(values, _mm256_and_si256(is_63, _mm256_set1_epi8(63))); // NOLINT
+}
+
+/// @brief Decodes 32 digits at a time, returning the number of digits decoded. Stops early at
+/// the first block containing an invalid digit, or when fewer than 32 bytes of output remain
+__attr(target("avx2")) __attr(nodiscard) static usize
+	base64_decode_avx2(const_cstring restrict data,
+					   usize length,
+					   u8* restrict out,
+					   usize out_length,
+					   CnxBase64Alphabet alphabet) {
+	let digit_62 = _mm256_set1_epi8(base64_digit_62(alphabet));
+	let digit_63 = _mm256_set1_epi8(base64_digit_63(alphabet));
+	let shuffle = _mm256_broadcastsi128_si256(
+		_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)); // NOLINT
+	// gathers the 12 decoded bytes at the start of each lane into the first 24 bytes
+	let gather = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7); // NOLINT(readability-magic-numbers)
+	let_mut i = static_cast(usize)(0);
+	let_mut written = static_cast(usize)(0);
+	// each step writes 32 bytes, but only 24 of them are decoded output
+	for(; i + 32 <= length && written + 32 <= out_length; i += 32, written += 24) { // NOLINT
+		let_mut valid = _mm256_set1_epi8(-1);
+		let values = base64_values_avx2(LOAD(_mm256_loadu_si256, __m256i, data, i),
+										digit_62,
+										digit_63,
+										&valid);
+		if(_mm256_movemask_epi8(valid) != -1) {
+			break;
+		}
+
+		let pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140)); // NOLINT
+		let quads = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000)); // NOLINT
+		let bytes = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(quads, shuffle), gather);
+		STORE(_mm256_storeu_si256, __m256i, out, written, bytes);
+	}
+	return i;
+}
+
+	#undef LOAD
+	#undef STORE
+
+#endif // CNX_ENCODING_SIMD_KERNELS
+
+usize cnx_hex_encoded_length(usize length) {
+	return length * 2;
+}
+
+usize cnx_hex_encode(const u8* restrict data, usize length, char* restrict out, bool uppercase) {
+	let digits = uppercase ? hex_digits_upper : hex_digits_lower;
+	let_mut i = static_cast(usize)(0);
+
+#if CNX_ENCODING_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		i = hex_encode_avx2(data, length, out, digits);
+	}
+	if(cpu_has_ssse3()) {
+		i += hex_encode_ssse3(data + i, length - i, out + 2 * i, digits);
+	}
+#endif // CNX_ENCODING_SIMD_KERNELS
+
+	for(; i < length; ++i) {
+		out[2 * i] = digits[data[i] >> 4U];
+		out[2 * i + 1] = digits[data[i] & 0x0FU]; // NOLINT(readability-magic-numbers)
+	}
+	return length * 2;
+}
+
+usize cnx_hex_decoded_length(usize length) {
+	return length / 2;
+}
+
+CnxResult(usize) cnx_hex_decode(restrict const_cstring data, usize length, u8* restrict out) {
+	if(length % 2 != 0) {
+		return Err(usize, cnx_error_new(EINVAL, CNX_POSIX_ERROR_CATEGORY));
+	}
+
+	let_mut i = static_cast(usize)(0);
+
+#if CNX_ENCODING_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		i = hex_decode_avx2(data, length, out);
+	}
+	if(cpu_has_ssse3()) {
+		i += hex_decode_ssse3(data + i, length - i, out + i / 2);
+	}
+#endif // CNX_ENCODING_SIMD_KERNELS
+
+	for(; i < length; i += 2) {
+		let high = hex_value(data[i]);
+		let low = hex_value(data[i + 1]);
+		if(high == INVALID_DIGIT || low == INVALID_DIGIT) {
+			return Err(usize, cnx_error_new(EINVAL, CNX_POSIX_ERROR_CATEGORY));
+		}
+		out[i / 2] = static_cast(u8)((high << 4U) | low);
+	}
+	return Ok(usize, length / 2);
+}
+
+usize cnx_base64_encoded_length(usize length, CnxBase64Alphabet alphabet) {
+	if(alphabet == CNX_BASE64_STANDARD) {
+		return ((length + 2) / 3) * 4;
+	}
+
+	// each trailing byte needs one digit, plus one more for the bits left over
+	let remainder = length % 3;
+	return (length / 3) * 4 + (remainder == 0 ? 0 : remainder + 1);
+}
+
+usize cnx_base64_encode(const u8* restrict data,
+						usize length,
+						char* restrict out,
+						CnxBase64Alphabet alphabet) {
+	let_mut i = static_cast(usize)(0);
+
+#if CNX_ENCODING_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		i = base64_encode_avx2(data, length, out, alphabet);
+	}
+	if(cpu_has_ssse3()) {
+		i += base64_encode_ssse3(data + i, length - i, out + (i / 3) * 4, alphabet);
+	}
+#endif // CNX_ENCODING_SIMD_KERNELS
+
+	let_mut written = (i / 3) * 4;
+	for(; i + 3 <= length; i += 3, written += 4) {
+		let bits = (static_cast(u32)(data[i]) << 16U) // NOLINT(readability-magic-numbers)
+				   | (static_cast(u32)(data[i + 1]) << 8U) | data[i + 2];
+		out[written] = base64_digit(bits >> 18U, alphabet); // NOLINT(readability-magic-numbers)
+		out[written + 1] = base64_digit((bits >> 12U) & 0x3FU, alphabet); // NOLINT
+		out[written + 2] = base64_digit((bits >> 6U) & 0x3FU, alphabet); // NOLINT
+		out[written + 3] = base64_digit(bits & 0x3FU, alphabet); // NOLINT
+	}
+
+	let remainder = length - i;
+	if(remainder != 0) {
+		let bits = (static_cast(u32)(data[i]) << 16U) // NOLINT(readability-magic-numbers)
+				   | (remainder == 2 ? static_cast(u32)(data[i + 1]) << 8U : 0U);
+		out[written++] = base64_digit(bits >> 18U, alphabet); // NOLINT(readability-magic-numbers)
+		out[written++] = base64_digit((bits >> 12U) & 0x3FU, alphabet); // NOLINT
+		if(remainder == 2) {
+			out[written++] = base64_digit((bits >> 6U) & 0x3FU, alphabet); // NOLINT
+		}
+		if(alphabet == CNX_BASE64_STANDARD) {
+			out[written++] = '=';
+			if(remainder == 1) {
+				out[written++] = '=';
+			}
+		}
+	}
+	return written;
+}
+
+/// @brief Returns the length of the given Base64 without its padding
+__attr(nodiscard) static usize base64_unpadded_length(restrict const_cstring data, usize length) {
+	if(length % 4 != 0 || length == 0) {
+		return length;
+	}
+
+	let_mut unpadded = length;
+	for(let_mut i = 0; i < 2 && data[unpadded - 1] == '='; ++i) {
+		--unpadded;
+	}
+	return unpadded;
+}
+
+usize cnx_base64_decoded_length(restrict const_cstring data, usize length) {
+	let unpadded = base64_unpadded_length(data, length);
+	let remainder = unpadded % 4;
+	return (unpadded / 4) * 3 + (remainder > 1 ? remainder - 1 : 0);
+}
+
+CnxResult(usize) cnx_base64_decode(restrict const_cstring data,
+								   usize length,
+								   u8* restrict out,
+								   CnxBase64Alphabet alphabet) {
+	let unpadded = base64_unpadded_length(data, length);
+	let remainder = unpadded % 4;
+	// a single trailing digit only carries 6 of the 8 bits of a byte
+	if(remainder == 1) {
+		return Err(usize, cnx_error_new(EINVAL, CNX_POSIX_ERROR_CATEGORY));
+	}
+	let out_length = cnx_base64_decoded_length(data, length);
+
+	let_mut i = static_cast(usize)(0);
+
+#if CNX_ENCODING_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		i = base64_decode_avx2(data, unpadded, out, out_length, alphabet);
+	}
+	if(cpu_has_ssse3()) {
+		let written = (i / 4) * 3;
+		i += base64_decode_ssse3(data + i,
+								 unpadded - i,
+								 out + written,
+								 out_length - written,
+								 alphabet);
+	}
+#endif // CNX_ENCODING_SIMD_KERNELS
+
+	let_mut written = (i / 4) * 3;
+	for(; i < unpadded; i += 4) {
+		let num_digits = unpadded - i < 4 ? unpadded - i : 4;
+		let_mut bits = static_cast(u32)(0);
+		for(let_mut j = static_cast(usize)(0); j < 4; ++j) {
+			let value = j < num_digits ? base64_value(data[i + j], alphabet) : 0U;
+			if(value == INVALID_DIGIT) {
+				return Err(usize, cnx_error_new(EINVAL, CNX_POSIX_ERROR_CATEGORY));
+			}
+			bits = (bits << 6U) | value;
+		}
+
+		out[written++] = static_cast(u8)(bits >> 16U); // NOLINT(readability-magic-numbers)
+		if(num_digits > 2) {
+			out[written++] = static_cast(u8)(bits >> 8U); // NOLINT(readability-magic-numbers)
+		}
+		if(num_digits > 3) {
+			out[written++] = static_cast(u8)(bits);
+		}
+	}
+	return Ok(usize, out_length);
+}
+
+void cnx_string_append_hex(CnxString* restrict self,
+						   const u8* restrict data,
+						   usize length,
+						   bool uppercase) {
+	let out = cnx_string_append_uninitialized(*self, cnx_hex_encoded_length(length));
+	ignore(cnx_hex_encode(data, length, out, uppercase));
+}
+
+void cnx_string_append_base64(CnxString* restrict self,
+							  const u8* restrict data,
+							  usize length,
+							  CnxBase64Alphabet alphabet) {
+	let out
+		= cnx_string_append_uninitialized(*self, cnx_base64_encoded_length(length, alphabet));
+	ignore(cnx_base64_encode(data, length, out, alphabet));
+}
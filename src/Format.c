@@ -310,34 +310,22 @@ __attr(nodiscard) static inline CnxString
 				   usize num_digits,
 				   CnxFormatIntegralNotation notation,
 				   CnxAllocator allocator) {
-	let_mut string = cnx_string_new_with_capacity_with_allocator(num_digits + 2, allocator);
-	let_mut gotten_non_zero = false;
-
-	cnx_string_push_back(string, '0');
-	if(notation == CNX_FORMAT_UNSIGNED_NOTATION_LOWER_HEX) {
-		cnx_string_push_back(string, 'x');
-		ranged_for(i, 0U, num_digits) {
-			let digit = cnx_get_hex(num, (num_digits - 1) - i);
-			if(gotten_non_zero || digit != 0) {
-				cnx_string_push_back(string, cnx_num_to_hex_lower(digit));
-				gotten_non_zero = true;
-			}
-		}
+	// leading zero digits aren't printed, but at least one digit always is
+	let_mut num_significant = num_digits;
+	while(num_significant > 1 && cnx_get_hex(num, num_significant - 1) == 0) {
+		--num_significant;
 	}
-	else {
-		cnx_string_push_back(string, 'X');
-		ranged_for(i, 0U, num_digits) {
-			let digit = cnx_get_hex(num, (num_digits - 1) - i);
-			if(gotten_non_zero || digit != 0) {
-				cnx_string_push_back(string, cnx_num_to_hex_upper(digit));
-				gotten_non_zero = true;
-			}
-		}
+
+	let_mut string = cnx_string_new_with_capacity_with_allocator(num_digits + 2, allocator);
+	let out = cnx_string_append_uninitialized(string, num_significant + 2);
+	let is_lower = notation == CNX_FORMAT_UNSIGNED_NOTATION_LOWER_HEX;
+	out[0] = '0';
+	out[1] = is_lower ? 'x' : 'X';
+	ranged_for(i, 0U, num_significant) {
+		let digit = cnx_get_hex(num, (num_significant - 1) - i);
+		out[i + 2] = is_lower ? cnx_num_to_hex_lower(digit) : cnx_num_to_hex_upper(digit);
 	}
-	return gotten_non_zero ? string : ({
-		cnx_string_push_back(string, '0');
-		string;
-	});
+	return string;
 }
 
 typedef enum CnxFormatFloatNotation {
@@ -1160,11 +1148,12 @@ CnxString(cnx_format_with_allocator)(restrict const_cstring format_string,
 	return string;
 }
 
-// NOLINTNEXTLINE(readability-function-cognitive-complexity, misc-no-recursion)
-CnxString(cnx_vformat_with_allocator)(restrict const_cstring format_string,
-									  CnxAllocator allocator,
-									  usize num_args,
-									  va_list list) { // NOLINT
+/// @brief Parses `format_string`, asserting that it's valid for `num_args` arguments in debug
+/// builds
+__attr(nodiscard) static CnxVector(CnxFormatVariant)
+	parse_format_string(restrict const_cstring format_string,
+						CnxAllocator allocator,
+						usize num_args) {
 	let string_length = strlen(format_string);
 	let_mut maybe_format_variants = cnx_format_parse_and_validate_format_string(format_string,
 																				string_length,
@@ -1178,31 +1167,29 @@ CnxString(cnx_vformat_with_allocator)(restrict const_cstring format_string,
 	}
 #endif // CNX_PLATFORM_DEBUG
 
-	CnxScopedVector(CnxFormatVariant) format_variants
-		= cnx_result_expect(maybe_format_variants, "Invalid format string");
-
-	// 10 chars per formatted string element is a reasonable first guess
-	// tradeof between performance and memory usage
-	// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
-	let_mut initial_size = static_cast(usize)(cnx_vector_size(format_variants) * 10U);
-	foreach_ref(elem, format_variants) {
-		match_let(*elem, Substring, str) {
-			initial_size += str.m_length;
-		}
-	}
-
-	CnxScopedString string = cnx_string_new_with_capacity_with_allocator(initial_size, allocator);
+	return cnx_result_expect(maybe_format_variants, "Invalid format string");
+}
 
+/// @brief Formats the arguments into the parsed format string, passing the output to `sink`. The
+/// arguments are read from `args` if it's not null, otherwise from `list`
+// NOLINTNEXTLINE(readability-function-cognitive-complexity, misc-no-recursion)
+static void format_to_sink(const CnxVector(CnxFormatVariant) * restrict variants,
+						   CnxAllocator allocator,
+						   va_list* list,
+						   const CnxFormat* restrict args,
+						   CnxFormatSink sink,
+						   void* restrict target) { // NOLINT
 #if CNX_PLATFORM_DEBUG
 	let_mut spec_index = static_cast(usize)(0);
 #endif
-	foreach(elem, format_variants) {
+	foreach(elem, *variants) {
 		match(elem) {
 			variant(Substring, view) {
-				cnx_string_append(string, &view);
+				sink(target, view.m_view, view.m_length);
 			}
 			variant(Specifier, specifier) {
-				let format = va_arg(list, CnxFormat); // NOLINT(clang-analyzer-valist.Uninitialized)
+				// NOLINTNEXTLINE(clang-analyzer-valist.Uninitialized)
+				let format = args != nullptr ? *args++ : va_arg(*list, CnxFormat);
 				let context = trait_call(is_specifier_valid, format, specifier);
 #if CNX_PLATFORM_DEBUG
 				if(context.is_valid != CNX_FORMAT_SUCCESS) {
@@ -1221,10 +1208,74 @@ CnxString(cnx_vformat_with_allocator)(restrict const_cstring format_string,
 #endif
 				CnxScopedString formatted
 					= trait_call(format_with_allocator, format, context, allocator);
-				cnx_string_append(string, &formatted);
+				sink(target, cnx_string_into_cstring(formatted), cnx_string_length(formatted));
 			}
 		}
 	}
+}
+
+/// @brief `CnxFormatSink` that appends to the `CnxString` `target`
+static void append_to_string(void* restrict target, restrict const_cstring piece, usize length) {
+	cnx_string_append_cstring(static_cast(CnxString*)(target), piece, length);
+}
+
+/// @brief Formats the arguments into `format_string`. The arguments are read from `args` if it's
+/// not null, otherwise from `list`
+// NOLINTNEXTLINE(misc-no-recursion)
+static CnxString format_impl(restrict const_cstring format_string,
+							 CnxAllocator allocator,
+							 usize num_args,
+							 va_list* list,
+							 const CnxFormat* restrict args) { // NOLINT
+	CnxScopedVector(CnxFormatVariant) format_variants
+		= parse_format_string(format_string, allocator, num_args);
+
+	// 10 chars per formatted string element is a reasonable first guess
+	// tradeof between performance and memory usage
+	// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+	let_mut initial_size = static_cast(usize)(cnx_vector_size(format_variants) * 10U);
+	foreach_ref(elem, format_variants) {
+		match_let(*elem, Substring, str) {
+			initial_size += str.m_length;
+		}
+	}
 
+	CnxScopedString string = cnx_string_new_with_capacity_with_allocator(initial_size, allocator);
+	format_to_sink(&format_variants, allocator, list, args, append_to_string, &string);
 	return move(string);
 }
+
+// NOLINTNEXTLINE(misc-no-recursion)
+CnxString(cnx_vformat_with_allocator)(restrict const_cstring format_string,
+									  CnxAllocator allocator,
+									  usize num_args,
+									  va_list list) { // NOLINT
+	va_list copy = {0};
+	va_copy(copy, list);
+	let string = format_impl(format_string, allocator, num_args, &copy, nullptr);
+	va_end(copy);
+	return string;
+}
+
+// NOLINTNEXTLINE(misc-no-recursion)
+void cnx_vformat_into(void* restrict target,
+					  CnxFormatSink sink,
+					  restrict const_cstring format_string,
+					  CnxAllocator allocator,
+					  usize num_args,
+					  va_list list) { // NOLINT
+	CnxScopedVector(CnxFormatVariant) format_variants
+		= parse_format_string(format_string, allocator, num_args);
+	va_list copy = {0};
+	va_copy(copy, list);
+	format_to_sink(&format_variants, allocator, &copy, nullptr, sink, target);
+	va_end(copy);
+}
+
+// NOLINTNEXTLINE(misc-no-recursion)
+CnxString cnx_format_array_with_allocator(restrict const_cstring format_string,
+										  CnxAllocator allocator,
+										  usize num_args,
+										  const CnxFormat* restrict args) {
+	return format_impl(format_string, allocator, num_args, nullptr, args);
+}
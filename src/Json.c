@@ -0,0 +1,1588 @@
+/// @file Json.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides JSON writing, and SAX and DOM style JSON parsing
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+
+#include <Cnx/Assert.h>
+#include <Cnx/Json.h>
+#include <Cnx/Platform.h>
+#include <Cnx/Utf8.h>
+#include <Cnx/__string/__byte_scan.h>
+#include <Cnx/__string/__decimal.h>
+#include <errno.h>
+#include <math.h>
+#include <memory.h>
+
+#if(CNX_PLATFORM_COMPILER_GCC || CNX_PLATFORM_COMPILER_CLANG) \
+	&& (defined(__x86_64__) || defined(_M_X64))
+	/// @brief Whether the SSE2 and AVX2 classification kernels are available for this target
+	#define CNX_JSON_SIMD_KERNELS 1
+	#include <immintrin.h>
+#else
+	/// @brief Whether the SSE2 and AVX2 classification kernels are available for this target
+	#define CNX_JSON_SIMD_KERNELS 0
+#endif
+
+#undef cnx_json_document_root
+
+#define RESULT_T	CnxJsonDocument
+#define RESULT_IMPL TRUE
+// NOLINTNEXTLINE(readability-duplicate-include)
+#include <Cnx/Result.h>
+#undef RESULT_T
+#undef RESULT_IMPL
+
+/// @brief The number of bytes classified at a time by the first stage of parsing
+#define BLOCK_SIZE (static_cast(usize)(64U))
+
+/// @brief The smallest block of a `CnxJsonDocument`'s arena
+#define MIN_ARENA_BLOCK_SIZE (static_cast(usize)(64U * 1024U))
+
+/// @brief The number of frames the DOM builder initially has room for
+#define INITIAL_FRAMES_CAPACITY (static_cast(usize)(16U))
+
+/// @brief The number of pending values the DOM builder initially has room for
+#define INITIAL_VALUES_CAPACITY (static_cast(usize)(64U))
+
+// The first stage of parsing classifies each 64 byte block of the input into bitmasks (one bit
+// per byte) of the bytes that are quotes, backslashes, structural operators, and whitespace, then
+// combines those masks to find the structural bytes: operators outside of strings, the opening
+// quote of each string, and the first byte of each scalar. The second stage only visits those.
+
+/// @brief The classification of a block of input, one bit per byte
+typedef struct BlockMasks {
+	/// @brief The bytes that are `"`
+	u64 quotes;
+	/// @brief The bytes that are `\`
+	u64 backslashes;
+	/// @brief The bytes that are one of `{`, `}`, `[`, `]`, `:`, or `,`
+	u64 operators;
+	/// @brief The bytes that are JSON whitespace: `' '`, `'\t'`, `'\n'`, or `'\r'`
+	u64 whitespace;
+} BlockMasks;
+
+/// @brief A function classifying the `BLOCK_SIZE` bytes at `block`
+typedef BlockMasks (*classify_function)(const_cstring block);
+
+/// @brief The classes of bytes, for the scalar classification kernel
+typedef enum ByteClass {
+	CLASS_QUOTE = 1U,
+	CLASS_BACKSLASH = 2U,
+	CLASS_OPERATOR = 4U,
+	CLASS_WHITESPACE = 8U,
+} ByteClass;
+
+/// @brief The class of each byte, for the scalar classification kernel
+static const u8 byte_classes[256] = {
+	['"'] = CLASS_QUOTE,
+	['\\'] = CLASS_BACKSLASH,
+	['{'] = CLASS_OPERATOR,
+	['}'] = CLASS_OPERATOR,
+	['['] = CLASS_OPERATOR,
+	[']'] = CLASS_OPERATOR,
+	[':'] = CLASS_OPERATOR,
+	[','] = CLASS_OPERATOR,
+	[' '] = CLASS_WHITESPACE,
+	['\t'] = CLASS_WHITESPACE,
+	['\n'] = CLASS_WHITESPACE,
+	['\r'] = CLASS_WHITESPACE,
+};
+
+__attr(maybe_unused) __attr(nodiscard) static BlockMasks classify_scalar(const_cstring block) {
+	let_mut masks = (BlockMasks){0};
+	for(let_mut i = static_cast(usize)(0); i < BLOCK_SIZE; ++i) {
+		let class = byte_classes[static_cast(u8)(block[i])];
+		let bit = static_cast(u64)(1) << i;
+		masks.quotes |= (class & CLASS_QUOTE) != 0 ? bit : 0U;
+		masks.backslashes |= (class & CLASS_BACKSLASH) != 0 ? bit : 0U;
+		masks.operators |= (class & CLASS_OPERATOR) != 0 ? bit : 0U;
+		masks.whitespace |= (class & CLASS_WHITESPACE) != 0 ? bit : 0U;
+	}
+	return masks;
+}
+
+#if CNX_JSON_SIMD_KERNELS
+
+__attr(always_inline) __attr(nodiscard) static inline bool cpu_has_avx2(void) {
+	return __builtin_cpu_supports("avx2");
+}
+
+	/// @brief Loads an unaligned vector of type `vector_t` from `data + index`
+	#define LOAD(loadu, vector_t, data, index) \
+		loadu(static_cast(const vector_t*)(static_cast(const void*)((data) + (index))))
+
+// `[` and `{` (and `]` and `}`) differ only in bit 5, which `:` and `,` already have set, so
+// or-ing in that bit lets two comparisons find all four brackets
+
+/// @brief Classifies 32 bytes into the low 32 bits of each mask
+__attr(target("avx2")) __attr(always_inline) static inline BlockMasks
+	classify_half_avx2(__m256i bytes) {
+	let folded = _mm256_or_si256(bytes, _mm256_set1_epi8(0x20)); // NOLINT
+	let operators = _mm256_or_si256(
+		_mm256_or_si256(_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')),
+						_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}'))),
+		_mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(':')),
+						_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(','))));
+	let whitespace = _mm256_or_si256(
+		_mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(' ')),
+						_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\t'))),
+		_mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\n')),
+						_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\r'))));
+	return (BlockMasks){
+		.quotes = static_cast(u32)(
+			_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('"')))),
+		.backslashes = static_cast(u32)(
+			_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\\')))),
+		.operators = static_cast(u32)(_mm256_movemask_epi8(operators)),
+		.whitespace = static_cast(u32)(_mm256_movemask_epi8(whitespace)),
+	};
+}
+
+__attr(target("avx2")) __attr(nodiscard) static BlockMasks classify_avx2(const_cstring block) {
+	let low = classify_half_avx2(LOAD(_mm256_loadu_si256, __m256i, block, 0));
+	let high = classify_half_avx2(LOAD(_mm256_loadu_si256, __m256i, block, 32));
+	return (BlockMasks){.quotes = low.quotes | (high.quotes << 32U),
+						.backslashes = low.backslashes | (high.backslashes << 32U),
+						.operators = low.operators | (high.operators << 32U),
+						.whitespace = low.whitespace | (high.whitespace << 32U)};
+}
+
+/// @brief Classifies 16 bytes into the low 16 bits of each mask
+__attr(always_inline) static inline BlockMasks classify_quarter_sse2(__m128i bytes) {
+	let folded = _mm_or_si128(bytes, _mm_set1_epi8(0x20)); // NOLINT
+	let operators
+		= _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')),
+									_mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))),
+					   _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(':')),
+									_mm_cmpeq_epi8(bytes, _mm_set1_epi8(','))));
+	let whitespace
+		= _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(' ')),
+									_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\t'))),
+					   _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n')),
+									_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\r'))));
+	return (BlockMasks){
+		.quotes = static_cast(u16)(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('"')))),
+		.backslashes
+		= static_cast(u16)(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\\')))),
+		.operators = static_cast(u16)(_mm_movemask_epi8(operators)),
+		.whitespace = static_cast(u16)(_mm_movemask_epi8(whitespace)),
+	};
+}
+
+__attr(nodiscard) static BlockMasks classify_sse2(const_cstring block) {
+	let_mut masks = (BlockMasks){0};
+	for(let_mut i = 0U; i < 4U; ++i) {
+		let quarter = classify_quarter_sse2(LOAD(_mm_loadu_si128, __m128i, block, i * 16U));
+		let shift = i * 16U;
+		masks.quotes |= quarter.quotes << shift;
+		masks.backslashes |= quarter.backslashes << shift;
+		masks.operators |= quarter.operators << shift;
+		masks.whitespace |= quarter.whitespace << shift;
+	}
+	return masks;
+}
+
+	#undef LOAD
+
+#endif // CNX_JSON_SIMD_KERNELS
+
+/// @brief Returns the classification kernel to use on this machine
+__attr(nodiscard) static inline classify_function select_classify(void) {
+#if CNX_JSON_SIMD_KERNELS
+	return cpu_has_avx2() ? classify_avx2 : classify_sse2;
+#else
+	return classify_scalar;
+#endif // CNX_JSON_SIMD_KERNELS
+}
+
+/// @brief The state carried between blocks by the first stage of parsing
+typedef struct ScanState {
+	/// @brief Whether the first byte of the next block is escaped by a backslash in this one
+	u64 escaped;
+	/// @brief All ones if the next block begins inside of a string, otherwise zero
+	u64 in_string;
+	/// @brief Whether the last byte of this block was part of an unquoted scalar
+	u64 scalar;
+} ScanState;
+
+/// @brief Returns the mask of the bytes of a block that are escaped by a preceding backslash,
+/// given the mask of its backslashes. A byte is escaped if it follows an odd-length run of
+/// backslashes, which this finds by adding the starts of runs to the runs themselves: the carry
+/// out of a run lands just past its end, at an even or odd offset depending on its length
+__attr(nodiscard) static inline u64 find_escaped(u64 backslashes, ScanState* restrict state) {
+	let even_bits = static_cast(u64)(0x5555555555555555ULL);
+	// a backslash escaped by the previous block doesn't begin a run
+	backslashes &= ~state->escaped;
+	let follows_escape = (backslashes << 1U) | state->escaped;
+	let odd_starts = backslashes & ~even_bits & ~follows_escape;
+	u64 even_sequences = 0;
+	state->escaped = __builtin_add_overflow(odd_starts, backslashes, &even_sequences) ? 1U : 0U;
+	let invert = even_sequences << 1U;
+	return (even_bits ^ invert) & follows_escape;
+}
+
+/// @brief Returns the mask with each bit set to the xor of it and every bit below it. For a mask
+/// of quotes, this is the mask of the bytes inside of strings, including the opening quotes
+__attr(nodiscard) static inline u64 prefix_xor(u64 mask) {
+	mask ^= mask << 1U;
+	mask ^= mask << 2U;
+	mask ^= mask << 4U;
+	mask ^= mask << 8U;  // NOLINT
+	mask ^= mask << 16U; // NOLINT
+	mask ^= mask << 32U; // NOLINT
+	return mask;
+}
+
+/// @brief Returns the structural bytes of a block, given its classification
+__attr(nodiscard) static inline u64 find_structurals(BlockMasks masks, ScanState* restrict state) {
+	let escaped = find_escaped(masks.backslashes, state);
+	let quotes = masks.quotes & ~escaped;
+	let in_string = prefix_xor(quotes) ^ state->in_string;
+	state->in_string = static_cast(u64)(static_cast(i64)(in_string) >> 63U);
+	// the bytes after each opening quote, up to and including the closing quote
+	let string_tail = in_string ^ quotes;
+
+	let scalar = ~(masks.operators | masks.whitespace);
+	let unquoted_scalar = scalar & ~quotes;
+	let follows_scalar = (unquoted_scalar << 1U) | state->scalar;
+	state->scalar = unquoted_scalar >> 63U;
+	let scalar_starts = scalar & ~follows_scalar;
+
+	return (masks.operators | scalar_starts) & ~string_tail;
+}
+
+/// @brief The structural index of the input, built by the first stage of parsing
+typedef struct StructuralIndex {
+	/// @brief The indices of the structural bytes of the input, in order
+	usize* m_indices;
+	/// @brief The number of indices in `m_indices`
+	usize m_size;
+	/// @brief The capacity of `m_indices`
+	usize m_capacity;
+} StructuralIndex;
+
+/// @brief Appends the indices of the set bits of `structurals`, offset by `base`, to `index`
+static inline void emit_structurals(StructuralIndex* restrict index,
+									u64 structurals,
+									usize base,
+									CnxAllocator allocator) {
+	if(index->m_size + BLOCK_SIZE > index->m_capacity) {
+		let capacity = index->m_capacity * 2U;
+		index->m_indices = cnx_allocator_reallocate_array_t(usize,
+															allocator,
+															index->m_indices,
+															index->m_capacity,
+															capacity);
+		index->m_capacity = capacity;
+	}
+
+	let_mut size = index->m_size;
+	while(structurals != 0) {
+		index->m_indices[size] = base + static_cast(usize)(__builtin_ctzll(structurals));
+		++size;
+		structurals &= structurals - 1U;
+	}
+	index->m_size = size;
+}
+
+/// @brief Builds the structural index of `data`
+///
+/// @return whether `data` has balanced quotes. If not, the index is incomplete
+__attr(nodiscard) static bool build_structural_index(restrict const_cstring data,
+													 usize length,
+													 StructuralIndex* restrict index,
+													 CnxAllocator allocator) {
+	let classify = select_classify();
+	let_mut state = (ScanState){0};
+	let capacity = length / 8U + BLOCK_SIZE;
+	*index = (StructuralIndex){
+		.m_indices = cnx_allocator_allocate_array_t(usize, allocator, capacity),
+		.m_size = 0,
+		.m_capacity = capacity,
+	};
+
+	let_mut base = static_cast(usize)(0);
+	for(; base + BLOCK_SIZE <= length; base += BLOCK_SIZE) {
+		let structurals = find_structurals(classify(data + base), &state);
+		emit_structurals(index, structurals, base, allocator);
+	}
+
+	if(base < length) {
+		// pad the final partial block with whitespace, which is never structural
+		char block[BLOCK_SIZE];
+		memset(block, ' ', BLOCK_SIZE);
+		memcpy(block, data + base, length - base);
+		let structurals = find_structurals(classify(block), &state);
+		emit_structurals(index, structurals, base, allocator);
+	}
+
+	return state.in_string == 0;
+}
+
+/// @brief The outcome of the second stage of parsing
+typedef enum ParseStatus {
+	PARSE_SUCCESS = 0,
+	PARSE_INVALID,
+	PARSE_CANCELLED,
+} ParseStatus;
+
+/// @brief The state of the second stage of parsing
+typedef struct JsonParser {
+	/// @brief The input
+	const_cstring m_data;
+	/// @brief The length of the input
+	usize m_length;
+	/// @brief The structural index of the input
+	StructuralIndex m_index;
+	/// @brief The position in `m_index` of the next structural to visit
+	usize m_next;
+	/// @brief Bitset of whether each nesting level is an object (`1`) or array (`0`)
+	u64 m_objects[CNX_JSON_MAX_DEPTH / 64U];
+	/// @brief The current nesting depth
+	usize m_depth;
+	/// @brief The bytes that end a run of characters in a string that can be copied verbatim
+	CnxByteSet m_string_specials;
+	/// @brief The bytes that end a scalar
+	CnxByteSet m_scalar_terminators;
+	/// @brief The buffer strings containing escape sequences are unescaped into
+	char* m_scratch;
+	/// @brief The capacity of `m_scratch`
+	usize m_scratch_capacity;
+	/// @brief The handler to report the contents of the input to
+	CnxJsonHandler* m_handler;
+	/// @brief The allocator to allocate temporary buffers with
+	CnxAllocator m_allocator;
+} JsonParser;
+
+/// @brief Calls the given function of the parser's handler, returning `PARSE_CANCELLED` from the
+/// enclosing function if the handler requests parsing stop
+#define HANDLE(parser, function, ...)                                                  \
+	do {                                                                               \
+		let ___handler = (parser)->m_handler;                                          \
+		if(!___handler->m_vtable->function(___handler __VA_OPT__(, ) __VA_ARGS__)) { \
+			return PARSE_CANCELLED;                                                    \
+		}                                                                              \
+	} while(false)
+
+/// @brief Parses the four hexadecimal digits at `data + index` into `value`
+__attr(nodiscard) static bool
+	parse_hex4(restrict const_cstring data, usize length, usize index, u32* restrict value) {
+	if(index + 4U > length) {
+		return false;
+	}
+
+	let_mut result = static_cast(u32)(0);
+	for(let_mut i = index; i < index + 4U; ++i) {
+		let digit = data[i];
+		let_mut digit_value = static_cast(u32)(0);
+		if(digit >= '0' && digit <= '9') {
+			digit_value = static_cast(u32)(digit - '0');
+		}
+		else if((digit | 0x20) >= 'a' && (digit | 0x20) <= 'f') { // NOLINT
+			digit_value = static_cast(u32)((digit | 0x20) - 'a' + 10); // NOLINT
+		}
+		else {
+			return false;
+		}
+		result = (result << 4U) | digit_value;
+	}
+
+	*value = result;
+	return true;
+}
+
+/// @brief Unescapes the escape sequence at `data + *index` into `*out`, advancing both past it
+__attr(nodiscard) static bool unescape(restrict const_cstring data,
+									   usize length,
+									   usize* restrict index,
+									   char** restrict out) {
+	let position = *index;
+	if(position + 1U >= length) {
+		return false;
+	}
+
+	let_mut output = *out;
+	let_mut consumed = static_cast(usize)(2);
+	switch(data[position + 1U]) {
+		case '"': *output++ = '"'; break;
+		case '\\': *output++ = '\\'; break;
+		case '/': *output++ = '/'; break;
+		case 'b': *output++ = '\b'; break;
+		case 'f': *output++ = '\f'; break;
+		case 'n': *output++ = '\n'; break;
+		case 'r': *output++ = '\r'; break;
+		case 't': *output++ = '\t'; break;
+		case 'u':
+			{
+				let_mut code_point = static_cast(u32)(0);
+				if(!parse_hex4(data, length, position + 2U, &code_point)) {
+					return false;
+				}
+				consumed = 6U;
+
+				// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+				if(code_point >= 0xD800U && code_point <= 0xDBFFU) {
+					// a high surrogate must be followed by an escaped low surrogate
+					let_mut low = static_cast(u32)(0);
+					// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+					if(position + 7U >= length || data[position + 6U] != '\\'
+					   || data[position + 7U] != 'u'
+					   || !parse_hex4(data, length, position + 8U, &low) || low < 0xDC00U
+					   || low > 0xDFFFU)
+					{
+						return false;
+					}
+					code_point = 0x10000U + ((code_point - 0xD800U) << 10U) + (low - 0xDC00U);
+					// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+					consumed = 12U;
+				}
+				// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+				else if(code_point >= 0xDC00U && code_point <= 0xDFFFU) {
+					return false;
+				}
+
+				// the unescaped code point is never longer than its escape sequence, so this
+				// can't overrun the string's bytes
+				output += cnx_utf8_encode(code_point, output);
+				break;
+			}
+		default: return false;
+	}
+
+	*index = position + consumed;
+	*out = output;
+	return true;
+}
+
+/// @brief Parses the string whose opening quote is at `position`, unescaping it into the
+/// parser's scratch buffer if it contains escape sequences
+__attr(nodiscard) static bool
+	parse_string(JsonParser* restrict self, usize position, CnxStringView* restrict string) {
+	let data = self->m_data;
+	let start = position + 1U;
+	// the closing quote comes before the next structural
+	let bound = self->m_next < self->m_index.m_size ? self->m_index.m_indices[self->m_next] :
+													   self->m_length;
+	let_mut index
+		= start + cnx_byte_scan_find_any_of(data + start, bound - start, &self->m_string_specials);
+	if(index < bound && data[index] == '"') {
+		*string = cnx_stringview_from_raw(data + start, index - start);
+		return true;
+	}
+
+	if(index == bound || data[index] != '\\') {
+		// unescaped control characters aren't allowed in strings
+		return false;
+	}
+
+	if(bound - start > self->m_scratch_capacity) {
+		if(self->m_scratch != nullptr) {
+			cnx_allocator_deallocate(self->m_allocator, self->m_scratch);
+		}
+		let doubled = self->m_scratch_capacity * 2U;
+		let capacity = bound - start > doubled ? bound - start : doubled;
+		self->m_scratch = cnx_allocator_allocate_array_t(char, self->m_allocator, capacity);
+		self->m_scratch_capacity = capacity;
+	}
+
+	let_mut out = self->m_scratch;
+	memcpy(out, data + start, index - start);
+	out += index - start;
+	while(data[index] != '"') {
+		if(data[index] != '\\' || !unescape(data, bound, &index, &out)) {
+			return false;
+		}
+
+		let run = cnx_byte_scan_find_any_of(data + index, bound - index, &self->m_string_specials);
+		memcpy(out, data + index, run);
+		out += run;
+		index += run;
+		if(index == bound) {
+			return false;
+		}
+	}
+
+	*string = cnx_stringview_from_raw(self->m_scratch, static_cast(usize)(out - self->m_scratch));
+	return true;
+}
+
+/// @brief Parses the given number, which must span the entire token
+__attr(nodiscard) static bool
+	parse_number(restrict const_cstring token, usize length, CnxJsonNumber* restrict number) {
+	let_mut i = static_cast(usize)(0);
+	let negative = token[0] == '-';
+	if(negative) {
+		++i;
+	}
+
+	if(i == length) {
+		return false;
+	}
+
+	let integer_start = i;
+	if(token[i] == '0') {
+		++i;
+	}
+	else if(token[i] >= '1' && token[i] <= '9') {
+		for(; i < length && token[i] >= '0' && token[i] <= '9'; ++i) {
+		}
+	}
+	else {
+		return false;
+	}
+
+	let_mut is_integer = true;
+	if(i < length && token[i] == '.') {
+		++i;
+		let digits_start = i;
+		for(; i < length && token[i] >= '0' && token[i] <= '9'; ++i) {
+		}
+		if(i == digits_start) {
+			return false;
+		}
+		is_integer = false;
+	}
+
+	if(i < length && (token[i] == 'e' || token[i] == 'E')) {
+		++i;
+		if(i < length && (token[i] == '+' || token[i] == '-')) {
+			++i;
+		}
+		let digits_start = i;
+		for(; i < length && token[i] >= '0' && token[i] <= '9'; ++i) {
+		}
+		if(i == digits_start) {
+			return false;
+		}
+		is_integer = false;
+	}
+
+	if(i != length) {
+		return false;
+	}
+
+	number->m_text = cnx_stringview_from_raw(token, length);
+	let digits = token + integer_start;
+	let num_digits = length - integer_start;
+	// integers with more digits than any `u64` are always out of range, so don't try them as one
+	if(is_integer && num_digits <= CNX_DECIMAL_MAX_INTEGER_LENGTH) {
+		if(negative) {
+			let_mut value = cnx_decimal_parse_i64(digits, num_digits, true);
+			if(cnx_result_is_ok(value)) {
+				number->m_type = CnxJsonI64;
+				number->m_i64 = cnx_result_unwrap(value);
+				return true;
+			}
+		}
+		else {
+			let_mut value = cnx_decimal_parse_u64(digits, num_digits);
+			if(cnx_result_is_ok(value)) {
+				let magnitude = cnx_result_unwrap(value);
+				if(magnitude <= static_cast(u64)(INT64_MAX)) {
+					number->m_type = CnxJsonI64;
+					number->m_i64 = static_cast(i64)(magnitude);
+				}
+				else {
+					number->m_type = CnxJsonU64;
+					number->m_u64 = magnitude;
+				}
+				return true;
+			}
+		}
+	}
+
+	number->m_type = CnxJsonF64;
+	let_mut as_f64 = cnx_decimal_parse_f64(token, length);
+	// the token has already been validated, so the only possible error is that its magnitude is
+	// too large for an `f64`. Its exact text is still available, so report it as an infinity
+	// instead of rejecting it
+	number->m_f64 = cnx_result_is_ok(as_f64) ? cnx_result_unwrap(as_f64) :
+											   (negative ? -HUGE_VAL : HUGE_VAL);
+	return true;
+}
+
+/// @brief Returns whether the given token is the given literal
+__attr(nodiscard) static inline bool
+	is_literal(restrict const_cstring token, usize length, restrict const_cstring literal) {
+	return length == strlen(literal) && memcmp(token, literal, length) == 0;
+}
+
+/// @brief Parses the scalar (number or literal) beginning at `position`
+__attr(nodiscard) static ParseStatus parse_scalar(JsonParser* restrict self, usize position) {
+	let data = self->m_data;
+	let end = position
+			  + cnx_byte_scan_find_any_of(data + position,
+										  self->m_length - position,
+										  &self->m_scalar_terminators);
+	// a quote immediately following a scalar isn't structural, so it must be caught here
+	if(end < self->m_length && data[end] == '"') {
+		return PARSE_INVALID;
+	}
+
+	let token = data + position;
+	let length = end - position;
+	if(is_literal(token, length, "true")) {
+		HANDLE(self, boolean, true);
+	}
+	else if(is_literal(token, length, "false")) {
+		HANDLE(self, boolean, false);
+	}
+	else if(is_literal(token, length, "null")) {
+		HANDLE(self, null_value);
+	}
+	else {
+		let_mut number = (CnxJsonNumber){0};
+		if(!parse_number(token, length, &number)) {
+			return PARSE_INVALID;
+		}
+		HANDLE(self, number, number);
+	}
+
+	return PARSE_SUCCESS;
+}
+
+/// @brief Enters a nested object or array
+__attr(nodiscard) static inline bool push_container(JsonParser* restrict self, bool is_object) {
+	if(self->m_depth == CNX_JSON_MAX_DEPTH) {
+		return false;
+	}
+
+	let bit = static_cast(u64)(1) << (self->m_depth % 64U);
+	if(is_object) {
+		self->m_objects[self->m_depth / 64U] |= bit;
+	}
+	else {
+		self->m_objects[self->m_depth / 64U] &= ~bit;
+	}
+	++self->m_depth;
+	return true;
+}
+
+/// @brief Returns whether the innermost container being parsed is an object
+__attr(nodiscard) static inline bool in_object(const JsonParser* restrict self) {
+	let depth = self->m_depth - 1U;
+	return ((self->m_objects[depth / 64U] >> (depth % 64U)) & 1U) != 0;
+}
+
+/// @brief Returns the byte at the next structural, if there is one, otherwise `'\0'`
+__attr(nodiscard) static inline char peek(const JsonParser* restrict self) {
+	return self->m_next < self->m_index.m_size ?
+			   self->m_data[self->m_index.m_indices[self->m_next]] :
+			   '\0';
+}
+
+/// @brief What the second stage of parsing expects next
+typedef enum ParseState {
+	EXPECT_VALUE,
+	EXPECT_KEY,
+	AFTER_VALUE,
+} ParseState;
+
+/// @brief Walks the structural index of the input, validating it and reporting its contents to
+/// the handler
+__attr(nodiscard) static ParseStatus parse_document(JsonParser* restrict self) {
+	let data = self->m_data;
+	let indices = self->m_index.m_indices;
+	let num_indices = self->m_index.m_size;
+	let_mut state = EXPECT_VALUE;
+
+	loop {
+		switch(state) {
+			case EXPECT_VALUE:
+				{
+					if(self->m_next == num_indices) {
+						return PARSE_INVALID;
+					}
+
+					let position = indices[self->m_next++];
+					let byte = data[position];
+					if(byte == '{') {
+						HANDLE(self, begin_object);
+						if(!push_container(self, true)) {
+							return PARSE_INVALID;
+						}
+						if(peek(self) == '}') {
+							++self->m_next;
+							--self->m_depth;
+							HANDLE(self, end_object);
+							state = AFTER_VALUE;
+						}
+						else {
+							state = EXPECT_KEY;
+						}
+					}
+					else if(byte == '[') {
+						HANDLE(self, begin_array);
+						if(!push_container(self, false)) {
+							return PARSE_INVALID;
+						}
+						if(peek(self) == ']') {
+							++self->m_next;
+							--self->m_depth;
+							HANDLE(self, end_array);
+							state = AFTER_VALUE;
+						}
+					}
+					else if(byte == '"') {
+						let_mut string = cnx_stringview_from_raw(data, 0);
+						if(!parse_string(self, position, &string)) {
+							return PARSE_INVALID;
+						}
+						HANDLE(self, string, string);
+						state = AFTER_VALUE;
+					}
+					else if(byte == '}' || byte == ']' || byte == ':' || byte == ',') {
+						return PARSE_INVALID;
+					}
+					else {
+						let status = parse_scalar(self, position);
+						if(status != PARSE_SUCCESS) {
+							return status;
+						}
+						state = AFTER_VALUE;
+					}
+					break;
+				}
+			case EXPECT_KEY:
+				{
+					if(self->m_next == num_indices) {
+						return PARSE_INVALID;
+					}
+
+					let position = indices[self->m_next++];
+					let_mut key = cnx_stringview_from_raw(data, 0);
+					if(data[position] != '"' || !parse_string(self, position, &key)) {
+						return PARSE_INVALID;
+					}
+					HANDLE(self, key, key);
+
+					if(peek(self) != ':') {
+						return PARSE_INVALID;
+					}
+					++self->m_next;
+					state = EXPECT_VALUE;
+					break;
+				}
+			case AFTER_VALUE:
+				{
+					if(self->m_depth == 0) {
+						// there must be nothing after the top-level value
+						return self->m_next == num_indices ? PARSE_SUCCESS : PARSE_INVALID;
+					}
+
+					if(self->m_next == num_indices) {
+						return PARSE_INVALID;
+					}
+
+					let byte = data[indices[self->m_next++]];
+					let is_object = in_object(self);
+					if(byte == ',') {
+						state = is_object ? EXPECT_KEY : EXPECT_VALUE;
+					}
+					else if(is_object && byte == '}') {
+						--self->m_depth;
+						HANDLE(self, end_object);
+					}
+					else if(!is_object && byte == ']') {
+						--self->m_depth;
+						HANDLE(self, end_array);
+					}
+					else {
+						return PARSE_INVALID;
+					}
+					break;
+				}
+		}
+	}
+}
+
+#undef HANDLE
+
+CnxResult cnx_json_parse_sax_with_allocator(const CnxStringView* restrict input,
+											CnxJsonHandler* restrict handler,
+											CnxAllocator allocator) {
+	let data = input->m_view;
+	let length = input->m_length;
+	if(!cnx_utf8_validate(data, length)) {
+		return Err(i32, cnx_error_new(EINVAL, CNX_POSIX_ERROR_CATEGORY));
+	}
+
+	const char string_specials[] = {'"',  '\\', 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+									0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+									0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+									0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F};
+	const char scalar_terminators[] = {' ', '\t', '\n', '\r', '{', '}', '[', ']', ':', ',', '"'};
+	let_mut parser = (JsonParser){
+		.m_data = data,
+		.m_length = length,
+		.m_next = 0,
+		.m_depth = 0,
+		.m_string_specials = cnx_byte_set_new(string_specials, sizeof(string_specials)),
+		.m_scalar_terminators = cnx_byte_set_new(scalar_terminators, sizeof(scalar_terminators)),
+		.m_scratch = nullptr,
+		.m_scratch_capacity = 0,
+		.m_handler = handler,
+		.m_allocator = allocator,
+	};
+
+	let_mut status = PARSE_INVALID;
+	if(build_structural_index(data, length, &parser.m_index, allocator)) {
+		status = parse_document(&parser);
+	}
+
+	cnx_allocator_deallocate(allocator, parser.m_index.m_indices);
+	if(parser.m_scratch != nullptr) {
+		cnx_allocator_deallocate(allocator, parser.m_scratch);
+	}
+
+	if(status == PARSE_CANCELLED) {
+		return Err(i32, cnx_error_new(ECANCELED, CNX_POSIX_ERROR_CATEGORY));
+	}
+	if(status == PARSE_INVALID) {
+		return Err(i32, cnx_error_new(EINVAL, CNX_POSIX_ERROR_CATEGORY));
+	}
+	return Ok(i32, 0);
+}
+
+/// @brief A block of memory in the arena of a `CnxJsonDocument`
+typedef struct CnxJsonArenaBlock {
+	/// @brief The previously allocated block, if any
+	CnxJsonArenaBlock* m_previous;
+	/// @brief The number of bytes of `m_data` in use
+	usize m_used;
+	/// @brief The number of bytes in `m_data`
+	usize m_capacity;
+	/// @brief The memory of the block
+	// NOLINTNEXTLINE(modernize-avoid-c-arrays)
+	char m_data[];
+} CnxJsonArenaBlock;
+
+/// @brief Allocates `size` bytes, aligned for a `CnxJsonValue`, from the arena of `document`
+__attr(nodiscard) __attr(returns_not_null) static void*
+	arena_allocate(CnxJsonDocument* restrict document, usize size) {
+	let alignment = alignof(CnxJsonValue);
+	size = (size + alignment - 1U) & ~(alignment - 1U);
+
+	let_mut block = document->m_blocks;
+	if(block == nullptr || block->m_capacity - block->m_used < size) {
+		let capacity = size > MIN_ARENA_BLOCK_SIZE ? size : MIN_ARENA_BLOCK_SIZE;
+		block = static_cast(CnxJsonArenaBlock*)(
+			cnx_allocator_allocate(document->m_allocator, sizeof(CnxJsonArenaBlock) + capacity));
+		block->m_previous = document->m_blocks;
+		block->m_used = 0;
+		block->m_capacity = capacity;
+		document->m_blocks = block;
+	}
+
+	let memory = block->m_data + block->m_used;
+	block->m_used += size;
+	return memory;
+}
+
+void cnx_json_document_free(void* restrict self) {
+	let_mut _self = static_cast(CnxJsonDocument*)(self);
+	let_mut block = _self->m_blocks;
+	while(block != nullptr) {
+		let previous = block->m_previous;
+		cnx_allocator_deallocate(_self->m_allocator, block);
+		block = previous;
+	}
+	_self->m_blocks = nullptr;
+	_self->m_root = (CnxJsonValue){.m_type = CnxJsonNull};
+}
+
+/// @brief An array or object being built by the DOM builder
+typedef struct DomFrame {
+	/// @brief The index in the builder's pending values at which this container's begin
+	usize m_start;
+	/// @brief The key of this container in its parent object
+	CnxStringView m_key;
+} DomFrame;
+
+/// @brief The state of building a `CnxJsonDocument`, as a `CnxJsonHandler`
+typedef struct DomBuilder {
+	/// @brief The document being built
+	CnxJsonDocument* m_document;
+	/// @brief The start of the input being parsed
+	const_cstring m_input;
+	/// @brief The length of the input being parsed
+	usize m_length;
+	/// @brief The values of the containers being built, with their keys if they're members
+	CnxJsonMember* m_values;
+	/// @brief The number of values in `m_values`
+	usize m_num_values;
+	/// @brief The capacity of `m_values`
+	usize m_values_capacity;
+	/// @brief The containers being built
+	DomFrame* m_frames;
+	/// @brief The number of frames in `m_frames`
+	usize m_num_frames;
+	/// @brief The capacity of `m_frames`
+	usize m_frames_capacity;
+	/// @brief The key of the next value, if it's a member of an object
+	CnxStringView m_key;
+	/// @brief The allocator to allocate the pending values and frames with
+	CnxAllocator m_allocator;
+} DomBuilder;
+
+/// @brief Returns a copy of `string` with the lifetime of the document being built. Strings in
+/// the input are already long-lived; only unescaped strings need copying into the arena
+__attr(nodiscard) static CnxStringView
+	persist_string(DomBuilder* restrict self, CnxStringView string) {
+	let begin = static_cast(usize)(static_cast(const void*)(self->m_input));
+	let address = static_cast(usize)(static_cast(const void*)(string.m_view));
+	if(address >= begin && address - begin < self->m_length) {
+		return string;
+	}
+
+	if(string.m_length == 0) {
+		return cnx_stringview_from_raw(self->m_input, 0);
+	}
+
+	let copy = static_cast(char*)(arena_allocate(self->m_document, string.m_length));
+	memcpy(copy, string.m_view, string.m_length);
+	return cnx_stringview_from_raw(copy, string.m_length);
+}
+
+/// @brief Adds a completed value to the innermost container being built, or makes it the root
+/// of the document if there is none
+static void push_value(DomBuilder* restrict self, CnxJsonValue value) {
+	if(self->m_num_frames == 0) {
+		self->m_document->m_root = value;
+		return;
+	}
+
+	if(self->m_num_values == self->m_values_capacity) {
+		let capacity = self->m_values_capacity * 2U;
+		self->m_values = cnx_allocator_reallocate_array_t(CnxJsonMember,
+														  self->m_allocator,
+														  self->m_values,
+														  self->m_values_capacity,
+														  capacity);
+		self->m_values_capacity = capacity;
+	}
+
+	self->m_values[self->m_num_values] = (CnxJsonMember){.m_key = self->m_key, .m_value = value};
+	++self->m_num_values;
+}
+
+__attr(nodiscard) static bool dom_null_value(CnxJsonHandler* restrict self) {
+	let builder = static_cast(DomBuilder*)(self->m_self);
+	push_value(builder, (CnxJsonValue){.m_type = CnxJsonNull});
+	return true;
+}
+
+__attr(nodiscard) static bool dom_boolean(CnxJsonHandler* restrict self, bool value) {
+	let builder = static_cast(DomBuilder*)(self->m_self);
+	push_value(builder, (CnxJsonValue){.m_type = CnxJsonBoolean, .m_boolean = value});
+	return true;
+}
+
+__attr(nodiscard) static bool dom_number(CnxJsonHandler* restrict self, CnxJsonNumber value) {
+	let builder = static_cast(DomBuilder*)(self->m_self);
+	let_mut number = (CnxJsonValue){.m_type = value.m_type};
+	if(value.m_type == CnxJsonI64) {
+		number.m_i64 = value.m_i64;
+	}
+	else if(value.m_type == CnxJsonU64) {
+		number.m_u64 = value.m_u64;
+	}
+	else {
+		number.m_f64 = value.m_f64;
+	}
+	push_value(builder, number);
+	return true;
+}
+
+__attr(nodiscard) static bool dom_string(CnxJsonHandler* restrict self, CnxStringView value) {
+	let builder = static_cast(DomBuilder*)(self->m_self);
+	push_value(builder,
+			   (CnxJsonValue){.m_type = CnxJsonString,
+							  .m_string = persist_string(builder, value)});
+	return true;
+}
+
+/// @brief Begins building an array or object
+static void push_frame(DomBuilder* restrict self) {
+	if(self->m_num_frames == self->m_frames_capacity) {
+		let capacity = self->m_frames_capacity * 2U;
+		self->m_frames = cnx_allocator_reallocate_array_t(DomFrame,
+														  self->m_allocator,
+														  self->m_frames,
+														  self->m_frames_capacity,
+														  capacity);
+		self->m_frames_capacity = capacity;
+	}
+
+	self->m_frames[self->m_num_frames]
+		= (DomFrame){.m_start = self->m_num_values, .m_key = self->m_key};
+	++self->m_num_frames;
+}
+
+/// @brief Finishes building the innermost array or object, moving its elements or members into
+/// the arena, returning the number of them and (via `elements`) where they are
+__attr(nodiscard) static usize
+	pop_frame(DomBuilder* restrict self, bool is_object, void** elements) {
+	--self->m_num_frames;
+	let frame = self->m_frames[self->m_num_frames];
+	let size = self->m_num_values - frame.m_start;
+	let pending = self->m_values + frame.m_start;
+
+	*elements = nullptr;
+	if(size != 0 && is_object) {
+		let members = static_cast(CnxJsonMember*)(
+			arena_allocate(self->m_document, size * sizeof(CnxJsonMember)));
+		memcpy(members, pending, size * sizeof(CnxJsonMember));
+		*elements = members;
+	}
+	else if(size != 0) {
+		let values = static_cast(CnxJsonValue*)(
+			arena_allocate(self->m_document, size * sizeof(CnxJsonValue)));
+		for(let_mut i = static_cast(usize)(0); i < size; ++i) {
+			values[i] = pending[i].m_value;
+		}
+		*elements = values;
+	}
+
+	self->m_num_values = frame.m_start;
+	self->m_key = frame.m_key;
+	return size;
+}
+
+__attr(nodiscard) static bool dom_begin_container(CnxJsonHandler* restrict self) {
+	push_frame(static_cast(DomBuilder*)(self->m_self));
+	return true;
+}
+
+__attr(nodiscard) static bool dom_key(CnxJsonHandler* restrict self, CnxStringView key) {
+	let builder = static_cast(DomBuilder*)(self->m_self);
+	builder->m_key = persist_string(builder, key);
+	return true;
+}
+
+__attr(nodiscard) static bool dom_end_object(CnxJsonHandler* restrict self) {
+	let builder = static_cast(DomBuilder*)(self->m_self);
+	void* members = nullptr;
+	let size = pop_frame(builder, true, &members);
+	push_value(builder,
+			   (CnxJsonValue){
+				   .m_type = CnxJsonObject,
+				   .m_object = {.m_members = static_cast(CnxJsonMember*)(members), .m_size = size},
+			   });
+	return true;
+}
+
+__attr(nodiscard) static bool dom_end_array(CnxJsonHandler* restrict self) {
+	let builder = static_cast(DomBuilder*)(self->m_self);
+	void* elements = nullptr;
+	let size = pop_frame(builder, false, &elements);
+	push_value(builder,
+			   (CnxJsonValue){
+				   .m_type = CnxJsonArray,
+				   .m_array = {.m_elements = static_cast(CnxJsonValue*)(elements), .m_size = size},
+			   });
+	return true;
+}
+
+/// @brief Implements `CnxJsonHandler` for building a `CnxJsonDocument`
+__attr(maybe_unused) static ImplTraitFor(CnxJsonHandler,
+										 DomBuilder,
+										 dom_null_value,
+										 dom_boolean,
+										 dom_number,
+										 dom_string,
+										 dom_begin_container,
+										 dom_key,
+										 dom_end_object,
+										 dom_begin_container,
+										 dom_end_array);
+
+CnxResult(CnxJsonDocument)
+	cnx_json_parse_with_allocator(const CnxStringView* restrict input, CnxAllocator allocator) {
+	let_mut document = (CnxJsonDocument){
+		.m_root = {.m_type = CnxJsonNull},
+		.m_blocks = nullptr,
+		.m_allocator = allocator,
+	};
+	let_mut builder = (DomBuilder){
+		.m_document = &document,
+		.m_input = input->m_view,
+		.m_length = input->m_length,
+		.m_values
+		= cnx_allocator_allocate_array_t(CnxJsonMember, allocator, INITIAL_VALUES_CAPACITY),
+		.m_num_values = 0,
+		.m_values_capacity = INITIAL_VALUES_CAPACITY,
+		.m_frames = cnx_allocator_allocate_array_t(DomFrame, allocator, INITIAL_FRAMES_CAPACITY),
+		.m_num_frames = 0,
+		.m_frames_capacity = INITIAL_FRAMES_CAPACITY,
+		.m_key = cnx_stringview_from_raw(input->m_view, 0),
+		.m_allocator = allocator,
+	};
+	let_mut handler = as_trait(CnxJsonHandler, DomBuilder, builder);
+
+	let_mut result = cnx_json_parse_sax_with_allocator(input, &handler, allocator);
+	cnx_allocator_deallocate(allocator, builder.m_values);
+	cnx_allocator_deallocate(allocator, builder.m_frames);
+
+	if(cnx_result_is_err(result)) {
+		cnx_json_document_free(&document);
+		return Err(CnxJsonDocument, cnx_result_unwrap_err(result));
+	}
+
+	return Ok(CnxJsonDocument, document);
+}
+
+CnxOption(i64) cnx_json_value_as_i64(const CnxJsonValue* restrict self) {
+	if(self->m_type == CnxJsonI64) {
+		return Some(i64, self->m_i64);
+	}
+	return None(i64);
+}
+
+CnxOption(u64) cnx_json_value_as_u64(const CnxJsonValue* restrict self) {
+	if(self->m_type == CnxJsonU64) {
+		return Some(u64, self->m_u64);
+	}
+	if(self->m_type == CnxJsonI64 && self->m_i64 >= 0) {
+		return Some(u64, static_cast(u64)(self->m_i64));
+	}
+	return None(u64);
+}
+
+CnxOption(f64) cnx_json_value_as_f64(const CnxJsonValue* restrict self) {
+	switch(self->m_type) {
+		case CnxJsonI64: return Some(f64, static_cast(f64)(self->m_i64));
+		case CnxJsonU64: return Some(f64, static_cast(f64)(self->m_u64));
+		case CnxJsonF64: return Some(f64, self->m_f64);
+		default: return None(f64);
+	}
+}
+
+CnxOption(CnxStringView) cnx_json_value_as_string(const CnxJsonValue* restrict self) {
+	if(self->m_type == CnxJsonString) {
+		return Some(CnxStringView, self->m_string);
+	}
+	return None(CnxStringView);
+}
+
+usize cnx_json_value_size(const CnxJsonValue* restrict self) {
+	if(self->m_type == CnxJsonArray) {
+		return self->m_array.m_size;
+	}
+	if(self->m_type == CnxJsonObject) {
+		return self->m_object.m_size;
+	}
+	return 0;
+}
+
+const CnxJsonValue* cnx_json_value_at(const CnxJsonValue* restrict self, usize index) {
+	if(self->m_type != CnxJsonArray || index >= self->m_array.m_size) {
+		return nullptr;
+	}
+	return &(self->m_array.m_elements[index]);
+}
+
+const CnxJsonMember* cnx_json_value_member_at(const CnxJsonValue* restrict self, usize index) {
+	if(self->m_type != CnxJsonObject || index >= self->m_object.m_size) {
+		return nullptr;
+	}
+	return &(self->m_object.m_members[index]);
+}
+
+const CnxJsonValue*
+cnx_json_value_get(const CnxJsonValue* restrict self, restrict const_cstring key) {
+	if(self->m_type != CnxJsonObject) {
+		return nullptr;
+	}
+
+	let length = strlen(key);
+	for(let_mut i = static_cast(usize)(0); i < self->m_object.m_size; ++i) {
+		let member = &(self->m_object.m_members[i]);
+		if(member->m_key.m_length == length && memcmp(member->m_key.m_view, key, length) == 0) {
+			return &(member->m_value);
+		}
+	}
+	return nullptr;
+}
+
+/// @brief Returns a new `CnxJsonWriter` with no target
+__attr(nodiscard) static inline CnxJsonWriter new_writer(void) {
+	return (CnxJsonWriter){
+		.m_string = nullptr,
+		.m_file = nullptr,
+		.m_depth = 0,
+		.m_objects = {0},
+		.m_needs_comma = false,
+		.m_after_key = false,
+		.m_complete = false,
+	};
+}
+
+CnxJsonWriter cnx_json_writer_new_string(CnxString* restrict string) {
+	let_mut writer = new_writer();
+	writer.m_string = string;
+	return writer;
+}
+
+CnxJsonWriter cnx_json_writer_new_file(CnxFile* restrict file) {
+	let_mut writer = new_writer();
+	writer.m_file = file;
+	return writer;
+}
+
+/// @brief Writes the given bytes to the target of `self`, storing the error in `result` on failure
+///
+/// @return whether the bytes were written
+__attr(nodiscard) static inline bool write_bytes(CnxJsonWriter* restrict self,
+												 restrict const_cstring bytes,
+												 usize length,
+												 CnxResult* restrict result) {
+	if(length == 0) {
+		return true;
+	}
+
+	if(self->m_string != nullptr) {
+		cnx_string_append_cstring(self->m_string, bytes, length);
+		return true;
+	}
+
+	let_mut written
+		= cnx_file_write_bytes(self->m_file,
+							   static_cast(const u8*)(static_cast(const void*)(bytes)),
+							   length);
+	if(cnx_result_is_err(written)) {
+		*result = written;
+		return false;
+	}
+
+	return true;
+}
+
+/// @brief Returns whether the innermost container being written is an object
+__attr(nodiscard) static inline bool writing_object(const CnxJsonWriter* restrict self) {
+	let depth = self->m_depth - 1U;
+	return self->m_depth != 0 && ((self->m_objects[depth / 64U] >> (depth % 64U)) & 1U) != 0;
+}
+
+/// @brief Validates that a value can be written next, and writes the separator preceding it
+__attr(nodiscard) static bool
+	begin_value(CnxJsonWriter* restrict self, CnxResult* restrict result) {
+	cnx_assert(!self->m_complete, "Can't write more than one top-level JSON value");
+	if(writing_object(self)) {
+		cnx_assert(self->m_after_key, "The key of a JSON object member must be written first");
+		// the separator was written before the key
+		self->m_after_key = false;
+		return true;
+	}
+
+	return !self->m_needs_comma || write_bytes(self, ",", 1U, result);
+}
+
+/// @brief Records that a complete value has been written
+static inline void end_value(CnxJsonWriter* restrict self) {
+	if(self->m_depth == 0) {
+		self->m_complete = true;
+	}
+	else {
+		self->m_needs_comma = true;
+	}
+}
+
+/// @brief Writes the given string, quoted and escaped
+__attr(nodiscard) static bool write_escaped(CnxJsonWriter* restrict self,
+											restrict const_cstring data,
+											usize length,
+											CnxResult* restrict result) {
+	const char specials[] = {'"',  '\\', 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+							 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+							 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+							 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F};
+	static const char hex_digits[] = "0123456789abcdef";
+
+	if(!write_bytes(self, "\"", 1U, result)) {
+		return false;
+	}
+
+	// most strings need no escaping, so avoid building the byte set for short strings that don't
+	let_mut position = static_cast(usize)(0);
+	let_mut set = (CnxByteSet){0};
+	let_mut has_set = false;
+	loop {
+		let_mut index = position;
+		// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+		if(length - position < 32U) {
+			for(; index < length; ++index) {
+				let byte = static_cast(u8)(data[index]);
+				// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+				if(byte < 0x20U || byte == '"' || byte == '\\') {
+					break;
+				}
+			}
+		}
+		else {
+			if(!has_set) {
+				set = cnx_byte_set_new(specials, sizeof(specials));
+				has_set = true;
+			}
+			index += cnx_byte_scan_find_any_of(data + position, length - position, &set);
+		}
+
+		if(!write_bytes(self, data + position, index - position, result)) {
+			return false;
+		}
+		if(index == length) {
+			break;
+		}
+
+		let byte = static_cast(u8)(data[index]);
+		char escape[6] = {'\\', 0, 0, 0, 0, 0};
+		let_mut escape_length = static_cast(usize)(2);
+		switch(byte) {
+			case '"': escape[1] = '"'; break;
+			case '\\': escape[1] = '\\'; break;
+			case '\b': escape[1] = 'b'; break;
+			case '\f': escape[1] = 'f'; break;
+			case '\n': escape[1] = 'n'; break;
+			case '\r': escape[1] = 'r'; break;
+			case '\t': escape[1] = 't'; break;
+			default:
+				escape[1] = 'u';
+				escape[2] = '0';
+				escape[3] = '0';
+				escape[4] = hex_digits[byte >> 4U];
+				escape[5] = hex_digits[byte & 0xFU]; // NOLINT(readability-magic-numbers)
+				escape_length = sizeof(escape);
+				break;
+		}
+		if(!write_bytes(self, escape, escape_length, result)) {
+			return false;
+		}
+		position = index + 1U;
+	}
+
+	return write_bytes(self, "\"", 1U, result);
+}
+
+/// @brief Begins an object or array
+__attr(nodiscard) static CnxResult
+	begin_container(CnxJsonWriter* restrict self, bool is_object, char opening) {
+	let_mut result = Ok(i32, 0);
+	if(!begin_value(self, &result)) {
+		return result;
+	}
+
+	cnx_assert(self->m_depth < CNX_JSON_MAX_DEPTH,
+			   "Can't write JSON nested deeper than CNX_JSON_MAX_DEPTH");
+	let bit = static_cast(u64)(1) << (self->m_depth % 64U);
+	if(is_object) {
+		self->m_objects[self->m_depth / 64U] |= bit;
+	}
+	else {
+		self->m_objects[self->m_depth / 64U] &= ~bit;
+	}
+	++self->m_depth;
+	self->m_needs_comma = false;
+
+	ignore(write_bytes(self, &opening, 1U, &result));
+	return result;
+}
+
+/// @brief Ends the innermost object or array
+__attr(nodiscard) static CnxResult
+	end_container(CnxJsonWriter* restrict self, __attr(maybe_unused) bool is_object, char closing) {
+	cnx_assert(self->m_depth != 0 && writing_object(self) == is_object,
+			   "Can't end a JSON object or array that hasn't begun");
+	cnx_assert(!self->m_after_key, "Can't end a JSON object before writing its last value");
+
+	--self->m_depth;
+	end_value(self);
+	let_mut result = Ok(i32, 0);
+	ignore(write_bytes(self, &closing, 1U, &result));
+	return result;
+}
+
+CnxResult cnx_json_writer_begin_object(CnxJsonWriter* restrict self) {
+	return begin_container(self, true, '{');
+}
+
+CnxResult cnx_json_writer_end_object(CnxJsonWriter* restrict self) {
+	return end_container(self, true, '}');
+}
+
+CnxResult cnx_json_writer_begin_array(CnxJsonWriter* restrict self) {
+	return begin_container(self, false, '[');
+}
+
+CnxResult cnx_json_writer_end_array(CnxJsonWriter* restrict self) {
+	return end_container(self, false, ']');
+}
+
+CnxResult cnx_json_writer_key(CnxJsonWriter* restrict self, const CnxStringView* restrict key) {
+	cnx_assert(writing_object(self) && !self->m_after_key,
+			   "A JSON key can only be written in an object, before each value");
+
+	let_mut result = Ok(i32, 0);
+	if(self->m_needs_comma && !write_bytes(self, ",", 1U, &result)) {
+		return result;
+	}
+	if(!write_escaped(self, key->m_view, key->m_length, &result)
+	   || !write_bytes(self, ":", 1U, &result))
+	{
+		return result;
+	}
+
+	self->m_needs_comma = false;
+	self->m_after_key = true;
+	return result;
+}
+
+CnxResult cnx_json_writer_key_cstring(CnxJsonWriter* restrict self, restrict const_cstring key) {
+	let view = cnx_stringview_from_raw(key, strlen(key));
+	return cnx_json_writer_key(self, &view);
+}
+
+/// @brief Writes the given pre-formatted scalar as a value
+__attr(nodiscard) static CnxResult
+	write_scalar(CnxJsonWriter* restrict self, restrict const_cstring scalar, usize length) {
+	let_mut result = Ok(i32, 0);
+	if(begin_value(self, &result) && write_bytes(self, scalar, length, &result)) {
+		end_value(self);
+	}
+	return result;
+}
+
+CnxResult cnx_json_writer_write_null(CnxJsonWriter* restrict self) {
+	return write_scalar(self, "null", 4U);
+}
+
+CnxResult cnx_json_writer_write_bool(CnxJsonWriter* restrict self, bool value) {
+	return value ? write_scalar(self, "true", 4U) : write_scalar(self, "false", 5U);
+}
+
+CnxResult cnx_json_writer_write_i64(CnxJsonWriter* restrict self, i64 value) {
+	char buffer[CNX_DECIMAL_MAX_INTEGER_LENGTH];
+	return write_scalar(self, buffer, cnx_decimal_format_i64(value, buffer));
+}
+
+CnxResult cnx_json_writer_write_u64(CnxJsonWriter* restrict self, u64 value) {
+	char buffer[CNX_DECIMAL_MAX_INTEGER_LENGTH];
+	return write_scalar(self, buffer, cnx_decimal_format_u64(value, buffer));
+}
+
+CnxResult cnx_json_writer_write_f64(CnxJsonWriter* restrict self, f64 value) {
+	if(!cnx_decimal_is_finite(value)) {
+		return cnx_json_writer_write_null(self);
+	}
+
+	char buffer[CNX_DECIMAL_MAX_FLOAT_LENGTH];
+	return write_scalar(self, buffer, cnx_decimal_format_f64(value, buffer));
+}
+
+CnxResult
+cnx_json_writer_write_string(CnxJsonWriter* restrict self, const CnxStringView* restrict value) {
+	let_mut result = Ok(i32, 0);
+	if(begin_value(self, &result) && write_escaped(self, value->m_view, value->m_length, &result))
+	{
+		end_value(self);
+	}
+	return result;
+}
+
+CnxResult
+cnx_json_writer_write_cstring(CnxJsonWriter* restrict self, restrict const_cstring value) {
+	let view = cnx_stringview_from_raw(value, strlen(value));
+	return cnx_json_writer_write_string(self, &view);
+}
+
+CnxResult
+cnx_json_writer_write_value(CnxJsonWriter* restrict self, const CnxJsonValue* restrict value) {
+	switch(value->m_type) {
+		case CnxJsonNull: return cnx_json_writer_write_null(self);
+		case CnxJsonBoolean: return cnx_json_writer_write_bool(self, value->m_boolean);
+		case CnxJsonI64: return cnx_json_writer_write_i64(self, value->m_i64);
+		case CnxJsonU64: return cnx_json_writer_write_u64(self, value->m_u64);
+		case CnxJsonF64: return cnx_json_writer_write_f64(self, value->m_f64);
+		case CnxJsonString: return cnx_json_writer_write_string(self, &(value->m_string));
+		case CnxJsonArray:
+			{
+				let_mut result = cnx_json_writer_begin_array(self);
+				for(let_mut i = static_cast(usize)(0);
+					i < value->m_array.m_size && cnx_result_is_ok(result);
+					++i)
+				{
+					result = cnx_json_writer_write_value(self, &(value->m_array.m_elements[i]));
+				}
+				return cnx_result_is_ok(result) ? cnx_json_writer_end_array(self) : result;
+			}
+		case CnxJsonObject:
+			{
+				let_mut result = cnx_json_writer_begin_object(self);
+				for(let_mut i = static_cast(usize)(0);
+					i < value->m_object.m_size && cnx_result_is_ok(result);
+					++i)
+				{
+					let member = &(value->m_object.m_members[i]);
+					result = cnx_json_writer_key(self, &(member->m_key));
+					if(cnx_result_is_ok(result)) {
+						result = cnx_json_writer_write_value(self, &(member->m_value));
+					}
+				}
+				return cnx_result_is_ok(result) ? cnx_json_writer_end_object(self) : result;
+			}
+	}
+
+	cnx_assert(false, "Invalid CnxJsonType");
+	return Ok(i32, 0);
+}
+
+CnxFormatContext
+cnx_json_value_is_specifier_valid(__attr(maybe_unused) const CnxFormat* restrict self,
+								  CnxStringView specifier) {
+	let_mut context = (CnxFormatContext){.is_valid = CNX_FORMAT_SUCCESS};
+	if(cnx_stringview_length(specifier) != 0) {
+		context.is_valid = CNX_FORMAT_BAD_SPECIFIER_INVALID_CHAR_IN_SPECIFIER;
+	}
+	return context;
+}
+
+CnxString cnx_json_value_format(const CnxFormat* restrict self, CnxFormatContext context) {
+	return cnx_json_value_format_with_allocator(self, context, DEFAULT_ALLOCATOR);
+}
+
+CnxString cnx_json_value_format_with_allocator(const CnxFormat* restrict self,
+											   __attr(maybe_unused) CnxFormatContext context,
+											   CnxAllocator allocator) {
+	cnx_assert(context.is_valid == CNX_FORMAT_SUCCESS,
+			   "Invalid format specifier used to format a CnxJsonValue");
+
+	let _self = static_cast(const CnxJsonValue*)(self->m_self);
+	let_mut string = cnx_string_new_with_allocator(allocator);
+	let_mut writer = cnx_json_writer_new_string(&string);
+	// writing to a string can't fail
+	ignore(cnx_json_writer_write_value(&writer, _self));
+	return string;
+}
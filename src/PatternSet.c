@@ -0,0 +1,462 @@
+/// @file PatternSet.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief CnxPatternSet provides single-pass multi-pattern search and replacement over strings
+/// and `CnxFile` streams
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <Cnx/Assert.h>
+#include <Cnx/PatternSet.h>
+#include <memory.h>
+
+#define OPTION_UNDEF_PARAMS TRUE
+
+/// @brief Declares `CnxOption(T)` for `CnxPatternMatch`
+#define OPTION_T	CnxPatternMatch
+#define OPTION_IMPL TRUE
+#include <Cnx/Option.h> // NOLINT(readability-duplicate-include)
+
+#undef OPTION_UNDEF_PARAMS
+
+#undef cnx_pattern_set_free
+#undef cnx_pattern_set_size
+#undef cnx_pattern_matcher_free
+#undef cnx_pattern_matcher_next
+#undef cnx_pattern_matcher_status
+#undef cnx_stringview_replace_all_with_allocator
+#undef cnx_string_replace_all
+#undef cnx_string_replace_all_with_allocator
+
+/// @brief The start state of the automaton. Also used to mean "no state" in output links, since
+/// the start state never has an output
+#define START_STATE 0U
+/// @brief Sentinel in `m_outputs` for states that no pattern ends at
+#define NO_PATTERN (cnx_max_value(u32))
+
+__attr(always_inline) __attr(nodiscard) static inline u32
+	next_state(const CnxPatternSet* restrict set, u32 state, u8 byte) {
+	return set->m_transitions[static_cast(usize)(state) * set->m_num_classes
+							  + set->m_classes[byte]];
+}
+
+/// @brief Returns the first state to report an output for after entering `state`: `state` itself
+/// if a pattern ends at it, otherwise its output link
+__attr(always_inline) __attr(nodiscard) static inline u32
+	first_output(const CnxPatternSet* restrict set, u32 state) {
+	return set->m_outputs[state] != NO_PATTERN ? state : set->m_output_links[state];
+}
+
+/// @brief Returns the number of bytes from the start of `data` that can be skipped while in the
+/// start state, because they can't begin a pattern
+__attr(always_inline) __attr(nodiscard) static inline usize
+	skip_to_candidate(const CnxPatternSet* restrict set, const u8* restrict data, usize length) {
+	if(!set->m_use_prefilter) {
+		return 0;
+	}
+
+	return cnx_byte_scan_find_any_of(static_cast(const_cstring)(static_cast(const void*)(data)),
+									 length,
+									 &(set->m_first_bytes));
+}
+
+/// @brief Computes the byte equivalence classes and first bytes of `patterns` into `set`
+static void compute_classes(CnxPatternSet* restrict set,
+							const CnxStringView* restrict patterns,
+							usize num_patterns) {
+	bool used[256] = {0}; // NOLINT(readability-magic-numbers)
+	bool first[256] = {0}; // NOLINT(readability-magic-numbers)
+	for(let_mut i = static_cast(usize)(0); i < num_patterns; ++i) {
+		let pattern = static_cast(const u8*)(static_cast(const void*)(patterns[i].m_view));
+		cnx_assert(patterns[i].m_length != 0, "CnxPatternSet patterns must not be empty");
+		first[pattern[0]] = true;
+		for(let_mut j = static_cast(usize)(0); j < patterns[i].m_length; ++j) {
+			used[pattern[j]] = true;
+		}
+	}
+
+	char first_bytes[256]; // NOLINT(readability-magic-numbers)
+	let_mut num_first_bytes = static_cast(usize)(0);
+	// class 0 is shared by every byte that doesn't occur in any pattern
+	set->m_num_classes = 1;
+	for(let_mut byte = 0U; byte < 256U; ++byte) { // NOLINT(readability-magic-numbers)
+		set->m_classes[byte] = used[byte] ? static_cast(u16)(set->m_num_classes++) : 0U;
+		if(first[byte]) {
+			first_bytes[num_first_bytes++] = static_cast(char)(byte);
+		}
+	}
+
+	set->m_first_bytes = cnx_byte_set_new(first_bytes, num_first_bytes);
+	set->m_use_prefilter = num_first_bytes <= CNX_PATTERN_SET_PREFILTER_MAX_BYTES;
+}
+
+/// @brief Builds the trie of `patterns` into `set`'s transition table, returning the number of
+/// states. Missing edges are left as `START_STATE`, which is never the target of a trie edge
+static usize build_trie(CnxPatternSet* restrict set,
+						const CnxStringView* restrict patterns,
+						usize num_patterns) {
+	let_mut num_states = static_cast(usize)(1);
+	for(let_mut i = static_cast(usize)(0); i < num_patterns; ++i) {
+		let pattern = static_cast(const u8*)(static_cast(const void*)(patterns[i].m_view));
+		let_mut state = START_STATE;
+		for(let_mut j = static_cast(usize)(0); j < patterns[i].m_length; ++j) {
+			let edge = static_cast(usize)(state) * set->m_num_classes + set->m_classes[pattern[j]];
+			if(set->m_transitions[edge] == START_STATE) {
+				set->m_transitions[edge] = static_cast(u32)(num_states++);
+			}
+			state = set->m_transitions[edge];
+		}
+
+		if(set->m_outputs[state] == NO_PATTERN) {
+			set->m_outputs[state] = static_cast(u32)(i);
+		}
+	}
+
+	return num_states;
+}
+
+/// @brief Resolves the failure transitions of `set`'s trie, in breadth-first order, into a
+/// complete transition table, and computes the output links
+static void resolve_failures(CnxPatternSet* restrict set) {
+	let num_classes = set->m_num_classes;
+	let transitions = set->m_transitions;
+	let failures = cnx_allocator_allocate_array_t(u32, set->m_allocator, set->m_num_states);
+	let queue = cnx_allocator_allocate_array_t(u32, set->m_allocator, set->m_num_states);
+	let_mut queue_front = static_cast(usize)(0);
+	let_mut queue_back = static_cast(usize)(0);
+
+	failures[START_STATE] = START_STATE;
+	set->m_output_links[START_STATE] = START_STATE;
+	for(let_mut class = static_cast(usize)(0); class < num_classes; ++class) {
+		let child = transitions[class];
+		if(child != START_STATE) {
+			failures[child] = START_STATE;
+			set->m_output_links[child] = START_STATE;
+			queue[queue_back++] = child;
+		}
+	}
+
+	while(queue_front < queue_back) {
+		let state = queue[queue_front++];
+		let row = static_cast(usize)(state) * num_classes;
+		let failure_row = static_cast(usize)(failures[state]) * num_classes;
+		for(let_mut class = static_cast(usize)(0); class < num_classes; ++class) {
+			let child = transitions[row + class];
+			// the failure state is shallower, so its row has already been resolved
+			let fallback = transitions[failure_row + class];
+			if(child == START_STATE) {
+				transitions[row + class] = fallback;
+				continue;
+			}
+
+			failures[child] = fallback;
+			set->m_output_links[child] = set->m_outputs[fallback] != NO_PATTERN ?
+											 fallback :
+											 set->m_output_links[fallback];
+			queue[queue_back++] = child;
+		}
+	}
+
+	cnx_allocator_deallocate(set->m_allocator, queue);
+	cnx_allocator_deallocate(set->m_allocator, failures);
+}
+
+CnxPatternSet cnx_pattern_set_new_with_allocator(const CnxStringView* restrict patterns,
+												 usize num_patterns,
+												 CnxAllocator allocator) {
+	let_mut total_length = static_cast(usize)(0);
+	let_mut max_length = static_cast(usize)(0);
+	for(let_mut i = static_cast(usize)(0); i < num_patterns; ++i) {
+		total_length += patterns[i].m_length;
+		max_length = patterns[i].m_length > max_length ? patterns[i].m_length : max_length;
+	}
+	cnx_assert(total_length < static_cast(usize)(cnx_max_value(u32)) && num_patterns < NO_PATTERN,
+			   "CnxPatternSet patterns too large");
+
+	CnxPatternSet set = {
+		.m_classes = cnx_allocator_allocate_array_t(u16, allocator, 256), // NOLINT
+		.m_num_patterns = num_patterns,
+		.m_max_pattern_length = max_length,
+		.m_allocator = allocator,
+	};
+	compute_classes(&set, patterns, num_patterns);
+
+	// the trie has at most one state per pattern byte, plus the start state
+	let max_states = total_length + 1;
+	set.m_transitions
+		= cnx_allocator_allocate_array_t(u32, allocator, max_states * set.m_num_classes);
+	memset(set.m_transitions, 0, max_states * set.m_num_classes * sizeof(u32));
+	set.m_outputs = cnx_allocator_allocate_array_t(u32, allocator, max_states);
+	memset(set.m_outputs, 0xFF, max_states * sizeof(u32)); // NOLINT(readability-magic-numbers)
+	set.m_num_states = build_trie(&set, patterns, num_patterns);
+
+	if(set.m_num_states < max_states) {
+		set.m_transitions = cnx_allocator_reallocate_array_t(u32,
+															 allocator,
+															 set.m_transitions,
+															 max_states * set.m_num_classes,
+															 set.m_num_states * set.m_num_classes);
+		set.m_outputs = cnx_allocator_reallocate_array_t(u32,
+														 allocator,
+														 set.m_outputs,
+														 max_states,
+														 set.m_num_states);
+	}
+	set.m_output_links = cnx_allocator_allocate_array_t(u32, allocator, set.m_num_states);
+	resolve_failures(&set);
+
+	set.m_pattern_lengths = cnx_allocator_allocate_array_t(usize,
+														   allocator,
+														   num_patterns != 0 ? num_patterns : 1);
+	for(let_mut i = static_cast(usize)(0); i < num_patterns; ++i) {
+		set.m_pattern_lengths[i] = patterns[i].m_length;
+	}
+
+	return set;
+}
+
+void cnx_pattern_set_free(void* restrict self) {
+	let set = static_cast(CnxPatternSet*)(self);
+	cnx_allocator_deallocate(set->m_allocator, set->m_transitions);
+	cnx_allocator_deallocate(set->m_allocator, set->m_outputs);
+	cnx_allocator_deallocate(set->m_allocator, set->m_output_links);
+	cnx_allocator_deallocate(set->m_allocator, set->m_pattern_lengths);
+	cnx_allocator_deallocate(set->m_allocator, set->m_classes);
+	*set = (CnxPatternSet){0};
+}
+
+usize cnx_pattern_set_size(const CnxPatternSet* restrict self) {
+	return self->m_num_patterns;
+}
+
+/// @brief Finds the leftmost-longest match in `data` starting at or after `start`
+static bool find_leftmost_longest(const CnxPatternSet* restrict set,
+								  const u8* restrict data,
+								  usize length,
+								  usize start,
+								  CnxPatternMatch* restrict match) {
+	let_mut found = false;
+	let_mut state = START_STATE;
+	let_mut position = start;
+	while(position < length) {
+		if(state == START_STATE && !found) {
+			position += skip_to_candidate(set, data + position, length - position);
+			if(position == length) {
+				break;
+			}
+		}
+
+		state = next_state(set, state, data[position]);
+		++position;
+		for(let_mut output = first_output(set, state); output != START_STATE;
+			output = set->m_output_links[output])
+		{
+			let pattern = set->m_outputs[output];
+			let pattern_length = set->m_pattern_lengths[pattern];
+			let match_start = position - pattern_length;
+			if(!found || match_start < match->m_start
+			   || (match_start == match->m_start && pattern_length > match->m_length))
+			{
+				*match = (CnxPatternMatch){.m_pattern = pattern,
+										   .m_start = match_start,
+										   .m_length = pattern_length};
+				found = true;
+			}
+		}
+
+		// any later match would start after the current best one, so it can't be preferred
+		if(found && position + 1 > match->m_start + set->m_max_pattern_length) {
+			break;
+		}
+	}
+
+	return found;
+}
+
+CnxOption(CnxPatternMatch) cnx_pattern_set_find_first_cstring(const CnxPatternSet* restrict self,
+															  restrict const_cstring haystack,
+															  usize haystack_length) {
+	CnxPatternMatch match = {0};
+	if(find_leftmost_longest(self,
+							 static_cast(const u8*)(static_cast(const void*)(haystack)),
+							 haystack_length,
+							 0,
+							 &match))
+	{
+		return Some(CnxPatternMatch, match);
+	}
+
+	return None(CnxPatternMatch);
+}
+
+CnxPatternMatcher cnx_pattern_matcher_new_cstring(const CnxPatternSet* restrict set,
+												  restrict const_cstring haystack,
+												  usize haystack_length) {
+	return (CnxPatternMatcher){
+		.m_set = set,
+		.m_data = static_cast(const u8*)(static_cast(const void*)(haystack)),
+		.m_length = haystack_length,
+		.m_state = START_STATE,
+		.m_pending = START_STATE,
+		.m_status = Ok(i32, 0),
+	};
+}
+
+CnxPatternMatcher cnx_pattern_matcher_from_file(const CnxPatternSet* restrict set,
+												CnxFile* restrict file,
+												usize buffer_size) {
+	cnx_assert(buffer_size != 0, "CnxPatternMatcher buffer size must not be zero");
+	let buffer = cnx_allocator_allocate_array_t(u8, set->m_allocator, buffer_size);
+	return (CnxPatternMatcher){
+		.m_set = set,
+		.m_data = buffer,
+		.m_state = START_STATE,
+		.m_pending = START_STATE,
+		.m_file = file,
+		.m_buffer = buffer,
+		.m_buffer_size = buffer_size,
+		.m_status = Ok(i32, 0),
+	};
+}
+
+void cnx_pattern_matcher_free(void* restrict self) {
+	let matcher = static_cast(CnxPatternMatcher*)(self);
+	if(matcher->m_buffer != nullptr) {
+		cnx_allocator_deallocate(matcher->m_set->m_allocator, matcher->m_buffer);
+		matcher->m_buffer = nullptr;
+	}
+}
+
+/// @brief Reads the next chunk of the matcher's file into its buffer. Returns whether any bytes
+/// were read
+static bool refill(CnxPatternMatcher* restrict self) {
+	if(self->m_file == nullptr || cnx_result_is_err(self->m_status)) {
+		return false;
+	}
+
+	let_mut read = cnx_file_read_bytes(self->m_file, self->m_buffer, self->m_buffer_size);
+	if(cnx_result_is_err(read)) {
+		self->m_status = Err(i32, cnx_result_unwrap_err(read));
+		return false;
+	}
+
+	let num_read = cnx_result_unwrap(read);
+	if(num_read == 0) {
+		return false;
+	}
+
+	self->m_offset += self->m_length;
+	self->m_length = num_read;
+	self->m_position = 0;
+	return true;
+}
+
+CnxOption(CnxPatternMatch) cnx_pattern_matcher_next(CnxPatternMatcher* restrict self) {
+	let set = self->m_set;
+	while(self->m_pending == START_STATE) {
+		if(self->m_position == self->m_length && !refill(self)) {
+			return None(CnxPatternMatch);
+		}
+
+		if(self->m_state == START_STATE) {
+			self->m_position += skip_to_candidate(set,
+												  self->m_data + self->m_position,
+												  self->m_length - self->m_position);
+			if(self->m_position == self->m_length) {
+				continue;
+			}
+		}
+
+		self->m_state = next_state(set, self->m_state, self->m_data[self->m_position]);
+		++self->m_position;
+		self->m_pending = first_output(set, self->m_state);
+	}
+
+	let output = self->m_pending;
+	self->m_pending = set->m_output_links[output];
+	let pattern = set->m_outputs[output];
+	let pattern_length = set->m_pattern_lengths[pattern];
+	let match = (CnxPatternMatch){.m_pattern = pattern,
+								  .m_start = self->m_offset + self->m_position - pattern_length,
+								  .m_length = pattern_length};
+	return Some(CnxPatternMatch, match);
+}
+
+CnxResult cnx_pattern_matcher_status(const CnxPatternMatcher* restrict self) {
+	return self->m_status;
+}
+
+/// @brief Appends `length` bytes of `data` to `string`, if there are any.
+/// `cnx_string_append_cstring` requires spare capacity even when appending nothing, which a string
+/// exactly sized for the result won't have once it's full
+__attr(always_inline) static inline void
+	append_if_not_empty(CnxString* restrict string, restrict const_cstring data, usize length) {
+	if(length != 0) {
+		cnx_string_append_cstring(string, data, length);
+	}
+}
+
+CnxString cnx_stringview_replace_all_with_allocator(const CnxStringView* restrict self,
+													const CnxPatternSet* restrict patterns,
+													const CnxStringView* restrict replacements,
+													CnxAllocator allocator) {
+	let data = static_cast(const u8*)(static_cast(const void*)(self->m_view));
+	let length = self->m_length;
+
+	// size the result first, so it's built with a single allocation
+	let_mut result_length = length;
+	CnxPatternMatch match = {0};
+	for(let_mut position = static_cast(usize)(0);
+		find_leftmost_longest(patterns, data, length, position, &match);
+		position = match.m_start + match.m_length)
+	{
+		result_length = result_length - match.m_length + replacements[match.m_pattern].m_length;
+	}
+
+	let_mut result = cnx_string_new_with_capacity_with_allocator(result_length, allocator);
+	let_mut position = static_cast(usize)(0);
+	while(find_leftmost_longest(patterns, data, length, position, &match)) {
+		let replacement = replacements + match.m_pattern;
+		append_if_not_empty(&result, self->m_view + position, match.m_start - position);
+		append_if_not_empty(&result, replacement->m_view, replacement->m_length);
+		position = match.m_start + match.m_length;
+	}
+	append_if_not_empty(&result, self->m_view + position, length - position);
+
+	return result;
+}
+
+CnxString cnx_string_replace_all(const CnxString* restrict self,
+								 const CnxPatternSet* restrict patterns,
+								 const CnxStringView* restrict replacements) {
+	return cnx_string_replace_all_with_allocator(self, patterns, replacements, self->m_allocator);
+}
+
+CnxString cnx_string_replace_all_with_allocator(const CnxString* restrict self,
+												const CnxPatternSet* restrict patterns,
+												const CnxStringView* restrict replacements,
+												CnxAllocator allocator) {
+	let view = cnx_string_into_stringview(*self);
+	return cnx_stringview_replace_all_with_allocator(&view, patterns, replacements, allocator);
+}
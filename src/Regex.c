@@ -0,0 +1,1558 @@
+/// @file Regex.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief CnxRegex provides compiled regular expressions for matching `CnxStringView`s
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <Cnx/Assert.h>
+#include <Cnx/Regex.h>
+#include <memory.h>
+
+#define RESULT_T	CnxRegex
+#define RESULT_IMPL TRUE
+// NOLINTNEXTLINE(readability-duplicate-include)
+#include <Cnx/Result.h>
+#undef RESULT_T
+#undef RESULT_IMPL
+
+#undef cnx_regex_free
+#undef cnx_regex_group_count
+#undef cnx_regex_is_match
+#undef cnx_regex_is_full_match
+#undef cnx_regex_find_at
+#undef cnx_regex_captures_at
+
+/// @brief The maximum nesting depth of groups and repetitions in a pattern
+#define MAX_DEPTH 256U
+/// @brief The maximum number of capture groups in a pattern, including group `0`
+#define MAX_GROUPS 256U
+/// @brief The maximum count in a counted repetition
+#define MAX_REPETITION 1000U
+/// @brief `m_max` of an unbounded repetition
+#define UNBOUNDED (cnx_max_value(u32))
+/// @brief The value of capture slots that haven't been set
+#define NO_POSITION (cnx_max_value(usize))
+/// @brief The number of times the DFA cache can be cleared in a single search before the search
+/// falls back to the Pike VM, because the DFA is no longer making efficient progress
+#define MAX_CACHE_CLEARS 8U
+
+typedef enum RegexOpcode {
+	/// @brief Consume a byte in the set `m_argument`, then continue at `m_next`
+	OP_BYTES = 0,
+	/// @brief Continue at both `m_next` (preferred) and `m_argument`
+	OP_SPLIT,
+	/// @brief Continue at `m_next`
+	OP_JUMP,
+	/// @brief Record the current position in capture slot `m_argument`, then continue at `m_next`
+	OP_SAVE,
+	/// @brief Continue at `m_next` only at the beginning of the input
+	OP_ASSERT_START,
+	/// @brief Continue at `m_next` only at the end of the input
+	OP_ASSERT_END,
+	/// @brief The pattern has matched
+	OP_MATCH,
+} RegexOpcode;
+
+typedef enum RegexStateFlags {
+	/// @brief The state contains a match
+	STATE_MATCH = 1U,
+	/// @brief The state contains a match if the input ends in it
+	STATE_END_MATCH = 2U,
+	/// @brief No match is possible from the state
+	STATE_DEAD = 4U,
+} RegexStateFlags;
+
+__attr(nodiscard) __attr(returns_not_null) const_cstring
+	cnx_regex_category_get_message(__attr(maybe_unused) const CnxErrorCategory* restrict self,
+								   i64 error_code) {
+	if(error_code == CNX_REGEX_SUCCESS) {
+		return "No error: Regex compiled successfully";
+	}
+	else if(error_code == CNX_REGEX_UNMATCHED_PARENTHESIS) {
+		return "Error: Unmatched parenthesis in regex";
+	}
+	else if(error_code == CNX_REGEX_UNCLOSED_CLASS) {
+		return "Error: Unclosed byte class in regex";
+	}
+	else if(error_code == CNX_REGEX_INVALID_RANGE) {
+		return "Error: Invalid range in regex byte class";
+	}
+	else if(error_code == CNX_REGEX_INVALID_ESCAPE) {
+		return "Error: Invalid escape sequence in regex";
+	}
+	else if(error_code == CNX_REGEX_NOTHING_TO_REPEAT) {
+		return "Error: Repetition operator with nothing to repeat in regex";
+	}
+	else if(error_code == CNX_REGEX_INVALID_REPETITION) {
+		return "Error: Invalid counted repetition in regex";
+	}
+	else if(error_code == CNX_REGEX_TOO_LARGE) {
+		return "Error: Regex is too large to compile";
+	}
+	unreachable();
+}
+
+__attr(nodiscard) i64
+	cnx_regex_category_get_last_error(__attr(maybe_unused) const CnxErrorCategory* restrict self) {
+	return 0;
+}
+
+typedef struct CnxRegexErrorCategory {
+} CnxRegexErrorCategory;
+
+__attr(maybe_unused) static ImplTraitFor(CnxErrorCategory,
+										 CnxRegexErrorCategory,
+										 cnx_regex_category_get_message,
+										 cnx_regex_category_get_last_error);
+
+__attr(maybe_unused) static const CnxRegexErrorCategory cnx_regex_error_category = {};
+
+__attr(maybe_unused) static let cnx_regex_category
+	= as_trait(CnxErrorCategory, CnxRegexErrorCategory, cnx_regex_error_category);
+
+__attr(always_inline) static inline void byte_set_add(CnxRegexByteSet* restrict set, u8 byte) {
+	set->m_bits[byte / 64U] |= static_cast(u64)(1U) << (byte % 64U);
+}
+
+__attr(always_inline) __attr(nodiscard) static inline bool
+	byte_set_contains(const CnxRegexByteSet* restrict set, u8 byte) {
+	return (set->m_bits[byte / 64U] >> (byte % 64U)) & 1U;
+}
+
+static void byte_set_add_range(CnxRegexByteSet* restrict set, u8 first, u8 last) {
+	for(let_mut byte = static_cast(u32)(first); byte <= last; ++byte) {
+		byte_set_add(set, static_cast(u8)(byte));
+	}
+}
+
+static void byte_set_add_set(CnxRegexByteSet* restrict set, const CnxRegexByteSet* restrict other) {
+	for(let_mut i = 0U; i < 4U; ++i) {
+		set->m_bits[i] |= other->m_bits[i];
+	}
+}
+
+static void byte_set_negate(CnxRegexByteSet* restrict set) {
+	for(let_mut i = 0U; i < 4U; ++i) {
+		set->m_bits[i] = ~set->m_bits[i];
+	}
+}
+
+/// @brief Returns the single byte in `set`, or `-1` if `set` doesn't contain exactly one byte
+__attr(nodiscard) static i32 byte_set_single_byte(const CnxRegexByteSet* restrict set) {
+	let_mut found = -1;
+	for(let_mut i = 0U; i < 4U; ++i) {
+		let bits = set->m_bits[i];
+		if(bits == 0) {
+			continue;
+		}
+		if(found != -1 || (bits & (bits - 1)) != 0) {
+			return -1;
+		}
+		found = static_cast(i32)(i * 64U) + __builtin_ctzll(bits);
+	}
+	return found;
+}
+
+typedef enum RegexNodeKind {
+	NODE_EMPTY = 0,
+	NODE_BYTES,
+	NODE_CONCAT,
+	NODE_ALTERNATE,
+	NODE_REPEAT,
+	NODE_GROUP,
+	NODE_ASSERT_START,
+	NODE_ASSERT_END,
+} RegexNodeKind;
+
+/// @brief A node in the syntax tree of a pattern. The children of `NODE_CONCAT` and
+/// `NODE_ALTERNATE` are stored as a linked list, in reverse order, because the program is
+/// compiled back to front
+typedef struct RegexNode {
+	RegexNodeKind m_kind;
+	/// @brief The byte set of `NODE_BYTES`, or the group index of `NODE_GROUP`
+	u32 m_argument;
+	/// @brief The child of `NODE_REPEAT` and `NODE_GROUP`, or the last child of `NODE_CONCAT` and
+	/// `NODE_ALTERNATE`
+	u32 m_child;
+	/// @brief The previous sibling of this node, if it's a child of a `NODE_CONCAT` or
+	/// `NODE_ALTERNATE`
+	u32 m_sibling;
+	u32 m_min;
+	u32 m_max;
+	bool m_greedy;
+} RegexNode;
+
+/// @brief Index of no node, used to terminate sibling lists
+#define NO_NODE (cnx_max_value(u32))
+
+typedef struct RegexCompiler {
+	const u8* m_pattern;
+	usize m_length;
+	usize m_position;
+	usize m_depth;
+	RegexNode* m_nodes;
+	usize m_num_nodes;
+	usize m_nodes_capacity;
+	CnxRegexByteSet* m_sets;
+	usize m_num_sets;
+	usize m_sets_capacity;
+	CnxRegexInstruction* m_program;
+	usize m_program_length;
+	usize m_num_groups;
+	CnxRegexErrorTypes m_error;
+	CnxAllocator m_allocator;
+} RegexCompiler;
+
+__attr(nodiscard) static u32 new_node(RegexCompiler* restrict compiler, RegexNodeKind kind) {
+	if(compiler->m_num_nodes == compiler->m_nodes_capacity) {
+		let new_capacity = compiler->m_nodes_capacity * 2U;
+		compiler->m_nodes = cnx_allocator_reallocate_array_t(RegexNode,
+															 compiler->m_allocator,
+															 compiler->m_nodes,
+															 compiler->m_nodes_capacity,
+															 new_capacity);
+		compiler->m_nodes_capacity = new_capacity;
+	}
+
+	let index = compiler->m_num_nodes++;
+	compiler->m_nodes[index] = (RegexNode){.m_kind = kind,
+										   .m_argument = 0,
+										   .m_child = NO_NODE,
+										   .m_sibling = NO_NODE,
+										   .m_min = 0,
+										   .m_max = 0,
+										   .m_greedy = true};
+	return static_cast(u32)(index);
+}
+
+__attr(nodiscard) static u32 new_set(RegexCompiler* restrict compiler) {
+	if(compiler->m_num_sets == compiler->m_sets_capacity) {
+		let new_capacity = compiler->m_sets_capacity * 2U;
+		compiler->m_sets = cnx_allocator_reallocate_array_t(CnxRegexByteSet,
+															compiler->m_allocator,
+															compiler->m_sets,
+															compiler->m_sets_capacity,
+															new_capacity);
+		compiler->m_sets_capacity = new_capacity;
+	}
+
+	let index = compiler->m_num_sets++;
+	compiler->m_sets[index] = (CnxRegexByteSet){0};
+	return static_cast(u32)(index);
+}
+
+__attr(nodiscard) static u32 new_bytes_node(RegexCompiler* restrict compiler,
+											const CnxRegexByteSet* restrict set) {
+	let set_index = new_set(compiler);
+	compiler->m_sets[set_index] = *set;
+	let node = new_node(compiler, NODE_BYTES);
+	compiler->m_nodes[node].m_argument = set_index;
+	return node;
+}
+
+__attr(always_inline) __attr(nodiscard) static inline bool
+	at_end(const RegexCompiler* restrict compiler) {
+	return compiler->m_position >= compiler->m_length;
+}
+
+__attr(always_inline) __attr(nodiscard) static inline u8
+	peek(const RegexCompiler* restrict compiler) {
+	return compiler->m_pattern[compiler->m_position];
+}
+
+__attr(nodiscard) static bool is_digit(u8 byte) {
+	return byte >= '0' && byte <= '9';
+}
+
+__attr(nodiscard) static bool is_alphanumeric(u8 byte) {
+	return is_digit(byte) || (byte >= 'a' && byte <= 'z') || (byte >= 'A' && byte <= 'Z');
+}
+
+__attr(nodiscard) static i32 hex_value(u8 byte) {
+	if(is_digit(byte)) {
+		return byte - '0';
+	}
+	else if(byte >= 'a' && byte <= 'f') {
+		return byte - 'a' + 10; // NOLINT(readability-magic-numbers)
+	}
+	else if(byte >= 'A' && byte <= 'F') {
+		return byte - 'A' + 10; // NOLINT(readability-magic-numbers)
+	}
+	return -1;
+}
+
+/// @brief Adds the bytes of the class escape `escape` (e.g. the `d` of `\d`) to `set`. Returns
+/// whether `escape` is a class escape
+__attr(nodiscard) static bool add_class_escape(CnxRegexByteSet* restrict set, u8 escape) {
+	let_mut class = (CnxRegexByteSet){0};
+	switch(escape) {
+		case 'd':
+		case 'D': byte_set_add_range(&class, '0', '9'); break;
+		case 'w':
+		case 'W':
+			byte_set_add_range(&class, '0', '9');
+			byte_set_add_range(&class, 'a', 'z');
+			byte_set_add_range(&class, 'A', 'Z');
+			byte_set_add(&class, '_');
+			break;
+		case 's':
+		case 'S':
+			byte_set_add(&class, ' ');
+			byte_set_add_range(&class, '\t', '\r');
+			break;
+		default: return false;
+	}
+
+	if(escape == 'D' || escape == 'W' || escape == 'S') {
+		byte_set_negate(&class);
+	}
+	byte_set_add_set(set, &class);
+	return true;
+}
+
+/// @brief Parses the escape sequence following a `\`, other than class escapes, returning the
+/// byte it represents, or `-1` if it's invalid
+__attr(nodiscard) static i32 parse_byte_escape(RegexCompiler* restrict compiler) {
+	if(at_end(compiler)) {
+		return -1;
+	}
+
+	let escape = compiler->m_pattern[compiler->m_position++];
+	switch(escape) {
+		case 'n': return '\n';
+		case 'r': return '\r';
+		case 't': return '\t';
+		case 'f': return '\f';
+		case 'v': return '\v';
+		case '0': return '\0';
+		case 'x': {
+			if(compiler->m_position + 2U > compiler->m_length) {
+				return -1;
+			}
+			let high = hex_value(compiler->m_pattern[compiler->m_position]);
+			let low = hex_value(compiler->m_pattern[compiler->m_position + 1U]);
+			if(high < 0 || low < 0) {
+				return -1;
+			}
+			compiler->m_position += 2U;
+			return high * 16 + low; // NOLINT(readability-magic-numbers)
+		}
+		default: break;
+	}
+
+	// any escaped ASCII punctuation is that punctuation literally
+	if(escape < 0x80U && !is_alphanumeric(escape)) { // NOLINT(readability-magic-numbers)
+		return escape;
+	}
+	return -1;
+}
+
+__attr(nodiscard) static u32 parse_class(RegexCompiler* restrict compiler) {
+	// the opening `[` has already been consumed
+	let_mut set = (CnxRegexByteSet){0};
+	let_mut negated = false;
+	if(!at_end(compiler) && peek(compiler) == '^') {
+		negated = true;
+		++compiler->m_position;
+	}
+
+	let_mut first = true;
+	while(true) {
+		if(at_end(compiler)) {
+			compiler->m_error = CNX_REGEX_UNCLOSED_CLASS;
+			return NO_NODE;
+		}
+
+		let_mut byte = static_cast(i32)(compiler->m_pattern[compiler->m_position++]);
+		if(byte == ']' && !first) {
+			break;
+		}
+		first = false;
+
+		if(byte == '\\') {
+			if(!at_end(compiler) && add_class_escape(&set, peek(compiler))) {
+				++compiler->m_position;
+				continue;
+			}
+			byte = parse_byte_escape(compiler);
+			if(byte < 0) {
+				compiler->m_error = CNX_REGEX_INVALID_ESCAPE;
+				return NO_NODE;
+			}
+		}
+
+		// a `-` forms a range unless it's the last character of the class
+		if(compiler->m_position + 1U < compiler->m_length && peek(compiler) == '-'
+		   && compiler->m_pattern[compiler->m_position + 1U] != ']')
+		{
+			compiler->m_position++;
+			let_mut last = static_cast(i32)(compiler->m_pattern[compiler->m_position++]);
+			if(last == '\\') {
+				if(!at_end(compiler) && add_class_escape(&set, peek(compiler))) {
+					compiler->m_error = CNX_REGEX_INVALID_RANGE;
+					return NO_NODE;
+				}
+				last = parse_byte_escape(compiler);
+				if(last < 0) {
+					compiler->m_error = CNX_REGEX_INVALID_ESCAPE;
+					return NO_NODE;
+				}
+			}
+
+			if(last < byte) {
+				compiler->m_error = CNX_REGEX_INVALID_RANGE;
+				return NO_NODE;
+			}
+			byte_set_add_range(&set, static_cast(u8)(byte), static_cast(u8)(last));
+		}
+		else {
+			byte_set_add(&set, static_cast(u8)(byte));
+		}
+	}
+
+	if(negated) {
+		byte_set_negate(&set);
+	}
+	return new_bytes_node(compiler, &set);
+}
+
+static u32 parse_alternation(RegexCompiler* restrict compiler);
+
+__attr(nodiscard) static u32 parse_group(RegexCompiler* restrict compiler) {
+	// the opening `(` has already been consumed
+	let_mut capturing = true;
+	if(compiler->m_position + 1U < compiler->m_length && peek(compiler) == '?'
+	   && compiler->m_pattern[compiler->m_position + 1U] == ':')
+	{
+		capturing = false;
+		compiler->m_position += 2U;
+	}
+
+	let_mut group = 0U;
+	if(capturing) {
+		if(compiler->m_num_groups == MAX_GROUPS) {
+			compiler->m_error = CNX_REGEX_TOO_LARGE;
+			return NO_NODE;
+		}
+		group = static_cast(u32)(compiler->m_num_groups++);
+	}
+
+	let child = parse_alternation(compiler);
+	if(compiler->m_error != CNX_REGEX_SUCCESS) {
+		return NO_NODE;
+	}
+	if(at_end(compiler) || peek(compiler) != ')') {
+		compiler->m_error = CNX_REGEX_UNMATCHED_PARENTHESIS;
+		return NO_NODE;
+	}
+	++compiler->m_position;
+
+	if(!capturing) {
+		return child;
+	}
+
+	let node = new_node(compiler, NODE_GROUP);
+	compiler->m_nodes[node].m_child = child;
+	compiler->m_nodes[node].m_argument = group;
+	return node;
+}
+
+__attr(nodiscard) static u32 parse_atom(RegexCompiler* restrict compiler) {
+	let byte = compiler->m_pattern[compiler->m_position++];
+	let_mut set = (CnxRegexByteSet){0};
+	switch(byte) {
+		case '(': return parse_group(compiler);
+		case '[': return parse_class(compiler);
+		case '^': return new_node(compiler, NODE_ASSERT_START);
+		case '$': return new_node(compiler, NODE_ASSERT_END);
+		case '.':
+			byte_set_add(&set, '\n');
+			byte_set_negate(&set);
+			return new_bytes_node(compiler, &set);
+		case '\\': {
+			if(!at_end(compiler) && add_class_escape(&set, peek(compiler))) {
+				++compiler->m_position;
+				return new_bytes_node(compiler, &set);
+			}
+			let escaped = parse_byte_escape(compiler);
+			if(escaped < 0) {
+				compiler->m_error = CNX_REGEX_INVALID_ESCAPE;
+				return NO_NODE;
+			}
+			byte_set_add(&set, static_cast(u8)(escaped));
+			return new_bytes_node(compiler, &set);
+		}
+		default:
+			byte_set_add(&set, byte);
+			return new_bytes_node(compiler, &set);
+	}
+}
+
+/// @brief Parses a decimal number of at most `MAX_REPETITION`, returning `-1` if there isn't
+/// one at the current position, or `-2` if it's too large
+__attr(nodiscard) static i64 parse_count(RegexCompiler* restrict compiler) {
+	if(at_end(compiler) || !is_digit(peek(compiler))) {
+		return -1;
+	}
+
+	let_mut count = static_cast(i64)(0);
+	let_mut too_large = false;
+	while(!at_end(compiler) && is_digit(peek(compiler))) {
+		count = count * 10 + (peek(compiler) - '0'); // NOLINT(readability-magic-numbers)
+		if(count > MAX_REPETITION) {
+			too_large = true;
+			count = MAX_REPETITION;
+		}
+		++compiler->m_position;
+	}
+	return too_large ? -2 : count;
+}
+
+/// @brief Parses the counted repetition at the current position (just after a `{`), storing its
+/// bounds in `min` and `max`. Returns false if there isn't a valid counted repetition at the
+/// current position, in which case the `{` is treated as a literal
+__attr(nodiscard) static bool parse_counted_repetition(RegexCompiler* restrict compiler,
+											   u32* restrict min,
+											   u32* restrict max) {
+	let start = compiler->m_position;
+	let first = parse_count(compiler);
+	if(first == -1) {
+		compiler->m_position = start;
+		return false;
+	}
+
+	let_mut second = first;
+	if(!at_end(compiler) && peek(compiler) == ',') {
+		++compiler->m_position;
+		second = parse_count(compiler);
+		if(second == -1) {
+			second = UNBOUNDED;
+		}
+	}
+
+	if(at_end(compiler) || peek(compiler) != '}') {
+		compiler->m_position = start;
+		return false;
+	}
+	++compiler->m_position;
+
+	if(first == -2 || second == -2) {
+		compiler->m_error = CNX_REGEX_TOO_LARGE;
+	}
+	else if(first > second) {
+		compiler->m_error = CNX_REGEX_INVALID_REPETITION;
+	}
+	*min = static_cast(u32)(first);
+	*max = static_cast(u32)(second);
+	return true;
+}
+
+__attr(nodiscard) static bool is_repetition_operator(RegexCompiler* restrict compiler) {
+	if(at_end(compiler)) {
+		return false;
+	}
+
+	let byte = peek(compiler);
+	if(byte == '*' || byte == '+' || byte == '?') {
+		return true;
+	}
+	if(byte != '{') {
+		return false;
+	}
+
+	// only a well-formed counted repetition is an operator, otherwise `{` is a literal
+	let start = compiler->m_position++;
+	let_mut min = 0U;
+	let_mut max = 0U;
+	let error = compiler->m_error;
+	let result = parse_counted_repetition(compiler, &min, &max);
+	compiler->m_position = start;
+	compiler->m_error = error;
+	return result;
+}
+
+__attr(nodiscard) static u32 parse_repetition(RegexCompiler* restrict compiler) {
+	if(is_repetition_operator(compiler)) {
+		compiler->m_error = CNX_REGEX_NOTHING_TO_REPEAT;
+		return NO_NODE;
+	}
+
+	let_mut node = parse_atom(compiler);
+	let_mut depth = compiler->m_depth;
+	while(compiler->m_error == CNX_REGEX_SUCCESS && is_repetition_operator(compiler)) {
+		let_mut min = 0U;
+		let_mut max = UNBOUNDED;
+		let byte = compiler->m_pattern[compiler->m_position++];
+		if(byte == '+') {
+			min = 1U;
+		}
+		else if(byte == '?') {
+			max = 1U;
+		}
+		else if(byte == '{') {
+			ignore(parse_counted_repetition(compiler, &min, &max));
+			if(compiler->m_error != CNX_REGEX_SUCCESS) {
+				return NO_NODE;
+			}
+		}
+
+		if(++depth > MAX_DEPTH) {
+			compiler->m_error = CNX_REGEX_TOO_LARGE;
+			return NO_NODE;
+		}
+
+		let repeat = new_node(compiler, NODE_REPEAT);
+		compiler->m_nodes[repeat].m_child = node;
+		compiler->m_nodes[repeat].m_min = min;
+		compiler->m_nodes[repeat].m_max = max;
+		if(!at_end(compiler) && peek(compiler) == '?') {
+			compiler->m_nodes[repeat].m_greedy = false;
+			++compiler->m_position;
+		}
+		node = repeat;
+	}
+
+	return node;
+}
+
+__attr(nodiscard) static u32 parse_concatenation(RegexCompiler* restrict compiler) {
+	let_mut last = NO_NODE;
+	let_mut count = 0U;
+	while(!at_end(compiler) && peek(compiler) != '|' && peek(compiler) != ')') {
+		let node = parse_repetition(compiler);
+		if(compiler->m_error != CNX_REGEX_SUCCESS) {
+			return NO_NODE;
+		}
+		compiler->m_nodes[node].m_sibling = last;
+		last = node;
+		++count;
+	}
+
+	if(count == 0) {
+		return new_node(compiler, NODE_EMPTY);
+	}
+	else if(count == 1) {
+		return last;
+	}
+
+	let concat = new_node(compiler, NODE_CONCAT);
+	compiler->m_nodes[concat].m_child = last;
+	return concat;
+}
+
+static u32 parse_alternation(RegexCompiler* restrict compiler) {
+	if(++compiler->m_depth > MAX_DEPTH) {
+		compiler->m_error = CNX_REGEX_TOO_LARGE;
+		return NO_NODE;
+	}
+
+	let_mut last = parse_concatenation(compiler);
+	let_mut count = 1U;
+	while(compiler->m_error == CNX_REGEX_SUCCESS && !at_end(compiler) && peek(compiler) == '|') {
+		++compiler->m_position;
+		let node = parse_concatenation(compiler);
+		if(compiler->m_error != CNX_REGEX_SUCCESS) {
+			break;
+		}
+		compiler->m_nodes[node].m_sibling = last;
+		last = node;
+		++count;
+	}
+
+	--compiler->m_depth;
+	if(compiler->m_error != CNX_REGEX_SUCCESS || count == 1) {
+		return last;
+	}
+
+	let alternate = new_node(compiler, NODE_ALTERNATE);
+	compiler->m_nodes[alternate].m_child = last;
+	return alternate;
+}
+
+__attr(nodiscard) static u32
+	emit(RegexCompiler* restrict compiler, RegexOpcode opcode, u32 next, u32 argument) {
+	if(compiler->m_program_length == CNX_REGEX_MAX_PROGRAM_LENGTH) {
+		compiler->m_error = CNX_REGEX_TOO_LARGE;
+		return 0;
+	}
+
+	let index = compiler->m_program_length++;
+	compiler->m_program[index]
+		= (CnxRegexInstruction){.m_opcode = opcode, .m_next = next, .m_argument = argument};
+	return static_cast(u32)(index);
+}
+
+/// @brief Compiles `node` so that it continues at `next` when it matches, returning the
+/// instruction to enter it at
+// NOLINTNEXTLINE(misc-no-recursion, readability-function-cognitive-complexity)
+__attr(nodiscard) static u32 compile_node(RegexCompiler* restrict compiler, u32 node, u32 next) {
+	if(compiler->m_error != CNX_REGEX_SUCCESS) {
+		return 0;
+	}
+
+	let current = compiler->m_nodes[node];
+	switch(current.m_kind) {
+		case NODE_EMPTY: return next;
+		case NODE_BYTES: return emit(compiler, OP_BYTES, next, current.m_argument);
+		case NODE_ASSERT_START: return emit(compiler, OP_ASSERT_START, next, 0);
+		case NODE_ASSERT_END: return emit(compiler, OP_ASSERT_END, next, 0);
+		case NODE_GROUP: {
+			let close = emit(compiler, OP_SAVE, next, current.m_argument * 2U + 1U);
+			let body = compile_node(compiler, current.m_child, close);
+			return emit(compiler, OP_SAVE, body, current.m_argument * 2U);
+		}
+		case NODE_CONCAT: {
+			// children are linked last to first, so this compiles back to front
+			let_mut entry = next;
+			for(let_mut child = current.m_child; child != NO_NODE;
+				child = compiler->m_nodes[child].m_sibling)
+			{
+				entry = compile_node(compiler, child, entry);
+			}
+			return entry;
+		}
+		case NODE_ALTERNATE: {
+			// children are linked last to first, so each alternative is preferred over the ones
+			// already compiled
+			let_mut entry = compile_node(compiler, current.m_child, next);
+			for(let_mut child = compiler->m_nodes[current.m_child].m_sibling; child != NO_NODE;
+				child = compiler->m_nodes[child].m_sibling)
+			{
+				let alternative = compile_node(compiler, child, next);
+				entry = emit(compiler, OP_SPLIT, alternative, entry);
+			}
+			return entry;
+		}
+		case NODE_REPEAT: {
+			let_mut entry = next;
+			let_mut copies = current.m_min;
+			if(current.m_max == UNBOUNDED) {
+				// the loop: `x*`, or `x+` when there's at least one required copy
+				let split = emit(compiler, OP_SPLIT, 0, 0);
+				let body = compile_node(compiler, current.m_child, split);
+				if(compiler->m_error != CNX_REGEX_SUCCESS) {
+					return 0;
+				}
+				compiler->m_program[split].m_next = current.m_greedy ? body : next;
+				compiler->m_program[split].m_argument = current.m_greedy ? next : body;
+				if(copies > 0) {
+					entry = body;
+					--copies;
+				}
+				else {
+					entry = split;
+				}
+			}
+			else {
+				// the optional copies, nested: `x{0,2}` is `(x(x)?)?`
+				for(let_mut i = current.m_min; i < current.m_max; ++i) {
+					let body = compile_node(compiler, current.m_child, entry);
+					entry = current.m_greedy ? emit(compiler, OP_SPLIT, body, next) :
+											   emit(compiler, OP_SPLIT, next, body);
+				}
+			}
+
+			for(let_mut i = 0U; i < copies; ++i) {
+				entry = compile_node(compiler, current.m_child, entry);
+			}
+			return entry;
+		}
+	}
+	unreachable();
+}
+
+/// @brief Partitions the byte values into equivalence classes, such that every byte set in the
+/// program either contains all of the bytes of a class or none of them
+static void compute_byte_classes(CnxRegex* restrict regex, usize num_sets) {
+	let_mut boundaries = (CnxRegexByteSet){0};
+	for(let_mut i = 0U; i < num_sets; ++i) {
+		let set = &(regex->m_sets[i]);
+		for(let_mut byte = 1U; byte < 256U; ++byte) { // NOLINT(readability-magic-numbers)
+			if(byte_set_contains(set, static_cast(u8)(byte))
+			   != byte_set_contains(set, static_cast(u8)(byte - 1U)))
+			{
+				byte_set_add(&boundaries, static_cast(u8)(byte));
+			}
+		}
+	}
+
+	let_mut class = 0U;
+	regex->m_class_representatives[0] = 0;
+	for(let_mut byte = 0U; byte < 256U; ++byte) { // NOLINT(readability-magic-numbers)
+		if(byte != 0 && byte_set_contains(&boundaries, static_cast(u8)(byte))) {
+			++class;
+			regex->m_class_representatives[class] = static_cast(u8)(byte);
+		}
+		regex->m_classes[byte] = static_cast(u8)(class);
+	}
+	regex->m_num_classes = class + 1U;
+}
+
+/// @brief Finds the literal bytes that every match must begin with, by following the program
+/// from its start for as long as it's a straight line of single-byte instructions
+static void compute_prefix(CnxRegex* restrict regex) {
+	let_mut length = 0U;
+	let_mut pc = regex->m_start;
+	while(true) {
+		let instruction = regex->m_program[pc];
+		if(instruction.m_opcode == OP_SAVE || instruction.m_opcode == OP_JUMP) {
+			pc = instruction.m_next;
+		}
+		else if(instruction.m_opcode == OP_BYTES
+				&& byte_set_single_byte(&(regex->m_sets[instruction.m_argument])) >= 0)
+		{
+			++length;
+			pc = instruction.m_next;
+		}
+		else {
+			break;
+		}
+	}
+
+	regex->m_prefix_length = length;
+	regex->m_prefix = nullptr;
+	if(length == 0) {
+		return;
+	}
+
+	regex->m_prefix = cnx_allocator_allocate_array_t(char, regex->m_allocator, length);
+	let_mut index = 0U;
+	pc = regex->m_start;
+	while(index < length) {
+		let instruction = regex->m_program[pc];
+		if(instruction.m_opcode == OP_BYTES) {
+			regex->m_prefix[index++] = static_cast(char)(
+				byte_set_single_byte(&(regex->m_sets[instruction.m_argument])));
+		}
+		pc = instruction.m_next;
+	}
+}
+
+static void thread_list_new(CnxRegexThreadList* restrict list,
+							usize program_length,
+							usize num_slots,
+							CnxAllocator allocator) {
+	list->m_dense = cnx_allocator_allocate_array_t(u32, allocator, program_length);
+	list->m_sparse = cnx_allocator_allocate_array_t(u32, allocator, program_length);
+	list->m_slots = cnx_allocator_allocate_array_t(usize, allocator, program_length * num_slots);
+	list->m_size = 0;
+}
+
+static void thread_list_free(CnxRegexThreadList* restrict list, CnxAllocator allocator) {
+	cnx_allocator_deallocate(allocator, list->m_dense);
+	cnx_allocator_deallocate(allocator, list->m_sparse);
+	cnx_allocator_deallocate(allocator, list->m_slots);
+}
+
+__attr(always_inline) __attr(nodiscard) static inline bool
+	thread_list_contains(const CnxRegexThreadList* restrict list, u32 pc) {
+	let index = list->m_sparse[pc];
+	return index < list->m_size && list->m_dense[index] == pc;
+}
+
+__attr(always_inline) static inline void
+	thread_list_insert(CnxRegexThreadList* restrict list, u32 pc) {
+	list->m_sparse[pc] = static_cast(u32)(list->m_size);
+	list->m_dense[list->m_size++] = pc;
+}
+
+static void cache_new(CnxRegex* restrict regex) {
+	let_mut cache = &(regex->m_cache);
+	let allocator = regex->m_allocator;
+	let program_length = regex->m_program_length;
+	let state_size = regex->m_num_classes * sizeof(u32) + 2U * sizeof(u32) + sizeof(u8)
+					 + 2U * sizeof(u32);
+
+	cache->m_max_states = (CNX_REGEX_CACHE_SIZE / 2U) / state_size;
+	if(cache->m_max_states < 16U) { // NOLINT(readability-magic-numbers)
+		cache->m_max_states = 16U;	// NOLINT(readability-magic-numbers)
+	}
+	// state `0` is never used, so that `0` can mean "not yet computed" in the transition table
+	++cache->m_max_states;
+	cache->m_pool_capacity = (CNX_REGEX_CACHE_SIZE / 2U) / sizeof(u32);
+	if(cache->m_pool_capacity < 4U * program_length) {
+		cache->m_pool_capacity = 4U * program_length;
+	}
+	cache->m_table_capacity = 1U;
+	while(cache->m_table_capacity < 2U * cache->m_max_states) {
+		cache->m_table_capacity *= 2U;
+	}
+
+	cache->m_transitions = cnx_allocator_allocate_array_t(u32,
+														  allocator,
+														  cache->m_max_states
+															  * regex->m_num_classes);
+	cache->m_offsets = cnx_allocator_allocate_array_t(u32, allocator, cache->m_max_states);
+	cache->m_lengths = cnx_allocator_allocate_array_t(u32, allocator, cache->m_max_states);
+	cache->m_flags = cnx_allocator_allocate_array_t(u8, allocator, cache->m_max_states);
+	cache->m_pool = cnx_allocator_allocate_array_t(u32, allocator, cache->m_pool_capacity);
+	cache->m_table = cnx_allocator_allocate_array_t(u32, allocator, cache->m_table_capacity);
+	cache->m_set = cnx_allocator_allocate_array_t(u32, allocator, program_length);
+	cache->m_num_states = 0;
+	cache->m_pool_used = 0;
+	cache->m_num_clears = 0;
+
+	let num_slots = regex->m_num_groups * 2U;
+	thread_list_new(&(cache->m_lists[0]), program_length, num_slots, allocator);
+	thread_list_new(&(cache->m_lists[1]), program_length, num_slots, allocator);
+	// each instruction is visited at most once per closure, pushing at most two frames
+	cache->m_stack
+		= cnx_allocator_allocate_array_t(CnxRegexFrame, allocator, 2U * program_length + 1U);
+	cache->m_scratch_slots = cnx_allocator_allocate_array_t(usize, allocator, num_slots);
+}
+
+static void cache_free(CnxRegex* restrict regex) {
+	let_mut cache = &(regex->m_cache);
+	let allocator = regex->m_allocator;
+	cnx_allocator_deallocate(allocator, cache->m_transitions);
+	cnx_allocator_deallocate(allocator, cache->m_offsets);
+	cnx_allocator_deallocate(allocator, cache->m_lengths);
+	cnx_allocator_deallocate(allocator, cache->m_flags);
+	cnx_allocator_deallocate(allocator, cache->m_pool);
+	cnx_allocator_deallocate(allocator, cache->m_table);
+	cnx_allocator_deallocate(allocator, cache->m_set);
+	thread_list_free(&(cache->m_lists[0]), allocator);
+	thread_list_free(&(cache->m_lists[1]), allocator);
+	cnx_allocator_deallocate(allocator, cache->m_stack);
+	cnx_allocator_deallocate(allocator, cache->m_scratch_slots);
+}
+
+static void compiler_free(RegexCompiler* restrict compiler) {
+	cnx_allocator_deallocate(compiler->m_allocator, compiler->m_nodes);
+	if(compiler->m_sets != nullptr) {
+		cnx_allocator_deallocate(compiler->m_allocator, compiler->m_sets);
+	}
+	if(compiler->m_program != nullptr) {
+		cnx_allocator_deallocate(compiler->m_allocator, compiler->m_program);
+	}
+}
+
+CnxResult(CnxRegex) cnx_regex_new_cstring_with_allocator(restrict const_cstring pattern,
+														 usize length,
+														 CnxAllocator allocator) {
+	let_mut compiler = (RegexCompiler){
+		.m_pattern = static_cast(const u8*)(static_cast(const void*)(pattern)),
+		.m_length = length,
+		.m_position = 0,
+		.m_depth = 0,
+		.m_nodes = cnx_allocator_allocate_array_t(RegexNode, allocator, 16U), // NOLINT
+		.m_num_nodes = 0,
+		.m_nodes_capacity = 16U, // NOLINT(readability-magic-numbers)
+		.m_sets = cnx_allocator_allocate_array_t(CnxRegexByteSet, allocator, 8U), // NOLINT
+		.m_num_sets = 0,
+		.m_sets_capacity = 8U, // NOLINT(readability-magic-numbers)
+		.m_program = nullptr,
+		.m_program_length = 0,
+		.m_num_groups = 1U,
+		.m_error = CNX_REGEX_SUCCESS,
+		.m_allocator = allocator,
+	};
+
+	let root = parse_alternation(&compiler);
+	if(compiler.m_error == CNX_REGEX_SUCCESS && !at_end(&compiler)) {
+		// the only way to stop parsing early is an unmatched `)`
+		compiler.m_error = CNX_REGEX_UNMATCHED_PARENTHESIS;
+	}
+
+	if(compiler.m_error == CNX_REGEX_SUCCESS) {
+		compiler.m_program = cnx_allocator_allocate_array_t(CnxRegexInstruction,
+															allocator,
+															CNX_REGEX_MAX_PROGRAM_LENGTH);
+	}
+
+	let_mut start = 0U;
+	if(compiler.m_error == CNX_REGEX_SUCCESS) {
+		// the whole match is the implicit capture group `0`
+		let match = emit(&compiler, OP_MATCH, 0, 0);
+		let close = emit(&compiler, OP_SAVE, match, 1U);
+		let body = compile_node(&compiler, root, close);
+		start = emit(&compiler, OP_SAVE, body, 0U);
+	}
+
+	if(compiler.m_error != CNX_REGEX_SUCCESS) {
+		let error = compiler.m_error;
+		compiler_free(&compiler);
+		return Err(CnxRegex, cnx_error_new(error, cnx_regex_category));
+	}
+
+	let_mut regex = (CnxRegex){
+		.m_program = cnx_allocator_reallocate_array_t(CnxRegexInstruction,
+													  allocator,
+													  compiler.m_program,
+													  CNX_REGEX_MAX_PROGRAM_LENGTH,
+													  compiler.m_program_length),
+		.m_program_length = compiler.m_program_length,
+		.m_start = start,
+		.m_sets = compiler.m_sets,
+		.m_num_groups = compiler.m_num_groups,
+		.m_allocator = allocator,
+	};
+	compiler.m_program = nullptr;
+	compiler.m_sets = nullptr;
+	compute_byte_classes(&regex, compiler.m_num_sets);
+	compute_prefix(&regex);
+	cache_new(&regex);
+	compiler_free(&compiler);
+
+	return Ok(CnxRegex, regex);
+}
+
+void cnx_regex_free(void* restrict self) {
+	let_mut regex = static_cast(CnxRegex*)(self);
+	cache_free(regex);
+	if(regex->m_prefix != nullptr) {
+		cnx_allocator_deallocate(regex->m_allocator, regex->m_prefix);
+	}
+	cnx_allocator_deallocate(regex->m_allocator, regex->m_sets);
+	cnx_allocator_deallocate(regex->m_allocator, regex->m_program);
+	*regex = (CnxRegex){0};
+}
+
+usize cnx_regex_group_count(const CnxRegex* restrict self) {
+	return self->m_num_groups;
+}
+
+/// @brief Adds the instructions reachable from `pc` without consuming input to `list`
+static void dfa_closure(CnxRegex* restrict regex,
+						CnxRegexThreadList* restrict list,
+						u32 pc,
+						bool is_at_start,
+						bool is_at_end) {
+	let stack = regex->m_cache.m_stack;
+	let_mut size = 0U;
+	stack[size++] = (CnxRegexFrame){.m_restore = false, .m_index = pc, .m_value = 0};
+	while(size > 0) {
+		let current = stack[--size].m_index;
+		if(thread_list_contains(list, current)) {
+			continue;
+		}
+		thread_list_insert(list, current);
+
+		let instruction = regex->m_program[current];
+		switch(instruction.m_opcode) {
+			case OP_SPLIT:
+				stack[size++] = (CnxRegexFrame){.m_index = instruction.m_argument};
+				stack[size++] = (CnxRegexFrame){.m_index = instruction.m_next};
+				break;
+			case OP_JUMP:
+			case OP_SAVE: stack[size++] = (CnxRegexFrame){.m_index = instruction.m_next}; break;
+			case OP_ASSERT_START:
+				if(is_at_start) {
+					stack[size++] = (CnxRegexFrame){.m_index = instruction.m_next};
+				}
+				break;
+			case OP_ASSERT_END:
+				if(is_at_end) {
+					stack[size++] = (CnxRegexFrame){.m_index = instruction.m_next};
+				}
+				break;
+			default: break;
+		}
+	}
+}
+
+/// @brief Returns whether the instruction at `pc` is part of the identity of a DFA state: the
+/// instructions that consume input, match, or are waiting for the end of the input
+__attr(always_inline) __attr(nodiscard) static inline bool
+	is_state_instruction(const CnxRegex* restrict regex, u32 pc) {
+	let opcode = regex->m_program[pc].m_opcode;
+	return opcode == OP_BYTES || opcode == OP_MATCH || opcode == OP_ASSERT_END;
+}
+
+/// @brief Writes the canonical (sorted) instruction set of `list` to the cache's scratch set,
+/// returning its size
+__attr(nodiscard) static usize
+	canonicalize(CnxRegex* restrict regex, const CnxRegexThreadList* restrict list) {
+	let set = regex->m_cache.m_set;
+	let_mut size = 0U;
+	// insertion sort is fastest for the typical, small sets, but large sets are sorted by
+	// checking membership of every instruction instead to avoid its quadratic worst case
+	// NOLINTNEXTLINE(readability-magic-numbers)
+	if(list->m_size <= 32U) {
+		for(let_mut i = 0U; i < list->m_size; ++i) {
+			let pc = list->m_dense[i];
+			if(!is_state_instruction(regex, pc)) {
+				continue;
+			}
+			let_mut j = size++;
+			for(; j > 0 && set[j - 1] > pc; --j) {
+				set[j] = set[j - 1];
+			}
+			set[j] = pc;
+		}
+	}
+	else {
+		for(let_mut pc = 0U; pc < regex->m_program_length; ++pc) {
+			if(thread_list_contains(list, static_cast(u32)(pc))
+			   && is_state_instruction(regex, static_cast(u32)(pc)))
+			{
+				set[size++] = static_cast(u32)(pc);
+			}
+		}
+	}
+	return size;
+}
+
+__attr(nodiscard) static usize hash_set(const u32* restrict set, usize size) {
+	let_mut hash = static_cast(u64)(14695981039346656037ULL); // NOLINT(readability-magic-numbers)
+	for(let_mut i = 0U; i < size; ++i) {
+		hash ^= set[i];
+		hash *= 1099511628211ULL; // NOLINT(readability-magic-numbers)
+	}
+	return static_cast(usize)(hash ^ (hash >> 32U)); // NOLINT(readability-magic-numbers)
+}
+
+/// @brief Computes the flags of the DFA state with the given instruction set
+__attr(nodiscard) static u8
+	compute_flags(CnxRegex* restrict regex, const u32* restrict set, usize size) {
+	if(size == 0) {
+		return STATE_DEAD;
+	}
+
+	let_mut flags = static_cast(u8)(0);
+	let list = &(regex->m_cache.m_lists[1]);
+	for(let_mut i = 0U; i < size; ++i) {
+		let instruction = regex->m_program[set[i]];
+		if(instruction.m_opcode == OP_MATCH) {
+			return STATE_MATCH | STATE_END_MATCH;
+		}
+		else if(instruction.m_opcode == OP_ASSERT_END && (flags & STATE_END_MATCH) == 0) {
+			list->m_size = 0;
+			dfa_closure(regex, list, instruction.m_next, false, true);
+			for(let_mut j = 0U; j < list->m_size; ++j) {
+				if(regex->m_program[list->m_dense[j]].m_opcode == OP_MATCH) {
+					flags |= STATE_END_MATCH;
+					break;
+				}
+			}
+		}
+	}
+	return flags;
+}
+
+/// @brief Returns the DFA state for the instruction set in the cache's scratch set, adding it to
+/// the cache if it isn't already. Returns `0` if there's no room in the cache for it
+__attr(nodiscard) static u32 find_or_add_state(CnxRegex* restrict regex, usize size) {
+	let_mut cache = &(regex->m_cache);
+	let set = cache->m_set;
+	let mask = cache->m_table_capacity - 1U;
+	let_mut slot = hash_set(set, size) & mask;
+	for(; cache->m_table[slot] != 0; slot = (slot + 1U) & mask) {
+		let state = cache->m_table[slot];
+		if(cache->m_lengths[state] == size
+		   && memcmp(cache->m_pool + cache->m_offsets[state], set, size * sizeof(u32)) == 0)
+		{
+			return state;
+		}
+	}
+
+	if(cache->m_num_states == cache->m_max_states
+	   || cache->m_pool_used + size > cache->m_pool_capacity)
+	{
+		return 0;
+	}
+
+	let state = static_cast(u32)(cache->m_num_states++);
+	memcpy(cache->m_pool + cache->m_pool_used, set, size * sizeof(u32));
+	cache->m_offsets[state] = static_cast(u32)(cache->m_pool_used);
+	cache->m_lengths[state] = static_cast(u32)(size);
+	cache->m_pool_used += size;
+	memset(cache->m_transitions + static_cast(usize)(state) * regex->m_num_classes,
+		   0,
+		   regex->m_num_classes * sizeof(u32));
+	cache->m_flags[state] = compute_flags(regex, set, size);
+	cache->m_table[slot] = state;
+	return state;
+}
+
+/// @brief Empties the DFA cache
+static void cache_clear(CnxRegex* restrict regex) {
+	let_mut cache = &(regex->m_cache);
+	memset(cache->m_table, 0, cache->m_table_capacity * sizeof(u32));
+	// state `0` is reserved to mean "not yet computed" in the transition table
+	cache->m_num_states = 1U;
+	cache->m_pool_used = 0;
+}
+
+/// @brief Adds the start states to the DFA cache. The cache must have room for them
+static void cache_add_start_states(CnxRegex* restrict regex) {
+	let_mut cache = &(regex->m_cache);
+	let list = &(cache->m_lists[0]);
+	for(let_mut i = 0U; i < 2U; ++i) {
+		list->m_size = 0;
+		dfa_closure(regex, list, regex->m_start, i == 0, false);
+		cache->m_start_states[i] = find_or_add_state(regex, canonicalize(regex, list));
+	}
+}
+
+/// @brief Computes the transition of DFA state `state` on byte class `class`, returning the next
+/// state, or `0` if the cache had to be cleared too many times to make progress
+__attr(nodiscard) static u32 compute_transition(CnxRegex* restrict regex, u32 state, u8 class) {
+	let_mut cache = &(regex->m_cache);
+	let byte = regex->m_class_representatives[class];
+	let list = &(cache->m_lists[0]);
+	list->m_size = 0;
+
+	let members = cache->m_pool + cache->m_offsets[state];
+	let length = cache->m_lengths[state];
+	for(let_mut i = 0U; i < length; ++i) {
+		let instruction = regex->m_program[members[i]];
+		if(instruction.m_opcode == OP_BYTES
+		   && byte_set_contains(&(regex->m_sets[instruction.m_argument]), byte))
+		{
+			dfa_closure(regex, list, instruction.m_next, false, false);
+		}
+	}
+	// searches are unanchored, so a match can also begin after this byte
+	dfa_closure(regex, list, regex->m_start, false, false);
+
+	let size = canonicalize(regex, list);
+	let next = find_or_add_state(regex, size);
+	if(next != 0) {
+		cache->m_transitions[static_cast(usize)(state) * regex->m_num_classes + class] = next;
+		return next;
+	}
+
+	if(++cache->m_num_clears > MAX_CACHE_CLEARS) {
+		return 0;
+	}
+	// the new state is still in the scratch set, so add it before the start states overwrite
+	// it. The transition isn't recorded, because `state` no longer exists
+	cache_clear(regex);
+	let added = find_or_add_state(regex, size);
+	cache_add_start_states(regex);
+	return added;
+}
+
+/// @brief Runs the lazy DFA over `haystack` from `start`, returning `1` if there's a match, `0` if
+/// there isn't, or `-1` if the DFA gave up because of cache thrashing
+__attr(nodiscard) static i32
+	dfa_is_match(CnxRegex* restrict regex, const u8* restrict haystack, usize length, usize start) {
+	let_mut cache = &(regex->m_cache);
+	if(cache->m_num_states == 0) {
+		cache_clear(regex);
+		cache_add_start_states(regex);
+	}
+	cache->m_num_clears = 0;
+
+	let_mut state = cache->m_start_states[start == 0 ? 0 : 1];
+	for(let_mut position = start;; ++position) {
+		let flags = cache->m_flags[state];
+		if((flags & STATE_MATCH) != 0) {
+			return 1;
+		}
+		else if((flags & STATE_DEAD) != 0) {
+			return 0;
+		}
+		else if(position == length) {
+			return (flags & STATE_END_MATCH) != 0 ? 1 : 0;
+		}
+
+		// with no partial match in progress, skip to the next place a match could begin
+		if(state == cache->m_start_states[1] && regex->m_prefix_length != 0) {
+			let_mut found = cnx_string_search_first(
+				static_cast(const_cstring)(static_cast(const void*)(haystack + position)),
+				length - position,
+				regex->m_prefix,
+				regex->m_prefix_length);
+			if(cnx_option_is_none(found)) {
+				return 0;
+			}
+			position += cnx_option_unwrap(found);
+		}
+
+		let class = regex->m_classes[haystack[position]];
+		let_mut next
+			= cache->m_transitions[static_cast(usize)(state) * regex->m_num_classes + class];
+		if(next == 0) {
+			next = compute_transition(regex, state, class);
+			if(next == 0) {
+				return -1;
+			}
+		}
+		state = next;
+	}
+}
+
+/// @brief Adds a thread at `pc` to `list`, following the instructions that don't consume input
+/// and recording capture positions. The thread's capture slots must be in the cache's scratch
+/// slots
+static void pike_add_thread(CnxRegex* restrict regex,
+							CnxRegexThreadList* restrict list,
+							u32 pc,
+							usize position,
+							usize num_slots,
+							bool is_at_start,
+							bool is_at_end) {
+	let stack = regex->m_cache.m_stack;
+	let slots = regex->m_cache.m_scratch_slots;
+	let_mut size = 0U;
+	stack[size++] = (CnxRegexFrame){.m_restore = false, .m_index = pc, .m_value = 0};
+	while(size > 0) {
+		let frame = stack[--size];
+		if(frame.m_restore) {
+			slots[frame.m_index] = frame.m_value;
+			continue;
+		}
+
+		let current = frame.m_index;
+		if(thread_list_contains(list, current)) {
+			continue;
+		}
+		thread_list_insert(list, current);
+
+		let instruction = regex->m_program[current];
+		switch(instruction.m_opcode) {
+			case OP_SPLIT:
+				// the preferred alternative is pushed last, so it's followed first
+				stack[size++] = (CnxRegexFrame){.m_index = instruction.m_argument};
+				stack[size++] = (CnxRegexFrame){.m_index = instruction.m_next};
+				break;
+			case OP_JUMP: stack[size++] = (CnxRegexFrame){.m_index = instruction.m_next}; break;
+			case OP_SAVE:
+				if(instruction.m_argument < num_slots) {
+					stack[size++] = (CnxRegexFrame){.m_restore = true,
+													.m_index = instruction.m_argument,
+													.m_value = slots[instruction.m_argument]};
+					slots[instruction.m_argument] = position;
+				}
+				stack[size++] = (CnxRegexFrame){.m_index = instruction.m_next};
+				break;
+			case OP_ASSERT_START:
+				if(is_at_start) {
+					stack[size++] = (CnxRegexFrame){.m_index = instruction.m_next};
+				}
+				break;
+			case OP_ASSERT_END:
+				if(is_at_end) {
+					stack[size++] = (CnxRegexFrame){.m_index = instruction.m_next};
+				}
+				break;
+			default:
+				memcpy(list->m_slots + static_cast(usize)(current) * num_slots,
+					   slots,
+					   num_slots * sizeof(usize));
+				break;
+		}
+	}
+}
+
+/// @brief Runs the Pike VM over `haystack` from `start`, finding the leftmost-first match and
+/// writing its first `num_slots` capture slots to `slots_out`. If `full` is true, only a match
+/// beginning at `start` and ending at the end of `haystack` is accepted
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+__attr(nodiscard) static bool pike_search(CnxRegex* restrict regex,
+										  const u8* restrict haystack,
+										  usize length,
+										  usize start,
+										  bool full,
+										  usize* restrict slots_out,
+										  usize num_slots) {
+	let_mut cache = &(regex->m_cache);
+	let_mut current = &(cache->m_lists[0]);
+	let_mut next = &(cache->m_lists[1]);
+	let scratch = cache->m_scratch_slots;
+	current->m_size = 0;
+	next->m_size = 0;
+
+	let_mut matched = false;
+	for(let_mut position = start; position <= length; ++position) {
+		if(!matched && (!full || position == start)) {
+			// with no partial match in progress, skip to the next place a match could begin
+			if(current->m_size == 0 && !full && regex->m_prefix_length != 0) {
+				let_mut found = cnx_string_search_first(
+					static_cast(const_cstring)(static_cast(const void*)(haystack + position)),
+					length - position,
+					regex->m_prefix,
+					regex->m_prefix_length);
+				if(cnx_option_is_none(found)) {
+					break;
+				}
+				position += cnx_option_unwrap(found);
+			}
+
+			// threads starting here have lower priority than any that started earlier
+			for(let_mut i = 0U; i < num_slots; ++i) {
+				scratch[i] = NO_POSITION;
+			}
+			pike_add_thread(regex,
+							current,
+							regex->m_start,
+							position,
+							num_slots,
+							position == 0,
+							position == length);
+		}
+
+		if(current->m_size == 0 && (matched || full)) {
+			break;
+		}
+
+		for(let_mut i = 0U; i < current->m_size; ++i) {
+			let pc = current->m_dense[i];
+			let instruction = regex->m_program[pc];
+			let thread_slots = current->m_slots + static_cast(usize)(pc) * num_slots;
+			if(instruction.m_opcode == OP_MATCH) {
+				if(full && position != length) {
+					continue;
+				}
+				matched = true;
+				memcpy(slots_out, thread_slots, num_slots * sizeof(usize));
+				// every remaining thread has lower priority than this match
+				break;
+			}
+			else if(instruction.m_opcode == OP_BYTES && position < length
+					&& byte_set_contains(&(regex->m_sets[instruction.m_argument]),
+										 haystack[position]))
+			{
+				memcpy(scratch, thread_slots, num_slots * sizeof(usize));
+				pike_add_thread(regex,
+								next,
+								instruction.m_next,
+								position + 1U,
+								num_slots,
+								false,
+								position + 1U == length);
+			}
+		}
+
+		let temp = current;
+		current = next;
+		next = temp;
+		next->m_size = 0;
+	}
+
+	return matched;
+}
+
+__attr(always_inline) __attr(nodiscard) static inline const u8*
+	haystack_bytes(const CnxStringView* restrict haystack) {
+	return static_cast(const u8*)(static_cast(const void*)(cnx_stringview_into_cstring(*haystack)));
+}
+
+/// @brief Returns whether there's a match in `haystack` at or after `start`, using the DFA unless
+/// it gives up
+__attr(nodiscard) static bool
+	is_match_at(CnxRegex* restrict regex, const CnxStringView* restrict haystack, usize start) {
+	let bytes = haystack_bytes(haystack);
+	let length = cnx_stringview_length(*haystack);
+	// the empty remainder has no bytes to drive the DFA, so needs the Pike VM to check anchors
+	if(start < length) {
+		let result = dfa_is_match(regex, bytes, length, start);
+		if(result >= 0) {
+			return result == 1;
+		}
+	}
+
+	usize slots[2]; // NOLINT
+	return pike_search(regex, bytes, length, start, false, slots, 2U);
+}
+
+bool cnx_regex_is_match(CnxRegex* restrict self, const CnxStringView* restrict haystack) {
+	return is_match_at(self, haystack, 0);
+}
+
+bool cnx_regex_is_full_match(CnxRegex* restrict self, const CnxStringView* restrict haystack) {
+	usize slots[2]; // NOLINT
+	return pike_search(self,
+					   haystack_bytes(haystack),
+					   cnx_stringview_length(*haystack),
+					   0,
+					   true,
+					   slots,
+					   2U);
+}
+
+__attr(nodiscard) static CnxStringView
+	subview(const CnxStringView* restrict haystack, usize start, usize end) {
+	let_mut view = *haystack;
+	view.m_view += start;
+	view.m_length = end - start;
+	return view;
+}
+
+CnxOption(CnxStringView) cnx_regex_find_at(CnxRegex* restrict self,
+										   const CnxStringView* restrict haystack,
+										   usize start) {
+	cnx_assert(start <= cnx_stringview_length(*haystack),
+			   "start passed to cnx_regex_find_at out of bounds");
+
+	if(!is_match_at(self, haystack, start)) {
+		return None(CnxStringView);
+	}
+
+	usize slots[2]; // NOLINT
+	if(!pike_search(self,
+					haystack_bytes(haystack),
+					cnx_stringview_length(*haystack),
+					start,
+					false,
+					slots,
+					2U))
+	{
+		return None(CnxStringView);
+	}
+
+	let view = subview(haystack, slots[0], slots[1]);
+	return Some(CnxStringView, view);
+}
+
+bool cnx_regex_captures_at(CnxRegex* restrict self,
+						   const CnxStringView* restrict haystack,
+						   usize start,
+						   CnxOption(CnxStringView) * restrict captures,
+						   usize num_captures) {
+	cnx_assert(start <= cnx_stringview_length(*haystack),
+			   "start passed to cnx_regex_captures_at out of bounds");
+
+	if(!is_match_at(self, haystack, start)) {
+		return false;
+	}
+
+	let num_groups = num_captures < self->m_num_groups ? num_captures : self->m_num_groups;
+	let num_slots = num_groups < 1U ? 2U : num_groups * 2U;
+	usize result[2U * MAX_GROUPS]; // NOLINT
+	if(!pike_search(self,
+					haystack_bytes(haystack),
+					cnx_stringview_length(*haystack),
+					start,
+					false,
+					result,
+					num_slots))
+	{
+		return false;
+	}
+
+	for(let_mut i = 0U; i < num_captures; ++i) {
+		if(i < num_groups && result[2U * i] != NO_POSITION && result[2U * i + 1U] != NO_POSITION) {
+			let view = subview(haystack, result[2U * i], result[2U * i + 1U]);
+			captures[i] = Some(CnxStringView, view);
+		}
+		else {
+			captures[i] = None(CnxStringView);
+		}
+	}
+	return true;
+}
@@ -0,0 +1,155 @@
+/// @file SharedString.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief This module provides an immutable, reference-counted string type for Cnx
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <Cnx/Allocators.h>
+#include <Cnx/Assert.h>
+#include <Cnx/SharedString.h>
+#include <memory.h>
+
+/// @brief Adds a reference to the given storage, if any
+__attr(always_inline) static inline void retain(CnxSharedStringStorage* restrict storage) {
+	if(storage != nullptr) {
+		// a new reference can only be made from an existing one, which keeps the storage alive,
+		// so no ordering is required here
+		ignore(atomic_fetch_add_explicit(&storage->m_ref_count, 1, memory_order_relaxed));
+	}
+}
+
+/// @brief Removes a reference from the given storage, if any, freeing it if that was the last one
+__attr(always_inline) static inline void release(CnxSharedStringStorage* restrict storage) {
+	// the release half orders this owner's reads of the characters before the free, and the
+	// acquire half orders the free after every other owner's reads
+	if(storage != nullptr
+	   && atomic_fetch_sub_explicit(&storage->m_ref_count, 1, memory_order_acq_rel) == 1)
+	{
+		let allocator = storage->m_allocator;
+		cnx_allocator_deallocate(allocator, storage);
+	}
+}
+
+CnxSharedString cnx_shared_string_new(void) {
+	return (CnxSharedString){.m_storage = nullptr, .m_data = "", .m_length = 0};
+}
+
+CnxSharedString cnx_shared_string_from_cstring_with_allocator(restrict const_cstring string,
+															  usize length,
+															  CnxAllocator allocator) {
+	if(length == 0) {
+		return cnx_shared_string_new();
+	}
+
+	// the header and characters share one allocation
+	let_mut storage = static_cast(CnxSharedStringStorage*)(
+		cnx_allocator_allocate(allocator, sizeof(CnxSharedStringStorage) + length + 1));
+	atomic_init(&storage->m_ref_count, 1);
+	storage->m_allocator = allocator;
+	storage->m_length = length;
+	cnx_memcpy(char, storage->m_data, string, length);
+	storage->m_data[length] = 0;
+
+	return (CnxSharedString){.m_storage = storage, .m_data = storage->m_data, .m_length = length};
+}
+
+CnxSharedString cnx_shared_string_from_cstring(restrict const_cstring string, usize length) {
+	return cnx_shared_string_from_cstring_with_allocator(string, length, DEFAULT_ALLOCATOR);
+}
+
+CnxSharedString(cnx_shared_string_from_string)(const CnxString* restrict string) {
+	return cnx_shared_string_from_cstring_with_allocator((cnx_string_into_cstring)(string),
+														 (cnx_string_length)(string),
+														 string->m_allocator);
+}
+
+CnxSharedString(cnx_shared_string_clone)(const CnxSharedString* restrict self) {
+	retain(self->m_storage);
+	return *self;
+}
+
+void(cnx_shared_string_free)(void* restrict self) {
+	let self_ptr = static_cast(CnxSharedString*)(self);
+	release(self_ptr->m_storage);
+	*self_ptr = cnx_shared_string_new();
+}
+
+usize(cnx_shared_string_ref_count)(const CnxSharedString* restrict self) {
+	return self->m_storage == nullptr ?
+			   0 :
+			   atomic_load_explicit(&self->m_storage->m_ref_count, memory_order_relaxed);
+}
+
+const_cstring(cnx_shared_string_at)(const CnxSharedString* restrict self, usize index) {
+	cnx_assert(index < self->m_length,
+			   "cnx_shared_string_at called with index >= length (index out of bounds)");
+	return &(self->m_data[index]);
+}
+
+CnxSharedString(cnx_shared_string_substring)(const CnxSharedString* restrict self,
+											 usize index,
+											 usize length) {
+	cnx_assert(index <= self->m_length && length <= self->m_length - index,
+			   "cnx_shared_string_substring called with index + length > length "
+			   "(index out of bounds)");
+
+	// an empty substring doesn't need to keep the original characters alive
+	if(length == 0) {
+		return cnx_shared_string_new();
+	}
+
+	retain(self->m_storage);
+	return (CnxSharedString){.m_storage = self->m_storage,
+							 .m_data = self->m_data + index,
+							 .m_length = length};
+}
+
+CnxStringView(cnx_shared_string_into_stringview)(const CnxSharedString* restrict self) {
+	return cnx_stringview_from_raw(self->m_data, self->m_length);
+}
+
+CnxString(cnx_shared_string_into_string)(const CnxSharedString* restrict self) {
+	let allocator
+		= self->m_storage == nullptr ? DEFAULT_ALLOCATOR : self->m_storage->m_allocator;
+	return cnx_string_from_cstring_with_allocator(self->m_data, self->m_length, allocator);
+}
+
+bool cnx_shared_string_equal_cstring(const CnxSharedString* restrict self,
+									 restrict const_cstring string,
+									 usize length) {
+	return self->m_length == length && memcmp(self->m_data, string, length) == 0;
+}
+
+i32 cnx_shared_string_compare_cstring(const CnxSharedString* restrict self,
+									  restrict const_cstring string,
+									  usize length) {
+	let shorter = self->m_length < length ? self->m_length : length;
+	let result = memcmp(self->m_data, string, shorter);
+	if(result != 0) {
+		return result;
+	}
+
+	return self->m_length < length ? -1 : (self->m_length > length ? 1 : 0);
+}
@@ -31,6 +31,8 @@
 #include <Cnx/Assert.h>
 #include <Cnx/Math.h>
 #include <Cnx/Platform.h>
+#include <Cnx/StringSearch.h>
+#include <Cnx/Utf8.h>
 #include <wchar.h>
 
 #define OPTION_UNDEF_PARAMS TRUE
@@ -468,20 +470,45 @@ CnxString cnx_string_from_wcstring(restrict const_wcstring string, usize length)
 CnxString cnx_string_from_wcstring_with_allocator(restrict const_wcstring string,
 												  usize length,
 												  CnxAllocator allocator) {
-#if CNX_PLATFORM_COMPILER_GCC
-	_Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Wformat-truncation\"")
-#endif // CNX_PLATFORM_COMPILER_GCC
-		let cstring_length
-		= static_cast(usize)(snprintf(nullptr, length, "%ls", string));
-#if CNX_PLATFORM_COMPILER_GCC
-	_Pragma("GCC diagnostic pop")
-#endif // CNX_PLATFORM_COMPILER_GCC
-
-		let_mut cnx_string
-		= cnx_string_new_with_capacity_with_allocator(cstring_length, allocator);
-	cnx_string_set_length(&cnx_string, cstring_length);
-	let_mut str = &(cnx_string_at(cnx_string, 0));
-	ignore(snprintf(str, length, "%ls", string));
+	// `wchar_t` is UTF-32 on most platforms, but UTF-16 on Windows
+	if(sizeof(wchar_t) == sizeof(u32)) {
+		return cnx_string_from_utf32_with_allocator(
+			static_cast(const u32*)(static_cast(const void*)(string)),
+			length,
+			allocator);
+	}
+
+	return cnx_string_from_utf16_with_allocator(
+		static_cast(const u16*)(static_cast(const void*)(string)),
+		length,
+		allocator);
+}
+
+CnxString cnx_string_from_utf16(const u16* restrict string, usize length) {
+	return cnx_string_from_utf16_with_allocator(string, length, DEFAULT_ALLOCATOR);
+}
+
+CnxString cnx_string_from_utf16_with_allocator(const u16* restrict string,
+											   usize length,
+											   CnxAllocator allocator) {
+	let utf8_length = cnx_utf16_utf8_length(string, length);
+	let_mut cnx_string = cnx_string_new_with_capacity_with_allocator(utf8_length, allocator);
+	cnx_string_set_length(&cnx_string, utf8_length);
+	ignore(cnx_utf16_to_utf8(string, length, &cnx_string_at(cnx_string, 0)));
+	return cnx_string;
+}
+
+CnxString cnx_string_from_utf32(const u32* restrict string, usize length) {
+	return cnx_string_from_utf32_with_allocator(string, length, DEFAULT_ALLOCATOR);
+}
+
+CnxString cnx_string_from_utf32_with_allocator(const u32* restrict string,
+											   usize length,
+											   CnxAllocator allocator) {
+	let utf8_length = cnx_utf32_utf8_length(string, length);
+	let_mut cnx_string = cnx_string_new_with_capacity_with_allocator(utf8_length, allocator);
+	cnx_string_set_length(&cnx_string, utf8_length);
+	ignore(cnx_utf32_to_utf8(string, length, &cnx_string_at(cnx_string, 0)));
 	return cnx_string;
 }
 
@@ -504,10 +531,20 @@ const_wcstring(cnx_string_into_wcstring)(const CnxString* restrict self) {
 
 const_wcstring(cnx_string_into_wcstring_with_allocator)(const CnxString* restrict self,
 														CnxAllocator allocator) {
-	let_mut string = cnx_string_into_cstring(*self);
-	let length = static_cast(usize)(swprintf(nullptr, cnx_string_length(*self), L"%s", string));
-	let_mut wstring = cnx_allocator_allocate_array_t(wchar_t, allocator, length);
-	ignore(swprintf(wstring, cnx_string_length(*self), L"%s", string));
+	let string = cnx_string_into_cstring(*self);
+	let length = cnx_string_length(*self);
+	// `wchar_t` is UTF-32 on most platforms, but UTF-16 on Windows
+	let is_utf32 = sizeof(wchar_t) == sizeof(u32);
+	let wide_length = is_utf32 ? cnx_utf8_utf32_length(string, length) :
+								 cnx_utf8_utf16_length(string, length);
+	let_mut wstring = cnx_allocator_allocate_array_t(wchar_t, allocator, wide_length + 1);
+	if(is_utf32) {
+		ignore(cnx_utf8_to_utf32(string, length, static_cast(u32*)(static_cast(void*)(wstring))));
+	}
+	else {
+		ignore(cnx_utf8_to_utf16(string, length, static_cast(u16*)(static_cast(void*)(wstring))));
+	}
+	wstring[wide_length] = L'\0';
 	return wstring;
 }
 
@@ -679,138 +716,20 @@ bool cnx_string_equal_stringview(const CnxString* restrict self,
 	return cnx_string_equal_cstring(self, to_compare->m_view, to_compare->m_length);
 }
 
-/// @brief Determines if the substring of `self` beginning at `index` is the same as the given
-/// `substring`
-__attr(always_inline) __attr(nodiscard) __attr(not_null(1, 2)) static inline CnxOption(usize)
-	cnx_string_contains_from_left(const CnxString* restrict self,
-								  const CnxString* restrict substring,
-								  usize index) {
-	let sublength = cnx_string_length(*substring);
-	cnx_assert(index + sublength < cnx_string_length(*self),
-			   "cnx_string_contains_from_left called with index + substring->m_length >= "
-			   "self->m_length (indices are out of bounds)");
-
-	if(0 == memcmp(&cnx_string_at(*self, index), &cnx_string_at(*substring, 0), sublength)) {
-		return Some(usize, index);
-	}
-	else {
-		return None(usize);
-	}
-}
-
-/// @brief Determines if the substring of `self` ending with `index` (inclusive)is the same as
-/// the given `substring`
-__attr(always_inline) __attr(nodiscard) __attr(not_null(1, 2)) static inline CnxOption(usize)
-	cnx_string_contains_from_right(const CnxString* restrict self,
-								   const CnxString* restrict substring,
-								   usize index) {
-
-	let sublength = cnx_string_length(*substring);
-	cnx_assert(index >= sublength,
-			   "cnx_string_contains_from_right called with index < substring->m_length (index out "
-			   "of bounds)");
-
-	let start_index = index - (sublength - 1);
-	if(0 == memcmp(&cnx_string_at(*self, start_index), &cnx_string_at(*substring, 0), sublength)) {
-		return Some(usize, start_index);
-	}
-	else {
-		return None(usize);
-	}
-}
-
 bool(cnx_string_contains)(const CnxString* restrict self, const CnxString* restrict substring) {
-	let length = cnx_string_length(*self);
-	let sublength = cnx_string_length(*substring);
-	if(length < sublength) {
-		return false;
-	}
-
-	for(usize left = static_cast(usize)(0), right = length - 1;
-		right >= sublength && left + sublength < length;
-		++left, --right)
-	{
-
-		let contains_left = cnx_string_contains_from_left(self, substring, left);
-		if(cnx_option_is_some(contains_left)) {
-			return true;
-		}
-
-		let contains_right = cnx_string_contains_from_right(self, substring, right);
-		if(cnx_option_is_some(contains_right)) {
-			return true;
-		}
-	}
-
-	return false;
-}
-
-/// @brief Determines if the substring of `self` beginning at `index` is the same as the given
-/// `substring`
-__attr(always_inline) __attr(nodiscard) __attr(not_null(1, 2)) static inline CnxOption(usize)
-	cnx_string_contains_cstring_from_left(const CnxString* restrict self,
-										  restrict const_cstring substring,
-										  usize substring_length,
-										  usize index) {
-	cnx_assert(index + substring_length < cnx_string_length(*self),
-			   "cnx_string_contains_cstring_from_left called with index + substring->m_length >= "
-			   "self->m_length (indices are out of bounds)");
-
-	if(0 == memcmp(&cnx_string_at(*self, index), substring, substring_length)) {
-		return Some(usize, index);
-	}
-	else {
-		return None(usize);
-	}
-}
-
-/// @brief Determines if the substring of `self` ending with `index` (inclusive)is the same as
-/// the given `substring`
-__attr(always_inline) __attr(nodiscard) __attr(not_null(1, 2)) static inline CnxOption(usize)
-	cnx_string_contains_cstring_from_right(const CnxString* restrict self,
-										   restrict const_cstring substring,
-										   usize substring_length,
-										   usize index) {
-	cnx_assert(
-		index >= substring_length,
-		"cnx_string_contains_cstring_from_right called with index < substring->m_length (index out "
-		"of bounds)");
-
-	let start_index = index - (substring_length - 1);
-	if(0 == memcmp(&cnx_string_at(*self, start_index), substring, substring_length)) {
-		return Some(usize, start_index);
-	}
-	else {
-		return None(usize);
-	}
+	return cnx_string_contains_cstring(self,
+									   cnx_string_into_cstring(*substring),
+									   cnx_string_length(*substring));
 }
 
 bool cnx_string_contains_cstring(const CnxString* restrict self,
 								 restrict const_cstring substring,
 								 usize substring_length) {
-	let length = cnx_string_length(*self);
-	if(length < substring_length) {
-		return false;
-	}
-	for(usize left = static_cast(usize)(0), right = length - 1;
-		right >= substring_length && left + substring_length < length;
-		++left, --right)
-	{
-
-		let contains_left
-			= cnx_string_contains_cstring_from_left(self, substring, substring_length, left);
-		if(cnx_option_is_some(contains_left)) {
-			return true;
-		}
-
-		let contains_right
-			= cnx_string_contains_cstring_from_right(self, substring, substring_length, right);
-		if(cnx_option_is_some(contains_right)) {
-			return true;
-		}
-	}
-
-	return false;
+	let found = cnx_string_search_first(cnx_string_into_cstring(*self),
+										cnx_string_length(*self),
+										substring,
+										substring_length);
+	return cnx_option_is_some(found);
 }
 
 bool cnx_string_contains_stringview(const CnxString* restrict self,
@@ -819,15 +738,16 @@ bool cnx_string_contains_stringview(const CnxString* restrict self,
 }
 
 bool(cnx_string_starts_with)(const CnxString* restrict self, const CnxString* restrict substring) {
-	let starts_with = cnx_string_contains_from_left(self, substring, 0);
-	return cnx_option_is_some(starts_with);
+	return cnx_string_starts_with_cstring(self,
+										  cnx_string_into_cstring(*substring),
+										  cnx_string_length(*substring));
 }
 
 bool cnx_string_starts_with_cstring(const CnxString* restrict self,
 									restrict const_cstring substring,
 									usize substring_length) {
-	let starts_with = cnx_string_contains_cstring_from_left(self, substring, substring_length, 0);
-	return cnx_option_is_some(starts_with);
+	return substring_length <= cnx_string_length(*self)
+		   && 0 == memcmp(cnx_string_into_cstring(*self), substring, substring_length);
 }
 
 bool cnx_string_starts_with_stringview(const CnxString* restrict self,
@@ -836,18 +756,20 @@ bool cnx_string_starts_with_stringview(const CnxString* restrict self,
 }
 
 bool(cnx_string_ends_with)(const CnxString* restrict self, const CnxString* restrict substring) {
-	let ends_with = cnx_string_contains_from_right(self, substring, cnx_string_length(*self) - 1);
-	return cnx_option_is_some(ends_with);
+	return cnx_string_ends_with_cstring(self,
+										cnx_string_into_cstring(*substring),
+										cnx_string_length(*substring));
 }
 
 bool cnx_string_ends_with_cstring(const CnxString* restrict self,
 								  restrict const_cstring substring,
 								  usize substring_length) {
-	let ends_with = cnx_string_contains_cstring_from_right(self,
-														   substring,
-														   substring_length,
-														   cnx_string_length(*self) - 1);
-	return cnx_option_is_some(ends_with);
+	let length = cnx_string_length(*self);
+	return substring_length <= length
+		   && 0
+				  == memcmp(cnx_string_into_cstring(*self) + (length - substring_length),
+							substring,
+							substring_length);
 }
 
 bool cnx_string_ends_with_stringview(const CnxString* restrict self,
@@ -857,42 +779,18 @@ bool cnx_string_ends_with_stringview(const CnxString* restrict self,
 
 CnxOption(usize)(cnx_string_find_first)(const CnxString* restrict self,
 										const CnxString* restrict substring) {
-	let length = cnx_string_length(*self);
-	let sublength = cnx_string_length(*substring);
-
-	if(sublength > length) {
-		return None(usize);
-	}
-
-	let end = length - sublength;
-	for(let_mut i = 0U; i < end; ++i) {
-		let maybe_contains = cnx_string_contains_from_left(self, substring, i);
-		if(cnx_option_is_some(maybe_contains)) {
-			return maybe_contains;
-		}
-	}
-
-	return None(usize);
+	return cnx_string_find_first_cstring(self,
+										 cnx_string_into_cstring(*substring),
+										 cnx_string_length(*substring));
 }
 
 CnxOption(usize) cnx_string_find_first_cstring(const CnxString* restrict self,
 											   restrict const_cstring substring,
 											   usize substring_length) {
-	let length = cnx_string_length(*self);
-	if(substring_length > length) {
-		return None(usize);
-	}
-
-	let end = length - substring_length;
-	for(let_mut i = 0U; i < end; ++i) {
-		let maybe_contains
-			= cnx_string_contains_cstring_from_left(self, substring, substring_length, i);
-		if(cnx_option_is_some(maybe_contains)) {
-			return maybe_contains;
-		}
-	}
-
-	return None(usize);
+	return cnx_string_search_first(cnx_string_into_cstring(*self),
+								   cnx_string_length(*self),
+								   substring,
+								   substring_length);
 }
 
 CnxOption(usize) cnx_string_find_first_stringview(const CnxString* restrict self,
@@ -902,39 +800,18 @@ CnxOption(usize) cnx_string_find_first_stringview(const CnxString* restrict self
 
 CnxOption(usize)(cnx_string_find_last)(const CnxString* restrict self,
 									   const CnxString* restrict substring) {
-	let length = cnx_string_length(*self);
-	let sublength = cnx_string_length(*substring);
-	if(sublength > length) {
-		return None(usize);
-	}
-
-	let end = sublength;
-	for(let_mut i = length - 1; i >= end; --i) {
-		let maybe_contains = cnx_string_contains_from_right(self, substring, i);
-		if(cnx_option_is_some(maybe_contains)) {
-			return maybe_contains;
-		}
-	}
-	return None(usize);
+	return cnx_string_find_last_cstring(self,
+										cnx_string_into_cstring(*substring),
+										cnx_string_length(*substring));
 }
 
 CnxOption(usize) cnx_string_find_last_cstring(const CnxString* restrict self,
 											  restrict const_cstring substring,
 											  usize substring_length) {
-	let length = cnx_string_length(*self);
-	if(substring_length > length) {
-		return None(usize);
-	}
-
-	let end = substring_length;
-	for(let_mut i = length - 1; i >= end; --i) {
-		let maybe_contains
-			= cnx_string_contains_cstring_from_right(self, substring, substring_length, i);
-		if(cnx_option_is_some(maybe_contains)) {
-			return maybe_contains;
-		}
-	}
-	return None(usize);
+	return cnx_string_search_last(cnx_string_into_cstring(*self),
+								  cnx_string_length(*self),
+								  substring,
+								  substring_length);
 }
 
 CnxOption(usize) cnx_string_find_last_stringview(const CnxString* restrict self,
@@ -1349,6 +1226,16 @@ void cnx_string_append_stringview(CnxString* restrict self,
 	cnx_string_append_cstring(self, to_append->m_view, to_append->m_length);
 }
 
+char_ptr(cnx_string_append_uninitialized)(CnxString* restrict self, usize num_characters) {
+	let capacity = cnx_string_capacity(*self);
+	let len = cnx_string_length(*self);
+	if(capacity < len + num_characters) {
+		cnx_string_reserve(*self, capacity + num_characters);
+	}
+	cnx_string_set_length(self, len + num_characters);
+	return cnx_string_is_short(self) ? &(self->m_short[len]) : &(self->m_long[len]);
+}
+
 void(cnx_string_prepend)(CnxString* restrict self, const CnxString* restrict to_prepend) {
 	cnx_string_insert(*self, to_prepend, 0U);
 }
@@ -1638,6 +1525,12 @@ CnxStringView cnx_stringview_from(restrict const_cstring string, usize index, us
 						   .m_vtable = &cnx_stringview_vtable};
 }
 
+CnxStringView cnx_stringview_from_raw(restrict const_cstring string, usize length) {
+	return (CnxStringView){.m_view = string,
+						   .m_length = length,
+						   .m_vtable = &cnx_stringview_vtable};
+}
+
 const_char_ptr(cnx_stringview_at)(const CnxStringView* restrict self, usize index) {
 	cnx_assert(index <= self->m_length,
 			   "cnx_stringview_at called with index > length (index out of bounds)");
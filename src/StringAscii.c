@@ -0,0 +1,181 @@
+/// @file StringAscii.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Vectorized ASCII case conversion, trimming, and case-insensitive comparison for
+/// `CnxString`s and `CnxStringView`s
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <Cnx/StringAscii.h>
+#include <Cnx/__string/__byte_scan.h>
+
+#undef cnx_stringview_trim
+#undef cnx_stringview_trim_start
+#undef cnx_stringview_trim_end
+#undef cnx_stringview_to_lower_with_allocator
+#undef cnx_stringview_to_upper_with_allocator
+#undef cnx_string_trim
+#undef cnx_string_trim_start
+#undef cnx_string_trim_end
+#undef cnx_string_to_lower_in_place
+#undef cnx_string_to_upper_in_place
+#undef cnx_string_to_lower
+#undef cnx_string_to_lower_with_allocator
+#undef cnx_string_to_upper
+#undef cnx_string_to_upper_with_allocator
+
+CnxStringView cnx_stringview_trim(const CnxStringView* restrict self) {
+	let start = cnx_stringview_trim_start(self);
+	return cnx_stringview_trim_end(&start);
+}
+
+CnxStringView cnx_stringview_trim_start(const CnxStringView* restrict self) {
+	let start = cnx_byte_scan_find_non_whitespace(self->m_view, self->m_length);
+	let_mut trimmed = *self;
+	trimmed.m_view += start;
+	trimmed.m_length -= start;
+	return trimmed;
+}
+
+CnxStringView cnx_stringview_trim_end(const CnxStringView* restrict self) {
+	let last = cnx_byte_scan_rfind_non_whitespace(self->m_view, self->m_length);
+	let_mut trimmed = *self;
+	trimmed.m_length = last == self->m_length ? 0 : last + 1;
+	return trimmed;
+}
+
+bool cnx_stringview_equal_ignore_case_cstring(const CnxStringView* restrict self,
+											  restrict const_cstring other,
+											  usize other_length) {
+	return self->m_length == other_length
+		   && cnx_byte_scan_equal_ignore_case(self->m_view, other, other_length);
+}
+
+bool cnx_stringview_starts_with_ignore_case_cstring(const CnxStringView* restrict self,
+													restrict const_cstring prefix,
+													usize prefix_length) {
+	return self->m_length >= prefix_length
+		   && cnx_byte_scan_equal_ignore_case(self->m_view, prefix, prefix_length);
+}
+
+bool cnx_stringview_ends_with_ignore_case_cstring(const CnxStringView* restrict self,
+												  restrict const_cstring suffix,
+												  usize suffix_length) {
+	return self->m_length >= suffix_length
+		   && cnx_byte_scan_equal_ignore_case(self->m_view + (self->m_length - suffix_length),
+											  suffix,
+											  suffix_length);
+}
+
+CnxString cnx_stringview_to_lower_with_allocator(const CnxStringView* restrict self,
+												 CnxAllocator allocator) {
+	let_mut string = cnx_string_new_with_capacity_with_allocator(self->m_length, allocator);
+	let out = cnx_string_append_uninitialized(string, self->m_length);
+	cnx_byte_scan_to_lower(self->m_view, self->m_length, out);
+	return string;
+}
+
+CnxString cnx_stringview_to_upper_with_allocator(const CnxStringView* restrict self,
+												 CnxAllocator allocator) {
+	let_mut string = cnx_string_new_with_capacity_with_allocator(self->m_length, allocator);
+	let out = cnx_string_append_uninitialized(string, self->m_length);
+	cnx_byte_scan_to_upper(self->m_view, self->m_length, out);
+	return string;
+}
+
+CnxStringView cnx_string_trim(const CnxString* restrict self) {
+	let view = cnx_string_into_stringview(*self);
+	return cnx_stringview_trim(&view);
+}
+
+CnxStringView cnx_string_trim_start(const CnxString* restrict self) {
+	let view = cnx_string_into_stringview(*self);
+	return cnx_stringview_trim_start(&view);
+}
+
+CnxStringView cnx_string_trim_end(const CnxString* restrict self) {
+	let view = cnx_string_into_stringview(*self);
+	return cnx_stringview_trim_end(&view);
+}
+
+bool cnx_string_equal_ignore_case_cstring(const CnxString* restrict self,
+										  restrict const_cstring other,
+										  usize other_length) {
+	let view = cnx_string_into_stringview(*self);
+	return cnx_stringview_equal_ignore_case_cstring(&view, other, other_length);
+}
+
+bool cnx_string_starts_with_ignore_case_cstring(const CnxString* restrict self,
+												restrict const_cstring prefix,
+												usize prefix_length) {
+	let view = cnx_string_into_stringview(*self);
+	return cnx_stringview_starts_with_ignore_case_cstring(&view, prefix, prefix_length);
+}
+
+bool cnx_string_ends_with_ignore_case_cstring(const CnxString* restrict self,
+											  restrict const_cstring suffix,
+											  usize suffix_length) {
+	let view = cnx_string_into_stringview(*self);
+	return cnx_stringview_ends_with_ignore_case_cstring(&view, suffix, suffix_length);
+}
+
+void cnx_string_to_lower_in_place(CnxString* restrict self) {
+	let length = cnx_string_length(*self);
+	if(length == 0) {
+		return;
+	}
+
+	let data = &cnx_string_at(*self, 0);
+	cnx_byte_scan_to_lower(data, length, data);
+}
+
+void cnx_string_to_upper_in_place(CnxString* restrict self) {
+	let length = cnx_string_length(*self);
+	if(length == 0) {
+		return;
+	}
+
+	let data = &cnx_string_at(*self, 0);
+	cnx_byte_scan_to_upper(data, length, data);
+}
+
+CnxString cnx_string_to_lower(const CnxString* restrict self) {
+	return cnx_string_to_lower_with_allocator(self, self->m_allocator);
+}
+
+CnxString cnx_string_to_lower_with_allocator(const CnxString* restrict self,
+											 CnxAllocator allocator) {
+	let view = cnx_string_into_stringview(*self);
+	return cnx_stringview_to_lower_with_allocator(&view, allocator);
+}
+
+CnxString cnx_string_to_upper(const CnxString* restrict self) {
+	return cnx_string_to_upper_with_allocator(self, self->m_allocator);
+}
+
+CnxString cnx_string_to_upper_with_allocator(const CnxString* restrict self,
+											 CnxAllocator allocator) {
+	let view = cnx_string_into_stringview(*self);
+	return cnx_stringview_to_upper_with_allocator(&view, allocator);
+}
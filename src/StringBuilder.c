@@ -0,0 +1,324 @@
+/// @file StringBuilder.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Chunked, incremental construction of large `CnxString`s
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+
+#include <Cnx/Assert.h>
+#include <Cnx/StringBuilder.h>
+#include <memory.h>
+
+#undef cnx_string_builder_free
+#undef cnx_string_builder_length
+#undef cnx_string_builder_is_empty
+#undef cnx_string_builder_clear
+#undef cnx_string_builder_push_back
+#undef cnx_string_builder_push_front
+#undef cnx_string_builder_append_format
+#undef cnx_string_builder_prepend_format
+#undef cnx_string_builder_build
+#undef cnx_string_builder_build_with_allocator
+#undef cnx_string_builder_write_to_file
+
+#define CNX_STRING_BUILDER_MIN_NUM_CHUNKS 4
+
+/// @brief Returns the capacity of the next chunk to allocate for the given `CnxStringBuilder`,
+/// so that it can hold at least `required` characters. Chunk sizes grow with the total length,
+/// so the number of chunks stays logarithmic in the length of the contents
+__attr(always_inline) static inline usize
+next_chunk_capacity(const CnxStringBuilder* restrict self, usize required) {
+	let capacity = self->m_length > CNX_STRING_BUILDER_MIN_CHUNK_SIZE ?
+						   self->m_length :
+						   static_cast(usize)(CNX_STRING_BUILDER_MIN_CHUNK_SIZE);
+	return capacity > required ? capacity : required;
+}
+
+/// @brief Pushes a new, empty chunk with the given capacity onto the given list of chunks
+static CnxStringBuilderChunk* push_chunk(CnxStringBuilder* restrict self,
+										 CnxStringBuilderChunk** restrict chunks,
+										 usize* restrict num_chunks,
+										 usize* restrict chunks_capacity,
+										 usize capacity) {
+	if(*num_chunks == *chunks_capacity) {
+		let new_capacity = *chunks_capacity == 0 ?
+							   static_cast(usize)(CNX_STRING_BUILDER_MIN_NUM_CHUNKS) :
+							   *chunks_capacity * 2;
+		*chunks = *chunks == nullptr ?
+					  cnx_allocator_allocate_array_t(CnxStringBuilderChunk,
+													 self->m_allocator,
+													 new_capacity) :
+					  cnx_allocator_reallocate_array_t(CnxStringBuilderChunk,
+													   self->m_allocator,
+													   *chunks,
+													   *chunks_capacity,
+													   new_capacity);
+		*chunks_capacity = new_capacity;
+	}
+
+	let chunk = &((*chunks)[*num_chunks]);
+	*chunk = (CnxStringBuilderChunk){
+		.m_data = cnx_allocator_allocate_array_t(char, self->m_allocator, capacity),
+		.m_length = 0,
+		.m_capacity = capacity,
+	};
+	++(*num_chunks);
+	return chunk;
+}
+
+/// @brief Frees the memory of the given chunks, starting at `first`
+static void free_chunks(CnxStringBuilder* restrict self,
+						CnxStringBuilderChunk* restrict chunks,
+						usize first,
+						usize num_chunks) {
+	for(let_mut i = first; i < num_chunks; ++i) {
+		cnx_allocator_deallocate(self->m_allocator, chunks[i].m_data);
+	}
+}
+
+CnxStringBuilder cnx_string_builder_new_with_allocator(CnxAllocator allocator) {
+	return (CnxStringBuilder){.m_chunks = nullptr,
+							  .m_num_chunks = 0,
+							  .m_chunks_capacity = 0,
+							  .m_prefix_chunks = nullptr,
+							  .m_num_prefix_chunks = 0,
+							  .m_prefix_chunks_capacity = 0,
+							  .m_length = 0,
+							  .m_allocator = allocator};
+}
+
+CnxStringBuilder
+cnx_string_builder_new_with_capacity_with_allocator(usize capacity, CnxAllocator allocator) {
+	let_mut builder = cnx_string_builder_new_with_allocator(allocator);
+	ignore(push_chunk(&builder,
+					  &builder.m_chunks,
+					  &builder.m_num_chunks,
+					  &builder.m_chunks_capacity,
+					  next_chunk_capacity(&builder, capacity)));
+	return builder;
+}
+
+void cnx_string_builder_free(void* restrict self) {
+	let self_ptr = static_cast(CnxStringBuilder*)(self);
+	free_chunks(self_ptr, self_ptr->m_chunks, 0, self_ptr->m_num_chunks);
+	free_chunks(self_ptr, self_ptr->m_prefix_chunks, 0, self_ptr->m_num_prefix_chunks);
+	if(self_ptr->m_chunks != nullptr) {
+		cnx_allocator_deallocate(self_ptr->m_allocator, self_ptr->m_chunks);
+	}
+	if(self_ptr->m_prefix_chunks != nullptr) {
+		cnx_allocator_deallocate(self_ptr->m_allocator, self_ptr->m_prefix_chunks);
+	}
+	*self_ptr = cnx_string_builder_new_with_allocator(self_ptr->m_allocator);
+}
+
+void cnx_string_builder_clear(CnxStringBuilder* restrict self) {
+	if(self->m_num_chunks > 0) {
+		free_chunks(self, self->m_chunks, 1, self->m_num_chunks);
+		self->m_num_chunks = 1;
+		self->m_chunks[0].m_length = 0;
+	}
+	free_chunks(self, self->m_prefix_chunks, 0, self->m_num_prefix_chunks);
+	self->m_num_prefix_chunks = 0;
+	self->m_length = 0;
+}
+
+void cnx_string_builder_append_cstring(CnxStringBuilder* restrict self,
+									   restrict const_cstring string,
+									   usize length) {
+	let_mut remaining = length;
+	if(self->m_num_chunks > 0) {
+		let tail = &(self->m_chunks[self->m_num_chunks - 1]);
+		let space = tail->m_capacity - tail->m_length;
+		let to_copy = space < remaining ? space : remaining;
+		cnx_memcpy(char, tail->m_data + tail->m_length, string, to_copy);
+		tail->m_length += to_copy;
+		remaining -= to_copy;
+	}
+
+	if(remaining > 0) {
+		// the rest always fits in a single new chunk
+		let chunk = push_chunk(self,
+							   &self->m_chunks,
+							   &self->m_num_chunks,
+							   &self->m_chunks_capacity,
+							   next_chunk_capacity(self, remaining));
+		cnx_memcpy(char, chunk->m_data, string + (length - remaining), remaining);
+		chunk->m_length = remaining;
+	}
+
+	self->m_length += length;
+}
+
+void cnx_string_builder_prepend_cstring(CnxStringBuilder* restrict self,
+										restrict const_cstring string,
+										usize length) {
+	// prefix chunks are filled back to front, so the end of `string` goes into the current head
+	// chunk and whatever doesn't fit goes into a new one
+	let_mut remaining = length;
+	if(self->m_num_prefix_chunks > 0) {
+		let head = &(self->m_prefix_chunks[self->m_num_prefix_chunks - 1]);
+		let space = head->m_capacity - head->m_length;
+		let to_copy = space < remaining ? space : remaining;
+		head->m_length += to_copy;
+		remaining -= to_copy;
+		cnx_memcpy(char,
+				   head->m_data + (head->m_capacity - head->m_length),
+				   string + remaining,
+				   to_copy);
+	}
+
+	if(remaining > 0) {
+		let chunk = push_chunk(self,
+							   &self->m_prefix_chunks,
+							   &self->m_num_prefix_chunks,
+							   &self->m_prefix_chunks_capacity,
+							   next_chunk_capacity(self, remaining));
+		chunk->m_length = remaining;
+		cnx_memcpy(char, chunk->m_data + (chunk->m_capacity - remaining), string, remaining);
+	}
+
+	self->m_length += length;
+}
+
+void cnx_string_builder_push_back(CnxStringBuilder* restrict self, char character) {
+	cnx_string_builder_append_cstring(self, &character, 1);
+}
+
+void cnx_string_builder_push_front(CnxStringBuilder* restrict self, char character) {
+	cnx_string_builder_prepend_cstring(self, &character, 1);
+}
+
+/// @brief `CnxFormatSink` that appends to the `CnxStringBuilder` `target`
+static void append_piece(void* restrict target, restrict const_cstring piece, usize length) {
+	cnx_string_builder_append_cstring(static_cast(CnxStringBuilder*)(target), piece, length);
+}
+
+void(cnx_string_builder_append_format)(CnxStringBuilder* restrict self,
+									   restrict const_cstring format_string,
+									   usize num_args,
+									   ...) {
+	va_list list = {0};
+	va_start(list, num_args);
+	cnx_vformat_into(self, append_piece, format_string, self->m_allocator, num_args, list);
+	va_end(list);
+}
+
+void(cnx_string_builder_prepend_format)(CnxStringBuilder* restrict self,
+										restrict const_cstring format_string,
+										usize num_args,
+										...) {
+	// the output arrives front to back, but prefix chunks are filled back to front, so format
+	// into the tail like `cnx_string_builder_append_format` does, then move the result to the
+	// front, taking the chunks it landed in last to first
+	let num_chunks = self->m_num_chunks;
+	let tail_length = num_chunks > 0 ? self->m_chunks[num_chunks - 1].m_length : 0U;
+	let length = self->m_length;
+
+	va_list list = {0};
+	va_start(list, num_args);
+	cnx_vformat_into(self, append_piece, format_string, self->m_allocator, num_args, list);
+	va_end(list);
+
+	let formatted_length = self->m_length - length;
+	let first = num_chunks > 0 ? num_chunks - 1 : 0U;
+	for(let_mut i = self->m_num_chunks; i > first;) {
+		--i;
+		let chunk = &(self->m_chunks[i]);
+		let start = i == first ? tail_length : 0U;
+		cnx_string_builder_prepend_cstring(self, chunk->m_data + start, chunk->m_length - start);
+		chunk->m_length = start;
+	}
+
+	// the chunks the output spilled into are empty again, so drop them (keeping one, if the
+	// builder had none, to append into later)
+	let keep = num_chunks > 0 ? num_chunks : 1U;
+	if(self->m_num_chunks > keep) {
+		free_chunks(self, self->m_chunks, keep, self->m_num_chunks);
+		self->m_num_chunks = keep;
+	}
+	self->m_length = length + formatted_length;
+}
+
+CnxString cnx_string_builder_build(const CnxStringBuilder* restrict self) {
+	return cnx_string_builder_build_with_allocator(self, self->m_allocator);
+}
+
+CnxString cnx_string_builder_build_with_allocator(const CnxStringBuilder* restrict self,
+												  CnxAllocator allocator) {
+	let_mut string = cnx_string_new_with_capacity_with_allocator(self->m_length, allocator);
+	for(let_mut i = self->m_num_prefix_chunks; i > 0; --i) {
+		let chunk = &(self->m_prefix_chunks[i - 1]);
+		cnx_string_append_cstring(&string,
+								  chunk->m_data + (chunk->m_capacity - chunk->m_length),
+								  chunk->m_length);
+	}
+	for(let_mut i = 0U; i < self->m_num_chunks; ++i) {
+		let chunk = &(self->m_chunks[i]);
+		cnx_string_append_cstring(&string, chunk->m_data, chunk->m_length);
+	}
+
+	return string;
+}
+
+/// @brief Writes the given characters to the given file, adding the number of bytes written to
+/// `written`
+__attr(always_inline) static inline CnxResult(usize)
+	write_chunk(CnxFile* restrict file, const char* data, usize length, usize written) {
+	if(length == 0) {
+		return Ok(usize, written);
+	}
+
+	let_mut res = cnx_file_write_bytes(file, static_cast(const u8*)(static_cast(const void*)(data)),
+									   length);
+	if(cnx_result_is_err(res)) {
+		return Err(usize, cnx_result_unwrap_err(res));
+	}
+
+	return Ok(usize, written + length);
+}
+
+CnxResult(usize) cnx_string_builder_write_to_file(const CnxStringBuilder* restrict self,
+												  CnxFile* restrict file) {
+	let_mut res = Ok(usize, 0);
+	for(let_mut i = self->m_num_prefix_chunks; i > 0; --i) {
+		let chunk = &(self->m_prefix_chunks[i - 1]);
+		res = write_chunk(file,
+						  chunk->m_data + (chunk->m_capacity - chunk->m_length),
+						  chunk->m_length,
+						  cnx_result_unwrap(res));
+		if(cnx_result_is_err(res)) {
+			return res;
+		}
+	}
+	for(let_mut i = 0U; i < self->m_num_chunks; ++i) {
+		let chunk = &(self->m_chunks[i]);
+		res = write_chunk(file, chunk->m_data, chunk->m_length, cnx_result_unwrap(res));
+		if(cnx_result_is_err(res)) {
+			return res;
+		}
+	}
+
+	return res;
+}
@@ -28,6 +28,9 @@
 #include <Cnx/Assert.h>
 #include <Cnx/Math.h>
 #include <Cnx/StringExt.h>
+#include <Cnx/StringSearch.h>
+#include <Cnx/StringSplit.h>
+#include <Cnx/__string/__byte_scan.h>
 
 CnxVector(CnxString)(cnx_string_split_on)(const CnxString* restrict self, char delimiter) {
 	return cnx_string_split_on_with_allocator(*self, delimiter, self->m_allocator);
@@ -38,30 +41,12 @@ CnxVector(CnxString)(cnx_string_split_on_with_allocator)(const CnxString* restri
 														 CnxAllocator allocator) {
 	let_mut vec = cnx_vector_new_with_allocator(CnxString, allocator);
 
-	let size = cnx_string_size(*self);
-	let_mut start = static_cast(usize)(0);
-	for(let_mut index = static_cast(usize)(0); index < size; ++index) {
-		if(cnx_string_at(*self, index) == delimiter) {
-			if(index != 0) {
-				let length = index - start;
-				if(length > 0) {
-					let view = cnx_string_stringview_of(*self, start, length);
-					cnx_vector_push_back(vec, cnx_string_from_with_allocator(&view, allocator));
-					start = cnx_min(index + 1, size);
-				}
-			}
-			else {
-				start = 1;
-			}
-		}
-	}
-
-	// if we haven't found at least one instance of `delimiter`, forward a copy of `self`
-	// OR if the string doesn't end with 'delimiter', make sure we push the last substring
-	if(start != size) {
-		let length = size - start;
-		let view = cnx_string_stringview_of(*self, start, length);
-		cnx_vector_push_back(vec, cnx_string_from_with_allocator(&view, allocator));
+	let_mut split = cnx_split_iterator_new(cnx_stringview_new(self),
+										   &delimiter,
+										   1,
+										   (CnxSplitOptions){.m_skip_empty = true});
+	foreach(piece, split) {
+		cnx_vector_push_back(vec, cnx_string_from_with_allocator(&piece, allocator));
 	}
 
 	return vec;
@@ -76,89 +61,41 @@ CnxVector(CnxStringView)(cnx_string_view_split_on_with_allocator)(const CnxStrin
 																  CnxAllocator allocator) {
 	let_mut vec = cnx_vector_new_with_allocator(CnxStringView, allocator);
 
-	let size = cnx_string_size(*self);
-	let_mut start = static_cast(usize)(0);
-	for(let_mut index = static_cast(usize)(0); index < size; ++index) {
-		if(cnx_string_at(*self, index) == delimiter) {
-			if(index != 0) {
-				let length = index - start;
-				if(length > 0) {
-					let view = cnx_string_stringview_of(*self, start, length);
-					cnx_vector_push_back(vec, view);
-					start = cnx_min(index + 1, size);
-				}
-			}
-			else {
-				start = 1;
-			}
-		}
-	}
-
-	// if we haven't found at least one instance of `delimiter`, forward a copy of `self`
-	// OR if the string doesn't end with 'delimiter', make sure we push the last substring
-	if(start != size) {
-		let length = size - start;
-		let view = cnx_string_stringview_of(*self, start, length);
-		cnx_vector_push_back(vec, view);
+	let_mut split = cnx_split_iterator_new(cnx_stringview_new(self),
+										   &delimiter,
+										   1,
+										   (CnxSplitOptions){.m_skip_empty = true});
+	foreach(piece, split) {
+		cnx_vector_push_back(vec, piece);
 	}
 
 	return vec;
 }
 
 usize(cnx_string_occurrences_of_char)(const CnxString* restrict self, char to_find) {
-
-	let_mut count = static_cast(usize)(0);
-	foreach(elem, *self) {
-		if(elem == to_find) {
-			count++;
-		}
-	}
-
-	return count;
+	return cnx_byte_scan_count(cnx_string_into_cstring(*self), cnx_string_size(*self), to_find);
 }
 
 // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
 usize(cnx_string_occurrences_of)(const CnxString* restrict self,
 								 const CnxString* restrict to_find) {
-
-	let_mut count = static_cast(usize)(0);
-	let size = cnx_string_size(*self);
-	let find_size = cnx_string_size(*to_find);
-	for(let_mut index = static_cast(usize)(0); index < size; ++index) {
-		if(index + find_size <= size) {
-			let view = cnx_string_stringview_of(*self, index, find_size);
-			if(cnx_string_equal(*to_find, &view)) {
-				count++;
-			}
-		}
-	}
-
-	return count;
+	return cnx_string_occurrences_of_cstring(self,
+											 cnx_string_into_cstring(*to_find),
+											 cnx_string_size(*to_find));
 }
 
 usize cnx_string_occurrences_of_stringview(const CnxString* restrict self,
 										   const CnxStringView* restrict to_find) {
-
-	let_mut count = static_cast(usize)(0);
-	let size = cnx_string_size(*self);
-	let find_size = cnx_stringview_size(*to_find);
-	for(let_mut index = static_cast(usize)(0); index < size; ++index) {
-		if(index + find_size <= size) {
-			let view = cnx_string_stringview_of(*self, index, find_size);
-			if(cnx_stringview_equal(*to_find, &view)) {
-				count++;
-			}
-		}
-	}
-
-	return count;
+	return cnx_string_occurrences_of_cstring(self, to_find->m_view, to_find->m_length);
 }
 
 usize cnx_string_occurrences_of_cstring(const CnxString* restrict self,
 										restrict const_cstring to_find,
 										usize to_find_length) {
-	let to_find_view = cnx_stringview_from(to_find, 0, to_find_length);
-	return cnx_string_occurrences_of_stringview(self, &to_find_view);
+	return cnx_string_search_count(cnx_string_into_cstring(*self),
+								   cnx_string_size(*self),
+								   to_find,
+								   to_find_length);
 }
 
 CnxVector(usize)(cnx_string_find_occurrences_of_char)(const CnxString* restrict self,
@@ -191,11 +128,20 @@ CnxVector(usize)(cnx_string_find_occurrences_of_char_with_allocator)(const CnxSt
 																	 char to_find,
 																	 CnxAllocator allocator) {
 	let_mut vec = cnx_vector_new_with_allocator(usize, allocator);
+	let data = cnx_string_into_cstring(*self);
 	let size = cnx_string_size(*self);
-	for(let_mut index = static_cast(usize)(0); index < size; ++index) {
-		if(cnx_string_at(*self, index) == to_find) {
-			cnx_vector_push_back(vec, index);
-		}
+
+	// count first so the result is allocated exactly once
+	let count = cnx_byte_scan_count(data, size, to_find);
+	if(count == 0) {
+		return vec;
+	}
+
+	cnx_vector_reserve(vec, count);
+	for(let_mut index = cnx_byte_scan_find(data, size, to_find); index < size;
+		index += 1 + cnx_byte_scan_find(data + index + 1, size - index - 1, to_find))
+	{
+		cnx_vector_push_back(vec, index);
 	}
 
 	return vec;
@@ -205,46 +151,94 @@ CnxVector(usize)(cnx_string_find_occurrences_of_char_with_allocator)(const CnxSt
 CnxVector(usize)(cnx_string_find_occurrences_of_with_allocator)(const CnxString* restrict self,
 																const CnxString* restrict to_find,
 																CnxAllocator allocator) {
-	let_mut vec = cnx_vector_new_with_allocator(usize, allocator);
-	let size = cnx_string_size(*self);
-	let find_size = cnx_string_size(*to_find);
-	for(let_mut index = static_cast(usize)(0); index < size; ++index) {
-		if(index + find_size <= size) {
-			let view = cnx_string_stringview_of(*self, index, find_size);
-			if(cnx_string_equal(*to_find, &view)) {
-				cnx_vector_push_back(vec, index);
-			}
-		}
-	}
-
-	return vec;
+	return cnx_string_find_occurrences_of_cstring_with_allocator(self,
+																 cnx_string_into_cstring(*to_find),
+																 cnx_string_size(*to_find),
+																 allocator);
 }
 
 CnxVector(usize)
 	cnx_string_find_occurrences_of_stringview_with_allocator(const CnxString* restrict self,
 															 const CnxStringView* restrict to_find,
 															 CnxAllocator allocator) {
+	return cnx_string_find_occurrences_of_cstring_with_allocator(self,
+																 to_find->m_view,
+																 to_find->m_length,
+																 allocator);
+}
 
+CnxVector(usize)
+	cnx_string_find_occurrences_of_cstring_with_allocator(const CnxString* restrict self,
+														  restrict const_cstring to_find,
+														  usize to_find_length,
+														  CnxAllocator allocator) {
 	let_mut vec = cnx_vector_new_with_allocator(usize, allocator);
+	let haystack = cnx_string_into_cstring(*self);
 	let size = cnx_string_size(*self);
-	let find_size = cnx_stringview_size(*to_find);
-	for(let_mut index = static_cast(usize)(0); index < size; ++index) {
-		if(index + find_size <= size) {
-			let view = cnx_string_stringview_of(*self, index, find_size);
-			if(cnx_stringview_equal(*to_find, &view)) {
-				cnx_vector_push_back(vec, index);
-			}
+	let_mut start = static_cast(usize)(0);
+	while(start < size) {
+		let_mut found
+			= cnx_string_search_first(haystack + start, size - start, to_find, to_find_length);
+		if(cnx_option_is_none(found)) {
+			break;
 		}
+
+		let index = start + cnx_option_unwrap(found);
+		cnx_vector_push_back(vec, index);
+		start = index + 1;
 	}
 
 	return vec;
 }
 
-CnxVector(usize)
-	cnx_string_find_occurrences_of_cstring_with_allocator(const CnxString* restrict self,
-														  restrict const_cstring to_find,
-														  usize to_find_length,
-														  CnxAllocator allocator) {
-	let to_find_view = cnx_stringview_from(to_find, 0, to_find_length);
-	return cnx_string_find_occurrences_of_stringview_with_allocator(self, &to_find_view, allocator);
+CnxString cnx_string_join_stringviews_with_allocator(restrict const_cstring separator,
+													 usize separator_length,
+													 const CnxStringView* restrict views,
+													 usize num_views,
+													 CnxAllocator allocator) {
+	if(num_views == 0) {
+		return cnx_string_new_with_allocator(allocator);
+	}
+
+	let_mut length = separator_length * (num_views - 1);
+	for(let_mut i = 0U; i < num_views; ++i) {
+		length += views[i].m_length;
+	}
+
+	let_mut string = cnx_string_new_with_capacity_with_allocator(length, allocator);
+	for(let_mut i = 0U; i < num_views; ++i) {
+		if(i != 0) {
+			cnx_string_append_cstring(&string, separator, separator_length);
+		}
+		cnx_string_append_cstring(&string, views[i].m_view, views[i].m_length);
+	}
+
+	return string;
+}
+
+CnxString cnx_string_join_strings_with_allocator(restrict const_cstring separator,
+												 usize separator_length,
+												 const CnxString* restrict strings,
+												 usize num_strings,
+												 CnxAllocator allocator) {
+	if(num_strings == 0) {
+		return cnx_string_new_with_allocator(allocator);
+	}
+
+	let_mut length = separator_length * (num_strings - 1);
+	for(let_mut i = 0U; i < num_strings; ++i) {
+		length += cnx_string_length(strings[i]);
+	}
+
+	let_mut string = cnx_string_new_with_capacity_with_allocator(length, allocator);
+	for(let_mut i = 0U; i < num_strings; ++i) {
+		if(i != 0) {
+			cnx_string_append_cstring(&string, separator, separator_length);
+		}
+		cnx_string_append_cstring(&string,
+								  cnx_string_into_cstring(strings[i]),
+								  cnx_string_length(strings[i]));
+	}
+
+	return string;
 }
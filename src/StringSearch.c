@@ -0,0 +1,485 @@
+/// @file StringSearch.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Substring search for `CnxString`, `CnxStringView`, and raw byte strings
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <Cnx/Assert.h>
+#include <Cnx/Platform.h>
+#include <Cnx/StringSearch.h>
+#include <memory.h>
+
+#if(CNX_PLATFORM_COMPILER_GCC || CNX_PLATFORM_COMPILER_CLANG) \
+	&& (defined(__x86_64__) || defined(_M_X64))
+	/// @brief Whether the SSE2 and AVX2 search kernels are available for this target
+	#define CNX_STRING_SEARCH_SIMD_KERNELS 1
+	#include <immintrin.h>
+#else
+	/// @brief Whether the SSE2 and AVX2 search kernels are available for this target
+	#define CNX_STRING_SEARCH_SIMD_KERNELS 0
+#endif
+
+/// @brief Sentinel index returned by the search kernels when the needle isn't found
+#define NOT_FOUND (cnx_max_value(usize))
+
+#if CNX_STRING_SEARCH_SIMD_KERNELS
+
+__attr(always_inline) __attr(nodiscard) static inline bool cpu_has_avx2(void) {
+	return __builtin_cpu_supports("avx2");
+}
+
+#endif // CNX_STRING_SEARCH_SIMD_KERNELS
+
+/// @brief Returns whether the middle of the needle (everything but its first and last bytes)
+/// matches the haystack at `candidate`. The first and last bytes must already be known to match
+__attr(always_inline) __attr(nodiscard) static inline bool
+	middle_matches(const u8* restrict haystack,
+				   usize candidate,
+				   const u8* restrict needle,
+				   usize needle_length) {
+	return needle_length <= 2
+		   || 0 == memcmp(haystack + candidate + 1, needle + 1, needle_length - 2);
+}
+
+// The block-filtered kernels below search the candidate positions `[start, end)` (or `[0, end)`
+// in reverse), where `end = haystack_length - needle_length + 1`. For each block of candidate
+// positions they compare the first byte of the needle against the block, and the last byte of the
+// needle against the block shifted by `needle_length - 1`, and only fully compare positions
+// where both match. They require `2 <= needle_length <= haystack_length`.
+
+static usize find_first_filtered_scalar(const u8* restrict haystack,
+										usize haystack_length,
+										const u8* restrict needle,
+										usize needle_length,
+										usize start) {
+	let end = haystack_length - needle_length + 1;
+	let last = needle_length - 1;
+	let_mut i = start;
+	while(i < end) {
+		let found = static_cast(const u8*)(memchr(haystack + i, needle[0], end - i));
+		if(found == nullptr) {
+			return NOT_FOUND;
+		}
+
+		i = static_cast(usize)(found - haystack);
+		if(haystack[i + last] == needle[last]
+		   && middle_matches(haystack, i, needle, needle_length))
+		{
+			return i;
+		}
+		++i;
+	}
+
+	return NOT_FOUND;
+}
+
+static usize find_last_filtered_scalar(const u8* restrict haystack,
+									   const u8* restrict needle,
+									   usize needle_length,
+									   usize end) {
+	let last = needle_length - 1;
+	for(let_mut i = end; i > 0;) {
+		--i;
+		if(haystack[i] == needle[0] && haystack[i + last] == needle[last]
+		   && middle_matches(haystack, i, needle, needle_length))
+		{
+			return i;
+		}
+	}
+
+	return NOT_FOUND;
+}
+
+#if CNX_STRING_SEARCH_SIMD_KERNELS
+
+	/// @brief Generates the forward and reverse block-filtered search kernels for a SIMD width
+	#define FILTERED_SEARCH_KERNELS(suffix, target_attr, vector_t, width, set1, loadu, cmpeq, and, \
+									movemask)                                                    \
+		target_attr static usize find_first_filtered_##suffix(const u8* restrict haystack,      \
+															  usize haystack_length,            \
+															  const u8* restrict needle,        \
+															  usize needle_length,              \
+															  usize start) {                    \
+			let first = set1(static_cast(char)(needle[0]));                                     \
+			let last = set1(static_cast(char)(needle[needle_length - 1]));                      \
+			let end = haystack_length - needle_length + 1;                                      \
+			let_mut i = start;                                                                  \
+			for(; i + (width) <= end; i += (width)) {                                           \
+				let block_first                                                                 \
+					= loadu(static_cast(const vector_t*)(static_cast(const void*)(haystack + i))); \
+				let block_last = loadu(static_cast(const vector_t*)(                            \
+					static_cast(const void*)(haystack + i + needle_length - 1)));               \
+				let_mut mask = static_cast(u32)(                                                \
+					movemask(and(cmpeq(first, block_first), cmpeq(last, block_last))));        \
+				while(mask != 0) {                                                              \
+					let bit = static_cast(usize)(__builtin_ctz(mask));                          \
+					if(middle_matches(haystack, i + bit, needle, needle_length)) {              \
+						return i + bit;                                                         \
+					}                                                                           \
+					mask &= mask - 1;                                                           \
+				}                                                                               \
+			}                                                                                   \
+                                                                                                \
+			return find_first_filtered_scalar(haystack, haystack_length, needle, needle_length, \
+											  i);                                               \
+		}                                                                                       \
+                                                                                                \
+		target_attr static usize find_last_filtered_##suffix(const u8* restrict haystack,       \
+															 const u8* restrict needle,         \
+															 usize needle_length,               \
+															 usize end) {                       \
+			let first = set1(static_cast(char)(needle[0]));                                     \
+			let last = set1(static_cast(char)(needle[needle_length - 1]));                      \
+			let_mut i = end;                                                                    \
+			for(; i >= (width); i -= (width)) {                                                 \
+				let base = i - (width);                                                         \
+				let block_first = loadu(                                                        \
+					static_cast(const vector_t*)(static_cast(const void*)(haystack + base)));   \
+				let block_last = loadu(static_cast(const vector_t*)(                            \
+					static_cast(const void*)(haystack + base + needle_length - 1)));            \
+				let_mut mask = static_cast(u32)(                                                \
+					movemask(and(cmpeq(first, block_first), cmpeq(last, block_last))));        \
+				while(mask != 0) {                                                              \
+					let bit = static_cast(usize)(31 - __builtin_clz(mask));                     \
+					if(middle_matches(haystack, base + bit, needle, needle_length)) {           \
+						return base + bit;                                                      \
+					}                                                                           \
+					mask &= ~(static_cast(u32)(1) << bit);                                      \
+				}                                                                               \
+			}                                                                                   \
+                                                                                                \
+			return find_last_filtered_scalar(haystack, needle, needle_length, i);               \
+		}
+
+	// SSE2 is part of the x86_64 baseline, so its kernels don't need a target attribute or a
+	// runtime check
+	#define NO_TARGET_ATTR
+FILTERED_SEARCH_KERNELS(sse2,
+						NO_TARGET_ATTR,
+						__m128i,
+						16,
+						_mm_set1_epi8,
+						_mm_loadu_si128,
+						_mm_cmpeq_epi8,
+						_mm_and_si128,
+						_mm_movemask_epi8)
+FILTERED_SEARCH_KERNELS(avx2,
+						__attr(target("avx2")),
+						__m256i,
+						32,
+						_mm256_set1_epi8,
+						_mm256_loadu_si256,
+						_mm256_cmpeq_epi8,
+						_mm256_and_si256,
+						_mm256_movemask_epi8)
+	#undef NO_TARGET_ATTR
+
+#endif // CNX_STRING_SEARCH_SIMD_KERNELS
+
+__attr(always_inline) static inline usize find_first_filtered(const u8* restrict haystack,
+															   usize haystack_length,
+															   const u8* restrict needle,
+															   usize needle_length,
+															   usize start) {
+#if CNX_STRING_SEARCH_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		return find_first_filtered_avx2(haystack, haystack_length, needle, needle_length, start);
+	}
+
+	return find_first_filtered_sse2(haystack, haystack_length, needle, needle_length, start);
+#else
+	return find_first_filtered_scalar(haystack, haystack_length, needle, needle_length, start);
+#endif // CNX_STRING_SEARCH_SIMD_KERNELS
+}
+
+__attr(always_inline) static inline usize find_last_filtered(const u8* restrict haystack,
+															  usize haystack_length,
+															  const u8* restrict needle,
+															  usize needle_length) {
+	let end = haystack_length - needle_length + 1;
+#if CNX_STRING_SEARCH_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		return find_last_filtered_avx2(haystack, needle, needle_length, end);
+	}
+
+	return find_last_filtered_sse2(haystack, needle, needle_length, end);
+#else
+	return find_last_filtered_scalar(haystack, needle, needle_length, end);
+#endif // CNX_STRING_SEARCH_SIMD_KERNELS
+}
+
+/// @brief Finds the first occurrence of `needle` in `haystack` with the Two-Way algorithm
+/// (Crochemore & Perrin, 1991), combined with a last-byte shift table for sublinear skipping on
+/// typical inputs. Requires `needle_length <= haystack_length`.
+static usize find_first_two_way(const u8* restrict haystack,
+								usize haystack_length,
+								const u8* restrict needle,
+								usize needle_length) {
+	// byte_set[b] is set if `b` occurs in the needle, shift[b] is one past the last index of `b`
+	// in the needle
+	bool byte_set[256] = {0}; // NOLINT
+	usize shift[256];		  // NOLINT
+	for(let_mut i = static_cast(usize)(0); i < needle_length; ++i) {
+		byte_set[needle[i]] = true;
+		shift[needle[i]] = i + 1;
+	}
+
+	// compute the critical factorization from the maximal suffixes under both orderings.
+	// `suffix` starts at "-1", relying on unsigned wraparound, as is conventional for this
+	// formulation
+	let_mut suffix = cnx_max_value(usize);
+	let_mut j = static_cast(usize)(0);
+	let_mut k = static_cast(usize)(1);
+	let_mut period = static_cast(usize)(1);
+	while(j + k < needle_length) {
+		let lhs = needle[suffix + k];
+		let rhs = needle[j + k];
+		if(lhs == rhs) {
+			if(k == period) {
+				j += period;
+				k = 1;
+			}
+			else {
+				++k;
+			}
+		}
+		else if(lhs > rhs) {
+			j += k;
+			k = 1;
+			period = j - suffix;
+		}
+		else {
+			suffix = j++;
+			k = period = 1;
+		}
+	}
+	let_mut critical = suffix;
+	let first_period = period;
+
+	suffix = cnx_max_value(usize);
+	j = 0;
+	k = period = 1;
+	while(j + k < needle_length) {
+		let lhs = needle[suffix + k];
+		let rhs = needle[j + k];
+		if(lhs == rhs) {
+			if(k == period) {
+				j += period;
+				k = 1;
+			}
+			else {
+				++k;
+			}
+		}
+		else if(lhs < rhs) {
+			j += k;
+			k = 1;
+			period = j - suffix;
+		}
+		else {
+			suffix = j++;
+			k = period = 1;
+		}
+	}
+	if(suffix + 1 > critical + 1) {
+		critical = suffix;
+	}
+	else {
+		period = first_period;
+	}
+
+	// for periodic needles we remember how much of the needle is already known to match after a
+	// shift by the period, so that search stays linear
+	let_mut memory_on_shift = static_cast(usize)(0);
+	if(0 != memcmp(needle, needle + period, critical + 1)) {
+		let left = critical;
+		let right = needle_length - critical - 1;
+		period = (left > right ? left : right) + 1;
+	}
+	else {
+		memory_on_shift = needle_length - period;
+	}
+
+	let_mut memory = static_cast(usize)(0);
+	let_mut position = static_cast(usize)(0);
+	while(haystack_length - position >= needle_length) {
+		let window = haystack + position;
+
+		// check the last byte first, skipping ahead by the shift table on mismatch
+		let last_byte = window[needle_length - 1];
+		if(!byte_set[last_byte]) {
+			position += needle_length;
+			memory = 0;
+			continue;
+		}
+		let skip = needle_length - shift[last_byte];
+		if(skip != 0) {
+			position += skip < memory ? memory : skip;
+			memory = 0;
+			continue;
+		}
+
+		// compare the right half
+		let_mut index = critical + 1 > memory ? critical + 1 : memory;
+		while(index < needle_length && needle[index] == window[index]) {
+			++index;
+		}
+		if(index < needle_length) {
+			position += index - critical;
+			memory = 0;
+			continue;
+		}
+
+		// compare the left half
+		index = critical + 1;
+		while(index > memory && needle[index - 1] == window[index - 1]) {
+			--index;
+		}
+		if(index <= memory) {
+			return position;
+		}
+
+		position += period;
+		memory = memory_on_shift;
+	}
+
+	return NOT_FOUND;
+}
+
+/// @brief Finds the first occurrence of `needle` in `haystack` at or after `start`, dispatching to
+/// the appropriate kernel for the needle length
+static usize find_first_from(const u8* restrict haystack,
+							 usize haystack_length,
+							 const u8* restrict needle,
+							 usize needle_length,
+							 usize start) {
+	if(needle_length == 0) {
+		return start <= haystack_length ? start : NOT_FOUND;
+	}
+
+	if(start > haystack_length || needle_length > haystack_length - start) {
+		return NOT_FOUND;
+	}
+
+	if(needle_length == 1) {
+		let found = static_cast(const u8*)(
+			memchr(haystack + start, needle[0], haystack_length - start));
+		return found == nullptr ? NOT_FOUND : static_cast(usize)(found - haystack);
+	}
+
+	if(needle_length > CNX_STRING_SEARCH_TWO_WAY_THRESHOLD) {
+		let found = find_first_two_way(haystack + start,
+									   haystack_length - start,
+									   needle,
+									   needle_length);
+		return found == NOT_FOUND ? NOT_FOUND : found + start;
+	}
+
+	return find_first_filtered(haystack, haystack_length, needle, needle_length, start);
+}
+
+__attr(always_inline) static inline CnxOption(usize) into_option(usize index) {
+	return index == NOT_FOUND ? None(usize) : Some(usize, index);
+}
+
+CnxOption(usize) cnx_string_search_first(restrict const_cstring haystack,
+										 usize haystack_length,
+										 restrict const_cstring needle,
+										 usize needle_length) {
+	return into_option(find_first_from(static_cast(const u8*)(static_cast(const void*)(haystack)),
+									   haystack_length,
+									   static_cast(const u8*)(static_cast(const void*)(needle)),
+									   needle_length,
+									   0));
+}
+
+CnxOption(usize) cnx_string_search_last(restrict const_cstring haystack,
+										usize haystack_length,
+										restrict const_cstring needle,
+										usize needle_length) {
+	if(needle_length == 0) {
+		return Some(usize, haystack_length);
+	}
+
+	if(needle_length > haystack_length) {
+		return None(usize);
+	}
+
+	let haystack_bytes = static_cast(const u8*)(static_cast(const void*)(haystack));
+	let needle_bytes = static_cast(const u8*)(static_cast(const void*)(needle));
+	if(needle_length == 1) {
+		for(let_mut i = haystack_length; i > 0;) {
+			--i;
+			if(haystack_bytes[i] == needle_bytes[0]) {
+				return Some(usize, i);
+			}
+		}
+		return None(usize);
+	}
+
+	return into_option(
+		find_last_filtered(haystack_bytes, haystack_length, needle_bytes, needle_length));
+}
+
+usize cnx_string_search_count(restrict const_cstring haystack,
+							  usize haystack_length,
+							  restrict const_cstring needle,
+							  usize needle_length) {
+	let haystack_bytes = static_cast(const u8*)(static_cast(const void*)(haystack));
+	let needle_bytes = static_cast(const u8*)(static_cast(const void*)(needle));
+	let_mut count = static_cast(usize)(0);
+	let_mut start = static_cast(usize)(0);
+	while(start < haystack_length) {
+		let found
+			= find_first_from(haystack_bytes, haystack_length, needle_bytes, needle_length, start);
+		if(found == NOT_FOUND) {
+			break;
+		}
+
+		++count;
+		start = found + 1;
+	}
+
+	return count;
+}
+
+bool cnx_stringview_contains_cstring(const CnxStringView* restrict self,
+									 restrict const_cstring substring,
+									 usize substring_length) {
+	let found = cnx_string_search_first(self->m_view, self->m_length, substring, substring_length);
+	return cnx_option_is_some(found);
+}
+
+CnxOption(usize) cnx_stringview_find_first_cstring(const CnxStringView* restrict self,
+												   restrict const_cstring substring,
+												   usize substring_length) {
+	return cnx_string_search_first(self->m_view, self->m_length, substring, substring_length);
+}
+
+CnxOption(usize) cnx_stringview_find_last_cstring(const CnxStringView* restrict self,
+												  restrict const_cstring substring,
+												  usize substring_length) {
+	return cnx_string_search_last(self->m_view, self->m_length, substring, substring_length);
+}
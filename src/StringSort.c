@@ -0,0 +1,384 @@
+/// @file StringSort.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief String-specialized sorting of `CnxString`s and `CnxStringView`s
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <Cnx/Allocators.h>
+#include <Cnx/Assert.h>
+#include <Cnx/Atomic.h>
+#include <Cnx/Lambda.h>
+#include <Cnx/Platform.h>
+#include <Cnx/StringSort.h>
+#include <Cnx/Thread.h>
+#include <memory.h>
+
+/// @brief The number of characters cached in a `SortKey`'s prefix
+#define PREFIX_SIZE sizeof(u64)
+/// @brief Ranges of at most this many keys are sorted with insertion sort
+#define INSERTION_SORT_THRESHOLD 16
+/// @brief The number of ranges (per thread) a parallel sort aims to split its input into, so that
+/// threads finishing early can pick up more work
+#define TASKS_PER_THREAD 16
+
+/// @brief The key a string is sorted by
+typedef struct SortKey {
+	/// @brief The `PREFIX_SIZE` characters of the string starting at the current depth, as a
+	/// big-endian integer (so that integer order is lexicographical order), zero-padded past the
+	/// end of the string
+	u64 m_prefix;
+	/// @brief The characters of the string
+	const u8* m_data;
+	/// @brief The length of the string
+	usize m_length;
+	/// @brief The index of the string in the input
+	usize m_index;
+} SortKey;
+
+/// @brief A range of keys, all sharing their first `m_depth` characters, to be sorted
+typedef struct SortTask {
+	SortKey* m_keys;
+	usize m_count;
+	usize m_depth;
+} SortTask;
+
+__attr(always_inline) __attr(nodiscard) static inline u64
+	load_prefix(const u8* restrict data, usize length, usize depth) {
+	if(depth >= length) {
+		return 0;
+	}
+
+	let remaining = length - depth;
+	if(remaining >= PREFIX_SIZE) {
+		let_mut prefix = static_cast(u64)(0);
+		memcpy(&prefix, data + depth, PREFIX_SIZE);
+#if CNX_PLATFORM_LITTLE_ENDIAN
+		prefix = __builtin_bswap64(prefix);
+#endif // CNX_PLATFORM_LITTLE_ENDIAN
+		return prefix;
+	}
+
+	let_mut prefix = static_cast(u64)(0);
+	for(let_mut i = static_cast(usize)(0); i < remaining; ++i) {
+		prefix |= static_cast(u64)(data[depth + i]) << (56U - 8U * i); // NOLINT
+	}
+	return prefix;
+}
+
+__attr(always_inline) static inline void swap_keys(SortKey* restrict keys, usize lhs, usize rhs) {
+	let temp = keys[lhs];
+	keys[lhs] = keys[rhs];
+	keys[rhs] = temp;
+}
+
+/// @brief Compares two keys sharing their first `depth` characters, starting from their (cached)
+/// prefixes at `depth`
+__attr(always_inline) __attr(nodiscard) static inline i32
+	compare_keys(const SortKey* restrict lhs, const SortKey* restrict rhs, usize depth) {
+	if(lhs->m_prefix != rhs->m_prefix) {
+		return lhs->m_prefix < rhs->m_prefix ? -1 : 1;
+	}
+
+	let next = depth + PREFIX_SIZE;
+	if(lhs->m_length > next && rhs->m_length > next) {
+		let lhs_rest = lhs->m_length - next;
+		let rhs_rest = rhs->m_length - next;
+		let result = memcmp(lhs->m_data + next,
+							rhs->m_data + next,
+							lhs_rest < rhs_rest ? lhs_rest : rhs_rest);
+		if(result != 0) {
+			return result;
+		}
+	}
+
+	// equal prefixes with a string ending within them only differ by zero-padding vs. actual
+	// zero characters, so the shorter string orders first
+	return lhs->m_length < rhs->m_length ? -1 : (lhs->m_length > rhs->m_length ? 1 : 0);
+}
+
+static void insertion_sort(SortKey* restrict keys, usize count, usize depth) {
+	for(let_mut i = static_cast(usize)(1); i < count; ++i) {
+		let key = keys[i];
+		let_mut j = i;
+		for(; j > 0 && compare_keys(&key, &keys[j - 1], depth) < 0; --j) {
+			keys[j] = keys[j - 1];
+		}
+		keys[j] = key;
+	}
+}
+
+__attr(always_inline) __attr(nodiscard) static inline u64 median_of_three(u64 a, u64 b, u64 c) {
+	if(a < b) {
+		return b < c ? b : (a < c ? c : a);
+	}
+	return a < c ? a : (b < c ? c : b);
+}
+
+/// @brief Partitions the given keys into those whose prefix is less than, equal to, and greater
+/// than a pivot, returning the bounds of the equal range in `equal_begin` and `equal_end`
+static void partition(SortKey* restrict keys, usize count, usize* equal_begin, usize* equal_end) {
+	let pivot = median_of_three(keys[0].m_prefix,
+								keys[count / 2].m_prefix,
+								keys[count - 1].m_prefix);
+	let_mut less = static_cast(usize)(0);
+	let_mut i = static_cast(usize)(0);
+	let_mut greater = count;
+	while(i < greater) {
+		let prefix = keys[i].m_prefix;
+		if(prefix < pivot) {
+			swap_keys(keys, less, i);
+			++less;
+			++i;
+		}
+		else if(prefix > pivot) {
+			--greater;
+			swap_keys(keys, i, greater);
+		}
+		else {
+			++i;
+		}
+	}
+	*equal_begin = less;
+	*equal_end = greater;
+}
+
+/// @brief Moves the keys that end within their (equal) prefixes at `depth` to the front of the
+/// given range, in order, returning how many there were. Advances the remaining keys to the next
+/// `PREFIX_SIZE` characters.
+static usize advance_equal(SortKey* restrict keys, usize count, usize depth) {
+	// all of the keys are equal up to `depth + PREFIX_SIZE`, so the keys ending within that
+	// are only ordered by their lengths, which can only be one of `PREFIX_SIZE + 1` values
+	let next = depth + PREFIX_SIZE;
+	let_mut finished = static_cast(usize)(0);
+	for(let_mut length = depth; length <= next && finished < count; ++length) {
+		for(let_mut i = finished; i < count; ++i) {
+			if(keys[i].m_length == length) {
+				swap_keys(keys, finished, i);
+				++finished;
+			}
+		}
+	}
+
+	for(let_mut i = finished; i < count; ++i) {
+		keys[i].m_prefix = load_prefix(keys[i].m_data, keys[i].m_length, next);
+	}
+	return finished;
+}
+
+/// @brief Sorts the given keys, all sharing their first `depth` characters and with their
+/// prefixes loaded at `depth`, with a multikey quicksort. If `tasks` is not `nullptr`, ranges of
+/// at most `grain` keys are pushed to `tasks` instead of being sorted
+static void sort_keys(SortKey* keys,
+					  usize count,
+					  usize depth,
+					  usize grain,
+					  SortTask** tasks,
+					  usize* num_tasks,
+					  usize* tasks_capacity) {
+	while(count > INSERTION_SORT_THRESHOLD) {
+		if(tasks != nullptr && count <= grain) {
+			if(*num_tasks == *tasks_capacity) {
+				let new_capacity = *tasks_capacity * 2;
+				*tasks = cnx_allocator_reallocate_array_t(SortTask,
+														  DEFAULT_ALLOCATOR,
+														  *tasks,
+														  *tasks_capacity,
+														  new_capacity);
+				*tasks_capacity = new_capacity;
+			}
+			(*tasks)[(*num_tasks)++]
+				= (SortTask){.m_keys = keys, .m_count = count, .m_depth = depth};
+			return;
+		}
+
+		let_mut equal_begin = static_cast(usize)(0);
+		let_mut equal_end = static_cast(usize)(0);
+		partition(keys, count, &equal_begin, &equal_end);
+
+		// the three ranges are independent, so recurse into the two smaller ones and continue
+		// with the largest, to bound the recursion depth
+		let equal = keys + equal_begin;
+		let equal_count = equal_end - equal_begin;
+		let finished = advance_equal(equal, equal_count, depth);
+		const SortTask ranges[] = {
+			{.m_keys = keys, .m_count = equal_begin, .m_depth = depth},
+			{.m_keys = equal + finished,
+			 .m_count = equal_count - finished,
+			 .m_depth = depth + PREFIX_SIZE},
+			{.m_keys = keys + equal_end, .m_count = count - equal_end, .m_depth = depth},
+		};
+		let_mut largest = static_cast(usize)(0);
+		for(let_mut i = static_cast(usize)(1); i < 3; ++i) {
+			if(ranges[i].m_count > ranges[largest].m_count) {
+				largest = i;
+			}
+		}
+		for(let_mut i = static_cast(usize)(0); i < 3; ++i) {
+			if(i != largest && ranges[i].m_count > 1) {
+				sort_keys(ranges[i].m_keys,
+						  ranges[i].m_count,
+						  ranges[i].m_depth,
+						  grain,
+						  tasks,
+						  num_tasks,
+						  tasks_capacity);
+			}
+		}
+
+		keys = ranges[largest].m_keys;
+		count = ranges[largest].m_count;
+		depth = ranges[largest].m_depth;
+	}
+
+	insertion_sort(keys, count, depth);
+}
+
+/// @brief Shared state of the threads of a parallel sort
+typedef struct SortWorkers {
+	const SortTask* m_tasks;
+	usize m_num_tasks;
+	atomic_usize m_next_task;
+} SortWorkers;
+
+static void sort_tasks(SortWorkers* restrict workers) {
+	let_mut index = atomic_fetch_add_explicit(&workers->m_next_task, 1, memory_order_relaxed);
+	for(; index < workers->m_num_tasks;
+		index = atomic_fetch_add_explicit(&workers->m_next_task, 1, memory_order_relaxed))
+	{
+		let task = workers->m_tasks[index];
+		sort_keys(task.m_keys, task.m_count, task.m_depth, 0, nullptr, nullptr, nullptr);
+	}
+}
+
+void LambdaFunction(sort_worker) {
+	let binding = lambda_binding(SortWorkers*);
+	sort_tasks(binding._1);
+}
+
+/// @brief Sorts the given keys (with their prefixes loaded at depth `0`), using up to the given
+/// number of threads
+static void sort(SortKey* restrict keys, usize count, usize num_threads) {
+	if(num_threads <= 1 || count < CNX_STRING_SORT_PARALLEL_THRESHOLD) {
+		sort_keys(keys, count, 0, 0, nullptr, nullptr, nullptr);
+		return;
+	}
+
+	// split the keys into independent ranges on this thread, then sort the ranges in parallel
+	let grain = count / (num_threads * TASKS_PER_THREAD);
+	let_mut tasks_capacity = num_threads * TASKS_PER_THREAD * 2;
+	let_mut tasks = cnx_allocator_allocate_array_t(SortTask, DEFAULT_ALLOCATOR, tasks_capacity);
+	let_mut num_tasks = static_cast(usize)(0);
+	sort_keys(keys, count, 0, grain, &tasks, &num_tasks, &tasks_capacity);
+
+	let_mut workers = (SortWorkers){.m_tasks = tasks, .m_num_tasks = num_tasks};
+	atomic_init(&workers.m_next_task, 0);
+	if(num_tasks <= 1) {
+		sort_tasks(&workers);
+		cnx_allocator_deallocate(DEFAULT_ALLOCATOR, tasks);
+		return;
+	}
+
+	// this thread sorts too, so only spawn as many others as there are remaining tasks for
+	let num_spawned = num_threads - 1 < num_tasks - 1 ? num_threads - 1 : num_tasks - 1;
+
+	let_mut threads = cnx_allocator_allocate_array_t(CnxThread, DEFAULT_ALLOCATOR, num_spawned);
+	let_mut spawned = cnx_allocator_allocate_array_t(bool, DEFAULT_ALLOCATOR, num_spawned);
+	for(let_mut i = static_cast(usize)(0); i < num_spawned; ++i) {
+		// if a thread can't be spawned, the remaining threads (including this one) pick up its
+		// share of the work
+		let_mut result = cnx_thread_init(&threads[i],
+										 lambda_cast(lambda(sort_worker, &workers),
+													 CnxThreadLambda));
+		spawned[i] = cnx_result_is_ok(result);
+	}
+
+	sort_tasks(&workers);
+	for(let_mut i = static_cast(usize)(0); i < num_spawned; ++i) {
+		if(spawned[i]) {
+			ignore(cnx_thread_join(&threads[i]));
+		}
+	}
+
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, spawned);
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, threads);
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, tasks);
+}
+
+void cnx_string_sort_strings(CnxString* restrict strings, usize count, usize num_threads) {
+	if(count < 2) {
+		return;
+	}
+
+	let_mut keys = cnx_allocator_allocate_array_t(SortKey, DEFAULT_ALLOCATOR, count);
+	for(let_mut i = static_cast(usize)(0); i < count; ++i) {
+		let data = static_cast(const u8*)(
+			static_cast(const void*)(cnx_string_into_cstring(strings[i])));
+		let length = cnx_string_length(strings[i]);
+		keys[i] = (SortKey){.m_prefix = load_prefix(data, length, 0),
+							.m_data = data,
+							.m_length = length,
+							.m_index = i};
+	}
+
+	sort(keys, count, num_threads);
+
+	// `CnxString`s are trivially relocatable, so they can be moved into their sorted positions
+	// with plain copies
+	let_mut sorted = cnx_allocator_allocate_array_t(CnxString, DEFAULT_ALLOCATOR, count);
+	for(let_mut i = static_cast(usize)(0); i < count; ++i) {
+		sorted[i] = strings[keys[i].m_index];
+	}
+	cnx_memcpy(CnxString, strings, sorted, count);
+
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, sorted);
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, keys);
+}
+
+void cnx_string_sort_stringviews(CnxStringView* restrict views, usize count, usize num_threads) {
+	if(count < 2) {
+		return;
+	}
+
+	let_mut keys = cnx_allocator_allocate_array_t(SortKey, DEFAULT_ALLOCATOR, count);
+	for(let_mut i = static_cast(usize)(0); i < count; ++i) {
+		let data = static_cast(const u8*)(static_cast(const void*)(views[i].m_view));
+		let length = views[i].m_length;
+		keys[i] = (SortKey){.m_prefix = load_prefix(data, length, 0),
+							.m_data = data,
+							.m_length = length,
+							.m_index = i};
+	}
+
+	sort(keys, count, num_threads);
+
+	let_mut sorted = cnx_allocator_allocate_array_t(CnxStringView, DEFAULT_ALLOCATOR, count);
+	for(let_mut i = static_cast(usize)(0); i < count; ++i) {
+		sorted[i] = views[keys[i].m_index];
+	}
+	cnx_memcpy(CnxStringView, views, sorted, count);
+
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, sorted);
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, keys);
+}
@@ -0,0 +1,253 @@
+/// @file StringSplit.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Lazy, allocation-free splitting and tokenizing of `CnxString`s and `CnxStringView`s
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <Cnx/Assert.h>
+#include <Cnx/StringSplit.h>
+#include <memory.h>
+
+#undef cnx_split_iterator_next
+#undef cnx_split_iterator_remainder
+#undef cnx_split_iterator_reset
+#undef cnx_split_iterator_begin
+#undef cnx_split_iterator_end
+
+static const cnx_split_iterator_vtable_t cnx_split_iterator_vtable = {
+	.begin = cnx_split_iterator_begin,
+	.end = cnx_split_iterator_end,
+	.cbegin = cnx_split_iterator_cbegin,
+	.cend = cnx_split_iterator_cend,
+};
+
+CnxSplitIterator cnx_split_iterator_new(CnxStringView input,
+										restrict const_cstring delimiter,
+										usize delimiter_length,
+										CnxSplitOptions options) {
+	cnx_assert(delimiter_length > 0, "cnx_split_iterator_new called with an empty delimiter");
+
+	let_mut split = (CnxSplitIterator){.m_input = input,
+									   .m_current = input,
+									   .m_delimiter = delimiter,
+									   .m_delimiter_length = delimiter_length,
+									   .m_position = 0,
+									   .m_splits = 0,
+									   .m_options = options,
+									   .m_finished = false,
+									   .m_delimiter_set = {0},
+									   .m_vtable = &cnx_split_iterator_vtable};
+	split.m_current.m_length = 0;
+
+	// splitting on any of a single byte is the same as splitting on that byte, which the search
+	// engine handles with `memchr`
+	if(options.m_any_of && delimiter_length == 1) {
+		split.m_options.m_any_of = false;
+	}
+
+	if(split.m_options.m_any_of) {
+		split.m_delimiter_set = cnx_byte_set_new(delimiter, delimiter_length);
+	}
+
+	return split;
+}
+
+/// @brief Returns the offset of the first delimiter in `self`'s remaining input and sets
+/// `delimiter_length` to the length of the matched delimiter, or returns the length of the
+/// remaining input if it contains no delimiter
+__attr(nodiscard) static usize find_delimiter(const CnxSplitIterator* restrict self,
+											  usize* restrict delimiter_length) {
+	let data = self->m_input.m_view + self->m_position;
+	let length = self->m_input.m_length - self->m_position;
+	if(self->m_options.m_any_of) {
+		*delimiter_length = 1;
+		return cnx_byte_scan_find_any_of(data, length, &(self->m_delimiter_set));
+	}
+
+	*delimiter_length = self->m_delimiter_length;
+	let_mut found
+		= cnx_string_search_first(data, length, self->m_delimiter, self->m_delimiter_length);
+	return cnx_option_unwrap_or(found, length);
+}
+
+/// @brief Advances `self` to its next piece, returning whether there was one
+__attr(nodiscard) static bool advance(CnxSplitIterator* restrict self) {
+	while(!self->m_finished) {
+		let start = self->m_position;
+		let remaining = self->m_input.m_length - start;
+		let_mut piece_length = remaining;
+		let max_splits = self->m_options.m_max_splits;
+
+		if(max_splits == 0 || self->m_splits < max_splits) {
+			let_mut delimiter_length = static_cast(usize)(0);
+			piece_length = find_delimiter(self, &delimiter_length);
+			if(piece_length != remaining) {
+				self->m_position = start + piece_length + delimiter_length;
+				++self->m_splits;
+			}
+		}
+
+		if(piece_length == remaining) {
+			self->m_position = self->m_input.m_length;
+			self->m_finished = true;
+		}
+
+		if(piece_length == 0 && self->m_options.m_skip_empty) {
+			continue;
+		}
+
+		self->m_current.m_view = self->m_input.m_view + start;
+		self->m_current.m_length = piece_length;
+		return true;
+	}
+
+	return false;
+}
+
+CnxOption(CnxStringView) cnx_split_iterator_next(CnxSplitIterator* restrict self) {
+	return advance(self) ? Some(CnxStringView, self->m_current) : None(CnxStringView);
+}
+
+CnxStringView cnx_split_iterator_remainder(const CnxSplitIterator* restrict self) {
+	let_mut remainder = self->m_input;
+	remainder.m_view += self->m_position;
+	remainder.m_length -= self->m_position;
+	return remainder;
+}
+
+void cnx_split_iterator_reset(CnxSplitIterator* restrict self) {
+	self->m_position = 0;
+	self->m_splits = 0;
+	self->m_finished = false;
+	self->m_current.m_view = self->m_input.m_view;
+	self->m_current.m_length = 0;
+}
+
+__attr(nodiscard) static CnxSplitIteratorCursor
+	cnx_split_iterator_cursor_new(const CnxSplitIterator* restrict self) {
+	// the split iterator is documented to be mutable, so casting away `const` here is fine;
+	// `into_iter` just requires a const pointer by convention
+	return (CnxSplitIteratorCursor){.m_index = 0,
+									.m_split = static_cast(CnxSplitIterator*)(self)};
+}
+
+__attr(nodiscard) static Ref(CnxStringView)
+	cnx_split_iterator_cursor_next(CnxForwardIterator(Ref(CnxStringView)) * restrict self) {
+	let_mut _self = static_cast(CnxSplitIteratorCursor*)(self->m_self);
+
+	cnx_assert(_self->m_index >= 0,
+			   "Iterator advanced when iterator is positioned at the end of the iteration "
+			   "(iterator out of bounds)");
+
+	_self->m_index = advance(_self->m_split) ? _self->m_index + 1 : -1;
+	return &(_self->m_split->m_current);
+}
+
+__attr(nodiscard) static Ref(CnxStringView) cnx_split_iterator_cursor_current(
+	const CnxForwardIterator(Ref(CnxStringView)) * restrict self) {
+	let _self = static_cast(const CnxSplitIteratorCursor*)(self->m_self);
+
+	cnx_assert(_self->m_index >= 0,
+			   "Iterator value accessed when iterator is positioned at the end of the iteration "
+			   "(iterator out of bounds)");
+
+	return &(_self->m_split->m_current);
+}
+
+__attr(nodiscard) static bool
+	cnx_split_iterator_cursor_equals(const CnxForwardIterator(Ref(CnxStringView)) * restrict self,
+									 const CnxForwardIterator(Ref(CnxStringView)) * restrict rhs) {
+	let _self = static_cast(const CnxSplitIteratorCursor*)(self->m_self);
+	let _rhs = static_cast(const CnxSplitIteratorCursor*)(rhs->m_self);
+
+	return _self->m_split == _rhs->m_split && _self->m_index == _rhs->m_index;
+}
+
+__attr(nodiscard) static ConstRef(CnxStringView) cnx_split_iterator_cursor_cnext(
+	CnxForwardIterator(ConstRef(CnxStringView)) * restrict self) {
+	return cnx_split_iterator_cursor_next(
+		static_cast(CnxForwardIterator(Ref(CnxStringView))*)(self));
+}
+
+__attr(nodiscard) static ConstRef(CnxStringView) cnx_split_iterator_cursor_ccurrent(
+	const CnxForwardIterator(ConstRef(CnxStringView)) * restrict self) {
+	return cnx_split_iterator_cursor_current(
+		static_cast(const CnxForwardIterator(Ref(CnxStringView))*)(self));
+}
+
+__attr(nodiscard) static bool cnx_split_iterator_cursor_cequals(
+	const CnxForwardIterator(ConstRef(CnxStringView)) * restrict self,
+	const CnxForwardIterator(ConstRef(CnxStringView)) * restrict rhs) {
+	return cnx_split_iterator_cursor_equals(
+		static_cast(const CnxForwardIterator(Ref(CnxStringView))*)(self),
+		static_cast(const CnxForwardIterator(Ref(CnxStringView))*)(rhs));
+}
+
+static ImplIntoCnxForwardIterator(CnxSplitIterator,
+								  Ref(CnxStringView),
+								  cnx_split_iterator_into_iter,
+								  cnx_split_iterator_cursor_new,
+								  cnx_split_iterator_cursor_next,
+								  cnx_split_iterator_cursor_current,
+								  cnx_split_iterator_cursor_equals);
+static ImplIntoCnxForwardIterator(CnxSplitIterator,
+								  ConstRef(CnxStringView),
+								  cnx_split_iterator_into_const_iter,
+								  cnx_split_iterator_cursor_new,
+								  cnx_split_iterator_cursor_cnext,
+								  cnx_split_iterator_cursor_ccurrent,
+								  cnx_split_iterator_cursor_cequals);
+
+CnxForwardIterator(Ref(CnxStringView)) cnx_split_iterator_begin(CnxSplitIterator* restrict self) {
+	cnx_split_iterator_reset(self);
+	let_mut iter = cnx_split_iterator_into_iter(self);
+	let_mut inner = static_cast(CnxSplitIteratorCursor*)(iter.m_self);
+	inner->m_index = advance(self) ? 0 : -1;
+	return iter;
+}
+
+CnxForwardIterator(Ref(CnxStringView)) cnx_split_iterator_end(CnxSplitIterator* restrict self) {
+	let_mut iter = cnx_split_iterator_into_iter(self);
+	let_mut inner = static_cast(CnxSplitIteratorCursor*)(iter.m_self);
+	inner->m_index = -1;
+	return iter;
+}
+
+CnxForwardIterator(ConstRef(CnxStringView))
+	cnx_split_iterator_cbegin(CnxSplitIterator* restrict self) {
+	cnx_split_iterator_reset(self);
+	let_mut iter = cnx_split_iterator_into_const_iter(self);
+	let_mut inner = static_cast(CnxSplitIteratorCursor*)(iter.m_self);
+	inner->m_index = advance(self) ? 0 : -1;
+	return iter;
+}
+
+CnxForwardIterator(ConstRef(CnxStringView))
+	cnx_split_iterator_cend(CnxSplitIterator* restrict self) {
+	let_mut iter = cnx_split_iterator_into_const_iter(self);
+	let_mut inner = static_cast(CnxSplitIteratorCursor*)(iter.m_self);
+	inner->m_index = -1;
+	return iter;
+}
@@ -0,0 +1,282 @@
+/// @file Symbol.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief String interning: deduplicated, identity-comparable `CnxSymbol`s
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+
+#include <Cnx/Assert.h>
+#include <Cnx/Symbol.h>
+#include <memory.h>
+#include <stddef.h>
+
+#define OPTION_UNDEF_PARAMS TRUE
+
+/// @brief Declares `CnxOption(T)` for `CnxSymbol`
+#define OPTION_T	CnxSymbol
+#define OPTION_IMPL TRUE
+#include <Cnx/Option.h> // NOLINT(readability-duplicate-include)
+
+#undef OPTION_UNDEF_PARAMS
+
+#undef cnx_symbol_table_free
+#undef cnx_symbol_table_size
+
+#define CNX_SYMBOL_TABLE_MIN_CAPACITY 16
+
+cnx_static_assert((CNX_SYMBOL_TABLE_NUM_SHARDS & (CNX_SYMBOL_TABLE_NUM_SHARDS - 1)) == 0,
+				  "CNX_SYMBOL_TABLE_NUM_SHARDS must be a power of two");
+
+__attr(always_inline) __attr(const) static inline u64 rotate_left(u64 value, u32 amount) {
+	return (value << amount) | (value >> (64U - amount));
+}
+
+/// @brief Scrambles a word of input before it's combined into the hash
+__attr(always_inline) __attr(const) static inline u64 mix_word(u64 word) {
+	word *= 0xC2B2AE3D27D4EB4FULL;
+	word = rotate_left(word, 31U);
+	return word * 0x9E3779B185EBCA87ULL;
+}
+
+/// @brief Hashes the given bytes a word at a time
+__attr(nodiscard) static u64 hash_bytes(restrict const_cstring data, usize length) {
+	let_mut hash = 0x27D4EB2F165667C5ULL ^ (static_cast(u64)(length) * 0x9E3779B185EBCA87ULL);
+	let_mut remaining = length;
+	for(; remaining >= sizeof(u64); remaining -= sizeof(u64), data += sizeof(u64)) {
+		u64 word = 0;
+		memcpy(&word, data, sizeof(u64));
+		hash ^= mix_word(word);
+		hash = rotate_left(hash, 27U) * 5U + 0x52DCE729U;
+	}
+	if(remaining > 0) {
+		u64 word = 0;
+		memcpy(&word, data, remaining);
+		hash ^= mix_word(word);
+	}
+
+	// finalize so that every input bit affects both the shard and slot bits
+	hash ^= hash >> 33U;
+	hash *= 0xFF51AFD7ED558CCDULL;
+	hash ^= hash >> 33U;
+	hash *= 0xC4CEB9FE1A85EC53ULL;
+	hash ^= hash >> 33U;
+	return hash;
+}
+
+/// @brief Returns the shard the string with the given hash belongs to. Uses the high bits of the
+/// hash, so that shard selection is independent of slot selection within the shard
+__attr(always_inline) static inline CnxSymbolTableShard*
+shard_for(CnxSymbolTable* restrict self, u64 hash) {
+	return &(self->m_shards[(hash >> 32U) & (CNX_SYMBOL_TABLE_NUM_SHARDS - 1)]);
+}
+
+/// @brief Returns the interned entry for the given string in the given shard, or `nullptr` if it
+/// hasn't been interned. The shard must be locked
+__attr(nodiscard) static const CnxSymbolEntry* find_in_shard(const CnxSymbolTableShard* restrict shard,
+															 u64 hash,
+															 restrict const_cstring string,
+															 usize length) {
+	if(shard->m_capacity == 0) {
+		return nullptr;
+	}
+
+	let mask = shard->m_capacity - 1;
+	for(let_mut index = hash & mask;; index = (index + 1) & mask) {
+		let entry = shard->m_slots[index];
+		if(entry == nullptr) {
+			return nullptr;
+		}
+		if(entry->m_hash == hash && entry->m_length == length
+		   && memcmp(entry->m_data, string, length) == 0)
+		{
+			return entry;
+		}
+	}
+}
+
+/// @brief Places the given entry in the first free slot for it in the given slot array
+__attr(always_inline) static inline void
+place_entry(const CnxSymbolEntry** restrict slots, usize capacity, const CnxSymbolEntry* entry) {
+	let mask = capacity - 1;
+	let_mut index = entry->m_hash & mask;
+	while(slots[index] != nullptr) {
+		index = (index + 1) & mask;
+	}
+	slots[index] = entry;
+}
+
+/// @brief Doubles the number of slots in the given shard. The shard must be locked exclusively
+static void grow_shard(CnxSymbolTableShard* restrict shard, CnxAllocator allocator) {
+	let new_capacity = shard->m_capacity == 0 ? static_cast(usize)(CNX_SYMBOL_TABLE_MIN_CAPACITY) :
+												shard->m_capacity * 2;
+	let_mut slots = cnx_allocator_allocate_array_t(const CnxSymbolEntry*, allocator, new_capacity);
+	for(let_mut i = 0U; i < new_capacity; ++i) {
+		slots[i] = nullptr;
+	}
+
+	for(let_mut i = 0U; i < shard->m_capacity; ++i) {
+		if(shard->m_slots[i] != nullptr) {
+			place_entry(slots, new_capacity, shard->m_slots[i]);
+		}
+	}
+
+	if(shard->m_slots != nullptr) {
+		cnx_allocator_deallocate(allocator, static_cast(void*)(shard->m_slots));
+	}
+	shard->m_slots = slots;
+	shard->m_capacity = new_capacity;
+}
+
+/// @brief Stores a new entry for the given string in the given shard's blocks. The shard must be
+/// locked exclusively
+__attr(nodiscard) static CnxSymbolEntry* allocate_entry(CnxSymbolTableShard* restrict shard,
+														CnxAllocator allocator,
+														usize length) {
+	let alignment = _Alignof(CnxSymbolEntry);
+	let size = (offsetof(CnxSymbolEntry, m_data) + length + 1 + alignment - 1) & ~(alignment - 1);
+	let header = (sizeof(char*) + alignment - 1) & ~(alignment - 1);
+
+	if(shard->m_block == nullptr || shard->m_block_used + size > shard->m_block_size) {
+		let block_size = header + size > CNX_SYMBOL_TABLE_BLOCK_SIZE ?
+							 header + size :
+							 static_cast(usize)(CNX_SYMBOL_TABLE_BLOCK_SIZE);
+		let_mut block = cnx_allocator_allocate_array_t(char, allocator, block_size);
+		// chain the blocks together so they can be freed with the table
+		memcpy(block, &shard->m_block, sizeof(char*));
+		shard->m_block = block;
+		shard->m_block_used = header;
+		shard->m_block_size = block_size;
+	}
+
+	let entry = static_cast(CnxSymbolEntry*)(
+		static_cast(void*)(shard->m_block + shard->m_block_used));
+	shard->m_block_used += size;
+	return entry;
+}
+
+CnxSymbolTable cnx_symbol_table_new_with_allocator(CnxAllocator allocator) {
+	let_mut table = (CnxSymbolTable){.m_allocator = allocator};
+	for(let_mut i = 0U; i < CNX_SYMBOL_TABLE_NUM_SHARDS; ++i) {
+		table.m_shards[i] = (CnxSymbolTableShard){.m_mutex = cnx_shared_mutex_new(),
+												  .m_slots = nullptr,
+												  .m_capacity = 0,
+												  .m_size = 0,
+												  .m_block = nullptr,
+												  .m_block_used = 0,
+												  .m_block_size = 0};
+	}
+	return table;
+}
+
+void cnx_symbol_table_free(void* restrict self) {
+	let self_ptr = static_cast(CnxSymbolTable*)(self);
+	for(let_mut i = 0U; i < CNX_SYMBOL_TABLE_NUM_SHARDS; ++i) {
+		let shard = &(self_ptr->m_shards[i]);
+		if(shard->m_slots != nullptr) {
+			cnx_allocator_deallocate(self_ptr->m_allocator, static_cast(void*)(shard->m_slots));
+		}
+
+		let_mut block = shard->m_block;
+		while(block != nullptr) {
+			char* previous = nullptr;
+			memcpy(&previous, block, sizeof(char*));
+			cnx_allocator_deallocate(self_ptr->m_allocator, block);
+			block = previous;
+		}
+
+		cnx_shared_mutex_free(&(shard->m_mutex));
+		*shard = (CnxSymbolTableShard){0};
+	}
+}
+
+CnxSymbol cnx_symbol_table_intern_cstring(CnxSymbolTable* restrict self,
+										  restrict const_cstring string,
+										  usize length) {
+	let hash = hash_bytes(string, length);
+	let shard = shard_for(self, hash);
+
+	// the common case, the string has already been interned, only needs a shared lock
+	cnx_shared_mutex_lock_shared(&(shard->m_mutex));
+	let found = find_in_shard(shard, hash, string, length);
+	cnx_shared_mutex_unlock_shared(&(shard->m_mutex));
+	if(found != nullptr) {
+		return (CnxSymbol){.m_entry = found};
+	}
+
+	cnx_shared_mutex_lock(&(shard->m_mutex));
+	// another thread may have interned the string between our locks
+	let_mut entry = find_in_shard(shard, hash, string, length);
+	if(entry == nullptr) {
+		if((shard->m_size + 1) * 4 > shard->m_capacity * 3) {
+			grow_shard(shard, self->m_allocator);
+		}
+
+		let_mut new_entry = allocate_entry(shard, self->m_allocator, length);
+		new_entry->m_hash = hash;
+		new_entry->m_length = length;
+		memcpy(new_entry->m_data, string, length);
+		new_entry->m_data[length] = 0;
+
+		place_entry(shard->m_slots, shard->m_capacity, new_entry);
+		++(shard->m_size);
+		entry = new_entry;
+	}
+	cnx_shared_mutex_unlock(&(shard->m_mutex));
+
+	return (CnxSymbol){.m_entry = entry};
+}
+
+CnxOption(CnxSymbol) cnx_symbol_table_find_cstring(CnxSymbolTable* restrict self,
+												   restrict const_cstring string,
+												   usize length) {
+	let hash = hash_bytes(string, length);
+	let shard = shard_for(self, hash);
+
+	cnx_shared_mutex_lock_shared(&(shard->m_mutex));
+	let found = find_in_shard(shard, hash, string, length);
+	cnx_shared_mutex_unlock_shared(&(shard->m_mutex));
+
+	if(found == nullptr) {
+		return None(CnxSymbol);
+	}
+
+	return Some(CnxSymbol, (CnxSymbol){.m_entry = found});
+}
+
+usize cnx_symbol_table_size(CnxSymbolTable* restrict self) {
+	let_mut size = static_cast(usize)(0);
+	for(let_mut i = 0U; i < CNX_SYMBOL_TABLE_NUM_SHARDS; ++i) {
+		let shard = &(self->m_shards[i]);
+		cnx_shared_mutex_lock_shared(&(shard->m_mutex));
+		size += shard->m_size;
+		cnx_shared_mutex_unlock_shared(&(shard->m_mutex));
+	}
+	return size;
+}
+
+CnxStringView cnx_symbol_into_stringview(CnxSymbol self) {
+	// symbols may contain embedded nulls, so their length can't be measured with `strlen`
+	return cnx_stringview_from_raw(self.m_entry->m_data, self.m_entry->m_length);
+}
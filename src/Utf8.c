@@ -0,0 +1,925 @@
+/// @file Utf8.c
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Vectorized UTF-8 validation, UTF-16/UTF-32 transcoding, and code point iteration for
+/// `CnxString`s and `CnxStringView`s
+/// @version 0.1.0
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include <Cnx/Assert.h>
+#include <Cnx/Platform.h>
+#include <Cnx/Utf8.h>
+#include <Cnx/__string/__byte_scan.h>
+#include <memory.h>
+
+#if(CNX_PLATFORM_COMPILER_GCC || CNX_PLATFORM_COMPILER_CLANG) \
+	&& (defined(__x86_64__) || defined(_M_X64))
+	/// @brief Whether the SSE2, SSSE3, and AVX2 UTF-8 kernels are available for this target
+	#define CNX_UTF8_SIMD_KERNELS 1
+	#include <immintrin.h>
+#else
+	/// @brief Whether the SSE2, SSSE3, and AVX2 UTF-8 kernels are available for this target
+	#define CNX_UTF8_SIMD_KERNELS 0
+#endif
+
+#undef cnx_code_point_iterator_next
+#undef cnx_code_point_iterator_remainder
+#undef cnx_code_point_iterator_reset
+#undef cnx_code_point_iterator_begin
+#undef cnx_code_point_iterator_end
+
+__attr(always_inline) __attr(nodiscard) static inline bool is_continuation(u8 byte) {
+	return (byte & 0xC0U) == 0x80U; // NOLINT
+}
+
+__attr(always_inline) __attr(nodiscard) static inline bool is_surrogate(u32 code_point) {
+	return code_point >= 0xD800U && code_point <= 0xDFFFU; // NOLINT
+}
+
+__attr(always_inline) __attr(nodiscard) static inline bool is_scalar_value(u32 code_point) {
+	return code_point <= 0x10FFFFU && !is_surrogate(code_point); // NOLINT
+}
+
+/// @brief Marks an ill-formed sequence in the output of `decode_sequence`
+#define INVALID_SEQUENCE UINT32_MAX
+
+/// @brief Checks the sequence starting at `data[index]`, per Table 3-7 of the Unicode Standard
+///
+/// Sets `code_point` to the decoded code point, or `INVALID_SEQUENCE` if the sequence is
+/// ill-formed, and returns the number of bytes consumed: the length of the sequence
+/// if it's well-formed, or of its maximal subpart (at least one byte) if it isn't
+__attr(nodiscard) static usize
+	decode_sequence(const_cstring data, usize length, usize index, u32* restrict code_point) {
+	let lead = static_cast(u8)(data[index]);
+	if(lead < 0x80U) { // NOLINT
+		*code_point = lead;
+		return 1;
+	}
+
+	let_mut sequence_length = static_cast(usize)(0);
+	let_mut value = static_cast(u32)(0);
+	// the valid range of the second byte, which is narrower than `[0x80, 0xBF]` for some lead
+	// bytes to exclude overlong encodings, surrogates, and values above U+10FFFF
+	let_mut lower = static_cast(u8)(0x80U); // NOLINT
+	let_mut upper = static_cast(u8)(0xBFU); // NOLINT
+	if(lead >= 0xC2U && lead <= 0xDFU) { // NOLINT
+		sequence_length = 2;
+		value = lead & 0x1FU; // NOLINT
+	}
+	else if(lead >= 0xE0U && lead <= 0xEFU) { // NOLINT
+		sequence_length = 3;
+		value = lead & 0x0FU; // NOLINT
+		if(lead == 0xE0U) { // NOLINT
+			lower = 0xA0U; // NOLINT
+		}
+		else if(lead == 0xEDU) { // NOLINT
+			upper = 0x9FU; // NOLINT
+		}
+	}
+	else if(lead >= 0xF0U && lead <= 0xF4U) { // NOLINT
+		sequence_length = 4;
+		value = lead & 0x07U; // NOLINT
+		if(lead == 0xF0U) { // NOLINT
+			lower = 0x90U; // NOLINT
+		}
+		else if(lead == 0xF4U) { // NOLINT
+			upper = 0x8FU; // NOLINT
+		}
+	}
+	else {
+		*code_point = INVALID_SEQUENCE;
+		return 1;
+	}
+
+	for(let_mut i = static_cast(usize)(1); i < sequence_length; ++i) {
+		if(index + i >= length) {
+			*code_point = INVALID_SEQUENCE;
+			return i;
+		}
+
+		let byte = static_cast(u8)(data[index + i]);
+		if(byte < lower || byte > upper) {
+			*code_point = INVALID_SEQUENCE;
+			return i;
+		}
+
+		value = (value << 6U) | (byte & 0x3FU); // NOLINT
+		lower = 0x80U; // NOLINT
+		upper = 0xBFU; // NOLINT
+	}
+
+	*code_point = value;
+	return sequence_length;
+}
+
+__attr(nodiscard) static usize find_invalid_scalar(const_cstring data, usize length, usize start) {
+	let_mut i = start;
+	while(i < length) {
+		i += cnx_byte_scan_find_non_ascii(data + i, length - i);
+		if(i == length) {
+			break;
+		}
+
+		let_mut code_point = static_cast(u32)(0);
+		let consumed = decode_sequence(data, length, i, &code_point);
+		if(code_point == INVALID_SEQUENCE) {
+			return i;
+		}
+		i += consumed;
+	}
+
+	return length;
+}
+
+/// @brief Counts the non-continuation bytes in `data[start, length)`, plus the four-byte lead
+/// bytes if `count_four_byte_leads` is true. This is the transcoded length of valid UTF-8
+__attr(nodiscard) static usize
+	length_scalar(const_cstring data, usize length, bool count_four_byte_leads, usize start) {
+	let_mut count = static_cast(usize)(0);
+	for(let_mut i = start; i < length; ++i) {
+		let byte = static_cast(u8)(data[i]);
+		count += !is_continuation(byte);
+		count += count_four_byte_leads && byte >= 0xF0U; // NOLINT
+	}
+	return count;
+}
+
+/// @brief Returns the transcoded length of `data[start, length)` in UTF-16 code units if `utf16`
+/// is true, otherwise in UTF-32 code units, for input that may be ill-formed
+///
+/// Each maximal subpart of an ill-formed sequence transcodes to one
+/// `CNX_UTF8_REPLACEMENT_CHARACTER`, exactly as in `cnx_utf8_to_utf16` and `cnx_utf8_to_utf32`.
+__attr(nodiscard) static usize
+	length_ill_formed(const_cstring data, usize length, bool utf16, usize start) {
+	let_mut count = static_cast(usize)(0);
+	let_mut i = start;
+	while(i < length) {
+		let_mut code_point = static_cast(u32)(0);
+		i += decode_sequence(data, length, i, &code_point);
+		// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+		count += utf16 && code_point != INVALID_SEQUENCE && code_point >= 0x10000U ? 2U : 1U;
+	}
+	return count;
+}
+
+/// @brief Writes the UTF-16 encoding of the code point decoded by `decode_sequence` to `out`,
+/// returning the number of code units written
+__attr(always_inline) static inline usize write_utf16(u32 code_point, u16* restrict out) {
+	if(code_point == INVALID_SEQUENCE) {
+		out[0] = CNX_UTF8_REPLACEMENT_CHARACTER;
+		return 1;
+	}
+
+	if(code_point < 0x10000U) { // NOLINT
+		out[0] = static_cast(u16)(code_point);
+		return 1;
+	}
+
+	let value = code_point - 0x10000U; // NOLINT
+	out[0] = static_cast(u16)(0xD800U + (value >> 10U)); // NOLINT
+	out[1] = static_cast(u16)(0xDC00U + (value & 0x3FFU)); // NOLINT
+	return 2;
+}
+
+#if CNX_UTF8_SIMD_KERNELS
+
+__attr(always_inline) __attr(nodiscard) static inline bool cpu_has_avx2(void) {
+	return __builtin_cpu_supports("avx2");
+}
+
+__attr(always_inline) __attr(nodiscard) static inline bool cpu_has_ssse3(void) {
+	return __builtin_cpu_supports("ssse3");
+}
+
+	/// @brief Loads an unaligned vector of type `vector_t` from `data + index`
+	#define LOAD(loadu, vector_t, data, index) \
+		loadu(static_cast(const vector_t*)(static_cast(const void*)((data) + (index))))
+	/// @brief Stores the vector `value` of type `vector_t` to `data + index`, unaligned
+	#define STORE(storeu, vector_t, data, index, value) \
+		storeu(static_cast(vector_t*)(static_cast(void*)((data) + (index))), value)
+
+// Validation uses the lookup algorithm from Keiser & Lemire, "Validating UTF-8 In Less Than One
+// Instruction Per Byte". Every error in a UTF-8 sequence is detectable from one of its bytes and
+// the byte before it, except for sequences that are too short or too long, which additionally
+// need the bytes two and three before it. Each of the three nibbles (the high and low nibbles of
+// the previous byte and the high nibble of the current byte) is looked up in a table mapping it
+// to the set of error classes it's consistent with; a byte pair is an error iff all three lookups
+// share an error class.
+
+	/// @brief A lead byte isn't followed by enough continuation bytes
+	#define TOO_SHORT (1U << 0U)
+	/// @brief A continuation byte isn't preceded by a lead byte
+	#define TOO_LONG (1U << 1U)
+	/// @brief An overlong three-byte sequence (`0xE0` followed by `< 0xA0`)
+	#define OVERLONG_3 (1U << 2U)
+	/// @brief A four-byte sequence above U+10FFFF (`0xF4` followed by `>= 0x90`, or `>= 0xF5`)
+	#define TOO_LARGE (1U << 3U)
+	/// @brief An encoded surrogate (`0xED` followed by `>= 0xA0`)
+	#define SURROGATE (1U << 4U)
+	/// @brief An overlong two-byte sequence (`0xC0` or `0xC1`)
+	#define OVERLONG_2 (1U << 5U)
+	/// @brief A four-byte sequence above U+10FFFF (`>= 0xF5` followed by `0x80`-`0x8F`)
+	#define TOO_LARGE_1000 (1U << 6U)
+	/// @brief An overlong four-byte sequence (`0xF0` followed by `< 0x90`)
+	#define OVERLONG_4 (1U << 6U)
+	/// @brief Two continuation bytes in a row, which may or may not be an error, depending on
+	/// the bytes before them (see `must_be_continuation`)
+	#define TWO_CONTS (1U << 7U)
+	/// @brief The error classes that depend only on the high nibble of the previous byte
+	#define CARRY (TOO_SHORT | TOO_LONG | TWO_CONTS)
+
+/// @brief Error classes by the high nibble of the previous byte
+static const u8 byte_1_high_table[16] = { // NOLINT
+	TOO_LONG,
+	TOO_LONG,
+	TOO_LONG,
+	TOO_LONG,
+	TOO_LONG,
+	TOO_LONG,
+	TOO_LONG,
+	TOO_LONG,
+	TWO_CONTS,
+	TWO_CONTS,
+	TWO_CONTS,
+	TWO_CONTS,
+	TOO_SHORT | OVERLONG_2,
+	TOO_SHORT,
+	TOO_SHORT | OVERLONG_3 | SURROGATE,
+	TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4,
+};
+
+/// @brief Error classes by the low nibble of the previous byte
+static const u8 byte_1_low_table[16] = { // NOLINT
+	CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+	CARRY | OVERLONG_2,
+	CARRY,
+	CARRY,
+	CARRY | TOO_LARGE,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+	CARRY | TOO_LARGE | TOO_LARGE_1000,
+};
+
+/// @brief Error classes by the high nibble of the current byte
+static const u8 byte_2_high_table[16] = { // NOLINT
+	TOO_SHORT,
+	TOO_SHORT,
+	TOO_SHORT,
+	TOO_SHORT,
+	TOO_SHORT,
+	TOO_SHORT,
+	TOO_SHORT,
+	TOO_SHORT,
+	TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+	TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+	TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+	TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+	TOO_SHORT,
+	TOO_SHORT,
+	TOO_SHORT,
+	TOO_SHORT,
+};
+
+/// @brief The per-position maximum byte values that don't leave a sequence incomplete at the end
+/// of a 32-byte block: a two-, three-, or four-byte lead in the last one, two, or three bytes,
+/// respectively, needs continuation bytes from the next block. The 16-byte variant is the last 16
+/// bytes of this
+static const u8 incomplete_maximums[32] = { // NOLINT
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // NOLINT
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // NOLINT
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // NOLINT
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1, // NOLINT
+};
+
+/// @brief The state carried between blocks by the vectorized validators
+typedef struct Utf8ValidationState128 {
+	__m128i m_error;
+	__m128i m_previous_input;
+	__m128i m_previous_incomplete;
+} Utf8ValidationState128;
+
+__attr(target("ssse3")) __attr(always_inline) static inline void
+	validate_block_ssse3(Utf8ValidationState128* restrict state, __m128i input) {
+	if(_mm_movemask_epi8(input) == 0) {
+		// an ASCII block is valid, unless the previous block ended mid-sequence
+		state->m_error = _mm_or_si128(state->m_error, state->m_previous_incomplete);
+		state->m_previous_incomplete = _mm_setzero_si128();
+		state->m_previous_input = input;
+		return;
+	}
+
+	let low_nibble_mask = _mm_set1_epi8(0x0F);
+	let previous_1 = _mm_alignr_epi8(input, state->m_previous_input, 15);
+	let byte_1_high = _mm_shuffle_epi8(
+		LOAD(_mm_loadu_si128, __m128i, byte_1_high_table, 0),
+		_mm_and_si128(_mm_srli_epi16(previous_1, 4), low_nibble_mask));
+	let byte_1_low = _mm_shuffle_epi8(LOAD(_mm_loadu_si128, __m128i, byte_1_low_table, 0),
+									  _mm_and_si128(previous_1, low_nibble_mask));
+	let byte_2_high
+		= _mm_shuffle_epi8(LOAD(_mm_loadu_si128, __m128i, byte_2_high_table, 0),
+						   _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble_mask));
+	let special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+	// bytes two or three after a three- or four-byte lead must be continuation bytes, which
+	// `special_cases` flags as `TWO_CONTS`; anywhere else `TWO_CONTS` is an error
+	let previous_2 = _mm_alignr_epi8(input, state->m_previous_input, 14);
+	let previous_3 = _mm_alignr_epi8(input, state->m_previous_input, 13);
+	let is_third_byte = _mm_subs_epu8(previous_2, _mm_set1_epi8(static_cast(char)(0xE0 - 0x80)));
+	let is_fourth_byte = _mm_subs_epu8(previous_3, _mm_set1_epi8(static_cast(char)(0xF0 - 0x80)));
+	let must_be_continuation
+		= _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte),
+						_mm_set1_epi8(static_cast(char)(0x80))); // NOLINT
+
+	state->m_error = _mm_or_si128(state->m_error,
+								  _mm_xor_si128(must_be_continuation, special_cases));
+	state->m_previous_incomplete
+		= _mm_subs_epu8(input, LOAD(_mm_loadu_si128, __m128i, incomplete_maximums, 16));
+	state->m_previous_input = input;
+}
+
+__attr(target("ssse3")) __attr(nodiscard) static bool validate_ssse3(const_cstring data,
+																	  usize length) {
+	let_mut state = (Utf8ValidationState128){.m_error = _mm_setzero_si128(),
+											 .m_previous_input = _mm_setzero_si128(),
+											 .m_previous_incomplete = _mm_setzero_si128()};
+	let_mut i = static_cast(usize)(0);
+	for(; i + 16 <= length; i += 16) {
+		validate_block_ssse3(&state, LOAD(_mm_loadu_si128, __m128i, data, i));
+	}
+
+	// the zero padding of the final block flags any sequence left incomplete by the input
+	char tail[16] = {0}; // NOLINT
+	memcpy(tail, data + i, length - i);
+	validate_block_ssse3(&state, LOAD(_mm_loadu_si128, __m128i, tail, 0));
+
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(state.m_error, _mm_setzero_si128())) == 0xFFFF;
+}
+
+/// @brief The state carried between blocks by the vectorized validators
+typedef struct Utf8ValidationState256 {
+	__m256i m_error;
+	__m256i m_previous_input;
+	__m256i m_previous_incomplete;
+} Utf8ValidationState256;
+
+	/// @brief Returns the 32 bytes ending `N` bytes before the end of `input`, continuing from
+	/// `previous`, by shifting across the two 128-bit lanes
+	#define PREVIOUS_AVX2(input, previous, N) \
+		_mm256_alignr_epi8(input, _mm256_permute2x128_si256(previous, input, 0x21), 16 - (N))
+
+__attr(target("avx2")) __attr(always_inline) static inline void
+	validate_block_avx2(Utf8ValidationState256* restrict state, __m256i input) {
+	if(_mm256_movemask_epi8(input) == 0) {
+		// an ASCII block is valid, unless the previous block ended mid-sequence
+		state->m_error = _mm256_or_si256(state->m_error, state->m_previous_incomplete);
+		state->m_previous_incomplete = _mm256_setzero_si256();
+		state->m_previous_input = input;
+		return;
+	}
+
+	let low_nibble_mask = _mm256_set1_epi8(0x0F);
+	let previous_1 = PREVIOUS_AVX2(input, state->m_previous_input, 1);
+	let byte_1_high = _mm256_shuffle_epi8(
+		_mm256_broadcastsi128_si256(LOAD(_mm_loadu_si128, __m128i, byte_1_high_table, 0)),
+		_mm256_and_si256(_mm256_srli_epi16(previous_1, 4), low_nibble_mask));
+	let byte_1_low = _mm256_shuffle_epi8(
+		_mm256_broadcastsi128_si256(LOAD(_mm_loadu_si128, __m128i, byte_1_low_table, 0)),
+		_mm256_and_si256(previous_1, low_nibble_mask));
+	let byte_2_high = _mm256_shuffle_epi8(
+		_mm256_broadcastsi128_si256(LOAD(_mm_loadu_si128, __m128i, byte_2_high_table, 0)),
+		_mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble_mask));
+	let special_cases
+		= _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+	let previous_2 = PREVIOUS_AVX2(input, state->m_previous_input, 2);
+	let previous_3 = PREVIOUS_AVX2(input, state->m_previous_input, 3);
+	let is_third_byte
+		= _mm256_subs_epu8(previous_2, _mm256_set1_epi8(static_cast(char)(0xE0 - 0x80)));
+	let is_fourth_byte
+		= _mm256_subs_epu8(previous_3, _mm256_set1_epi8(static_cast(char)(0xF0 - 0x80)));
+	let must_be_continuation
+		= _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte),
+						   _mm256_set1_epi8(static_cast(char)(0x80))); // NOLINT
+
+	state->m_error = _mm256_or_si256(state->m_error,
+									 _mm256_xor_si256(must_be_continuation, special_cases));
+	state->m_previous_incomplete
+		= _mm256_subs_epu8(input, LOAD(_mm256_loadu_si256, __m256i, incomplete_maximums, 0));
+	state->m_previous_input = input;
+}
+
+	#undef PREVIOUS_AVX2
+
+__attr(target("avx2")) __attr(nodiscard) static bool validate_avx2(const_cstring data,
+																	usize length) {
+	let_mut state = (Utf8ValidationState256){.m_error = _mm256_setzero_si256(),
+											 .m_previous_input = _mm256_setzero_si256(),
+											 .m_previous_incomplete = _mm256_setzero_si256()};
+	let_mut i = static_cast(usize)(0);
+	for(; i + 32 <= length; i += 32) {
+		validate_block_avx2(&state, LOAD(_mm256_loadu_si256, __m256i, data, i));
+	}
+
+	// the zero padding of the final block flags any sequence left incomplete by the input
+	char tail[32] = {0}; // NOLINT
+	memcpy(tail, data + i, length - i);
+	validate_block_avx2(&state, LOAD(_mm256_loadu_si256, __m256i, tail, 0));
+
+	return _mm256_testz_si256(state.m_error, state.m_error) != 0;
+}
+
+	#undef TOO_SHORT
+	#undef TOO_LONG
+	#undef OVERLONG_3
+	#undef TOO_LARGE
+	#undef SURROGATE
+	#undef OVERLONG_2
+	#undef TOO_LARGE_1000
+	#undef OVERLONG_4
+	#undef TWO_CONTS
+	#undef CARRY
+
+__attr(target("avx2")) __attr(nodiscard) static usize
+	length_avx2(const_cstring data, usize length, bool count_four_byte_leads) {
+	// continuation bytes are exactly those `< -64` as signed bytes
+	let continuation_limit = _mm256_set1_epi8(-65); // NOLINT
+	let four_byte_lead = _mm256_set1_epi8(static_cast(char)(0xF0));
+	let_mut count = static_cast(usize)(0);
+	let_mut i = static_cast(usize)(0);
+	for(; i + 32 <= length; i += 32) {
+		let block = LOAD(_mm256_loadu_si256, __m256i, data, i);
+		let leads = static_cast(u32)(
+			_mm256_movemask_epi8(_mm256_cmpgt_epi8(block, continuation_limit)));
+		count += static_cast(usize)(__builtin_popcount(leads));
+		if(count_four_byte_leads) {
+			let is_four_byte_lead
+				= _mm256_cmpeq_epi8(_mm256_max_epu8(block, four_byte_lead), block);
+			count += static_cast(usize)(
+				__builtin_popcount(static_cast(u32)(_mm256_movemask_epi8(is_four_byte_lead))));
+		}
+	}
+	return count + length_scalar(data, length, count_four_byte_leads, i);
+}
+
+__attr(nodiscard) static usize
+	length_sse2(const_cstring data, usize length, bool count_four_byte_leads) {
+	// continuation bytes are exactly those `< -64` as signed bytes
+	let continuation_limit = _mm_set1_epi8(-65); // NOLINT
+	let four_byte_lead = _mm_set1_epi8(static_cast(char)(0xF0));
+	let_mut count = static_cast(usize)(0);
+	let_mut i = static_cast(usize)(0);
+	for(; i + 16 <= length; i += 16) {
+		let block = LOAD(_mm_loadu_si128, __m128i, data, i);
+		let leads = static_cast(u32)(_mm_movemask_epi8(_mm_cmpgt_epi8(block, continuation_limit)));
+		count += static_cast(usize)(__builtin_popcount(leads));
+		if(count_four_byte_leads) {
+			let is_four_byte_lead = _mm_cmpeq_epi8(_mm_max_epu8(block, four_byte_lead), block);
+			count += static_cast(usize)(
+				__builtin_popcount(static_cast(u32)(_mm_movemask_epi8(is_four_byte_lead))));
+		}
+	}
+	return count + length_scalar(data, length, count_four_byte_leads, i);
+}
+
+/// @brief If the 16 bytes at `data + index` are all ASCII, widens them to UTF-16 at `out` and
+/// returns true
+__attr(always_inline) __attr(nodiscard) static inline bool
+	widen_ascii_utf16(const_cstring data, usize index, u16* restrict out) {
+	let block = LOAD(_mm_loadu_si128, __m128i, data, index);
+	if(_mm_movemask_epi8(block) != 0) {
+		return false;
+	}
+
+	let zero = _mm_setzero_si128();
+	STORE(_mm_storeu_si128, __m128i, out, 0, _mm_unpacklo_epi8(block, zero));
+	STORE(_mm_storeu_si128, __m128i, out, 8, _mm_unpackhi_epi8(block, zero));
+	return true;
+}
+
+/// @brief If the 16 bytes at `data + index` are all ASCII, widens them to UTF-32 at `out` and
+/// returns true
+__attr(always_inline) __attr(nodiscard) static inline bool
+	widen_ascii_utf32(const_cstring data, usize index, u32* restrict out) {
+	let block = LOAD(_mm_loadu_si128, __m128i, data, index);
+	if(_mm_movemask_epi8(block) != 0) {
+		return false;
+	}
+
+	let zero = _mm_setzero_si128();
+	let low = _mm_unpacklo_epi8(block, zero);
+	let high = _mm_unpackhi_epi8(block, zero);
+	STORE(_mm_storeu_si128, __m128i, out, 0, _mm_unpacklo_epi16(low, zero));
+	STORE(_mm_storeu_si128, __m128i, out, 4, _mm_unpackhi_epi16(low, zero));
+	STORE(_mm_storeu_si128, __m128i, out, 8, _mm_unpacklo_epi16(high, zero));
+	STORE(_mm_storeu_si128, __m128i, out, 12, _mm_unpackhi_epi16(high, zero)); // NOLINT
+	return true;
+}
+
+/// @brief If the 8 code units at `data + index` are all ASCII, narrows them to UTF-8 at `out` and
+/// returns true
+__attr(always_inline) __attr(nodiscard) static inline bool
+	narrow_ascii_utf16(const u16* restrict data, usize index, char* restrict out) {
+	let block = LOAD(_mm_loadu_si128, __m128i, data, index);
+	// any code unit `>= 0x80` has a bit set outside of the low seven
+	let high_bits = _mm_and_si128(block, _mm_set1_epi16(static_cast(i16)(0xFF80))); // NOLINT
+	if(_mm_movemask_epi8(_mm_cmpeq_epi16(high_bits, _mm_setzero_si128())) != 0xFFFF) { // NOLINT
+		return false;
+	}
+
+	_mm_storel_epi64(static_cast(__m128i*)(static_cast(void*)(out)),
+					 _mm_packus_epi16(block, block));
+	return true;
+}
+
+#endif // CNX_UTF8_SIMD_KERNELS
+
+bool cnx_utf8_is_ascii(restrict const_cstring data, usize length) {
+	return cnx_byte_scan_find_non_ascii(data, length) == length;
+}
+
+bool cnx_utf8_validate(restrict const_cstring data, usize length) {
+#if CNX_UTF8_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		return validate_avx2(data, length);
+	}
+	if(cpu_has_ssse3()) {
+		return validate_ssse3(data, length);
+	}
+#endif // CNX_UTF8_SIMD_KERNELS
+
+	return find_invalid_scalar(data, length, 0) == length;
+}
+
+usize cnx_utf8_find_invalid(restrict const_cstring data, usize length) {
+	// valid input, the common case, is confirmed by the vectorized validator. The scalar search
+	// is only needed to locate an error once one is known to exist
+	if(cnx_utf8_validate(data, length)) {
+		return length;
+	}
+
+	return find_invalid_scalar(data, length, 0);
+}
+
+u32 cnx_utf8_decode(restrict const_cstring data, usize length, usize* restrict index) {
+	cnx_assert(*index < length, "cnx_utf8_decode called with an index out of bounds");
+
+	let_mut code_point = static_cast(u32)(0);
+	*index += decode_sequence(data, length, *index, &code_point);
+	return code_point == INVALID_SEQUENCE ? CNX_UTF8_REPLACEMENT_CHARACTER : code_point;
+}
+
+usize cnx_utf8_encode(u32 code_point, char* restrict out) {
+	if(!is_scalar_value(code_point)) {
+		code_point = CNX_UTF8_REPLACEMENT_CHARACTER;
+	}
+
+	if(code_point < 0x80U) { // NOLINT
+		out[0] = static_cast(char)(code_point);
+		return 1;
+	}
+	if(code_point < 0x800U) { // NOLINT
+		out[0] = static_cast(char)(0xC0U | (code_point >> 6U)); // NOLINT
+		out[1] = static_cast(char)(0x80U | (code_point & 0x3FU)); // NOLINT
+		return 2;
+	}
+	if(code_point < 0x10000U) { // NOLINT
+		out[0] = static_cast(char)(0xE0U | (code_point >> 12U)); // NOLINT
+		out[1] = static_cast(char)(0x80U | ((code_point >> 6U) & 0x3FU)); // NOLINT
+		out[2] = static_cast(char)(0x80U | (code_point & 0x3FU)); // NOLINT
+		return 3;
+	}
+
+	out[0] = static_cast(char)(0xF0U | (code_point >> 18U)); // NOLINT
+	out[1] = static_cast(char)(0x80U | ((code_point >> 12U) & 0x3FU)); // NOLINT
+	out[2] = static_cast(char)(0x80U | ((code_point >> 6U) & 0x3FU)); // NOLINT
+	out[3] = static_cast(char)(0x80U | (code_point & 0x3FU)); // NOLINT
+	return 4;
+}
+
+/// @brief Returns the transcoded length of `data`, which must be valid UTF-8, in UTF-16 code
+/// units if `utf16` is true, otherwise in UTF-32 code units
+__attr(nodiscard) static inline usize length_valid(const_cstring data, usize length, bool utf16) {
+#if CNX_UTF8_SIMD_KERNELS
+	if(cpu_has_avx2()) {
+		return length_avx2(data, length, utf16);
+	}
+	return length_sse2(data, length, utf16);
+#else
+	return length_scalar(data, length, utf16, 0);
+#endif // CNX_UTF8_SIMD_KERNELS
+}
+
+usize cnx_utf8_utf16_length(restrict const_cstring data, usize length) {
+	// the vectorized count is only exact for valid UTF-8, so input from the first ill-formed
+	// sequence onward is decoded instead
+	let valid_length = cnx_utf8_find_invalid(data, length);
+	return length_valid(data, valid_length, true)
+		   + length_ill_formed(data, length, true, valid_length);
+}
+
+usize cnx_utf8_utf32_length(restrict const_cstring data, usize length) {
+	let valid_length = cnx_utf8_find_invalid(data, length);
+	return length_valid(data, valid_length, false)
+		   + length_ill_formed(data, length, false, valid_length);
+}
+
+usize cnx_utf8_to_utf16(restrict const_cstring data, usize length, u16* restrict out) {
+	let_mut written = static_cast(usize)(0);
+	let_mut i = static_cast(usize)(0);
+	while(i < length) {
+#if CNX_UTF8_SIMD_KERNELS
+		if(i + 16 <= length && widen_ascii_utf16(data, i, out + written)) {
+			i += 16;
+			written += 16;
+			continue;
+		}
+#endif // CNX_UTF8_SIMD_KERNELS
+
+		let_mut code_point = static_cast(u32)(0);
+		i += decode_sequence(data, length, i, &code_point);
+		written += write_utf16(code_point, out + written);
+	}
+
+	return written;
+}
+
+usize cnx_utf8_to_utf32(restrict const_cstring data, usize length, u32* restrict out) {
+	let_mut written = static_cast(usize)(0);
+	let_mut i = static_cast(usize)(0);
+	while(i < length) {
+#if CNX_UTF8_SIMD_KERNELS
+		if(i + 16 <= length && widen_ascii_utf32(data, i, out + written)) {
+			i += 16;
+			written += 16;
+			continue;
+		}
+#endif // CNX_UTF8_SIMD_KERNELS
+
+		let_mut code_point = static_cast(u32)(0);
+		i += decode_sequence(data, length, i, &code_point);
+		out[written++]
+			= code_point == INVALID_SEQUENCE ? CNX_UTF8_REPLACEMENT_CHARACTER : code_point;
+	}
+
+	return written;
+}
+
+/// @brief Decodes the UTF-16 code point starting at `data[index]`, setting `code_point` and
+/// returning the number of code units consumed
+__attr(always_inline) __attr(nodiscard) static inline usize
+	decode_utf16(const u16* restrict data, usize length, usize index, u32* restrict code_point) {
+	let unit = static_cast(u32)(data[index]);
+	if(!is_surrogate(unit)) {
+		*code_point = unit;
+		return 1;
+	}
+
+	if(unit <= 0xDBFFU && index + 1 < length) { // NOLINT
+		let next = static_cast(u32)(data[index + 1]);
+		if(next >= 0xDC00U && next <= 0xDFFFU) { // NOLINT
+			*code_point = 0x10000U + ((unit - 0xD800U) << 10U) + (next - 0xDC00U); // NOLINT
+			return 2;
+		}
+	}
+
+	*code_point = CNX_UTF8_REPLACEMENT_CHARACTER;
+	return 1;
+}
+
+__attr(always_inline) __attr(nodiscard) static inline usize encoded_length(u32 code_point) {
+	if(!is_scalar_value(code_point)) {
+		return 3;
+	}
+	if(code_point < 0x80U) { // NOLINT
+		return 1;
+	}
+	if(code_point < 0x800U) { // NOLINT
+		return 2;
+	}
+	return code_point < 0x10000U ? 3U : 4U; // NOLINT
+}
+
+usize cnx_utf16_utf8_length(const u16* restrict data, usize length) {
+	let_mut count = static_cast(usize)(0);
+	let_mut i = static_cast(usize)(0);
+	while(i < length) {
+		let_mut code_point = static_cast(u32)(0);
+		i += decode_utf16(data, length, i, &code_point);
+		count += encoded_length(code_point);
+	}
+	return count;
+}
+
+usize cnx_utf16_to_utf8(const u16* restrict data, usize length, char* restrict out) {
+	let_mut written = static_cast(usize)(0);
+	let_mut i = static_cast(usize)(0);
+	while(i < length) {
+#if CNX_UTF8_SIMD_KERNELS
+		if(i + 8 <= length && narrow_ascii_utf16(data, i, out + written)) {
+			i += 8;
+			written += 8;
+			continue;
+		}
+#endif // CNX_UTF8_SIMD_KERNELS
+
+		let_mut code_point = static_cast(u32)(0);
+		i += decode_utf16(data, length, i, &code_point);
+		written += cnx_utf8_encode(code_point, out + written);
+	}
+
+	return written;
+}
+
+usize cnx_utf32_utf8_length(const u32* restrict data, usize length) {
+	let_mut count = static_cast(usize)(0);
+	for(let_mut i = static_cast(usize)(0); i < length; ++i) {
+		count += encoded_length(data[i]);
+	}
+	return count;
+}
+
+usize cnx_utf32_to_utf8(const u32* restrict data, usize length, char* restrict out) {
+	let_mut written = static_cast(usize)(0);
+	for(let_mut i = static_cast(usize)(0); i < length; ++i) {
+		written += cnx_utf8_encode(data[i], out + written);
+	}
+	return written;
+}
+
+static const cnx_code_point_iterator_vtable_t cnx_code_point_iterator_vtable = {
+	.begin = cnx_code_point_iterator_begin,
+	.end = cnx_code_point_iterator_end,
+	.cbegin = cnx_code_point_iterator_cbegin,
+	.cend = cnx_code_point_iterator_cend,
+};
+
+CnxCodePointIterator cnx_code_point_iterator_new(CnxStringView input) {
+	return (CnxCodePointIterator){.m_input = input,
+								  .m_position = 0,
+								  .m_current = 0,
+								  .m_vtable = &cnx_code_point_iterator_vtable};
+}
+
+/// @brief Advances `self` to its next code point, returning whether there was one
+__attr(nodiscard) static bool advance(CnxCodePointIterator* restrict self) {
+	if(self->m_position >= self->m_input.m_length) {
+		return false;
+	}
+
+	self->m_current = cnx_utf8_decode(self->m_input.m_view,
+									  self->m_input.m_length,
+									  &(self->m_position));
+	return true;
+}
+
+CnxOption(u32) cnx_code_point_iterator_next(CnxCodePointIterator* restrict self) {
+	return advance(self) ? Some(u32, self->m_current) : None(u32);
+}
+
+CnxStringView cnx_code_point_iterator_remainder(const CnxCodePointIterator* restrict self) {
+	let_mut remainder = self->m_input;
+	remainder.m_view += self->m_position;
+	remainder.m_length -= self->m_position;
+	return remainder;
+}
+
+void cnx_code_point_iterator_reset(CnxCodePointIterator* restrict self) {
+	self->m_position = 0;
+	self->m_current = 0;
+}
+
+__attr(nodiscard) static CnxCodePointIteratorCursor
+	cnx_code_point_iterator_cursor_new(const CnxCodePointIterator* restrict self) {
+	// the code point iterator is documented to be mutable, so casting away `const` here is fine;
+	// `into_iter` just requires a const pointer by convention
+	return (CnxCodePointIteratorCursor){
+		.m_index = 0,
+		.m_code_points = static_cast(CnxCodePointIterator*)(self)};
+}
+
+__attr(nodiscard) static Ref(u32)
+	cnx_code_point_iterator_cursor_next(CnxForwardIterator(Ref(u32)) * restrict self) {
+	let_mut _self = static_cast(CnxCodePointIteratorCursor*)(self->m_self);
+
+	cnx_assert(_self->m_index >= 0,
+			   "Iterator advanced when iterator is positioned at the end of the iteration "
+			   "(iterator out of bounds)");
+
+	_self->m_index = advance(_self->m_code_points) ? _self->m_index + 1 : -1;
+	return &(_self->m_code_points->m_current);
+}
+
+__attr(nodiscard) static Ref(u32)
+	cnx_code_point_iterator_cursor_current(const CnxForwardIterator(Ref(u32)) * restrict self) {
+	let _self = static_cast(const CnxCodePointIteratorCursor*)(self->m_self);
+
+	cnx_assert(_self->m_index >= 0,
+			   "Iterator value accessed when iterator is positioned at the end of the iteration "
+			   "(iterator out of bounds)");
+
+	return &(_self->m_code_points->m_current);
+}
+
+__attr(nodiscard) static bool
+	cnx_code_point_iterator_cursor_equals(const CnxForwardIterator(Ref(u32)) * restrict self,
+										  const CnxForwardIterator(Ref(u32)) * restrict rhs) {
+	let _self = static_cast(const CnxCodePointIteratorCursor*)(self->m_self);
+	let _rhs = static_cast(const CnxCodePointIteratorCursor*)(rhs->m_self);
+
+	return _self->m_code_points == _rhs->m_code_points && _self->m_index == _rhs->m_index;
+}
+
+__attr(nodiscard) static ConstRef(u32)
+	cnx_code_point_iterator_cursor_cnext(CnxForwardIterator(ConstRef(u32)) * restrict self) {
+	return cnx_code_point_iterator_cursor_next(static_cast(CnxForwardIterator(Ref(u32))*)(self));
+}
+
+__attr(nodiscard) static ConstRef(u32) cnx_code_point_iterator_cursor_ccurrent(
+	const CnxForwardIterator(ConstRef(u32)) * restrict self) {
+	return cnx_code_point_iterator_cursor_current(
+		static_cast(const CnxForwardIterator(Ref(u32))*)(self));
+}
+
+__attr(nodiscard) static bool
+	cnx_code_point_iterator_cursor_cequals(const CnxForwardIterator(ConstRef(u32)) * restrict self,
+										   const CnxForwardIterator(ConstRef(u32)) * restrict rhs) {
+	return cnx_code_point_iterator_cursor_equals(
+		static_cast(const CnxForwardIterator(Ref(u32))*)(self),
+		static_cast(const CnxForwardIterator(Ref(u32))*)(rhs));
+}
+
+static ImplIntoCnxForwardIterator(CnxCodePointIterator,
+								  Ref(u32),
+								  cnx_code_point_iterator_into_iter,
+								  cnx_code_point_iterator_cursor_new,
+								  cnx_code_point_iterator_cursor_next,
+								  cnx_code_point_iterator_cursor_current,
+								  cnx_code_point_iterator_cursor_equals);
+static ImplIntoCnxForwardIterator(CnxCodePointIterator,
+								  ConstRef(u32),
+								  cnx_code_point_iterator_into_const_iter,
+								  cnx_code_point_iterator_cursor_new,
+								  cnx_code_point_iterator_cursor_cnext,
+								  cnx_code_point_iterator_cursor_ccurrent,
+								  cnx_code_point_iterator_cursor_cequals);
+
+CnxForwardIterator(Ref(u32)) cnx_code_point_iterator_begin(CnxCodePointIterator* restrict self) {
+	cnx_code_point_iterator_reset(self);
+	let_mut iter = cnx_code_point_iterator_into_iter(self);
+	let_mut inner = static_cast(CnxCodePointIteratorCursor*)(iter.m_self);
+	inner->m_index = advance(self) ? 0 : -1;
+	return iter;
+}
+
+CnxForwardIterator(Ref(u32)) cnx_code_point_iterator_end(CnxCodePointIterator* restrict self) {
+	let_mut iter = cnx_code_point_iterator_into_iter(self);
+	let_mut inner = static_cast(CnxCodePointIteratorCursor*)(iter.m_self);
+	inner->m_index = -1;
+	return iter;
+}
+
+CnxForwardIterator(ConstRef(u32))
+	cnx_code_point_iterator_cbegin(CnxCodePointIterator* restrict self) {
+	cnx_code_point_iterator_reset(self);
+	let_mut iter = cnx_code_point_iterator_into_const_iter(self);
+	let_mut inner = static_cast(CnxCodePointIteratorCursor*)(iter.m_self);
+	inner->m_index = advance(self) ? 0 : -1;
+	return iter;
+}
+
+CnxForwardIterator(ConstRef(u32))
+	cnx_code_point_iterator_cend(CnxCodePointIterator* restrict self) {
+	let_mut iter = cnx_code_point_iterator_into_const_iter(self);
+	let_mut inner = static_cast(CnxCodePointIteratorCursor*)(iter.m_self);
+	inner->m_index = -1;
+	return iter;
+}
@@ -0,0 +1,123 @@
+#include <Cnx/IO.h>
+#include <Cnx/Platform.h>
+#include <Cnx/Span.h>
+#include <Cnx/String.h>
+#define VECTOR_INCLUDE_DEFAULT_INSTANTIATIONS TRUE
+#include <Cnx/Vector.h>
+#undef VECTOR_INCLUDE_DEFAULT_INSTANTIATIONS
+#include <Cnx/time/Clock.h>
+
+#define FOREACH_BENCHMARK_SIZE 1000000
+
+typedef struct ForeachBenchmarkResult {
+	i64 sum;
+	i32 min;
+	i32 max;
+} ForeachBenchmarkResult;
+
+// iterates through `CnxVector(i32)`'s iterators: an indirect call to `next` and `equals` per
+// element, which the compiler can't see through
+__attr(noinline) static ForeachBenchmarkResult foreach_iterators(const CnxVector(i32) * vec) {
+	let_mut result
+		= (ForeachBenchmarkResult){.sum = 0, .min = cnx_max_value(i32), .max = cnx_min_value(i32)};
+	foreach(value, *vec) {
+		result.sum += value;
+		result.min = value < result.min ? value : result.min;
+		result.max = value > result.max ? value : result.max;
+	}
+	return result;
+}
+
+// iterates through a `CnxSpan(i32)` of the vector's elements: a raw pointer loop that the compiler
+// can unroll and vectorize
+__attr(noinline) static ForeachBenchmarkResult foreach_contiguous(CnxSpan(i32) span) {
+	let_mut result
+		= (ForeachBenchmarkResult){.sum = 0, .min = cnx_max_value(i32), .max = cnx_min_value(i32)};
+	foreach_span(value, span) {
+		result.sum += value;
+		result.min = value < result.min ? value : result.min;
+		result.max = value > result.max ? value : result.max;
+	}
+	return result;
+}
+
+// `CnxString` is contiguous, so `foreach` takes the raw pointer path for it automatically
+__attr(noinline) static usize foreach_string(const CnxString* string) {
+	let_mut count = 0U;
+	foreach(character, *string) {
+		count += character == ' ' ? 1U : 0U;
+	}
+	return count;
+}
+
+static f64 foreach_benchmark_elapsed(CnxTimePoint start, CnxTimePoint end) {
+	return static_cast(f64)(
+		cnx_duration_subtract(end.time_since_epoch, start.time_since_epoch).count);
+}
+
+i32 main(i32 argc, char** argv) {
+
+	ignore(argc, argv);
+
+	println("beginning foreach iterators vs contiguous benchmark");
+	let num_runs = 100;
+
+	CnxScopedVector(i32) vec = cnx_vector_new_with_capacity(i32, FOREACH_BENCHMARK_SIZE);
+	for(let_mut i = 0; i < FOREACH_BENCHMARK_SIZE; ++i) {
+		// NOLINTNEXTLINE(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+		cnx_vector_push_back(vec, static_cast(i32)((static_cast(i64)(i) * 7919) % 100003) - 50000);
+	}
+
+	CnxScopedString string = cnx_string_new_with_capacity(FOREACH_BENCHMARK_SIZE);
+	for(let_mut i = 0; i < FOREACH_BENCHMARK_SIZE; ++i) {
+		// NOLINTNEXTLINE(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+		cnx_string_push_back(string, i % 7 == 0 ? ' ' : 'a');
+	}
+
+	let_mut average_iterators = 0.0;
+	let_mut average_contiguous = 0.0;
+	let_mut average_string = 0.0;
+	let_mut iterators_result = (ForeachBenchmarkResult){0};
+	let_mut contiguous_result = (ForeachBenchmarkResult){0};
+	let_mut spaces = 0U;
+
+	for(let_mut i = 0; i < num_runs; ++i) {
+		let start = cnx_clock_now(&cnx_steady_clock);
+		iterators_result = foreach_iterators(&vec);
+		let end = cnx_clock_now(&cnx_steady_clock);
+		average_iterators += foreach_benchmark_elapsed(start, end);
+	}
+	average_iterators = average_iterators / static_cast(f64)(num_runs);
+
+	for(let_mut i = 0; i < num_runs; ++i) {
+		let start = cnx_clock_now(&cnx_steady_clock);
+		contiguous_result = foreach_contiguous(cnx_vector_as_span(i32, vec));
+		let end = cnx_clock_now(&cnx_steady_clock);
+		average_contiguous += foreach_benchmark_elapsed(start, end);
+	}
+	average_contiguous = average_contiguous / static_cast(f64)(num_runs);
+
+	for(let_mut i = 0; i < num_runs; ++i) {
+		let start = cnx_clock_now(&cnx_steady_clock);
+		spaces = foreach_string(&string);
+		let end = cnx_clock_now(&cnx_steady_clock);
+		average_string += foreach_benchmark_elapsed(start, end);
+	}
+	average_string = average_string / static_cast(f64)(num_runs);
+
+	println("Results (iterators): sum: {}, min: {}, max: {}",
+			iterators_result.sum,
+			iterators_result.min,
+			iterators_result.max);
+	println("Results (contiguous): sum: {}, min: {}, max: {}",
+			contiguous_result.sum,
+			contiguous_result.min,
+			contiguous_result.max);
+	println("Run time for foreach over iterators (ns): {d}", average_iterators);
+	println("Run time for foreach over span (ns): {d}", average_contiguous);
+	let relative_perf = average_iterators / average_contiguous;
+	println("Relative performance: {d}", relative_perf);
+	println("Run time for foreach over CnxString ({} spaces) (ns): {d}", spaces, average_string);
+
+	return 0;
+}
@@ -0,0 +1,133 @@
+#include <Cnx/IO.h>
+#include <Cnx/Platform.h>
+#include <Cnx/StringExt.h>
+#include <Cnx/StringSort.h>
+#include <Cnx/time/Clock.h>
+#include <stdlib.h>
+
+#include "../test/TestRandom.h"
+
+#define STRING_SORT_BENCHMARK_SIZE		  200000
+#define STRING_SORT_BENCHMARK_KEY_LENGTH  40
+#define STRING_SORT_BENCHMARK_NUM_RUNS	  10
+#define STRING_SORT_BENCHMARK_SHARED_PREFIX "https://example.com/api/v2/"
+
+// the comparator a generic sort needs for `memcmp` order: it compares each pair from its first
+// character every time it's called, through an indirect call the compiler can't see through
+static i32 string_sort_benchmark_compare(const void* lhs, const void* rhs) {
+	let left = static_cast(const CnxStringView*)(lhs);
+	let right = static_cast(const CnxStringView*)(rhs);
+	let length = left->m_length < right->m_length ? left->m_length : right->m_length;
+	let result = memcmp(left->m_view, right->m_view, length);
+	if(result != 0) {
+		return result;
+	}
+	return left->m_length < right->m_length ? -1 : (left->m_length > right->m_length ? 1 : 0);
+}
+
+// fills `buffer` with `STRING_SORT_BENCHMARK_SIZE` keys, each beginning with `prefix` followed by
+// random lowercase letters, and appends a view of each to `views`
+static void string_sort_benchmark_keys(u32* restrict state,
+									   char* restrict buffer,
+									   restrict const_cstring prefix,
+									   CnxVector(CnxStringView) * restrict views) {
+	let prefix_length = strlen(prefix);
+	for(let_mut i = 0; i < STRING_SORT_BENCHMARK_SIZE; ++i) {
+		let key = buffer + static_cast(usize)(i) * STRING_SORT_BENCHMARK_KEY_LENGTH;
+		memcpy(key, prefix, prefix_length);
+		for(let_mut j = prefix_length; j < STRING_SORT_BENCHMARK_KEY_LENGTH; ++j) {
+			// NOLINTNEXTLINE(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
+			let letter = static_cast(char)(test_random(state) % 26U);
+			key[j] = static_cast(char)('a' + letter);
+		}
+		cnx_vector_push_back(*views,
+							 cnx_stringview_from(key, 0, STRING_SORT_BENCHMARK_KEY_LENGTH));
+	}
+}
+
+static f64 string_sort_benchmark_elapsed(CnxTimePoint start, CnxTimePoint end) {
+	return static_cast(f64)(
+		cnx_duration_subtract(end.time_since_epoch, start.time_since_epoch).count);
+}
+
+// sorts copies of `unsorted` with `cnx_string_sort` and with `qsort`, reporting the average run
+// time of each
+static void string_sort_benchmark_run(const_cstring name,
+									  const CnxVector(CnxStringView) * restrict unsorted) {
+	let size = cnx_vector_size(*unsorted);
+	let bytes = size * sizeof(CnxStringView);
+	CnxScopedVector(CnxStringView) string_sorted
+		= cnx_vector_new_with_capacity(CnxStringView, size);
+	cnx_vector_resize(string_sorted, size);
+	CnxScopedVector(CnxStringView) qsorted = cnx_vector_new_with_capacity(CnxStringView, size);
+	cnx_vector_resize(qsorted, size);
+
+	let_mut average_string_sort = 0.0;
+	let_mut average_qsort = 0.0;
+	for(let_mut i = 0; i < STRING_SORT_BENCHMARK_NUM_RUNS; ++i) {
+		memcpy(cnx_vector_data_mut(string_sorted), cnx_vector_data(*unsorted), bytes);
+		let start = cnx_clock_now(&cnx_steady_clock);
+		cnx_string_sort(string_sorted);
+		let end = cnx_clock_now(&cnx_steady_clock);
+		average_string_sort += string_sort_benchmark_elapsed(start, end);
+
+		memcpy(cnx_vector_data_mut(qsorted), cnx_vector_data(*unsorted), bytes);
+		let qsort_start = cnx_clock_now(&cnx_steady_clock);
+		qsort(cnx_vector_data_mut(qsorted),
+			  size,
+			  sizeof(CnxStringView),
+			  string_sort_benchmark_compare);
+		let qsort_end = cnx_clock_now(&cnx_steady_clock);
+		average_qsort += string_sort_benchmark_elapsed(qsort_start, qsort_end);
+	}
+	average_string_sort = average_string_sort / static_cast(f64)(STRING_SORT_BENCHMARK_NUM_RUNS);
+	average_qsort = average_qsort / static_cast(f64)(STRING_SORT_BENCHMARK_NUM_RUNS);
+
+	// both sorts must agree, or the comparison is meaningless
+	let_mut agree = true;
+	for(let_mut i = static_cast(usize)(0); i < size; ++i) {
+		agree = agree
+				&& string_sort_benchmark_compare(&cnx_vector_at(string_sorted, i),
+												 &cnx_vector_at(qsorted, i))
+					   == 0;
+	}
+
+	println("Results ({}): sorts agree: {}", name, agree);
+	println("Run time for cnx_string_sort ({}) (ns): {d}", name, average_string_sort);
+	println("Run time for qsort with a memcmp comparator ({}) (ns): {d}", name, average_qsort);
+	let relative_perf = average_qsort / average_string_sort;
+	println("Relative performance ({}): {d}", name, relative_perf);
+}
+
+i32 main(i32 argc, char** argv) {
+
+	ignore(argc, argv);
+
+	println("beginning cnx_string_sort vs qsort benchmark");
+	let_mut state = 42U;
+	let buffer_size = static_cast(usize)(STRING_SORT_BENCHMARK_SIZE)
+					  * STRING_SORT_BENCHMARK_KEY_LENGTH;
+	let_mut random_buffer = cnx_allocator_allocate_array_t(char, DEFAULT_ALLOCATOR, buffer_size);
+	let_mut prefix_buffer = cnx_allocator_allocate_array_t(char, DEFAULT_ALLOCATOR, buffer_size);
+
+	// keys that almost always differ in their first few characters
+	CnxScopedVector(CnxStringView) random_keys
+		= cnx_vector_new_with_capacity(CnxStringView, STRING_SORT_BENCHMARK_SIZE);
+	string_sort_benchmark_keys(&state, random_buffer, "", &random_keys);
+	string_sort_benchmark_run("random keys", &random_keys);
+
+	// keys that all share a long prefix, like URLs or file paths, which a comparison sort has to
+	// re-compare on every comparison
+	CnxScopedVector(CnxStringView) prefixed_keys
+		= cnx_vector_new_with_capacity(CnxStringView, STRING_SORT_BENCHMARK_SIZE);
+	string_sort_benchmark_keys(&state,
+							   prefix_buffer,
+							   STRING_SORT_BENCHMARK_SHARED_PREFIX,
+							   &prefixed_keys);
+	string_sort_benchmark_run("shared-prefix keys", &prefixed_keys);
+
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, random_buffer);
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, prefix_buffer);
+
+	return 0;
+}
@@ -26,6 +26,7 @@
 /// SOFTWARE.
 
 #include <Cnx/StringExt.h>
+#include <Cnx/__string/__byte_scan.h>
 #include <Cnx/filesystem/Path.h>
 #include <stdio.h>
 #include <sys/stat.h>
@@ -101,31 +102,32 @@ __attr(always_inline) __attr(nodiscard) __attr(not_null(1)) static inline CnxStr
 #undef OPTION_IMPL
 
 bool cnx_path_is_valid_string(const CnxPath* restrict path) {
-	CnxScopedVector(usize) occurrences
-		= cnx_string_find_occurrences_of_char_with_allocator(*path,
-															 CNX_PATH_SEPARATOR,
-															 path->m_allocator);
+	let data = cnx_string_into_cstring(*path);
+	let length = cnx_string_length(*path);
 #if CNX_PLATFORM_WINDOWS
 	let_mut previous = static_cast(usize)(0);
-
-	foreach(elem, occurrences) {
-		if(elem - previous < 2) {
+	for(let_mut index = cnx_byte_scan_find(data, length, CNX_PATH_SEPARATOR); index < length;
+		index += 1 + cnx_byte_scan_find(data + index + 1, length - index - 1, CNX_PATH_SEPARATOR))
+	{
+		if(index - previous < 2) {
 			return false;
 		}
-		previous = elem;
+		previous = index;
 	}
 
-	return cnx_string_occurrences_of_char(*path, CNX_PATH_SEPARATOR_UNIX) == 0;
+	return cnx_byte_scan_find(data, length, CNX_PATH_SEPARATOR_UNIX) == length;
 #else
 	let_mut previous = static_cast(usize)(0);
-	foreach(elem, occurrences) {
-		if(elem - previous < 2 && previous != 0) {
+	for(let_mut index = cnx_byte_scan_find(data, length, CNX_PATH_SEPARATOR); index < length;
+		index += 1 + cnx_byte_scan_find(data + index + 1, length - index - 1, CNX_PATH_SEPARATOR))
+	{
+		if(index - previous < 2 && previous != 0) {
 			return false;
 		}
-		previous = elem;
+		previous = index;
 	}
 
-	return cnx_string_occurrences_of_char(*path, CNX_PATH_SEPARATOR_WINDOWS) == 0;
+	return cnx_byte_scan_find(data, length, CNX_PATH_SEPARATOR_WINDOWS) == length;
 #endif // CNX_PLATFORM_WINDOWS
 }
 
@@ -165,22 +167,19 @@ CnxPath cnx_path_new_string_was_invalid(CnxString path) {
 	CnxScopedString cloned = path;
 
 #if CNX_PLATFORM_WINDOWS
-	if(cnx_string_occurrences_of_char(cloned, CNX_PATH_SEPARATOR_UNIX) != 0) {
-		CnxScopedVector(usize) occurrences
-			= cnx_string_find_occurrences_of_char(cloned, CNX_PATH_SEPARATOR_WINDOWS);
-		foreach(index, occurrences) {
-			cnx_string_at(cloned, index) = CNX_PATH_SEPARATOR;
-		}
-	}
+	let wrong_separator = CNX_PATH_SEPARATOR_UNIX;
 #else
-	if(cnx_string_occurrences_of_char(cloned, CNX_PATH_SEPARATOR_WINDOWS) != 0) {
-		CnxScopedVector(usize) occurrences
-			= cnx_string_find_occurrences_of_char(cloned, CNX_PATH_SEPARATOR_WINDOWS);
-		foreach(index, occurrences) {
-			cnx_string_at(cloned, index) = CNX_PATH_SEPARATOR;
+	let wrong_separator = CNX_PATH_SEPARATOR_WINDOWS;
+#endif // CNX_PLATFORM_WINDOWS
+	{
+		let_mut data = &cnx_string_at(cloned, 0);
+		let length = cnx_string_length(cloned);
+		for(let_mut index = cnx_byte_scan_find(data, length, wrong_separator); index < length;
+			index += 1 + cnx_byte_scan_find(data + index + 1, length - index - 1, wrong_separator))
+		{
+			data[index] = CNX_PATH_SEPARATOR;
 		}
 	}
-#endif
 
 	CnxScopedVector(CnxString) split
 		= cnx_string_split_on_with_allocator(cloned, CNX_PATH_SEPARATOR, cloned.m_allocator);
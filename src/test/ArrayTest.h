@@ -179,4 +179,21 @@ TEST(CnxArray, iterators) {
 	}
 }
 
+TEST(CnxArray, clone) {
+	let_mut array = cnx_array_new(i32, 10);
+	for(let_mut i = 0; i < 7; ++i) {
+		cnx_array_push_back(array, i);
+	}
+
+	let_mut cloned = cnx_array_clone(array);
+	TEST_ASSERT_EQUAL(cnx_array_size(cloned), cnx_array_size(array));
+	for(let_mut i = 0U; i < cnx_array_size(array); ++i) {
+		TEST_ASSERT_EQUAL(cnx_array_at(cloned, i), cnx_array_at(array, i));
+	}
+
+	cnx_array_resize(cloned, 10);
+	TEST_ASSERT_EQUAL(cnx_array_back(cloned), 0);
+	TEST_ASSERT_EQUAL(cnx_array_size(array), 7U);
+}
+
 #endif // CNX_ARRAY_TEST
@@ -0,0 +1,208 @@
+#ifndef CNX_BTREE_MAP_TEST
+#define CNX_BTREE_MAP_TEST
+
+#include <Cnx/Allocators.h>
+#include <Cnx/Def.h>
+
+#define BTREE_MAP_K			   i32
+#define BTREE_MAP_V			   i32
+#define BTREE_MAP_DECL		   TRUE
+#define BTREE_MAP_IMPL		   TRUE
+#define BTREE_MAP_UNDEF_PARAMS TRUE
+#include <Cnx/BTreeMap.h>
+
+#define RANGE_T	   CnxBTreeMapEntry(i32, i32)
+#define RANGE_DECL TRUE
+#define RANGE_IMPL TRUE
+#include <Cnx/Range.h>
+#undef RANGE_T
+#undef RANGE_DECL
+#undef RANGE_IMPL
+
+#include "Criterion.h"
+#include "TestAllocator.h"
+
+#define BTREE_MAP_TEST_SIZE 5000
+
+static inline i32 btree_map_test_key(i32 index) {
+	// a permutation of [0, BTREE_MAP_TEST_SIZE), so keys arrive out of order
+	return (index * 7919) % BTREE_MAP_TEST_SIZE;
+}
+
+static inline bool btree_map_test_is_ordered(CnxBTreeMap(i32, i32) * map) {
+	let_mut previous = -1;
+	let_mut count = 0U;
+	foreach(entry, *map) {
+		if(entry.m_key <= previous || entry.m_value != entry.m_key * 2) {
+			return false;
+		}
+		previous = entry.m_key;
+		++count;
+	}
+	return count == cnx_btree_map_size(*map);
+}
+
+TEST(CnxBTreeMap, insert_and_get) {
+	CnxScopedBTreeMap(i32, i32) map = cnx_btree_map_new(i32, i32);
+	TEST_ASSERT_TRUE(cnx_btree_map_is_empty(map));
+	TEST_ASSERT_EQUAL(cnx_btree_map_get(map, 4), nullptr);
+
+	for(let_mut i = 0; i < BTREE_MAP_TEST_SIZE; ++i) {
+		let key = btree_map_test_key(i);
+		TEST_ASSERT_TRUE(cnx_btree_map_insert(map, key, key * 2));
+	}
+
+	TEST_ASSERT_EQUAL(cnx_btree_map_size(map), static_cast(usize)(BTREE_MAP_TEST_SIZE));
+	for(let_mut i = 0; i < BTREE_MAP_TEST_SIZE; ++i) {
+		TEST_ASSERT_TRUE(cnx_btree_map_contains(map, i));
+		TEST_ASSERT_EQUAL(cnx_btree_map_at(map, i), i * 2);
+	}
+	TEST_ASSERT_FALSE(cnx_btree_map_contains(map, BTREE_MAP_TEST_SIZE));
+	TEST_ASSERT_FALSE(cnx_btree_map_contains(map, -1));
+	TEST_ASSERT_TRUE(btree_map_test_is_ordered(&map));
+
+	TEST_ASSERT_FALSE(cnx_btree_map_insert(map, 10, 11));
+	TEST_ASSERT_EQUAL(cnx_btree_map_at(map, 10), 11);
+	cnx_btree_map_at_mut(map, 10) = 20;
+	TEST_ASSERT_EQUAL(*cnx_btree_map_get(map, 10), 20);
+	TEST_ASSERT_EQUAL(cnx_btree_map_size(map), static_cast(usize)(BTREE_MAP_TEST_SIZE));
+}
+
+TEST(CnxBTreeMap, erase) {
+	CnxScopedBTreeMap(i32, i32) map = cnx_btree_map_new(i32, i32);
+	for(let_mut i = 0; i < BTREE_MAP_TEST_SIZE; ++i) {
+		let key = btree_map_test_key(i);
+		ignore(cnx_btree_map_insert(map, key, key * 2));
+	}
+
+	for(let_mut i = 0; i < BTREE_MAP_TEST_SIZE; i += 2) {
+		TEST_ASSERT_TRUE(cnx_btree_map_erase(map, i));
+	}
+	TEST_ASSERT_FALSE(cnx_btree_map_erase(map, 0));
+	TEST_ASSERT_EQUAL(cnx_btree_map_size(map), static_cast(usize)(BTREE_MAP_TEST_SIZE / 2));
+	for(let_mut i = 0; i < BTREE_MAP_TEST_SIZE; ++i) {
+		TEST_ASSERT_EQUAL(cnx_btree_map_contains(map, i), i % 2 != 0);
+	}
+	TEST_ASSERT_TRUE(btree_map_test_is_ordered(&map));
+
+	for(let_mut i = BTREE_MAP_TEST_SIZE - 1; i >= 0; --i) {
+		ignore(cnx_btree_map_erase(map, btree_map_test_key(i)));
+	}
+	TEST_ASSERT_TRUE(cnx_btree_map_is_empty(map));
+
+	TEST_ASSERT_TRUE(cnx_btree_map_insert(map, 1, 2));
+	TEST_ASSERT_EQUAL(cnx_btree_map_at(map, 1), 2);
+}
+
+TEST(CnxBTreeMap, lower_and_upper_bound) {
+	CnxScopedBTreeMap(i32, i32) map = cnx_btree_map_new(i32, i32);
+	for(let_mut i = 0; i < 1000; ++i) {
+		ignore(cnx_btree_map_insert(map, i * 10, i * 20));
+	}
+
+	let_mut lower = cnx_btree_map_lower_bound(map, 105);
+	TEST_ASSERT_EQUAL((cnx_iterator_current(lower)).m_key, 110);
+	lower = cnx_btree_map_lower_bound(map, 110);
+	TEST_ASSERT_EQUAL((cnx_iterator_current(lower)).m_key, 110);
+	let upper = cnx_btree_map_upper_bound(map, 110);
+	TEST_ASSERT_EQUAL((cnx_iterator_current(upper)).m_key, 120);
+
+	let end = cnx_btree_map_end(map);
+	let past_end = cnx_btree_map_lower_bound(map, 9991);
+	TEST_ASSERT_TRUE(cnx_iterator_equals(past_end, end));
+	let last = cnx_btree_map_upper_bound(map, 9989);
+	TEST_ASSERT_EQUAL((cnx_iterator_current(last)).m_key, 9990);
+
+	let_mut begin = cnx_btree_map_lower_bound(map, 2000);
+	let stop = cnx_btree_map_lower_bound(map, 3000);
+	let_mut count = 0;
+	for(; !cnx_iterator_equals(begin, stop); ignore(cnx_iterator_next(begin))) {
+		TEST_ASSERT_EQUAL((cnx_iterator_current(begin)).m_key, 2000 + count * 10);
+		++count;
+	}
+	TEST_ASSERT_EQUAL(count, 100);
+}
+
+TEST(CnxBTreeMap, from_sorted) {
+	let_mut entries = cnx_allocator_allocate_array_t(CnxBTreeMapEntry(i32, i32),
+													 DEFAULT_ALLOCATOR,
+													 BTREE_MAP_TEST_SIZE);
+	for(let_mut i = 0; i < BTREE_MAP_TEST_SIZE; ++i) {
+		entries[i] = (CnxBTreeMapEntry(i32, i32)){.m_key = i, .m_value = i * 2};
+	}
+
+	CnxScopedBTreeMap(i32, i32) map
+		= cnx_btree_map_from_sorted(i32, i32, entries, BTREE_MAP_TEST_SIZE);
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, entries);
+
+	TEST_ASSERT_EQUAL(cnx_btree_map_size(map), static_cast(usize)(BTREE_MAP_TEST_SIZE));
+	TEST_ASSERT_TRUE(btree_map_test_is_ordered(&map));
+	for(let_mut i = 0; i < BTREE_MAP_TEST_SIZE; ++i) {
+		TEST_ASSERT_EQUAL(cnx_btree_map_at(map, i), i * 2);
+	}
+
+	// a bulk-loaded tree must remain valid under further mutation
+	for(let_mut i = 0; i < BTREE_MAP_TEST_SIZE; i += 3) {
+		TEST_ASSERT_TRUE(cnx_btree_map_erase(map, i));
+	}
+	for(let_mut i = BTREE_MAP_TEST_SIZE; i < BTREE_MAP_TEST_SIZE + 500; ++i) {
+		TEST_ASSERT_TRUE(cnx_btree_map_insert(map, i, i * 2));
+	}
+	TEST_ASSERT_TRUE(btree_map_test_is_ordered(&map));
+	TEST_ASSERT_EQUAL(cnx_btree_map_size(map),
+					  static_cast(usize)(BTREE_MAP_TEST_SIZE - (BTREE_MAP_TEST_SIZE + 2) / 3 + 500));
+}
+
+TEST(CnxBTreeMap, clone) {
+	CnxScopedBTreeMap(i32, i32) map = cnx_btree_map_new(i32, i32);
+	for(let_mut i = 0; i < 1000; ++i) {
+		ignore(cnx_btree_map_insert(map, btree_map_test_key(i), btree_map_test_key(i) * 2));
+	}
+
+	CnxScopedBTreeMap(i32, i32) cloned = cnx_btree_map_clone(map);
+	let erased = btree_map_test_key(42);
+	TEST_ASSERT_TRUE(cnx_btree_map_erase(map, erased));
+	TEST_ASSERT_EQUAL(cnx_btree_map_size(cloned), cnx_btree_map_size(map) + 1U);
+	TEST_ASSERT_TRUE(cnx_btree_map_contains(cloned, erased));
+	TEST_ASSERT_TRUE(btree_map_test_is_ordered(&cloned));
+}
+
+static bool btree_map_test_even_filter(const CnxBTreeMapEntry(i32, i32) * restrict entry) {
+	return entry->m_key % 2 == 0;
+}
+
+TEST(CnxBTreeMap, range) {
+	CnxScopedBTreeMap(i32, i32) map = cnx_btree_map_new(i32, i32);
+	for(let_mut i = 0; i < 100; ++i) {
+		ignore(cnx_btree_map_insert(map, i, i * 2));
+	}
+
+	let_mut range = cnx_range_from_filtered(CnxBTreeMapEntry(i32, i32),
+											map,
+											btree_map_test_even_filter);
+	let_mut expected = 0;
+	foreach(entry, range) {
+		TEST_ASSERT_EQUAL(entry.m_key, expected);
+		expected += 2;
+	}
+	TEST_ASSERT_EQUAL(expected, 100);
+}
+
+TEST(CnxBTreeMap, allocator) {
+	let allocator = test_allocator_new();
+	{
+		CnxScopedBTreeMap(i32, i32) map
+			= cnx_btree_map_new_with_allocator(i32, i32, allocator);
+		for(let_mut i = 0; i < BTREE_MAP_TEST_SIZE; ++i) {
+			ignore(cnx_btree_map_insert(map, btree_map_test_key(i), btree_map_test_key(i) * 2));
+		}
+		TEST_ASSERT_GREATER_THAN(test_allocator_live_allocations, 1U);
+		for(let_mut i = 0; i < BTREE_MAP_TEST_SIZE / 2; ++i) {
+			ignore(cnx_btree_map_erase(map, i));
+		}
+		TEST_ASSERT_TRUE(btree_map_test_is_ordered(&map));
+	}
+	TEST_ASSERT_EQUAL(test_allocator_live_allocations, 0U);
+}
+
+#endif // CNX_BTREE_MAP_TEST
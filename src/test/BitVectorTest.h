@@ -0,0 +1,143 @@
+#ifndef CNX_BIT_VECTOR_TEST
+#define CNX_BIT_VECTOR_TEST
+
+#include <Cnx/BitVector.h>
+
+#include "Criterion.h"
+
+TEST(CnxBitVector, new_with_size) {
+	CnxScopedBitVector bits = cnx_bit_vector_new_with_size(130);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_size(bits), 130U);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_word_count(bits), 3U);
+	TEST_ASSERT_GREATER_THAN_OR_EQUAL(cnx_bit_vector_capacity(bits), 130U);
+	TEST_ASSERT_TRUE(cnx_bit_vector_none(bits));
+	TEST_ASSERT_EQUAL(cnx_bit_vector_count(bits), 0U);
+}
+
+TEST(CnxBitVector, set_reset_flip_and_test) {
+	CnxScopedBitVector bits = cnx_bit_vector_new_with_size(100);
+	cnx_bit_vector_set(bits, 0);
+	cnx_bit_vector_set(bits, 63);
+	cnx_bit_vector_set(bits, 64);
+	cnx_bit_vector_set(bits, 99);
+	TEST_ASSERT_TRUE(cnx_bit_vector_test(bits, 0));
+	TEST_ASSERT_TRUE(cnx_bit_vector_test(bits, 63));
+	TEST_ASSERT_TRUE(cnx_bit_vector_test(bits, 64));
+	TEST_ASSERT_TRUE(cnx_bit_vector_test(bits, 99));
+	TEST_ASSERT_FALSE(cnx_bit_vector_test(bits, 1));
+	TEST_ASSERT_EQUAL(cnx_bit_vector_count(bits), 4U);
+
+	cnx_bit_vector_reset(bits, 63);
+	TEST_ASSERT_FALSE(cnx_bit_vector_test(bits, 63));
+	cnx_bit_vector_flip(bits, 63);
+	TEST_ASSERT_TRUE(cnx_bit_vector_test(bits, 63));
+	cnx_bit_vector_assign(bits, 63, false);
+	TEST_ASSERT_FALSE(cnx_bit_vector_test(bits, 63));
+	TEST_ASSERT_EQUAL(cnx_bit_vector_count(bits), 3U);
+}
+
+TEST(CnxBitVector, ranges_and_all) {
+	CnxScopedBitVector bits = cnx_bit_vector_new_with_size(300);
+	cnx_bit_vector_set_range(bits, 10, 200);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_count(bits), 200U);
+	TEST_ASSERT_FALSE(cnx_bit_vector_test(bits, 9));
+	TEST_ASSERT_TRUE(cnx_bit_vector_test(bits, 10));
+	TEST_ASSERT_TRUE(cnx_bit_vector_test(bits, 209));
+	TEST_ASSERT_FALSE(cnx_bit_vector_test(bits, 210));
+
+	cnx_bit_vector_reset_range(bits, 20, 5);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_count(bits), 195U);
+
+	cnx_bit_vector_set_all(bits);
+	TEST_ASSERT_TRUE(cnx_bit_vector_all(bits));
+	TEST_ASSERT_EQUAL(cnx_bit_vector_count(bits), 300U);
+
+	cnx_bit_vector_flip_all(bits);
+	TEST_ASSERT_TRUE(cnx_bit_vector_none(bits));
+
+	cnx_bit_vector_flip(bits, 150);
+	cnx_bit_vector_reset_all(bits);
+	TEST_ASSERT_FALSE(cnx_bit_vector_any(bits));
+}
+
+TEST(CnxBitVector, push_back_and_resize) {
+	CnxScopedBitVector bits = cnx_bit_vector_new();
+	for(let_mut i = 0U; i < 200U; ++i) {
+		cnx_bit_vector_push_back(bits, i % 3U == 0U);
+	}
+	TEST_ASSERT_EQUAL(cnx_bit_vector_size(bits), 200U);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_count(bits), 67U);
+
+	cnx_bit_vector_resize(bits, 70);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_count(bits), 24U);
+	cnx_bit_vector_resize(bits, 500);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_count(bits), 24U);
+	TEST_ASSERT_FALSE(cnx_bit_vector_test(bits, 72));
+
+	cnx_bit_vector_clear(bits);
+	TEST_ASSERT_TRUE(cnx_bit_vector_is_empty(bits));
+}
+
+TEST(CnxBitVector, bulk_operations) {
+	CnxScopedBitVector lhs = cnx_bit_vector_new_with_size(1000);
+	CnxScopedBitVector rhs = cnx_bit_vector_new_with_size(1000);
+	cnx_bit_vector_set_range(lhs, 0, 600);
+	cnx_bit_vector_set_range(rhs, 400, 600);
+
+	CnxScopedBitVector anded = cnx_bit_vector_clone(lhs);
+	cnx_bit_vector_and(anded, rhs);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_count(anded), 200U);
+
+	CnxScopedBitVector ored = cnx_bit_vector_clone(lhs);
+	cnx_bit_vector_or(ored, rhs);
+	TEST_ASSERT_TRUE(cnx_bit_vector_all(ored));
+
+	CnxScopedBitVector xored = cnx_bit_vector_clone(lhs);
+	cnx_bit_vector_xor(xored, rhs);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_count(xored), 800U);
+
+	CnxScopedBitVector andnoted = cnx_bit_vector_clone(lhs);
+	cnx_bit_vector_andnot(andnoted, rhs);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_count(andnoted), 400U);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_find_first_unset(andnoted), 400U);
+
+	cnx_bit_vector_or(andnoted, anded);
+	cnx_bit_vector_and(andnoted, lhs);
+	TEST_ASSERT_TRUE(cnx_bit_vector_equals(andnoted, lhs));
+}
+
+TEST(CnxBitVector, find) {
+	CnxScopedBitVector bits = cnx_bit_vector_new_with_size(200);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_find_first_set(bits), 200U);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_find_first_unset(bits), 0U);
+
+	cnx_bit_vector_set(bits, 5);
+	cnx_bit_vector_set(bits, 130);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_find_first_set(bits), 5U);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_find_next_set(bits, 5), 130U);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_find_next_set(bits, 130), 200U);
+
+	cnx_bit_vector_set_all(bits);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_find_first_unset(bits), 200U);
+	cnx_bit_vector_reset(bits, 199);
+	TEST_ASSERT_EQUAL(cnx_bit_vector_find_next_unset(bits, 0), 199U);
+}
+
+TEST(CnxBitVector, set_bits_iteration) {
+	CnxScopedBitVector bits = cnx_bit_vector_new_with_size(1000);
+	cnx_bit_vector_set(bits, 3);
+	cnx_bit_vector_set(bits, 64);
+	cnx_bit_vector_set(bits, 700);
+	cnx_bit_vector_set(bits, 999);
+
+	let expected = (usize[]){3, 64, 700, 999};
+	let_mut index = 0U;
+	let set_bits = cnx_bit_vector_set_bits(bits);
+	foreach(bit, set_bits) {
+		TEST_ASSERT_EQUAL(bit, expected[index]);
+		++index;
+	}
+	TEST_ASSERT_EQUAL(index, 4U);
+}
+
+#endif // CNX_BIT_VECTOR_TEST
@@ -0,0 +1,160 @@
+#ifndef CNX_BYTE_SCAN_TEST
+#define CNX_BYTE_SCAN_TEST
+
+#include <Cnx/__string/__byte_scan.h>
+
+#include "Criterion.h"
+
+#define BYTE_SCAN_TEST_SIZE 200
+
+TEST(CnxByteScan, count_and_find) {
+	char data[BYTE_SCAN_TEST_SIZE];
+	memset(data, 'a', sizeof(data));
+	TEST_ASSERT_EQUAL(cnx_byte_scan_count(data, sizeof(data), 'b'), static_cast(usize)(0));
+	TEST_ASSERT_EQUAL(cnx_byte_scan_find(data, sizeof(data), 'b'), sizeof(data));
+
+	// place matches on and around the block boundaries and in the scalar tail
+	let positions = (usize[]){0, 15, 16, 31, 32, 33, 100, 190, 199};
+	for(let_mut i = static_cast(usize)(0); i < 9; ++i) {
+		data[positions[i]] = 'b';
+	}
+	TEST_ASSERT_EQUAL(cnx_byte_scan_count(data, sizeof(data), 'b'), static_cast(usize)(9));
+	TEST_ASSERT_EQUAL(cnx_byte_scan_count(data + 1, sizeof(data) - 1, 'b'), static_cast(usize)(8));
+	TEST_ASSERT_EQUAL(cnx_byte_scan_find(data + 1, sizeof(data) - 1, 'b'), static_cast(usize)(14));
+}
+
+TEST(CnxByteScan, find_any_of) {
+	let set = cnx_byte_set_new("/\\:\xE9", 4);
+	TEST_ASSERT_TRUE(cnx_byte_set_contains(&set, ':'));
+	TEST_ASSERT_TRUE(cnx_byte_set_contains(&set, '\xE9'));
+	TEST_ASSERT_FALSE(cnx_byte_set_contains(&set, '\xE8'));
+	TEST_ASSERT_FALSE(cnx_byte_set_contains(&set, 'Z'));
+
+	char data[BYTE_SCAN_TEST_SIZE];
+	// fill with every byte value outside the set, so bytes sharing a nibble with set members are
+	// exercised
+	let_mut next = static_cast(u8)(0);
+	for(let_mut i = static_cast(usize)(0); i < sizeof(data); ++i) {
+		while(cnx_byte_set_contains(&set, static_cast(char)(next))) {
+			++next;
+		}
+		data[i] = static_cast(char)(next++);
+	}
+	TEST_ASSERT_EQUAL(cnx_byte_scan_find_any_of(data, sizeof(data), &set), sizeof(data));
+
+	for(let_mut position = static_cast(usize)(0); position < sizeof(data); position += 7) {
+		let saved = data[position];
+		data[position] = position % 2 == 0 ? '\xE9' : '\\';
+		TEST_ASSERT_EQUAL(cnx_byte_scan_find_any_of(data, sizeof(data), &set), position);
+		data[position] = saved;
+	}
+}
+
+TEST(CnxByteScan, find_non_ascii_and_whitespace) {
+	char data[BYTE_SCAN_TEST_SIZE];
+	memset(data, 'x', sizeof(data));
+	TEST_ASSERT_EQUAL(cnx_byte_scan_find_non_ascii(data, sizeof(data)), sizeof(data));
+	TEST_ASSERT_EQUAL(cnx_byte_scan_find_whitespace(data, sizeof(data)), sizeof(data));
+
+	for(let_mut position = static_cast(usize)(0); position < sizeof(data); position += 9) {
+		data[position] = '\x80';
+		TEST_ASSERT_EQUAL(cnx_byte_scan_find_non_ascii(data, sizeof(data)), position);
+		data[position] = 'x';
+	}
+
+	let whitespace = " \t\n\v\f\r";
+	for(let_mut position = static_cast(usize)(0); position < sizeof(data); position += 11) {
+		data[position] = whitespace[position % 6];
+		TEST_ASSERT_EQUAL(cnx_byte_scan_find_whitespace(data, sizeof(data)), position);
+		data[position] = 'x';
+	}
+
+	// bytes just outside the '\t'..'\r' range aren't whitespace
+	data[3] = '\x08';
+	data[4] = '\x0E';
+	TEST_ASSERT_EQUAL(cnx_byte_scan_find_whitespace(data, sizeof(data)), sizeof(data));
+}
+
+TEST(CnxByteScan, find_non_whitespace) {
+	char data[BYTE_SCAN_TEST_SIZE];
+	memset(data, ' ', sizeof(data));
+	TEST_ASSERT_EQUAL(cnx_byte_scan_find_non_whitespace(data, sizeof(data)), sizeof(data));
+	TEST_ASSERT_EQUAL(cnx_byte_scan_rfind_non_whitespace(data, sizeof(data)), sizeof(data));
+
+	let whitespace = " \t\n\v\f\r";
+	for(let_mut i = static_cast(usize)(0); i < sizeof(data); ++i) {
+		data[i] = whitespace[i % 6];
+	}
+	TEST_ASSERT_EQUAL(cnx_byte_scan_find_non_whitespace(data, sizeof(data)), sizeof(data));
+	TEST_ASSERT_EQUAL(cnx_byte_scan_rfind_non_whitespace(data, sizeof(data)), sizeof(data));
+
+	for(let_mut position = static_cast(usize)(0); position < sizeof(data); position += 7) {
+		let saved = data[position];
+		data[position] = 'x';
+		TEST_ASSERT_EQUAL(cnx_byte_scan_find_non_whitespace(data, sizeof(data)), position);
+		TEST_ASSERT_EQUAL(cnx_byte_scan_rfind_non_whitespace(data, sizeof(data)), position);
+		data[position] = saved;
+	}
+
+	data[10] = 'x';
+	data[170] = 'y';
+	TEST_ASSERT_EQUAL(cnx_byte_scan_find_non_whitespace(data, sizeof(data)),
+					  static_cast(usize)(10));
+	TEST_ASSERT_EQUAL(cnx_byte_scan_rfind_non_whitespace(data, sizeof(data)),
+					  static_cast(usize)(170));
+	TEST_ASSERT_EQUAL(cnx_byte_scan_rfind_non_whitespace(data, 170), static_cast(usize)(10));
+}
+
+TEST(CnxByteScan, convert_case) {
+	// every byte value, so the bytes bordering 'A'..'Z' and 'a'..'z' and the non-ASCII bytes
+	// (which are negative as a signed `char`) are all exercised
+	char data[256 + BYTE_SCAN_TEST_SIZE];
+	for(let_mut i = static_cast(usize)(0); i < sizeof(data); ++i) {
+		data[i] = static_cast(char)(i);
+	}
+
+	char lower[sizeof(data)];
+	char upper[sizeof(data)];
+	cnx_byte_scan_to_lower(data, sizeof(data), lower);
+	cnx_byte_scan_to_upper(data, sizeof(data), upper);
+	for(let_mut i = static_cast(usize)(0); i < sizeof(data); ++i) {
+		let byte = static_cast(u8)(data[i]);
+		let expected_lower = byte >= 'A' && byte <= 'Z' ? byte + ('a' - 'A') : byte;
+		let expected_upper = byte >= 'a' && byte <= 'z' ? byte - ('a' - 'A') : byte;
+		TEST_ASSERT_EQUAL(static_cast(u8)(lower[i]), static_cast(u8)(expected_lower));
+		TEST_ASSERT_EQUAL(static_cast(u8)(upper[i]), static_cast(u8)(expected_upper));
+	}
+
+	// in place, starting at an unaligned offset
+	cnx_byte_scan_to_upper(lower + 3, sizeof(lower) - 3, lower + 3);
+	TEST_ASSERT_EQUAL(memcmp(lower + 3, upper + 3, sizeof(lower) - 3), 0);
+}
+
+TEST(CnxByteScan, equal_ignore_case) {
+	char lhs[BYTE_SCAN_TEST_SIZE];
+	char rhs[BYTE_SCAN_TEST_SIZE];
+	for(let_mut i = static_cast(usize)(0); i < sizeof(lhs); ++i) {
+		lhs[i] = static_cast(char)('a' + i % 26);
+		rhs[i] = static_cast(char)(i % 3 == 0 ? 'A' + i % 26 : 'a' + i % 26);
+	}
+	TEST_ASSERT_TRUE(cnx_byte_scan_equal_ignore_case(lhs, rhs, sizeof(lhs)));
+	TEST_ASSERT_TRUE(cnx_byte_scan_equal_ignore_case(lhs, rhs, 0));
+
+	for(let_mut position = static_cast(usize)(0); position < sizeof(lhs); position += 9) {
+		let saved = rhs[position];
+		rhs[position] = lhs[position] == 'a' ? '@' : '0';
+		TEST_ASSERT_FALSE(cnx_byte_scan_equal_ignore_case(lhs, rhs, sizeof(lhs)));
+		TEST_ASSERT_TRUE(cnx_byte_scan_equal_ignore_case(lhs, rhs, position));
+		rhs[position] = saved;
+	}
+
+	// '`' and '@' differ only in the case bit, but aren't letters
+	lhs[5] = '`';
+	rhs[5] = '@';
+	TEST_ASSERT_FALSE(cnx_byte_scan_equal_ignore_case(lhs, rhs, sizeof(lhs)));
+	lhs[5] = '\xC9';
+	rhs[5] = '\xE9';
+	TEST_ASSERT_FALSE(cnx_byte_scan_equal_ignore_case(lhs, rhs, sizeof(lhs)));
+}
+
+#endif // CNX_BYTE_SCAN_TEST
@@ -0,0 +1,117 @@
+#ifndef CNX_COMPACT_STRING_TEST
+#define CNX_COMPACT_STRING_TEST
+
+#include <Cnx/CompactString.h>
+#include <Cnx/StringSearch.h>
+
+#include "Criterion.h"
+
+static inline bool compact_string_test_pop_equals(CnxCompactString* restrict string,
+												  char expected) {
+	let_mut popped = cnx_compact_string_pop_back(*string);
+	return cnx_option_is_some(popped) && cnx_option_unwrap(popped) == expected;
+}
+
+TEST(CnxCompactString, layout) {
+	TEST_ASSERT_EQUAL(sizeof(CnxCompactString), static_cast(usize)(32));
+	TEST_ASSERT_LESS_THAN(sizeof(CnxCompactString), sizeof(CnxString));
+
+	CnxScopedCompactString string = cnx_compact_string_new();
+	TEST_ASSERT_TRUE(cnx_compact_string_is_empty(string));
+	TEST_ASSERT_TRUE(cnx_compact_string_is_short(string));
+	TEST_ASSERT_EQUAL(cnx_compact_string_capacity(string),
+					  static_cast(usize)(CNX_COMPACT_STRING_SHORT_CAPACITY));
+	TEST_ASSERT_EQUAL(strcmp(cnx_compact_string_into_cstring(string), ""), 0);
+
+	// freeing leaves a string empty, whether it was short or long
+	cnx_compact_string_append(string, "short");
+	cnx_compact_string_free(string);
+	TEST_ASSERT_TRUE(cnx_compact_string_is_empty(string));
+	TEST_ASSERT_EQUAL(strcmp(cnx_compact_string_into_cstring(string), ""), 0);
+}
+
+TEST(CnxCompactString, short_long_boundary) {
+	let full = "0123456789012345678901234567890";
+	CnxScopedCompactString short_string = cnx_compact_string_from(full);
+	TEST_ASSERT_TRUE(cnx_compact_string_is_short(short_string));
+	TEST_ASSERT_EQUAL(cnx_compact_string_length(short_string), static_cast(usize)(31));
+	// the tag byte of a full short string is its null terminator
+	TEST_ASSERT_EQUAL(strcmp(cnx_compact_string_into_cstring(short_string), full), 0);
+
+	cnx_compact_string_push_back(short_string, 'x');
+	TEST_ASSERT_FALSE(cnx_compact_string_is_short(short_string));
+	TEST_ASSERT_EQUAL(cnx_compact_string_length(short_string), static_cast(usize)(32));
+	TEST_ASSERT_GREATER_THAN_OR_EQUAL(cnx_compact_string_capacity(short_string),
+									  static_cast(usize)(32));
+	TEST_ASSERT_EQUAL(cnx_compact_string_at(short_string, 31), 'x');
+	TEST_ASSERT_EQUAL(cnx_compact_string_at(short_string, 30), '0');
+
+	TEST_ASSERT_TRUE(compact_string_test_pop_equals(&short_string, 'x'));
+	cnx_compact_string_shrink_to_fit(short_string);
+	TEST_ASSERT_TRUE(cnx_compact_string_is_short(short_string));
+	TEST_ASSERT_TRUE(cnx_compact_string_equal(short_string, full));
+}
+
+TEST(CnxCompactString, append_and_reserve) {
+	CnxScopedCompactString string = cnx_compact_string_new();
+	for(let_mut i = 0; i < 100; ++i) {
+		cnx_compact_string_append(string, "ab");
+	}
+	TEST_ASSERT_EQUAL(cnx_compact_string_length(string), static_cast(usize)(200));
+	TEST_ASSERT_FALSE(cnx_compact_string_is_short(string));
+	for(let_mut i = 0U; i < 200U; i += 2) {
+		TEST_ASSERT_EQUAL(cnx_compact_string_at(string, i), 'a');
+		TEST_ASSERT_EQUAL(cnx_compact_string_at(string, i + 1), 'b');
+	}
+
+	// appending a string to itself must survive the reallocation
+	cnx_compact_string_append(string, &string);
+	TEST_ASSERT_EQUAL(cnx_compact_string_length(string), static_cast(usize)(400));
+	TEST_ASSERT_EQUAL(strlen(cnx_compact_string_into_cstring(string)), static_cast(usize)(400));
+
+	cnx_compact_string_clear(string);
+	TEST_ASSERT_TRUE(cnx_compact_string_is_empty(string));
+	cnx_compact_string_reserve(string, 1000);
+	TEST_ASSERT_GREATER_THAN_OR_EQUAL(cnx_compact_string_capacity(string),
+									  static_cast(usize)(1000));
+	cnx_compact_string_append(string, "cat");
+	cnx_compact_string_at_mut(string, 0) = 'b';
+	TEST_ASSERT_TRUE(cnx_compact_string_equal(string, "bat"));
+}
+
+TEST(CnxCompactString, compare) {
+	CnxScopedCompactString apple = cnx_compact_string_from("apple");
+	CnxScopedCompactString apples = cnx_compact_string_from("apples");
+	CnxScopedCompactString cloned = cnx_compact_string_clone(apple);
+
+	TEST_ASSERT_TRUE(cnx_compact_string_equal(apple, &cloned));
+	TEST_ASSERT_FALSE(cnx_compact_string_equal(apple, &apples));
+	TEST_ASSERT_LESS_THAN(cnx_compact_string_compare(apple, &apples), 0);
+	TEST_ASSERT_GREATER_THAN(cnx_compact_string_compare(apples, "apple"), 0);
+	TEST_ASSERT_GREATER_THAN(cnx_compact_string_compare(apple, "applc"), 0);
+	TEST_ASSERT_EQUAL(cnx_compact_string_compare(apple, "apple"), 0);
+}
+
+TEST(CnxCompactString, interop) {
+	CnxScopedString string = cnx_string_from("a string longer than thirty one characters");
+	CnxScopedCompactString compact = cnx_compact_string_from(&string);
+	TEST_ASSERT_FALSE(cnx_compact_string_is_short(compact));
+	TEST_ASSERT_TRUE(cnx_compact_string_equal(compact, &string));
+
+	let view = cnx_compact_string_into_stringview(compact);
+	TEST_ASSERT_EQUAL(cnx_stringview_length(view), cnx_string_length(string));
+	TEST_ASSERT_TRUE(cnx_stringview_equal(view, &string));
+	TEST_ASSERT_TRUE(cnx_stringview_contains(view, "thirty"));
+
+	let_mut count = 0U;
+	foreach(character, view) {
+		TEST_ASSERT_EQUAL(character, cnx_string_at(string, count));
+		++count;
+	}
+	TEST_ASSERT_EQUAL(count, cnx_string_length(string));
+
+	CnxScopedString round_trip = cnx_compact_string_into_string(compact);
+	TEST_ASSERT_TRUE(cnx_string_equal(round_trip, &string));
+}
+
+#endif // CNX_COMPACT_STRING_TEST
@@ -0,0 +1,295 @@
+#ifndef CNX_CSV_TEST
+#define CNX_CSV_TEST
+
+#include <Cnx/Csv.h>
+#include <Cnx/filesystem/File.h>
+#include <stdio.h>
+
+#include "Criterion.h"
+#include "TestView.h"
+
+#define CSV_TEST_PATH "cnx_csv_test.csv"
+
+static inline bool
+csv_test_field_equal(CnxCsvRow row, usize index, restrict const_cstring expected) {
+	let field = cnx_csv_row_get(row, index);
+	return field.m_length == strlen(expected)
+		   && memcmp(field.m_view, expected, field.m_length) == 0;
+}
+
+static inline i64 csv_test_error_code(CnxError error) {
+	return cnx_error_code(&error);
+}
+
+TEST(CnxCsv, reads_quoted_and_escaped_fields) {
+	let view = test_view("name,quote,notes\r\n"
+						 "\"Smith, J\",\"He said \"\"hi\"\"\",\"multi\nline\"\n"
+						 "plain,,\"\"\n"
+						 "\"\"\"\"\n");
+	CnxScopedCsvReader reader = cnx_csv_reader_from_stringview(view);
+	CnxCsvRow row;
+
+	TEST_ASSERT_TRUE(cnx_csv_reader_next(&reader, &row));
+	TEST_ASSERT_EQUAL(cnx_csv_row_size(row), 3U);
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 0, "name"));
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 1, "quote"));
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 2, "notes"));
+
+	TEST_ASSERT_TRUE(cnx_csv_reader_next(&reader, &row));
+	TEST_ASSERT_EQUAL(cnx_csv_row_size(row), 3U);
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 0, "Smith, J"));
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 1, "He said \"hi\""));
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 2, "multi\nline"));
+
+	TEST_ASSERT_TRUE(cnx_csv_reader_next(&reader, &row));
+	TEST_ASSERT_EQUAL(cnx_csv_row_size(row), 3U);
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 0, "plain"));
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 1, ""));
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 2, ""));
+
+	TEST_ASSERT_TRUE(cnx_csv_reader_next(&reader, &row));
+	TEST_ASSERT_EQUAL(cnx_csv_row_size(row), 1U);
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 0, "\""));
+
+	// a trailing line ending doesn't begin another row
+	TEST_ASSERT_FALSE(cnx_csv_reader_next(&reader, &row));
+	let_mut status = cnx_csv_reader_status(&reader);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(status));
+}
+
+TEST(CnxCsv, empty_lines_and_final_row) {
+	let view = test_view("a\n\nb;c\r\rd;");
+	let_mut options = cnx_csv_default_options;
+	options.delimiter = ';';
+	CnxScopedCsvReader reader = cnx_csv_reader_from_stringview_with_options(view, options);
+	CnxCsvRow row;
+
+	TEST_ASSERT_TRUE(cnx_csv_reader_next(&reader, &row));
+	TEST_ASSERT_EQUAL(cnx_csv_row_size(row), 1U);
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 0, "a"));
+
+	// an empty line is a row with a single empty field
+	TEST_ASSERT_TRUE(cnx_csv_reader_next(&reader, &row));
+	TEST_ASSERT_EQUAL(cnx_csv_row_size(row), 1U);
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 0, ""));
+
+	TEST_ASSERT_TRUE(cnx_csv_reader_next(&reader, &row));
+	TEST_ASSERT_EQUAL(cnx_csv_row_size(row), 2U);
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 0, "b"));
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 1, "c"));
+
+	TEST_ASSERT_TRUE(cnx_csv_reader_next(&reader, &row));
+	TEST_ASSERT_EQUAL(cnx_csv_row_size(row), 1U);
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 0, ""));
+
+	// the final row needn't end with a line ending
+	TEST_ASSERT_TRUE(cnx_csv_reader_next(&reader, &row));
+	TEST_ASSERT_EQUAL(cnx_csv_row_size(row), 2U);
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 0, "d"));
+	TEST_ASSERT_TRUE(csv_test_field_equal(row, 1, ""));
+
+	TEST_ASSERT_FALSE(cnx_csv_reader_next(&reader, &row));
+	let_mut status = cnx_csv_reader_status(&reader);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(status));
+}
+
+TEST(CnxCsv, malformed_input) {
+	const_cstring inputs[] = {"a,b\n\"abc\"x,1\n", "a,\"unterminated\n"};
+	for(let_mut i = 0U; i < sizeof(inputs) / sizeof(inputs[0]); ++i) {
+		let view = test_view(inputs[i]);
+		CnxScopedCsvReader reader = cnx_csv_reader_from_stringview(view);
+		CnxCsvRow row;
+		if(i == 0) {
+			TEST_ASSERT_TRUE(cnx_csv_reader_next(&reader, &row));
+			TEST_ASSERT_EQUAL(cnx_csv_row_size(row), 2U);
+		}
+
+		TEST_ASSERT_FALSE(cnx_csv_reader_next(&reader, &row));
+		let_mut status = cnx_csv_reader_status(&reader);
+		TEST_ASSERT_TRUE(cnx_result_is_err(status));
+		TEST_ASSERT_EQUAL(csv_test_error_code(cnx_result_unwrap_err(status)), EINVAL);
+		// the reader stays failed
+		TEST_ASSERT_FALSE(cnx_csv_reader_next(&reader, &row));
+	}
+}
+
+TEST(CnxCsv, typed_fields) {
+	let view = test_view("42,-9223372036854775808,18446744073709551615,2.5,abc,"
+						 "99999999999999999999,1e400,\" 7\",-1,+3,-0.125e1,\n");
+	CnxScopedCsvReader reader = cnx_csv_reader_from_stringview(view);
+	CnxCsvRow row;
+	TEST_ASSERT_TRUE(cnx_csv_reader_next(&reader, &row));
+	TEST_ASSERT_EQUAL(cnx_csv_row_size(row), 12U);
+
+	let_mut as_i64 = cnx_csv_row_get_i64(row, 0);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(as_i64));
+	TEST_ASSERT_EQUAL(cnx_result_unwrap(as_i64), 42);
+	as_i64 = cnx_csv_row_get_i64(row, 1);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(as_i64));
+	TEST_ASSERT_EQUAL(cnx_result_unwrap(as_i64), INT64_MIN);
+	as_i64 = cnx_csv_row_get_i64(row, 2);
+	TEST_ASSERT_TRUE(cnx_result_is_err(as_i64));
+	TEST_ASSERT_EQUAL(csv_test_error_code(cnx_result_unwrap_err(as_i64)), ERANGE);
+	as_i64 = cnx_csv_row_get_i64(row, 9);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(as_i64));
+	TEST_ASSERT_EQUAL(cnx_result_unwrap(as_i64), 3);
+
+	let_mut as_u64 = cnx_csv_row_get_u64(row, 2);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(as_u64));
+	TEST_ASSERT_EQUAL(cnx_result_unwrap(as_u64), UINT64_MAX);
+	as_u64 = cnx_csv_row_get_u64(row, 5);
+	TEST_ASSERT_TRUE(cnx_result_is_err(as_u64));
+	TEST_ASSERT_EQUAL(csv_test_error_code(cnx_result_unwrap_err(as_u64)), ERANGE);
+	as_u64 = cnx_csv_row_get_u64(row, 8);
+	TEST_ASSERT_TRUE(cnx_result_is_err(as_u64));
+	TEST_ASSERT_EQUAL(csv_test_error_code(cnx_result_unwrap_err(as_u64)), EINVAL);
+
+	let_mut as_f64 = cnx_csv_row_get_f64(row, 3);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(as_f64));
+	TEST_ASSERT_EQUAL(cnx_result_unwrap(as_f64), 2.5);
+	as_f64 = cnx_csv_row_get_f64(row, 10);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(as_f64));
+	TEST_ASSERT_EQUAL(cnx_result_unwrap(as_f64), -1.25);
+	as_f64 = cnx_csv_row_get_f64(row, 0);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(as_f64));
+	TEST_ASSERT_EQUAL(cnx_result_unwrap(as_f64), 42.0);
+	as_f64 = cnx_csv_row_get_f64(row, 6);
+	TEST_ASSERT_TRUE(cnx_result_is_err(as_f64));
+	TEST_ASSERT_EQUAL(csv_test_error_code(cnx_result_unwrap_err(as_f64)), ERANGE);
+
+	// fields that aren't entirely a number, empty fields, and out of bounds indices are invalid
+	let invalid = (usize[]){4, 7, 11, 12};
+	for(let_mut i = 0U; i < 4U; ++i) {
+		as_i64 = cnx_csv_row_get_i64(row, invalid[i]);
+		TEST_ASSERT_TRUE(cnx_result_is_err(as_i64));
+		TEST_ASSERT_EQUAL(csv_test_error_code(cnx_result_unwrap_err(as_i64)), EINVAL);
+		as_f64 = cnx_csv_row_get_f64(row, invalid[i]);
+		TEST_ASSERT_TRUE(cnx_result_is_err(as_f64));
+		TEST_ASSERT_EQUAL(csv_test_error_code(cnx_result_unwrap_err(as_f64)), EINVAL);
+	}
+}
+
+static inline CnxFile csv_test_open(CnxFileOptions options) {
+	let_mut maybe_file = cnx_file_open(CSV_TEST_PATH, options);
+	cnx_assert(cnx_result_is_ok(maybe_file), "Failed to open the CSV test file");
+	return cnx_result_unwrap(maybe_file);
+}
+
+TEST(CnxCsv, writer_quotes_only_when_necessary) {
+	{
+		CnxScopedFile file = csv_test_open(
+			(CnxFileOptions){.mode = CnxFileWrite, .modifiers = CnxFileTruncate});
+		let_mut options = cnx_csv_default_options;
+		options.crlf = true;
+		let_mut writer = cnx_csv_writer_new_with_options(&file, options);
+
+		const CnxStringView fields[] = {test_view("plain"),
+										test_view("with, comma"),
+										test_view("say \"hi\""),
+										test_view(""),
+										test_view("two\nlines")};
+		let_mut result = cnx_csv_writer_write_fields(&writer, fields, 5);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+
+		result = cnx_csv_writer_write_i64(&writer, INT64_MIN);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+		result = cnx_csv_writer_write_u64(&writer, UINT64_MAX);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+		result = cnx_csv_writer_write_f64(&writer, 0.1);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+		result = cnx_csv_writer_write_f64(&writer, 1.0 / 3.0);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+		result = cnx_csv_writer_end_row(&writer);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	}
+
+	CnxScopedFile file
+		= csv_test_open((CnxFileOptions){.mode = CnxFileRead, .modifiers = CnxFileNone});
+	char contents[256] = {0};
+	let_mut read = cnx_file_read_bytes(&file,
+									   static_cast(u8*)(static_cast(void*)(contents)),
+									   sizeof(contents) - 1U);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(read));
+	TEST_ASSERT_EQUAL(strcmp(contents,
+							 "plain,\"with, comma\",\"say \"\"hi\"\"\",,\"two\nlines\"\r\n"
+							 "-9223372036854775808,18446744073709551615,0.1,"
+							 "0.3333333333333333\r\n"),
+					  0);
+	ignore(remove(CSV_TEST_PATH));
+}
+
+TEST(CnxCsv, file_round_trip) {
+	// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+	let num_rows = 5000;
+	// longer than the reader's initial buffer, so that it has to grow
+	let long_length = CNX_CSV_READER_DEFAULT_BUFFER_SIZE + CNX_CSV_READER_DEFAULT_BUFFER_SIZE / 2U;
+	let long_field = cnx_allocator_allocate_array_t(char, DEFAULT_ALLOCATOR, long_length + 1U);
+	for(let_mut i = 0U; i < long_length; ++i) {
+		// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+		long_field[i] = i % 100U == 99U ? '"' : static_cast(char)('a' + static_cast(char)(i % 26U));
+	}
+	long_field[long_length] = '\0';
+
+	{
+		CnxScopedFile file = csv_test_open(
+			(CnxFileOptions){.mode = CnxFileWrite, .modifiers = CnxFileTruncate});
+		let_mut writer = cnx_csv_writer_new(&file);
+		char text[64];
+		for(let_mut i = 0; i < num_rows; ++i) {
+			// every row spans several of the reader's buffer refills at some point
+			ignore(snprintf(text, sizeof(text), "row \"%d\",\nwith extras", i));
+			let field = test_view(text);
+			let_mut result = cnx_csv_writer_write_i64(&writer, i);
+			TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+			result = cnx_csv_writer_write_field(&writer, &field);
+			TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+			result = cnx_csv_writer_write_f64(&writer, i * 0.5);
+			TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+			result = cnx_csv_writer_end_row(&writer);
+			TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+
+			// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+			if(i == 1234) {
+				let long_view = test_view(long_field);
+				result = cnx_csv_writer_write_fields(&writer, &long_view, 1);
+				TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+			}
+		}
+	}
+
+	{
+		CnxScopedFile file
+			= csv_test_open((CnxFileOptions){.mode = CnxFileRead, .modifiers = CnxFileNone});
+		CnxScopedCsvReader reader = cnx_csv_reader_from_file(&file);
+		CnxCsvRow row;
+		char text[64];
+		for(let_mut i = 0; i < num_rows; ++i) {
+			TEST_ASSERT_TRUE(cnx_csv_reader_next(&reader, &row));
+			TEST_ASSERT_EQUAL(cnx_csv_row_size(row), 3U);
+			let_mut index = cnx_csv_row_get_i64(row, 0);
+			TEST_ASSERT_TRUE(cnx_result_is_ok(index));
+			TEST_ASSERT_EQUAL(cnx_result_unwrap(index), i);
+			ignore(snprintf(text, sizeof(text), "row \"%d\",\nwith extras", i));
+			TEST_ASSERT_TRUE(csv_test_field_equal(row, 1, text));
+			let_mut value = cnx_csv_row_get_f64(row, 2);
+			TEST_ASSERT_TRUE(cnx_result_is_ok(value));
+			TEST_ASSERT_EQUAL(cnx_result_unwrap(value), i * 0.5);
+
+			// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+			if(i == 1234) {
+				TEST_ASSERT_TRUE(cnx_csv_reader_next(&reader, &row));
+				TEST_ASSERT_EQUAL(cnx_csv_row_size(row), 1U);
+				TEST_ASSERT_TRUE(csv_test_field_equal(row, 0, long_field));
+			}
+		}
+
+		TEST_ASSERT_FALSE(cnx_csv_reader_next(&reader, &row));
+		let_mut status = cnx_csv_reader_status(&reader);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(status));
+	}
+
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, long_field);
+	ignore(remove(CSV_TEST_PATH));
+}
+
+#endif // CNX_CSV_TEST
@@ -0,0 +1,234 @@
+#ifndef CNX_DEFERRED_LOG_TEST
+#define CNX_DEFERRED_LOG_TEST
+
+#include <Cnx/DeferredLog.h>
+#include <Cnx/Thread.h>
+#include <Cnx/filesystem/File.h>
+#include <stdio.h>
+
+#include "Criterion.h"
+
+#define DEFERRED_LOG_TEST_PATH			  "cnx_deferred_log_test.txt"
+#define DEFERRED_LOG_TEST_NUM_THREADS	  4
+#define DEFERRED_LOG_TEST_LINES_PER_THREAD 2000
+
+static inline CnxFile deferred_log_test_open(void) {
+	let_mut maybe_file = cnx_file_open(DEFERRED_LOG_TEST_PATH);
+	cnx_assert(cnx_result_is_ok(maybe_file), "Failed to open the deferred log test file");
+	return cnx_result_unwrap(maybe_file);
+}
+
+static inline CnxString deferred_log_test_read(void) {
+	let options = (CnxFileOptions){.mode = CnxFileRead, .modifiers = CnxFileNone};
+	let_mut maybe_file = cnx_file_open(DEFERRED_LOG_TEST_PATH, options);
+	cnx_assert(cnx_result_is_ok(maybe_file), "Failed to open the deferred log test file");
+	CnxScopedFile file = cnx_result_unwrap(maybe_file);
+
+	// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+	let capacity = static_cast(usize)(1024U * 1024U);
+	let_mut bytes = cnx_allocator_allocate_array_t(u8, DEFAULT_ALLOCATOR, capacity);
+	let_mut maybe_read = cnx_file_read_bytes(&file, bytes, capacity);
+	cnx_assert(cnx_result_is_ok(maybe_read), "Failed to read the deferred log test file");
+	let view = cnx_stringview_from_raw(static_cast(const_cstring)(static_cast(void*)(bytes)),
+									   cnx_result_unwrap(maybe_read));
+	let contents = cnx_string_from(&view);
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, bytes);
+	return contents;
+}
+
+static inline CnxDeferredLogOptions deferred_log_test_options(usize buffer_capacity) {
+	let_mut options = cnx_deferred_log_default_options;
+	options.buffer_capacity = buffer_capacity;
+	options.decode_interval = cnx_milliseconds(0);
+	return options;
+}
+
+TEST(CnxDeferredLog, format_array) {
+	let number = 42;
+	let_mut string = cnx_string_from("string");
+	let view = cnx_stringview_from("view", 0, 4);
+	const CnxFormat args[] = {as_format(number), as_format(string), as_format(view)};
+
+	CnxScopedString formatted = cnx_format_array("{} {} {}", 3, args);
+	TEST_ASSERT_EQUAL(cnx_string_length(formatted), 14U);
+	TEST_ASSERT_TRUE(cnx_string_equal(formatted, "42 string view"));
+
+	CnxScopedString expected = cnx_format("{} {} {}", number, string, view);
+	TEST_ASSERT_TRUE(cnx_string_equal(formatted, &expected));
+	cnx_string_free(string);
+}
+
+TEST(CnxDeferredLog, print_and_println) {
+	{
+		CnxScopedFile file = deferred_log_test_open();
+		let_mut maybe_log
+			= cnx_deferred_log_new_with_options(&file, deferred_log_test_options(4096));
+		TEST_ASSERT_TRUE(cnx_result_is_ok(maybe_log));
+		CnxScopedDeferredLog log = cnx_result_unwrap(maybe_log);
+
+		let integer = -17;
+		let unsigned_integer = static_cast(u64)(1234567890123U);
+		let floating_point = 2.5;
+		let boolean = true;
+		let character = static_cast(char)('c');
+		let_mut cstr = static_cast(const_cstring)("cstring");
+		TEST_ASSERT_TRUE(cnx_deferred_log_println(&log, "no arguments"));
+		TEST_ASSERT_TRUE(cnx_deferred_log_println(&log,
+												  "{} {} {} {} {}",
+												  integer,
+												  unsigned_integer,
+												  floating_point,
+												  boolean,
+												  character));
+		TEST_ASSERT_TRUE(cnx_deferred_log_print(&log, "{} ", cstr));
+		TEST_ASSERT_TRUE(cnx_deferred_log_println(&log, "{}", "literal"));
+
+		{
+			// strings are copied when logged, so they needn't outlive decoding
+			CnxScopedString string = cnx_string_from("a CnxString");
+			let view = cnx_stringview_from("a CnxStringView, truncated", 0, 15);
+			TEST_ASSERT_TRUE(cnx_deferred_log_println(&log, "{}, {}", string, view));
+		}
+		let_mut empty = cnx_string_new();
+		TEST_ASSERT_TRUE(cnx_deferred_log_println(&log, "[{}]", empty));
+		cnx_string_free(empty);
+
+		let_mut flushed = cnx_deferred_log_flush(&log);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(flushed));
+		TEST_ASSERT_EQUAL(cnx_deferred_log_dropped(&log), 0U);
+	}
+
+	CnxScopedString contents = deferred_log_test_read();
+	let expected = static_cast(const_cstring)("no arguments\n"
+											  "-17 1234567890123 2.500E0 true c\n"
+											  "cstring literal\n"
+											  "a CnxString, a CnxStringView\n"
+											  "[]\n");
+	TEST_ASSERT_TRUE(cnx_string_equal(contents, expected));
+	ignore(remove(DEFERRED_LOG_TEST_PATH));
+}
+
+TEST(CnxDeferredLog, wrap_around_and_drops) {
+	// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+	let num_lines = 1000;
+	{
+		CnxScopedFile file = deferred_log_test_open();
+		// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+		let_mut maybe_log
+			= cnx_deferred_log_new_with_options(&file, deferred_log_test_options(512));
+		TEST_ASSERT_TRUE(cnx_result_is_ok(maybe_log));
+		CnxScopedDeferredLog log = cnx_result_unwrap(maybe_log);
+
+		// records of varying sizes, flushed often enough to never fill the buffer, but wrapping
+		// around its end many times
+		for(let_mut i = 0; i < num_lines; ++i) {
+			let text
+				= cnx_stringview_from("abcdefghijklmnopqrstuvwxyz", 0, static_cast(usize)(i % 27));
+			TEST_ASSERT_TRUE(cnx_deferred_log_println(&log, "{} {}", i, text));
+			if(i % 2 == 1) {
+				let_mut flushed = cnx_deferred_log_flush(&log);
+				TEST_ASSERT_TRUE(cnx_result_is_ok(flushed));
+			}
+		}
+		TEST_ASSERT_EQUAL(cnx_deferred_log_dropped(&log), 0U);
+
+		// without decoding, the buffer eventually fills and further records are dropped
+		let_mut recorded = 0U;
+		for(let_mut i = 0; i < 100; ++i) {
+			recorded += cnx_deferred_log_println(&log, "{}", i) ? 1U : 0U;
+		}
+		TEST_ASSERT_GREATER_THAN(recorded, 0U);
+		TEST_ASSERT_LESS_THAN(recorded, 100U);
+		TEST_ASSERT_EQUAL(cnx_deferred_log_dropped(&log), 100U - recorded);
+
+		// a record larger than the buffer can never be recorded
+		CnxScopedString too_large = cnx_string_new();
+		// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+		cnx_string_resize(too_large, 512U);
+		cnx_string_fill(too_large, 'x');
+		let_mut flushed = cnx_deferred_log_flush(&log);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(flushed));
+		TEST_ASSERT_FALSE(cnx_deferred_log_println(&log, "{}", too_large));
+	}
+
+	CnxScopedString contents = deferred_log_test_read();
+	let_mut line = cnx_string_into_cstring(contents);
+	for(let_mut i = 0; i < num_lines; ++i) {
+		let_mut index = 0;
+		let_mut length = 0;
+		TEST_ASSERT_EQUAL(sscanf(line, "%d%n", &index, &length), 1);
+		TEST_ASSERT_EQUAL(index, i);
+		TEST_ASSERT_EQUAL(line[length], ' ');
+		line += length + 1;
+
+		let text_length = static_cast(usize)(i % 27);
+		TEST_ASSERT_EQUAL(strncmp(line, "abcdefghijklmnopqrstuvwxyz", text_length), 0);
+		TEST_ASSERT_EQUAL(line[text_length], '\n');
+		line += text_length + 1;
+	}
+	ignore(remove(DEFERRED_LOG_TEST_PATH));
+}
+
+typedef struct DeferredLogTestThread {
+	CnxDeferredLog* log;
+	i32 index;
+} DeferredLogTestThread;
+
+void LambdaFunction(deferred_log_test_log_lines) {
+	let binding = lambda_binding(DeferredLogTestThread*);
+	let thread = binding._1;
+	for(let_mut i = 0; i < DEFERRED_LOG_TEST_LINES_PER_THREAD; ++i) {
+		// the background decoder keeps up with the logging threads, so only spin if it hasn't yet
+		while(!cnx_deferred_log_println(thread->log, "{} {}", thread->index, i)) {
+			cnx_this_thread_yield();
+		}
+	}
+}
+
+TEST(CnxDeferredLog, background_decoder) {
+	{
+		CnxScopedFile file = deferred_log_test_open();
+		let_mut options = deferred_log_test_options(4096);
+		options.decode_interval = cnx_milliseconds(1);
+		let_mut maybe_log = cnx_deferred_log_new_with_options(&file, options);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(maybe_log));
+		CnxScopedDeferredLog log = cnx_result_unwrap(maybe_log);
+
+		DeferredLogTestThread threads[DEFERRED_LOG_TEST_NUM_THREADS];
+		CnxThread handles[DEFERRED_LOG_TEST_NUM_THREADS];
+		for(let_mut i = 0; i < DEFERRED_LOG_TEST_NUM_THREADS; ++i) {
+			threads[i] = (DeferredLogTestThread){.log = &log, .index = i};
+			let_mut res = cnx_thread_init(
+				&handles[i],
+				lambda_cast(lambda(deferred_log_test_log_lines, &threads[i]), CnxThreadLambda));
+			TEST_ASSERT_TRUE(cnx_result_is_ok(res));
+		}
+		for(let_mut i = 0; i < DEFERRED_LOG_TEST_NUM_THREADS; ++i) {
+			ignore(cnx_thread_join(&handles[i]));
+		}
+		// the remaining records are written when the log is freed
+	}
+
+	CnxScopedString contents = deferred_log_test_read();
+	i32 next_lines[DEFERRED_LOG_TEST_NUM_THREADS] = {0};
+	let_mut line = cnx_string_into_cstring(contents);
+	let_mut num_lines = 0;
+	while(*line != '\0') {
+		let_mut thread = 0;
+		let_mut index = 0;
+		TEST_ASSERT_EQUAL(sscanf(line, "%d %d", &thread, &index), 2);
+		TEST_ASSERT_TRUE(thread >= 0 && thread < DEFERRED_LOG_TEST_NUM_THREADS);
+		// each thread's lines are written in the order they were logged
+		TEST_ASSERT_EQUAL(index, next_lines[thread]);
+		++next_lines[thread];
+		++num_lines;
+		line = strchr(line, '\n');
+		TEST_ASSERT_NOT_EQUAL(line, nullptr);
+		++line;
+	}
+	TEST_ASSERT_EQUAL(num_lines,
+					  DEFERRED_LOG_TEST_NUM_THREADS * DEFERRED_LOG_TEST_LINES_PER_THREAD);
+	ignore(remove(DEFERRED_LOG_TEST_PATH));
+}
+
+#endif // CNX_DEFERRED_LOG_TEST
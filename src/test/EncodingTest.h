@@ -0,0 +1,230 @@
+#ifndef CNX_ENCODING_TEST
+#define CNX_ENCODING_TEST
+
+#include <Cnx/Encoding.h>
+#include <Cnx/Format.h>
+
+#include "Criterion.h"
+#include "TestRandom.h"
+
+#define ENCODING_TEST_MAX_LENGTH 200
+
+/// @brief Encodes `data` one six-bit group at a time, independently of the vectorized encoders
+static inline usize encoding_test_reference_base64(const u8* restrict data,
+												   usize length,
+												   char* restrict out,
+												   CnxBase64Alphabet alphabet) {
+	let digits = alphabet == CNX_BASE64_URL ?
+					 "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_" :
+					 "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	let num_bits = length * 8;
+	let_mut written = static_cast(usize)(0);
+	for(let_mut bit = static_cast(usize)(0); bit < num_bits; bit += 6) {
+		let_mut value = 0U;
+		for(let_mut i = bit; i < bit + 6; ++i) {
+			let set = i < num_bits && (data[i / 8] & (0x80U >> (i % 8))) != 0; // NOLINT
+			value = (value << 1U) | (set ? 1U : 0U);
+		}
+		out[written++] = digits[value];
+	}
+	while(alphabet == CNX_BASE64_STANDARD && written % 4 != 0) {
+		out[written++] = '=';
+	}
+	return written;
+}
+
+/// @brief Checks that decoding `encoded` with `alphabet` fails
+static inline bool
+encoding_test_base64_is_invalid(const_cstring encoded, CnxBase64Alphabet alphabet) {
+	u8 decoded[ENCODING_TEST_MAX_LENGTH] = {0};
+	let length = strlen(encoded);
+	let result = cnx_base64_decode(encoded, length, decoded, alphabet);
+	return cnx_result_is_err(result);
+}
+
+TEST(CnxEncoding, hex) {
+	const u8 data[] = {0x00, 0x01, 0x7F, 0x80, 0xAB, 0xCD, 0xEF, 0xFF};
+	char encoded[2 * sizeof(data) + 1] = {0};
+	TEST_ASSERT_EQUAL(cnx_hex_encoded_length(sizeof(data)), 2 * sizeof(data));
+	TEST_ASSERT_EQUAL(cnx_hex_encode(data, sizeof(data), encoded, false), 2 * sizeof(data));
+	TEST_ASSERT_EQUAL(strcmp(encoded, "00017f80abcdefff"), 0);
+	ignore(cnx_hex_encode(data, sizeof(data), encoded, true));
+	TEST_ASSERT_EQUAL(strcmp(encoded, "00017F80ABCDEFFF"), 0);
+
+	u8 decoded[sizeof(data)] = {0};
+	let_mut result = cnx_hex_decode("00017f80ABcdEfFF", 16, decoded);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	TEST_ASSERT_EQUAL(cnx_result_unwrap(result), sizeof(data));
+	TEST_ASSERT_EQUAL(memcmp(decoded, data, sizeof(data)), 0);
+
+	let odd = cnx_hex_decode("abc", 3, decoded);
+	TEST_ASSERT_TRUE(cnx_result_is_err(odd));
+	let invalid = cnx_hex_decode("0g", 2, decoded);
+	TEST_ASSERT_TRUE(cnx_result_is_err(invalid));
+}
+
+TEST(CnxEncoding, hex_across_blocks) {
+	// place an invalid digit at every offset around the 32- and 64-digit block boundaries
+	char digits[ENCODING_TEST_MAX_LENGTH + 1] = {0};
+	u8 decoded[ENCODING_TEST_MAX_LENGTH / 2] = {0};
+	for(let_mut offset = 0U; offset < 130U; ++offset) {
+		memset(digits, 'a', ENCODING_TEST_MAX_LENGTH);
+		let valid = cnx_hex_decode(digits, 130, decoded);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(valid));
+		TEST_ASSERT_EQUAL(decoded[offset / 2], 0xAAU);
+
+		digits[offset] = 'x';
+		let invalid = cnx_hex_decode(digits, 130, decoded);
+		TEST_ASSERT_TRUE(cnx_result_is_err(invalid));
+		digits[offset] = 'G';
+		let invalid_upper = cnx_hex_decode(digits, 130, decoded);
+		TEST_ASSERT_TRUE(cnx_result_is_err(invalid_upper));
+	}
+}
+
+TEST(CnxEncoding, base64) {
+	// the test vectors from RFC 4648, section 10
+	const_cstring inputs[] = {"", "f", "fo", "foo", "foob", "fooba", "foobar"};
+	const_cstring padded[] = {"", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy"};
+	const_cstring unpadded[] = {"", "Zg", "Zm8", "Zm9v", "Zm9vYg", "Zm9vYmE", "Zm9vYmFy"};
+	for(let_mut i = 0U; i < sizeof(inputs) / sizeof(inputs[0]); ++i) {
+		let data = static_cast(const u8*)(static_cast(const void*)(inputs[i]));
+		let length = strlen(inputs[i]);
+		char encoded[16] = {0};
+
+		let standard_length = cnx_base64_encoded_length(length, CNX_BASE64_STANDARD);
+		TEST_ASSERT_EQUAL(standard_length, strlen(padded[i]));
+		TEST_ASSERT_EQUAL(cnx_base64_encode(data, length, encoded, CNX_BASE64_STANDARD),
+						  standard_length);
+		TEST_ASSERT_EQUAL(strcmp(encoded, padded[i]), 0);
+
+		memset(encoded, 0, sizeof(encoded));
+		let url_length = cnx_base64_encoded_length(length, CNX_BASE64_URL);
+		TEST_ASSERT_EQUAL(url_length, strlen(unpadded[i]));
+		TEST_ASSERT_EQUAL(cnx_base64_encode(data, length, encoded, CNX_BASE64_URL), url_length);
+		TEST_ASSERT_EQUAL(strcmp(encoded, unpadded[i]), 0);
+
+		// padding is optional when decoding, in either alphabet
+		u8 decoded[16] = {0};
+		TEST_ASSERT_EQUAL(cnx_base64_decoded_length(padded[i], strlen(padded[i])), length);
+		let_mut from_padded
+			= cnx_base64_decode(padded[i], strlen(padded[i]), decoded, CNX_BASE64_URL);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(from_padded));
+		TEST_ASSERT_EQUAL(cnx_result_unwrap(from_padded), length);
+		TEST_ASSERT_EQUAL(memcmp(decoded, data, length), 0);
+
+		memset(decoded, 0, sizeof(decoded));
+		TEST_ASSERT_EQUAL(cnx_base64_decoded_length(unpadded[i], strlen(unpadded[i])), length);
+		let_mut from_unpadded
+			= cnx_base64_decode(unpadded[i], strlen(unpadded[i]), decoded, CNX_BASE64_STANDARD);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(from_unpadded));
+		TEST_ASSERT_EQUAL(cnx_result_unwrap(from_unpadded), length);
+		TEST_ASSERT_EQUAL(memcmp(decoded, data, length), 0);
+	}
+}
+
+TEST(CnxEncoding, base64_alphabets) {
+	const u8 data[] = {0xFB, 0xFF, 0xBF};
+	char encoded[5] = {0};
+	ignore(cnx_base64_encode(data, sizeof(data), encoded, CNX_BASE64_STANDARD));
+	TEST_ASSERT_EQUAL(strcmp(encoded, "+/+/"), 0);
+	ignore(cnx_base64_encode(data, sizeof(data), encoded, CNX_BASE64_URL));
+	TEST_ASSERT_EQUAL(strcmp(encoded, "-_-_"), 0);
+
+	TEST_ASSERT_TRUE(encoding_test_base64_is_invalid("+/+/", CNX_BASE64_URL));
+	TEST_ASSERT_TRUE(encoding_test_base64_is_invalid("-_-_", CNX_BASE64_STANDARD));
+}
+
+TEST(CnxEncoding, base64_invalid) {
+	TEST_ASSERT_TRUE(encoding_test_base64_is_invalid("Z", CNX_BASE64_STANDARD));
+	TEST_ASSERT_TRUE(encoding_test_base64_is_invalid("Zm9vY", CNX_BASE64_STANDARD));
+	TEST_ASSERT_TRUE(encoding_test_base64_is_invalid("Z===", CNX_BASE64_STANDARD));
+	TEST_ASSERT_TRUE(encoding_test_base64_is_invalid("Zg=", CNX_BASE64_STANDARD));
+	TEST_ASSERT_TRUE(encoding_test_base64_is_invalid("Zg==Zg==", CNX_BASE64_STANDARD));
+	TEST_ASSERT_TRUE(encoding_test_base64_is_invalid("Zm 9v", CNX_BASE64_STANDARD));
+
+	// an invalid digit at every offset around the 16- and 32-digit block boundaries
+	char digits[ENCODING_TEST_MAX_LENGTH + 1] = {0};
+	for(let_mut offset = 0U; offset < 100U; ++offset) {
+		memset(digits, 'Q', 100);
+		digits[offset] = '*';
+		TEST_ASSERT_TRUE(encoding_test_base64_is_invalid(digits, CNX_BASE64_STANDARD));
+	}
+}
+
+TEST(CnxEncoding, round_trips_match_reference) {
+	let_mut state = 42U;
+	u8 data[ENCODING_TEST_MAX_LENGTH] = {0};
+	u8 decoded[ENCODING_TEST_MAX_LENGTH] = {0};
+	char encoded[2 * ENCODING_TEST_MAX_LENGTH + 1] = {0};
+	char expected[2 * ENCODING_TEST_MAX_LENGTH + 1] = {0};
+	for(let_mut length = 0U; length < ENCODING_TEST_MAX_LENGTH; ++length) {
+		for(let_mut i = 0U; i < length; ++i) {
+			data[i] = static_cast(u8)(test_random(&state));
+		}
+
+		let hex_length = cnx_hex_encode(data, length, encoded, (length & 1U) != 0);
+		TEST_ASSERT_EQUAL(hex_length, cnx_hex_encoded_length(length));
+		for(let_mut i = 0U; i < length; ++i) {
+			let_mut byte = 0U;
+			TEST_ASSERT_EQUAL(sscanf(encoded + 2 * i, "%2x", &byte), 1); // NOLINT
+			TEST_ASSERT_EQUAL(byte, data[i]);
+		}
+		let_mut hex_decoded = cnx_hex_decode(encoded, hex_length, decoded);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(hex_decoded));
+		TEST_ASSERT_EQUAL(cnx_result_unwrap(hex_decoded), length);
+		TEST_ASSERT_EQUAL(memcmp(decoded, data, length), 0);
+
+		for(let_mut alphabet = CNX_BASE64_STANDARD; alphabet <= CNX_BASE64_URL; ++alphabet) {
+			let encoded_length = cnx_base64_encode(data, length, encoded, alphabet);
+			let expected_length = encoding_test_reference_base64(data, length, expected, alphabet);
+			TEST_ASSERT_EQUAL(encoded_length, expected_length);
+			TEST_ASSERT_EQUAL(encoded_length, cnx_base64_encoded_length(length, alphabet));
+			TEST_ASSERT_EQUAL(memcmp(encoded, expected, encoded_length), 0);
+
+			memset(decoded, 0, sizeof(decoded));
+			TEST_ASSERT_EQUAL(cnx_base64_decoded_length(encoded, encoded_length), length);
+			let_mut base64_decoded = cnx_base64_decode(encoded, encoded_length, decoded, alphabet);
+			TEST_ASSERT_TRUE(cnx_result_is_ok(base64_decoded));
+			TEST_ASSERT_EQUAL(cnx_result_unwrap(base64_decoded), length);
+			TEST_ASSERT_EQUAL(memcmp(decoded, data, length), 0);
+		}
+	}
+}
+
+TEST(CnxEncoding, string_append) {
+	const u8 data[] = {'f', 'o', 'o', 'b', 'a', 'r'};
+	CnxScopedString string = cnx_string_from("hex: ");
+	cnx_string_append_hex(string, data, sizeof(data), false);
+	TEST_ASSERT(cnx_string_equal(string, "hex: 666f6f626172"));
+
+	cnx_string_append(string, ", base64: ");
+	cnx_string_append_base64(string, data, sizeof(data) - 1, CNX_BASE64_STANDARD);
+	TEST_ASSERT(cnx_string_equal(string, "hex: 666f6f626172, base64: Zm9vYmE="));
+	TEST_ASSERT_EQUAL(cnx_string_length(string), strlen("hex: 666f6f626172, base64: Zm9vYmE="));
+
+	// growing past the short-string capacity
+	CnxScopedString long_string = cnx_string_new();
+	for(let_mut i = 0; i < 20; ++i) {
+		cnx_string_append_base64(long_string, data, sizeof(data), CNX_BASE64_URL);
+	}
+	TEST_ASSERT_EQUAL(cnx_string_length(long_string), 160U);
+	TEST_ASSERT_EQUAL(cnx_string_at(long_string, 159), 'y');
+}
+
+TEST(CnxEncoding, format_hex) {
+	let value = 0xDEADBEEFU;
+	CnxScopedString lower = cnx_format("{x}", value);
+	TEST_ASSERT(cnx_string_equal(lower, "0xdeadbeef"));
+	let wide = static_cast(u64)(0x1234ABCDU);
+	CnxScopedString upper = cnx_format("{X}", wide);
+	TEST_ASSERT(cnx_string_equal(upper, "0X1234ABCD"));
+	let zero_value = 0U;
+	CnxScopedString zero = cnx_format("{x}", zero_value);
+	TEST_ASSERT(cnx_string_equal(zero, "0x0"));
+	let byte = static_cast(u8)(0xFF);
+	CnxScopedString max = cnx_format("{x}", byte);
+	TEST_ASSERT(cnx_string_equal(max, "0xff"));
+}
+
+#endif // CNX_ENCODING_TEST
@@ -0,0 +1,350 @@
+#ifndef CNX_JSON_TEST
+#define CNX_JSON_TEST
+
+#include <Cnx/Json.h>
+#include <Cnx/filesystem/File.h>
+#include <stdio.h>
+
+#include "Criterion.h"
+#include "TestView.h"
+
+#define JSON_TEST_PATH "cnx_json_test.json"
+
+static inline bool json_test_view_equal(CnxStringView view, restrict const_cstring expected) {
+	return view.m_length == strlen(expected) && memcmp(view.m_view, expected, view.m_length) == 0;
+}
+
+static inline i64 json_test_parse_error(restrict const_cstring json) {
+	let view = test_view(json);
+	let_mut result = cnx_json_parse(view);
+	if(cnx_result_is_ok(result)) {
+		let_mut document = cnx_result_unwrap(result);
+		cnx_json_document_free(&document);
+		return 0;
+	}
+	let error = cnx_result_unwrap_err(result);
+	return cnx_error_code(&error);
+}
+
+TEST(CnxJson, writer_escapes_and_nests) {
+	CnxScopedString string = cnx_string_new();
+	let_mut writer = cnx_json_writer_new_string(&string);
+	let_mut result = cnx_json_writer_begin_object(&writer);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	result = cnx_json_writer_key_cstring(&writer, "name");
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	result = cnx_json_writer_write_cstring(&writer, "quote \" slash \\ tab \t bell \x07");
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	result = cnx_json_writer_key_cstring(&writer, "values");
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	result = cnx_json_writer_begin_array(&writer);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	result = cnx_json_writer_write_i64(&writer, INT64_MIN);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	result = cnx_json_writer_write_u64(&writer, UINT64_MAX);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	result = cnx_json_writer_write_f64(&writer, 0.1);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	result = cnx_json_writer_write_f64(&writer, NAN);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	result = cnx_json_writer_write_bool(&writer, false);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	result = cnx_json_writer_begin_object(&writer);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	result = cnx_json_writer_end_object(&writer);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	result = cnx_json_writer_end_array(&writer);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	result = cnx_json_writer_key_cstring(&writer, "empty");
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	result = cnx_json_writer_write_null(&writer);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	TEST_ASSERT_FALSE(cnx_json_writer_is_complete(&writer));
+	result = cnx_json_writer_end_object(&writer);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	TEST_ASSERT_TRUE(cnx_json_writer_is_complete(&writer));
+
+	TEST_ASSERT_TRUE(cnx_string_equal(
+		string,
+		"{\"name\":\"quote \\\" slash \\\\ tab \\t bell \\u0007\","
+		"\"values\":[-9223372036854775808,18446744073709551615,0.1,null,false,{}],"
+		"\"empty\":null}"));
+}
+
+TEST(CnxJson, parses_document) {
+	let view = test_view(" {\"id\": 42, \"big\": 18446744073709551615, \"neg\": -7,\n"
+						 "  \"pi\": 3.25e0, \"ok\": true, \"nothing\": null,\n"
+						 "  \"text\": \"a\\\"b\\\\c\\nd \\u00e9 \\ud83d\\ude00\",\n"
+						 "  \"plain\": \"no escapes\", \"list\": [1, [], {}, \"x\"]} ");
+	let_mut result = cnx_json_parse(view);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	CnxScopedJsonDocument document = cnx_result_unwrap(result);
+	let root = cnx_json_document_root(document);
+	TEST_ASSERT_EQUAL(cnx_json_value_type(root), CnxJsonObject);
+	TEST_ASSERT_EQUAL(cnx_json_value_size(root), 9U);
+	TEST_ASSERT_TRUE(json_test_view_equal(cnx_json_value_member_at(root, 1)->m_key, "big"));
+	TEST_ASSERT_EQUAL(cnx_json_value_member_at(root, 9), nullptr);
+
+	let_mut id = cnx_json_value_as_i64(cnx_json_value_get(root, "id"));
+	TEST_ASSERT_TRUE(cnx_option_is_some(id));
+	TEST_ASSERT_EQUAL(cnx_option_unwrap(id), 42);
+	let_mut big = cnx_json_value_as_u64(cnx_json_value_get(root, "big"));
+	TEST_ASSERT_TRUE(cnx_option_is_some(big));
+	TEST_ASSERT_EQUAL(cnx_option_unwrap(big), UINT64_MAX);
+	let_mut negative = cnx_json_value_as_u64(cnx_json_value_get(root, "neg"));
+	TEST_ASSERT_TRUE(cnx_option_is_none(negative));
+	let_mut pi = cnx_json_value_as_f64(cnx_json_value_get(root, "pi"));
+	TEST_ASSERT_TRUE(cnx_option_is_some(pi));
+	TEST_ASSERT_EQUAL(cnx_option_unwrap(pi), 3.25);
+	TEST_ASSERT_TRUE(cnx_json_value_as_bool(cnx_json_value_get(root, "ok")));
+	TEST_ASSERT_EQUAL(cnx_json_value_type(cnx_json_value_get(root, "nothing")), CnxJsonNull);
+	TEST_ASSERT_EQUAL(cnx_json_value_get(root, "missing"), nullptr);
+
+	let_mut text = cnx_json_value_as_string(cnx_json_value_get(root, "text"));
+	TEST_ASSERT_TRUE(cnx_option_is_some(text));
+	TEST_ASSERT_TRUE(
+		json_test_view_equal(cnx_option_unwrap(text), "a\"b\\c\nd \xC3\xA9 \xF0\x9F\x98\x80"));
+	// strings without escapes are views into the input
+	let_mut plain = cnx_json_value_as_string(cnx_json_value_get(root, "plain"));
+	TEST_ASSERT_TRUE(cnx_option_is_some(plain));
+	TEST_ASSERT_TRUE(cnx_option_unwrap(plain).m_view > view.m_view
+					 && cnx_option_unwrap(plain).m_view < view.m_view + view.m_length);
+
+	let list = cnx_json_value_get(root, "list");
+	TEST_ASSERT_EQUAL(cnx_json_value_size(list), 4U);
+	TEST_ASSERT_EQUAL(cnx_json_value_type(cnx_json_value_at(list, 1)), CnxJsonArray);
+	TEST_ASSERT_EQUAL(cnx_json_value_size(cnx_json_value_at(list, 1)), 0U);
+	TEST_ASSERT_EQUAL(cnx_json_value_type(cnx_json_value_at(list, 2)), CnxJsonObject);
+	TEST_ASSERT_EQUAL(cnx_json_value_type(cnx_json_value_at(list, 3)), CnxJsonString);
+	TEST_ASSERT_EQUAL(cnx_json_value_at(list, 4), nullptr);
+}
+
+TEST(CnxJson, classifies_numbers_by_range) {
+	let view = test_view("[9223372036854775807, 9223372036854775808, -9223372036854775808,"
+						 " -9223372036854775809, 18446744073709551616, -0, 1e400, -1e400]");
+	let_mut result = cnx_json_parse(view);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	CnxScopedJsonDocument document = cnx_result_unwrap(result);
+	let root = cnx_json_document_root(document);
+	const CnxJsonType types[] = {CnxJsonI64,
+								 CnxJsonU64,
+								 CnxJsonI64,
+								 CnxJsonF64,
+								 CnxJsonF64,
+								 CnxJsonI64,
+								 CnxJsonF64,
+								 CnxJsonF64};
+	TEST_ASSERT_EQUAL(cnx_json_value_size(root), sizeof(types) / sizeof(types[0]));
+	for(let_mut i = 0U; i < sizeof(types) / sizeof(types[0]); ++i) {
+		TEST_ASSERT_EQUAL(cnx_json_value_type(cnx_json_value_at(root, i)), types[i]);
+	}
+
+	let_mut min = cnx_json_value_as_i64(cnx_json_value_at(root, 2));
+	TEST_ASSERT_TRUE(cnx_option_is_some(min));
+	TEST_ASSERT_EQUAL(cnx_option_unwrap(min), INT64_MIN);
+	// numbers too large for an `f64` are infinite
+	let_mut huge = cnx_json_value_as_f64(cnx_json_value_at(root, 7));
+	TEST_ASSERT_TRUE(cnx_option_is_some(huge));
+	TEST_ASSERT_EQUAL(cnx_option_unwrap(huge), -HUGE_VAL);
+}
+
+TEST(CnxJson, rejects_invalid_input) {
+	TEST_ASSERT_EQUAL(json_test_parse_error("[1, 2]"), 0);
+	TEST_ASSERT_EQUAL(json_test_parse_error("\"scalar root\""), 0);
+	TEST_ASSERT_EQUAL(json_test_parse_error(""), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("  "), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("[1, 2"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("[1, 2,]"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("[1 2]"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("[1\"a\"]"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("{\"a\" 1}"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("{1: 1}"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("{\"a\": 1]"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("[\"unclosed]"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("[\"bad \\x escape\"]"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("[\"lone \\udc00 surrogate\"]"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("[\"raw \n newline\"]"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("[\"invalid \xC3 utf8\"]"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("[01]"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("[1.]"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("[-]"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("[1e+]"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("[tru]"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("[nulls]"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("1 2"), EINVAL);
+	TEST_ASSERT_EQUAL(json_test_parse_error("{} x"), EINVAL);
+
+	// nesting deeper than `CNX_JSON_MAX_DEPTH` is rejected
+	let depth = CNX_JSON_MAX_DEPTH + 1U;
+	let_mut deep = cnx_allocator_allocate_array_t(char, DEFAULT_ALLOCATOR, depth * 2U + 1U);
+	memset(deep, '[', depth);
+	memset(deep + depth, ']', depth);
+	deep[depth * 2U] = '\0';
+	TEST_ASSERT_EQUAL(json_test_parse_error(deep), EINVAL);
+	deep[depth - 1U] = ' ';
+	deep[depth] = ' ';
+	TEST_ASSERT_EQUAL(json_test_parse_error(deep), 0);
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, deep);
+}
+
+TEST(CnxJson, escapes_across_blocks) {
+	// runs of backslashes of every length, at every offset relative to the parser's 64 byte
+	// blocks, must only escape the byte following them when their length is odd
+	let_mut json = cnx_string_new();
+	let_mut expected = cnx_string_new();
+	cnx_string_push_back(json, '[');
+	// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+	for(let_mut i = 0U; i < 200U; ++i) {
+		cnx_string_push_back(json, '"');
+		for(let_mut padding = 0U; padding < i % 67U; ++padding) {
+			cnx_string_push_back(json, 'p');
+		}
+		// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+		for(let_mut backslash = 0U; backslash < i % 9U; ++backslash) {
+			cnx_string_push_back(json, '\\');
+			cnx_string_push_back(json, '\\');
+		}
+		cnx_string_append(json, "\\\"],\"");
+		cnx_string_push_back(json, ',');
+	}
+	cnx_string_append(json, "\"end\"]");
+
+	let view = cnx_string_into_stringview(json);
+	let_mut result = cnx_json_parse(view);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	CnxScopedJsonDocument document = cnx_result_unwrap(result);
+	let root = cnx_json_document_root(document);
+	TEST_ASSERT_EQUAL(cnx_json_value_size(root), 201U);
+	// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+	for(let_mut i = 0U; i < 200U; ++i) {
+		cnx_string_clear(expected);
+		for(let_mut padding = 0U; padding < i % 67U; ++padding) {
+			cnx_string_push_back(expected, 'p');
+		}
+		// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+		for(let_mut backslash = 0U; backslash < i % 9U; ++backslash) {
+			cnx_string_push_back(expected, '\\');
+		}
+		cnx_string_append(expected, "\"],");
+		let_mut string = cnx_json_value_as_string(cnx_json_value_at(root, i));
+		TEST_ASSERT_TRUE(cnx_option_is_some(string));
+		TEST_ASSERT_TRUE(
+			json_test_view_equal(cnx_option_unwrap(string), cnx_string_into_cstring(expected)));
+	}
+
+	cnx_string_free(json);
+	cnx_string_free(expected);
+}
+
+typedef struct JsonTestCounter {
+	usize values;
+	usize keys;
+	usize containers;
+	usize limit;
+} JsonTestCounter;
+
+static inline bool json_test_count_value(JsonTestCounter* restrict counter) {
+	++counter->values;
+	return counter->values < counter->limit;
+}
+
+static inline bool json_test_null_value(CnxJsonHandler* restrict self) {
+	return json_test_count_value(static_cast(JsonTestCounter*)(self->m_self));
+}
+
+static inline bool
+json_test_boolean(CnxJsonHandler* restrict self, __attr(maybe_unused) bool value) {
+	return json_test_count_value(static_cast(JsonTestCounter*)(self->m_self));
+}
+
+static inline bool
+json_test_number(CnxJsonHandler* restrict self, __attr(maybe_unused) CnxJsonNumber value) {
+	return json_test_count_value(static_cast(JsonTestCounter*)(self->m_self));
+}
+
+static inline bool
+json_test_string(CnxJsonHandler* restrict self, __attr(maybe_unused) CnxStringView value) {
+	return json_test_count_value(static_cast(JsonTestCounter*)(self->m_self));
+}
+
+static inline bool json_test_container(CnxJsonHandler* restrict self) {
+	let counter = static_cast(JsonTestCounter*)(self->m_self);
+	++counter->containers;
+	return true;
+}
+
+static inline bool
+json_test_key(CnxJsonHandler* restrict self, __attr(maybe_unused) CnxStringView key) {
+	let counter = static_cast(JsonTestCounter*)(self->m_self);
+	++counter->keys;
+	return true;
+}
+
+__attr(maybe_unused) static ImplTraitFor(CnxJsonHandler,
+										 JsonTestCounter,
+										 json_test_null_value,
+										 json_test_boolean,
+										 json_test_number,
+										 json_test_string,
+										 json_test_container,
+										 json_test_key,
+										 json_test_container,
+										 json_test_container,
+										 json_test_container);
+
+TEST(CnxJson, sax_handler) {
+	let view = test_view("{\"a\": [1, 2.5, \"three\", null], \"b\": {\"c\": false}}");
+	let_mut counter = (JsonTestCounter){.values = 0, .keys = 0, .containers = 0, .limit = 100};
+	let_mut handler = as_trait(CnxJsonHandler, JsonTestCounter, counter);
+	let_mut result = cnx_json_parse_sax(view, &handler);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	TEST_ASSERT_EQUAL(counter.values, 5U);
+	TEST_ASSERT_EQUAL(counter.keys, 3U);
+	TEST_ASSERT_EQUAL(counter.containers, 6U);
+
+	// returning false from a handler function stops parsing
+	counter = (JsonTestCounter){.values = 0, .keys = 0, .containers = 0, .limit = 2};
+	result = cnx_json_parse_sax(view, &handler);
+	TEST_ASSERT_TRUE(cnx_result_is_err(result));
+	let error = cnx_result_unwrap_err(result);
+	TEST_ASSERT_EQUAL(cnx_error_code(&error), ECANCELED);
+	TEST_ASSERT_EQUAL(counter.values, 2U);
+}
+
+TEST(CnxJson, file_and_format_round_trip) {
+	let view = test_view("{\"name\":\"caf\xC3\xA9 \\\"menu\\\"\",\"prices\":[1.5,-2,"
+						 "18446744073709551615],\"open\":true,\"owner\":null,\"tags\":[]}");
+	let_mut result = cnx_json_parse(view);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(result));
+	CnxScopedJsonDocument document = cnx_result_unwrap(result);
+	let root = cnx_json_document_root(document);
+
+	// formatting a value writes it as compact JSON, which here reproduces the input
+	CnxScopedString formatted = cnx_format("{}", as_format_t(CnxJsonValue, *root));
+	TEST_ASSERT_TRUE(cnx_string_equal(formatted, &view));
+
+	{
+		let_mut maybe_file = cnx_file_open(JSON_TEST_PATH);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(maybe_file));
+		CnxScopedFile file = cnx_result_unwrap(maybe_file);
+		let_mut writer = cnx_json_writer_new_file(&file);
+		let_mut written = cnx_json_writer_write_value(&writer, root);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(written));
+		TEST_ASSERT_TRUE(cnx_json_writer_is_complete(&writer));
+	}
+
+	let options = (CnxFileOptions){.mode = CnxFileRead, .modifiers = CnxFileNone};
+	let_mut maybe_file = cnx_file_open(JSON_TEST_PATH, options);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(maybe_file));
+	CnxScopedFile file = cnx_result_unwrap(maybe_file);
+	char contents[256];
+	let_mut read = cnx_file_read_bytes(&file,
+									   static_cast(u8*)(static_cast(void*)(contents)),
+									   sizeof(contents));
+	TEST_ASSERT_TRUE(cnx_result_is_ok(read));
+	TEST_ASSERT_EQUAL(cnx_result_unwrap(read), view.m_length);
+	TEST_ASSERT_EQUAL(memcmp(contents, view.m_view, view.m_length), 0);
+	ignore(remove(JSON_TEST_PATH));
+}
+
+#endif // CNX_JSON_TEST
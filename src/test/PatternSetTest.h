@@ -0,0 +1,309 @@
+#ifndef CNX_PATTERN_SET_TEST
+#define CNX_PATTERN_SET_TEST
+
+#include <Cnx/PatternSet.h>
+#include <Cnx/filesystem/Path.h>
+
+#include "Criterion.h"
+
+#define PATTERN_SET_TEST_HAYSTACK_SIZE 2000
+#define PATTERN_SET_TEST_NUM_PATTERNS  12
+
+static inline bool pattern_set_test_matches_at(const_cstring haystack,
+											   usize haystack_length,
+											   usize start,
+											   CnxStringView pattern) {
+	return start + pattern.m_length <= haystack_length
+		   && 0 == memcmp(haystack + start, pattern.m_view, pattern.m_length);
+}
+
+static inline void
+	pattern_set_test_append(CnxString* string, const_cstring data, usize length) {
+	if(length != 0) {
+		cnx_string_append_cstring(string, data, length);
+	}
+}
+
+/// @brief Naive leftmost-longest search, for reference
+static inline bool pattern_set_test_naive_find(const_cstring haystack,
+											   usize haystack_length,
+											   usize start,
+											   const CnxStringView* patterns,
+											   usize num_patterns,
+											   CnxPatternMatch* match) {
+	for(let_mut position = start; position < haystack_length; ++position) {
+		let_mut found = false;
+		for(let_mut i = static_cast(usize)(0); i < num_patterns; ++i) {
+			if(pattern_set_test_matches_at(haystack, haystack_length, position, patterns[i])
+			   && (!found || patterns[i].m_length > match->m_length))
+			{
+				*match = (CnxPatternMatch){.m_pattern = i,
+										   .m_start = position,
+										   .m_length = patterns[i].m_length};
+				found = true;
+			}
+		}
+
+		if(found) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/// @brief Returns the index of the first pattern equal to `patterns[index]`
+static inline usize pattern_set_test_first_duplicate(const CnxStringView* patterns, usize index) {
+	for(let_mut i = static_cast(usize)(0); i < index; ++i) {
+		if(patterns[i].m_length == patterns[index].m_length
+		   && 0 == memcmp(patterns[i].m_view, patterns[index].m_view, patterns[i].m_length))
+		{
+			return i;
+		}
+	}
+	return index;
+}
+
+/// @brief Checks that `matcher` reports exactly every occurrence of every pattern, ordered by end
+/// position and then from longest to shortest
+static inline bool pattern_set_test_matcher_is_exhaustive(CnxPatternMatcher* matcher,
+														  const_cstring haystack,
+														  usize haystack_length,
+														  const CnxStringView* patterns,
+														  usize num_patterns) {
+	for(let_mut end = static_cast(usize)(1); end <= haystack_length; ++end) {
+		// patterns are at most 5 long in these tests
+		for(let_mut length = static_cast(usize)(5); length > 0; --length) {
+			for(let_mut i = static_cast(usize)(0); i < num_patterns; ++i) {
+				if(patterns[i].m_length != length || length > end
+				   || pattern_set_test_first_duplicate(patterns, i) != i
+				   || !pattern_set_test_matches_at(haystack,
+												   haystack_length,
+												   end - length,
+												   patterns[i]))
+				{
+					continue;
+				}
+
+				let_mut next = cnx_pattern_matcher_next(*matcher);
+				if(cnx_option_is_none(next)) {
+					return false;
+				}
+				let match = cnx_option_unwrap(next);
+				if(match.m_pattern != i || match.m_start != end - length
+				   || match.m_length != length) {
+					return false;
+				}
+			}
+		}
+	}
+
+	let_mut last = cnx_pattern_matcher_next(*matcher);
+	return cnx_option_is_none(last);
+}
+
+TEST(CnxPatternSet, find_first) {
+	let patterns = (CnxStringView[]){
+		cnx_stringview_from("he", 0, 2),
+		cnx_stringview_from("she", 0, 3),
+		cnx_stringview_from("his", 0, 3),
+		cnx_stringview_from("hers", 0, 4),
+	};
+	CnxScopedPatternSet set = cnx_pattern_set_new(patterns, 4);
+	TEST_ASSERT_EQUAL(cnx_pattern_set_size(set), static_cast(usize)(4));
+
+	let_mut found = cnx_pattern_set_find_first(set, "ushers");
+	TEST_ASSERT_TRUE(cnx_option_is_some(found));
+	let match = cnx_option_unwrap(found);
+	TEST_ASSERT_EQUAL(match.m_pattern, static_cast(usize)(1));
+	TEST_ASSERT_EQUAL(match.m_start, static_cast(usize)(1));
+	TEST_ASSERT_EQUAL(match.m_length, static_cast(usize)(3));
+
+	// the longest pattern starting at the leftmost position wins
+	found = cnx_pattern_set_find_first(set, "xxhersx");
+	TEST_ASSERT_TRUE(cnx_option_is_some(found));
+	TEST_ASSERT_EQUAL((cnx_option_unwrap(found)).m_pattern, static_cast(usize)(3));
+
+	found = cnx_pattern_set_find_first(set, "nothing to see");
+	TEST_ASSERT_TRUE(cnx_option_is_none(found));
+	found = cnx_pattern_set_find_first(set, "");
+	TEST_ASSERT_TRUE(cnx_option_is_none(found));
+
+	// a leftmost match that is only found after a longer, later-ending candidate
+	let overlapping = (CnxStringView[]){
+		cnx_stringview_from("bc", 0, 2),
+		cnx_stringview_from("abcdefg", 0, 7),
+	};
+	CnxScopedPatternSet overlapping_set = cnx_pattern_set_new(overlapping, 2);
+	found = cnx_pattern_set_find_first(overlapping_set, "xabcdefgx");
+	TEST_ASSERT_TRUE(cnx_option_is_some(found));
+	TEST_ASSERT_EQUAL((cnx_option_unwrap(found)).m_pattern, static_cast(usize)(1));
+	found = cnx_pattern_set_find_first(overlapping_set, "xabcdefx");
+	TEST_ASSERT_TRUE(cnx_option_is_some(found));
+	TEST_ASSERT_EQUAL((cnx_option_unwrap(found)).m_pattern, static_cast(usize)(0));
+
+	CnxScopedPatternSet empty_set = cnx_pattern_set_new(patterns, 0);
+	found = cnx_pattern_set_find_first(empty_set, "ushers");
+	TEST_ASSERT_TRUE(cnx_option_is_none(found));
+}
+
+TEST(CnxPatternSet, matcher) {
+	let patterns = (CnxStringView[]){
+		cnx_stringview_from("he", 0, 2),
+		cnx_stringview_from("she", 0, 3),
+		cnx_stringview_from("his", 0, 3),
+		cnx_stringview_from("hers", 0, 4),
+	};
+	CnxScopedPatternSet set = cnx_pattern_set_new(patterns, 4);
+	let haystack = "ushers and his sheep";
+	CnxScopedPatternMatcher matcher = cnx_pattern_matcher_new(set, haystack);
+	TEST_ASSERT_TRUE(
+		pattern_set_test_matcher_is_exhaustive(&matcher, haystack, strlen(haystack), patterns, 4));
+	let status = cnx_pattern_matcher_status(matcher);
+	TEST_ASSERT_TRUE(cnx_result_is_ok(status));
+}
+
+TEST(CnxPatternSet, matches_naive_search) {
+	char haystack[PATTERN_SET_TEST_HAYSTACK_SIZE + 1] = {0};
+	char pattern_storage[PATTERN_SET_TEST_NUM_PATTERNS][6] = {0};
+	CnxStringView patterns[PATTERN_SET_TEST_NUM_PATTERNS];
+
+	// a small alphabet produces many overlapping matches and shared prefixes and suffixes
+	let_mut state = static_cast(u32)(2024);
+	for(let_mut i = static_cast(usize)(0); i < PATTERN_SET_TEST_HAYSTACK_SIZE; ++i) {
+		state = state * 1103515245U + 12345U;
+		haystack[i] = static_cast(char)('a' + (state >> 16U) % 3U);
+	}
+
+	for(let_mut round = 0; round < 20; ++round) {
+		for(let_mut i = static_cast(usize)(0); i < PATTERN_SET_TEST_NUM_PATTERNS; ++i) {
+			state = state * 1103515245U + 12345U;
+			let length = static_cast(usize)(1U + (state >> 16U) % 5U);
+			for(let_mut j = static_cast(usize)(0); j < length; ++j) {
+				state = state * 1103515245U + 12345U;
+				// rarely use a byte that doesn't occur in the haystack
+				let byte = (state >> 16U) % 16U;
+				pattern_storage[i][j] = static_cast(char)(byte == 15U ? 'z' : 'a' + byte % 3U);
+			}
+			pattern_storage[i][length] = 0;
+			patterns[i] = cnx_stringview_from(pattern_storage[i], 0, length);
+		}
+		let num_patterns = static_cast(usize)(1 + round % PATTERN_SET_TEST_NUM_PATTERNS);
+
+		CnxScopedPatternSet set = cnx_pattern_set_new(patterns, num_patterns);
+
+		// every occurrence
+		CnxScopedPatternMatcher matcher
+			= cnx_pattern_matcher_new_cstring(&set, haystack, PATTERN_SET_TEST_HAYSTACK_SIZE);
+		TEST_ASSERT_TRUE(pattern_set_test_matcher_is_exhaustive(&matcher,
+																haystack,
+																PATTERN_SET_TEST_HAYSTACK_SIZE,
+																patterns,
+																num_patterns));
+
+		// leftmost-longest, non-overlapping, via replacement
+		let replacements = (CnxStringView[]){
+			cnx_stringview_from("<0>", 0, 3),
+			cnx_stringview_from("<1>", 0, 3),
+			cnx_stringview_from("", 0, 0),
+			cnx_stringview_from("<3>", 0, 3),
+			cnx_stringview_from("<4>", 0, 3),
+			cnx_stringview_from("<5>", 0, 3),
+			cnx_stringview_from("<6>", 0, 3),
+			cnx_stringview_from("a much longer replacement", 0, 25),
+			cnx_stringview_from("<8>", 0, 3),
+			cnx_stringview_from("<9>", 0, 3),
+			cnx_stringview_from("<10>", 0, 4),
+			cnx_stringview_from("<11>", 0, 4),
+		};
+		let view = cnx_stringview_from(haystack, 0, PATTERN_SET_TEST_HAYSTACK_SIZE);
+		CnxScopedString replaced = cnx_stringview_replace_all(view, set, replacements);
+
+		CnxScopedString expected = cnx_string_new();
+		let_mut position = static_cast(usize)(0);
+		CnxPatternMatch match = {0};
+		while(pattern_set_test_naive_find(haystack,
+										  PATTERN_SET_TEST_HAYSTACK_SIZE,
+										  position,
+										  patterns,
+										  num_patterns,
+										  &match))
+		{
+			match.m_pattern = pattern_set_test_first_duplicate(patterns, match.m_pattern);
+			let replacement = replacements[match.m_pattern];
+			pattern_set_test_append(&expected, haystack + position, match.m_start - position);
+			pattern_set_test_append(&expected, replacement.m_view, replacement.m_length);
+			position = match.m_start + match.m_length;
+		}
+		pattern_set_test_append(&expected,
+								haystack + position,
+								PATTERN_SET_TEST_HAYSTACK_SIZE - position);
+		TEST_ASSERT_TRUE(cnx_string_equal(replaced, &expected));
+	}
+}
+
+TEST(CnxPatternSet, replace_all) {
+	let patterns = (CnxStringView[]){
+		cnx_stringview_from("password=hunter2", 0, 16),
+		cnx_stringview_from("token=abc", 0, 9),
+		cnx_stringview_from("token=abcdef", 0, 12),
+	};
+	let replacements = (CnxStringView[]){
+		cnx_stringview_from("password=***", 0, 12),
+		cnx_stringview_from("token=***", 0, 9),
+		cnx_stringview_from("token=******", 0, 12),
+	};
+	CnxScopedPatternSet set = cnx_pattern_set_new(patterns, 3);
+
+	CnxScopedString line
+		= cnx_string_from("user=bob password=hunter2 token=abcdef token=abc password=hunter3");
+	CnxScopedString scrubbed = cnx_string_replace_all(line, set, replacements);
+	TEST_ASSERT_TRUE(cnx_string_equal(
+		scrubbed,
+		"user=bob password=*** token=****** token=*** password=hunter3"));
+
+	CnxScopedString untouched = cnx_string_from("nothing sensitive here");
+	CnxScopedString same = cnx_string_replace_all(untouched, set, replacements);
+	TEST_ASSERT_TRUE(cnx_string_equal(same, &untouched));
+}
+
+TEST(CnxPatternSet, file) {
+	char haystack[PATTERN_SET_TEST_HAYSTACK_SIZE];
+	let_mut state = static_cast(u32)(7);
+	for(let_mut i = static_cast(usize)(0); i < sizeof(haystack); ++i) {
+		state = state * 1103515245U + 12345U;
+		haystack[i] = static_cast(char)('a' + (state >> 16U) % 4U);
+	}
+	let patterns = (CnxStringView[]){
+		cnx_stringview_from("abc", 0, 3),
+		cnx_stringview_from("dd", 0, 2),
+		cnx_stringview_from("cabd", 0, 4),
+		cnx_stringview_from("b", 0, 1),
+	};
+	CnxScopedPatternSet set = cnx_pattern_set_new(patterns, 4);
+
+	CnxScopedString path = cnx_string_from("CnxPatternSetTest.txt");
+	{
+		let_mut maybe_file = cnx_file_open(&path);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(maybe_file));
+		CnxScopedFile file = cnx_result_unwrap(maybe_file);
+		let bytes = static_cast(const u8*)(static_cast(const void*)(haystack));
+		let_mut written = cnx_file_write_bytes(&file, bytes, sizeof(haystack));
+		TEST_ASSERT_TRUE(cnx_result_is_ok(written));
+		ignore(cnx_file_flush(&file));
+		ignore(cnx_file_seek(&file, 0, CnxFileSeekBegin));
+
+		// a small, odd buffer size places many matches across chunk boundaries
+		CnxScopedPatternMatcher matcher = cnx_pattern_matcher_from_file(&set, &file, 7);
+		TEST_ASSERT_TRUE(pattern_set_test_matcher_is_exhaustive(&matcher,
+																haystack,
+																sizeof(haystack),
+																patterns,
+																4));
+		let status = cnx_pattern_matcher_status(matcher);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(status));
+	}
+	ignore(cnx_path_remove_file(&path));
+}
+
+#endif // CNX_PATTERN_SET_TEST
@@ -0,0 +1,414 @@
+#ifndef CNX_REGEX_TEST
+#define CNX_REGEX_TEST
+
+#include <Cnx/Regex.h>
+
+#include "Criterion.h"
+#include "TestAllocator.h"
+
+#define REGEX_TEST_HAYSTACK_SIZE 24
+
+typedef struct RegexTestCase {
+	const_cstring m_pattern;
+	const_cstring m_haystack;
+	/// @brief The expected start of the first match, or -1 if there is none
+	i32 m_start;
+	i32 m_length;
+} RegexTestCase;
+
+static inline bool regex_test_check_find(const RegexTestCase* test_case) {
+	let_mut maybe_regex = cnx_regex_new(test_case->m_pattern);
+	if(cnx_result_is_err(maybe_regex)) {
+		return false;
+	}
+	CnxScopedRegex regex = cnx_result_unwrap(maybe_regex);
+
+	let haystack = cnx_stringview_from(test_case->m_haystack, 0, strlen(test_case->m_haystack));
+	let_mut found = cnx_regex_find(regex, haystack);
+	if(cnx_regex_is_match(regex, haystack) != cnx_option_is_some(found)) {
+		return false;
+	}
+	if(test_case->m_start < 0) {
+		return cnx_option_is_none(found);
+	}
+	if(cnx_option_is_none(found)) {
+		return false;
+	}
+
+	let match = cnx_option_unwrap(found);
+	return match.m_view == test_case->m_haystack + test_case->m_start
+		   && match.m_length == static_cast(usize)(test_case->m_length);
+}
+
+static inline bool regex_test_capture_equals(CnxOption(CnxStringView) capture,
+											 const_cstring expected) {
+	if(expected == nullptr) {
+		return cnx_option_is_none(capture);
+	}
+	if(cnx_option_is_none(capture)) {
+		return false;
+	}
+
+	let view = cnx_option_unwrap(capture);
+	return view.m_length == strlen(expected) && 0 == memcmp(view.m_view, expected, view.m_length);
+}
+
+static inline CnxRegexErrorTypes regex_test_compile_error(const_cstring pattern) {
+	let_mut maybe_regex = cnx_regex_new(pattern);
+	if(cnx_result_is_ok(maybe_regex)) {
+		let_mut regex = cnx_result_unwrap(maybe_regex);
+		cnx_regex_free(regex);
+		return CNX_REGEX_SUCCESS;
+	}
+
+	let error = cnx_result_unwrap_err(maybe_regex);
+	return static_cast(CnxRegexErrorTypes)(cnx_error_code(&error));
+}
+
+TEST(CnxRegex, find) {
+	const RegexTestCase cases[] = {
+		{"abc", "xxabcxx", 2, 3},
+		{"abc", "ababab", -1, 0},
+		{"a.c", "a\ncabc", 3, 3},
+		{"[a-c]+", "xyzbcaq", 3, 3},
+		{"[^a-c]+", "abcxyzab", 3, 3},
+		{"[]a]+", "b]a]c", 1, 3},
+		{"[a-]+", "b-a-c", 1, 3},
+		{"\\d+\\.\\d*", "v 12.5 13", 2, 4},
+		{"\\w+", "  foo_1 bar", 2, 5},
+		{"\\s+\\S", "ab \t\ncd", 2, 4},
+		{"[\\d\\s]+", "ab1 2c", 2, 3},
+		{"\\x41\\t", "zA\tB", 1, 2},
+		{"a\\*\\(\\)", "aa*()", 1, 4},
+		{"colou?r", "the color", 4, 5},
+		{"ab*", "xabbbc", 1, 4},
+		{"ab+", "xac abb", 4, 3},
+		{"a{3}", "aa aaaa", 3, 3},
+		{"a{2,}", "a aaaaa", 2, 5},
+		{"a{2,3}", "aaaaa", 0, 3},
+		{"a{,2}", "a{,2}", 0, 5},
+		{"a{x}", "a{x}", 0, 4},
+		{"x{0}y", "xy", 1, 1},
+		{"", "abc", 0, 0},
+		{"a*", "bbb", 0, 0},
+		{"(?:ab)+c", "abababc", 0, 7},
+	};
+
+	for(let_mut i = static_cast(usize)(0); i < sizeof(cases) / sizeof(cases[0]); ++i) {
+		TEST_ASSERT_TRUE(regex_test_check_find(&(cases[i])), "pattern \"%s\" on \"%s\"",
+						 cases[i].m_pattern,
+						 cases[i].m_haystack);
+	}
+}
+
+TEST(CnxRegex, alternation_and_laziness) {
+	const RegexTestCase cases[] = {
+		// leftmost-first: the first alternative that matches wins, not the longest
+		{"a|ab", "ab", 0, 1},
+		{"ab|a", "ab", 0, 2},
+		{"b|abc", "xabc", 1, 3},
+		{"cat|dog|bird", "a bird, a dog", 2, 4},
+		{"a(b|bc)d", "abcd", 0, 4},
+		{"<.*>", "<a><b>", 0, 6},
+		{"<.*?>", "<a><b>", 0, 3},
+		{"a+?", "aaa", 0, 1},
+		{"a??b", "ab", 0, 2},
+		{"a{2,4}?", "aaaa", 0, 2},
+		{"(a|b)*?c", "abac", 0, 4},
+		{"x*", "axx", 0, 0},
+	};
+
+	for(let_mut i = static_cast(usize)(0); i < sizeof(cases) / sizeof(cases[0]); ++i) {
+		TEST_ASSERT_TRUE(regex_test_check_find(&(cases[i])), "pattern \"%s\" on \"%s\"",
+						 cases[i].m_pattern,
+						 cases[i].m_haystack);
+	}
+}
+
+TEST(CnxRegex, anchors) {
+	const RegexTestCase cases[] = {
+		{"^abc", "abcabc", 0, 3},
+		{"^abc", "xabc", -1, 0},
+		{"abc$", "abcabc", 3, 3},
+		{"abc$", "abcx", -1, 0},
+		{"^$", "", 0, 0},
+		{"^$", "a", -1, 0},
+		{"^a*$", "aaaa", 0, 4},
+		{"^a*$", "aaba", -1, 0},
+		{"a|^b", "cb", -1, 0},
+		{"a$|b", "ab", 1, 1},
+		{"(^|x)y", "zxy", 1, 2},
+		{"$", "abc", 3, 0},
+	};
+
+	for(let_mut i = static_cast(usize)(0); i < sizeof(cases) / sizeof(cases[0]); ++i) {
+		TEST_ASSERT_TRUE(regex_test_check_find(&(cases[i])), "pattern \"%s\" on \"%s\"",
+						 cases[i].m_pattern,
+						 cases[i].m_haystack);
+	}
+
+	let_mut maybe_regex = cnx_regex_new("a+b");
+	CnxScopedRegex regex = cnx_result_unwrap(maybe_regex);
+	let full = cnx_stringview_from("aaab", 0, 4);
+	let partial = cnx_stringview_from("aaabc", 0, 5);
+	TEST_ASSERT_TRUE(cnx_regex_is_full_match(regex, full));
+	TEST_ASSERT_FALSE(cnx_regex_is_full_match(regex, partial));
+	TEST_ASSERT_TRUE(cnx_regex_is_match(regex, partial));
+}
+
+TEST(CnxRegex, captures) {
+	let_mut maybe_regex = cnx_regex_new("(\\w+)@(\\w+)(\\.com)?(x)?");
+	TEST_ASSERT_TRUE(cnx_result_is_ok(maybe_regex));
+	CnxScopedRegex regex = cnx_result_unwrap(maybe_regex);
+	TEST_ASSERT_EQUAL(cnx_regex_group_count(regex), static_cast(usize)(5));
+
+	CnxOption(CnxStringView) captures[6];
+	let haystack = cnx_stringview_from("mail: user@example.com!", 0, 23);
+	TEST_ASSERT_TRUE(cnx_regex_captures(regex, haystack, captures, 6));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[0], "user@example.com"));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[1], "user"));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[2], "example"));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[3], ".com"));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[4], nullptr));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[5], nullptr));
+
+	// fewer captures than groups
+	TEST_ASSERT_TRUE(cnx_regex_captures(regex, haystack, captures, 2));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[0], "user@example.com"));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[1], "user"));
+
+	let no_match = cnx_stringview_from("no at sign", 0, 10);
+	TEST_ASSERT_FALSE(cnx_regex_captures(regex, no_match, captures, 6));
+
+	// the last iteration of a repeated group is captured
+	let_mut maybe_repeated = cnx_regex_new("(?:(a)|(b))+");
+	CnxScopedRegex repeated = cnx_result_unwrap(maybe_repeated);
+	let abab = cnx_stringview_from("abab", 0, 4);
+	TEST_ASSERT_TRUE(cnx_regex_captures(repeated, abab, captures, 3));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[0], "abab"));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[1], "a"));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[2], "b"));
+
+	// an iteration that would match empty ends the loop rather than being retried, so this takes
+	// the lower priority non-empty iteration, as RE2 does, where Perl and PCRE match empty. The
+	// pattern is `(a??)*`, split to avoid forming a trigraph
+	let_mut maybe_lazy_loop = cnx_regex_new("(a?" "?)*");
+	CnxScopedRegex lazy_loop = cnx_result_unwrap(maybe_lazy_loop);
+	let a = cnx_stringview_from("a", 0, 1);
+	TEST_ASSERT_TRUE(cnx_regex_captures(lazy_loop, a, captures, 2));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[0], "a"));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[1], "a"));
+
+	let_mut maybe_nested = cnx_regex_new("((a)(b(c)))");
+	CnxScopedRegex nested = cnx_result_unwrap(maybe_nested);
+	let abc = cnx_stringview_from("xabc", 0, 4);
+	TEST_ASSERT_TRUE(cnx_regex_captures(nested, abc, captures, 5));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[1], "abc"));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[2], "a"));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[3], "bc"));
+	TEST_ASSERT_TRUE(regex_test_capture_equals(captures[4], "c"));
+}
+
+TEST(CnxRegex, find_all) {
+	let_mut maybe_regex = cnx_regex_new("ERROR: [0-9]+");
+	CnxScopedRegex regex = cnx_result_unwrap(maybe_regex);
+	// every match begins with the literal prefix "ERROR: ", so this exercises the prefilter
+	let data = "ok\nERROR: 12\nERROR: x\nwarn ERROR: 345\nERROR: ";
+	let haystack = cnx_stringview_from(data, 0, strlen(data));
+	let expected = (const_cstring[]){"ERROR: 12", "ERROR: 345"};
+
+	let_mut count = static_cast(usize)(0);
+	let_mut position = static_cast(usize)(0);
+	while(true) {
+		let_mut found = cnx_regex_find_at(regex, haystack, position);
+		if(cnx_option_is_none(found)) {
+			break;
+		}
+		TEST_ASSERT_TRUE(count < 2U);
+		TEST_ASSERT_TRUE(regex_test_capture_equals(found, expected[count]));
+		let match = cnx_option_unwrap(found);
+		position = static_cast(usize)(match.m_view - data) + match.m_length;
+		++count;
+	}
+	TEST_ASSERT_EQUAL(count, static_cast(usize)(2));
+
+	// `^` only matches at the beginning of the haystack, not of the search
+	let_mut maybe_anchored = cnx_regex_new("^a");
+	CnxScopedRegex anchored = cnx_result_unwrap(maybe_anchored);
+	let aa = cnx_stringview_from("aa", 0, 2);
+	let at_start = cnx_regex_find_at(anchored, aa, 0);
+	let after_start = cnx_regex_find_at(anchored, aa, 1);
+	TEST_ASSERT_TRUE(cnx_option_is_some(at_start));
+	TEST_ASSERT_TRUE(cnx_option_is_none(after_start));
+}
+
+TEST(CnxRegex, errors) {
+	TEST_ASSERT_EQUAL(regex_test_compile_error("(ab"), CNX_REGEX_UNMATCHED_PARENTHESIS);
+	TEST_ASSERT_EQUAL(regex_test_compile_error("ab)"), CNX_REGEX_UNMATCHED_PARENTHESIS);
+	TEST_ASSERT_EQUAL(regex_test_compile_error("[ab"), CNX_REGEX_UNCLOSED_CLASS);
+	TEST_ASSERT_EQUAL(regex_test_compile_error("[]"), CNX_REGEX_UNCLOSED_CLASS);
+	TEST_ASSERT_EQUAL(regex_test_compile_error("[z-a]"), CNX_REGEX_INVALID_RANGE);
+	TEST_ASSERT_EQUAL(regex_test_compile_error("[a-\\d]"), CNX_REGEX_INVALID_RANGE);
+	TEST_ASSERT_EQUAL(regex_test_compile_error("\\q"), CNX_REGEX_INVALID_ESCAPE);
+	TEST_ASSERT_EQUAL(regex_test_compile_error("\\x4"), CNX_REGEX_INVALID_ESCAPE);
+	TEST_ASSERT_EQUAL(regex_test_compile_error("ab\\"), CNX_REGEX_INVALID_ESCAPE);
+	TEST_ASSERT_EQUAL(regex_test_compile_error("*a"), CNX_REGEX_NOTHING_TO_REPEAT);
+	TEST_ASSERT_EQUAL(regex_test_compile_error("a|+"), CNX_REGEX_NOTHING_TO_REPEAT);
+	TEST_ASSERT_EQUAL(regex_test_compile_error("(?)"), CNX_REGEX_NOTHING_TO_REPEAT);
+	TEST_ASSERT_EQUAL(regex_test_compile_error("a{3,2}"), CNX_REGEX_INVALID_REPETITION);
+	TEST_ASSERT_EQUAL(regex_test_compile_error("a{1001}"), CNX_REGEX_TOO_LARGE);
+	TEST_ASSERT_EQUAL(regex_test_compile_error("(a{1000}){1000}"), CNX_REGEX_TOO_LARGE);
+
+	char deep[601] = {0};
+	for(let_mut i = 0; i < 300; ++i) {
+		deep[i] = '(';
+		deep[599 - i] = ')';
+	}
+	let deep_view = cnx_stringview_from(deep, 0, 600);
+	let_mut maybe_deep = cnx_regex_new(&deep_view);
+	TEST_ASSERT_TRUE(cnx_result_is_err(maybe_deep));
+
+	TEST_ASSERT_EQUAL(regex_test_compile_error("a{2}{3}b*?c+?"), CNX_REGEX_SUCCESS);
+	TEST_ASSERT_EQUAL(regex_test_compile_error("((((a))))|()"), CNX_REGEX_SUCCESS);
+}
+
+TEST(CnxRegex, cache_pressure) {
+	// the DFA for "an `a` followed by exactly 12 more bytes" has thousands of states, far more
+	// than fit in the cache, so it must be cleared and rebuilt (or fall back to the Pike VM)
+	let_mut maybe_regex = cnx_regex_new("^[ab]*a[ab]{12}$");
+	CnxScopedRegex regex = cnx_result_unwrap(maybe_regex);
+	let_mut maybe_unanchored = cnx_regex_new("a[ab]{12}");
+	CnxScopedRegex unanchored = cnx_result_unwrap(maybe_unanchored);
+
+	char haystack[4001] = {0};
+	let_mut state = static_cast(u32)(7);
+	for(let_mut round = 0; round < 8; ++round) {
+		let length = static_cast(usize)(500 * (round + 1));
+		for(let_mut i = static_cast(usize)(0); i < length; ++i) {
+			state = state * 1103515245U + 12345U;
+			haystack[i] = ((state >> 16U) & 1U) != 0 ? 'a' : 'b';
+		}
+		// alternate between whether the haystack should match
+		haystack[length - 13] = round % 2 == 0 ? 'a' : 'b';
+
+		let view = cnx_stringview_from(haystack, 0, length);
+		TEST_ASSERT_EQUAL(cnx_regex_is_match(regex, view), round % 2 == 0);
+		TEST_ASSERT_EQUAL(cnx_regex_is_full_match(regex, view), round % 2 == 0);
+		TEST_ASSERT_TRUE(cnx_regex_is_match(unanchored, view));
+		let_mut found = cnx_regex_find(unanchored, view);
+		TEST_ASSERT_TRUE(cnx_option_is_some(found));
+		let match = cnx_option_unwrap(found);
+		TEST_ASSERT_EQUAL(match.m_length, static_cast(usize)(13));
+		TEST_ASSERT_EQUAL(match.m_view, static_cast(const_cstring)(strchr(haystack, 'a')));
+	}
+}
+
+/// @brief Appends a random pattern, without anchors, over the alphabet `abc` to `pattern`
+// NOLINTNEXTLINE(misc-no-recursion)
+static inline void regex_test_random_pattern(CnxString* pattern, u32* state, i32 depth) {
+	*state = *state * 1103515245U + 12345U;
+	let num_atoms = 1U + (*state >> 16U) % 4U;
+	for(let_mut i = 0U; i < num_atoms; ++i) {
+		*state = *state * 1103515245U + 12345U;
+		let choice = (*state >> 16U) % 10U;
+		if(choice < 4U) {
+			cnx_string_push_back(*pattern, static_cast(char)('a' + choice % 3U));
+		}
+		else if(choice == 4U) {
+			cnx_string_push_back(*pattern, '.');
+		}
+		else if(choice == 5U) {
+			cnx_string_append(*pattern, "[ab]");
+		}
+		else if(choice == 6U) {
+			cnx_string_append(*pattern, "[^a]");
+		}
+		else if(depth > 0) {
+			cnx_string_push_back(*pattern, '(');
+			regex_test_random_pattern(pattern, state, depth - 1);
+			cnx_string_push_back(*pattern, '|');
+			regex_test_random_pattern(pattern, state, depth - 1);
+			cnx_string_push_back(*pattern, ')');
+		}
+		else {
+			cnx_string_push_back(*pattern, 'b');
+		}
+
+		*state = *state * 1103515245U + 12345U;
+		let quantifier = (*state >> 16U) % 12U;
+		let quantifiers = (const_cstring[]){"*", "+", "?", "{1,2}", "*?", "+?"};
+		if(quantifier < 6U) {
+			cnx_string_append(*pattern, quantifiers[quantifier]);
+		}
+	}
+}
+
+TEST(CnxRegex, engines_agree) {
+	// cross-checks the DFA (`cnx_regex_is_match`) and the unanchored Pike VM (`cnx_regex_find`)
+	// against a brute-force search built from the anchored Pike VM (`cnx_regex_is_full_match`)
+	char haystack[REGEX_TEST_HAYSTACK_SIZE + 1] = {0};
+	let_mut state = static_cast(u32)(1234);
+	for(let_mut round = 0; round < 300; ++round) {
+		CnxScopedString pattern = cnx_string_new();
+		regex_test_random_pattern(&pattern, &state, 2);
+		let_mut maybe_regex = cnx_regex_new(&pattern);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(maybe_regex), "pattern: %s",
+						 cnx_string_into_cstring(pattern));
+		CnxScopedRegex regex = cnx_result_unwrap(maybe_regex);
+
+		for(let_mut trial = 0; trial < 4; ++trial) {
+			state = state * 1103515245U + 12345U;
+			let length = static_cast(usize)((state >> 16U) % (REGEX_TEST_HAYSTACK_SIZE + 1U));
+			for(let_mut i = static_cast(usize)(0); i < length; ++i) {
+				state = state * 1103515245U + 12345U;
+				haystack[i] = static_cast(char)('a' + (state >> 16U) % 4U);
+			}
+			let view = cnx_stringview_from(haystack, 0, length);
+
+			// the leftmost start of any match, and the ends of matches beginning there
+			let_mut expected_start = -1;
+			for(let_mut start = static_cast(usize)(0); start <= length && expected_start < 0;
+				++start)
+			{
+				for(let_mut end = start; end <= length; ++end) {
+					let sub = cnx_stringview_from(haystack, start, end - start);
+					if(cnx_regex_is_full_match(regex, sub)) {
+						expected_start = static_cast(i32)(start);
+						break;
+					}
+				}
+			}
+
+			let_mut found = cnx_regex_find(regex, view);
+			TEST_ASSERT_EQUAL(cnx_regex_is_match(regex, view), expected_start >= 0);
+			TEST_ASSERT_EQUAL(cnx_option_is_some(found), expected_start >= 0);
+			if(expected_start >= 0) {
+				let match = cnx_option_unwrap(found);
+				TEST_ASSERT_EQUAL(match.m_view,
+								  static_cast(const_cstring)(haystack + expected_start));
+				TEST_ASSERT_TRUE(cnx_regex_is_full_match(regex, match));
+			}
+		}
+	}
+}
+
+TEST(CnxRegex, allocator) {
+	let allocator = test_allocator_new();
+	{
+		let_mut maybe_regex = cnx_regex_new_with_allocator("(a+)(b*)c", allocator);
+		CnxScopedRegex regex = cnx_result_unwrap(maybe_regex);
+		let haystack = cnx_stringview_from("xxaabbc", 0, 7);
+		let allocations = test_allocator_total_allocations;
+		CnxOption(CnxStringView) captures[3];
+		TEST_ASSERT_TRUE(cnx_regex_captures(regex, haystack, captures, 3));
+		TEST_ASSERT_TRUE(cnx_regex_is_match(regex, haystack));
+		// matching never allocates, not even temporarily
+		TEST_ASSERT_EQUAL(test_allocator_total_allocations, allocations);
+
+		let_mut maybe_invalid = cnx_regex_new_with_allocator("(a", allocator);
+		TEST_ASSERT_TRUE(cnx_result_is_err(maybe_invalid));
+	}
+	TEST_ASSERT_EQUAL(test_allocator_live_allocations, static_cast(usize)(0));
+}
+
+#endif // CNX_REGEX_TEST
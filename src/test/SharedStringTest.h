@@ -0,0 +1,150 @@
+#ifndef CNX_SHARED_STRING_TEST
+#define CNX_SHARED_STRING_TEST
+
+#include <Cnx/Allocators.h>
+#include <Cnx/SharedString.h>
+#include <Cnx/Thread.h>
+
+#include "Criterion.h"
+#include "TestAllocator.h"
+
+#define SHARED_STRING_TEST_NUM_CLONES 10000
+
+TEST(CnxSharedString, new_and_from) {
+	CnxScopedSharedString empty = cnx_shared_string_new();
+	TEST_ASSERT_TRUE(cnx_shared_string_is_empty(empty));
+	TEST_ASSERT_EQUAL(cnx_shared_string_ref_count(empty), 0U);
+	TEST_ASSERT_TRUE(cnx_shared_string_equal(empty, ""));
+
+	CnxScopedSharedString string = cnx_shared_string_from("Hello, world!");
+	TEST_ASSERT_EQUAL(cnx_shared_string_length(string), 13U);
+	TEST_ASSERT_EQUAL(cnx_shared_string_ref_count(string), 1U);
+	TEST_ASSERT_EQUAL(cnx_shared_string_at(string, 7), 'w');
+	TEST_ASSERT_TRUE(cnx_shared_string_equal(string, "Hello, world!"));
+	TEST_ASSERT_FALSE(cnx_shared_string_equal(string, "Hello, world"));
+	// a full string is always null-terminated
+	TEST_ASSERT_EQUAL(strcmp(cnx_shared_string_data(string), "Hello, world!"), 0);
+
+	TEST_ASSERT_LESS_THAN(cnx_shared_string_compare(string, "Hello, xorld!"), 0);
+	TEST_ASSERT_GREATER_THAN(cnx_shared_string_compare(string, "Hello"), 0);
+	TEST_ASSERT_EQUAL(cnx_shared_string_compare(string, &string), 0);
+}
+
+TEST(CnxSharedString, clone) {
+	CnxScopedSharedString string = cnx_shared_string_from("a string long enough to not be inline");
+	{
+		CnxScopedSharedString clone = cnx_shared_string_clone(string);
+		// clones share the same characters, rather than copying them
+		TEST_ASSERT_EQUAL(cnx_shared_string_data(clone), cnx_shared_string_data(string));
+		TEST_ASSERT_EQUAL(cnx_shared_string_ref_count(string), 2U);
+		TEST_ASSERT_TRUE(cnx_shared_string_equal(clone, &string));
+	}
+	TEST_ASSERT_EQUAL(cnx_shared_string_ref_count(string), 1U);
+
+	CnxScopedSharedString empty = cnx_shared_string_new();
+	CnxScopedSharedString empty_clone = cnx_shared_string_clone(empty);
+	TEST_ASSERT_TRUE(cnx_shared_string_is_empty(empty_clone));
+	TEST_ASSERT_EQUAL(cnx_shared_string_ref_count(empty_clone), 0U);
+}
+
+TEST(CnxSharedString, substring) {
+	let_mut url = cnx_shared_string_from("https://example.com/index.html");
+	CnxScopedSharedString host = cnx_shared_string_substring(url, 8, 11);
+	TEST_ASSERT_TRUE(cnx_shared_string_equal(host, "example.com"));
+	TEST_ASSERT_EQUAL(cnx_shared_string_data(host), cnx_shared_string_data(url) + 8);
+	TEST_ASSERT_EQUAL(cnx_shared_string_ref_count(url), 2U);
+
+	CnxScopedSharedString nested = cnx_shared_string_substring(host, 8, 3);
+	TEST_ASSERT_TRUE(cnx_shared_string_equal(nested, "com"));
+	TEST_ASSERT_EQUAL(cnx_shared_string_ref_count(url), 3U);
+
+	CnxScopedSharedString empty = cnx_shared_string_substring(url, 30, 0);
+	TEST_ASSERT_TRUE(cnx_shared_string_is_empty(empty));
+	TEST_ASSERT_EQUAL(cnx_shared_string_ref_count(url), 3U);
+
+	// substrings keep the original characters alive
+	cnx_shared_string_free(url);
+	TEST_ASSERT_TRUE(cnx_shared_string_is_empty(url));
+	TEST_ASSERT_EQUAL(cnx_shared_string_ref_count(host), 2U);
+	TEST_ASSERT_TRUE(cnx_shared_string_equal(host, "example.com"));
+	TEST_ASSERT_TRUE(cnx_shared_string_equal(nested, "com"));
+}
+
+TEST(CnxSharedString, conversions) {
+	CnxScopedString string = cnx_string_from("a CnxString to share with some other owners");
+	CnxScopedSharedString shared = cnx_shared_string_from_string(string);
+	TEST_ASSERT_TRUE(cnx_shared_string_equal(shared, &string));
+
+	CnxScopedSharedString word = cnx_shared_string_substring(shared, 2, 9);
+	let view = cnx_shared_string_into_stringview(word);
+	TEST_ASSERT_EQUAL(cnx_stringview_length(view), 9U);
+	TEST_ASSERT_TRUE(cnx_stringview_equal(view, "CnxString"));
+	TEST_ASSERT_TRUE(cnx_shared_string_equal(word, &view));
+
+	CnxScopedString copy = cnx_shared_string_into_string(word);
+	TEST_ASSERT_TRUE(cnx_string_equal(copy, "CnxString"));
+	// the copy is null-terminated, even though the substring isn't
+	TEST_ASSERT_EQUAL(strcmp(cnx_string_into_cstring(copy), "CnxString"), 0);
+
+	CnxScopedSharedString from_view = cnx_shared_string_from(&view);
+	TEST_ASSERT_TRUE(cnx_shared_string_equal(from_view, "CnxString"));
+	TEST_ASSERT_NOT_EQUAL(cnx_shared_string_data(from_view), cnx_shared_string_data(word));
+}
+
+TEST(CnxSharedString, allocator) {
+	let allocator = test_allocator_new();
+	{
+		CnxScopedSharedString string
+			= cnx_shared_string_from_with_allocator("allocated exactly once", allocator);
+		TEST_ASSERT_EQUAL(test_allocator_total_allocations, 1U);
+
+		for(let_mut i = 0; i < 100; ++i) {
+			CnxScopedSharedString clone = cnx_shared_string_clone(string);
+			CnxScopedSharedString substring = cnx_shared_string_substring(clone, 10, 7);
+			TEST_ASSERT_TRUE(cnx_shared_string_equal(substring, "exactly"));
+		}
+		TEST_ASSERT_EQUAL(test_allocator_total_allocations, 1U);
+		TEST_ASSERT_EQUAL(test_allocator_live_allocations, 1U);
+
+		// copies out use the same allocator
+		CnxScopedString copy = cnx_shared_string_into_string(string);
+		TEST_ASSERT_TRUE(cnx_string_equal(copy, "allocated exactly once"));
+	}
+	TEST_ASSERT_EQUAL(test_allocator_live_allocations, 0U);
+}
+
+void LambdaFunction(shared_string_test_clone_and_free) {
+	let binding = lambda_binding(CnxSharedString*);
+	for(let_mut i = 0; i < SHARED_STRING_TEST_NUM_CLONES; ++i) {
+		CnxScopedSharedString clone = cnx_shared_string_clone(*(binding._1));
+		CnxScopedSharedString substring = cnx_shared_string_substring(clone, 2, 6);
+		cnx_assert(cnx_shared_string_equal(substring, "shared"), "substring should be 'shared'");
+	}
+}
+
+TEST(CnxSharedString, concurrent) {
+	let_mut string = cnx_shared_string_from("a shared string, used from many threads");
+
+	// add a new scope so the threads get joined before our final asserts
+	{
+		let_mut res = cnx_thread_new(
+			lambda_cast(lambda(shared_string_test_clone_and_free, &string), CnxThreadLambda));
+		TEST_ASSERT_TRUE(cnx_result_is_ok(res));
+		__attr(maybe_unused) CnxScopedThread thread = cnx_result_unwrap(res);
+
+		let_mut res2 = cnx_thread_new(
+			lambda_cast(lambda(shared_string_test_clone_and_free, &string), CnxThreadLambda));
+		TEST_ASSERT_TRUE(cnx_result_is_ok(res2));
+		__attr(maybe_unused) CnxScopedThread thread2 = cnx_result_unwrap(res2);
+
+		for(let_mut i = 0; i < SHARED_STRING_TEST_NUM_CLONES; ++i) {
+			CnxScopedSharedString clone = cnx_shared_string_clone(string);
+			TEST_ASSERT_EQUAL(cnx_shared_string_length(clone), cnx_shared_string_length(string));
+		}
+	}
+
+	TEST_ASSERT_EQUAL(cnx_shared_string_ref_count(string), 1U);
+	cnx_shared_string_free(string);
+}
+
+#endif // CNX_SHARED_STRING_TEST
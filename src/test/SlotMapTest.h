@@ -0,0 +1,124 @@
+#ifndef CNX_SLOT_MAP_TEST
+#define CNX_SLOT_MAP_TEST
+
+#include <Cnx/Def.h>
+
+#define SLOT_MAP_T			  i32
+#define SLOT_MAP_DECL		  TRUE
+#define SLOT_MAP_IMPL		  TRUE
+#define SLOT_MAP_UNDEF_PARAMS TRUE
+#include <Cnx/SlotMap.h>
+
+#include "Criterion.h"
+
+#define SLOT_MAP_TEST_SIZE 1000
+
+TEST(CnxSlotMap, insert_and_get) {
+	CnxScopedSlotMap(i32) map = cnx_slot_map_new(i32);
+	TEST_ASSERT_TRUE(cnx_slot_map_is_empty(map));
+	TEST_ASSERT_EQUAL(cnx_slot_map_get(map, CNX_SLOT_MAP_NULL_HANDLE), nullptr);
+
+	CnxSlotMapHandle handles[SLOT_MAP_TEST_SIZE];
+	for(let_mut i = 0; i < SLOT_MAP_TEST_SIZE; ++i) {
+		handles[i] = cnx_slot_map_insert(map, i);
+	}
+
+	TEST_ASSERT_EQUAL(cnx_slot_map_size(map), static_cast(usize)(SLOT_MAP_TEST_SIZE));
+	for(let_mut i = 0; i < SLOT_MAP_TEST_SIZE; ++i) {
+		TEST_ASSERT_TRUE(cnx_slot_map_contains(map, handles[i]));
+		TEST_ASSERT_EQUAL(cnx_slot_map_at(map, handles[i]), i);
+	}
+	TEST_ASSERT_FALSE(cnx_slot_map_contains(map, CNX_SLOT_MAP_NULL_HANDLE));
+
+	cnx_slot_map_at_mut(map, handles[10]) = 42;
+	TEST_ASSERT_EQUAL(*cnx_slot_map_get(map, handles[10]), 42);
+}
+
+TEST(CnxSlotMap, erase_and_stale_handles) {
+	CnxScopedSlotMap(i32) map = cnx_slot_map_new(i32);
+	CnxSlotMapHandle handles[SLOT_MAP_TEST_SIZE];
+	for(let_mut i = 0; i < SLOT_MAP_TEST_SIZE; ++i) {
+		handles[i] = cnx_slot_map_insert(map, i);
+	}
+
+	for(let_mut i = 0; i < SLOT_MAP_TEST_SIZE; i += 2) {
+		TEST_ASSERT_TRUE(cnx_slot_map_erase(map, handles[i]));
+	}
+	TEST_ASSERT_FALSE(cnx_slot_map_erase(map, handles[0]));
+	TEST_ASSERT_EQUAL(cnx_slot_map_size(map), static_cast(usize)(SLOT_MAP_TEST_SIZE / 2));
+
+	// removal must not disturb the elements referred to by the remaining handles
+	for(let_mut i = 0; i < SLOT_MAP_TEST_SIZE; ++i) {
+		if(i % 2 == 0) {
+			TEST_ASSERT_EQUAL(cnx_slot_map_get(map, handles[i]), nullptr);
+		}
+		else {
+			TEST_ASSERT_EQUAL(cnx_slot_map_at(map, handles[i]), i);
+		}
+	}
+
+	// freed slots are reused, but handles to their previous occupants stay stale
+	let reused = cnx_slot_map_insert(map, -1);
+	TEST_ASSERT_TRUE(reused.m_index < SLOT_MAP_TEST_SIZE);
+	TEST_ASSERT_EQUAL(cnx_slot_map_at(map, reused), -1);
+	for(let_mut i = 0; i < SLOT_MAP_TEST_SIZE; i += 2) {
+		TEST_ASSERT_FALSE(cnx_slot_map_contains(map, handles[i]));
+	}
+	TEST_ASSERT_EQUAL(cnx_slot_map_size(map), static_cast(usize)(SLOT_MAP_TEST_SIZE / 2 + 1));
+}
+
+TEST(CnxSlotMap, dense_iteration) {
+	CnxScopedSlotMap(i32) map = cnx_slot_map_new_with_capacity(i32, SLOT_MAP_TEST_SIZE);
+	TEST_ASSERT_GREATER_THAN_OR_EQUAL(cnx_slot_map_capacity(map),
+									  static_cast(usize)(SLOT_MAP_TEST_SIZE));
+	CnxSlotMapHandle handles[SLOT_MAP_TEST_SIZE];
+	for(let_mut i = 0; i < SLOT_MAP_TEST_SIZE; ++i) {
+		handles[i] = cnx_slot_map_insert(map, i);
+	}
+	for(let_mut i = 0; i < SLOT_MAP_TEST_SIZE; i += 3) {
+		ignore(cnx_slot_map_erase(map, handles[i]));
+	}
+
+	let_mut sum = 0;
+	let_mut expected_sum = 0;
+	for(let_mut i = 0; i < SLOT_MAP_TEST_SIZE; ++i) {
+		expected_sum += i % 3 == 0 ? 0 : i;
+	}
+	let_mut count = 0U;
+	foreach(elem, map) {
+		sum += elem;
+		// the handle recovered from the dense position must refer back to the same element
+		let handle = cnx_slot_map_handle_at(map, count);
+		TEST_ASSERT_EQUAL(cnx_slot_map_at(map, handle), elem);
+		TEST_ASSERT_EQUAL(cnx_slot_map_data(map)[count], elem);
+		++count;
+	}
+	TEST_ASSERT_EQUAL(count, cnx_slot_map_size(map));
+	TEST_ASSERT_EQUAL(sum, expected_sum);
+}
+
+TEST(CnxSlotMap, clone_and_clear) {
+	CnxScopedSlotMap(i32) map = cnx_slot_map_new(i32);
+	CnxSlotMapHandle handles[SLOT_MAP_TEST_SIZE];
+	for(let_mut i = 0; i < SLOT_MAP_TEST_SIZE; ++i) {
+		handles[i] = cnx_slot_map_insert(map, i);
+	}
+	ignore(cnx_slot_map_erase(map, handles[5]));
+
+	CnxScopedSlotMap(i32) cloned = cnx_slot_map_clone(map);
+	TEST_ASSERT_EQUAL(cnx_slot_map_size(cloned), cnx_slot_map_size(map));
+	for(let_mut i = 0; i < SLOT_MAP_TEST_SIZE; ++i) {
+		TEST_ASSERT_EQUAL(cnx_slot_map_contains(cloned, handles[i]), i != 5);
+	}
+
+	cnx_slot_map_clear(map);
+	TEST_ASSERT_TRUE(cnx_slot_map_is_empty(map));
+	TEST_ASSERT_FALSE(cnx_slot_map_contains(map, handles[1]));
+	TEST_ASSERT_EQUAL(cnx_slot_map_at(cloned, handles[1]), 1);
+
+	let handle = cnx_slot_map_insert(map, 7);
+	TEST_ASSERT_EQUAL(cnx_slot_map_at(map, handle), 7);
+	TEST_ASSERT_FALSE(cnx_slot_map_contains(map, handles[handle.m_index]));
+}
+
+#endif // CNX_SLOT_MAP_TEST
@@ -0,0 +1,111 @@
+#ifndef CNX_SOA_TEST
+#define CNX_SOA_TEST
+
+#include <Cnx/Def.h>
+
+#define SOA_T			 SoATestParticle
+#define SOA_FIELDS		 (f32, x), (f64, y), (u8, flags), (i32, id)
+#define SOA_DECL		 TRUE
+#define SOA_IMPL		 TRUE
+#define SOA_UNDEF_PARAMS TRUE
+#include <Cnx/SoA.h>
+
+#include "Criterion.h"
+
+#define SOA_TEST_SIZE 1000
+
+static inline SoATestParticle soa_test_particle(i32 index) {
+	return (SoATestParticle){.x = static_cast(f32)(index),
+							 .y = static_cast(f64)(index) * 2.0,
+							 .flags = static_cast(u8)(index % 256),
+							 .id = index};
+}
+
+static inline bool soa_test_particle_matches(SoATestParticle particle, i32 index) {
+	let expected = soa_test_particle(index);
+	return particle.x == expected.x && particle.y == expected.y
+		   && particle.flags == expected.flags && particle.id == expected.id;
+}
+
+TEST(CnxSoA, push_back_and_get) {
+	CnxScopedSoA(SoATestParticle) soa = cnx_soa_new(SoATestParticle);
+	TEST_ASSERT_TRUE(cnx_soa_is_empty(soa));
+
+	for(let_mut i = 0; i < SOA_TEST_SIZE; ++i) {
+		cnx_soa_push_back(soa, soa_test_particle(i));
+	}
+
+	TEST_ASSERT_EQUAL(cnx_soa_size(soa), static_cast(usize)(SOA_TEST_SIZE));
+	TEST_ASSERT_GREATER_THAN_OR_EQUAL(cnx_soa_capacity(soa), static_cast(usize)(SOA_TEST_SIZE));
+	for(let_mut i = 0; i < SOA_TEST_SIZE; ++i) {
+		TEST_ASSERT_TRUE(soa_test_particle_matches(cnx_soa_get(soa, static_cast(usize)(i)), i));
+		TEST_ASSERT_EQUAL(cnx_soa_at(soa, id, static_cast(usize)(i)), i);
+	}
+
+	cnx_soa_at(soa, id, 10U) = -1;
+	TEST_ASSERT_EQUAL(cnx_soa_get(soa, 10U).id, -1);
+	cnx_soa_set(soa, 10U, soa_test_particle(10));
+	TEST_ASSERT_TRUE(soa_test_particle_matches(cnx_soa_get(soa, 10U), 10));
+}
+
+TEST(CnxSoA, columns_are_aligned_spans) {
+	CnxScopedSoA(SoATestParticle) soa = cnx_soa_new_with_capacity(SoATestParticle, 37U);
+	for(let_mut i = 0; i < SOA_TEST_SIZE; ++i) {
+		cnx_soa_push_back(soa, soa_test_particle(i));
+	}
+
+	TEST_ASSERT_EQUAL(static_cast(usize)(cnx_soa_column(soa, x)) % CNX_SOA_COLUMN_ALIGNMENT, 0U);
+	TEST_ASSERT_EQUAL(static_cast(usize)(cnx_soa_column(soa, y)) % CNX_SOA_COLUMN_ALIGNMENT, 0U);
+	TEST_ASSERT_EQUAL(static_cast(usize)(cnx_soa_column(soa, flags)) % CNX_SOA_COLUMN_ALIGNMENT,
+					  0U);
+	TEST_ASSERT_EQUAL(static_cast(usize)(cnx_soa_column(soa, id)) % CNX_SOA_COLUMN_ALIGNMENT, 0U);
+
+	let ids = cnx_soa_column_span(SoATestParticle, soa, id);
+	TEST_ASSERT_EQUAL(ids.m_size, static_cast(usize)(SOA_TEST_SIZE));
+	let_mut sum = 0;
+	for(let_mut i = 0U; i < ids.m_size; ++i) {
+		sum += ids.m_data[i];
+	}
+	TEST_ASSERT_EQUAL(sum, (SOA_TEST_SIZE - 1) * SOA_TEST_SIZE / 2);
+}
+
+TEST(CnxSoA, insert_and_erase) {
+	CnxScopedSoA(SoATestParticle) soa = cnx_soa_new(SoATestParticle);
+	for(let_mut i = 0; i < 10; ++i) {
+		cnx_soa_push_back(soa, soa_test_particle(i * 2));
+	}
+	for(let_mut i = 0; i < 9; ++i) {
+		cnx_soa_insert(soa, soa_test_particle(i * 2 + 1), static_cast(usize)(i * 2 + 1));
+	}
+
+	TEST_ASSERT_EQUAL(cnx_soa_size(soa), 19U);
+	for(let_mut i = 0; i < 19; ++i) {
+		TEST_ASSERT_TRUE(soa_test_particle_matches(cnx_soa_get(soa, static_cast(usize)(i)), i));
+	}
+
+	cnx_soa_erase(soa, 0U);
+	cnx_soa_erase(soa, 17U);
+	cnx_soa_erase(soa, 5U);
+	TEST_ASSERT_EQUAL(cnx_soa_size(soa), 16U);
+	TEST_ASSERT_TRUE(soa_test_particle_matches(cnx_soa_get(soa, 0U), 1));
+	TEST_ASSERT_TRUE(soa_test_particle_matches(cnx_soa_get(soa, 4U), 5));
+	TEST_ASSERT_TRUE(soa_test_particle_matches(cnx_soa_get(soa, 5U), 7));
+	TEST_ASSERT_TRUE(soa_test_particle_matches(cnx_soa_get(soa, 15U), 17));
+}
+
+TEST(CnxSoA, resize_and_clone) {
+	CnxScopedSoA(SoATestParticle) soa = cnx_soa_new(SoATestParticle);
+	cnx_soa_push_back(soa, soa_test_particle(1));
+	cnx_soa_resize(soa, 100U);
+	TEST_ASSERT_EQUAL(cnx_soa_size(soa), 100U);
+	TEST_ASSERT_TRUE(soa_test_particle_matches(cnx_soa_get(soa, 0U), 1));
+	TEST_ASSERT_TRUE(soa_test_particle_matches(cnx_soa_get(soa, 99U), 0));
+
+	CnxScopedSoA(SoATestParticle) cloned = cnx_soa_clone(soa);
+	cnx_soa_clear(soa);
+	TEST_ASSERT_TRUE(cnx_soa_is_empty(soa));
+	TEST_ASSERT_EQUAL(cnx_soa_size(cloned), 100U);
+	TEST_ASSERT_TRUE(soa_test_particle_matches(cnx_soa_get(cloned, 0U), 1));
+}
+
+#endif // CNX_SOA_TEST
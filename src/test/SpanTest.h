@@ -0,0 +1,81 @@
+#ifndef CNX_SPAN_TEST
+#define CNX_SPAN_TEST
+
+#include <Cnx/Span.h>
+
+#define VECTOR_INCLUDE_DEFAULT_INSTANTIATIONS TRUE
+#include <Cnx/Vector.h>
+#undef VECTOR_INCLUDE_DEFAULT_INSTANTIATIONS
+
+#include "Criterion.h"
+
+TEST(CnxSpan, from_array) {
+	i32 array[] = {1, 2, 3, 4, 5, 6, 7, 8};
+	let span = cnx_span_from_array(i32, array);
+	TEST_ASSERT_EQUAL(cnx_span_size(span), 8U);
+	TEST_ASSERT_FALSE(cnx_span_is_empty(span));
+	TEST_ASSERT_EQUAL(cnx_span_data(span), &array[0]);
+
+	let_mut sum = 0;
+	foreach_span(value, span) {
+		sum += value;
+	}
+	TEST_ASSERT_EQUAL(sum, 36);
+
+	cnx_span_at(span, 3) = 10;
+	TEST_ASSERT_EQUAL(array[3], 10);
+
+	foreach_span_ref_mut(value, span) {
+		*value *= 2;
+	}
+	let_mut index = 0;
+	foreach_span_ref(value, span) {
+		TEST_ASSERT_EQUAL(value, &array[index]);
+		++index;
+	}
+	TEST_ASSERT_EQUAL(array[0], 2);
+	TEST_ASSERT_EQUAL(array[3], 20);
+}
+
+TEST(CnxSpan, subspans) {
+	i32 array[] = {1, 2, 3, 4, 5, 6, 7, 8};
+	let span = cnx_span_from_array(i32, array);
+
+	let middle = cnx_span_subspan(span, 2, 3);
+	TEST_ASSERT_EQUAL(cnx_span_size(middle), 3U);
+	TEST_ASSERT_EQUAL(cnx_span_at(middle, 0), 3);
+	TEST_ASSERT_EQUAL(cnx_span_at(middle, 2), 5);
+
+	let first = cnx_span_first(span, 2);
+	TEST_ASSERT_EQUAL(cnx_span_size(first), 2U);
+	TEST_ASSERT_EQUAL(cnx_span_at(first, 1), 2);
+
+	let last = cnx_span_last(span, 3);
+	TEST_ASSERT_EQUAL(cnx_span_size(last), 3U);
+	TEST_ASSERT_EQUAL(cnx_span_at(last, 0), 6);
+
+	let empty = cnx_span_last(span, 0);
+	TEST_ASSERT_TRUE(cnx_span_is_empty(empty));
+	foreach_span(value, empty) {
+		ignore(value);
+		TEST_ASSERT(false);
+	}
+}
+
+TEST(CnxSpan, from_vector) {
+	CnxScopedVector(i32) vec = cnx_vector_new(i32);
+	for(let_mut i = 0; i < 100; ++i) {
+		cnx_vector_push_back(vec, i);
+	}
+
+	let span = cnx_vector_as_span(i32, vec);
+	TEST_ASSERT_EQUAL(cnx_span_size(span), cnx_vector_size(vec));
+	let_mut expected = 0;
+	foreach_span(value, span) {
+		TEST_ASSERT_EQUAL(value, expected);
+		++expected;
+	}
+	TEST_ASSERT_EQUAL(expected, 100);
+}
+
+#endif // CNX_SPAN_TEST
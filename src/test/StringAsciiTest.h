@@ -0,0 +1,88 @@
+#ifndef CNX_STRING_ASCII_TEST
+#define CNX_STRING_ASCII_TEST
+
+#include <Cnx/StringAscii.h>
+
+#include "Criterion.h"
+
+TEST(CnxStringAscii, trim) {
+	CnxScopedString string = cnx_string_from(" \t\r\n  Content-Length: 42 \v\f ");
+	let trimmed = cnx_string_trim(string);
+	TEST_ASSERT_TRUE(cnx_stringview_equal(trimmed, "Content-Length: 42"));
+	let start = cnx_string_trim_start(string);
+	TEST_ASSERT_TRUE(cnx_stringview_equal(start, "Content-Length: 42 \v\f "));
+	let end = cnx_string_trim_end(string);
+	TEST_ASSERT_TRUE(cnx_stringview_equal(end, " \t\r\n  Content-Length: 42"));
+
+	// trimming returns views into the original string
+	TEST_ASSERT_EQUAL(trimmed.m_view, cnx_string_data(string) + 6);
+
+	let view = cnx_stringview_from("   ", 0, 3);
+	TEST_ASSERT_EQUAL(cnx_stringview_trim(view).m_length, static_cast(usize)(0));
+	TEST_ASSERT_EQUAL(cnx_stringview_trim_start(view).m_length, static_cast(usize)(0));
+	TEST_ASSERT_EQUAL(cnx_stringview_trim_end(view).m_length, static_cast(usize)(0));
+
+	let empty = cnx_stringview_from("", 0, 0);
+	TEST_ASSERT_EQUAL(cnx_stringview_trim(empty).m_length, static_cast(usize)(0));
+
+	// long enough to cover the vector kernels and their tails
+	CnxScopedString padded = cnx_string_from(
+		"                                          x                                          ");
+	let padded_trimmed = cnx_string_trim(padded);
+	TEST_ASSERT_TRUE(cnx_stringview_equal(padded_trimmed, "x"));
+}
+
+TEST(CnxStringAscii, case_conversion) {
+	CnxScopedString string = cnx_string_from("Hello, World! [@`{] caf\xC3\xA9 0123456789 Z");
+
+	CnxScopedString lower = cnx_string_to_lower(string);
+	TEST_ASSERT_TRUE(cnx_string_equal(lower, "hello, world! [@`{] caf\xC3\xA9 0123456789 z"));
+	CnxScopedString upper = cnx_string_to_upper(string);
+	TEST_ASSERT_TRUE(cnx_string_equal(upper, "HELLO, WORLD! [@`{] CAF\xC3\xA9 0123456789 Z"));
+
+	cnx_string_to_lower_in_place(string);
+	TEST_ASSERT_TRUE(cnx_string_equal(string, &lower));
+	cnx_string_to_upper_in_place(string);
+	TEST_ASSERT_TRUE(cnx_string_equal(string, &upper));
+
+	let view = cnx_stringview_from("MiXeD cAsE", 0, 10);
+	CnxScopedString view_lower = cnx_stringview_to_lower(view);
+	TEST_ASSERT_TRUE(cnx_string_equal(view_lower, "mixed case"));
+	CnxScopedString view_upper = cnx_stringview_to_upper(view);
+	TEST_ASSERT_TRUE(cnx_string_equal(view_upper, "MIXED CASE"));
+
+	CnxScopedString empty = cnx_string_from("");
+	cnx_string_to_upper_in_place(empty);
+	TEST_ASSERT_TRUE(cnx_string_is_empty(empty));
+}
+
+TEST(CnxStringAscii, ignore_case_comparison) {
+	CnxScopedString string = cnx_string_from("Content-Type: text/html; charset=UTF-8");
+	TEST_ASSERT_TRUE(
+		cnx_string_equal_ignore_case(string, "content-type: TEXT/HTML; CHARSET=utf-8"));
+	TEST_ASSERT_FALSE(cnx_string_equal_ignore_case(string, "content-type: text/html"));
+	TEST_ASSERT_FALSE(
+		cnx_string_equal_ignore_case(string, "content-type: text/html; charset=utf-9"));
+	TEST_ASSERT_TRUE(cnx_string_starts_with_ignore_case(string, "CONTENT-TYPE"));
+	TEST_ASSERT_FALSE(cnx_string_starts_with_ignore_case(string, "content-length"));
+	TEST_ASSERT_TRUE(cnx_string_ends_with_ignore_case(string, "charset=utf-8"));
+	TEST_ASSERT_FALSE(cnx_string_ends_with_ignore_case(string, "charset=utf-16"));
+	TEST_ASSERT_TRUE(cnx_string_starts_with_ignore_case(string, ""));
+	TEST_ASSERT_TRUE(cnx_string_ends_with_ignore_case(string, ""));
+
+	CnxScopedString lower = cnx_string_to_lower(string);
+	TEST_ASSERT_TRUE(cnx_string_equal_ignore_case(string, &lower));
+
+	let view = cnx_string_trim(string);
+	let prefix = cnx_stringview_from("CONTENT", 0, 7);
+	TEST_ASSERT_TRUE(cnx_stringview_starts_with_ignore_case(view, &prefix));
+	TEST_ASSERT_FALSE(cnx_stringview_ends_with_ignore_case(view, &prefix));
+	TEST_ASSERT_TRUE(cnx_stringview_equal_ignore_case(view, &string));
+
+	// a needle longer than the string never matches
+	CnxScopedString short_string = cnx_string_from("abc");
+	TEST_ASSERT_FALSE(cnx_string_starts_with_ignore_case(short_string, "ABCD"));
+	TEST_ASSERT_FALSE(cnx_string_ends_with_ignore_case(short_string, "ZABC"));
+}
+
+#endif // CNX_STRING_ASCII_TEST
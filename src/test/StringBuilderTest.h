@@ -0,0 +1,114 @@
+#ifndef CNX_STRING_BUILDER_TEST
+#define CNX_STRING_BUILDER_TEST
+
+#include <Cnx/StringBuilder.h>
+#include <Cnx/filesystem/Path.h>
+
+#include "Criterion.h"
+
+TEST(CnxStringBuilder, append_and_prepend) {
+	CnxScopedStringBuilder builder = cnx_string_builder_new();
+	TEST_ASSERT_TRUE(cnx_string_builder_is_empty(builder));
+
+	cnx_string_builder_append(builder, "world");
+	cnx_string_builder_prepend(builder, "hello ");
+	cnx_string_builder_push_back(builder, '!');
+	cnx_string_builder_push_front(builder, '>');
+
+	CnxScopedString suffix = cnx_string_from(" bye");
+	let view = cnx_stringview_from(" again", 0, 6);
+	cnx_string_builder_append(builder, &suffix);
+	cnx_string_builder_prepend(builder, &view);
+
+	TEST_ASSERT_EQUAL(cnx_string_builder_length(builder), static_cast(usize)(23));
+	CnxScopedString built = cnx_string_builder_build(builder);
+	TEST_ASSERT_TRUE(cnx_string_equal(built, " again>hello world! bye"));
+	TEST_ASSERT_EQUAL(cnx_string_length(built), static_cast(usize)(23));
+}
+
+TEST(CnxStringBuilder, large) {
+	CnxScopedStringBuilder builder = cnx_string_builder_new();
+	CnxScopedString expected = cnx_string_new();
+	// interleave appends and prepends across many chunk boundaries
+	for(let_mut i = 0; i < 2000; ++i) {
+		if(i % 3 == 0) {
+			cnx_string_builder_prepend_format(builder, "[{}]", i);
+			CnxScopedString piece = cnx_format("[{}]", i);
+			cnx_string_prepend(expected, &piece);
+		}
+		else {
+			cnx_string_builder_append_format(builder, "({})", i);
+			CnxScopedString piece = cnx_format("({})", i);
+			cnx_string_append(expected, &piece);
+		}
+	}
+
+	TEST_ASSERT_EQUAL(cnx_string_builder_length(builder), cnx_string_length(expected));
+	TEST_ASSERT_LESS_THAN(builder.m_num_chunks + builder.m_num_prefix_chunks,
+						  static_cast(usize)(32));
+	CnxScopedString built = cnx_string_builder_build(builder);
+	TEST_ASSERT_TRUE(cnx_string_equal(built, &expected));
+
+	// a single append larger than any chunk
+	let_mut big = cnx_string_new_with_capacity(10000);
+	for(let_mut i = 0; i < 10000; ++i) {
+		cnx_string_push_back(big, static_cast(char)('a' + i % 26));
+	}
+	cnx_string_builder_clear(builder);
+	TEST_ASSERT_TRUE(cnx_string_builder_is_empty(builder));
+	cnx_string_builder_append(builder, &big);
+	cnx_string_builder_prepend(builder, &big);
+	CnxScopedString doubled = cnx_string_builder_build(builder);
+	TEST_ASSERT_EQUAL(cnx_string_length(doubled), static_cast(usize)(20000));
+	for(let_mut i = 0U; i < 20000U; ++i) {
+		TEST_ASSERT_EQUAL(cnx_string_at(doubled, i), static_cast(char)('a' + (i % 10000) % 26));
+	}
+	cnx_string_free(big);
+}
+
+TEST(CnxStringBuilder, format_across_chunks) {
+	// longer than a chunk, so the formatted output spans several
+	CnxScopedString long_piece = cnx_string_new();
+	for(let_mut i = 0; i < CNX_STRING_BUILDER_MIN_CHUNK_SIZE * 3; ++i) {
+		cnx_string_push_back(long_piece, static_cast(char)('a' + i % 26));
+	}
+
+	CnxScopedStringBuilder builder = cnx_string_builder_new();
+	cnx_string_builder_prepend_format(builder, "<{}>", long_piece);
+	cnx_string_builder_append(builder, "tail");
+	let answer = 42;
+	cnx_string_builder_prepend_format(builder, "{} {}|", answer, long_piece);
+	cnx_string_builder_append_format(builder, "|{}", long_piece);
+
+	CnxScopedString expected = cnx_format("42 {}|<{}>tail|{}", long_piece, long_piece, long_piece);
+	TEST_ASSERT_EQUAL(cnx_string_builder_length(builder), cnx_string_length(expected));
+	CnxScopedString built = cnx_string_builder_build(builder);
+	TEST_ASSERT_TRUE(cnx_string_equal(built, &expected));
+}
+
+TEST(CnxStringBuilder, write_to_file) {
+	CnxScopedString path = cnx_string_from("CnxStringBuilderTest.txt");
+	{
+		let_mut maybe_file = cnx_file_open(&path);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(maybe_file));
+		CnxScopedFile file = cnx_result_unwrap(maybe_file);
+
+		CnxScopedStringBuilder builder = cnx_string_builder_new();
+		cnx_string_builder_append(builder, "line two\n");
+		cnx_string_builder_prepend(builder, "line one\n");
+		let_mut written = cnx_string_builder_write_to_file(builder, &file);
+		TEST_ASSERT_TRUE(cnx_result_is_ok(written));
+		TEST_ASSERT_EQUAL(cnx_result_unwrap(written), static_cast(usize)(18));
+
+		ignore(cnx_file_flush(&file));
+		ignore(cnx_file_seek(&file, 0, CnxFileSeekBegin));
+		u8 contents[32] = {0};
+		let_mut read = cnx_file_read_bytes(&file, contents, sizeof(contents));
+		TEST_ASSERT_TRUE(cnx_result_is_ok(read));
+		TEST_ASSERT_EQUAL(cnx_result_unwrap(read), static_cast(usize)(18));
+		TEST_ASSERT_EQUAL(memcmp(contents, "line one\nline two\n", 18), 0);
+	}
+	ignore(cnx_path_remove_file(&path));
+}
+
+#endif // CNX_STRING_BUILDER_TEST
@@ -0,0 +1,202 @@
+#ifndef CNX_STRING_SEARCH_TEST
+#define CNX_STRING_SEARCH_TEST
+
+#include <Cnx/StringExt.h>
+#include <Cnx/StringSearch.h>
+
+#include "Criterion.h"
+
+#define STRING_SEARCH_TEST_HAYSTACK_SIZE 1000
+
+static inline usize string_search_test_naive_first(const_cstring haystack,
+												   usize haystack_length,
+												   const_cstring needle,
+												   usize needle_length) {
+	for(let_mut i = static_cast(usize)(0); i + needle_length <= haystack_length; ++i) {
+		if(0 == memcmp(haystack + i, needle, needle_length)) {
+			return i;
+		}
+	}
+	return cnx_max_value(usize);
+}
+
+static inline usize string_search_test_naive_last(const_cstring haystack,
+												  usize haystack_length,
+												  const_cstring needle,
+												  usize needle_length) {
+	let_mut last = cnx_max_value(usize);
+	for(let_mut i = static_cast(usize)(0); i + needle_length <= haystack_length; ++i) {
+		if(0 == memcmp(haystack + i, needle, needle_length)) {
+			last = i;
+		}
+	}
+	return last;
+}
+
+static inline usize string_search_test_naive_count(const_cstring haystack,
+												   usize haystack_length,
+												   const_cstring needle,
+												   usize needle_length) {
+	let_mut count = static_cast(usize)(0);
+	for(let_mut i = static_cast(usize)(0); i + needle_length <= haystack_length; ++i) {
+		if(0 == memcmp(haystack + i, needle, needle_length)) {
+			++count;
+		}
+	}
+	return count;
+}
+
+static inline usize string_search_test_option_or_max(CnxOption(usize) option) {
+	return cnx_option_unwrap_or(option, cnx_max_value(usize));
+}
+
+static inline usize string_search_test_unwrap(CnxOption(usize) option) {
+	return cnx_option_unwrap(option);
+}
+
+static inline bool string_search_test_is_none(CnxOption(usize) option) {
+	return cnx_option_is_none(option);
+}
+
+TEST(CnxStringSearch, short_needles) {
+	let haystack = "the quick brown fox jumps over the lazy dog, the end";
+	let length = strlen(haystack);
+
+	TEST_ASSERT_EQUAL(string_search_test_unwrap(cnx_string_search_first(haystack, length, "the", 3)),
+					  static_cast(usize)(0));
+	TEST_ASSERT_EQUAL(string_search_test_unwrap(cnx_string_search_last(haystack, length, "the", 3)),
+					  static_cast(usize)(45));
+	TEST_ASSERT_EQUAL(cnx_string_search_count(haystack, length, "the", 3), static_cast(usize)(3));
+	TEST_ASSERT_EQUAL(string_search_test_unwrap(cnx_string_search_first(haystack, length, "end", 3)),
+					  length - 3);
+	TEST_ASSERT_EQUAL(string_search_test_unwrap(cnx_string_search_first(haystack, length, "q", 1)),
+					  static_cast(usize)(4));
+	TEST_ASSERT_EQUAL(string_search_test_unwrap(cnx_string_search_last(haystack, length, "o", 1)),
+					  static_cast(usize)(41));
+	TEST_ASSERT_TRUE(string_search_test_is_none(cnx_string_search_first(haystack, length, "cat", 3)));
+	TEST_ASSERT_TRUE(string_search_test_is_none(cnx_string_search_last(haystack, length, "cat", 3)));
+	TEST_ASSERT_TRUE(string_search_test_is_none(cnx_string_search_first("ab", 2, "abc", 3)));
+
+	// an exact-length match at the very end of the haystack
+	TEST_ASSERT_EQUAL(string_search_test_unwrap(cnx_string_search_first("abc", 3, "abc", 3)),
+					  static_cast(usize)(0));
+	TEST_ASSERT_EQUAL(string_search_test_unwrap(cnx_string_search_last("abc", 3, "abc", 3)),
+					  static_cast(usize)(0));
+
+	TEST_ASSERT_EQUAL(string_search_test_unwrap(cnx_string_search_first(haystack, length, "", 0)),
+					  static_cast(usize)(0));
+	TEST_ASSERT_EQUAL(string_search_test_unwrap(cnx_string_search_last(haystack, length, "", 0)), length);
+
+	// overlapping occurrences are counted
+	TEST_ASSERT_EQUAL(cnx_string_search_count("aaaaa", 5, "aa", 2), static_cast(usize)(4));
+}
+
+TEST(CnxStringSearch, matches_naive_search) {
+	char haystack[STRING_SEARCH_TEST_HAYSTACK_SIZE];
+	char needle[CNX_STRING_SEARCH_TWO_WAY_THRESHOLD * 2];
+
+	// a small alphabet produces many partial matches, exercising every kernel's candidate
+	// verification, block boundaries, and tails
+	let_mut state = static_cast(u32)(12345);
+	for(let_mut i = static_cast(usize)(0); i < sizeof(haystack); ++i) {
+		state = state * 1103515245U + 12345U;
+		haystack[i] = static_cast(char)('a' + (state >> 16U) % 3U);
+	}
+
+	let needle_lengths = (usize[]){2, 3, 4, 7, 16, 17, 33, 64, 65, 90, 128};
+	for(let_mut length_index = static_cast(usize)(0); length_index < 11; ++length_index) {
+		let needle_length = needle_lengths[length_index];
+		for(let_mut offset = static_cast(usize)(0); offset < sizeof(haystack) - needle_length;
+			offset += 37)
+		{
+			// needles taken from the haystack are always found, then mutate one byte to produce
+			// (usually) absent needles
+			memcpy(needle, haystack + offset, needle_length);
+			for(let_mut mutate = 0; mutate < 2; ++mutate) {
+				if(mutate == 1) {
+					needle[needle_length / 2] = 'z';
+				}
+
+				TEST_ASSERT_EQUAL(string_search_test_option_or_max(cnx_string_search_first(
+									  haystack,
+									  sizeof(haystack),
+									  needle,
+									  needle_length)),
+								  string_search_test_naive_first(haystack,
+																 sizeof(haystack),
+																 needle,
+																 needle_length));
+				TEST_ASSERT_EQUAL(string_search_test_option_or_max(cnx_string_search_last(
+									  haystack,
+									  sizeof(haystack),
+									  needle,
+									  needle_length)),
+								  string_search_test_naive_last(haystack,
+																sizeof(haystack),
+																needle,
+																needle_length));
+				TEST_ASSERT_EQUAL(
+					cnx_string_search_count(haystack, sizeof(haystack), needle, needle_length),
+					string_search_test_naive_count(haystack,
+												   sizeof(haystack),
+												   needle,
+												   needle_length));
+			}
+		}
+	}
+}
+
+TEST(CnxStringSearch, periodic_long_needle) {
+	char haystack[STRING_SEARCH_TEST_HAYSTACK_SIZE];
+	char needle[CNX_STRING_SEARCH_TWO_WAY_THRESHOLD + 36];
+	memset(haystack, 'a', sizeof(haystack));
+	memset(needle, 'a', sizeof(needle));
+	needle[sizeof(needle) - 1] = 'b';
+
+	TEST_ASSERT_TRUE(string_search_test_is_none(
+		cnx_string_search_first(haystack, sizeof(haystack), needle, sizeof(needle))));
+
+	haystack[sizeof(haystack) - 1] = 'b';
+	TEST_ASSERT_EQUAL(
+		string_search_test_unwrap(cnx_string_search_first(haystack, sizeof(haystack), needle, sizeof(needle))),
+		sizeof(haystack) - sizeof(needle));
+	TEST_ASSERT_EQUAL(
+		string_search_test_unwrap(cnx_string_search_last(haystack, sizeof(haystack), needle, sizeof(needle))),
+		sizeof(haystack) - sizeof(needle));
+	TEST_ASSERT_EQUAL(cnx_string_search_count(haystack, sizeof(haystack), needle, sizeof(needle)),
+					  static_cast(usize)(1));
+}
+
+TEST(CnxStringSearch, stringview) {
+	let view = cnx_stringview_from("GET /index.html HTTP/1.1", 0, 24);
+	TEST_ASSERT_TRUE(cnx_stringview_contains(view, "HTTP/"));
+	TEST_ASSERT_FALSE(cnx_stringview_contains(view, "POST"));
+	TEST_ASSERT_EQUAL(string_search_test_unwrap(cnx_stringview_find_first(view, "/")),
+					  static_cast(usize)(4));
+	TEST_ASSERT_EQUAL(string_search_test_unwrap(cnx_stringview_find_last(view, "/")),
+					  static_cast(usize)(20));
+
+	let needle_view = cnx_stringview_from("index", 0, 5);
+	TEST_ASSERT_EQUAL(string_search_test_unwrap(cnx_stringview_find_first(view, &needle_view)),
+					  static_cast(usize)(5));
+	CnxScopedString needle_string = cnx_string_from("1.1");
+	TEST_ASSERT_EQUAL(string_search_test_unwrap(cnx_stringview_find_last(view, &needle_string)),
+					  static_cast(usize)(21));
+}
+
+TEST(CnxStringSearch, string_boundaries) {
+	CnxScopedString string = cnx_string_from("test string test");
+	TEST_ASSERT_TRUE(cnx_string_starts_with(string, "test"));
+	TEST_ASSERT_TRUE(cnx_string_ends_with(string, "test"));
+	TEST_ASSERT_TRUE(cnx_string_starts_with(string, "test string test"));
+	TEST_ASSERT_TRUE(cnx_string_ends_with(string, "test string test"));
+	TEST_ASSERT_FALSE(cnx_string_starts_with(string, "test string test!"));
+	TEST_ASSERT_TRUE(cnx_string_contains(string, "test string test"));
+	TEST_ASSERT_EQUAL(string_search_test_unwrap(cnx_string_find_first(string, "test string test")),
+					  static_cast(usize)(0));
+	TEST_ASSERT_EQUAL(string_search_test_unwrap(cnx_string_find_last(string, "test")),
+					  static_cast(usize)(12));
+	TEST_ASSERT_EQUAL(cnx_string_occurrences_of(string, "t"), static_cast(usize)(5));
+}
+
+#endif // CNX_STRING_SEARCH_TEST
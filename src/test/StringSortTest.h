@@ -0,0 +1,164 @@
+#ifndef CNX_STRING_SORT_TEST
+#define CNX_STRING_SORT_TEST
+
+#include <Cnx/Allocators.h>
+#include <Cnx/StringExt.h>
+#include <Cnx/StringSort.h>
+#include <stdlib.h>
+
+#include "Criterion.h"
+#include "TestRandom.h"
+
+#define STRING_SORT_TEST_MAX_LENGTH 40
+#define STRING_SORT_TEST_NUM_STRINGS 3000
+// large enough to be split between threads
+#define STRING_SORT_TEST_NUM_PARALLEL_STRINGS (CNX_STRING_SORT_PARALLEL_THRESHOLD * 3)
+
+/// @brief Fills `buffer` with `count` random strings of at most `STRING_SORT_TEST_MAX_LENGTH`
+/// characters each, writing a view of each to `views`. Strings are drawn from a tiny alphabet
+/// (including `'\0'`), often share long prefixes, and are often duplicated, to exercise
+/// every path of the sort
+static inline void string_sort_test_random_views(u32* restrict state,
+												 char* restrict buffer,
+												 CnxStringView* restrict views,
+												 usize count) {
+	static const char alphabet[] = {'a', 'b', '\0', 'z'};
+	static const char prefix[] = "a shared prefix, ";
+	let_mut offset = static_cast(usize)(0);
+	for(let_mut i = static_cast(usize)(0); i < count; ++i) {
+		let kind = test_random(state) % 4;
+		if(kind == 0 && i > 0) {
+			// a duplicate of an earlier string
+			views[i] = views[test_random(state) % i];
+			continue;
+		}
+
+		let length = static_cast(usize)(test_random(state) % (STRING_SORT_TEST_MAX_LENGTH + 1));
+		let start = offset;
+		for(let_mut j = static_cast(usize)(0); j < length; ++j) {
+			buffer[offset++] = kind == 1 && j < sizeof(prefix) - 1 ?
+								   prefix[j] :
+								   alphabet[test_random(state) % sizeof(alphabet)];
+		}
+		views[i] = cnx_stringview_from_raw(buffer + start, length);
+	}
+}
+
+static inline i32 string_sort_test_compare(const void* lhs, const void* rhs) {
+	let left = static_cast(const CnxStringView*)(lhs);
+	let right = static_cast(const CnxStringView*)(rhs);
+	let shorter = left->m_length < right->m_length ? left->m_length : right->m_length;
+	let result = memcmp(left->m_view, right->m_view, shorter);
+	if(result != 0) {
+		return result;
+	}
+	return left->m_length < right->m_length ? -1 : (left->m_length > right->m_length ? 1 : 0);
+}
+
+static inline bool string_sort_test_views_match(const CnxStringView* restrict views,
+												const CnxStringView* restrict expected,
+												usize count) {
+	for(let_mut i = static_cast(usize)(0); i < count; ++i) {
+		if(string_sort_test_compare(&views[i], &expected[i]) != 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static inline void string_sort_test_check_views(usize count, usize num_threads) {
+	let_mut state = 42U;
+	let_mut buffer = cnx_allocator_allocate_array_t(char,
+													DEFAULT_ALLOCATOR,
+													count * STRING_SORT_TEST_MAX_LENGTH);
+	let_mut views = cnx_allocator_allocate_array_t(CnxStringView, DEFAULT_ALLOCATOR, count);
+	let_mut expected = cnx_allocator_allocate_array_t(CnxStringView, DEFAULT_ALLOCATOR, count);
+	string_sort_test_random_views(&state, buffer, views, count);
+	cnx_memcpy(CnxStringView, expected, views, count);
+
+	qsort(expected, count, sizeof(CnxStringView), string_sort_test_compare);
+	cnx_string_sort_array_parallel(views, count, num_threads);
+	TEST_ASSERT_TRUE(string_sort_test_views_match(views, expected, count));
+
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, expected);
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, views);
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, buffer);
+}
+
+static inline void string_sort_test_check_strings(usize count, usize num_threads) {
+	let_mut state = 7U;
+	let_mut buffer = cnx_allocator_allocate_array_t(char,
+													DEFAULT_ALLOCATOR,
+													count * STRING_SORT_TEST_MAX_LENGTH);
+	let_mut expected = cnx_allocator_allocate_array_t(CnxStringView, DEFAULT_ALLOCATOR, count);
+	let_mut strings = cnx_allocator_allocate_array_t(CnxString, DEFAULT_ALLOCATOR, count);
+	string_sort_test_random_views(&state, buffer, expected, count);
+	for(let_mut i = static_cast(usize)(0); i < count; ++i) {
+		strings[i] = cnx_string_from_cstring(expected[i].m_view, expected[i].m_length);
+	}
+
+	qsort(expected, count, sizeof(CnxStringView), string_sort_test_compare);
+	cnx_string_sort_array_parallel(strings, count, num_threads);
+	let_mut matches = true;
+	for(let_mut i = static_cast(usize)(0); i < count; ++i) {
+		let view = cnx_string_into_stringview(strings[i]);
+		matches = matches && string_sort_test_compare(&view, &expected[i]) == 0;
+		cnx_string_free(strings[i]);
+	}
+	TEST_ASSERT_TRUE(matches);
+
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, strings);
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, expected);
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, buffer);
+}
+
+TEST(CnxStringSort, vector) {
+	CnxScopedString string = cnx_string_from("pear=apple=fig=applesauce=app=banana=fig=");
+	CnxScopedVector(CnxString) strings = cnx_string_split_on(string, '=');
+	CnxScopedVector(CnxStringView) views = cnx_string_view_split_on(string, '=');
+
+	cnx_string_sort(strings);
+	CnxScopedString joined_strings = cnx_string_join(" ", strings);
+	TEST_ASSERT(cnx_string_equal(joined_strings, "app apple applesauce banana fig fig pear"));
+
+	cnx_string_sort_parallel(views, 4);
+	CnxScopedString joined_views = cnx_string_join(" ", views);
+	TEST_ASSERT(cnx_string_equal(joined_views, "app apple applesauce banana fig fig pear"));
+}
+
+TEST(CnxStringSort, edge_cases) {
+	// embedded null characters must order after the end of an otherwise equal string, and
+	// strings ending exactly at (and just past) the cached prefixes must order correctly
+	const_cstring data = "a\0a\0\0abcdefghabcdefgh\0abcdefghabcdefgz";
+	const usize starts[] = {0, 0, 0, 0, 5, 5, 5, 5};
+	const usize lengths[] = {2, 1, 0, 3, 16, 8, 17, 9};
+	const usize expected[] = {2, 1, 0, 3, 5, 7, 4, 6};
+	CnxStringView views[8] = {0};
+	for(let_mut i = 0U; i < 8U; ++i) {
+		views[i] = cnx_stringview_from_raw(data + starts[i], lengths[i]);
+	}
+	CnxStringView sorted[8] = {0};
+	cnx_memcpy(CnxStringView, sorted, views, 8);
+
+	cnx_string_sort_array(sorted, 8);
+	for(let_mut i = 0U; i < 8U; ++i) {
+		TEST_ASSERT_EQUAL(string_sort_test_compare(&sorted[i], &views[expected[i]]), 0);
+	}
+
+	// empty and single-element inputs
+	cnx_string_sort_array(sorted, 0);
+	cnx_string_sort_array(sorted, 1);
+	TEST_ASSERT_EQUAL(sorted[0].m_length, 0U);
+}
+
+TEST(CnxStringSort, matches_reference) {
+	string_sort_test_check_views(STRING_SORT_TEST_NUM_STRINGS, 1);
+	string_sort_test_check_strings(STRING_SORT_TEST_NUM_STRINGS, 1);
+}
+
+TEST(CnxStringSort, parallel_matches_reference) {
+	string_sort_test_check_views(STRING_SORT_TEST_NUM_PARALLEL_STRINGS, 4);
+	string_sort_test_check_strings(STRING_SORT_TEST_NUM_PARALLEL_STRINGS, 3);
+}
+
+#endif // CNX_STRING_SORT_TEST
@@ -0,0 +1,109 @@
+#ifndef CNX_STRING_SPLIT_TEST
+#define CNX_STRING_SPLIT_TEST
+
+#include <Cnx/StringSplit.h>
+
+#define RANGE_T	   CnxStringView
+#define RANGE_DECL TRUE
+#define RANGE_IMPL TRUE
+#include <Cnx/Range.h>
+#undef RANGE_T
+#undef RANGE_DECL
+#undef RANGE_IMPL
+
+#include "Criterion.h"
+
+static inline bool string_split_test_next_equals(CnxSplitIterator* restrict split,
+												 restrict const_cstring expected) {
+	let_mut next = cnx_split_iterator_next(*split);
+	if(cnx_option_is_none(next)) {
+		return false;
+	}
+	let piece = cnx_option_unwrap(next);
+	return cnx_stringview_equal(piece, expected);
+}
+
+static inline bool string_split_test_is_finished(CnxSplitIterator* restrict split) {
+	let_mut next = cnx_split_iterator_next(*split);
+	return cnx_option_is_none(next);
+}
+
+TEST(CnxStringSplit, split) {
+	let view = cnx_stringview_from("a,b,,c,", 0, 7);
+	let_mut split = cnx_stringview_split(view, ",");
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&split, "a"));
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&split, "b"));
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&split, ""));
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&split, "c"));
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&split, ""));
+	TEST_ASSERT_TRUE(string_split_test_is_finished(&split));
+	TEST_ASSERT_TRUE(string_split_test_is_finished(&split));
+
+	let empty = cnx_stringview_from("", 0, 0);
+	let_mut empty_split = cnx_stringview_split(empty, ",");
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&empty_split, ""));
+	TEST_ASSERT_TRUE(string_split_test_is_finished(&empty_split));
+}
+
+TEST(CnxStringSplit, multi_byte_delimiter) {
+	CnxScopedString string = cnx_string_from("key::value::::end");
+	let_mut split = cnx_string_split(string, "::");
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&split, "key"));
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&split, "value"));
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&split, ""));
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&split, "end"));
+	TEST_ASSERT_TRUE(string_split_test_is_finished(&split));
+}
+
+TEST(CnxStringSplit, any_of_and_tokenize) {
+	let view = cnx_stringview_from("  one two\tthree\n\nfour ", 0, 22);
+
+	let_mut split = cnx_stringview_split_any_of(view, " \t\n");
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&split, ""));
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&split, ""));
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&split, "one"));
+
+	let_mut tokens = cnx_stringview_tokenize(view, " \t\n");
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&tokens, "one"));
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&tokens, "two"));
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&tokens, "three"));
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&tokens, "four"));
+	TEST_ASSERT_TRUE(string_split_test_is_finished(&tokens));
+}
+
+TEST(CnxStringSplit, max_splits) {
+	let view = cnx_stringview_from("GET /index.html HTTP/1.1", 0, 24);
+	let_mut split
+		= cnx_stringview_split_with_options(view, " ", ((CnxSplitOptions){.m_max_splits = 1}));
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&split, "GET"));
+	let remainder = cnx_split_iterator_remainder(split);
+	TEST_ASSERT_TRUE(cnx_stringview_equal(remainder, "/index.html HTTP/1.1"));
+	TEST_ASSERT_TRUE(string_split_test_next_equals(&split, "/index.html HTTP/1.1"));
+	TEST_ASSERT_TRUE(string_split_test_is_finished(&split));
+}
+
+TEST(CnxStringSplit, foreach_and_range) {
+	CnxScopedString string = cnx_string_from("10,20,,30,40");
+	let_mut split = cnx_string_split_with_options(string,
+												  ",",
+												  ((CnxSplitOptions){.m_skip_empty = true}));
+
+	let expected = (const_cstring[]){"10", "20", "30", "40"};
+	let_mut count = static_cast(usize)(0);
+	foreach(piece, split) {
+		TEST_ASSERT_TRUE(cnx_stringview_equal(piece, expected[count]));
+		++count;
+	}
+	TEST_ASSERT_EQUAL(count, static_cast(usize)(4));
+
+	// iterating again restarts at the beginning of the input
+	count = 0;
+	let_mut range = cnx_range_from(CnxStringView, split);
+	foreach(piece, range) {
+		TEST_ASSERT_TRUE(cnx_stringview_equal(piece, expected[count]));
+		++count;
+	}
+	TEST_ASSERT_EQUAL(count, static_cast(usize)(4));
+}
+
+#endif // CNX_STRING_SPLIT_TEST
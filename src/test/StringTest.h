@@ -462,6 +462,42 @@ TEST(CnxString, iterator) {
 	cnx_string_free(string2);
 }
 
+TEST(CnxString, iterator_ref) {
+	CnxScopedString string = cnx_string_from("this is a string longer than the short capacity");
+	let_mut count = 0U;
+	foreach_ref(character, string) {
+		TEST_ASSERT_EQUAL(character, &cnx_string_at(string, count));
+		++count;
+	}
+	TEST_ASSERT_EQUAL(count, cnx_string_length(string));
+
+	foreach_ref_mut(character, string) {
+		if(*character == ' ') {
+			*character = '_';
+		}
+	}
+	TEST_ASSERT(cnx_string_equal(string, "this_is_a_string_longer_than_the_short_capacity"));
+
+	let view = cnx_string_into_stringview(string);
+	let_mut underscores = 0;
+	foreach(character, view) {
+		if(character == 'l') {
+			break;
+		}
+		if(character != '_') {
+			continue;
+		}
+		++underscores;
+	}
+	TEST_ASSERT_EQUAL(underscores, 4);
+
+	CnxScopedString empty = cnx_string_new();
+	foreach(character, empty) {
+		ignore(character);
+		TEST_ASSERT(false);
+	}
+}
+
 TEST(CnxString, split_on) {
 	CnxScopedString string = cnx_string_from("This=is=a=test=string");
 
@@ -527,4 +563,57 @@ TEST(CnxString, find_occurrences_of) {
 	TEST_ASSERT_EQUAL(cnx_vector_at(occurrences, 2), 12);
 }
 
+static usize string_test_num_allocations = 0;
+
+static void* string_test_counting_malloc(__attr(maybe_unused) CnxAllocator* self, usize bytes) {
+	++string_test_num_allocations;
+	return malloc(bytes);
+}
+
+static void* string_test_counting_realloc(__attr(maybe_unused) CnxAllocator* self,
+										  void* memory,
+										  usize new_size_bytes) {
+	++string_test_num_allocations;
+	return realloc(memory, new_size_bytes);
+}
+
+TEST(CnxString, join) {
+	CnxScopedString string = cnx_string_from("This=is=a=test=string");
+	CnxScopedVector(CnxString) strings = cnx_string_split_on(string, '=');
+	CnxScopedVector(CnxStringView) views = cnx_string_view_split_on(string, '=');
+
+	CnxScopedString joined_strings = cnx_string_join(" ", strings);
+	TEST_ASSERT(cnx_string_equal(joined_strings, "This is a test string"));
+
+	CnxScopedString separator = cnx_string_from(", ");
+	CnxScopedString joined_views = cnx_string_join(&separator, views);
+	TEST_ASSERT(cnx_string_equal(joined_views, "This, is, a, test, string"));
+
+	CnxScopedString joined_array = cnx_string_join_array("", cnx_vector_data(views), 2);
+	TEST_ASSERT(cnx_string_equal(joined_array, "Thisis"));
+
+	CnxScopedString joined_none = cnx_string_join_array("-", cnx_vector_data(views), 0);
+	TEST_ASSERT(cnx_string_is_empty(joined_none));
+}
+
+TEST(CnxString, concat_n) {
+	CnxScopedString first = cnx_string_from("The quick brown fox ");
+	let second = cnx_stringview_from("jumps over ", 0, 11);
+	CnxScopedString concatenated = cnx_string_concat_n(&first, &second, "the lazy ", "dog");
+
+	TEST_ASSERT(cnx_string_equal(concatenated, "The quick brown fox jumps over the lazy dog"));
+
+	let allocator = cnx_allocator_from_custom_stateless_allocator(string_test_counting_malloc,
+																  string_test_counting_realloc,
+																  test_free);
+	string_test_num_allocations = 0;
+	CnxScopedString counted
+		= cnx_string_concat_n_with_allocator(allocator, &first, &second, "the lazy ", "dog");
+	TEST_ASSERT(cnx_string_equal(counted, &concatenated));
+	TEST_ASSERT_EQUAL(string_test_num_allocations, 1U);
+
+	CnxScopedString single = cnx_string_concat_n("single");
+	TEST_ASSERT(cnx_string_equal(single, "single"));
+}
+
 #endif // CNX_STRING_TEST
@@ -0,0 +1,113 @@
+#ifndef CNX_SYMBOL_TEST
+#define CNX_SYMBOL_TEST
+
+#include <Cnx/Symbol.h>
+#include <Cnx/Thread.h>
+
+#include "Criterion.h"
+
+#define SYMBOL_TEST_NUM_STRINGS 2000
+
+static inline CnxString symbol_test_name(usize index) {
+	return cnx_format("service-{}.example.com", index);
+}
+
+TEST(CnxSymbol, intern) {
+	CnxScopedSymbolTable table = cnx_symbol_table_new();
+	TEST_ASSERT_EQUAL(cnx_symbol_table_size(table), static_cast(usize)(0));
+
+	CnxScopedString host = cnx_string_from("localhost");
+	let first = cnx_symbol_table_intern(table, "localhost");
+	let second = cnx_symbol_table_intern(table, &host);
+	let view = cnx_stringview_from("localhost:8080", 0, 9);
+	let third = cnx_symbol_table_intern(table, &view);
+	let other = cnx_symbol_table_intern(table, "remotehost");
+
+	TEST_ASSERT_TRUE(cnx_symbol_equal(first, second));
+	TEST_ASSERT_TRUE(cnx_symbol_equal(first, third));
+	TEST_ASSERT_FALSE(cnx_symbol_equal(first, other));
+	TEST_ASSERT_EQUAL(cnx_symbol_hash(first), cnx_symbol_hash(second));
+	TEST_ASSERT_EQUAL(cnx_symbol_table_size(table), static_cast(usize)(2));
+
+	TEST_ASSERT_EQUAL(cnx_symbol_length(first), static_cast(usize)(9));
+	TEST_ASSERT_EQUAL(strcmp(cnx_symbol_into_cstring(first), "localhost"), 0);
+	let symbol_view = cnx_symbol_into_stringview(other);
+	TEST_ASSERT_TRUE(cnx_stringview_equal(symbol_view, "remotehost"));
+
+	let empty = cnx_symbol_table_intern(table, "");
+	TEST_ASSERT_EQUAL(cnx_symbol_length(empty), static_cast(usize)(0));
+	TEST_ASSERT_TRUE(cnx_symbol_equal(empty, cnx_symbol_table_intern(table, "")));
+}
+
+TEST(CnxSymbol, find) {
+	CnxScopedSymbolTable table = cnx_symbol_table_new();
+	let_mut missing = cnx_symbol_table_find(table, "absent");
+	TEST_ASSERT_TRUE(cnx_option_is_none(missing));
+
+	let interned = cnx_symbol_table_intern(table, "present");
+	let_mut found = cnx_symbol_table_find(table, "present");
+	TEST_ASSERT_TRUE(cnx_option_is_some(found));
+	TEST_ASSERT_TRUE(cnx_symbol_equal(cnx_option_unwrap(found), interned));
+	TEST_ASSERT_EQUAL(cnx_symbol_table_size(table), static_cast(usize)(1));
+}
+
+TEST(CnxSymbol, many) {
+	CnxScopedSymbolTable table = cnx_symbol_table_new();
+	let_mut symbols
+		= cnx_allocator_allocate_array_t(CnxSymbol, DEFAULT_ALLOCATOR, SYMBOL_TEST_NUM_STRINGS);
+	for(let_mut i = 0U; i < SYMBOL_TEST_NUM_STRINGS; ++i) {
+		CnxScopedString name = symbol_test_name(i);
+		symbols[i] = cnx_symbol_table_intern(table, &name);
+	}
+	TEST_ASSERT_EQUAL(cnx_symbol_table_size(table), static_cast(usize)(SYMBOL_TEST_NUM_STRINGS));
+
+	// symbols must stay valid while the table grows
+	for(let_mut i = 0U; i < SYMBOL_TEST_NUM_STRINGS; ++i) {
+		CnxScopedString name = symbol_test_name(i);
+		TEST_ASSERT_TRUE(cnx_symbol_equal(symbols[i], cnx_symbol_table_intern(table, &name)));
+		TEST_ASSERT_EQUAL(strcmp(cnx_symbol_into_cstring(symbols[i]),
+								 cnx_string_into_cstring(name)),
+						  0);
+	}
+	TEST_ASSERT_EQUAL(cnx_symbol_table_size(table), static_cast(usize)(SYMBOL_TEST_NUM_STRINGS));
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, symbols);
+}
+
+void LambdaFunction(symbol_test_intern_all) {
+	let binding = lambda_binding(CnxSymbolTable*);
+	for(let_mut i = 0U; i < SYMBOL_TEST_NUM_STRINGS; ++i) {
+		CnxScopedString name = symbol_test_name(i);
+		ignore(cnx_symbol_table_intern(*(binding._1), &name));
+	}
+}
+
+TEST(CnxSymbol, concurrent) {
+	CnxScopedSymbolTable table = cnx_symbol_table_new();
+
+	// add a new scope so the threads get joined before our final asserts
+	{
+		let_mut res = cnx_thread_new(
+			lambda_cast(lambda(symbol_test_intern_all, &table), CnxThreadLambda));
+		TEST_ASSERT_TRUE(cnx_result_is_ok(res));
+		__attr(maybe_unused) CnxScopedThread thread = cnx_result_unwrap(res);
+
+		let_mut res2 = cnx_thread_new(
+			lambda_cast(lambda(symbol_test_intern_all, &table), CnxThreadLambda));
+		TEST_ASSERT_TRUE(cnx_result_is_ok(res2));
+		__attr(maybe_unused) CnxScopedThread thread2 = cnx_result_unwrap(res2);
+
+		for(let_mut i = static_cast(usize)(SYMBOL_TEST_NUM_STRINGS); i > 0U; --i) {
+			CnxScopedString name = symbol_test_name(i - 1);
+			ignore(cnx_symbol_table_intern(table, &name));
+		}
+	}
+
+	TEST_ASSERT_EQUAL(cnx_symbol_table_size(table), static_cast(usize)(SYMBOL_TEST_NUM_STRINGS));
+	for(let_mut i = 0U; i < SYMBOL_TEST_NUM_STRINGS; ++i) {
+		CnxScopedString name = symbol_test_name(i);
+		let_mut found = cnx_symbol_table_find(table, &name);
+		TEST_ASSERT_TRUE(cnx_option_is_some(found));
+	}
+}
+
+#endif // CNX_SYMBOL_TEST
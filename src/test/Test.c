@@ -1,15 +1,36 @@
 #include "ArrayTest.h"
+#include "BTreeMapTest.h"
+#include "BitVectorTest.h"
+#include "ByteScanTest.h"
 #include "CheckedMathTest.h"
 #include "ClockTest.h"
+#include "CompactStringTest.h"
+#include "CsvTest.h"
+#include "DeferredLogTest.h"
 #include "DurationTest.h"
+#include "EncodingTest.h"
 #include "GcdAndLcmTest.h"
+#include "JsonTest.h"
 #include "LambdaTest.h"
 #include "PathTest.h"
+#include "PatternSetTest.h"
 #include "RangeTest.h"
 #include "RatioTest.h"
+#include "RegexTest.h"
 #include "SharedPtrTest.h"
+#include "SharedStringTest.h"
+#include "SlotMapTest.h"
+#include "SoATest.h"
+#include "SpanTest.h"
+#include "StringAsciiTest.h"
+#include "StringBuilderTest.h"
+#include "StringSearchTest.h"
+#include "StringSortTest.h"
+#include "StringSplitTest.h"
 #include "StringTest.h"
+#include "SymbolTest.h"
 #include "ThreadTest.h"
 #include "TimePointTest.h"
 #include "UniquePtrTest.h"
+#include "Utf8Test.h"
 #include "VectorTest.h"
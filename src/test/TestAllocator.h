@@ -0,0 +1,41 @@
+#ifndef CNX_TEST_ALLOCATOR
+#define CNX_TEST_ALLOCATOR
+
+#include <Cnx/Allocators.h>
+
+static usize test_allocator_live_allocations = 0;
+static usize test_allocator_total_allocations = 0;
+
+static void* test_allocator_allocate(CnxAllocator* restrict self, usize size_bytes) {
+	++test_allocator_live_allocations;
+	++test_allocator_total_allocations;
+	return cnx_allocate(self, size_bytes);
+}
+
+static void* test_allocator_reallocate(CnxAllocator* restrict self,
+									   void* memory,
+									   usize new_size_bytes) {
+	++test_allocator_total_allocations;
+	return cnx_reallocate(self, memory, new_size_bytes);
+}
+
+static void test_allocator_deallocate(CnxAllocator* restrict self, void* memory) {
+	--test_allocator_live_allocations;
+	cnx_deallocate(self, memory);
+}
+
+static const CnxAllocatorVTable test_allocator_vtable = {.allocate = test_allocator_allocate,
+														.reallocate = test_allocator_reallocate,
+														.deallocate = test_allocator_deallocate};
+
+/// @brief Returns an allocator that counts its allocations, after resetting the counts
+///
+/// `test_allocator_live_allocations` is the number of allocations that haven't been freed, and
+/// `test_allocator_total_allocations` is the number of calls to allocate or reallocate
+static inline CnxAllocator test_allocator_new(void) {
+	test_allocator_live_allocations = 0;
+	test_allocator_total_allocations = 0;
+	return (CnxAllocator){.m_self = nullptr, .m_vtable = &test_allocator_vtable};
+}
+
+#endif // CNX_TEST_ALLOCATOR
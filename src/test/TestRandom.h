@@ -0,0 +1,14 @@
+#ifndef CNX_TEST_RANDOM
+#define CNX_TEST_RANDOM
+
+#include <Cnx/BasicTypes.h>
+
+/// @brief Advances the given linear congruential generator state, returning its next value
+///
+/// This is deterministic for a given initial state, so failures are reproducible
+static inline u32 test_random(u32* restrict state) {
+	*state = *state * 1664525U + 1013904223U; // NOLINT
+	return *state >> 8U; // NOLINT
+}
+
+#endif // CNX_TEST_RANDOM
@@ -0,0 +1,11 @@
+#ifndef CNX_TEST_VIEW
+#define CNX_TEST_VIEW
+
+#include <Cnx/String.h>
+#include <string.h>
+
+static inline CnxStringView test_view(restrict const_cstring string) {
+	return cnx_stringview_from(string, 0, strlen(string));
+}
+
+#endif // CNX_TEST_VIEW
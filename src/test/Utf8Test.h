@@ -0,0 +1,315 @@
+#ifndef CNX_UTF8_TEST
+#define CNX_UTF8_TEST
+
+#include <Cnx/Allocators.h>
+#include <Cnx/Utf8.h>
+
+#include "Criterion.h"
+#include "TestRandom.h"
+
+#define UTF8_TEST_MAX_LENGTH 160
+
+/// @brief Well-formed and ill-formed sequences to build test inputs from
+static const_cstring utf8_test_fragments[] = {
+	"a",
+	"hello, world ",
+	"0123456789abcdef0123456789abcdef",
+	"\xC3\xA9",
+	"\xE2\x82\xAC",
+	"\xEF\xBF\xBD",
+	"\xF0\x9F\x98\x80",
+	"\xF4\x8F\xBF\xBF",
+	"\xED\x9F\xBF",
+	"\x80",
+	"\xBF\xBF",
+	"\xC0\x80",
+	"\xC1\xBF",
+	"\xE0\x80\x80",
+	"\xED\xA0\x80",
+	"\xF0\x80\x80\x80",
+	"\xF4\x90\x80\x80",
+	"\xF5\x80\x80\x80",
+	"\xFF",
+	"\xE2\x82",
+	"\xF0\x9F\x98",
+	"\xC3",
+};
+
+/// @brief Fills `buffer` with a random mix of `utf8_test_fragments`, returning its length
+static inline usize utf8_test_random_input(u32* restrict state, char* restrict buffer) {
+	let num_fragments = sizeof(utf8_test_fragments) / sizeof(utf8_test_fragments[0]);
+	let target_length = static_cast(usize)(test_random(state) % UTF8_TEST_MAX_LENGTH);
+	let_mut length = static_cast(usize)(0);
+	while(length < target_length) {
+		let fragment = utf8_test_fragments[test_random(state) % num_fragments];
+		let fragment_length = strlen(fragment);
+		if(length + fragment_length > UTF8_TEST_MAX_LENGTH) {
+			break;
+		}
+		memcpy(buffer + length, fragment, fragment_length);
+		length += fragment_length;
+	}
+	buffer[length] = '\0';
+	return length;
+}
+
+/// @brief Finds the first ill-formed sequence by checking that each decoded code point
+/// re-encodes to the bytes it was decoded from, independently of the vectorized validators
+static inline usize utf8_test_reference_find_invalid(const_cstring data, usize length) {
+	let_mut index = static_cast(usize)(0);
+	while(index < length) {
+		let start = index;
+		let code_point = cnx_utf8_decode(data, length, &index);
+		char encoded[CNX_UTF8_MAX_SEQUENCE_LENGTH] = {0};
+		let encoded_length = cnx_utf8_encode(code_point, encoded);
+		if(encoded_length != index - start || memcmp(encoded, data + start, encoded_length) != 0)
+		{
+			return start;
+		}
+	}
+	return length;
+}
+
+TEST(CnxUtf8, validate) {
+	TEST_ASSERT_TRUE(cnx_utf8_validate("", 0));
+	TEST_ASSERT_TRUE(cnx_utf8_validate("plain ascii", 11));
+	TEST_ASSERT_TRUE(cnx_utf8_validate("caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80", 14));
+	TEST_ASSERT_TRUE(cnx_utf8_validate("\xF4\x8F\xBF\xBF", 4));
+
+	// overlong, surrogate, out of range, stray continuation, and truncated sequences
+	TEST_ASSERT_FALSE(cnx_utf8_validate("\xC0\xAF", 2));
+	TEST_ASSERT_FALSE(cnx_utf8_validate("\xE0\x9F\xBF", 3));
+	TEST_ASSERT_FALSE(cnx_utf8_validate("\xF0\x8F\xBF\xBF", 4));
+	TEST_ASSERT_FALSE(cnx_utf8_validate("\xED\xA0\x80", 3));
+	TEST_ASSERT_FALSE(cnx_utf8_validate("\xF4\x90\x80\x80", 4));
+	TEST_ASSERT_FALSE(cnx_utf8_validate("\xF8\x88\x80\x80\x80", 5));
+	TEST_ASSERT_FALSE(cnx_utf8_validate("a\x80", 2));
+	TEST_ASSERT_FALSE(cnx_utf8_validate("\xE2\x82", 2));
+	TEST_ASSERT_FALSE(cnx_utf8_validate("\xE2\x82z", 3));
+
+	TEST_ASSERT_EQUAL(cnx_utf8_find_invalid("abc\xC3\xA9\xFF", 6), 5U);
+	TEST_ASSERT_EQUAL(cnx_utf8_find_invalid("abc\xC3\xA9", 5), 5U);
+}
+
+TEST(CnxUtf8, validate_across_blocks) {
+	// place each sequence at every offset around the 16- and 32-byte block boundaries, so that
+	// errors and incomplete sequences are carried between blocks
+	static const_cstring sequences[]
+		= {"\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\xE2\x82", "\xED\xA0\x80"};
+	static const bool valid[] = {true, true, false, false};
+	char buffer[UTF8_TEST_MAX_LENGTH + 1] = {0};
+	for(let_mut i = 0U; i < sizeof(sequences) / sizeof(sequences[0]); ++i) {
+		let sequence_length = strlen(sequences[i]);
+		for(let_mut offset = 0U; offset < 70U; ++offset) {
+			memset(buffer, 'x', sizeof(buffer) - 1);
+			memcpy(buffer + offset, sequences[i], sequence_length);
+			TEST_ASSERT_EQUAL(cnx_utf8_validate(buffer, UTF8_TEST_MAX_LENGTH), valid[i]);
+			// also as the very end of the input
+			TEST_ASSERT_EQUAL(cnx_utf8_validate(buffer, offset + sequence_length), valid[i]);
+		}
+	}
+}
+
+TEST(CnxUtf8, validate_matches_reference) {
+	let_mut state = 42U;
+	char buffer[UTF8_TEST_MAX_LENGTH + 1] = {0};
+	for(let_mut i = 0; i < 5000; ++i) {
+		let length = utf8_test_random_input(&state, buffer);
+		let expected = utf8_test_reference_find_invalid(buffer, length);
+		TEST_ASSERT_EQUAL(cnx_utf8_validate(buffer, length), expected == length);
+		TEST_ASSERT_EQUAL(cnx_utf8_find_invalid(buffer, length), expected);
+	}
+}
+
+TEST(CnxUtf8, is_ascii) {
+	TEST_ASSERT_TRUE(cnx_utf8_is_ascii("", 0));
+	TEST_ASSERT_TRUE(cnx_utf8_is_ascii("0123456789abcdef0123456789abcdef!", 33));
+	TEST_ASSERT_FALSE(cnx_utf8_is_ascii("0123456789abcdef0123456789abcdef\xC3\xA9", 34));
+
+	let view = cnx_stringview_from("caf\xC3\xA9", 0, 5);
+	TEST_ASSERT_FALSE(cnx_stringview_is_ascii(view));
+	TEST_ASSERT_TRUE(cnx_stringview_is_valid_utf8(view));
+	CnxScopedString string = cnx_string_from("ascii");
+	TEST_ASSERT_TRUE(cnx_string_is_ascii(string));
+	TEST_ASSERT_TRUE(cnx_string_is_valid_utf8(string));
+}
+
+TEST(CnxUtf8, decode_and_encode) {
+	let data = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\xE2\x82";
+	let length = strlen(data);
+	let_mut index = static_cast(usize)(0);
+	TEST_ASSERT_EQUAL(cnx_utf8_decode(data, length, &index), 0x61U);
+	TEST_ASSERT_EQUAL(cnx_utf8_decode(data, length, &index), 0xE9U);
+	TEST_ASSERT_EQUAL(cnx_utf8_decode(data, length, &index), 0x20ACU);
+	TEST_ASSERT_EQUAL(cnx_utf8_decode(data, length, &index), 0x1F600U);
+	// the truncated sequence is one maximal subpart
+	TEST_ASSERT_EQUAL(cnx_utf8_decode(data, length, &index), CNX_UTF8_REPLACEMENT_CHARACTER);
+	TEST_ASSERT_EQUAL(index, length);
+
+	char encoded[CNX_UTF8_MAX_SEQUENCE_LENGTH] = {0};
+	TEST_ASSERT_EQUAL(cnx_utf8_encode(0x20ACU, encoded), 3U);
+	TEST_ASSERT_EQUAL(memcmp(encoded, "\xE2\x82\xAC", 3), 0);
+	TEST_ASSERT_EQUAL(cnx_utf8_encode(0xD800U, encoded), 3U);
+	TEST_ASSERT_EQUAL(memcmp(encoded, "\xEF\xBF\xBD", 3), 0);
+}
+
+TEST(CnxUtf8, transcode) {
+	let data = "ASCII prefix that spans a block: caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80";
+	let length = strlen(data);
+	let utf16_length = cnx_utf8_utf16_length(data, length);
+	let utf32_length = cnx_utf8_utf32_length(data, length);
+	TEST_ASSERT_EQUAL(utf32_length, 41U);
+	TEST_ASSERT_EQUAL(utf16_length, 42U);
+
+	let_mut utf16 = cnx_allocator_allocate_array_t(u16, DEFAULT_ALLOCATOR, utf16_length);
+	TEST_ASSERT_EQUAL(cnx_utf8_to_utf16(data, length, utf16), utf16_length);
+	TEST_ASSERT_EQUAL(utf16[0], 'A');
+	TEST_ASSERT_EQUAL(utf16[36], 0xE9U);
+	TEST_ASSERT_EQUAL(utf16[38], 0x20ACU);
+	TEST_ASSERT_EQUAL(utf16[40], 0xD83DU);
+	TEST_ASSERT_EQUAL(utf16[41], 0xDE00U);
+
+	let_mut utf32 = cnx_allocator_allocate_array_t(u32, DEFAULT_ALLOCATOR, utf32_length);
+	TEST_ASSERT_EQUAL(cnx_utf8_to_utf32(data, length, utf32), utf32_length);
+	TEST_ASSERT_EQUAL(utf32[36], 0xE9U);
+	TEST_ASSERT_EQUAL(utf32[40], 0x1F600U);
+
+	TEST_ASSERT_EQUAL(cnx_utf16_utf8_length(utf16, utf16_length), length);
+	TEST_ASSERT_EQUAL(cnx_utf32_utf8_length(utf32, utf32_length), length);
+	CnxScopedString from_utf16 = cnx_string_from_utf16(utf16, utf16_length);
+	CnxScopedString from_utf32 = cnx_string_from_utf32(utf32, utf32_length);
+	TEST_ASSERT_TRUE(cnx_string_equal(from_utf16, data));
+	TEST_ASSERT_TRUE(cnx_string_equal(from_utf32, data));
+
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, utf16);
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, utf32);
+
+	// unpaired surrogates and invalid code points become U+FFFD
+	let unpaired = (const u16[]){'a', 0xDC00U, 0xD800U}; // NOLINT
+	CnxScopedString from_unpaired = cnx_string_from_utf16(unpaired, 3);
+	TEST_ASSERT_TRUE(cnx_string_equal(from_unpaired, "a\xEF\xBF\xBD\xEF\xBF\xBD"));
+	let invalid = (const u32[]){0x110000U, 'b'}; // NOLINT
+	CnxScopedString from_invalid = cnx_string_from_utf32(invalid, 2);
+	TEST_ASSERT_TRUE(cnx_string_equal(from_invalid, "\xEF\xBF\xBD" "b"));
+}
+
+/// @brief Transcodes `data` to UTF-16 and UTF-32, checking both against `expected`, which
+/// contains no supplementary code points
+static inline void utf8_test_transcode_equals(restrict const_cstring data,
+											  const u32* restrict expected,
+											  usize expected_length) {
+	let length = strlen(data);
+	u16 utf16[UTF8_TEST_MAX_LENGTH] = {0};
+	u32 utf32[UTF8_TEST_MAX_LENGTH] = {0};
+	TEST_ASSERT_EQUAL(cnx_utf8_utf16_length(data, length), expected_length);
+	TEST_ASSERT_EQUAL(cnx_utf8_utf32_length(data, length), expected_length);
+	TEST_ASSERT_EQUAL(cnx_utf8_to_utf16(data, length, utf16), expected_length);
+	TEST_ASSERT_EQUAL(cnx_utf8_to_utf32(data, length, utf32), expected_length);
+	for(let_mut i = 0U; i < expected_length; ++i) {
+		TEST_ASSERT_EQUAL(utf16[i], expected[i]);
+		TEST_ASSERT_EQUAL(utf32[i], expected[i]);
+	}
+}
+
+TEST(CnxUtf8, transcode_replaces_ill_formed_sequences) {
+	let replacement = CNX_UTF8_REPLACEMENT_CHARACTER;
+	// a stray continuation byte is replaced, not dropped
+	utf8_test_transcode_equals(
+		"<scr\x80ipt>",
+		(const u32[]){'<', 's', 'c', 'r', replacement, 'i', 'p', 't', '>'},
+		9U);
+	// an invalid lead byte is one replacement character in both UTF-16 and UTF-32
+	utf8_test_transcode_equals("a\xF8z", (const u32[]){'a', replacement, 'z'}, 3U);
+	// one replacement character per maximal subpart, as `cnx_utf8_decode` does
+	utf8_test_transcode_equals("\xF0\x80\x80\x80",
+							   (const u32[]){replacement, replacement, replacement, replacement},
+							   4U);
+	utf8_test_transcode_equals("\xF0\x9F\x98z", (const u32[]){replacement, 'z'}, 2U);
+
+	CnxScopedString string = cnx_string_from("<scr\x80ipt>");
+	let_mut wide = cnx_string_into_wcstring(string);
+	TEST_ASSERT_EQUAL(wcslen(wide), 9U);
+	TEST_ASSERT_EQUAL(static_cast(u32)(wide[4]), replacement);
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, static_cast(wcstring)(wide));
+}
+
+TEST(CnxUtf8, transcode_ill_formed_lengths_are_exact) {
+	// transcoding untrusted input must never write more than the precomputed length
+	let_mut state = 7U;
+	char buffer[UTF8_TEST_MAX_LENGTH + 1] = {0};
+	u16 utf16[UTF8_TEST_MAX_LENGTH * 2] = {0};
+	u32 utf32[UTF8_TEST_MAX_LENGTH] = {0};
+	char round_trip[UTF8_TEST_MAX_LENGTH * 3] = {0};
+	for(let_mut i = 0; i < 5000; ++i) {
+		let length = utf8_test_random_input(&state, buffer);
+		let utf16_length = cnx_utf8_utf16_length(buffer, length);
+		let utf32_length = cnx_utf8_utf32_length(buffer, length);
+		TEST_ASSERT_EQUAL(cnx_utf8_to_utf16(buffer, length, utf16), utf16_length);
+		TEST_ASSERT_EQUAL(cnx_utf8_to_utf32(buffer, length, utf32), utf32_length);
+		// every code point `cnx_utf8_decode` yields, replacement characters included, is kept
+		let_mut num_code_points = static_cast(usize)(0);
+		for(let_mut index = static_cast(usize)(0); index < length; ++num_code_points) {
+			ignore(cnx_utf8_decode(buffer, length, &index));
+		}
+		TEST_ASSERT_EQUAL(utf32_length, num_code_points);
+		TEST_ASSERT_EQUAL(cnx_utf16_to_utf8(utf16, utf16_length, round_trip),
+						  cnx_utf16_utf8_length(utf16, utf16_length));
+		if(cnx_utf8_validate(buffer, length)) {
+			TEST_ASSERT_EQUAL(cnx_utf32_utf8_length(utf32, utf32_length), length);
+		}
+	}
+}
+
+TEST(CnxUtf8, code_points) {
+	let view = cnx_stringview_from("a\xC3\xA9\xF0\x9F\x98\x80\x80z", 0, 9);
+	static const u32 expected[] = {0x61U, 0xE9U, 0x1F600U, CNX_UTF8_REPLACEMENT_CHARACTER, 0x7AU};
+
+	let_mut code_points = cnx_stringview_code_points(view);
+	let_mut count = 0U;
+	foreach(code_point, code_points) {
+		TEST_ASSERT_EQUAL(code_point, expected[count]);
+		++count;
+	}
+	TEST_ASSERT_EQUAL(count, 5U);
+
+	// iterating again starts from the beginning
+	count = 0U;
+	foreach(code_point, code_points) {
+		TEST_ASSERT_EQUAL(code_point, expected[count]);
+		++count;
+	}
+	TEST_ASSERT_EQUAL(count, 5U);
+
+	cnx_code_point_iterator_reset(code_points);
+	let_mut first = cnx_code_point_iterator_next(code_points);
+	TEST_ASSERT_EQUAL(cnx_option_unwrap(first), 0x61U);
+	let remainder = cnx_code_point_iterator_remainder(code_points);
+	TEST_ASSERT_EQUAL(remainder.m_length, 8U);
+	for(let_mut i = 0; i < 4; ++i) {
+		let_mut next = cnx_code_point_iterator_next(code_points);
+		TEST_ASSERT_TRUE(cnx_option_is_some(next));
+	}
+	let_mut last = cnx_code_point_iterator_next(code_points);
+	TEST_ASSERT_TRUE(cnx_option_is_none(last));
+
+	CnxScopedString empty = cnx_string_new();
+	let_mut no_code_points = cnx_string_code_points(empty);
+	foreach(code_point, no_code_points) {
+		ignore(code_point);
+		TEST_ASSERT_TRUE(false);
+	}
+}
+
+TEST(CnxUtf8, wcstring) {
+	CnxScopedString string = cnx_string_from("wide caf\xC3\xA9 \xF0\x9F\x98\x80");
+	let_mut wide = cnx_string_into_wcstring(string);
+	TEST_ASSERT_EQUAL(wide[0], L'w');
+	TEST_ASSERT_EQUAL(wide[wcslen(wide) - 1 - (sizeof(wchar_t) == sizeof(u16))],
+					  (sizeof(wchar_t) == sizeof(u32) ? 0x1F600 : 0xD83D));
+
+	CnxScopedString round_trip = cnx_string_from_wcstring(wide, wcslen(wide));
+	TEST_ASSERT_TRUE(cnx_string_equal(round_trip, &string));
+	cnx_allocator_deallocate(DEFAULT_ALLOCATOR, static_cast(wcstring)(wide));
+}
+
+#endif // CNX_UTF8_TEST
@@ -252,4 +252,304 @@ TEST(CnxVector, iterator) {
 	cnx_vector_free(vec2);
 }
 
+TEST(CnxVector, extend) {
+	let_mut vec = cnx_vector_new(u32);
+	u32 elements[SHORT_OPT_CAPACITY * 4U];
+	for(let_mut i = 0U; i < SHORT_OPT_CAPACITY * 4U; ++i) {
+		elements[i] = i;
+	}
+
+	cnx_vector_extend(vec, elements, 2U);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), 2U);
+	cnx_vector_extend(vec, elements + 2U, SHORT_OPT_CAPACITY * 4U - 2U);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), SHORT_OPT_CAPACITY * 4U);
+	for(let_mut i = 0U; i < SHORT_OPT_CAPACITY * 4U; ++i) {
+		TEST_ASSERT_EQUAL(cnx_vector_at(vec, i), i);
+	}
+
+	let_mut vec2 = cnx_vector_new(u32);
+	cnx_vector_push_back(vec2, 42U);
+	cnx_vector_extend_from_vector(vec2, vec);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec2), SHORT_OPT_CAPACITY * 4U + 1U);
+	TEST_ASSERT_EQUAL(cnx_vector_front(vec2), 42U);
+	TEST_ASSERT_EQUAL(cnx_vector_back(vec2), SHORT_OPT_CAPACITY * 4U - 1U);
+
+	let span = cnx_span_new(u32, elements, 3U);
+	cnx_vector_extend_from_span(vec2, span);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec2), SHORT_OPT_CAPACITY * 4U + 4U);
+	TEST_ASSERT_EQUAL(cnx_vector_back(vec2), 2U);
+
+	cnx_vector_free(vec);
+	cnx_vector_free(vec2);
+}
+
+TEST(CnxVector, extend_from_iter) {
+	let_mut vec = cnx_vector_new(u32);
+	for(let_mut i = 0U; i < SHORT_OPT_CAPACITY * 2U; ++i) {
+		cnx_vector_push_back(vec, i);
+	}
+
+	let data = (CnxCollectionData(CnxVector(u32))){.m_constructor = vector_test_constructor,
+												   .m_copy_constructor = vector_test_copy_constructor,
+												   .m_destructor = vector_test_destructor};
+	let_mut vec2 = cnx_vector_new_with_collection_data(u32, &data);
+	let begin = cnx_vector_begin(vec);
+	let end = cnx_vector_end(vec);
+	cnx_vector_extend_from_iter(vec2,
+								cnx_iterator_into_forward_iterator(begin),
+								cnx_iterator_into_forward_iterator(end));
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec2), cnx_vector_size(vec));
+	for(let_mut i = 0U; i < cnx_vector_size(vec); ++i) {
+		TEST_ASSERT_EQUAL(cnx_vector_at(vec2, i), cnx_vector_at(vec, i));
+	}
+
+	let_mut vec3 = cnx_vector_new(u32);
+	let_mut range = cnx_range_from(u32, vec);
+	cnx_vector_extend_from_range(vec3, range);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec3), cnx_vector_size(vec));
+	TEST_ASSERT_EQUAL(cnx_vector_back(vec3), SHORT_OPT_CAPACITY * 2U - 1U);
+
+	cnx_vector_free(vec);
+	cnx_vector_free(vec2);
+	cnx_vector_free(vec3);
+}
+
+TEST(CnxVector, insert_n) {
+	let_mut vec = cnx_vector_new(u32);
+	for(let_mut i = 0U; i < SHORT_OPT_CAPACITY; ++i) {
+		cnx_vector_push_back(vec, i);
+	}
+
+	u32 elements[SHORT_OPT_CAPACITY * 2U];
+	for(let_mut i = 0U; i < SHORT_OPT_CAPACITY * 2U; ++i) {
+		elements[i] = 100U + i;
+	}
+
+	cnx_vector_insert_n(vec, elements, SHORT_OPT_CAPACITY * 2U, 1U);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), SHORT_OPT_CAPACITY * 3U);
+	TEST_ASSERT_EQUAL(cnx_vector_front(vec), 0U);
+	for(let_mut i = 0U; i < SHORT_OPT_CAPACITY * 2U; ++i) {
+		TEST_ASSERT_EQUAL(cnx_vector_at(vec, i + 1U), 100U + i);
+	}
+	for(let_mut i = 1U; i < SHORT_OPT_CAPACITY; ++i) {
+		TEST_ASSERT_EQUAL(cnx_vector_at(vec, SHORT_OPT_CAPACITY * 2U + i), i);
+	}
+
+	cnx_vector_insert_n(vec, elements, 2U, cnx_vector_size(vec));
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), SHORT_OPT_CAPACITY * 3U + 2U);
+	TEST_ASSERT_EQUAL(cnx_vector_back(vec), 101U);
+
+	cnx_vector_free(vec);
+}
+
+TEST(CnxVector, assign) {
+	let_mut vec = cnx_vector_new(u32);
+	for(let_mut i = 0U; i < SHORT_OPT_CAPACITY * 2U; ++i) {
+		cnx_vector_push_back(vec, i);
+	}
+
+	u32 elements[3] = {7U, 8U, 9U};
+	cnx_vector_assign(vec, elements, 3U);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), 3U);
+	for(let_mut i = 0U; i < 3U; ++i) {
+		TEST_ASSERT_EQUAL(cnx_vector_at(vec, i), elements[i]);
+	}
+
+	cnx_vector_free(vec);
+}
+
+TEST(CnxVector, resize_for_overwrite) {
+	let_mut vec = cnx_vector_new(u32);
+	cnx_vector_resize_for_overwrite(vec, SHORT_OPT_CAPACITY * 2U);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), SHORT_OPT_CAPACITY * 2U);
+	TEST_ASSERT_GREATER_THAN_OR_EQUAL(cnx_vector_capacity(vec), SHORT_OPT_CAPACITY * 2U);
+
+	let_mut data = cnx_vector_data_mut(vec);
+	for(let_mut i = 0U; i < SHORT_OPT_CAPACITY * 2U; ++i) {
+		data[i] = i;
+	}
+	cnx_vector_resize_for_overwrite(vec, 2U);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), 2U);
+	TEST_ASSERT_EQUAL(cnx_vector_back(vec), 1U);
+
+	cnx_vector_free(vec);
+}
+
+u32 vector_test_nonzero_constructor(CnxAllocator allocator) {
+	ignore(allocator);
+	return 7U;
+}
+
+TEST(CnxVector, resize_grow_and_shrink) {
+	let_mut vec = cnx_vector_new(u32);
+	for(let_mut i = 0U; i < 3U; ++i) {
+		cnx_vector_push_back(vec, i + 1U);
+	}
+
+	cnx_vector_resize(vec, SHORT_OPT_CAPACITY * 3U);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), SHORT_OPT_CAPACITY * 3U);
+	for(let_mut i = 0U; i < 3U; ++i) {
+		TEST_ASSERT_EQUAL(cnx_vector_at(vec, i), i + 1U);
+	}
+	for(let_mut i = 3U; i < SHORT_OPT_CAPACITY * 3U; ++i) {
+		TEST_ASSERT_EQUAL(cnx_vector_at(vec, i), 0U);
+	}
+
+	cnx_vector_resize(vec, 2U);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), 2U);
+	TEST_ASSERT_EQUAL(cnx_vector_capacity(vec), SHORT_OPT_CAPACITY);
+	TEST_ASSERT_EQUAL(cnx_vector_back(vec), 2U);
+	cnx_vector_free(vec);
+
+	let data = (CnxCollectionData(CnxVector(u32))){.m_constructor = vector_test_nonzero_constructor,
+												   .m_copy_constructor = vector_test_copy_constructor,
+												   .m_destructor = vector_test_destructor};
+	let_mut vec2 = cnx_vector_new_with_collection_data(u32, &data);
+	cnx_vector_push_back(vec2, 1U);
+	cnx_vector_resize(vec2, SHORT_OPT_CAPACITY * 2U);
+	TEST_ASSERT_EQUAL(cnx_vector_front(vec2), 1U);
+	for(let_mut i = 1U; i < SHORT_OPT_CAPACITY * 2U; ++i) {
+		TEST_ASSERT_EQUAL(cnx_vector_at(vec2, i), 7U);
+	}
+	cnx_vector_free(vec2);
+}
+
+TEST(CnxVector, clone) {
+	let_mut vec = cnx_vector_new(u32);
+	for(let_mut i = 0U; i < SHORT_OPT_CAPACITY * 2U; ++i) {
+		cnx_vector_push_back(vec, i);
+	}
+
+	let_mut cloned = cnx_vector_clone(vec);
+	TEST_ASSERT_EQUAL(cnx_vector_size(cloned), cnx_vector_size(vec));
+	for(let_mut i = 0U; i < cnx_vector_size(vec); ++i) {
+		TEST_ASSERT_EQUAL(cnx_vector_at(cloned, i), cnx_vector_at(vec, i));
+	}
+	cnx_vector_at_mut(cloned, 0) = 42U;
+	TEST_ASSERT_EQUAL(cnx_vector_front(vec), 0U);
+
+	let data = (CnxCollectionData(CnxVector(u32))){.m_constructor = vector_test_constructor,
+												   .m_copy_constructor = vector_test_copy_constructor,
+												   .m_destructor = vector_test_destructor};
+	let_mut vec2 = cnx_vector_new_with_collection_data(u32, &data);
+	for(let_mut i = 0U; i < 3U; ++i) {
+		cnx_vector_push_back(vec2, i);
+	}
+	let_mut cloned2 = cnx_vector_clone(vec2);
+	TEST_ASSERT_EQUAL(cnx_vector_size(cloned2), 3U);
+	TEST_ASSERT_EQUAL(cnx_vector_back(cloned2), 2U);
+
+	cnx_vector_free(vec);
+	cnx_vector_free(cloned);
+	cnx_vector_free(vec2);
+	cnx_vector_free(cloned2);
+}
+
+static bool vector_test_is_even(const u32* restrict elem) {
+	return *elem % 2U == 0U;
+}
+
+static usize vector_test_destructor_calls = 0U;
+
+void vector_test_counting_destructor(u32* elem, CnxAllocator allocator) { // NOLINT
+	ignore(elem);
+	ignore(allocator);
+	++vector_test_destructor_calls;
+}
+
+TEST(CnxVector, retain_and_erase_if) {
+	let data = (CnxCollectionData(CnxVector(u32))){.m_constructor = vector_test_constructor,
+												   .m_copy_constructor = vector_test_copy_constructor,
+												   .m_destructor = vector_test_counting_destructor};
+	let_mut vec = cnx_vector_new_with_collection_data(u32, &data);
+	for(let_mut i = 0U; i < SHORT_OPT_CAPACITY * 4U; ++i) {
+		cnx_vector_push_back(vec, i);
+	}
+
+	vector_test_destructor_calls = 0U;
+	let removed = cnx_vector_retain(vec, vector_test_is_even);
+	TEST_ASSERT_EQUAL(removed, SHORT_OPT_CAPACITY * 2U);
+	TEST_ASSERT_EQUAL(vector_test_destructor_calls, SHORT_OPT_CAPACITY * 2U);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), SHORT_OPT_CAPACITY * 2U);
+	for(let_mut i = 0U; i < cnx_vector_size(vec); ++i) {
+		TEST_ASSERT_EQUAL(cnx_vector_at(vec, i), i * 2U);
+	}
+
+	let erased = cnx_vector_erase_if(vec, vector_test_is_even);
+	TEST_ASSERT_EQUAL(erased, SHORT_OPT_CAPACITY * 2U);
+	TEST_ASSERT_TRUE(cnx_vector_is_empty(vec));
+	TEST_ASSERT_EQUAL(cnx_vector_erase_if(vec, vector_test_is_even), 0U);
+
+	cnx_vector_free(vec);
+}
+
+bool LambdaFunction(vector_test_less_than, const u32* restrict elem) {
+	let binding = lambda_binding(u32);
+	return *elem < binding._1;
+}
+
+TEST(CnxVector, retain_and_erase_if_lambda) {
+	let_mut vec = cnx_vector_new(u32);
+	for(let_mut i = 0U; i < SHORT_OPT_CAPACITY * 4U; ++i) {
+		cnx_vector_push_back(vec, i);
+	}
+
+	ScopedLambda less_than_ten
+		= lambda_cast(lambda(vector_test_less_than, 10U), CnxVectorPredicateLambda(u32));
+	let erased = cnx_vector_erase_if_lambda(vec, less_than_ten);
+	TEST_ASSERT_EQUAL(erased, 10U);
+	TEST_ASSERT_EQUAL(cnx_vector_front(vec), 10U);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), SHORT_OPT_CAPACITY * 4U - 10U);
+
+	ScopedLambda less_than_twenty
+		= lambda_cast(lambda(vector_test_less_than, 20U), CnxVectorPredicateLambda(u32));
+	let removed = cnx_vector_retain_lambda(vec, less_than_twenty);
+	TEST_ASSERT_EQUAL(removed, SHORT_OPT_CAPACITY * 4U - 20U);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), 10U);
+	for(let_mut i = 0U; i < cnx_vector_size(vec); ++i) {
+		TEST_ASSERT_EQUAL(cnx_vector_at(vec, i), i + 10U);
+	}
+
+	cnx_vector_free(vec);
+}
+
+TEST(CnxVector, erase_range) {
+	let_mut vec = cnx_vector_new(u32);
+	for(let_mut i = 0U; i < SHORT_OPT_CAPACITY * 2U; ++i) {
+		cnx_vector_push_back(vec, i);
+	}
+
+	cnx_vector_erase_range(vec, 2U, 5U);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), SHORT_OPT_CAPACITY * 2U - 3U);
+	TEST_ASSERT_EQUAL(cnx_vector_at(vec, 1U), 1U);
+	TEST_ASSERT_EQUAL(cnx_vector_at(vec, 2U), 5U);
+
+	cnx_vector_erase_range(vec, 4U, 4U);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), SHORT_OPT_CAPACITY * 2U - 3U);
+
+	cnx_vector_erase_range(vec, 3U, cnx_vector_size(vec));
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), 3U);
+	TEST_ASSERT_EQUAL(cnx_vector_back(vec), 5U);
+
+	cnx_vector_free(vec);
+}
+
+TEST(CnxVector, swap_remove) {
+	let_mut vec = cnx_vector_new(u32);
+	for(let_mut i = 0U; i < 5U; ++i) {
+		cnx_vector_push_back(vec, i);
+	}
+
+	cnx_vector_swap_remove(vec, 1U);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), 4U);
+	TEST_ASSERT_EQUAL(cnx_vector_at(vec, 1U), 4U);
+	TEST_ASSERT_EQUAL(cnx_vector_back(vec), 3U);
+
+	cnx_vector_swap_remove(vec, 3U);
+	TEST_ASSERT_EQUAL(cnx_vector_size(vec), 3U);
+	TEST_ASSERT_EQUAL(cnx_vector_back(vec), 2U);
+
+	cnx_vector_free(vec);
+}
+
 #endif // CNX_VECTOR_TEST